@@ -495,6 +495,14 @@ int libnsfdb_bucket_read(
 	 ( (nsfdb_bucket_header_t *) bucket_data )->checksum,
 	 stored_checksum );
 #endif
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (nsfdb_bucket_header_t *) bucket_data )->modification_time,
+	 bucket->modification_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_bucket_header_t *) bucket_data )->checksum,
+	 bucket->checksum );
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (nsfdb_bucket_header_t *) bucket_data )->number_of_slots,
 	 number_of_slots );
@@ -819,6 +827,77 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the bucket key
+ * The key consists of the modification time and checksum stored in the bucket header
+ * and is used to determine if a cached bucket is still valid
+ * Only the bucket header is read
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_bucket_read_key(
+     libbfio_handle_t *file_io_handle,
+     off64_t bucket_offset,
+     uint64_t *modification_time,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	nsfdb_bucket_header_t bucket_header;
+
+	static char *function = "libnsfdb_bucket_read_key";
+	ssize_t read_count    = 0;
+
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &bucket_header,
+	              sizeof( nsfdb_bucket_header_t ),
+	              bucket_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( nsfdb_bucket_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read bucket header data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+		 function,
+		 bucket_offset,
+		 bucket_offset );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 bucket_header.modification_time,
+	 *modification_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_header.checksum,
+	 *checksum );
+
+	return( 1 );
+}
+
 /* Reads the bucket index
  * Returns 1 if successful or -1 on error
  */
@@ -75,6 +75,14 @@ struct libnsfdb_bucket
 	 */
 	uint32_t data_size;
 
+	/* The modification time stored in the bucket header
+	 */
+	uint64_t modification_time;
+
+	/* The checksum stored in the bucket header
+	 */
+	uint32_t checksum;
+
 	/* The bucket slots array
 	 */
 	libcdata_array_t *slots_array;
@@ -110,6 +118,13 @@ int libnsfdb_bucket_read(
      off64_t bucket_offset,
      libcerror_error_t **error );
 
+int libnsfdb_bucket_read_key(
+     libbfio_handle_t *file_io_handle,
+     off64_t bucket_offset,
+     uint64_t *modification_time,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
 int libnsfdb_bucket_read_index(
      libcdata_array_t *bucket_index_array,
      uint32_t number_of_bucket_entries,
@@ -0,0 +1,318 @@
+/*
+ * Bucket reference history functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_bucket_history.h"
+#include "libnsfdb_libcerror.h"
+
+/* Creates a bucket history
+ * Make sure the value bucket_history is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_bucket_history_initialize(
+     libnsfdb_bucket_history_t **bucket_history,
+     int number_of_entries,
+     uint32_t correlated_reference_period,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_bucket_history_initialize";
+	size_t entries_size   = 0;
+
+	if( bucket_history == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket history.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bucket_history != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bucket history value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	entries_size = sizeof( uint32_t ) * (size_t) number_of_entries;
+
+	if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*bucket_history = memory_allocate_structure(
+	                   libnsfdb_bucket_history_t );
+
+	if( *bucket_history == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket history.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bucket_history,
+	     0,
+	     sizeof( libnsfdb_bucket_history_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bucket history.",
+		 function );
+
+		memory_free(
+		 *bucket_history );
+
+		*bucket_history = NULL;
+
+		return( -1 );
+	}
+	( *bucket_history )->bucket_indexes = (uint32_t *) memory_allocate(
+	                                                    entries_size );
+
+	if( ( *bucket_history )->bucket_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket indexes.",
+		 function );
+
+		goto on_error;
+	}
+	/* A bucket index of 0 marks an unused entry since bucket indexes start at 1
+	 */
+	if( memory_set(
+	     ( *bucket_history )->bucket_indexes,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bucket indexes.",
+		 function );
+
+		goto on_error;
+	}
+	( *bucket_history )->reference_times = (uint32_t *) memory_allocate(
+	                                                     entries_size );
+
+	if( ( *bucket_history )->reference_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create reference times.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *bucket_history )->reference_times,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear reference times.",
+		 function );
+
+		goto on_error;
+	}
+	( *bucket_history )->number_of_entries           = number_of_entries;
+	( *bucket_history )->correlated_reference_period = correlated_reference_period;
+
+	return( 1 );
+
+on_error:
+	if( *bucket_history != NULL )
+	{
+		if( ( *bucket_history )->reference_times != NULL )
+		{
+			memory_free(
+			 ( *bucket_history )->reference_times );
+		}
+		if( ( *bucket_history )->bucket_indexes != NULL )
+		{
+			memory_free(
+			 ( *bucket_history )->bucket_indexes );
+		}
+		memory_free(
+		 *bucket_history );
+
+		*bucket_history = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a bucket history
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_bucket_history_free(
+     libnsfdb_bucket_history_t **bucket_history,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_bucket_history_free";
+
+	if( bucket_history == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket history.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bucket_history != NULL )
+	{
+		if( ( *bucket_history )->reference_times != NULL )
+		{
+			memory_free(
+			 ( *bucket_history )->reference_times );
+		}
+		if( ( *bucket_history )->bucket_indexes != NULL )
+		{
+			memory_free(
+			 ( *bucket_history )->bucket_indexes );
+		}
+		memory_free(
+		 *bucket_history );
+
+		*bucket_history = NULL;
+	}
+	return( 1 );
+}
+
+/* References a bucket in the bucket history
+ * A bucket that is referenced again after the correlated reference period
+ * has passed is considered to be reused and should be promoted to the main cache.
+ * References within the correlated reference period, such as the consecutive
+ * slots of a bucket read by a sequential scan, do not promote the bucket.
+ * The history is direct mapped, a bucket can replace an older bucket
+ * in the history that maps to the same entry.
+ * Returns 1 if the bucket should be promoted, 0 if not or -1 on error
+ */
+int libnsfdb_bucket_history_reference(
+     libnsfdb_bucket_history_t *bucket_history,
+     uint32_t bucket_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_bucket_history_reference";
+	uint32_t elapsed_time = 0;
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( bucket_history == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket history.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bucket_history->bucket_indexes == NULL )
+	 || ( bucket_history->reference_times == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid bucket history - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_index == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid bucket index value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_history->current_time += 1;
+
+	entry_index = (int) ( bucket_index % (uint32_t) bucket_history->number_of_entries );
+
+	if( bucket_history->bucket_indexes[ entry_index ] == bucket_index )
+	{
+		elapsed_time = bucket_history->current_time - bucket_history->reference_times[ entry_index ];
+
+		if( elapsed_time > bucket_history->correlated_reference_period )
+		{
+			result = 1;
+		}
+	}
+	else
+	{
+		bucket_history->bucket_indexes[ entry_index ]  = bucket_index;
+		bucket_history->reference_times[ entry_index ] = bucket_history->current_time;
+	}
+	return( result );
+}
+
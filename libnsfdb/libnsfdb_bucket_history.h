@@ -0,0 +1,79 @@
+/*
+ * Bucket reference history functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_BUCKET_HISTORY_H )
+#define _LIBNSFDB_BUCKET_HISTORY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_bucket_history libnsfdb_bucket_history_t;
+
+struct libnsfdb_bucket_history
+{
+	/* The bucket indexes
+	 */
+	uint32_t *bucket_indexes;
+
+	/* The reference times
+	 */
+	uint32_t *reference_times;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The current reference time
+	 */
+	uint32_t current_time;
+
+	/* The correlated reference period
+	 */
+	uint32_t correlated_reference_period;
+};
+
+int libnsfdb_bucket_history_initialize(
+     libnsfdb_bucket_history_t **bucket_history,
+     int number_of_entries,
+     uint32_t correlated_reference_period,
+     libcerror_error_t **error );
+
+int libnsfdb_bucket_history_free(
+     libnsfdb_bucket_history_t **bucket_history,
+     libcerror_error_t **error );
+
+int libnsfdb_bucket_history_reference(
+     libnsfdb_bucket_history_t *bucket_history,
+     uint32_t bucket_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_BUCKET_HISTORY_H ) */
+
@@ -20,9 +20,11 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
 #include "libnsfdb_bucket.h"
+#include "libnsfdb_cache_pool.h"
 #include "libnsfdb_libbfio.h"
 #include "libnsfdb_libcerror.h"
 #include "libnsfdb_libfcache.h"
@@ -75,3 +77,461 @@ int libnsfdb_bucket_list_get_bucket_by_index(
 	return( 1 );
 }
 
+/* Sorts specific summary or non summary bucket indexes by the file offset of the buckets
+ * This allows to read the buckets in order of their file offset to reduce seeking
+ * Buckets are numbered from 1 to N, the bucket indexes are sorted in place
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_bucket_list_sort_bucket_indexes(
+     libfdata_list_t *bucket_list,
+     uint32_t *bucket_indexes,
+     int number_of_bucket_indexes,
+     libcerror_error_t **error )
+{
+	off64_t *bucket_offsets = NULL;
+	static char *function   = "libnsfdb_bucket_list_sort_bucket_indexes";
+	size64_t element_size   = 0;
+	off64_t bucket_offset   = 0;
+	uint32_t bucket_index   = 0;
+	uint32_t element_flags  = 0;
+	int element_file_index  = 0;
+	int index               = 0;
+	int sort_index          = 0;
+
+	if( bucket_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_bucket_indexes < 0 )
+	 || ( (size_t) number_of_bucket_indexes > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bucket indexes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bucket_indexes == 0 )
+	{
+		return( 1 );
+	}
+	bucket_offsets = (off64_t *) memory_allocate(
+	                              sizeof( off64_t ) * (size_t) number_of_bucket_indexes );
+
+	if( bucket_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( index = 0;
+	     index < number_of_bucket_indexes;
+	     index++ )
+	{
+		bucket_index = bucket_indexes[ index ];
+
+		if( bucket_index == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+			 "%s: invalid bucket index: %d value zero or less.",
+			 function,
+			 index );
+
+			goto on_error;
+		}
+		if( libfdata_list_get_element_by_index(
+		     bucket_list,
+		     (int) bucket_index - 1,
+		     &element_file_index,
+		     &bucket_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bucket: %" PRIu32 " element.",
+			 function,
+			 bucket_index );
+
+			goto on_error;
+		}
+		/* Insert the bucket index sorted by offset
+		 */
+		for( sort_index = index;
+		     sort_index > 0;
+		     sort_index-- )
+		{
+			if( bucket_offsets[ sort_index - 1 ] <= bucket_offset )
+			{
+				break;
+			}
+			bucket_offsets[ sort_index ] = bucket_offsets[ sort_index - 1 ];
+			bucket_indexes[ sort_index ] = bucket_indexes[ sort_index - 1 ];
+		}
+		bucket_offsets[ sort_index ] = bucket_offset;
+		bucket_indexes[ sort_index ] = bucket_index;
+	}
+	memory_free(
+	 bucket_offsets );
+
+	return( 1 );
+
+on_error:
+	if( bucket_offsets != NULL )
+	{
+		memory_free(
+		 bucket_offsets );
+	}
+	return( -1 );
+}
+
+/* Updates a summary or non summary bucket list from a refreshed bucket list
+ * A bucket can be rewritten at the same offset, hence all elements are set
+ * which invalidates the buckets cached by the bucket list. If a cache pool
+ * is provided the buckets at both the previous and the reassigned offsets
+ * are removed from it. A bucket in the cache pool at an offset that was kept
+ * is only retained if its key still matches the bucket header in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_bucket_list_update(
+     libfdata_list_t *bucket_list,
+     libfdata_list_t *refreshed_bucket_list,
+     libbfio_handle_t *file_io_handle,
+     libnsfdb_internal_cache_pool_t *cache_pool,
+     uint32_t cache_pool_owner_identifier,
+     uint8_t cache_pool_value_type,
+     int *number_of_updated_elements,
+     libcerror_error_t **error )
+{
+	libnsfdb_bucket_t *cached_bucket    = NULL;
+	static char *function               = "libnsfdb_bucket_list_update";
+	size64_t element_size               = 0;
+	size64_t refreshed_element_size     = 0;
+	off64_t element_offset              = 0;
+	off64_t refreshed_element_offset    = 0;
+	uint64_t modification_time          = 0;
+	uint32_t checksum                   = 0;
+	uint32_t element_flags              = 0;
+	uint32_t refreshed_element_flags    = 0;
+	int element_file_index              = 0;
+	int element_index                   = 0;
+	int number_of_elements              = 0;
+	int number_of_refreshed_elements    = 0;
+	int refreshed_element_file_index    = 0;
+	int result                          = 0;
+	int safe_number_of_updated_elements = 0;
+
+	if( number_of_updated_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of updated elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     bucket_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     refreshed_bucket_list,
+	     &number_of_refreshed_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of refreshed elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     bucket_list,
+		     element_index,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( element_index < number_of_refreshed_elements )
+		{
+			if( libfdata_list_get_element_by_index(
+			     refreshed_bucket_list,
+			     element_index,
+			     &refreshed_element_file_index,
+			     &refreshed_element_offset,
+			     &refreshed_element_size,
+			     &refreshed_element_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve refreshed element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( refreshed_element_offset == element_offset )
+			{
+				if( cache_pool == NULL )
+				{
+					continue;
+				}
+				result = libnsfdb_cache_pool_get_value(
+				          cache_pool,
+				          cache_pool_owner_identifier,
+				          cache_pool_value_type,
+				          element_offset,
+				          (intptr_t **) &cached_bucket,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve element: %d from cache pool.",
+					 function,
+					 element_index );
+
+					return( -1 );
+				}
+				else if( result == 0 )
+				{
+					continue;
+				}
+				/* A bucket that cannot be read could be in the process of being rewritten
+				 */
+				result = libnsfdb_bucket_read_key(
+				          file_io_handle,
+				          element_offset,
+				          &modification_time,
+				          &checksum,
+				          NULL );
+
+				if( ( result == 1 )
+				 && ( modification_time == cached_bucket->modification_time )
+				 && ( checksum == cached_bucket->checksum ) )
+				{
+					result = 0;
+				}
+				else
+				{
+					result = 1;
+				}
+				if( libnsfdb_cache_pool_release_value(
+				     cache_pool,
+				     (intptr_t *) cached_bucket,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release element: %d in cache pool.",
+					 function,
+					 element_index );
+
+					return( -1 );
+				}
+				cached_bucket = NULL;
+
+				if( result == 0 )
+				{
+					continue;
+				}
+			}
+		}
+		if( cache_pool != NULL )
+		{
+			if( libnsfdb_cache_pool_remove_value(
+			     cache_pool,
+			     cache_pool_owner_identifier,
+			     cache_pool_value_type,
+			     element_offset,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove element: %d from cache pool.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+		safe_number_of_updated_elements++;
+	}
+	if( number_of_refreshed_elements != number_of_elements )
+	{
+		if( libfdata_list_resize(
+		     bucket_list,
+		     number_of_refreshed_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize bucket list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( element_index = 0;
+	     element_index < number_of_refreshed_elements;
+	     element_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     refreshed_bucket_list,
+		     element_index,
+		     &refreshed_element_file_index,
+		     &refreshed_element_offset,
+		     &refreshed_element_size,
+		     &refreshed_element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve refreshed element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( element_index < number_of_elements )
+		{
+			if( libfdata_list_get_element_by_index(
+			     bucket_list,
+			     element_index,
+			     &element_file_index,
+			     &element_offset,
+			     &element_size,
+			     &element_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			safe_number_of_updated_elements++;
+		}
+		/* The reassigned offset could have been used by another element
+		 * of which the bucket was rewritten
+		 */
+		if( ( cache_pool != NULL )
+		 && ( ( element_index >= number_of_elements )
+		  ||  ( element_offset != refreshed_element_offset ) ) )
+		{
+			if( libnsfdb_cache_pool_remove_value(
+			     cache_pool,
+			     cache_pool_owner_identifier,
+			     cache_pool_value_type,
+			     refreshed_element_offset,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove refreshed element: %d from cache pool.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+		if( libfdata_list_set_element_by_index(
+		     bucket_list,
+		     element_index,
+		     refreshed_element_file_index,
+		     refreshed_element_offset,
+		     refreshed_element_size,
+		     refreshed_element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+	}
+	*number_of_updated_elements = safe_number_of_updated_elements;
+
+	return( 1 );
+}
+
@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libnsfdb_bucket.h"
+#include "libnsfdb_cache_pool.h"
 #include "libnsfdb_libbfio.h"
 #include "libnsfdb_libcerror.h"
 #include "libnsfdb_libfcache.h"
@@ -43,6 +44,22 @@ int libnsfdb_bucket_list_get_bucket_by_index(
      libnsfdb_bucket_t **bucket,
      libcerror_error_t **error );
 
+int libnsfdb_bucket_list_sort_bucket_indexes(
+     libfdata_list_t *bucket_list,
+     uint32_t *bucket_indexes,
+     int number_of_bucket_indexes,
+     libcerror_error_t **error );
+
+int libnsfdb_bucket_list_update(
+     libfdata_list_t *bucket_list,
+     libfdata_list_t *refreshed_bucket_list,
+     libbfio_handle_t *file_io_handle,
+     libnsfdb_internal_cache_pool_t *cache_pool,
+     uint32_t cache_pool_owner_identifier,
+     uint8_t cache_pool_value_type,
+     int *number_of_updated_elements,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,669 @@
+/*
+ * Bucket prefetch functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_bucket.h"
+#include "libnsfdb_bucket_prefetch.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libcthreads.h"
+#include "libnsfdb_libfcache.h"
+
+/* Creates a bucket prefetch
+ * Make sure the value bucket_prefetch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_bucket_prefetch_initialize(
+     libnsfdb_bucket_prefetch_t **bucket_prefetch,
+     int maximum_number_of_buckets,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_bucket_prefetch_initialize";
+
+	if( bucket_prefetch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket prefetch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bucket_prefetch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bucket prefetch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_buckets <= 0 )
+	 || ( (size_t) maximum_number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*bucket_prefetch = memory_allocate_structure(
+	                    libnsfdb_bucket_prefetch_t );
+
+	if( *bucket_prefetch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket prefetch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bucket_prefetch,
+	     0,
+	     sizeof( libnsfdb_bucket_prefetch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bucket prefetch.",
+		 function );
+
+		memory_free(
+		 *bucket_prefetch );
+
+		*bucket_prefetch = NULL;
+
+		return( -1 );
+	}
+	( *bucket_prefetch )->bucket_indexes = (uint32_t *) memory_allocate(
+	                                                     sizeof( uint32_t ) * (size_t) maximum_number_of_buckets );
+
+	if( ( *bucket_prefetch )->bucket_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket indexes.",
+		 function );
+
+		goto on_error;
+	}
+	( *bucket_prefetch )->bucket_offsets = (off64_t *) memory_allocate(
+	                                                    sizeof( off64_t ) * (size_t) maximum_number_of_buckets );
+
+	if( ( *bucket_prefetch )->bucket_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *bucket_prefetch )->buckets = (libnsfdb_bucket_t **) memory_allocate(
+	                                                        sizeof( libnsfdb_bucket_t * ) * (size_t) maximum_number_of_buckets );
+
+	if( ( *bucket_prefetch )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *bucket_prefetch )->buckets,
+	     0,
+	     sizeof( libnsfdb_bucket_t * ) * (size_t) maximum_number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *bucket_prefetch )->maximum_number_of_buckets = maximum_number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( *bucket_prefetch != NULL )
+	{
+		if( ( *bucket_prefetch )->buckets != NULL )
+		{
+			memory_free(
+			 ( *bucket_prefetch )->buckets );
+		}
+		if( ( *bucket_prefetch )->bucket_offsets != NULL )
+		{
+			memory_free(
+			 ( *bucket_prefetch )->bucket_offsets );
+		}
+		if( ( *bucket_prefetch )->bucket_indexes != NULL )
+		{
+			memory_free(
+			 ( *bucket_prefetch )->bucket_indexes );
+		}
+		memory_free(
+		 *bucket_prefetch );
+
+		*bucket_prefetch = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a bucket prefetch
+ * Waits for the buckets that are being read by the thread
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_bucket_prefetch_free(
+     libnsfdb_bucket_prefetch_t **bucket_prefetch,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_bucket_prefetch_free";
+	int result            = 1;
+
+	if( bucket_prefetch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket prefetch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bucket_prefetch != NULL )
+	{
+		if( libnsfdb_bucket_prefetch_clear(
+		     *bucket_prefetch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear bucket prefetch.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *bucket_prefetch )->thread_file_io_handle != NULL )
+		{
+			if( libbfio_handle_close(
+			     ( *bucket_prefetch )->thread_file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close thread file IO handle.",
+				 function );
+
+				result = -1;
+			}
+			if( libbfio_handle_free(
+			     &( ( *bucket_prefetch )->thread_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free thread file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 ( *bucket_prefetch )->buckets );
+
+		memory_free(
+		 ( *bucket_prefetch )->bucket_offsets );
+
+		memory_free(
+		 ( *bucket_prefetch )->bucket_indexes );
+
+		memory_free(
+		 *bucket_prefetch );
+
+		*bucket_prefetch = NULL;
+	}
+	return( result );
+}
+
+/* Reads the buckets
+ * This function is also the entry point of the prefetch thread
+ * A bucket that cannot be read is skipped, it is read again when it is used
+ * Returns 1
+ */
+int libnsfdb_bucket_prefetch_read_buckets(
+     void *parameters )
+{
+	libnsfdb_bucket_prefetch_t *bucket_prefetch = NULL;
+	libnsfdb_bucket_t *bucket                   = NULL;
+	libcerror_error_t *error                    = NULL;
+	int bucket_index                            = 0;
+
+	bucket_prefetch = (libnsfdb_bucket_prefetch_t *) parameters;
+
+	if( bucket_prefetch == NULL )
+	{
+		return( 1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < bucket_prefetch->number_of_buckets;
+	     bucket_index++ )
+	{
+		if( libnsfdb_bucket_initialize(
+		     &bucket,
+		     &error ) != 1 )
+		{
+			break;
+		}
+		if( libnsfdb_bucket_read(
+		     bucket,
+		     bucket_prefetch->file_io_handle,
+		     bucket_prefetch->bucket_offsets[ bucket_index ],
+		     &error ) != 1 )
+		{
+			libnsfdb_bucket_free(
+			 &bucket,
+			 NULL );
+
+			libcerror_error_free(
+			 &error );
+
+			continue;
+		}
+		bucket_prefetch->buckets[ bucket_index ] = bucket;
+
+		bucket = NULL;
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	bucket_prefetch->buckets_read = 1;
+
+	return( 1 );
+}
+
+/* Starts prefetching buckets
+ * If multi-threading support is available the buckets are read by a thread using a clone
+ * of the file IO handle, otherwise the buckets are read when the prefetch is joined
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_bucket_prefetch_start(
+     libnsfdb_bucket_prefetch_t *bucket_prefetch,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *bucket_cache,
+     const uint32_t *bucket_indexes,
+     const off64_t *bucket_offsets,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_bucket_prefetch_start";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *thread_error = NULL;
+	int result                      = 0;
+#endif
+
+	if( bucket_prefetch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket prefetch.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_prefetch->number_of_buckets != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bucket prefetch - buckets already being prefetched.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets < 0 )
+	 || ( number_of_buckets > bucket_prefetch->maximum_number_of_buckets ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buckets == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     bucket_prefetch->bucket_indexes,
+	     bucket_indexes,
+	     sizeof( uint32_t ) * (size_t) number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy bucket indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     bucket_prefetch->bucket_offsets,
+	     bucket_offsets,
+	     sizeof( off64_t ) * (size_t) number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy bucket offsets.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_prefetch->file_io_handle    = file_io_handle;
+	bucket_prefetch->bucket_cache      = bucket_cache;
+	bucket_prefetch->number_of_buckets = number_of_buckets;
+	bucket_prefetch->buckets_read      = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread cannot share the file IO handle with the file hence it reads using a clone
+	 * the buckets are read when the prefetch is joined if the file IO handle cannot be cloned
+	 */
+	if( ( bucket_prefetch->thread_file_io_handle == NULL )
+	 && ( bucket_prefetch->clone_failed == 0 ) )
+	{
+		result = libbfio_handle_clone(
+		          &( bucket_prefetch->thread_file_io_handle ),
+		          file_io_handle,
+		          &thread_error );
+
+		if( result == 1 )
+		{
+			result = libbfio_handle_is_open(
+			          bucket_prefetch->thread_file_io_handle,
+			          &thread_error );
+
+			if( result == 0 )
+			{
+				result = libbfio_handle_open(
+				          bucket_prefetch->thread_file_io_handle,
+				          LIBBFIO_OPEN_READ,
+				          &thread_error );
+			}
+		}
+		if( result != 1 )
+		{
+			if( bucket_prefetch->thread_file_io_handle != NULL )
+			{
+				libbfio_handle_free(
+				 &( bucket_prefetch->thread_file_io_handle ),
+				 NULL );
+			}
+			libcerror_error_free(
+			 &thread_error );
+
+			bucket_prefetch->clone_failed = 1;
+		}
+	}
+	if( bucket_prefetch->thread_file_io_handle != NULL )
+	{
+		bucket_prefetch->file_io_handle = bucket_prefetch->thread_file_io_handle;
+
+		if( libcthreads_thread_create(
+		     &( bucket_prefetch->thread ),
+		     NULL,
+		     &libnsfdb_bucket_prefetch_read_buckets,
+		     (void *) bucket_prefetch,
+		     &thread_error ) != 1 )
+		{
+			libcerror_error_free(
+			 &thread_error );
+
+			bucket_prefetch->file_io_handle = file_io_handle;
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Waits until the buckets have been read
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_bucket_prefetch_join(
+     libnsfdb_bucket_prefetch_t *bucket_prefetch,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_bucket_prefetch_join";
+
+	if( bucket_prefetch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket prefetch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( bucket_prefetch->thread != NULL )
+	{
+		if( libcthreads_thread_join(
+		     &( bucket_prefetch->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( ( bucket_prefetch->number_of_buckets > 0 )
+	 && ( bucket_prefetch->buckets_read == 0 ) )
+	{
+		libnsfdb_bucket_prefetch_read_buckets(
+		 (void *) bucket_prefetch );
+	}
+	return( 1 );
+}
+
+/* Determines if a bucket is being prefetched
+ * Returns 1 if the bucket is being prefetched or 0 if not
+ */
+int libnsfdb_bucket_prefetch_contains_bucket(
+     libnsfdb_bucket_prefetch_t *bucket_prefetch,
+     uint32_t bucket_index )
+{
+	int entry_index = 0;
+
+	if( bucket_prefetch == NULL )
+	{
+		return( 0 );
+	}
+	for( entry_index = 0;
+	     entry_index < bucket_prefetch->number_of_buckets;
+	     entry_index++ )
+	{
+		if( bucket_prefetch->bucket_indexes[ entry_index ] == bucket_index )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Clears the bucket prefetch
+ * Waits for the buckets that are being read by the thread and frees the buckets
+ * that were not taken
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_bucket_prefetch_clear(
+     libnsfdb_bucket_prefetch_t *bucket_prefetch,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_bucket_prefetch_clear";
+	int bucket_index      = 0;
+	int result            = 1;
+
+	if( bucket_prefetch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket prefetch.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( bucket_prefetch->thread != NULL )
+	{
+		if( libcthreads_thread_join(
+		     &( bucket_prefetch->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	for( bucket_index = 0;
+	     bucket_index < bucket_prefetch->number_of_buckets;
+	     bucket_index++ )
+	{
+		if( bucket_prefetch->buckets[ bucket_index ] != NULL )
+		{
+			if( libnsfdb_bucket_free(
+			     &( bucket_prefetch->buckets[ bucket_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bucket: %d.",
+				 function,
+				 bucket_index );
+
+				result = -1;
+			}
+		}
+	}
+	bucket_prefetch->file_io_handle    = NULL;
+	bucket_prefetch->bucket_cache      = NULL;
+	bucket_prefetch->number_of_buckets = 0;
+	bucket_prefetch->buckets_read      = 0;
+
+	return( result );
+}
+
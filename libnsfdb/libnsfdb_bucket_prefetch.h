@@ -0,0 +1,127 @@
+/*
+ * Bucket prefetch functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_BUCKET_PREFETCH_H )
+#define _LIBNSFDB_BUCKET_PREFETCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_bucket.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libcthreads.h"
+#include "libnsfdb_libfcache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_bucket_prefetch libnsfdb_bucket_prefetch_t;
+
+struct libnsfdb_bucket_prefetch
+{
+	/* The file IO handle used to read the buckets
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The bucket cache the buckets are added to
+	 */
+	libfcache_cache_t *bucket_cache;
+
+	/* The bucket indexes
+	 */
+	uint32_t *bucket_indexes;
+
+	/* The bucket offsets
+	 */
+	off64_t *bucket_offsets;
+
+	/* The buckets
+	 */
+	libnsfdb_bucket_t **buckets;
+
+	/* The number of buckets
+	 */
+	int number_of_buckets;
+
+	/* The maximum number of buckets
+	 */
+	int maximum_number_of_buckets;
+
+	/* Value to indicate the buckets were read
+	 */
+	uint8_t buckets_read;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The clone of the file IO handle used by the thread
+	 */
+	libbfio_handle_t *thread_file_io_handle;
+
+	/* Value to indicate the file IO handle could not be cloned
+	 */
+	uint8_t clone_failed;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+int libnsfdb_bucket_prefetch_initialize(
+     libnsfdb_bucket_prefetch_t **bucket_prefetch,
+     int maximum_number_of_buckets,
+     libcerror_error_t **error );
+
+int libnsfdb_bucket_prefetch_free(
+     libnsfdb_bucket_prefetch_t **bucket_prefetch,
+     libcerror_error_t **error );
+
+int libnsfdb_bucket_prefetch_read_buckets(
+     void *parameters );
+
+int libnsfdb_bucket_prefetch_start(
+     libnsfdb_bucket_prefetch_t *bucket_prefetch,
+     libbfio_handle_t *file_io_handle,
+     libfcache_cache_t *bucket_cache,
+     const uint32_t *bucket_indexes,
+     const off64_t *bucket_offsets,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int libnsfdb_bucket_prefetch_join(
+     libnsfdb_bucket_prefetch_t *bucket_prefetch,
+     libcerror_error_t **error );
+
+int libnsfdb_bucket_prefetch_contains_bucket(
+     libnsfdb_bucket_prefetch_t *bucket_prefetch,
+     uint32_t bucket_index );
+
+int libnsfdb_bucket_prefetch_clear(
+     libnsfdb_bucket_prefetch_t *bucket_prefetch,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_BUCKET_PREFETCH_H ) */
+
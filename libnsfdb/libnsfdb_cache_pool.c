@@ -0,0 +1,1503 @@
+/*
+ * Cache pool functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_cache_pool.h"
+#include "libnsfdb_definitions.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libcnotify.h"
+#include "libnsfdb_libcthreads.h"
+#include "libnsfdb_types.h"
+
+/* Creates a cache pool
+ * The cache pool can be shared by multiple files, the values of all files
+ * are evicted least recently used first when the maximum size is exceeded
+ * Values that are referenced are not evicted until they are released
+ * Make sure the value cache_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_initialize(
+     libnsfdb_cache_pool_t **cache_pool,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_cache_pool_t *internal_cache_pool = NULL;
+	static char *function                               = "libnsfdb_cache_pool_initialize";
+
+	if( cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_pool = memory_allocate_structure(
+	                       libnsfdb_internal_cache_pool_t );
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cache_pool,
+	     0,
+	     sizeof( libnsfdb_internal_cache_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache pool.",
+		 function );
+
+		memory_free(
+		 internal_cache_pool );
+
+		return( -1 );
+	}
+	internal_cache_pool->hash_table = (libnsfdb_cache_pool_entry_t **) memory_allocate(
+	                                                                    sizeof( libnsfdb_cache_pool_entry_t * ) * LIBNSFDB_CACHE_POOL_HASH_TABLE_SIZE );
+
+	if( internal_cache_pool->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cache_pool->hash_table,
+	     0,
+	     sizeof( libnsfdb_cache_pool_entry_t * ) * LIBNSFDB_CACHE_POOL_HASH_TABLE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_cache_pool->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_cache_pool->maximum_size          = maximum_size;
+	internal_cache_pool->next_owner_identifier = 1;
+
+	*cache_pool = (libnsfdb_cache_pool_t *) internal_cache_pool;
+
+	return( 1 );
+
+on_error:
+	if( internal_cache_pool != NULL )
+	{
+		if( internal_cache_pool->hash_table != NULL )
+		{
+			memory_free(
+			 internal_cache_pool->hash_table );
+		}
+		memory_free(
+		 internal_cache_pool );
+	}
+	return( -1 );
+}
+
+/* Frees a cache pool
+ * The files that use the cache pool must be freed before the cache pool
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_free(
+     libnsfdb_cache_pool_t **cache_pool,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_cache_pool_t *internal_cache_pool = NULL;
+	libnsfdb_cache_pool_entry_t *cache_pool_entry       = NULL;
+	static char *function                               = "libnsfdb_cache_pool_free";
+	int result                                          = 1;
+
+	if( cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_pool != NULL )
+	{
+		internal_cache_pool = (libnsfdb_internal_cache_pool_t *) *cache_pool;
+
+		if( internal_cache_pool->number_of_owners != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid cache pool - still in use by: %d files.",
+			 function,
+			 internal_cache_pool->number_of_owners );
+
+			return( -1 );
+		}
+		*cache_pool = NULL;
+
+		/* The entries that were removed while referenced are no longer
+		 * in the list of entries
+		 */
+		while( internal_cache_pool->first_referenced_entry != NULL )
+		{
+			cache_pool_entry = internal_cache_pool->first_referenced_entry;
+
+			internal_cache_pool->first_referenced_entry = cache_pool_entry->next_referenced_entry;
+
+			cache_pool_entry->number_of_references  = 0;
+			cache_pool_entry->next_referenced_entry = NULL;
+
+			if( cache_pool_entry->is_removed != 0 )
+			{
+				if( libnsfdb_cache_pool_entry_free(
+				     &cache_pool_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free entry.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+		while( internal_cache_pool->first_entry != NULL )
+		{
+			if( libnsfdb_cache_pool_free_entry(
+			     internal_cache_pool,
+			     internal_cache_pool->first_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_cache_pool->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_cache_pool->hash_table );
+
+		memory_free(
+		 internal_cache_pool );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the values in the cache pool
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_get_size(
+     libnsfdb_cache_pool_t *cache_pool,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_cache_pool_t *internal_cache_pool = NULL;
+	static char *function                               = "libnsfdb_cache_pool_get_size";
+
+	if( cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache_pool = (libnsfdb_internal_cache_pool_t *) cache_pool;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size = internal_cache_pool->size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Attaches an owner e.g. a file to the cache pool
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_attach_owner(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t *owner_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_cache_pool_attach_owner";
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( owner_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner identifier.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_pool->next_owner_identifier == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache pool - next owner identifier value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*owner_identifier = internal_cache_pool->next_owner_identifier;
+
+	internal_cache_pool->next_owner_identifier += 1;
+	internal_cache_pool->number_of_owners      += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_cache_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Detaches an owner e.g. a file from the cache pool
+ * This removes the values of the owner from the cache pool
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_detach_owner(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_cache_pool_detach_owner";
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cache_pool->number_of_owners <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache pool - number of owners value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_cache_pool_remove_entries(
+	     internal_cache_pool,
+	     owner_identifier,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove values of owner: %" PRIu32 ".",
+		 function,
+		 owner_identifier );
+
+		goto on_error;
+	}
+	internal_cache_pool->number_of_owners -= 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_cache_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Calculates the hash of a cache pool value
+ * Returns the hash table index
+ */
+uint32_t libnsfdb_cache_pool_get_hash(
+          uint32_t owner_identifier,
+          uint8_t value_type,
+          off64_t offset )
+{
+	uint32_t hash_value = 0;
+
+	/* Buckets are aligned hence the lower bits of the offset are mostly 0
+	 */
+	hash_value  = (uint32_t) ( offset >> 8 ) ^ (uint32_t) ( offset >> 32 );
+	hash_value ^= owner_identifier * 0x9e3779b1UL;
+	hash_value ^= (uint32_t) value_type << 24;
+	hash_value ^= hash_value >> 16;
+
+	return( hash_value % LIBNSFDB_CACHE_POOL_HASH_TABLE_SIZE );
+}
+
+/* Frees a cache pool entry and its value
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_entry_free(
+     libnsfdb_cache_pool_entry_t **cache_pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_cache_pool_entry_free";
+	int result            = 1;
+
+	if( cache_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_pool_entry != NULL )
+	{
+		if( ( ( *cache_pool_entry )->value != NULL )
+		 && ( ( *cache_pool_entry )->value_free_function != NULL ) )
+		{
+			if( ( *cache_pool_entry )->value_free_function(
+			     &( ( *cache_pool_entry )->value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *cache_pool_entry );
+
+		*cache_pool_entry = NULL;
+	}
+	return( result );
+}
+
+/* Removes an entry from the cache pool and frees it
+ * An entry of which the value is referenced is freed when the value is released
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_free_entry(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     libnsfdb_cache_pool_entry_t *cache_pool_entry,
+     libcerror_error_t **error )
+{
+	libnsfdb_cache_pool_entry_t **hash_entry = NULL;
+	static char *function                    = "libnsfdb_cache_pool_free_entry";
+	uint32_t hash_value                      = 0;
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash_value = libnsfdb_cache_pool_get_hash(
+	              cache_pool_entry->owner_identifier,
+	              cache_pool_entry->value_type,
+	              cache_pool_entry->offset );
+
+	hash_entry = &( internal_cache_pool->hash_table[ hash_value ] );
+
+	while( *hash_entry != NULL )
+	{
+		if( *hash_entry == cache_pool_entry )
+		{
+			*hash_entry = cache_pool_entry->next_hash_entry;
+
+			break;
+		}
+		hash_entry = &( ( *hash_entry )->next_hash_entry );
+	}
+	if( cache_pool_entry->previous_entry != NULL )
+	{
+		cache_pool_entry->previous_entry->next_entry = cache_pool_entry->next_entry;
+	}
+	else
+	{
+		internal_cache_pool->first_entry = cache_pool_entry->next_entry;
+	}
+	if( cache_pool_entry->next_entry != NULL )
+	{
+		cache_pool_entry->next_entry->previous_entry = cache_pool_entry->previous_entry;
+	}
+	else
+	{
+		internal_cache_pool->last_entry = cache_pool_entry->previous_entry;
+	}
+	internal_cache_pool->number_of_entries -= 1;
+	internal_cache_pool->size              -= cache_pool_entry->value_size;
+
+	if( cache_pool_entry->number_of_references > 0 )
+	{
+		cache_pool_entry->next_hash_entry = NULL;
+		cache_pool_entry->previous_entry  = NULL;
+		cache_pool_entry->next_entry      = NULL;
+		cache_pool_entry->is_removed      = 1;
+
+		return( 1 );
+	}
+	if( libnsfdb_cache_pool_entry_free(
+	     &cache_pool_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Evicts least recently used entries while the maximum size is exceeded
+ * Entries of which the value is referenced are not evicted
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_evict_entries(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     libcerror_error_t **error )
+{
+	libnsfdb_cache_pool_entry_t *cache_pool_entry = NULL;
+	libnsfdb_cache_pool_entry_t *previous_entry   = NULL;
+	static char *function                         = "libnsfdb_cache_pool_evict_entries";
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+	cache_pool_entry = internal_cache_pool->last_entry;
+
+	while( ( internal_cache_pool->size > internal_cache_pool->maximum_size )
+	    && ( cache_pool_entry != NULL ) )
+	{
+		previous_entry = cache_pool_entry->previous_entry;
+
+		if( cache_pool_entry->number_of_references == 0 )
+		{
+			if( libnsfdb_cache_pool_free_entry(
+			     internal_cache_pool,
+			     cache_pool_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to evict least recently used entry.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		cache_pool_entry = previous_entry;
+	}
+	return( 1 );
+}
+
+/* Removes the entries of a specific owner
+ * If value type is 0 the entries of all value types are removed
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_remove_entries(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	libnsfdb_cache_pool_entry_t *cache_pool_entry = NULL;
+	libnsfdb_cache_pool_entry_t *next_entry       = NULL;
+	static char *function                         = "libnsfdb_cache_pool_remove_entries";
+	int result                                    = 1;
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+	cache_pool_entry = internal_cache_pool->first_entry;
+
+	while( cache_pool_entry != NULL )
+	{
+		next_entry = cache_pool_entry->next_entry;
+
+		if( ( cache_pool_entry->owner_identifier == owner_identifier )
+		 && ( ( value_type == 0 )
+		  ||  ( cache_pool_entry->value_type == value_type ) ) )
+		{
+			if( libnsfdb_cache_pool_free_entry(
+			     internal_cache_pool,
+			     cache_pool_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry.",
+				 function );
+
+				result = -1;
+			}
+		}
+		cache_pool_entry = next_entry;
+	}
+	return( result );
+}
+
+/* Retrieves a value from the cache pool
+ * The value remains managed by the cache pool and is marked as most recently used
+ * The value is referenced and must be released with libnsfdb_cache_pool_release_value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libnsfdb_cache_pool_get_value(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     uint8_t value_type,
+     off64_t offset,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libnsfdb_cache_pool_entry_t *cache_pool_entry = NULL;
+	static char *function                         = "libnsfdb_cache_pool_get_value";
+	uint32_t hash_value                           = 0;
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	hash_value = libnsfdb_cache_pool_get_hash(
+	              owner_identifier,
+	              value_type,
+	              offset );
+
+	cache_pool_entry = internal_cache_pool->hash_table[ hash_value ];
+
+	while( cache_pool_entry != NULL )
+	{
+		if( ( cache_pool_entry->owner_identifier == owner_identifier )
+		 && ( cache_pool_entry->value_type == value_type )
+		 && ( cache_pool_entry->offset == offset ) )
+		{
+			break;
+		}
+		cache_pool_entry = cache_pool_entry->next_hash_entry;
+	}
+	if( cache_pool_entry == NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_cache_pool->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		return( 0 );
+	}
+	if( cache_pool_entry->previous_entry != NULL )
+	{
+		cache_pool_entry->previous_entry->next_entry = cache_pool_entry->next_entry;
+
+		if( cache_pool_entry->next_entry != NULL )
+		{
+			cache_pool_entry->next_entry->previous_entry = cache_pool_entry->previous_entry;
+		}
+		else
+		{
+			internal_cache_pool->last_entry = cache_pool_entry->previous_entry;
+		}
+		cache_pool_entry->previous_entry = NULL;
+		cache_pool_entry->next_entry     = internal_cache_pool->first_entry;
+
+		internal_cache_pool->first_entry->previous_entry = cache_pool_entry;
+		internal_cache_pool->first_entry                 = cache_pool_entry;
+	}
+	if( cache_pool_entry->number_of_references == 0 )
+	{
+		cache_pool_entry->next_referenced_entry     = internal_cache_pool->first_referenced_entry;
+		internal_cache_pool->first_referenced_entry = cache_pool_entry;
+	}
+	cache_pool_entry->number_of_references += 1;
+
+	*value = cache_pool_entry->value;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets a value in the cache pool
+ * The cache pool takes over management of the value
+ * The value is referenced and must be released with libnsfdb_cache_pool_release_value
+ * Least recently used values that are not referenced are evicted while the maximum size is exceeded
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_set_value(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     uint8_t value_type,
+     off64_t offset,
+     intptr_t *value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     size_t value_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_cache_pool_entry_t *cache_pool_entry = NULL;
+	static char *function                         = "libnsfdb_cache_pool_set_value";
+	uint32_t hash_value                           = 0;
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	hash_value = libnsfdb_cache_pool_get_hash(
+	              owner_identifier,
+	              value_type,
+	              offset );
+
+	cache_pool_entry = internal_cache_pool->hash_table[ hash_value ];
+
+	while( cache_pool_entry != NULL )
+	{
+		if( ( cache_pool_entry->owner_identifier == owner_identifier )
+		 && ( cache_pool_entry->value_type == value_type )
+		 && ( cache_pool_entry->offset == offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid cache pool - value already set.",
+			 function );
+
+			goto on_error;
+		}
+		cache_pool_entry = cache_pool_entry->next_hash_entry;
+	}
+	cache_pool_entry = memory_allocate_structure(
+	                    libnsfdb_cache_pool_entry_t );
+
+	if( cache_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache pool entry.",
+		 function );
+
+		goto on_error;
+	}
+	cache_pool_entry->owner_identifier      = owner_identifier;
+	cache_pool_entry->value_type            = value_type;
+	cache_pool_entry->offset                = offset;
+	cache_pool_entry->value                 = value;
+	cache_pool_entry->value_free_function   = value_free_function;
+	cache_pool_entry->value_size            = value_size;
+	cache_pool_entry->number_of_references  = 1;
+	cache_pool_entry->is_removed            = 0;
+	cache_pool_entry->next_hash_entry       = internal_cache_pool->hash_table[ hash_value ];
+	cache_pool_entry->previous_entry        = NULL;
+	cache_pool_entry->next_entry            = internal_cache_pool->first_entry;
+	cache_pool_entry->next_referenced_entry = internal_cache_pool->first_referenced_entry;
+
+	internal_cache_pool->hash_table[ hash_value ]  = cache_pool_entry;
+	internal_cache_pool->first_referenced_entry    = cache_pool_entry;
+
+	if( internal_cache_pool->first_entry != NULL )
+	{
+		internal_cache_pool->first_entry->previous_entry = cache_pool_entry;
+	}
+	else
+	{
+		internal_cache_pool->last_entry = cache_pool_entry;
+	}
+	internal_cache_pool->first_entry = cache_pool_entry;
+
+	internal_cache_pool->number_of_entries += 1;
+	internal_cache_pool->size              += value_size;
+
+	/* The value was set hence a failure to evict is not returned as a failure to set
+	 */
+	if( libnsfdb_cache_pool_evict_entries(
+	     internal_cache_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to evict entries.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_cache_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Releases a value that was referenced by retrieving or setting it
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_release_value(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	libnsfdb_cache_pool_entry_t **referenced_entry = NULL;
+	libnsfdb_cache_pool_entry_t *cache_pool_entry  = NULL;
+	static char *function                          = "libnsfdb_cache_pool_release_value";
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The number of referenced entries is small hence a linear search suffices
+	 */
+	referenced_entry = &( internal_cache_pool->first_referenced_entry );
+
+	while( *referenced_entry != NULL )
+	{
+		if( ( *referenced_entry )->value == value )
+		{
+			break;
+		}
+		referenced_entry = &( ( *referenced_entry )->next_referenced_entry );
+	}
+	if( *referenced_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value - not referenced.",
+		 function );
+
+		goto on_error;
+	}
+	cache_pool_entry = *referenced_entry;
+
+	cache_pool_entry->number_of_references -= 1;
+
+	if( cache_pool_entry->number_of_references == 0 )
+	{
+		*referenced_entry = cache_pool_entry->next_referenced_entry;
+
+		cache_pool_entry->next_referenced_entry = NULL;
+
+		if( cache_pool_entry->is_removed != 0 )
+		{
+			if( libnsfdb_cache_pool_entry_free(
+			     &cache_pool_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* A referenced value can prevent the cache pool from evicting values
+		 */
+		else if( libnsfdb_cache_pool_evict_entries(
+		          internal_cache_pool,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to evict entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_cache_pool->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Removes the values of a specific owner from the cache pool
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_remove_values(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_cache_pool_remove_values";
+	int result            = 1;
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libnsfdb_cache_pool_remove_entries(
+	     internal_cache_pool,
+	     owner_identifier,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove values of owner: %" PRIu32 ".",
+		 function,
+		 owner_identifier );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes a specific value of an owner from the cache pool
+ * A value that is referenced is freed when it is released
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libnsfdb_cache_pool_remove_value(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     uint8_t value_type,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libnsfdb_cache_pool_entry_t *cache_pool_entry = NULL;
+	static char *function                         = "libnsfdb_cache_pool_remove_value";
+	uint32_t hash_value                           = 0;
+	int result                                    = 0;
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	hash_value = libnsfdb_cache_pool_get_hash(
+	              owner_identifier,
+	              value_type,
+	              offset );
+
+	cache_pool_entry = internal_cache_pool->hash_table[ hash_value ];
+
+	while( cache_pool_entry != NULL )
+	{
+		if( ( cache_pool_entry->owner_identifier == owner_identifier )
+		 && ( cache_pool_entry->value_type == value_type )
+		 && ( cache_pool_entry->offset == offset ) )
+		{
+			break;
+		}
+		cache_pool_entry = cache_pool_entry->next_hash_entry;
+	}
+	if( cache_pool_entry != NULL )
+	{
+		result = libnsfdb_cache_pool_free_entry(
+		          internal_cache_pool,
+		          cache_pool_entry,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes all values of a specific type of an owner from the cache pool
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cache_pool_remove_values_by_type(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_cache_pool_remove_values_by_type";
+	int result            = 1;
+
+	if( internal_cache_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libnsfdb_cache_pool_remove_entries(
+	     internal_cache_pool,
+	     owner_identifier,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove values of owner: %" PRIu32 ".",
+		 function,
+		 owner_identifier );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cache_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
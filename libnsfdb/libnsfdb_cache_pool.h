@@ -0,0 +1,238 @@
+/*
+ * Cache pool functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_CACHE_POOL_H )
+#define _LIBNSFDB_CACHE_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_extern.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libcthreads.h"
+#include "libnsfdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_cache_pool_entry libnsfdb_cache_pool_entry_t;
+
+struct libnsfdb_cache_pool_entry
+{
+	/* The identifier of the owner e.g. the file
+	 */
+	uint32_t owner_identifier;
+
+	/* The value type
+	 */
+	uint8_t value_type;
+
+	/* The offset of the value
+	 */
+	off64_t offset;
+
+	/* The value
+	 */
+	intptr_t *value;
+
+	/* The value free function
+	 */
+	int (*value_free_function)(
+	       intptr_t **value,
+	       libcerror_error_t **error );
+
+	/* The value size
+	 */
+	size_t value_size;
+
+	/* The number of references to the value
+	 */
+	int number_of_references;
+
+	/* Value to indicate the entry was removed while the value was referenced
+	 */
+	uint8_t is_removed;
+
+	/* The next entry in the hash table
+	 */
+	libnsfdb_cache_pool_entry_t *next_hash_entry;
+
+	/* The previous, more recently used, entry
+	 */
+	libnsfdb_cache_pool_entry_t *previous_entry;
+
+	/* The next, less recently used, entry
+	 */
+	libnsfdb_cache_pool_entry_t *next_entry;
+
+	/* The next referenced entry
+	 */
+	libnsfdb_cache_pool_entry_t *next_referenced_entry;
+};
+
+typedef struct libnsfdb_internal_cache_pool libnsfdb_internal_cache_pool_t;
+
+struct libnsfdb_internal_cache_pool
+{
+	/* The hash table
+	 */
+	libnsfdb_cache_pool_entry_t **hash_table;
+
+	/* The most recently used entry
+	 */
+	libnsfdb_cache_pool_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libnsfdb_cache_pool_entry_t *last_entry;
+
+	/* The first referenced entry
+	 */
+	libnsfdb_cache_pool_entry_t *first_referenced_entry;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The size of the values
+	 */
+	size64_t size;
+
+	/* The maximum size of the values
+	 */
+	size64_t maximum_size;
+
+	/* The next owner identifier
+	 */
+	uint32_t next_owner_identifier;
+
+	/* The number of owners
+	 */
+	int number_of_owners;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBNSFDB_EXTERN \
+int libnsfdb_cache_pool_initialize(
+     libnsfdb_cache_pool_t **cache_pool,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_cache_pool_free(
+     libnsfdb_cache_pool_t **cache_pool,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_cache_pool_get_size(
+     libnsfdb_cache_pool_t *cache_pool,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_attach_owner(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t *owner_identifier,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_detach_owner(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     libcerror_error_t **error );
+
+uint32_t libnsfdb_cache_pool_get_hash(
+          uint32_t owner_identifier,
+          uint8_t value_type,
+          off64_t offset );
+
+int libnsfdb_cache_pool_entry_free(
+     libnsfdb_cache_pool_entry_t **cache_pool_entry,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_free_entry(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     libnsfdb_cache_pool_entry_t *cache_pool_entry,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_evict_entries(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_remove_entries(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_get_value(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     uint8_t value_type,
+     off64_t offset,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_set_value(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     uint8_t value_type,
+     off64_t offset,
+     intptr_t *value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     size_t value_size,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_release_value(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_remove_values(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_remove_value(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     uint8_t value_type,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libnsfdb_cache_pool_remove_values_by_type(
+     libnsfdb_internal_cache_pool_t *internal_cache_pool,
+     uint32_t owner_identifier,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_CACHE_POOL_H ) */
+
@@ -0,0 +1,1770 @@
+/*
+ * Column scan functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libnsfdb_bucket.h"
+#include "libnsfdb_column_scan.h"
+#include "libnsfdb_definitions.h"
+#include "libnsfdb_file.h"
+#include "libnsfdb_io_handle.h"
+#include "libnsfdb_libcdata.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libfcache.h"
+#include "libnsfdb_note_index.h"
+#include "libnsfdb_scan_predicate.h"
+#include "libnsfdb_types.h"
+#include "libnsfdb_unique_name_key.h"
+
+#include "nsfdb_note.h"
+
+/* Creates a column scan
+ * Make sure the value column_scan is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_column_scan_initialize(
+     libnsfdb_column_scan_t **column_scan,
+     int number_of_columns,
+     int maximum_number_of_rows,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	static char *function                                 = "libnsfdb_column_scan_initialize";
+	size_t number_of_values                               = 0;
+
+	if( column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_scan != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column scan value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_columns <= 0 )
+	 || ( number_of_columns > (int) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of columns value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_rows <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of rows value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) maximum_number_of_rows > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( sizeof( size_t ) * (size_t) number_of_columns ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of rows value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_values = (size_t) number_of_columns * (size_t) maximum_number_of_rows;
+
+	internal_column_scan = memory_allocate_structure(
+	                        libnsfdb_internal_column_scan_t );
+
+	if( internal_column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create column scan.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_column_scan,
+	     0,
+	     sizeof( libnsfdb_internal_column_scan_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column scan.",
+		 function );
+
+		memory_free(
+		 internal_column_scan );
+
+		return( -1 );
+	}
+	internal_column_scan->note_identifiers = (uint32_t *) memory_allocate(
+	                                                       sizeof( uint32_t ) * (size_t) maximum_number_of_rows );
+
+	if( internal_column_scan->note_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create note identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	internal_column_scan->value_data_offsets = (size_t *) memory_allocate(
+	                                                       sizeof( size_t ) * number_of_values );
+
+	if( internal_column_scan->value_data_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value data offsets.",
+		 function );
+
+		goto on_error;
+	}
+	internal_column_scan->value_data_sizes = (uint16_t *) memory_allocate(
+	                                                       sizeof( uint16_t ) * number_of_values );
+
+	if( internal_column_scan->value_data_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create value data sizes.",
+		 function );
+
+		goto on_error;
+	}
+	internal_column_scan->item_data = (const uint8_t **) memory_allocate(
+	                                                     sizeof( const uint8_t * ) * (size_t) number_of_columns );
+
+	if( internal_column_scan->item_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_column_scan->item_data_sizes = (uint16_t *) memory_allocate(
+	                                                      sizeof( uint16_t ) * (size_t) number_of_columns );
+
+	if( internal_column_scan->item_data_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item data sizes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_column_scan->predicates ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create predicates array.",
+		 function );
+
+		goto on_error;
+	}
+	internal_column_scan->number_of_columns      = number_of_columns;
+	internal_column_scan->maximum_number_of_rows = maximum_number_of_rows;
+
+	*column_scan = (libnsfdb_column_scan_t *) internal_column_scan;
+
+	return( 1 );
+
+on_error:
+	if( internal_column_scan != NULL )
+	{
+		if( internal_column_scan->item_data_sizes != NULL )
+		{
+			memory_free(
+			 internal_column_scan->item_data_sizes );
+		}
+		if( internal_column_scan->item_data != NULL )
+		{
+			memory_free(
+			 internal_column_scan->item_data );
+		}
+		if( internal_column_scan->value_data_sizes != NULL )
+		{
+			memory_free(
+			 internal_column_scan->value_data_sizes );
+		}
+		if( internal_column_scan->value_data_offsets != NULL )
+		{
+			memory_free(
+			 internal_column_scan->value_data_offsets );
+		}
+		if( internal_column_scan->note_identifiers != NULL )
+		{
+			memory_free(
+			 internal_column_scan->note_identifiers );
+		}
+		memory_free(
+		 internal_column_scan );
+	}
+	return( -1 );
+}
+
+/* Frees a column scan
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_column_scan_free(
+     libnsfdb_column_scan_t **column_scan,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	static char *function                                 = "libnsfdb_column_scan_free";
+	int result                                            = 1;
+
+	if( column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_scan != NULL )
+	{
+		internal_column_scan = (libnsfdb_internal_column_scan_t *) *column_scan;
+		*column_scan         = NULL;
+
+		/* The internal_file reference is freed elsewhere
+		 */
+		if( libcdata_array_free(
+		     &( internal_column_scan->predicates ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_scan_predicate_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free predicates array.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_column_scan->item_data_sizes != NULL )
+		{
+			memory_free(
+			 internal_column_scan->item_data_sizes );
+		}
+		if( internal_column_scan->item_data != NULL )
+		{
+			memory_free(
+			 internal_column_scan->item_data );
+		}
+		if( internal_column_scan->value_data != NULL )
+		{
+			memory_free(
+			 internal_column_scan->value_data );
+		}
+		if( internal_column_scan->value_data_sizes != NULL )
+		{
+			memory_free(
+			 internal_column_scan->value_data_sizes );
+		}
+		if( internal_column_scan->value_data_offsets != NULL )
+		{
+			memory_free(
+			 internal_column_scan->value_data_offsets );
+		}
+		if( internal_column_scan->note_identifiers != NULL )
+		{
+			memory_free(
+			 internal_column_scan->note_identifiers );
+		}
+		if( internal_column_scan->unk_column_indexes != NULL )
+		{
+			memory_free(
+			 internal_column_scan->unk_column_indexes );
+		}
+		memory_free(
+		 internal_column_scan );
+	}
+	return( result );
+}
+
+/* Sets the field names of the columns
+ * This resolves the field names to unique name key (UNK) table indexes once so that
+ * the items of a note can be mapped to a column without comparing their names
+ * The field names are compared case insensitive, a field name without a matching
+ * unique name key results in a column without values
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_column_scan_set_field_names(
+     libnsfdb_internal_column_scan_t *internal_column_scan,
+     libcdata_array_t *unique_name_key_table,
+     const char **field_names,
+     libcerror_error_t **error )
+{
+	libnsfdb_unique_name_key_t *unique_name_key = NULL;
+	static char *function                       = "libnsfdb_column_scan_set_field_names";
+	size_t field_name_length                    = 0;
+	int column_index                            = 0;
+	int number_of_unique_name_keys              = 0;
+	int unique_name_key_index                   = 0;
+
+	if( internal_column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_column_scan->unk_column_indexes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid column scan - UNK column indexes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field names.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < internal_column_scan->number_of_columns;
+	     column_index++ )
+	{
+		if( field_names[ column_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid field name: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     unique_name_key_table,
+	     &number_of_unique_name_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of unique name keys.",
+		 function );
+
+		return( -1 );
+	}
+	/* Always allocate at least 1 element so that an empty unique name key table can be used
+	 */
+	internal_column_scan->unk_column_indexes = (int *) memory_allocate(
+	                                                    sizeof( int ) * (size_t) ( number_of_unique_name_keys + 1 ) );
+
+	if( internal_column_scan->unk_column_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UNK column indexes.",
+		 function );
+
+		goto on_error;
+	}
+	for( unique_name_key_index = 0;
+	     unique_name_key_index < number_of_unique_name_keys;
+	     unique_name_key_index++ )
+	{
+		internal_column_scan->unk_column_indexes[ unique_name_key_index ] = -1;
+
+		if( libcdata_array_get_entry_by_index(
+		     unique_name_key_table,
+		     unique_name_key_index,
+		     (intptr_t **) &unique_name_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve unique name key: %d.",
+			 function,
+			 unique_name_key_index );
+
+			goto on_error;
+		}
+		if( ( unique_name_key == NULL )
+		 || ( unique_name_key->name == NULL )
+		 || ( unique_name_key->name_size == 0 ) )
+		{
+			continue;
+		}
+		for( column_index = 0;
+		     column_index < internal_column_scan->number_of_columns;
+		     column_index++ )
+		{
+			field_name_length = narrow_string_length(
+			                     field_names[ column_index ] );
+
+			if( ( field_name_length == ( unique_name_key->name_size - 1 ) )
+			 && ( narrow_string_compare_no_case(
+			       (char *) unique_name_key->name,
+			       field_names[ column_index ],
+			       field_name_length ) == 0 ) )
+			{
+				internal_column_scan->unk_column_indexes[ unique_name_key_index ] = column_index;
+
+				break;
+			}
+		}
+	}
+	internal_column_scan->number_of_unk_column_indexes = number_of_unique_name_keys;
+
+	return( 1 );
+
+on_error:
+	if( internal_column_scan->unk_column_indexes != NULL )
+	{
+		memory_free(
+		 internal_column_scan->unk_column_indexes );
+
+		internal_column_scan->unk_column_indexes = NULL;
+	}
+	return( -1 );
+}
+
+/* Appends a predicate
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_column_scan_append_predicate(
+     libnsfdb_internal_column_scan_t *internal_column_scan,
+     libnsfdb_scan_predicate_t *scan_predicate,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_column_scan_append_predicate";
+	int entry_index       = 0;
+
+	if( internal_column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_predicate->column_index >= internal_column_scan->number_of_columns )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan predicate - column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     internal_column_scan->predicates,
+	     &entry_index,
+	     (intptr_t *) scan_predicate,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan predicate to array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a text predicate
+ * The text is compared with the raw text data of the items of the column, without conversion
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_column_scan_append_text_predicate(
+     libnsfdb_column_scan_t *column_scan,
+     int column_index,
+     uint8_t predicate_type,
+     const uint8_t *text,
+     size_t text_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_scan_predicate_t *scan_predicate = NULL;
+	static char *function                     = "libnsfdb_column_scan_append_text_predicate";
+
+	if( column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS )
+	 && ( predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_CONTAINS )
+	 && ( predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_PREFIX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported predicate type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_scan_predicate_initialize(
+	     &scan_predicate,
+	     column_index,
+	     predicate_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan predicate.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_scan_predicate_set_text(
+	     scan_predicate,
+	     text,
+	     text_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set text.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_column_scan_append_predicate(
+	     (libnsfdb_internal_column_scan_t *) column_scan,
+	     scan_predicate,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan predicate.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_predicate != NULL )
+	{
+		libnsfdb_scan_predicate_free(
+		 &scan_predicate,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a number range predicate
+ * The range includes both values
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_column_scan_append_number_range_predicate(
+     libnsfdb_column_scan_t *column_scan,
+     int column_index,
+     double minimum_number,
+     double maximum_number,
+     libcerror_error_t **error )
+{
+	libnsfdb_scan_predicate_t *scan_predicate = NULL;
+	static char *function                     = "libnsfdb_column_scan_append_number_range_predicate";
+
+	if( column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_scan_predicate_initialize(
+	     &scan_predicate,
+	     column_index,
+	     LIBNSFDB_SCAN_PREDICATE_TYPE_NUMBER_RANGE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan predicate.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_scan_predicate_set_number_range(
+	     scan_predicate,
+	     minimum_number,
+	     maximum_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number range.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_column_scan_append_predicate(
+	     (libnsfdb_internal_column_scan_t *) column_scan,
+	     scan_predicate,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan predicate.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_predicate != NULL )
+	{
+		libnsfdb_scan_predicate_free(
+		 &scan_predicate,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a time range predicate
+ * The times are 64-bit NSF timedate values and the range includes both values
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_column_scan_append_time_range_predicate(
+     libnsfdb_column_scan_t *column_scan,
+     int column_index,
+     uint64_t first_time,
+     uint64_t last_time,
+     libcerror_error_t **error )
+{
+	libnsfdb_scan_predicate_t *scan_predicate = NULL;
+	static char *function                     = "libnsfdb_column_scan_append_time_range_predicate";
+
+	if( column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_scan_predicate_initialize(
+	     &scan_predicate,
+	     column_index,
+	     LIBNSFDB_SCAN_PREDICATE_TYPE_TIME_RANGE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan predicate.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_scan_predicate_set_time_range(
+	     scan_predicate,
+	     first_time,
+	     last_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time range.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_column_scan_append_predicate(
+	     (libnsfdb_internal_column_scan_t *) column_scan,
+	     scan_predicate,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append scan predicate.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( scan_predicate != NULL )
+	{
+		libnsfdb_scan_predicate_free(
+		 &scan_predicate,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends value data to a specific column of the row that is being read
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_column_scan_append_value_data(
+     libnsfdb_internal_column_scan_t *internal_column_scan,
+     int column_index,
+     const uint8_t *data,
+     uint16_t data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation               = NULL;
+	static char *function            = "libnsfdb_column_scan_append_value_data";
+	size_t allocated_value_data_size = 0;
+	size_t value_index               = 0;
+
+	if( internal_column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_column_scan->number_of_rows >= internal_column_scan->maximum_number_of_rows )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column scan - number of rows value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index >= internal_column_scan->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_column_scan->value_data_size + data_size ) > internal_column_scan->allocated_value_data_size )
+	{
+		if( internal_column_scan->allocated_value_data_size == 0 )
+		{
+			allocated_value_data_size = 65536;
+		}
+		else
+		{
+			allocated_value_data_size = internal_column_scan->allocated_value_data_size * 2;
+		}
+		while( allocated_value_data_size < ( internal_column_scan->value_data_size + data_size ) )
+		{
+			allocated_value_data_size *= 2;
+		}
+		if( allocated_value_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid allocated value data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                internal_column_scan->value_data,
+		                allocated_value_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize value data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_column_scan->value_data                = (uint8_t *) reallocation;
+		internal_column_scan->allocated_value_data_size = allocated_value_data_size;
+	}
+	if( memory_copy(
+	     &( internal_column_scan->value_data[ internal_column_scan->value_data_size ] ),
+	     data,
+	     (size_t) data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy value data.",
+		 function );
+
+		return( -1 );
+	}
+	value_index = ( (size_t) column_index * (size_t) internal_column_scan->maximum_number_of_rows )
+	            + (size_t) internal_column_scan->number_of_rows;
+
+	internal_column_scan->value_data_offsets[ value_index ] = internal_column_scan->value_data_size;
+	internal_column_scan->value_data_sizes[ value_index ]   = data_size;
+
+	internal_column_scan->value_data_size += data_size;
+
+	return( 1 );
+}
+
+/* Reads the values of the scanned columns from the note data into a new row
+ * Only the items of which the unique name key (UNK) table index maps to a column are copied,
+ * the other items are skipped without being decoded
+ * Returns 1 if successful, 0 if the note does not match the predicates or -1 on error
+ */
+int libnsfdb_column_scan_read_note_data(
+     libnsfdb_internal_column_scan_t *internal_column_scan,
+     const uint8_t *note_data,
+     size_t note_data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_scan_predicate_t *scan_predicate = NULL;
+	const uint8_t *note_item_data             = NULL;
+	static char *function                     = "libnsfdb_column_scan_read_note_data";
+	size_t item_data_offset                   = 0;
+	size_t value_index                        = 0;
+	uint32_t note_size                        = 0;
+	uint16_t data_size                        = 0;
+	uint16_t field_flags                      = 0;
+	uint16_t note_item_index                  = 0;
+	uint16_t note_signature                   = 0;
+	uint16_t number_of_note_items             = 0;
+	uint16_t unk_table_index                  = 0;
+	int column_index                          = 0;
+	int number_of_predicates                  = 0;
+	int predicate_index                       = 0;
+	int result                                = 0;
+
+	if( internal_column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_column_scan->unk_column_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid column scan - missing UNK column indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_column_scan->number_of_rows >= internal_column_scan->maximum_number_of_rows )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column scan - number of rows value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( note_data_size < sizeof( nsfdb_note_header_t ) )
+	 || ( note_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid note data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->signature,
+	 note_signature );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->size,
+	 note_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->number_of_note_items,
+	 number_of_note_items );
+
+	if( note_signature != 0x0004 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported note signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) note_size != note_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid note size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	item_data_offset = sizeof( nsfdb_note_header_t ) + ( (size_t) number_of_note_items * sizeof( nsfdb_note_item_t ) );
+
+	if( item_data_offset > note_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of note items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < internal_column_scan->number_of_columns;
+	     column_index++ )
+	{
+		internal_column_scan->item_data[ column_index ]       = NULL;
+		internal_column_scan->item_data_sizes[ column_index ] = 0;
+	}
+	note_item_data = &( note_data[ sizeof( nsfdb_note_header_t ) ] );
+
+	for( note_item_index = 0;
+	     note_item_index < number_of_note_items;
+	     note_item_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (nsfdb_note_item_t *) note_item_data )->unk_table_index,
+		 unk_table_index );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (nsfdb_note_item_t *) note_item_data )->field_flags,
+		 field_flags );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (nsfdb_note_item_t *) note_item_data )->data_size,
+		 data_size );
+
+		note_item_data += sizeof( nsfdb_note_item_t );
+
+		/* Only the data of the summary items is stored in the note data
+		 */
+		if( ( ( field_flags & LIBNSFDB_NOTE_ITEM_FIELD_FLAG_SUMMARY ) == 0 )
+		 || ( data_size == 0 ) )
+		{
+			continue;
+		}
+		if( (size_t) data_size > ( note_data_size - item_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid note item: %" PRIu16 " data size value out of bounds.",
+			 function,
+			 note_item_index );
+
+			return( -1 );
+		}
+		if( (int) unk_table_index < internal_column_scan->number_of_unk_column_indexes )
+		{
+			column_index = internal_column_scan->unk_column_indexes[ unk_table_index ];
+
+			/* If a note contains multiple items for the same column the first item is used
+			 */
+			if( ( column_index != -1 )
+			 && ( internal_column_scan->item_data[ column_index ] == NULL ) )
+			{
+				internal_column_scan->item_data[ column_index ]       = &( note_data[ item_data_offset ] );
+				internal_column_scan->item_data_sizes[ column_index ] = data_size;
+			}
+		}
+		item_data_offset += data_size;
+	}
+	/* The predicates are evaluated on the item data in the note data
+	 * so that the values of a note that does not match are never copied
+	 */
+	if( libcdata_array_get_number_of_entries(
+	     internal_column_scan->predicates,
+	     &number_of_predicates,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of predicates.",
+		 function );
+
+		return( -1 );
+	}
+	for( predicate_index = 0;
+	     predicate_index < number_of_predicates;
+	     predicate_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_column_scan->predicates,
+		     predicate_index,
+		     (intptr_t **) &scan_predicate,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve predicate: %d.",
+			 function,
+			 predicate_index );
+
+			return( -1 );
+		}
+		if( scan_predicate == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing predicate: %d.",
+			 function,
+			 predicate_index );
+
+			return( -1 );
+		}
+		/* A note without a value for the column of the predicate does not match
+		 */
+		if( internal_column_scan->item_data[ scan_predicate->column_index ] == NULL )
+		{
+			return( 0 );
+		}
+		result = libnsfdb_scan_predicate_match_value_data(
+		          scan_predicate,
+		          internal_column_scan->item_data[ scan_predicate->column_index ],
+		          (size_t) internal_column_scan->item_data_sizes[ scan_predicate->column_index ],
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match predicate: %d.",
+			 function,
+			 predicate_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->rrv_identifier,
+	 internal_column_scan->note_identifiers[ internal_column_scan->number_of_rows ] );
+
+	for( column_index = 0;
+	     column_index < internal_column_scan->number_of_columns;
+	     column_index++ )
+	{
+		value_index = ( (size_t) column_index * (size_t) internal_column_scan->maximum_number_of_rows )
+		            + (size_t) internal_column_scan->number_of_rows;
+
+		internal_column_scan->value_data_offsets[ value_index ] = 0;
+		internal_column_scan->value_data_sizes[ value_index ]   = 0;
+
+		if( internal_column_scan->item_data[ column_index ] == NULL )
+		{
+			continue;
+		}
+		if( libnsfdb_column_scan_append_value_data(
+		     internal_column_scan,
+		     column_index,
+		     internal_column_scan->item_data[ column_index ],
+		     internal_column_scan->item_data_sizes[ column_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append column: %d value data.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+	}
+	internal_column_scan->number_of_rows += 1;
+
+	return( 1 );
+}
+
+/* Reads the next batch of rows
+ * Every row contains the values of the scanned columns of a note
+ * Notes that do not match the predicates are skipped
+ * Returns 1 if successful, 0 if there are no more notes to scan or -1 on error
+ */
+int libnsfdb_column_scan_read_rows(
+     libnsfdb_column_scan_t *column_scan,
+     int *number_of_rows,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *non_summary_bucket_cache           = NULL;
+	libfcache_cache_t *summary_bucket_cache               = NULL;
+	libnsfdb_bucket_t *summary_bucket                     = NULL;
+	libnsfdb_bucket_slot_t *summary_bucket_slot           = NULL;
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	libnsfdb_internal_file_t *internal_file               = NULL;
+	libnsfdb_note_index_entry_t *note_index_entry         = NULL;
+	static char *function                                 = "libnsfdb_column_scan_read_rows";
+	int number_of_notes                                   = 0;
+
+	if( column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+	if( internal_column_scan->internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid column scan - missing internal file.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_rows == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of rows.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = internal_column_scan->internal_file;
+
+	internal_column_scan->number_of_rows  = 0;
+	internal_column_scan->value_data_size = 0;
+
+	if( libnsfdb_file_read_note_index(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_index_get_number_of_entries(
+	     internal_file->io_handle->note_index,
+	     internal_column_scan->note_type,
+	     &number_of_notes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of note index entries.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( internal_column_scan->note_index < number_of_notes )
+	    && ( internal_column_scan->number_of_rows < internal_column_scan->maximum_number_of_rows ) )
+	{
+		if( internal_file->abort != 0 )
+		{
+			break;
+		}
+		if( libnsfdb_note_index_get_entry_by_index(
+		     internal_file->io_handle->note_index,
+		     internal_column_scan->note_type,
+		     internal_column_scan->note_index,
+		     &note_index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve note index entry: %d.",
+			 function,
+			 internal_column_scan->note_index );
+
+			return( -1 );
+		}
+		internal_column_scan->note_index += 1;
+
+		/* Only notes stored in a summary bucket slot are supported
+		 */
+		if( note_index_entry->rrv_value.type != LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER )
+		{
+			continue;
+		}
+		if( libnsfdb_file_get_bucket_caches(
+		     internal_file,
+		     &( note_index_entry->rrv_value ),
+		     &summary_bucket_cache,
+		     &non_summary_bucket_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bucket caches.",
+			 function );
+
+			return( -1 );
+		}
+		if( libnsfdb_io_handle_get_bucket_by_index(
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     internal_file->summary_bucket_list,
+		     summary_bucket_cache,
+		     LIBNSFDB_CACHE_POOL_VALUE_TYPE_SUMMARY_BUCKET,
+		     note_index_entry->rrv_value.bucket_index,
+		     &summary_bucket,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve summary bucket: %" PRIu32 ".",
+			 function,
+			 note_index_entry->rrv_value.bucket_index );
+
+			return( -1 );
+		}
+		if( libnsfdb_bucket_get_slot(
+		     summary_bucket,
+		     (int) note_index_entry->rrv_value.slot_index,
+		     &summary_bucket_slot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve summary bucket: %" PRIu32 " slot: %" PRIu16 ".",
+			 function,
+			 note_index_entry->rrv_value.bucket_index,
+			 note_index_entry->rrv_value.slot_index );
+
+			goto on_error;
+		}
+		if( summary_bucket_slot == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing summary bucket slot: %" PRIu16 ".",
+			 function,
+			 note_index_entry->rrv_value.slot_index );
+
+			goto on_error;
+		}
+		if( libnsfdb_column_scan_read_note_data(
+		     internal_column_scan,
+		     summary_bucket_slot->data,
+		     (size_t) summary_bucket_slot->size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read note: 0x%08" PRIx32 " data.",
+			 function,
+			 note_index_entry->rrv_value.rrv_identifier );
+
+			goto on_error;
+		}
+		if( libnsfdb_io_handle_release_bucket(
+		     internal_file->io_handle,
+		     &summary_bucket,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release summary bucket: %" PRIu32 ".",
+			 function,
+			 note_index_entry->rrv_value.bucket_index );
+
+			return( -1 );
+		}
+	}
+	*number_of_rows = internal_column_scan->number_of_rows;
+
+	if( internal_column_scan->number_of_rows == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( summary_bucket != NULL )
+	{
+		libnsfdb_io_handle_release_bucket(
+		 internal_file->io_handle,
+		 &summary_bucket,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of columns
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_column_scan_get_number_of_columns(
+     libnsfdb_column_scan_t *column_scan,
+     int *number_of_columns,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	static char *function                                 = "libnsfdb_column_scan_get_number_of_columns";
+
+	if( column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+	if( number_of_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of columns.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_columns = internal_column_scan->number_of_columns;
+
+	return( 1 );
+}
+
+/* Retrieves the note identifier of a specific row of the current batch
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_column_scan_get_note_identifier(
+     libnsfdb_column_scan_t *column_scan,
+     int row_index,
+     uint32_t *note_identifier,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	static char *function                                 = "libnsfdb_column_scan_get_note_identifier";
+
+	if( column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+	if( ( row_index < 0 )
+	 || ( row_index >= internal_column_scan->number_of_rows ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid row index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*note_identifier = internal_column_scan->note_identifiers[ row_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the value data size of a specific column and row of the current batch
+ * Returns 1 if successful, 0 if the note of the row has no value for the column or -1 on error
+ */
+int libnsfdb_column_scan_get_value_data_size(
+     libnsfdb_column_scan_t *column_scan,
+     int column_index,
+     int row_index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	static char *function                                 = "libnsfdb_column_scan_get_value_data_size";
+	size_t value_index                                    = 0;
+
+	if( column_scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column scan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+	if( ( column_index < 0 )
+	 || ( column_index >= internal_column_scan->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( row_index < 0 )
+	 || ( row_index >= internal_column_scan->number_of_rows ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid row index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	value_index = ( (size_t) column_index * (size_t) internal_column_scan->maximum_number_of_rows )
+	            + (size_t) row_index;
+
+	if( internal_column_scan->value_data_sizes[ value_index ] == 0 )
+	{
+		return( 0 );
+	}
+	*data_size = (size_t) internal_column_scan->value_data_sizes[ value_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the value data of a specific column and row of the current batch
+ * Returns 1 if successful, 0 if the note of the row has no value for the column or -1 on error
+ */
+int libnsfdb_column_scan_get_value_data(
+     libnsfdb_column_scan_t *column_scan,
+     int column_index,
+     int row_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	static char *function                                 = "libnsfdb_column_scan_get_value_data";
+	size_t value_data_size                                = 0;
+	size_t value_index                                    = 0;
+	int result                                            = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libnsfdb_column_scan_get_value_data_size(
+	          column_scan,
+	          column_index,
+	          row_index,
+	          &value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( data_size < value_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+		value_index = ( (size_t) column_index * (size_t) internal_column_scan->maximum_number_of_rows )
+		            + (size_t) row_index;
+
+		if( memory_copy(
+		     data,
+		     &( internal_column_scan->value_data[ internal_column_scan->value_data_offsets[ value_index ] ] ),
+		     value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
@@ -0,0 +1,217 @@
+/*
+ * Column scan functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_COLUMN_SCAN_H )
+#define _LIBNSFDB_COLUMN_SCAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_extern.h"
+#include "libnsfdb_file.h"
+#include "libnsfdb_libcdata.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_scan_predicate.h"
+#include "libnsfdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_internal_column_scan libnsfdb_internal_column_scan_t;
+
+struct libnsfdb_internal_column_scan
+{
+	/* The internal file
+	 */
+	libnsfdb_internal_file_t *internal_file;
+
+	/* The note type
+	 */
+	uint8_t note_type;
+
+	/* The index of the next note to scan
+	 */
+	int note_index;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The column index of every unique name key (UNK) table index
+	 * -1 represents that the items of the UNK table index are not scanned
+	 */
+	int *unk_column_indexes;
+
+	/* The number of UNK column indexes
+	 */
+	int number_of_unk_column_indexes;
+
+	/* The predicates array
+	 */
+	libcdata_array_t *predicates;
+
+	/* The item data of every column of the note that is being read
+	 * This references data in the summary bucket slot
+	 */
+	const uint8_t **item_data;
+
+	/* The item data size of every column of the note that is being read
+	 */
+	uint16_t *item_data_sizes;
+
+	/* The maximum number of rows in a batch
+	 */
+	int maximum_number_of_rows;
+
+	/* The number of rows in the current batch
+	 */
+	int number_of_rows;
+
+	/* The note identifier of every row
+	 */
+	uint32_t *note_identifiers;
+
+	/* The value data offsets
+	 * The offsets are stored per column, one for every row
+	 */
+	size_t *value_data_offsets;
+
+	/* The value data sizes
+	 * The sizes are stored per column, one for every row
+	 */
+	uint16_t *value_data_sizes;
+
+	/* The value data of the current batch
+	 */
+	uint8_t *value_data;
+
+	/* The value data size of the current batch
+	 */
+	size_t value_data_size;
+
+	/* The allocated value data size
+	 */
+	size_t allocated_value_data_size;
+};
+
+int libnsfdb_column_scan_initialize(
+     libnsfdb_column_scan_t **column_scan,
+     int number_of_columns,
+     int maximum_number_of_rows,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_column_scan_free(
+     libnsfdb_column_scan_t **column_scan,
+     libcerror_error_t **error );
+
+int libnsfdb_column_scan_set_field_names(
+     libnsfdb_internal_column_scan_t *internal_column_scan,
+     libcdata_array_t *unique_name_key_table,
+     const char **field_names,
+     libcerror_error_t **error );
+
+int libnsfdb_column_scan_append_predicate(
+     libnsfdb_internal_column_scan_t *internal_column_scan,
+     libnsfdb_scan_predicate_t *scan_predicate,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_column_scan_append_text_predicate(
+     libnsfdb_column_scan_t *column_scan,
+     int column_index,
+     uint8_t predicate_type,
+     const uint8_t *text,
+     size_t text_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_column_scan_append_number_range_predicate(
+     libnsfdb_column_scan_t *column_scan,
+     int column_index,
+     double minimum_number,
+     double maximum_number,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_column_scan_append_time_range_predicate(
+     libnsfdb_column_scan_t *column_scan,
+     int column_index,
+     uint64_t first_time,
+     uint64_t last_time,
+     libcerror_error_t **error );
+
+int libnsfdb_column_scan_append_value_data(
+     libnsfdb_internal_column_scan_t *internal_column_scan,
+     int column_index,
+     const uint8_t *data,
+     uint16_t data_size,
+     libcerror_error_t **error );
+
+int libnsfdb_column_scan_read_note_data(
+     libnsfdb_internal_column_scan_t *internal_column_scan,
+     const uint8_t *note_data,
+     size_t note_data_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_column_scan_read_rows(
+     libnsfdb_column_scan_t *column_scan,
+     int *number_of_rows,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_column_scan_get_number_of_columns(
+     libnsfdb_column_scan_t *column_scan,
+     int *number_of_columns,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_column_scan_get_note_identifier(
+     libnsfdb_column_scan_t *column_scan,
+     int row_index,
+     uint32_t *note_identifier,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_column_scan_get_value_data_size(
+     libnsfdb_column_scan_t *column_scan,
+     int column_index,
+     int row_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_column_scan_get_value_data(
+     libnsfdb_column_scan_t *column_scan,
+     int column_index,
+     int row_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_COLUMN_SCAN_H ) */
+
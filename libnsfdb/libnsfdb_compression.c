@@ -21,9 +21,11 @@
 
 #include <common.h>
 #include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include "libnsfdb_compression.h"
+#include "libnsfdb_definitions.h"
 #include "libnsfdb_libcerror.h"
 
 /* Decompressed CX (Huffman encoded) compressed data
@@ -418,3 +420,895 @@ int libnsfdb_compression_cx_decompress(
 	return( 1 );
 }
 
+/* Retrieves the maximum size of CX compressed data
+ * Returns 1 on success or -1 on error
+ */
+int libnsfdb_compression_cx_get_maximum_compressed_data_size(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_compression_cx_get_maximum_compressed_data_size";
+
+	if( uncompressed_data_size > (size_t) ( ( SSIZE_MAX / 9 ) - 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every byte is stored in at most 9 bits, which is the size of a literal,
+	 * preceded by 3 header bits and followed by the 18 bits of the end of data marker
+	 * and 2 bytes of padding
+	 */
+	*compressed_data_size = ( ( ( uncompressed_data_size * 9 ) + 3 + 18 + 7 ) / 8 ) + 2;
+
+	return( 1 );
+}
+
+/* Writes bits to CX compressed data
+ * The bits are stored least significant bit first
+ * Returns 1 on success or -1 on error
+ */
+int libnsfdb_compression_cx_write_bits(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_iterator,
+     uint8_t *bit_index,
+     uint32_t value_32bit,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function  = "libnsfdb_compression_cx_write_bits";
+	size_t data_iterator   = 0;
+	uint8_t data_bit_index = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_bits > 32 )
+	 || ( *bit_index >= 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits or bit index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data_iterator  = *compressed_data_iterator;
+	data_bit_index = *bit_index;
+
+	while( number_of_bits > 0 )
+	{
+		if( data_iterator >= compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_bit_index == 0 )
+		{
+			compressed_data[ data_iterator ] = 0;
+		}
+		compressed_data[ data_iterator ] |= (uint8_t) ( ( value_32bit & 0x00000001UL ) << data_bit_index );
+
+		value_32bit >>= 1;
+
+		data_bit_index++;
+
+		if( data_bit_index >= 8 )
+		{
+			data_bit_index = 0;
+			data_iterator++;
+		}
+		number_of_bits--;
+	}
+	*compressed_data_iterator = data_iterator;
+	*bit_index                = data_bit_index;
+
+	return( 1 );
+}
+
+/* Retrieves the number of bits of a CX compression tuple value
+ * A value is stored as a number of bits N, stored as N - 1 bits of 0 followed by a bit of 1,
+ * followed by the N-bit value minus ( 2 ^ N ) - 1
+ * Returns the number of bits
+ */
+uint8_t libnsfdb_compression_cx_get_tuple_value_number_of_bits(
+         uint16_t tuple_value )
+{
+	uint8_t number_of_bits = 0;
+
+	tuple_value += 1;
+
+	while( tuple_value > 1 )
+	{
+		number_of_bits++;
+
+		tuple_value >>= 1;
+	}
+	return( number_of_bits );
+}
+
+/* Retrieves the number of bits needed to store a CX compression tuple
+ * Returns the number of bits
+ */
+size_t libnsfdb_compression_cx_get_tuple_number_of_bits(
+        uint16_t tuple_size,
+        uint32_t tuple_offset )
+{
+	size_t number_of_bits = 0;
+
+	/* A compression tuple of size 2 is stored as the tag bits 1 and 1
+	 * followed by the 8-bit offset
+	 */
+	if( tuple_size == 2 )
+	{
+		return( 2 + 8 );
+	}
+	number_of_bits = 2
+	               + ( 2 * (size_t) libnsfdb_compression_cx_get_tuple_value_number_of_bits( tuple_size - 2 ) )
+	               + 1
+	               + 8;
+
+	if( tuple_offset > 0xff )
+	{
+		number_of_bits += 2 * (size_t) libnsfdb_compression_cx_get_tuple_value_number_of_bits(
+		                                (uint16_t) ( tuple_offset >> 8 ) );
+	}
+	return( number_of_bits );
+}
+
+/* Writes a CX compression tuple value
+ * Returns 1 on success or -1 on error
+ */
+int libnsfdb_compression_cx_write_tuple_value(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_iterator,
+     uint8_t *bit_index,
+     uint16_t tuple_value,
+     libcerror_error_t **error )
+{
+	static char *function  = "libnsfdb_compression_cx_write_tuple_value";
+	uint32_t value_32bit   = 0;
+	uint8_t number_of_bits = 0;
+
+	if( ( tuple_value == 0 )
+	 || ( tuple_value > 510 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tuple value value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_bits = libnsfdb_compression_cx_get_tuple_value_number_of_bits(
+	                  tuple_value );
+
+	value_32bit   = (uint32_t) tuple_value - ( ( (uint32_t) 1 << number_of_bits ) - 1 );
+	value_32bit <<= number_of_bits;
+	value_32bit  |= (uint32_t) 1 << ( number_of_bits - 1 );
+
+	if( libnsfdb_compression_cx_write_bits(
+	     compressed_data,
+	     compressed_data_size,
+	     compressed_data_iterator,
+	     bit_index,
+	     value_32bit,
+	     2 * number_of_bits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write tuple value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a CX compression tuple
+ * Returns 1 on success or -1 on error
+ */
+int libnsfdb_compression_cx_write_tuple(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_iterator,
+     uint8_t *bit_index,
+     uint16_t tuple_size,
+     uint32_t tuple_offset,
+     libcerror_error_t **error )
+{
+	static char *function  = "libnsfdb_compression_cx_write_tuple";
+	uint32_t value_32bit   = 0;
+	uint8_t number_of_bits = 0;
+
+	if( ( tuple_size < 2 )
+	 || ( tuple_size > LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tuple size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( tuple_offset == 0 )
+	 || ( tuple_offset > LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_OFFSET )
+	 || ( ( tuple_size == 2 )
+	  &&  ( tuple_offset > 0xff ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tuple offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* A compression tuple of size 2 is stored as the tag bits 1 and 1,
+	 * other sizes as the tag bits 1 and 0 followed by the size minus 2
+	 */
+	if( tuple_size == 2 )
+	{
+		value_32bit    = 0x00000003UL;
+		number_of_bits = 2;
+	}
+	else
+	{
+		value_32bit    = 0x00000001UL;
+		number_of_bits = 2;
+	}
+	if( libnsfdb_compression_cx_write_bits(
+	     compressed_data,
+	     compressed_data_size,
+	     compressed_data_iterator,
+	     bit_index,
+	     value_32bit,
+	     number_of_bits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write tag bits.",
+		 function );
+
+		return( -1 );
+	}
+	if( tuple_size > 2 )
+	{
+		if( libnsfdb_compression_cx_write_tuple_value(
+		     compressed_data,
+		     compressed_data_size,
+		     compressed_data_iterator,
+		     bit_index,
+		     tuple_size - 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write tuple size.",
+			 function );
+
+			return( -1 );
+		}
+		/* The upper bits (> 8) of the offset are stored after a tag bit of 0
+		 */
+		if( libnsfdb_compression_cx_write_bits(
+		     compressed_data,
+		     compressed_data_size,
+		     compressed_data_iterator,
+		     bit_index,
+		     ( tuple_offset > 0xff ) ? 0 : 1,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write offset tag bit.",
+			 function );
+
+			return( -1 );
+		}
+		if( tuple_offset > 0xff )
+		{
+			if( libnsfdb_compression_cx_write_tuple_value(
+			     compressed_data,
+			     compressed_data_size,
+			     compressed_data_iterator,
+			     bit_index,
+			     (uint16_t) ( tuple_offset >> 8 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write tuple offset upper bits.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( libnsfdb_compression_cx_write_bits(
+	     compressed_data,
+	     compressed_data_size,
+	     compressed_data_iterator,
+	     bit_index,
+	     tuple_offset & 0x000000ffUL,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write tuple offset lower bits.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the CX compression hash of the 3 bytes at the start of the data
+ * Returns the hash
+ */
+uint32_t libnsfdb_compression_cx_calculate_hash(
+          const uint8_t *data )
+{
+	uint32_t value_32bit = 0;
+
+	value_32bit   = data[ 0 ];
+	value_32bit <<= 8;
+	value_32bit  |= data[ 1 ];
+	value_32bit <<= 8;
+	value_32bit  |= data[ 2 ];
+	value_32bit  *= 0x9e3779b1UL;
+
+	return( ( value_32bit & 0xffffffffUL ) >> ( 32 - LIBNSFDB_COMPRESSION_CX_HASH_TABLE_BITS ) );
+}
+
+/* Finds the longest match of the data at the uncompressed data iterator
+ * The hash chains must contain all positions before the uncompressed data iterator
+ * Returns the size of the match, or 0 if no match was found
+ */
+uint16_t libnsfdb_compression_cx_find_match(
+          const uint8_t *uncompressed_data,
+          size_t uncompressed_data_size,
+          size_t uncompressed_data_iterator,
+          const uint32_t *hash_chain_heads,
+          const uint32_t *hash_chain_previous,
+          int maximum_number_of_chain_entries,
+          uint32_t *match_offset )
+{
+	size_t candidate_iterator = 0;
+	size_t maximum_match_size = 0;
+	size_t match_size         = 0;
+	uint32_t candidate        = 0;
+	uint32_t candidate_offset = 0;
+	uint16_t best_match_size  = 0;
+
+	/* The decompression requires a compression tuple to end before the end of the data
+	 */
+	if( ( uncompressed_data_iterator + 1 ) >= uncompressed_data_size )
+	{
+		return( 0 );
+	}
+	maximum_match_size = uncompressed_data_size - uncompressed_data_iterator - 1;
+
+	if( maximum_match_size > LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_SIZE )
+	{
+		maximum_match_size = LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_SIZE;
+	}
+	if( maximum_match_size < 3 )
+	{
+		return( 0 );
+	}
+	candidate = hash_chain_heads[ libnsfdb_compression_cx_calculate_hash(
+	                               &( uncompressed_data[ uncompressed_data_iterator ] ) ) ];
+
+	while( ( candidate != 0 )
+	    && ( maximum_number_of_chain_entries > 0 ) )
+	{
+		candidate_iterator = (size_t) candidate - 1;
+		candidate_offset   = (uint32_t) ( uncompressed_data_iterator - candidate_iterator );
+
+		if( candidate_offset > LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_OFFSET )
+		{
+			break;
+		}
+		if( uncompressed_data[ candidate_iterator + best_match_size ] == uncompressed_data[ uncompressed_data_iterator + best_match_size ] )
+		{
+			for( match_size = 0;
+			     match_size < maximum_match_size;
+			     match_size++ )
+			{
+				if( uncompressed_data[ candidate_iterator + match_size ] != uncompressed_data[ uncompressed_data_iterator + match_size ] )
+				{
+					break;
+				}
+			}
+			if( match_size > (size_t) best_match_size )
+			{
+				best_match_size = (uint16_t) match_size;
+				*match_offset   = candidate_offset;
+
+				if( match_size == maximum_match_size )
+				{
+					break;
+				}
+			}
+		}
+		candidate = hash_chain_previous[ candidate_iterator ];
+
+		maximum_number_of_chain_entries--;
+	}
+	if( best_match_size < 3 )
+	{
+		return( 0 );
+	}
+	/* Only use the match if it is smaller than storing the bytes as literals
+	 */
+	if( libnsfdb_compression_cx_get_tuple_number_of_bits(
+	     best_match_size,
+	     *match_offset ) >= ( 9 * (size_t) best_match_size ) )
+	{
+		return( 0 );
+	}
+	return( best_match_size );
+}
+
+/* Compresses data using CX compression
+ * The compression level determines the number of hash chain entries that are searched for a match
+ * and if the match of the next byte is tried before using a match (lazy matching)
+ * On input compressed_data_size contains the size of the compressed data buffer
+ * and on output the size of the compressed data
+ * Returns 1 on success or -1 on error
+ */
+int libnsfdb_compression_cx_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	uint32_t *hash_chain_heads          = NULL;
+	uint32_t *hash_chain_previous       = NULL;
+	static char *function               = "libnsfdb_compression_cx_compress";
+	size_t compressed_data_iterator     = 0;
+	size_t hash_chain_iterator          = 0;
+	size_t safe_compressed_data_size    = 0;
+	size_t uncompressed_data_iterator   = 0;
+	uint32_t hash_value                 = 0;
+	uint32_t match_offset               = 0;
+	uint32_t next_match_offset          = 0;
+	uint16_t match_size                 = 0;
+	uint16_t next_match_size            = 0;
+	uint8_t bit_index                   = 0;
+	uint8_t use_lazy_matching           = 0;
+	int maximum_number_of_chain_entries = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_SIZE_T > 4
+	if( uncompressed_data_size >= (size_t) UINT32_MAX )
+#else
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_size = *compressed_data_size;
+
+	if( safe_compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( compression_level )
+	{
+		case LIBNSFDB_COMPRESSION_LEVEL_NONE:
+			maximum_number_of_chain_entries = 0;
+			use_lazy_matching               = 0;
+			break;
+
+		case LIBNSFDB_COMPRESSION_LEVEL_FAST:
+			maximum_number_of_chain_entries = 4;
+			use_lazy_matching               = 0;
+			break;
+
+		case LIBNSFDB_COMPRESSION_LEVEL_DEFAULT:
+			maximum_number_of_chain_entries = 32;
+			use_lazy_matching               = 1;
+			break;
+
+		case LIBNSFDB_COMPRESSION_LEVEL_BEST:
+			maximum_number_of_chain_entries = 1024;
+			use_lazy_matching               = 1;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression level.",
+			 function );
+
+			return( -1 );
+	}
+	if( ( maximum_number_of_chain_entries > 0 )
+	 && ( uncompressed_data_size > 0 ) )
+	{
+		if( ( sizeof( uint32_t ) * uncompressed_data_size ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid uncompressed data size value exceeds maximum allocation size.",
+			 function );
+
+			goto on_error;
+		}
+		hash_chain_heads = (uint32_t *) memory_allocate(
+		                                 sizeof( uint32_t ) * LIBNSFDB_COMPRESSION_CX_HASH_TABLE_SIZE );
+
+		if( hash_chain_heads == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hash chain heads.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     hash_chain_heads,
+		     0,
+		     sizeof( uint32_t ) * LIBNSFDB_COMPRESSION_CX_HASH_TABLE_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear hash chain heads.",
+			 function );
+
+			goto on_error;
+		}
+		hash_chain_previous = (uint32_t *) memory_allocate(
+		                                    sizeof( uint32_t ) * uncompressed_data_size );
+
+		if( hash_chain_previous == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hash chain previous.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The lower 3 bits of the first byte must contain a value larger than 3
+	 */
+	if( libnsfdb_compression_cx_write_bits(
+	     compressed_data,
+	     safe_compressed_data_size,
+	     &compressed_data_iterator,
+	     &bit_index,
+	     4,
+	     3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		goto on_error;
+	}
+	while( uncompressed_data_iterator < uncompressed_data_size )
+	{
+		match_size = 0;
+
+		if( hash_chain_heads != NULL )
+		{
+			/* Add the positions before the uncompressed data iterator to the hash chains
+			 */
+			while( ( hash_chain_iterator < uncompressed_data_iterator )
+			    && ( ( hash_chain_iterator + 2 ) < uncompressed_data_size ) )
+			{
+				hash_value = libnsfdb_compression_cx_calculate_hash(
+				              &( uncompressed_data[ hash_chain_iterator ] ) );
+
+				hash_chain_previous[ hash_chain_iterator ] = hash_chain_heads[ hash_value ];
+				hash_chain_heads[ hash_value ]             = (uint32_t) hash_chain_iterator + 1;
+
+				hash_chain_iterator++;
+			}
+			match_size = libnsfdb_compression_cx_find_match(
+			              uncompressed_data,
+			              uncompressed_data_size,
+			              uncompressed_data_iterator,
+			              hash_chain_heads,
+			              hash_chain_previous,
+			              maximum_number_of_chain_entries,
+			              &match_offset );
+
+			/* Store a literal if the match of the next byte is larger
+			 */
+			if( ( use_lazy_matching != 0 )
+			 && ( match_size > 0 )
+			 && ( match_size < LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_SIZE )
+			 && ( ( uncompressed_data_iterator + 3 ) < uncompressed_data_size ) )
+			{
+				hash_value = libnsfdb_compression_cx_calculate_hash(
+				              &( uncompressed_data[ uncompressed_data_iterator ] ) );
+
+				hash_chain_previous[ uncompressed_data_iterator ] = hash_chain_heads[ hash_value ];
+				hash_chain_heads[ hash_value ]                    = (uint32_t) uncompressed_data_iterator + 1;
+
+				hash_chain_iterator = uncompressed_data_iterator + 1;
+
+				next_match_size = libnsfdb_compression_cx_find_match(
+				                   uncompressed_data,
+				                   uncompressed_data_size,
+				                   uncompressed_data_iterator + 1,
+				                   hash_chain_heads,
+				                   hash_chain_previous,
+				                   maximum_number_of_chain_entries,
+				                   &next_match_offset );
+
+				if( next_match_size > match_size )
+				{
+					match_size = 0;
+				}
+			}
+		}
+		if( match_size > 0 )
+		{
+			if( libnsfdb_compression_cx_write_tuple(
+			     compressed_data,
+			     safe_compressed_data_size,
+			     &compressed_data_iterator,
+			     &bit_index,
+			     match_size,
+			     match_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write compression tuple at offset: %" PRIzd ".",
+				 function,
+				 uncompressed_data_iterator );
+
+				goto on_error;
+			}
+			uncompressed_data_iterator += match_size;
+		}
+		else
+		{
+			/* An uncompressed byte is stored as a 0 tag bit followed by the byte
+			 */
+			if( libnsfdb_compression_cx_write_bits(
+			     compressed_data,
+			     safe_compressed_data_size,
+			     &compressed_data_iterator,
+			     &bit_index,
+			     (uint32_t) uncompressed_data[ uncompressed_data_iterator ] << 1,
+			     9,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to write literal at offset: %" PRIzd ".",
+				 function,
+				 uncompressed_data_iterator );
+
+				goto on_error;
+			}
+			uncompressed_data_iterator++;
+		}
+	}
+	if( hash_chain_previous != NULL )
+	{
+		memory_free(
+		 hash_chain_previous );
+
+		hash_chain_previous = NULL;
+	}
+	if( hash_chain_heads != NULL )
+	{
+		memory_free(
+		 hash_chain_heads );
+
+		hash_chain_heads = NULL;
+	}
+	/* The end of the compressed data is signified by a compression tuple
+	 * with a size of 0x0102, which consists of the tag bits 1 and 0,
+	 * 7 bits of 0 followed by a bit of 1 and the 8-bit value 1
+	 */
+	if( libnsfdb_compression_cx_write_bits(
+	     compressed_data,
+	     safe_compressed_data_size,
+	     &compressed_data_iterator,
+	     &bit_index,
+	     0x00000601UL,
+	     18,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write end of data marker.",
+		 function );
+
+		goto on_error;
+	}
+	if( bit_index != 0 )
+	{
+		compressed_data_iterator++;
+	}
+	/* The decompression reads ahead 1 byte hence 2 bytes of padding are added
+	 */
+	if( ( safe_compressed_data_size < 2 )
+	 || ( compressed_data_iterator > ( safe_compressed_data_size - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data[ compressed_data_iterator++ ] = 0;
+	compressed_data[ compressed_data_iterator++ ] = 0;
+
+	*compressed_data_size = compressed_data_iterator;
+
+	return( 1 );
+
+on_error:
+	if( hash_chain_previous != NULL )
+	{
+		memory_free(
+		 hash_chain_previous );
+	}
+	if( hash_chain_heads != NULL )
+	{
+		memory_free(
+		 hash_chain_heads );
+	}
+	return( -1 );
+}
+
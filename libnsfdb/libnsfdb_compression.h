@@ -31,6 +31,23 @@
 extern "C" {
 #endif
 
+/* The number of bits of the CX compression hash
+ */
+#define LIBNSFDB_COMPRESSION_CX_HASH_TABLE_BITS		12
+
+/* The number of entries in the CX compression hash table
+ */
+#define LIBNSFDB_COMPRESSION_CX_HASH_TABLE_SIZE		( 1 << LIBNSFDB_COMPRESSION_CX_HASH_TABLE_BITS )
+
+/* The maximum size of a CX compression tuple
+ */
+#define LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_SIZE	257
+
+/* The maximum offset of a CX compression tuple
+ * The decompression stores the offset as a 16-bit value
+ */
+#define LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_OFFSET	65535
+
 int libnsfdb_compression_cx_decompress(
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
@@ -38,6 +55,64 @@ int libnsfdb_compression_cx_decompress(
      size_t compressed_data_size,
      libcerror_error_t **error );
 
+int libnsfdb_compression_cx_get_maximum_compressed_data_size(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int libnsfdb_compression_cx_write_bits(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_iterator,
+     uint8_t *bit_index,
+     uint32_t value_32bit,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
+uint8_t libnsfdb_compression_cx_get_tuple_value_number_of_bits(
+         uint16_t tuple_value );
+
+size_t libnsfdb_compression_cx_get_tuple_number_of_bits(
+        uint16_t tuple_size,
+        uint32_t tuple_offset );
+
+int libnsfdb_compression_cx_write_tuple_value(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_iterator,
+     uint8_t *bit_index,
+     uint16_t tuple_value,
+     libcerror_error_t **error );
+
+int libnsfdb_compression_cx_write_tuple(
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_iterator,
+     uint8_t *bit_index,
+     uint16_t tuple_size,
+     uint32_t tuple_offset,
+     libcerror_error_t **error );
+
+uint32_t libnsfdb_compression_cx_calculate_hash(
+          const uint8_t *data );
+
+uint16_t libnsfdb_compression_cx_find_match(
+          const uint8_t *uncompressed_data,
+          size_t uncompressed_data_size,
+          size_t uncompressed_data_iterator,
+          const uint32_t *hash_chain_heads,
+          const uint32_t *hash_chain_previous,
+          int maximum_number_of_chain_entries,
+          uint32_t *match_offset );
+
+int libnsfdb_compression_cx_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -26,17 +26,29 @@
 #include <wide_string.h>
 
 #include "libnsfdb_bucket.h"
+#include "libnsfdb_bucket_list.h"
+#include "libnsfdb_bucket_prefetch.h"
+#include "libnsfdb_cache_pool.h"
+#include "libnsfdb_column_scan.h"
 #include "libnsfdb_debug.h"
 #include "libnsfdb_definitions.h"
 #include "libnsfdb_file.h"
+#include "libnsfdb_file_io_pool_entry.h"
+#include "libnsfdb_index_file.h"
 #include "libnsfdb_io_handle.h"
 #include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcdata.h"
 #include "libnsfdb_libcerror.h"
 #include "libnsfdb_libcnotify.h"
 #include "libnsfdb_libfcache.h"
 #include "libnsfdb_libfdata.h"
 #include "libnsfdb_note.h"
+#include "libnsfdb_note_filter.h"
+#include "libnsfdb_note_index.h"
+#include "libnsfdb_note_recovery.h"
+#include "libnsfdb_recovery.h"
 #include "libnsfdb_rrv_value.h"
+#include "libnsfdb_text_index.h"
 #include "libnsfdb_types.h"
 
 /* Creates a file
@@ -113,6 +125,8 @@ int libnsfdb_file_initialize(
 
 		goto on_error;
 	}
+	internal_file->number_of_recovery_threads = 1;
+
 	*file = (libnsfdb_file_t *) internal_file;
 
 	return( 1 );
@@ -170,6 +184,24 @@ int libnsfdb_file_free(
 		}
 		*file = NULL;
 
+		if( internal_file->io_handle->cache_pool != NULL )
+		{
+			if( libnsfdb_cache_pool_detach_owner(
+			     internal_file->io_handle->cache_pool,
+			     internal_file->io_handle->cache_pool_owner_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to detach file from cache pool.",
+				 function );
+
+				result = -1;
+			}
+			internal_file->io_handle->cache_pool = NULL;
+		}
 		if( libnsfdb_io_handle_free(
 		     &( internal_file->io_handle ),
 		     error ) != 1 )
@@ -183,6 +215,18 @@ int libnsfdb_file_free(
 
 			result = -1;
 		}
+		if( internal_file->index_filename != NULL )
+		{
+			memory_free(
+			 internal_file->index_filename );
+		}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		if( internal_file->index_filename_wide != NULL )
+		{
+			memory_free(
+			 internal_file->index_filename_wide );
+		}
+#endif
 		memory_free(
 		 internal_file );
 	}
@@ -633,6 +677,92 @@ on_error:
 	return( -1 );
 }
 
+/* Opens a Notes Storage Facility file using an entry of a Basic File IO (bfio) pool
+ * The file IO pool reopens the file IO handle of the entry on demand and
+ * closes the least recently used file IO handles if the maximum number of
+ * open handles of the pool is reached
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_open_file_io_pool(
+     libnsfdb_file_t *file,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_open_file_io_pool";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_io_pool_entry_initialize_file_io_handle(
+	     &file_io_handle,
+	     file_io_pool,
+	     file_io_pool_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO pool entry: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Closes a Notes Storage Facility file
  * Returns 0 if successful or -1 on error
  */
@@ -668,6 +798,24 @@ int libnsfdb_file_close(
 
 		return( -1 );
 	}
+	/* The prefetch thread reads using a clone of the file IO handle
+	 */
+	if( internal_file->bucket_prefetch != NULL )
+	{
+		if( libnsfdb_bucket_prefetch_free(
+		     &( internal_file->bucket_prefetch ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free bucket prefetch.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -724,7 +872,27 @@ int libnsfdb_file_close(
 		internal_file->file_io_handle_created_in_library = 0;
 	}
 	internal_file->file_io_handle = NULL;
+	internal_file->is_recovered   = 0;
+
+	/* The values in the cache pool cannot be reused if the file is reopened
+	 */
+	if( internal_file->io_handle->cache_pool != NULL )
+	{
+		if( libnsfdb_cache_pool_remove_values(
+		     internal_file->io_handle->cache_pool,
+		     internal_file->io_handle->cache_pool_owner_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove values from cache pool.",
+			 function );
 
+			result = -1;
+		}
+	}
 	if( libnsfdb_io_handle_clear(
 	     internal_file->io_handle,
 	     error ) != 1 )
@@ -802,35 +970,96 @@ int libnsfdb_file_close(
 			result = -1;
 		}
 	}
+	if( internal_file->summary_bucket_scan_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_file->summary_bucket_scan_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free summary bucket scan cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->non_summary_bucket_scan_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_file->non_summary_bucket_scan_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free non-summary bucket scan cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->bucket_history != NULL )
+	{
+		if( libnsfdb_bucket_history_free(
+		     &( internal_file->bucket_history ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free bucket history.",
+			 function );
+
+			result = -1;
+		}
+	}
 	return( result );
 }
 
-/* Opens a Notes Storage Facility file for reading
- * Returns 1 if successful or -1 on error
+/* Refreshes an open file
+ * Reads the database header and the most recently written superblock again.
+ * The bucket lists and bucket descriptor block are only updated when
+ * the superblock has changed, cached buckets are invalidated unless
+ * the bucket header in the file shows they did not change
+ * The superblock key is only updated when the refresh was successful
+ * A file of which the bucket lists were recovered cannot be refreshed
+ * Returns 1 if refreshed, 0 if the file did not change or -1 on error
  */
-int libnsfdb_file_open_read(
-     libnsfdb_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+int libnsfdb_file_refresh(
+     libnsfdb_file_t *file,
      libcerror_error_t **error )
 {
-	static char *function                   = "libnsfdb_file_open_read";
-	uint32_t database_header_size           = 0;
-	off64_t bucket_descriptor_block1_offset = 0;
-	off64_t bucket_descriptor_block2_offset = 0;
-	off64_t data_rrv_bucket_offset          = 0;
-	off64_t non_data_rrv_bucket_offset      = 0;
-	off64_t superblock1_offset              = 0;
-	off64_t superblock2_offset              = 0;
-	off64_t superblock3_offset              = 0;
-	off64_t superblock4_offset              = 0;
-	uint32_t bucket_descriptor_block1_size  = 0;
-	uint32_t bucket_descriptor_block2_size  = 0;
-	uint32_t superblock1_size               = 0;
-	uint32_t superblock2_size               = 0;
-	uint32_t superblock3_size               = 0;
-	uint32_t superblock4_size               = 0;
+	off64_t superblock_offsets[ 4 ];
+	uint32_t superblock_sizes[ 4 ];
 
-	if( internal_file == NULL )
+	libfdata_list_t *non_summary_bucket_list  = NULL;
+	libfdata_list_t *summary_bucket_list      = NULL;
+	libnsfdb_internal_file_t *internal_file   = NULL;
+	static char *function                     = "libnsfdb_file_refresh";
+	off64_t bucket_descriptor_block1_offset   = 0;
+	off64_t bucket_descriptor_block2_offset   = 0;
+	off64_t data_rrv_bucket_offset            = 0;
+	off64_t non_data_rrv_bucket_offset        = 0;
+	uint32_t bucket_descriptor_block1_size    = 0;
+	uint32_t bucket_descriptor_block2_size    = 0;
+	uint32_t database_header_size             = 0;
+	uint32_t newest_superblock_checksum       = 0;
+	uint32_t newest_superblock_write_count    = 0;
+	uint32_t previous_superblock_checksum     = 0;
+	uint32_t previous_superblock_write_count  = 0;
+	uint32_t superblock_checksum              = 0;
+	uint32_t superblock_write_count           = 0;
+	int newest_superblock_index               = -1;
+	int number_of_updated_non_summary_buckets = 0;
+	int number_of_updated_summary_buckets     = 0;
+	int superblock_index                      = 0;
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -841,71 +1070,67 @@ int libnsfdb_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing io handle.",
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->summary_bucket_list != NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - summary bucket list already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing io handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->summary_bucket_cache != NULL )
+	/* The bucket lists of a recovered file do not correspond with a superblock
+	 */
+	if( internal_file->is_recovered != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - summary bucket cache already set.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported recovered file.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->non_summary_bucket_list != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - non summary bucket list already set.",
-		 function );
+	previous_superblock_write_count = internal_file->io_handle->superblock_write_count;
+	previous_superblock_checksum    = internal_file->io_handle->superblock_checksum;
 
-		return( -1 );
-	}
-	if( internal_file->non_summary_bucket_cache != NULL )
+	/* Buckets that are being prefetched could have been read before the file changed
+	 */
+	if( internal_file->bucket_prefetch != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - non summary bucket cache already set.",
-		 function );
+		if( libnsfdb_bucket_prefetch_clear(
+		     internal_file->bucket_prefetch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear bucket prefetch.",
+			 function );
 
-		return( -1 );
-	}
-#if defined( HAVE_VERBOSE_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
+			goto on_error;
+		}
 	}
-#endif
 	if( libnsfdb_io_handle_read_file_header(
 	     internal_file->io_handle,
-	     file_io_handle,
+	     internal_file->file_io_handle,
 	     &database_header_size,
 	     error ) != 1 )
 	{
@@ -918,25 +1143,20 @@ int libnsfdb_file_open_read(
 
 		goto on_error;
 	}
-#if defined( HAVE_VERBOSE_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading database header:\n" );
-	}
-#endif
+	/* Reading the database header also updates the file size
+	 */
 	if( libnsfdb_io_handle_read_database_header(
 	     internal_file->io_handle,
-	     file_io_handle,
+	     internal_file->file_io_handle,
 	     database_header_size,
-	     &superblock1_offset,
-	     &superblock1_size,
-	     &superblock2_offset,
-	     &superblock2_size,
-	     &superblock3_offset,
-	     &superblock3_size,
-	     &superblock4_offset,
-	     &superblock4_size,
+	     &( superblock_offsets[ 0 ] ),
+	     &( superblock_sizes[ 0 ] ),
+	     &( superblock_offsets[ 1 ] ),
+	     &( superblock_sizes[ 1 ] ),
+	     &( superblock_offsets[ 2 ] ),
+	     &( superblock_sizes[ 2 ] ),
+	     &( superblock_offsets[ 3 ] ),
+	     &( superblock_sizes[ 3 ] ),
 	     &bucket_descriptor_block1_offset,
 	     &bucket_descriptor_block1_size,
 	     &bucket_descriptor_block2_offset,
@@ -954,41 +1174,96 @@ int libnsfdb_file_open_read(
 
 		goto on_error;
 	}
-	if( libfdata_list_initialize(
-	     &( internal_file->summary_bucket_list ),
-	     NULL,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
+	/* The superblock with the highest write count is the most recently written one,
+	 * a superblock that is being written could be unreadable
+	 */
+	for( superblock_index = 0;
+	     superblock_index < 4;
+	     superblock_index++ )
+	{
+		if( superblock_sizes[ superblock_index ] == 0 )
+		{
+			continue;
+		}
+		if( libnsfdb_io_handle_read_superblock_key(
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     superblock_offsets[ superblock_index ],
+		     superblock_sizes[ superblock_index ],
+		     &superblock_write_count,
+		     &superblock_checksum,
+		     error ) != 1 )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read superblock: %d key.\n",
+				 function,
+				 superblock_index + 1 );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			continue;
+		}
+		if( ( newest_superblock_index == -1 )
+		 || ( superblock_write_count > newest_superblock_write_count ) )
+		{
+			newest_superblock_index       = superblock_index;
+			newest_superblock_write_count = superblock_write_count;
+			newest_superblock_checksum    = superblock_checksum;
+		}
+	}
+	if( newest_superblock_index == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create summary bucket list.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read superblock key.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_file->summary_bucket_cache ),
-	     LIBNSFDB_MAXIMUM_CACHE_ENTRIES_BUCKETS,
+	if( ( newest_superblock_write_count == previous_superblock_write_count )
+	 && ( newest_superblock_checksum == previous_superblock_checksum ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading superblock: %d:\n",
+		 newest_superblock_index + 1 );
+	}
+#endif
+	/* The superblock is read into separate bucket lists so that
+	 * only the elements that changed are updated
+	 */
+	if( libfdata_list_initialize(
+	     &summary_bucket_list,
+	     NULL,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create summary bucket cache.",
+		 "%s: unable to create summary bucket list.",
 		 function );
 
 		goto on_error;
 	}
 	if( libfdata_list_initialize(
-	     &( internal_file->non_summary_bucket_list ),
+	     &non_summary_bucket_list,
 	     NULL,
 	     NULL,
 	     NULL,
@@ -1006,87 +1281,121 @@ int libnsfdb_file_open_read(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_file->non_summary_bucket_cache ),
-	     LIBNSFDB_MAXIMUM_CACHE_ENTRIES_BUCKETS,
+	if( libnsfdb_io_handle_read_superblock(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     superblock_offsets[ newest_superblock_index ],
+	     superblock_sizes[ newest_superblock_index ],
+	     summary_bucket_list,
+	     internal_file->summary_bucket_cache,
+	     non_summary_bucket_list,
+	     internal_file->non_summary_bucket_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read superblock: %d.",
+		 function,
+		 newest_superblock_index + 1 );
+
+		goto on_error;
+	}
+	if( libnsfdb_bucket_list_update(
+	     internal_file->summary_bucket_list,
+	     summary_bucket_list,
+	     internal_file->file_io_handle,
+	     internal_file->io_handle->cache_pool,
+	     internal_file->io_handle->cache_pool_owner_identifier,
+	     LIBNSFDB_CACHE_POOL_VALUE_TYPE_SUMMARY_BUCKET,
+	     &number_of_updated_summary_buckets,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create non-summary bucket cache.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update summary bucket list.",
 		 function );
 
 		goto on_error;
 	}
-	/* TODO determine the last modified superblock
-	 * try to read it
-	 * fallback to previously modified superblocks if necessary?
-	 */
+	if( libnsfdb_bucket_list_update(
+	     internal_file->non_summary_bucket_list,
+	     non_summary_bucket_list,
+	     internal_file->file_io_handle,
+	     internal_file->io_handle->cache_pool,
+	     internal_file->io_handle->cache_pool_owner_identifier,
+	     LIBNSFDB_CACHE_POOL_VALUE_TYPE_NON_SUMMARY_BUCKET,
+	     &number_of_updated_non_summary_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update non-summary bucket list.",
+		 function );
 
+		goto on_error;
+	}
 #if defined( HAVE_VERBOSE_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "Reading superblock:\n" );
+		 "%s: number of updated summary buckets\t: %d\n",
+		 function,
+		 number_of_updated_summary_buckets );
+
+		libcnotify_printf(
+		 "%s: number of updated non-summary buckets\t: %d\n",
+		 function,
+		 number_of_updated_non_summary_buckets );
+
+		libcnotify_printf(
+		 "\n" );
 	}
 #endif
-	if( libnsfdb_io_handle_read_superblock(
-	     internal_file->io_handle,
-	     file_io_handle,
-	     superblock1_offset,
-	     superblock1_size,
-	     internal_file->summary_bucket_list,
-	     internal_file->summary_bucket_cache,
-	     internal_file->non_summary_bucket_list,
-	     internal_file->non_summary_bucket_cache,
+	if( libfdata_list_free(
+	     &non_summary_bucket_list,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read superblock.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free non-summary bucket list.",
 		 function );
 
 		goto on_error;
 	}
-#ifdef TODO
-/* TODO read secondary superblock */
-#if defined( HAVE_VERBOSE_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libfdata_list_free(
+	     &summary_bucket_list,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "Reading superblock:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free summary bucket list.",
+		 function );
+
+		goto on_error;
 	}
-#endif
-	if( libnsfdb_io_handle_read_superblock(
+	if( libnsfdb_io_handle_clear_bucket_descriptor_block(
 	     internal_file->io_handle,
-	     file_io_handle,
-	     superblock2_offset,
-	     superblock2_size,
-	     internal_file->summary_bucket_list,
-	     internal_file->summary_bucket_cache,
-	     internal_file->non_summary_bucket_list,
-	     internal_file->non_summary_bucket_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read superblock.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear bucket descriptor block.",
 		 function );
 
 		goto on_error;
 	}
-#endif
-	/* TODO determine the last modified BDB
-	 * try to read it
-	 * fallback to previously BDB superblocks if necessary?
-	 */
-
 #if defined( HAVE_VERBOSE_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1096,7 +1405,7 @@ int libnsfdb_file_open_read(
 #endif
 	if( libnsfdb_io_handle_read_bucket_descriptor_block(
 	     internal_file->io_handle,
-	     file_io_handle,
+	     internal_file->file_io_handle,
 	     bucket_descriptor_block1_offset,
 	     bucket_descriptor_block1_size,
 	     error ) != 1 )
@@ -1110,49 +1419,60 @@ int libnsfdb_file_open_read(
 
 		goto on_error;
 	}
+	internal_file->io_handle->superblock_write_count = newest_superblock_write_count;
+	internal_file->io_handle->superblock_checksum    = newest_superblock_checksum;
+
 	return( 1 );
 
 on_error:
-	if( internal_file->non_summary_bucket_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &( internal_file->non_summary_bucket_cache ),
-		 NULL );
-	}
-	if( internal_file->non_summary_bucket_list != NULL )
+	/* Reading the superblock sets the superblock key, it is restored so that
+	 * a subsequent refresh does not consider a partially refreshed file unchanged
+	 */
+	internal_file->io_handle->superblock_write_count = previous_superblock_write_count;
+	internal_file->io_handle->superblock_checksum    = previous_superblock_checksum;
+
+	if( non_summary_bucket_list != NULL )
 	{
 		libfdata_list_free(
-		 &( internal_file->non_summary_bucket_list ),
-		 NULL );
-	}
-	if( internal_file->summary_bucket_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &( internal_file->summary_bucket_cache ),
+		 &non_summary_bucket_list,
 		 NULL );
 	}
-	if( internal_file->summary_bucket_list != NULL )
+	if( summary_bucket_list != NULL )
 	{
 		libfdata_list_free(
-		 &( internal_file->summary_bucket_list ),
+		 &summary_bucket_list,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the number of notes
+/* Opens a Notes Storage Facility file for reading
  * Returns 1 if successful or -1 on error
  */
-int libnsfdb_file_get_number_of_notes(
-     libnsfdb_file_t *file,
-     uint8_t note_type,
-     int *number_of_notes,
+int libnsfdb_file_open_read(
+     libnsfdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libnsfdb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libnsfdb_file_get_number_of_notes";
+	static char *function                   = "libnsfdb_file_open_read";
+	uint32_t database_header_size           = 0;
+	off64_t bucket_descriptor_block1_offset = 0;
+	off64_t bucket_descriptor_block2_offset = 0;
+	off64_t data_rrv_bucket_offset          = 0;
+	off64_t non_data_rrv_bucket_offset      = 0;
+	off64_t superblock1_offset              = 0;
+	off64_t superblock2_offset              = 0;
+	off64_t superblock3_offset              = 0;
+	off64_t superblock4_offset              = 0;
+	uint32_t bucket_descriptor_block1_size  = 0;
+	uint32_t bucket_descriptor_block2_size  = 0;
+	uint32_t superblock1_size               = 0;
+	uint32_t superblock2_size               = 0;
+	uint32_t superblock3_size               = 0;
+	uint32_t superblock4_size               = 0;
+	int result                              = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1163,131 +1483,3771 @@ int libnsfdb_file_get_number_of_notes(
 
 		return( -1 );
 	}
-	internal_file = (libnsfdb_internal_file_t *) file;
-
-	if( libnsfdb_io_handle_get_number_of_rrv_values(
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     note_type,
-	     number_of_notes,
-	     error ) != 1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of RRV values.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing io handle.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific note
- * Returns 1 if successful or -1 on error
- */
-int libnsfdb_file_get_note(
-     libnsfdb_file_t *file,
-     uint8_t note_type,
-     int note_index,
-     libnsfdb_note_t **note,
-     libcerror_error_t **error )
-{
-	libnsfdb_internal_file_t *internal_file = NULL;
-	libnsfdb_rrv_value_t *rrv_value         = NULL;
-	static char *function                   = "libnsfdb_file_get_note";
-
-	if( file == NULL )
+	if( internal_file->summary_bucket_list != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - summary bucket list already set.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libnsfdb_internal_file_t *) file;
-
-	if( note == NULL )
+	if( internal_file->summary_bucket_cache != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid note.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - summary bucket cache already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( *note != NULL )
+	if( internal_file->non_summary_bucket_list != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: note already set.",
+		 "%s: invalid file - non summary bucket list already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libnsfdb_io_handle_get_rrv_value_by_index(
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     note_type,
-	     note_index,
-	     &rrv_value,
-	     error ) != 1 )
+	if( internal_file->non_summary_bucket_cache != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve RRV value: %d.",
-		 function,
-		 note_index );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - non summary bucket cache already set.",
+		 function );
 
 		return( -1 );
 	}
-	if( libnsfdb_note_initialize(
-	     note,
-	     internal_file->file_io_handle,
-	     internal_file->io_handle,
-	     rrv_value,
-	     internal_file->summary_bucket_list,
-	     internal_file->summary_bucket_cache,
-	     internal_file->non_summary_bucket_list,
-	     internal_file->non_summary_bucket_cache,
-	     error ) != 1 )
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libnsfdb_io_handle_read_file_header(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     &database_header_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading database header:\n" );
+	}
+#endif
+	if( libnsfdb_io_handle_read_database_header(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     database_header_size,
+	     &superblock1_offset,
+	     &superblock1_size,
+	     &superblock2_offset,
+	     &superblock2_size,
+	     &superblock3_offset,
+	     &superblock3_size,
+	     &superblock4_offset,
+	     &superblock4_size,
+	     &bucket_descriptor_block1_offset,
+	     &bucket_descriptor_block1_size,
+	     &bucket_descriptor_block2_offset,
+	     &bucket_descriptor_block2_size,
+	     &non_data_rrv_bucket_offset,
+	     &data_rrv_bucket_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read database header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_initialize(
+	     &( internal_file->summary_bucket_list ),
+	     NULL,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_file->summary_bucket_cache ),
+	     LIBNSFDB_MAXIMUM_CACHE_ENTRIES_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create summary bucket cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_initialize(
+	     &( internal_file->non_summary_bucket_list ),
+	     NULL,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create non-summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_file->non_summary_bucket_cache ),
+	     LIBNSFDB_MAXIMUM_CACHE_ENTRIES_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create non-summary bucket cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_file->summary_bucket_scan_cache ),
+	     LIBNSFDB_MAXIMUM_CACHE_ENTRIES_SCAN_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create summary bucket scan cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_file->non_summary_bucket_scan_cache ),
+	     LIBNSFDB_MAXIMUM_CACHE_ENTRIES_SCAN_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create non-summary bucket scan cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* Buckets that are referenced again after they would have been evicted
+	 * from the scan cache are promoted to the bucket cache
+	 */
+	if( libnsfdb_bucket_history_initialize(
+	     &( internal_file->bucket_history ),
+	     LIBNSFDB_BUCKET_HISTORY_SIZE,
+	     LIBNSFDB_MAXIMUM_CACHE_ENTRIES_SCAN_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bucket history.",
+		 function );
+
+		goto on_error;
+	}
+	result = 0;
+
+	/* The index file replaces reading the superblock, the bucket descriptor block
+	 * and the note index, any failure to use it falls back to reading them
+	 */
+	if( internal_file->recovery_mode != LIBNSFDB_RECOVERY_MODE_ALWAYS )
+	{
+		result = libnsfdb_file_read_index_file(
+		          internal_file,
+		          file_io_handle,
+		          superblock1_offset,
+		          superblock1_size,
+		          bucket_descriptor_block1_offset,
+		          bucket_descriptor_block1_size,
+		          error );
+
+		if( result == -1 )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			result = 0;
+		}
+	}
+	if( ( internal_file->recovery_mode != LIBNSFDB_RECOVERY_MODE_ALWAYS )
+	 && ( result == 0 ) )
+	{
+		/* TODO determine the last modified superblock
+		 * try to read it
+		 * fallback to previously modified superblocks if necessary?
+		 */
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading superblock:\n" );
+		}
+#endif
+		result = libnsfdb_io_handle_read_superblock(
+		          internal_file->io_handle,
+		          file_io_handle,
+		          superblock1_offset,
+		          superblock1_size,
+		          internal_file->summary_bucket_list,
+		          internal_file->summary_bucket_cache,
+		          internal_file->non_summary_bucket_list,
+		          internal_file->non_summary_bucket_cache,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read superblock.",
+			 function );
+		}
+#ifdef TODO
+/* TODO read secondary superblock */
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading superblock:\n" );
+		}
+#endif
+		if( libnsfdb_io_handle_read_superblock(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     superblock2_offset,
+		     superblock2_size,
+		     internal_file->summary_bucket_list,
+		     internal_file->summary_bucket_cache,
+		     internal_file->non_summary_bucket_list,
+		     internal_file->non_summary_bucket_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read superblock.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		/* TODO determine the last modified BDB
+		 * try to read it
+		 * fallback to previously BDB superblocks if necessary?
+		 */
+
+		if( result == 1 )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading bucket descriptor block:\n" );
+			}
+#endif
+			result = libnsfdb_io_handle_read_bucket_descriptor_block(
+			          internal_file->io_handle,
+			          file_io_handle,
+			          bucket_descriptor_block1_offset,
+			          bucket_descriptor_block1_size,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read bucket descriptor block.",
+				 function );
+			}
+		}
+		if( result != 1 )
+		{
+			if( internal_file->recovery_mode == LIBNSFDB_RECOVERY_MODE_NONE )
+			{
+				goto on_error;
+			}
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	/* The bucket lists are rebuilt from the buckets and RRV buckets found by
+	 * scanning the file when the superblock or bucket descriptor block is damaged
+	 */
+	if( result != 1 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Scanning file for buckets:\n" );
+		}
+#endif
+		if( libfdata_list_empty(
+		     internal_file->summary_bucket_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty summary bucket list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_list_empty(
+		     internal_file->non_summary_bucket_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty non-summary bucket list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libnsfdb_io_handle_clear_bucket_descriptor_block(
+		     internal_file->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear bucket descriptor block.",
+			 function );
+
+			goto on_error;
+		}
+		if( libnsfdb_recovery_scan_file(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     internal_file->number_of_recovery_threads,
+		     non_data_rrv_bucket_offset,
+		     data_rrv_bucket_offset,
+		     internal_file->summary_bucket_list,
+		     internal_file->non_summary_bucket_list,
+		     &( internal_file->abort ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to recover buckets.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->is_recovered = 1;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->io_handle->cache_pool != NULL )
+	{
+		libnsfdb_cache_pool_remove_values(
+		 internal_file->io_handle->cache_pool,
+		 internal_file->io_handle->cache_pool_owner_identifier,
+		 NULL );
+	}
+	if( internal_file->bucket_history != NULL )
+	{
+		libnsfdb_bucket_history_free(
+		 &( internal_file->bucket_history ),
+		 NULL );
+	}
+	if( internal_file->non_summary_bucket_scan_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->non_summary_bucket_scan_cache ),
+		 NULL );
+	}
+	if( internal_file->summary_bucket_scan_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->summary_bucket_scan_cache ),
+		 NULL );
+	}
+	if( internal_file->non_summary_bucket_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->non_summary_bucket_cache ),
+		 NULL );
+	}
+	if( internal_file->non_summary_bucket_list != NULL )
+	{
+		libfdata_list_free(
+		 &( internal_file->non_summary_bucket_list ),
+		 NULL );
+	}
+	if( internal_file->summary_bucket_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->summary_bucket_cache ),
+		 NULL );
+	}
+	if( internal_file->summary_bucket_list != NULL )
+	{
+		libfdata_list_free(
+		 &( internal_file->summary_bucket_list ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the index file
+ * The index file is keyed on the write count and checksum of the superblock and
+ * bucket descriptor block, which are read without decoding them
+ * On error the bucket lists and bucket descriptor block values are cleared
+ * Returns 1 if successful, 0 if the index file is not available or does not match or -1 on error
+ */
+int libnsfdb_file_read_index_file(
+     libnsfdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t superblock_offset,
+     uint32_t superblock_size,
+     off64_t bucket_descriptor_block_offset,
+     uint32_t bucket_descriptor_block_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle         = NULL;
+	static char *function                          = "libnsfdb_file_read_index_file";
+	uint32_t bucket_descriptor_block_checksum      = 0;
+	uint32_t bucket_descriptor_block_write_count   = 0;
+	uint32_t superblock_checksum                   = 0;
+	uint32_t superblock_write_count                = 0;
+	int result                                     = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( ( internal_file->index_filename == NULL )
+	 && ( internal_file->index_filename_wide == NULL ) )
+#else
+	if( internal_file->index_filename == NULL )
+#endif
+	{
+		return( 0 );
+	}
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading index file:\n" );
+	}
+#endif
+	if( libnsfdb_io_handle_read_superblock_key(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     superblock_offset,
+	     superblock_size,
+	     &superblock_write_count,
+	     &superblock_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read superblock key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_io_handle_read_bucket_descriptor_block_key(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     bucket_descriptor_block_offset,
+	     bucket_descriptor_block_size,
+	     &bucket_descriptor_block_write_count,
+	     &bucket_descriptor_block_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read bucket descriptor block key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( internal_file->index_filename_wide != NULL )
+	{
+		result = libbfio_file_set_name_wide(
+		          index_file_io_handle,
+		          internal_file->index_filename_wide,
+		          internal_file->index_filename_wide_size,
+		          error );
+	}
+	else
+#endif
+	{
+		result = libbfio_file_set_name(
+		          index_file_io_handle,
+		          internal_file->index_filename,
+		          internal_file->index_filename_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* A missing or unreadable index file is not considered an error
+	 */
+	if( libbfio_handle_open(
+	     index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to open index file.\n",
+			 function );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+
+		return( 0 );
+	}
+	result = libnsfdb_index_file_read(
+	          internal_file->io_handle,
+	          index_file_io_handle,
+	          superblock_write_count,
+	          superblock_checksum,
+	          bucket_descriptor_block_write_count,
+	          bucket_descriptor_block_checksum,
+	          internal_file->summary_bucket_list,
+	          internal_file->non_summary_bucket_list,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_VERBOSE_OUTPUT )
+	else if( result == 0 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: index file does not match.\n",
+			 function );
+		}
+	}
+#endif
+	if( libbfio_handle_close(
+	     index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 index_file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	libfdata_list_empty(
+	 internal_file->summary_bucket_list,
+	 NULL );
+	libfdata_list_empty(
+	 internal_file->non_summary_bucket_list,
+	 NULL );
+	libnsfdb_io_handle_clear_bucket_descriptor_block(
+	 internal_file->io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Clears the index filename
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_clear_index_filename(
+     libnsfdb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_clear_index_filename";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->index_filename != NULL )
+	{
+		memory_free(
+		 internal_file->index_filename );
+
+		internal_file->index_filename = NULL;
+	}
+	internal_file->index_filename_size = 0;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( internal_file->index_filename_wide != NULL )
+	{
+		memory_free(
+		 internal_file->index_filename_wide );
+
+		internal_file->index_filename_wide = NULL;
+	}
+	internal_file->index_filename_wide_size = 0;
+#endif
+	return( 1 );
+}
+
+/* Sets the index filename
+ * The index file replaces reading the superblock, the bucket descriptor block and the note index
+ * if it matches the write counts and checksums of the superblock and bucket descriptor block
+ * This function needs to be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_set_index_filename(
+     libnsfdb_file_t *file,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_set_index_filename";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_clear_index_filename(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear index filename.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->index_filename = narrow_string_allocate(
+	                                 filename_length + 1 );
+
+	if( internal_file->index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     internal_file->index_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy index filename.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->index_filename[ filename_length ] = 0;
+
+	internal_file->index_filename_size = filename_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( internal_file->index_filename != NULL )
+	{
+		memory_free(
+		 internal_file->index_filename );
+
+		internal_file->index_filename = NULL;
+	}
+	internal_file->index_filename_size = 0;
+
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the index filename
+ * The index file replaces reading the superblock, the bucket descriptor block and the note index
+ * if it matches the write counts and checksums of the superblock and bucket descriptor block
+ * This function needs to be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_set_index_filename_wide(
+     libnsfdb_file_t *file,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_set_index_filename_wide";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( wchar_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_clear_index_filename(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear index filename.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->index_filename_wide = wide_string_allocate(
+	                                      filename_length + 1 );
+
+	if( internal_file->index_filename_wide == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( wide_string_copy(
+	     internal_file->index_filename_wide,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy index filename.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->index_filename_wide[ filename_length ] = 0;
+
+	internal_file->index_filename_wide_size = filename_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( internal_file->index_filename_wide != NULL )
+	{
+		memory_free(
+		 internal_file->index_filename_wide );
+
+		internal_file->index_filename_wide = NULL;
+	}
+	internal_file->index_filename_wide_size = 0;
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads the note index if it was not read before
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_read_note_index(
+     libnsfdb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_read_note_index";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing io handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->note_index != NULL )
+	{
+		return( 1 );
+	}
+	if( libnsfdb_io_handle_read_note_index(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     internal_file->summary_bucket_list,
+	     internal_file->summary_bucket_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read note index.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes an index file using a file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_write_index_file_io_handle(
+     libnsfdb_internal_file_t *internal_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_write_index_file_io_handle";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_read_note_index(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     index_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_index_file_write(
+	     internal_file->io_handle,
+	     index_file_io_handle,
+	     internal_file->summary_bucket_list,
+	     internal_file->non_summary_bucket_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libbfio_handle_close(
+	 index_file_io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes an index file
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_write_index(
+     libnsfdb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle  = NULL;
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_write_index";
+	size_t filename_length                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_file_write_index_file_io_handle(
+	     internal_file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes an index file
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_write_index_wide(
+     libnsfdb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle  = NULL;
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_write_index_wide";
+	size_t filename_length                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_file_write_index_file_io_handle(
+	     internal_file,
+	     index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Sets the cache policy of the bucket caches
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_set_cache_policy(
+     libnsfdb_file_t *file,
+     int cache_policy,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_set_cache_policy";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( ( cache_policy != LIBNSFDB_CACHE_POLICY_DEFAULT )
+	 && ( cache_policy != LIBNSFDB_CACHE_POLICY_SCAN_RESISTANT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache policy: %d.",
+		 function,
+		 cache_policy );
+
+		return( -1 );
+	}
+	internal_file->cache_policy = cache_policy;
+
+	return( 1 );
+}
+
+/* Sets the access hint
+ * The scan access hint indicates the notes are read once, e.g. by a full database pass,
+ * and makes the bucket reads bypass the bucket caches using the smaller scan caches instead
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_set_access_hint(
+     libnsfdb_file_t *file,
+     int access_hint,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_set_access_hint";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( ( access_hint != LIBNSFDB_ACCESS_HINT_NORMAL )
+	 && ( access_hint != LIBNSFDB_ACCESS_HINT_SCAN ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access hint: %d.",
+		 function,
+		 access_hint );
+
+		return( -1 );
+	}
+	internal_file->access_hint = access_hint;
+
+	return( 1 );
+}
+
+/* Sets the cache pool
+ * The cache pool is used instead of the bucket caches of the file
+ * This function needs to be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_set_cache_pool(
+     libnsfdb_file_t *file,
+     libnsfdb_cache_pool_t *cache_pool,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_set_cache_pool";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->cache_pool != NULL )
+	{
+		if( libnsfdb_cache_pool_detach_owner(
+		     internal_file->io_handle->cache_pool,
+		     internal_file->io_handle->cache_pool_owner_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to detach file from cache pool.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->io_handle->cache_pool                  = NULL;
+		internal_file->io_handle->cache_pool_owner_identifier = 0;
+	}
+	if( cache_pool != NULL )
+	{
+		if( libnsfdb_cache_pool_attach_owner(
+		     (libnsfdb_internal_cache_pool_t *) cache_pool,
+		     &( internal_file->io_handle->cache_pool_owner_identifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to attach file to cache pool.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->io_handle->cache_pool = (libnsfdb_internal_cache_pool_t *) cache_pool;
+	}
+	return( 1 );
+}
+
+/* Sets the recovery mode
+ * The on error recovery mode scans the file for buckets when the superblock
+ * or bucket descriptor block cannot be read, the always recovery mode
+ * does not read the superblock and bucket descriptor block at all
+ * This function needs to be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_set_recovery_mode(
+     libnsfdb_file_t *file,
+     int recovery_mode,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_set_recovery_mode";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recovery_mode != LIBNSFDB_RECOVERY_MODE_NONE )
+	 && ( recovery_mode != LIBNSFDB_RECOVERY_MODE_ON_ERROR )
+	 && ( recovery_mode != LIBNSFDB_RECOVERY_MODE_ALWAYS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported recovery mode: %d.",
+		 function,
+		 recovery_mode );
+
+		return( -1 );
+	}
+	internal_file->recovery_mode = recovery_mode;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to scan the file in recovery mode
+ * The file is divided in regions that are scanned in parallel
+ * This function needs to be called before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_set_number_of_recovery_threads(
+     libnsfdb_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_set_number_of_recovery_threads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBNSFDB_MAXIMUM_NUMBER_OF_RECOVERY_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->number_of_recovery_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Determines if the bucket lists of the file were recovered by scanning the file
+ * Returns 1 if recovered, 0 if not or -1 on error
+ */
+int libnsfdb_file_is_recovered(
+     libnsfdb_file_t *file,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_is_recovered";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->is_recovered != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Recovers deleted notes from the summary bucket data that is no longer referenced
+ * The summary buckets are scanned by the number of threads of the recovery scan
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_recover_notes(
+     libnsfdb_file_t *file,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_recover_notes";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->recovered_notes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - recovered notes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->io_handle->recovered_notes ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered notes array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_note_recovery_scan(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     internal_file->summary_bucket_list,
+	     internal_file->number_of_recovery_threads,
+	     internal_file->io_handle->recovered_notes,
+	     &( internal_file->abort ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to recover notes.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->io_handle->recovered_notes != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_file->io_handle->recovered_notes ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_value_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of recovered notes
+ * The number of recovered notes is 0 if the notes were not recovered
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_get_number_of_recovered_notes(
+     libnsfdb_file_t *file,
+     int *number_of_recovered_notes,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_get_number_of_recovered_notes";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_recovered_notes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of recovered notes.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->recovered_notes == NULL )
+	{
+		*number_of_recovered_notes = 0;
+
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->io_handle->recovered_notes,
+	     number_of_recovered_notes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered notes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific recovered note
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_get_recovered_note(
+     libnsfdb_file_t *file,
+     int recovered_note_index,
+     libnsfdb_note_t **note,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *non_summary_bucket_cache = NULL;
+	libfcache_cache_t *summary_bucket_cache     = NULL;
+	libnsfdb_internal_file_t *internal_file     = NULL;
+	libnsfdb_rrv_value_t *rrv_value             = NULL;
+	static char *function                       = "libnsfdb_file_get_recovered_note";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->recovered_notes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing recovered notes.",
+		 function );
+
+		return( -1 );
+	}
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( *note != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: note already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->io_handle->recovered_notes,
+	     recovered_note_index,
+	     (intptr_t **) &rrv_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve recovered note: %d.",
+		 function,
+		 recovered_note_index );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_get_bucket_caches(
+	     internal_file,
+	     rrv_value,
+	     &summary_bucket_cache,
+	     &non_summary_bucket_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bucket caches.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_initialize(
+	     note,
+	     internal_file->file_io_handle,
+	     internal_file->io_handle,
+	     rrv_value,
+	     internal_file->summary_bucket_list,
+	     summary_bucket_cache,
+	     internal_file->non_summary_bucket_list,
+	     non_summary_bucket_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create note.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Completes the prefetch of buckets
+ * The prefetched buckets are added to the bucket cache or to the cache pool
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_complete_prefetch(
+     libnsfdb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libnsfdb_bucket_prefetch_t *bucket_prefetch = NULL;
+	libnsfdb_bucket_t *cached_bucket            = NULL;
+	static char *function                       = "libnsfdb_file_complete_prefetch";
+	int entry_index                             = 0;
+	int result                                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_prefetch = internal_file->bucket_prefetch;
+
+	if( ( bucket_prefetch == NULL )
+	 || ( bucket_prefetch->number_of_buckets == 0 ) )
+	{
+		return( 1 );
+	}
+	if( libnsfdb_bucket_prefetch_join(
+	     bucket_prefetch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to join bucket prefetch.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < bucket_prefetch->number_of_buckets;
+	     entry_index++ )
+	{
+		if( bucket_prefetch->buckets[ entry_index ] == NULL )
+		{
+			continue;
+		}
+		if( internal_file->io_handle->cache_pool != NULL )
+		{
+			/* A bucket that was read in the mean time is already in the cache pool
+			 */
+			result = libnsfdb_cache_pool_get_value(
+			          internal_file->io_handle->cache_pool,
+			          internal_file->io_handle->cache_pool_owner_identifier,
+			          LIBNSFDB_CACHE_POOL_VALUE_TYPE_SUMMARY_BUCKET,
+			          bucket_prefetch->bucket_offsets[ entry_index ],
+			          (intptr_t **) &cached_bucket,
+			          error );
+
+			if( result == 0 )
+			{
+				result = libnsfdb_cache_pool_set_value(
+				          internal_file->io_handle->cache_pool,
+				          internal_file->io_handle->cache_pool_owner_identifier,
+				          LIBNSFDB_CACHE_POOL_VALUE_TYPE_SUMMARY_BUCKET,
+				          bucket_prefetch->bucket_offsets[ entry_index ],
+				          (intptr_t *) bucket_prefetch->buckets[ entry_index ],
+				          (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_bucket_free,
+				          sizeof( libnsfdb_bucket_t ) + (size_t) bucket_prefetch->buckets[ entry_index ]->data_size,
+				          error );
+
+				if( result == 1 )
+				{
+					cached_bucket = bucket_prefetch->buckets[ entry_index ];
+
+					bucket_prefetch->buckets[ entry_index ] = NULL;
+				}
+			}
+			if( result == 1 )
+			{
+				result = libnsfdb_cache_pool_release_value(
+				          internal_file->io_handle->cache_pool,
+				          (intptr_t *) cached_bucket,
+				          error );
+			}
+		}
+		else
+		{
+			result = libfdata_list_set_element_value_by_index(
+			          internal_file->summary_bucket_list,
+			          (intptr_t *) internal_file->file_io_handle,
+			          (libfdata_cache_t *) bucket_prefetch->bucket_cache,
+			          (int) bucket_prefetch->bucket_indexes[ entry_index ] - 1,
+			          (intptr_t *) bucket_prefetch->buckets[ entry_index ],
+			          (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_bucket_free,
+			          LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+			          error );
+
+			if( result == 1 )
+			{
+				bucket_prefetch->buckets[ entry_index ] = NULL;
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set prefetched summary bucket: %" PRIu32 ".",
+			 function,
+			 bucket_prefetch->bucket_indexes[ entry_index ] );
+
+			goto on_error;
+		}
+	}
+	if( libnsfdb_bucket_prefetch_clear(
+	     bucket_prefetch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear bucket prefetch.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libnsfdb_bucket_prefetch_clear(
+	 bucket_prefetch,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the bucket caches to read the buckets of a specific note
+ * The libfcache caches use a single replacement strategy, the scan resistant
+ * cache policy therefore keeps buckets in a small scan cache until the bucket
+ * history indicates they are reused, in the manner of the 2Q algorithm
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_get_bucket_caches(
+     libnsfdb_internal_file_t *internal_file,
+     libnsfdb_rrv_value_t *rrv_value,
+     libfcache_cache_t **summary_bucket_cache,
+     libfcache_cache_t **non_summary_bucket_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_get_bucket_caches";
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( rrv_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RRV value.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_bucket_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary bucket cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( non_summary_bucket_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid non-summary bucket cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->access_hint == LIBNSFDB_ACCESS_HINT_SCAN )
+	{
+		result = 0;
+	}
+	else if( ( internal_file->cache_policy == LIBNSFDB_CACHE_POLICY_SCAN_RESISTANT )
+	      && ( internal_file->bucket_history != NULL )
+	      && ( rrv_value->type == LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER ) )
+	{
+		result = libnsfdb_bucket_history_reference(
+		          internal_file->bucket_history,
+		          rrv_value->bucket_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reference bucket: %" PRIu32 " in history.",
+			 function,
+			 rrv_value->bucket_index );
+
+			return( -1 );
+		}
+	}
+	if( ( result == 0 )
+	 && ( internal_file->summary_bucket_scan_cache != NULL )
+	 && ( internal_file->non_summary_bucket_scan_cache != NULL ) )
+	{
+		*summary_bucket_cache     = internal_file->summary_bucket_scan_cache;
+		*non_summary_bucket_cache = internal_file->non_summary_bucket_scan_cache;
+	}
+	else
+	{
+		*summary_bucket_cache     = internal_file->summary_bucket_cache;
+		*non_summary_bucket_cache = internal_file->non_summary_bucket_cache;
+	}
+	/* The prefetched buckets are added to the cache before the first one of them is used
+	 */
+	if( ( rrv_value->type == LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER )
+	 && ( libnsfdb_bucket_prefetch_contains_bucket(
+	       internal_file->bucket_prefetch,
+	       rrv_value->bucket_index ) != 0 ) )
+	{
+		if( libnsfdb_file_complete_prefetch(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to complete bucket prefetch.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of unique name keys (UNK)
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_get_number_of_unique_name_keys(
+     libnsfdb_file_t *file,
+     int *number_of_unique_name_keys,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_get_number_of_unique_name_keys";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_unique_name_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of unique name keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->unique_name_key_table == NULL )
+	{
+		*number_of_unique_name_keys = 0;
+
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->io_handle->unique_name_key_table,
+	     number_of_unique_name_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of unique name keys.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of notes
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_get_number_of_notes(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     int *number_of_notes,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_get_number_of_notes";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( libnsfdb_io_handle_get_number_of_rrv_values(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     note_type,
+	     number_of_notes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of RRV values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific note
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_get_note(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     int note_index,
+     libnsfdb_note_t **note,
+     libcerror_error_t **error )
+{
+	libnsfdb_rrv_value_t rrv_value;
+
+	libfcache_cache_t *non_summary_bucket_cache = NULL;
+	libfcache_cache_t *summary_bucket_cache     = NULL;
+	libnsfdb_internal_file_t *internal_file     = NULL;
+	static char *function                       = "libnsfdb_file_get_note";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( *note != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: note already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_io_handle_get_rrv_value_by_index(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     note_type,
+	     note_index,
+	     &rrv_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve RRV value: %d.",
+		 function,
+		 note_index );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_get_bucket_caches(
+	     internal_file,
+	     &rrv_value,
+	     &summary_bucket_cache,
+	     &non_summary_bucket_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bucket caches.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_initialize(
+	     note,
+	     internal_file->file_io_handle,
+	     internal_file->io_handle,
+	     &rrv_value,
+	     internal_file->summary_bucket_list,
+	     summary_bucket_cache,
+	     internal_file->non_summary_bucket_list,
+	     non_summary_bucket_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create note.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific note if it matches a note filter
+ * The note filter is matched against the note header before the note values are read
+ * Returns 1 if successful, 0 if the note does not match the note filter or -1 on error
+ */
+int libnsfdb_file_get_filtered_note(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     int note_index,
+     libnsfdb_note_filter_t *note_filter,
+     libnsfdb_note_t **note,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_t *safe_note = NULL;
+	static char *function      = "libnsfdb_file_get_filtered_note";
+	int result                 = 0;
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( *note != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: note already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_get_note(
+	     file,
+	     note_type,
+	     note_index,
+	     &safe_note,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve note: %d.",
+		 function,
+		 note_index );
+
+		goto on_error;
+	}
+	result = libnsfdb_note_match_filter(
+	          safe_note,
+	          note_filter,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to match note: %d against note filter.",
+		 function,
+		 note_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libnsfdb_note_free(
+		     &safe_note,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free note: %d.",
+			 function,
+			 note_index );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	*note = safe_note;
+
+	return( 1 );
+
+on_error:
+	if( safe_note != NULL )
+	{
+		libnsfdb_note_free(
+		 &safe_note,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a note for a specific identifier
+ * Returns 1 if successful, 0 if no such note was found or -1 on error
+ */
+int libnsfdb_file_get_note_by_identifier(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint32_t note_identifier,
+     libnsfdb_note_t **note,
+     libcerror_error_t **error )
+{
+	libnsfdb_rrv_value_t rrv_value;
+
+	libfcache_cache_t *non_summary_bucket_cache = NULL;
+	libfcache_cache_t *summary_bucket_cache     = NULL;
+	libnsfdb_internal_file_t *internal_file     = NULL;
+	static char *function                       = "libnsfdb_file_get_note";
+	int result                                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( *note != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: note already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libnsfdb_io_handle_get_rrv_value_by_identifier(
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          note_type,
+	          note_identifier,
+	          &rrv_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve RRV value: 0x%08" PRIx32 ".",
+		 function,
+		 note_identifier );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libnsfdb_file_get_bucket_caches(
+		     internal_file,
+		     &rrv_value,
+		     &summary_bucket_cache,
+		     &non_summary_bucket_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bucket caches.",
+			 function );
+
+			return( -1 );
+		}
+		if( libnsfdb_note_initialize(
+		     note,
+		     internal_file->file_io_handle,
+		     internal_file->io_handle,
+		     &rrv_value,
+		     internal_file->summary_bucket_list,
+		     summary_bucket_cache,
+		     internal_file->non_summary_bucket_list,
+		     non_summary_bucket_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create note.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the number of notes that were modified after a specific modification time
+ * The modification time is a 64-bit NSF timedate value
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_get_number_of_notes_modified_since(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint64_t modification_time,
+     int *number_of_notes,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libnsfdb_file_get_number_of_notes_modified_since";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_read_note_index(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_index_get_number_of_modified_entries(
+	     internal_file->io_handle->note_index,
+	     note_type,
+	     modification_time,
+	     number_of_notes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of modified note index entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific note of the notes that were modified after a specific modification time
+ * The notes are sorted by modification time, the modification time of the last note
+ * can be used to retrieve the notes modified after it at a later time
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_get_note_modified_since(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint64_t modification_time,
+     int note_index,
+     libnsfdb_note_t **note,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *non_summary_bucket_cache   = NULL;
+	libfcache_cache_t *summary_bucket_cache       = NULL;
+	libnsfdb_internal_file_t *internal_file       = NULL;
+	libnsfdb_note_index_entry_t *note_index_entry = NULL;
+	static char *function                         = "libnsfdb_file_get_note_modified_since";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( *note != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: note already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_read_note_index(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_index_get_modified_entry_by_index(
+	     internal_file->io_handle->note_index,
+	     note_type,
+	     modification_time,
+	     note_index,
+	     &note_index_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modified note index entry: %d.",
+		 function,
+		 note_index );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_get_bucket_caches(
+	     internal_file,
+	     &( note_index_entry->rrv_value ),
+	     &summary_bucket_cache,
+	     &non_summary_bucket_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bucket caches.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_initialize(
+	     note,
+	     internal_file->file_io_handle,
+	     internal_file->io_handle,
+	     &( note_index_entry->rrv_value ),
+	     internal_file->summary_bucket_list,
+	     summary_bucket_cache,
+	     internal_file->non_summary_bucket_list,
+	     non_summary_bucket_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
 		 "%s: unable to create note.",
 		 function );
 
-		return( -1 );
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the note index entry of a specific note identifier of which the threads were built
+ * Returns 1 if successful, 0 if no such note was found or -1 on error
+ */
+int libnsfdb_file_get_thread_entry(
+     libnsfdb_internal_file_t *internal_file,
+     uint8_t note_type,
+     uint32_t note_identifier,
+     libnsfdb_note_index_entry_t **note_index_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_get_thread_entry";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_read_note_index(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_index_build_threads(
+	     internal_file->io_handle->note_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build note index threads.",
+		 function );
+
+		return( -1 );
+	}
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          internal_file->io_handle->note_index,
+	          note_type,
+	          note_identifier,
+	          note_index_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve note index entry: 0x%08" PRIx32 ".",
+		 function,
+		 note_identifier );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of responses of a specific note
+ * The responses are the notes that have the note as their parent
+ * Returns 1 if successful, 0 if no such note was found or -1 on error
+ */
+int libnsfdb_file_get_number_of_note_responses(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint32_t note_identifier,
+     int *number_of_responses,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file       = NULL;
+	libnsfdb_note_index_entry_t *note_index_entry = NULL;
+	static char *function                         = "libnsfdb_file_get_number_of_note_responses";
+	int result                                    = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	result = libnsfdb_file_get_thread_entry(
+	          internal_file,
+	          note_type,
+	          note_identifier,
+	          &note_index_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve thread entry: 0x%08" PRIx32 ".",
+		 function,
+		 note_identifier );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libnsfdb_note_index_get_number_of_response_entries(
+		     internal_file->io_handle->note_index,
+		     note_index_entry,
+		     number_of_responses,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of response entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the identifier of a specific response of a specific note
+ * Returns 1 if successful, 0 if no such note was found or -1 on error
+ */
+int libnsfdb_file_get_note_response_identifier(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint32_t note_identifier,
+     int response_index,
+     uint32_t *response_identifier,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file           = NULL;
+	libnsfdb_note_index_entry_t *note_index_entry     = NULL;
+	libnsfdb_note_index_entry_t *response_index_entry = NULL;
+	static char *function                             = "libnsfdb_file_get_note_response_identifier";
+	int result                                        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( response_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid response identifier.",
+		 function );
+
+		return( -1 );
+	}
+	result = libnsfdb_file_get_thread_entry(
+	          internal_file,
+	          note_type,
+	          note_identifier,
+	          &note_index_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve thread entry: 0x%08" PRIx32 ".",
+		 function,
+		 note_identifier );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libnsfdb_note_index_get_response_entry_by_index(
+		     internal_file->io_handle->note_index,
+		     note_index_entry,
+		     response_index,
+		     &response_index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve response entry: %d.",
+			 function,
+			 response_index );
+
+			return( -1 );
+		}
+		*response_identifier = response_index_entry->rrv_value.rrv_identifier;
+	}
+	return( result );
+}
+
+/* Retrieves the identifier of the root note of the thread of a specific note
+ * The root note of a note without a parent is the note itself
+ * Returns 1 if successful, 0 if no such note was found or -1 on error
+ */
+int libnsfdb_file_get_note_thread_root_identifier(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint32_t note_identifier,
+     uint32_t *root_identifier,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file       = NULL;
+	libnsfdb_note_index_entry_t *note_index_entry = NULL;
+	libnsfdb_note_index_entry_t *root_index_entry = NULL;
+	static char *function                         = "libnsfdb_file_get_note_thread_root_identifier";
+	int result                                    = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( root_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root identifier.",
+		 function );
+
+		return( -1 );
+	}
+	result = libnsfdb_file_get_thread_entry(
+	          internal_file,
+	          note_type,
+	          note_identifier,
+	          &note_index_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve thread entry: 0x%08" PRIx32 ".",
+		 function,
+		 note_identifier );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libnsfdb_note_index_get_thread_root_entry(
+		     internal_file->io_handle->note_index,
+		     note_index_entry,
+		     &root_index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve thread root entry.",
+			 function );
+
+			return( -1 );
+		}
+		*root_identifier = root_index_entry->rrv_value.rrv_identifier;
+	}
+	return( result );
+}
+
+/* Creates a column scan of specific fields of the notes
+ * The field names are resolved to unique name key (UNK) table indexes once
+ * and the notes are read in batches of up to maximum number of rows
+ * Make sure the value column_scan is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_scan_columns(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     const char **field_names,
+     int number_of_field_names,
+     int maximum_number_of_rows,
+     libnsfdb_column_scan_t **column_scan,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	libnsfdb_internal_file_t *internal_file               = NULL;
+	static char *function                                 = "libnsfdb_file_scan_columns";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( note_type != LIBNSFDB_NOTE_TYPE_ALL )
+	 && ( note_type != LIBNSFDB_NOTE_TYPE_DATA )
+	 && ( note_type != LIBNSFDB_NOTE_TYPE_NON_DATA ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported note type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_column_scan_initialize(
+	     column_scan,
+	     number_of_field_names,
+	     maximum_number_of_rows,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create column scan.",
+		 function );
+
+		goto on_error;
+	}
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) *column_scan;
+
+	internal_column_scan->internal_file = internal_file;
+	internal_column_scan->note_type     = note_type;
+
+	if( libnsfdb_column_scan_set_field_names(
+	     internal_column_scan,
+	     internal_file->io_handle->unique_name_key_table,
+	     field_names,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set field names.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *column_scan != NULL )
+	{
+		libnsfdb_column_scan_free(
+		 column_scan,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prefetches the summary buckets of a range of notes into the bucket cache
+ * or into the cache pool if the file is attached to one
+ * The buckets are read in the background if multi-threading support is available
+ * and are added to the cache when the first one of them is used or on the next prefetch
+ * The number of buckets is limited so that the prefetched buckets do not evict each other
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_prefetch_notes(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     int note_index,
+     int number_of_notes,
+     libcerror_error_t **error )
+{
+	libnsfdb_rrv_value_t rrv_value;
+
+	libfcache_cache_t *summary_bucket_cache = NULL;
+	libnsfdb_internal_file_t *internal_file = NULL;
+	off64_t *bucket_offsets                 = NULL;
+	uint32_t *bucket_indexes                = NULL;
+	uint8_t *used_cache_entries             = NULL;
+	static char *function                   = "libnsfdb_file_prefetch_notes";
+	size64_t element_size                   = 0;
+	uint32_t element_flags                  = 0;
+	int bucket_index                        = 0;
+	int cache_entry_index                   = 0;
+	int element_file_index                  = 0;
+	int last_note_index                     = 0;
+	int maximum_number_of_bucket_indexes    = 0;
+	int maximum_number_of_notes             = 0;
+	int number_of_bucket_indexes            = 0;
+	int number_of_cache_entries             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid note index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_notes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of notes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* The buckets of the previous prefetch are added to the cache first
+	 * so that they can be used while the next buckets are being read
+	 */
+	if( libnsfdb_file_complete_prefetch(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to complete previous bucket prefetch.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_io_handle_get_number_of_rrv_values(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     note_type,
+	     &maximum_number_of_notes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of RRV values.",
+		 function );
+
+		goto on_error;
+	}
+	if( note_index >= maximum_number_of_notes )
+	{
+		return( 1 );
+	}
+	if( number_of_notes > ( maximum_number_of_notes - note_index ) )
+	{
+		number_of_notes = maximum_number_of_notes - note_index;
+	}
+	if( number_of_notes == 0 )
+	{
+		return( 1 );
+	}
+	/* Prefetched buckets are not considered reused, hence they are read
+	 * into the scan cache unless the default cache policy is used
+	 */
+	if( ( ( internal_file->access_hint == LIBNSFDB_ACCESS_HINT_SCAN )
+	  || ( internal_file->cache_policy == LIBNSFDB_CACHE_POLICY_SCAN_RESISTANT ) )
+	 && ( internal_file->summary_bucket_scan_cache != NULL ) )
+	{
+		summary_bucket_cache = internal_file->summary_bucket_scan_cache;
+	}
+	else
+	{
+		summary_bucket_cache = internal_file->summary_bucket_cache;
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     summary_bucket_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of summary bucket cache entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_cache_entries <= 0 )
+	 || ( number_of_cache_entries > LIBNSFDB_MAXIMUM_CACHE_ENTRIES_BUCKETS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of summary bucket cache entries value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_number_of_bucket_indexes = number_of_cache_entries;
+
+	if( internal_file->bucket_prefetch == NULL )
+	{
+		if( libnsfdb_bucket_prefetch_initialize(
+		     &( internal_file->bucket_prefetch ),
+		     LIBNSFDB_MAXIMUM_CACHE_ENTRIES_BUCKETS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create bucket prefetch.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	bucket_indexes = (uint32_t *) memory_allocate(
+	                               sizeof( uint32_t ) * (size_t) maximum_number_of_bucket_indexes );
+
+	if( bucket_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket indexes.",
+		 function );
+
+		goto on_error;
+	}
+	bucket_offsets = (off64_t *) memory_allocate(
+	                              sizeof( off64_t ) * (size_t) maximum_number_of_bucket_indexes );
+
+	if( bucket_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket offsets.",
+		 function );
+
+		goto on_error;
+	}
+	used_cache_entries = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * (size_t) number_of_cache_entries );
+
+	if( used_cache_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create used cache entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     used_cache_entries,
+	     0,
+	     sizeof( uint8_t ) * (size_t) number_of_cache_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear used cache entries.",
+		 function );
+
+		goto on_error;
+	}
+	last_note_index = note_index + number_of_notes;
+
+	while( note_index < last_note_index )
+	{
+		if( libnsfdb_io_handle_get_rrv_value_by_index(
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     note_type,
+		     note_index,
+		     &rrv_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve RRV value: %d.",
+			 function,
+			 note_index );
+
+			goto on_error;
+		}
+		note_index++;
+
+		if( ( rrv_value.type != LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER )
+		 || ( rrv_value.bucket_index == 0 ) )
+		{
+			continue;
+		}
+		/* Consecutive notes are mostly stored in the same bucket
+		 */
+		for( bucket_index = number_of_bucket_indexes - 1;
+		     bucket_index >= 0;
+		     bucket_index-- )
+		{
+			if( bucket_indexes[ bucket_index ] == rrv_value.bucket_index )
+			{
+				break;
+			}
+		}
+		if( bucket_index >= 0 )
+		{
+			continue;
+		}
+		/* The bucket cache stores a bucket in the entry of its index modulo the number
+		 * of entries, the prefetch stops at the first bucket that would evict another
+		 * prefetched bucket before it is used. The cache pool is not affected by this.
+		 */
+		cache_entry_index = (int) ( ( rrv_value.bucket_index - 1 ) % (uint32_t) number_of_cache_entries );
+
+		if( ( number_of_bucket_indexes >= maximum_number_of_bucket_indexes )
+		 || ( ( internal_file->io_handle->cache_pool == NULL )
+		  &&  ( used_cache_entries[ cache_entry_index ] != 0 ) ) )
+		{
+			break;
+		}
+		used_cache_entries[ cache_entry_index ] = 1;
+
+		bucket_indexes[ number_of_bucket_indexes++ ] = rrv_value.bucket_index;
+	}
+	if( libnsfdb_bucket_list_sort_bucket_indexes(
+	     internal_file->summary_bucket_list,
+	     bucket_indexes,
+	     number_of_bucket_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort summary bucket indexes.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_bucket_indexes;
+	     bucket_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     internal_file->summary_bucket_list,
+		     (int) bucket_indexes[ bucket_index ] - 1,
+		     &element_file_index,
+		     &( bucket_offsets[ bucket_index ] ),
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve summary bucket: %" PRIu32 " list element.",
+			 function,
+			 bucket_indexes[ bucket_index ] );
+
+			goto on_error;
+		}
+	}
+	if( libnsfdb_bucket_prefetch_start(
+	     internal_file->bucket_prefetch,
+	     internal_file->file_io_handle,
+	     summary_bucket_cache,
+	     bucket_indexes,
+	     bucket_offsets,
+	     number_of_bucket_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to start bucket prefetch.",
+		 function );
+
+		goto on_error;
 	}
+	memory_free(
+	 used_cache_entries );
+
+	memory_free(
+	 bucket_offsets );
+
+	memory_free(
+	 bucket_indexes );
+
 	return( 1 );
+
+on_error:
+	if( used_cache_entries != NULL )
+	{
+		memory_free(
+		 used_cache_entries );
+	}
+	if( bucket_offsets != NULL )
+	{
+		memory_free(
+		 bucket_offsets );
+	}
+	if( bucket_indexes != NULL )
+	{
+		memory_free(
+		 bucket_indexes );
+	}
+	return( -1 );
 }
 
-/* Retrieves a note for a specific identifier
- * Returns 1 if successful, 0 if no such note was found or -1 on error
+/* Adds the terms of the text items of a range of notes to a text index
+ * Only the text items stored in the summary buckets are indexed
+ * Returns 1 if successful or -1 on error
  */
-int libnsfdb_file_get_note_by_identifier(
+int libnsfdb_file_build_text_index(
      libnsfdb_file_t *file,
      uint8_t note_type,
-     uint32_t note_identifier,
-     libnsfdb_note_t **note,
+     int note_index,
+     int number_of_notes,
+     libnsfdb_text_index_t *text_index,
      libcerror_error_t **error )
 {
-	libnsfdb_internal_file_t *internal_file = NULL;
-	libnsfdb_rrv_value_t *rrv_value         = NULL;
-	static char *function                   = "libnsfdb_file_get_note";
-	int result                              = 0;
+	libnsfdb_rrv_value_t rrv_value;
+
+	libfcache_cache_t *non_summary_bucket_cache = NULL;
+	libfcache_cache_t *summary_bucket_cache     = NULL;
+	libnsfdb_bucket_t *summary_bucket           = NULL;
+	libnsfdb_bucket_slot_t *summary_bucket_slot = NULL;
+	libnsfdb_internal_file_t *internal_file     = NULL;
+	static char *function                       = "libnsfdb_file_build_text_index";
+	int last_note_index                         = 0;
+	int maximum_number_of_notes                 = 0;
 
 	if( file == NULL )
 	{
@@ -1302,71 +5262,215 @@ int libnsfdb_file_get_note_by_identifier(
 	}
 	internal_file = (libnsfdb_internal_file_t *) file;
 
-	if( note == NULL )
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid note.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid note index value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( *note != NULL )
+	if( number_of_notes < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: note already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of notes value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	result = libnsfdb_io_handle_get_rrv_value_by_identifier(
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          note_type,
-	          note_identifier,
-	          &rrv_value,
-	          error );
+	if( text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	if( libnsfdb_io_handle_get_number_of_rrv_values(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     note_type,
+	     &maximum_number_of_notes,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve RRV value: 0x%08" PRIx32 ".",
-		 function,
-		 note_identifier );
+		 "%s: unable to retrieve number of RRV values.",
+		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	if( note_index >= maximum_number_of_notes )
 	{
-		if( libnsfdb_note_initialize(
-		     note,
+		return( 1 );
+	}
+	if( number_of_notes > ( maximum_number_of_notes - note_index ) )
+	{
+		number_of_notes = maximum_number_of_notes - note_index;
+	}
+	last_note_index = note_index + number_of_notes;
+
+	while( note_index < last_note_index )
+	{
+		if( internal_file->abort != 0 )
+		{
+			break;
+		}
+		if( libnsfdb_io_handle_get_rrv_value_by_index(
+		     internal_file->io_handle,
 		     internal_file->file_io_handle,
+		     note_type,
+		     note_index,
+		     &rrv_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve RRV value: %d.",
+			 function,
+			 note_index );
+
+			return( -1 );
+		}
+		note_index++;
+
+		/* Only notes stored in a summary bucket slot are supported
+		 */
+		if( rrv_value.type != LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER )
+		{
+			continue;
+		}
+		if( libnsfdb_file_get_bucket_caches(
+		     internal_file,
+		     &rrv_value,
+		     &summary_bucket_cache,
+		     &non_summary_bucket_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bucket caches.",
+			 function );
+
+			return( -1 );
+		}
+		if( libnsfdb_io_handle_get_bucket_by_index(
 		     internal_file->io_handle,
-		     rrv_value,
+		     internal_file->file_io_handle,
 		     internal_file->summary_bucket_list,
-		     internal_file->summary_bucket_cache,
-		     internal_file->non_summary_bucket_list,
-		     internal_file->non_summary_bucket_cache,
+		     summary_bucket_cache,
+		     LIBNSFDB_CACHE_POOL_VALUE_TYPE_SUMMARY_BUCKET,
+		     rrv_value.bucket_index,
+		     &summary_bucket,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create note.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve summary bucket: %" PRIu32 ".",
+			 function,
+			 rrv_value.bucket_index );
+
+			goto on_error;
+		}
+		if( libnsfdb_bucket_get_slot(
+		     summary_bucket,
+		     (int) rrv_value.slot_index,
+		     &summary_bucket_slot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve summary bucket: %" PRIu32 " slot: %" PRIu16 ".",
+			 function,
+			 rrv_value.bucket_index,
+			 rrv_value.slot_index );
+
+			goto on_error;
+		}
+		if( summary_bucket_slot == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing summary bucket slot: %" PRIu16 ".",
+			 function,
+			 rrv_value.slot_index );
+
+			goto on_error;
+		}
+		if( libnsfdb_text_index_read_note_data(
+		     (libnsfdb_internal_text_index_t *) text_index,
+		     summary_bucket_slot->data,
+		     (size_t) summary_bucket_slot->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read note: 0x%08" PRIx32 " text.",
+			 function,
+			 rrv_value.rrv_identifier );
+
+			goto on_error;
+		}
+		if( libnsfdb_io_handle_release_bucket(
+		     internal_file->io_handle,
+		     &summary_bucket,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release summary bucket: %" PRIu32 ".",
+			 function,
+			 rrv_value.bucket_index );
 
 			return( -1 );
 		}
 	}
-	return( result );
+	return( 1 );
+
+on_error:
+	if( summary_bucket != NULL )
+	{
+		libnsfdb_io_handle_release_bucket(
+		 internal_file->io_handle,
+		 &summary_bucket,
+		 NULL );
+	}
+	return( -1 );
 }
 
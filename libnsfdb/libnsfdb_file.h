@@ -25,12 +25,16 @@
 #include <common.h>
 #include <types.h>
 
+#include "libnsfdb_bucket_history.h"
 #include "libnsfdb_extern.h"
+#include "libnsfdb_bucket_prefetch.h"
 #include "libnsfdb_io_handle.h"
 #include "libnsfdb_libbfio.h"
 #include "libnsfdb_libcerror.h"
 #include "libnsfdb_libfcache.h"
 #include "libnsfdb_libfdata.h"
+#include "libnsfdb_note_index.h"
+#include "libnsfdb_rrv_value.h"
 #include "libnsfdb_types.h"
 
 #if defined( __cplusplus )
@@ -73,6 +77,60 @@ struct libnsfdb_internal_file
 	 */
 	libfcache_cache_t *non_summary_bucket_cache;
 
+	/* The summary bucket scan cache
+	 */
+	libfcache_cache_t *summary_bucket_scan_cache;
+
+	/* The non-summary bucket scan cache
+	 */
+	libfcache_cache_t *non_summary_bucket_scan_cache;
+
+	/* The bucket reference history
+	 */
+	libnsfdb_bucket_history_t *bucket_history;
+
+	/* The bucket prefetch
+	 */
+	libnsfdb_bucket_prefetch_t *bucket_prefetch;
+
+	/* The cache policy
+	 */
+	int cache_policy;
+
+	/* The access hint
+	 */
+	int access_hint;
+
+	/* The index filename
+	 */
+	char *index_filename;
+
+	/* The index filename size
+	 */
+	size_t index_filename_size;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The index filename in wide characters
+	 */
+	wchar_t *index_filename_wide;
+
+	/* The index filename size in wide characters
+	 */
+	size_t index_filename_wide_size;
+#endif
+
+	/* The recovery mode
+	 */
+	int recovery_mode;
+
+	/* The number of threads of the recovery scan
+	 */
+	int number_of_recovery_threads;
+
+	/* Value to indicate the bucket lists were recovered by the recovery scan
+	 */
+	uint8_t is_recovered;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -118,16 +176,155 @@ int libnsfdb_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBNSFDB_EXTERN \
+int libnsfdb_file_open_file_io_pool(
+     libnsfdb_file_t *file,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBNSFDB_EXTERN \
 int libnsfdb_file_close(
      libnsfdb_file_t *file,
      libcerror_error_t **error );
 
+LIBNSFDB_EXTERN \
+int libnsfdb_file_refresh(
+     libnsfdb_file_t *file,
+     libcerror_error_t **error );
+
 int libnsfdb_file_open_read(
      libnsfdb_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libnsfdb_file_read_index_file(
+     libnsfdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     off64_t superblock_offset,
+     uint32_t superblock_size,
+     off64_t bucket_descriptor_block_offset,
+     uint32_t bucket_descriptor_block_size,
+     libcerror_error_t **error );
+
+int libnsfdb_file_clear_index_filename(
+     libnsfdb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_set_index_filename(
+     libnsfdb_file_t *file,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_set_index_filename_wide(
+     libnsfdb_file_t *file,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libnsfdb_file_read_note_index(
+     libnsfdb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libnsfdb_file_write_index_file_io_handle(
+     libnsfdb_internal_file_t *internal_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_write_index(
+     libnsfdb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_write_index_wide(
+     libnsfdb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_set_cache_policy(
+     libnsfdb_file_t *file,
+     int cache_policy,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_set_access_hint(
+     libnsfdb_file_t *file,
+     int access_hint,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_set_cache_pool(
+     libnsfdb_file_t *file,
+     libnsfdb_cache_pool_t *cache_pool,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_set_recovery_mode(
+     libnsfdb_file_t *file,
+     int recovery_mode,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_set_number_of_recovery_threads(
+     libnsfdb_file_t *file,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_is_recovered(
+     libnsfdb_file_t *file,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_recover_notes(
+     libnsfdb_file_t *file,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_get_number_of_recovered_notes(
+     libnsfdb_file_t *file,
+     int *number_of_recovered_notes,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_get_recovered_note(
+     libnsfdb_file_t *file,
+     int recovered_note_index,
+     libnsfdb_note_t **note,
+     libcerror_error_t **error );
+
+int libnsfdb_file_complete_prefetch(
+     libnsfdb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libnsfdb_file_get_bucket_caches(
+     libnsfdb_internal_file_t *internal_file,
+     libnsfdb_rrv_value_t *rrv_value,
+     libfcache_cache_t **summary_bucket_cache,
+     libfcache_cache_t **non_summary_bucket_cache,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_get_number_of_unique_name_keys(
+     libnsfdb_file_t *file,
+     int *number_of_unique_name_keys,
+     libcerror_error_t **error );
+
 LIBNSFDB_EXTERN \
 int libnsfdb_file_get_number_of_notes(
      libnsfdb_file_t *file,
@@ -143,6 +340,15 @@ int libnsfdb_file_get_note(
      libnsfdb_note_t **note_item,
      libcerror_error_t **error );
 
+LIBNSFDB_EXTERN \
+int libnsfdb_file_get_filtered_note(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     int note_index,
+     libnsfdb_note_filter_t *note_filter,
+     libnsfdb_note_t **note,
+     libcerror_error_t **error );
+
 LIBNSFDB_EXTERN \
 int libnsfdb_file_get_note_by_identifier(
      libnsfdb_file_t *file,
@@ -151,6 +357,82 @@ int libnsfdb_file_get_note_by_identifier(
      libnsfdb_note_t **note_item,
      libcerror_error_t **error );
 
+LIBNSFDB_EXTERN \
+int libnsfdb_file_get_number_of_notes_modified_since(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint64_t modification_time,
+     int *number_of_notes,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_get_note_modified_since(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint64_t modification_time,
+     int note_index,
+     libnsfdb_note_t **note,
+     libcerror_error_t **error );
+
+int libnsfdb_file_get_thread_entry(
+     libnsfdb_internal_file_t *internal_file,
+     uint8_t note_type,
+     uint32_t note_identifier,
+     libnsfdb_note_index_entry_t **note_index_entry,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_get_number_of_note_responses(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint32_t note_identifier,
+     int *number_of_responses,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_get_note_response_identifier(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint32_t note_identifier,
+     int response_index,
+     uint32_t *response_identifier,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_get_note_thread_root_identifier(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     uint32_t note_identifier,
+     uint32_t *root_identifier,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_scan_columns(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     const char **field_names,
+     int number_of_field_names,
+     int maximum_number_of_rows,
+     libnsfdb_column_scan_t **column_scan,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_prefetch_notes(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     int note_index,
+     int number_of_notes,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_file_build_text_index(
+     libnsfdb_file_t *file,
+     uint8_t note_type,
+     int note_index,
+     int number_of_notes,
+     libnsfdb_text_index_t *text_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,680 @@
+/*
+ * File IO pool entry functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_file_io_pool_entry.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_unused.h"
+
+/* Creates a file IO pool entry
+ * Make sure the value file_io_pool_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_io_pool_entry_initialize(
+     libnsfdb_file_io_pool_entry_t **file_io_pool_entry,
+     libbfio_pool_t *file_io_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_io_pool_entry_initialize";
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_pool_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO pool entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*file_io_pool_entry = memory_allocate_structure(
+	                       libnsfdb_file_io_pool_entry_t );
+
+	if( *file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO pool entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_io_pool_entry,
+	     0,
+	     sizeof( libnsfdb_file_io_pool_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO pool entry.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_io_pool_entry )->file_io_pool       = file_io_pool;
+	( *file_io_pool_entry )->file_io_pool_entry = entry;
+
+	return( 1 );
+
+on_error:
+	if( *file_io_pool_entry != NULL )
+	{
+		memory_free(
+		 *file_io_pool_entry );
+
+		*file_io_pool_entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file IO pool entry
+ * The file IO pool is not freed since it is managed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_io_pool_entry_free(
+     libnsfdb_file_io_pool_entry_t **file_io_pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_io_pool_entry_free";
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_pool_entry != NULL )
+	{
+		memory_free(
+		 *file_io_pool_entry );
+
+		*file_io_pool_entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones (duplicates) the file IO pool entry
+ * The clone refers to the same file IO pool entry and is not open
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_io_pool_entry_clone(
+     libnsfdb_file_io_pool_entry_t **destination_file_io_pool_entry,
+     libnsfdb_file_io_pool_entry_t *source_file_io_pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_io_pool_entry_clone";
+
+	if( destination_file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_file_io_pool_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination file IO pool entry already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_io_pool_entry == NULL )
+	{
+		*destination_file_io_pool_entry = NULL;
+
+		return( 1 );
+	}
+	if( libnsfdb_file_io_pool_entry_initialize(
+	     destination_file_io_pool_entry,
+	     source_file_io_pool_entry->file_io_pool,
+	     source_file_io_pool_entry->file_io_pool_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the file IO pool entry
+ * The file IO handle of the entry is opened on demand by the file IO pool
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_io_pool_entry_open(
+     libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_io_pool_entry_open";
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO pool entry - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_pool_entry->current_offset = 0;
+	file_io_pool_entry->access_flags   = access_flags;
+	file_io_pool_entry->is_open        = 1;
+
+	return( 1 );
+}
+
+/* Closes the file IO pool entry
+ * The file IO handle of the entry is closed by the file IO pool when it is least recently used
+ * Returns 0 if successful or -1 on error
+ */
+int libnsfdb_file_io_pool_entry_close(
+     libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_io_pool_entry_close";
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO pool entry - not open.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_pool_entry->is_open = 0;
+
+	return( 0 );
+}
+
+/* Reads a buffer from the file IO pool entry
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libnsfdb_file_io_pool_entry_read(
+         libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_io_pool_entry_read";
+	ssize_t read_count    = 0;
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO pool entry - not open.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file IO pool reopens the file IO handle of the entry if it was closed
+	 * and closes the least recently used file IO handle if too many are open
+	 */
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              file_io_pool_entry->file_io_pool,
+	              file_io_pool_entry->file_io_pool_entry,
+	              buffer,
+	              size,
+	              file_io_pool_entry->current_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO pool entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_io_pool_entry->file_io_pool_entry,
+		 file_io_pool_entry->current_offset,
+		 file_io_pool_entry->current_offset );
+
+		return( -1 );
+	}
+	file_io_pool_entry->current_offset += read_count;
+
+	return( read_count );
+}
+
+/* Writes a buffer to the file IO pool entry
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libnsfdb_file_io_pool_entry_write(
+         libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+         const uint8_t *buffer LIBNSFDB_ATTRIBUTE_UNUSED,
+         size_t size LIBNSFDB_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_io_pool_entry_write";
+
+	LIBNSFDB_UNREFERENCED_PARAMETER( buffer )
+	LIBNSFDB_UNREFERENCED_PARAMETER( size )
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access currently not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the file IO pool entry
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libnsfdb_file_io_pool_entry_seek_offset(
+         libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_io_pool_entry_seek_offset";
+	size64_t size         = 0;
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO pool entry - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += file_io_pool_entry->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( libbfio_pool_get_size(
+		     file_io_pool_entry->file_io_pool,
+		     file_io_pool_entry->file_io_pool_entry,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size of file IO pool entry: %d.",
+			 function,
+			 file_io_pool_entry->file_io_pool_entry );
+
+			return( -1 );
+		}
+		offset += (off64_t) size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_pool_entry->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the file IO pool entry exists
+ * Returns 1 if the entry exists, 0 if not or -1 on error
+ */
+int libnsfdb_file_io_pool_entry_exists(
+     libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libnsfdb_file_io_pool_entry_exists";
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_handle(
+	     file_io_pool_entry->file_io_pool,
+	     file_io_pool_entry->file_io_pool_entry,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from pool.",
+		 function,
+		 file_io_pool_entry->file_io_pool_entry );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Check if the file IO pool entry is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libnsfdb_file_io_pool_entry_is_open(
+     libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_io_pool_entry_is_open";
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the file IO pool entry
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_io_pool_entry_get_size(
+     libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_file_io_pool_entry_get_size";
+
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_size(
+	     file_io_pool_entry->file_io_pool,
+	     file_io_pool_entry->file_io_pool_entry,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file IO pool entry: %d.",
+		 function,
+		 file_io_pool_entry->file_io_pool_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a file IO handle that reads from an entry of a file IO pool
+ * The file IO pool manages the number of open file IO handles
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_file_io_pool_entry_initialize_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     libbfio_pool_t *file_io_pool,
+     int entry,
+     libcerror_error_t **error )
+{
+	libnsfdb_file_io_pool_entry_t *file_io_pool_entry = NULL;
+	static char *function                             = "libnsfdb_file_io_pool_entry_initialize_file_io_handle";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_io_pool_entry_initialize(
+	     &file_io_pool_entry,
+	     file_io_pool,
+	     entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     file_io_handle,
+	     (intptr_t *) file_io_pool_entry,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libnsfdb_file_io_pool_entry_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libnsfdb_file_io_pool_entry_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libnsfdb_file_io_pool_entry_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libnsfdb_file_io_pool_entry_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libnsfdb_file_io_pool_entry_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libnsfdb_file_io_pool_entry_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libnsfdb_file_io_pool_entry_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libnsfdb_file_io_pool_entry_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libnsfdb_file_io_pool_entry_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libnsfdb_file_io_pool_entry_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_pool_entry != NULL )
+	{
+		libnsfdb_file_io_pool_entry_free(
+		 &file_io_pool_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,126 @@
+/*
+ * File IO pool entry functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_FILE_IO_POOL_ENTRY_H )
+#define _LIBNSFDB_FILE_IO_POOL_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_file_io_pool_entry libnsfdb_file_io_pool_entry_t;
+
+struct libnsfdb_file_io_pool_entry
+{
+	/* The file IO pool
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The file IO pool entry
+	 */
+	int file_io_pool_entry;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* Value to indicate the file IO pool entry is open
+	 */
+	uint8_t is_open;
+};
+
+int libnsfdb_file_io_pool_entry_initialize(
+     libnsfdb_file_io_pool_entry_t **file_io_pool_entry,
+     libbfio_pool_t *file_io_pool,
+     int entry,
+     libcerror_error_t **error );
+
+int libnsfdb_file_io_pool_entry_free(
+     libnsfdb_file_io_pool_entry_t **file_io_pool_entry,
+     libcerror_error_t **error );
+
+int libnsfdb_file_io_pool_entry_clone(
+     libnsfdb_file_io_pool_entry_t **destination_file_io_pool_entry,
+     libnsfdb_file_io_pool_entry_t *source_file_io_pool_entry,
+     libcerror_error_t **error );
+
+int libnsfdb_file_io_pool_entry_open(
+     libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libnsfdb_file_io_pool_entry_close(
+     libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+     libcerror_error_t **error );
+
+ssize_t libnsfdb_file_io_pool_entry_read(
+         libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libnsfdb_file_io_pool_entry_write(
+         libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libnsfdb_file_io_pool_entry_seek_offset(
+         libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libnsfdb_file_io_pool_entry_exists(
+     libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+     libcerror_error_t **error );
+
+int libnsfdb_file_io_pool_entry_is_open(
+     libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+     libcerror_error_t **error );
+
+int libnsfdb_file_io_pool_entry_get_size(
+     libnsfdb_file_io_pool_entry_t *file_io_pool_entry,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libnsfdb_file_io_pool_entry_initialize_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     libbfio_pool_t *file_io_pool,
+     int entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_FILE_IO_POOL_ENTRY_H ) */
+
@@ -0,0 +1,1393 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_checksum.h"
+#include "libnsfdb_definitions.h"
+#include "libnsfdb_index_file.h"
+#include "libnsfdb_io_handle.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcdata.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libcnotify.h"
+#include "libnsfdb_libfdata.h"
+#include "libnsfdb_note_index.h"
+#include "libnsfdb_rrv_bucket_descriptor.h"
+#include "libnsfdb_rrv_value.h"
+#include "libnsfdb_unique_name_key.h"
+#include "libnsfdb_unique_name_key_table.h"
+
+#include "nsfdb_index_file.h"
+
+const uint8_t nsfdb_index_file_signature[ 8 ] = { 'n', 's', 'f', 'd', 'b', 'i', 'd', 'x' };
+
+/* Copies the bucket file positions of a bucket list to the index file data
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_index_file_copy_bucket_list_to_data(
+     libfdata_list_t *bucket_list,
+     uint8_t *data,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	static char *function  = "libnsfdb_index_file_copy_bucket_list_to_data";
+	size64_t element_size  = 0;
+	off64_t element_offset = 0;
+	uint32_t element_flags = 0;
+	int bucket_index       = 0;
+	int element_file_index = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     bucket_list,
+		     bucket_index,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bucket: %d.",
+			 function,
+			 bucket_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 data,
+		 (uint32_t) ( element_offset >> 8 ) );
+
+		data += 4;
+	}
+	return( 1 );
+}
+
+/* Copies the bucket file positions of the index file data to a bucket list
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_index_file_copy_data_to_bucket_list(
+     const uint8_t *data,
+     uint32_t number_of_buckets,
+     libfdata_list_t *bucket_list,
+     libcerror_error_t **error )
+{
+	static char *function  = "libnsfdb_index_file_copy_data_to_bucket_list";
+	off64_t bucket_offset  = 0;
+	uint32_t bucket_index  = 0;
+	uint32_t file_position = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buckets > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of buckets value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buckets == 0 )
+	{
+		return( 1 );
+	}
+	if( libfdata_list_resize(
+	     bucket_list,
+	     (int) number_of_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize bucket list.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 data,
+		 file_position );
+
+		data += 4;
+
+		bucket_offset = (off64_t) file_position << 8;
+
+		if( libfdata_list_set_element_by_index(
+		     bucket_list,
+		     (int) bucket_index,
+		     0,
+		     bucket_offset,
+		     (size64_t) 0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set bucket: %" PRIu32 ".",
+			 function,
+			 bucket_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the index file
+ * The index file is only used if it matches the file size and the write counts and checksums
+ * of the superblock and bucket descriptor block, in which case it replaces reading them and
+ * the note index. The bucket lists, RRV bucket descriptors, unique name key table and note index
+ * are set from the index file and must be empty
+ * On error the bucket lists and values of the IO handle can be partially set
+ * Returns 1 if successful, 0 if the index file does not match or -1 on error
+ */
+int libnsfdb_index_file_read(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     uint32_t superblock_write_count,
+     uint32_t superblock_checksum,
+     uint32_t bucket_descriptor_block_write_count,
+     uint32_t bucket_descriptor_block_checksum,
+     libfdata_list_t *summary_bucket_list,
+     libfdata_list_t *non_summary_bucket_list,
+     libcerror_error_t **error )
+{
+	nsfdb_index_file_header_t index_file_header;
+	libnsfdb_rrv_value_t rrv_value;
+
+	libnsfdb_note_index_t *note_index                       = NULL;
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	nsfdb_index_file_note_entry_t *note_entry               = NULL;
+	uint8_t *data                                           = NULL;
+	uint8_t *index_file_data                                = NULL;
+	static char *function                                   = "libnsfdb_index_file_read";
+	size64_t expected_data_size                             = 0;
+	size64_t file_size                                      = 0;
+	size_t unique_name_key_data_size                        = 0;
+	ssize_t read_count                                      = 0;
+	uint64_t modification_time                              = 0;
+	uint32_t calculated_checksum                            = 0;
+	uint32_t data_size                                      = 0;
+	uint32_t format_version                                 = 0;
+	uint32_t number_of_non_summary_buckets                  = 0;
+	uint32_t number_of_note_entries                         = 0;
+	uint32_t number_of_rrv_bucket_descriptors               = 0;
+	uint32_t number_of_summary_buckets                      = 0;
+	uint32_t number_of_unique_name_keys                     = 0;
+	uint32_t parent_note_identifier                         = 0;
+	uint32_t stored_bucket_descriptor_block_checksum        = 0;
+	uint32_t stored_bucket_descriptor_block_write_count     = 0;
+	uint32_t stored_checksum                                = 0;
+	uint32_t stored_superblock_checksum                     = 0;
+	uint32_t stored_superblock_write_count                  = 0;
+	uint32_t unique_name_key_text_size                      = 0;
+	uint32_t value_iterator                                 = 0;
+	uint16_t note_class                                     = 0;
+	uint16_t slot_index                                     = 0;
+	int number_of_rrv_bucket_descriptor_entries             = 0;
+	int number_of_unique_name_key_entries                   = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->note_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - note index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     io_handle->rrv_bucket_descriptors,
+	     &number_of_rrv_bucket_descriptor_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of RRV bucket descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     io_handle->unique_name_key_table,
+	     &number_of_unique_name_key_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of unique name keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_rrv_bucket_descriptor_entries != 0 )
+	 || ( number_of_unique_name_key_entries != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - bucket descriptor block values already set.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              index_file_io_handle,
+	              (uint8_t *) &index_file_header,
+	              sizeof( nsfdb_index_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( read_count != (ssize_t) sizeof( nsfdb_index_file_header_t ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     index_file_header.signature,
+	     nsfdb_index_file_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_file_header.file_size,
+	 file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.superblock_write_count,
+	 stored_superblock_write_count );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.superblock_checksum,
+	 stored_superblock_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.bucket_descriptor_block_write_count,
+	 stored_bucket_descriptor_block_write_count );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.bucket_descriptor_block_checksum,
+	 stored_bucket_descriptor_block_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.number_of_summary_buckets,
+	 number_of_summary_buckets );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.number_of_non_summary_buckets,
+	 number_of_non_summary_buckets );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.number_of_rrv_bucket_descriptors,
+	 number_of_rrv_bucket_descriptors );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.number_of_unique_name_keys,
+	 number_of_unique_name_keys );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.unique_name_key_text_size,
+	 unique_name_key_text_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.number_of_note_entries,
+	 number_of_note_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.data_size,
+	 data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.checksum,
+	 stored_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: file size\t\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 file_size );
+
+		libcnotify_printf(
+		 "%s: superblock write count\t\t\t: %" PRIu32 "\n",
+		 function,
+		 stored_superblock_write_count );
+
+		libcnotify_printf(
+		 "%s: superblock checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_superblock_checksum );
+
+		libcnotify_printf(
+		 "%s: bucket descriptor block write count\t\t: %" PRIu32 "\n",
+		 function,
+		 stored_bucket_descriptor_block_write_count );
+
+		libcnotify_printf(
+		 "%s: bucket descriptor block checksum\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_bucket_descriptor_block_checksum );
+
+		libcnotify_printf(
+		 "%s: number of summary buckets\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_summary_buckets );
+
+		libcnotify_printf(
+		 "%s: number of non-summary buckets\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_non_summary_buckets );
+
+		libcnotify_printf(
+		 "%s: number of RRV bucket descriptors\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_rrv_bucket_descriptors );
+
+		libcnotify_printf(
+		 "%s: number of unique name keys\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_unique_name_keys );
+
+		libcnotify_printf(
+		 "%s: unique name key text size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 unique_name_key_text_size );
+
+		libcnotify_printf(
+		 "%s: number of note entries\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_note_entries );
+
+		libcnotify_printf(
+		 "%s: data size\t\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 data_size );
+
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_checksum );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( format_version != 3 )
+	 || ( file_size != io_handle->file_size )
+	 || ( stored_superblock_write_count != superblock_write_count )
+	 || ( stored_superblock_checksum != superblock_checksum )
+	 || ( stored_bucket_descriptor_block_write_count != bucket_descriptor_block_write_count )
+	 || ( stored_bucket_descriptor_block_checksum != bucket_descriptor_block_checksum ) )
+	{
+		return( 0 );
+	}
+	expected_data_size = ( (size64_t) number_of_summary_buckets * 4 )
+	                   + ( (size64_t) number_of_non_summary_buckets * 4 )
+	                   + ( (size64_t) number_of_rrv_bucket_descriptors * 8 )
+	                   + ( (size64_t) number_of_note_entries * sizeof( nsfdb_index_file_note_entry_t ) );
+
+	if( number_of_unique_name_keys > 0 )
+	{
+		expected_data_size += ( (size64_t) number_of_unique_name_keys * 10 ) + 4 + unique_name_key_text_size;
+	}
+	if( ( number_of_note_entries > (uint32_t) INT_MAX )
+	 || ( expected_data_size != (size64_t) data_size ) )
+	{
+		return( 0 );
+	}
+	if( ( data_size == 0 )
+	 || ( (size_t) data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	index_file_data = (uint8_t *) memory_allocate(
+	                               (size_t) data_size );
+
+	if( index_file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index file data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              index_file_io_handle,
+	              index_file_data,
+	              (size_t) data_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( read_count != (ssize_t) data_size )
+	{
+		memory_free(
+		 index_file_data );
+
+		return( 0 );
+	}
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     index_file_data,
+	     (size_t) data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in index file checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+		}
+#endif
+		memory_free(
+		 index_file_data );
+
+		return( 0 );
+	}
+	/* The bucket lists are stored in the same format as in the superblock
+	 */
+	data = index_file_data;
+
+	if( libnsfdb_index_file_copy_data_to_bucket_list(
+	     data,
+	     number_of_summary_buckets,
+	     summary_bucket_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	data += (size_t) number_of_summary_buckets * 4;
+
+	if( libnsfdb_index_file_copy_data_to_bucket_list(
+	     data,
+	     number_of_non_summary_buckets,
+	     non_summary_bucket_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy non-summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	data += (size_t) number_of_non_summary_buckets * 4;
+
+	/* The RRV bucket descriptors are stored in the same format as in the bucket descriptor block
+	 */
+	if( number_of_rrv_bucket_descriptors > 0 )
+	{
+		if( libcdata_array_resize(
+		     io_handle->rrv_bucket_descriptors,
+		     (int) number_of_rrv_bucket_descriptors,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_bucket_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize RRV bucket descriptors array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( value_iterator = 0;
+	     value_iterator < number_of_rrv_bucket_descriptors;
+	     value_iterator++ )
+	{
+		if( libnsfdb_rrv_bucket_descriptor_initialize(
+		     &rrv_bucket_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create RRV bucket descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 data,
+		 rrv_bucket_descriptor->file_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 rrv_bucket_descriptor->initial_rrv_identifier );
+
+		data += 8;
+
+		if( ( rrv_bucket_descriptor->file_offset & 0x00000001UL ) != 0 )
+		{
+			rrv_bucket_descriptor->file_offset -= 1;
+			rrv_bucket_descriptor->type         = LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA;
+		}
+		else
+		{
+			rrv_bucket_descriptor->type = LIBNSFDB_RRV_BUCKET_TYPE_DATA;
+		}
+		rrv_bucket_descriptor->file_offset <<= 8;
+
+		if( libcdata_array_set_entry_by_index(
+		     io_handle->rrv_bucket_descriptors,
+		     (int) value_iterator,
+		     (intptr_t *) rrv_bucket_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set RRV bucket descriptor: %" PRIu32 ".",
+			 function,
+			 value_iterator );
+
+			goto on_error;
+		}
+		rrv_bucket_descriptor = NULL;
+	}
+	/* The unique name key table is stored in the same format as in the bucket descriptor block
+	 */
+	if( number_of_unique_name_keys > 0 )
+	{
+		unique_name_key_data_size = ( (size_t) number_of_unique_name_keys * 10 ) + 4 + unique_name_key_text_size;
+
+		read_count = libnsfdb_unique_name_key_table_read(
+		              io_handle->unique_name_key_table,
+		              data,
+		              unique_name_key_data_size,
+		              number_of_unique_name_keys,
+		              unique_name_key_text_size,
+		              error );
+
+		if( read_count != (ssize_t) unique_name_key_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unique name key table.",
+			 function );
+
+			goto on_error;
+		}
+		data += unique_name_key_data_size;
+	}
+	if( libnsfdb_note_index_initialize(
+	     &note_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create note index.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_iterator = 0;
+	     value_iterator < number_of_note_entries;
+	     value_iterator++ )
+	{
+		note_entry = (nsfdb_index_file_note_entry_t *) data;
+
+		if( memory_set(
+		     &rrv_value,
+		     0,
+		     sizeof( libnsfdb_rrv_value_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear RRV value.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 note_entry->rrv_identifier,
+		 rrv_value.rrv_identifier );
+
+		rrv_value.type = note_entry->rrv_value_type;
+
+		if( rrv_value.type == LIBNSFDB_RRV_VALUE_TYPE_FILE_POSITION )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 note_entry->bucket_index,
+			 rrv_value.file_offset );
+
+			rrv_value.file_offset <<= 8;
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 note_entry->bucket_index,
+			 rrv_value.bucket_index );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 note_entry->slot_index,
+			 slot_index );
+
+			rrv_value.slot_index = slot_index;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 note_entry->non_summary,
+			 rrv_value.nonsum );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 note_entry->note_class,
+		 note_class );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 note_entry->modification_time,
+		 modification_time );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 note_entry->parent_note_identifier,
+		 parent_note_identifier );
+
+		if( libnsfdb_note_index_append_entry(
+		     note_index,
+		     &rrv_value,
+		     note_entry->note_type,
+		     note_class,
+		     modification_time,
+		     parent_note_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append note index entry: %" PRIu32 ".",
+			 function,
+			 value_iterator );
+
+			goto on_error;
+		}
+		data += sizeof( nsfdb_index_file_note_entry_t );
+	}
+	if( libnsfdb_note_index_finalize(
+	     note_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize note index.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 index_file_data );
+
+	io_handle->note_index = note_index;
+
+	io_handle->superblock_write_count              = superblock_write_count;
+	io_handle->superblock_checksum                 = superblock_checksum;
+	io_handle->bucket_descriptor_block_write_count = bucket_descriptor_block_write_count;
+	io_handle->bucket_descriptor_block_checksum    = bucket_descriptor_block_checksum;
+
+	return( 1 );
+
+on_error:
+	if( note_index != NULL )
+	{
+		libnsfdb_note_index_free(
+		 &note_index,
+		 NULL );
+	}
+	if( rrv_bucket_descriptor != NULL )
+	{
+		libnsfdb_rrv_bucket_descriptor_free(
+		 &rrv_bucket_descriptor,
+		 NULL );
+	}
+	if( index_file_data != NULL )
+	{
+		memory_free(
+		 index_file_data );
+	}
+	return( -1 );
+}
+
+/* Writes the index file
+ * The IO handle must contain a note index
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_index_file_write(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     libfdata_list_t *summary_bucket_list,
+     libfdata_list_t *non_summary_bucket_list,
+     libcerror_error_t **error )
+{
+	nsfdb_index_file_header_t index_file_header;
+
+	libnsfdb_note_index_entry_t *note_index_entry           = NULL;
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	libnsfdb_unique_name_key_t *unique_name_key             = NULL;
+	nsfdb_index_file_note_entry_t *note_entry               = NULL;
+	uint8_t *data                                           = NULL;
+	uint8_t *index_file_data                                = NULL;
+	uint8_t *unique_name_key_text                           = NULL;
+	static char *function                                   = "libnsfdb_index_file_write";
+	size64_t data_size                                      = 0;
+	ssize_t write_count                                     = 0;
+	uint32_t calculated_checksum                            = 0;
+	uint32_t file_position                                  = 0;
+	uint32_t unique_name_key_text_offset                    = 0;
+	uint32_t unique_name_key_text_size                      = 0;
+	int entry_index                                         = 0;
+	int number_of_non_summary_buckets                       = 0;
+	int number_of_rrv_bucket_descriptors                    = 0;
+	int number_of_summary_buckets                           = 0;
+	int number_of_unique_name_keys                          = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     summary_bucket_list,
+	     &number_of_summary_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of summary buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_get_number_of_elements(
+	     non_summary_bucket_list,
+	     &number_of_non_summary_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of non-summary buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     io_handle->rrv_bucket_descriptors,
+	     &number_of_rrv_bucket_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of RRV bucket descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     io_handle->unique_name_key_table,
+	     &number_of_unique_name_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of unique name keys.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_unique_name_keys;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     io_handle->unique_name_key_table,
+		     entry_index,
+		     (intptr_t **) &unique_name_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve unique name key: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( unique_name_key == NULL )
+		 || ( unique_name_key->name == NULL )
+		 || ( unique_name_key->name_size == 0 )
+		 || ( unique_name_key->name_size > (size_t) ( UINT16_MAX + 1 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid unique name key: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		unique_name_key_text_size += (uint32_t) unique_name_key->name_size - 1;
+	}
+	data_size = ( (size64_t) number_of_summary_buckets * 4 )
+	          + ( (size64_t) number_of_non_summary_buckets * 4 )
+	          + ( (size64_t) number_of_rrv_bucket_descriptors * 8 )
+	          + ( (size64_t) io_handle->note_index->number_of_entries * sizeof( nsfdb_index_file_note_entry_t ) );
+
+	if( number_of_unique_name_keys > 0 )
+	{
+		data_size += ( (size64_t) number_of_unique_name_keys * 10 ) + 4 + unique_name_key_text_size;
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size64_t) UINT32_MAX )
+	 || ( data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index file data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	index_file_data = (uint8_t *) memory_allocate(
+	                               (size_t) data_size );
+
+	if( index_file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     index_file_data,
+	     0,
+	     (size_t) data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index file data.",
+		 function );
+
+		goto on_error;
+	}
+	data = index_file_data;
+
+	if( libnsfdb_index_file_copy_bucket_list_to_data(
+	     summary_bucket_list,
+	     data,
+	     number_of_summary_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to copy summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	data += (size_t) number_of_summary_buckets * 4;
+
+	if( libnsfdb_index_file_copy_bucket_list_to_data(
+	     non_summary_bucket_list,
+	     data,
+	     number_of_non_summary_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to copy non-summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	data += (size_t) number_of_non_summary_buckets * 4;
+
+	for( entry_index = 0;
+	     entry_index < number_of_rrv_bucket_descriptors;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     io_handle->rrv_bucket_descriptors,
+		     entry_index,
+		     (intptr_t **) &rrv_bucket_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve RRV bucket descriptor: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( rrv_bucket_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing RRV bucket descriptor: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		file_position = (uint32_t) ( rrv_bucket_descriptor->file_offset >> 8 );
+
+		if( rrv_bucket_descriptor->type == LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA )
+		{
+			file_position |= 0x00000001UL;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 data,
+		 file_position );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 rrv_bucket_descriptor->initial_rrv_identifier );
+
+		data += 8;
+	}
+	/* The unique name keys are stored in the same format as in the bucket descriptor block
+	 */
+	if( number_of_unique_name_keys > 0 )
+	{
+		unique_name_key_text = &( data[ ( number_of_unique_name_keys * 10 ) + 4 ] );
+
+		for( entry_index = 0;
+		     entry_index < number_of_unique_name_keys;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     io_handle->unique_name_key_table,
+			     entry_index,
+			     (intptr_t **) &unique_name_key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve unique name key: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 data,
+			 unique_name_key_text_offset );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( data[ 4 ] ),
+			 (uint16_t) ( unique_name_key->name_size - 1 ) );
+
+			data[ 6 ] = unique_name_key->note_item_type;
+			data[ 7 ] = unique_name_key->note_item_class;
+
+			data += 10;
+
+			if( memory_copy(
+			     &( unique_name_key_text[ unique_name_key_text_offset ] ),
+			     unique_name_key->name,
+			     unique_name_key->name_size - 1 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy unique name key: %d name.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			unique_name_key_text_offset += (uint32_t) unique_name_key->name_size - 1;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 data,
+		 unique_name_key_text_size );
+
+		data += 4 + unique_name_key_text_size;
+	}
+	for( entry_index = 0;
+	     entry_index < io_handle->note_index->number_of_entries;
+	     entry_index++ )
+	{
+		note_index_entry = &( io_handle->note_index->entries[ entry_index ] );
+		note_entry       = (nsfdb_index_file_note_entry_t *) data;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 note_entry->rrv_identifier,
+		 note_index_entry->rrv_value.rrv_identifier );
+
+		note_entry->rrv_value_type = note_index_entry->rrv_value.type;
+		note_entry->note_type      = note_index_entry->note_type;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 note_entry->note_class,
+		 note_index_entry->note_class );
+
+		if( note_index_entry->rrv_value.type == LIBNSFDB_RRV_VALUE_TYPE_FILE_POSITION )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 note_entry->bucket_index,
+			 (uint32_t) ( note_index_entry->rrv_value.file_offset >> 8 ) );
+		}
+		else
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 note_entry->bucket_index,
+			 note_index_entry->rrv_value.bucket_index );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 note_entry->slot_index,
+			 note_index_entry->rrv_value.slot_index );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 note_entry->non_summary,
+			 note_index_entry->rrv_value.nonsum );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 note_entry->modification_time,
+		 note_index_entry->modification_time );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 note_entry->parent_note_identifier,
+		 note_index_entry->parent_note_identifier );
+
+		data += sizeof( nsfdb_index_file_note_entry_t );
+	}
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     index_file_data,
+	     (size_t) data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     &index_file_header,
+	     0,
+	     sizeof( nsfdb_index_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     index_file_header.signature,
+	     nsfdb_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.format_version,
+	 3 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_file_header.file_size,
+	 io_handle->file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.superblock_write_count,
+	 io_handle->superblock_write_count );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.superblock_checksum,
+	 io_handle->superblock_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.bucket_descriptor_block_write_count,
+	 io_handle->bucket_descriptor_block_write_count );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.bucket_descriptor_block_checksum,
+	 io_handle->bucket_descriptor_block_checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.number_of_summary_buckets,
+	 (uint32_t) number_of_summary_buckets );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.number_of_non_summary_buckets,
+	 (uint32_t) number_of_non_summary_buckets );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.number_of_rrv_bucket_descriptors,
+	 (uint32_t) number_of_rrv_bucket_descriptors );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.number_of_unique_name_keys,
+	 (uint32_t) number_of_unique_name_keys );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.unique_name_key_text_size,
+	 unique_name_key_text_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.number_of_note_entries,
+	 (uint32_t) io_handle->note_index->number_of_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.data_size,
+	 (uint32_t) data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.checksum,
+	 calculated_checksum );
+
+	write_count = libbfio_handle_write_buffer(
+	               index_file_io_handle,
+	               (uint8_t *) &index_file_header,
+	               sizeof( nsfdb_index_file_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( nsfdb_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file header.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               index_file_io_handle,
+	               index_file_data,
+	               (size_t) data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 index_file_data );
+
+	return( 1 );
+
+on_error:
+	if( index_file_data != NULL )
+	{
+		memory_free(
+		 index_file_data );
+	}
+	return( -1 );
+}
+
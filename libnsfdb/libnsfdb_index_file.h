@@ -0,0 +1,74 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_INDEX_FILE_H )
+#define _LIBNSFDB_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_io_handle.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t nsfdb_index_file_signature[ 8 ];
+
+int libnsfdb_index_file_copy_bucket_list_to_data(
+     libfdata_list_t *bucket_list,
+     uint8_t *data,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int libnsfdb_index_file_copy_data_to_bucket_list(
+     const uint8_t *data,
+     uint32_t number_of_buckets,
+     libfdata_list_t *bucket_list,
+     libcerror_error_t **error );
+
+int libnsfdb_index_file_read(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     uint32_t superblock_write_count,
+     uint32_t superblock_checksum,
+     uint32_t bucket_descriptor_block_write_count,
+     uint32_t bucket_descriptor_block_checksum,
+     libfdata_list_t *summary_bucket_list,
+     libfdata_list_t *non_summary_bucket_list,
+     libcerror_error_t **error );
+
+int libnsfdb_index_file_write(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *index_file_io_handle,
+     libfdata_list_t *summary_bucket_list,
+     libfdata_list_t *non_summary_bucket_list,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_INDEX_FILE_H ) */
+
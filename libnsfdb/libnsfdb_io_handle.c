@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libnsfdb_bucket.h"
+#include "libnsfdb_bucket_list.h"
 #include "libnsfdb_checksum.h"
 #include "libnsfdb_compression.h"
 #include "libnsfdb_debug.h"
@@ -37,8 +38,10 @@
 #include "libnsfdb_libfcache.h"
 #include "libnsfdb_libfdata.h"
 #include "libnsfdb_libfdatetime.h"
+#include "libnsfdb_note_index.h"
 #include "libnsfdb_rrv_bucket.h"
 #include "libnsfdb_rrv_bucket_descriptor.h"
+#include "libnsfdb_rrv_value.h"
 #include "libnsfdb_unique_name_key.h"
 #include "libnsfdb_unique_name_key_table.h"
 #include "libnsfdb_unused.h"
@@ -47,6 +50,7 @@
 #include "nsfdb_bucket_descriptor_block.h"
 #include "nsfdb_database_header.h"
 #include "nsfdb_file_header.h"
+#include "nsfdb_note.h"
 #include "nsfdb_superblock.h"
 
 const char nsfdb_file_signature[ 2 ] = { 0x1a, 0x00 };
@@ -247,6 +251,39 @@ int libnsfdb_io_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *io_handle )->note_index != NULL )
+		{
+			if( libnsfdb_note_index_free(
+			     &( ( *io_handle )->note_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free note index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->recovered_notes != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *io_handle )->recovered_notes ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_value_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free recovered notes array.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *io_handle );
 
@@ -336,6 +373,39 @@ int libnsfdb_io_handle_clear(
 			result = -1;
 		}
 	}
+	if( io_handle->note_index != NULL )
+	{
+		if( libnsfdb_note_index_free(
+		     &( io_handle->note_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free note index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( io_handle->recovered_notes != NULL )
+	{
+		if( libcdata_array_free(
+		     &( io_handle->recovered_notes ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_value_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free recovered notes array.",
+			 function );
+
+			result = -1;
+		}
+	}
         io_handle->format_version                  = 0;
         io_handle->rrv_bucket_size                 = 0;
         io_handle->summary_bucket_size             = 0;
@@ -344,6 +414,11 @@ int libnsfdb_io_handle_clear(
         io_handle->minimum_non_summary_bucket_size = 0;
         io_handle->maximum_non_summary_bucket_size = 0;
         io_handle->file_size                       = 0;
+        io_handle->superblock_write_count          = 0;
+        io_handle->superblock_checksum             = 0;
+
+        io_handle->bucket_descriptor_block_write_count = 0;
+        io_handle->bucket_descriptor_block_checksum    = 0;
 
 /* TODO refactor IO handle
 	if( memory_set(
@@ -364,6 +439,113 @@ int libnsfdb_io_handle_clear(
 	return( result );
 }
 
+/* Clears the values read from the bucket descriptor block and the values derived from them
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_io_handle_clear_bucket_descriptor_block(
+     libnsfdb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_io_handle_clear_bucket_descriptor_block";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     io_handle->rrv_bucket_descriptors,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_bucket_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty RRV bucket descriptors array.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_empty(
+	     io_handle->unique_name_key_table,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_unique_name_key_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty unique name key table.",
+		 function );
+
+		result = -1;
+	}
+	/* RRV buckets can be rewritten in place hence none of the cached RRV buckets can be reused
+	 */
+	if( io_handle->rrv_bucket_cache != NULL )
+	{
+		if( libfcache_cache_empty(
+		     io_handle->rrv_bucket_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty RRV bucket cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( io_handle->cache_pool != NULL )
+	{
+		if( libnsfdb_cache_pool_remove_values_by_type(
+		     io_handle->cache_pool,
+		     io_handle->cache_pool_owner_identifier,
+		     LIBNSFDB_CACHE_POOL_VALUE_TYPE_RRV_BUCKET,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove RRV buckets from cache pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( io_handle->note_index != NULL )
+	{
+		if( libnsfdb_note_index_free(
+		     &( io_handle->note_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free note index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	io_handle->bucket_descriptor_block_write_count = 0;
+	io_handle->bucket_descriptor_block_checksum    = 0;
+
+	return( result );
+}
+
 /* Reads the file header
  * Returns 1 if successful or -1 on error
  */
@@ -507,6 +689,7 @@ int libnsfdb_io_handle_read_database_header(
 
 	static char *function                     = "libnsfdb_io_handle_read_database_header";
 	ssize_t read_count                        = 0;
+	int number_of_segments                    = 0;
 	int segment_index                         = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -2361,6 +2544,25 @@ int libnsfdb_io_handle_read_database_header(
 
 			goto on_error;
 		}
+	}
+	if( libfdata_vector_get_number_of_segments(
+	     io_handle->rrv_bucket_vector,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments of RRV bucket vector.",
+		 function );
+
+		goto on_error;
+	}
+	/* The segment is updated when the database header is read again, after the file has grown
+	 */
+	if( number_of_segments == 0 )
+	{
 		if( libfdata_vector_append_segment(
 		     io_handle->rrv_bucket_vector,
 		     &segment_index,
@@ -2380,6 +2582,27 @@ int libnsfdb_io_handle_read_database_header(
 			goto on_error;
 		}
 	}
+	else
+	{
+		if( libfdata_vector_set_segment_by_index(
+		     io_handle->rrv_bucket_vector,
+		     0,
+		     0,
+		     0,
+		     io_handle->file_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set segment of RRV bucket vector.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( io_handle->rrv_bucket_cache == NULL )
 	{
 		if( libfcache_cache_initialize(
@@ -3019,6 +3242,12 @@ int libnsfdb_io_handle_read_superblock(
 
 		goto on_error;
 	}
+	byte_stream_copy_to_uint32_little_endian(
+	 superblock_header.write_count,
+	 io_handle->superblock_write_count );
+
+	io_handle->superblock_checksum = stored_checksum;
+
 	if( compression_type != 1 )
 	{
 		libcerror_error_set(
@@ -3929,43 +4158,29 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the bucket descriptor block
+/* Reads the superblock key
+ * The key consists of the superblock write count and checksum and is used
+ * to determine if cached information about the file is still valid
+ * Only the superblock header and footer are read
  * Returns 1 if successful or -1 on error
  */
-int libnsfdb_io_handle_read_bucket_descriptor_block(
+int libnsfdb_io_handle_read_superblock_key(
      libnsfdb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     off64_t bucket_descriptor_block_offset,
-     uint32_t bucket_descriptor_block_size,
+     off64_t superblock_offset,
+     uint32_t superblock_size,
+     uint32_t *superblock_write_count,
+     uint32_t *superblock_checksum,
      libcerror_error_t **error )
 {
-	nsfdb_bucket_descriptor_block_header_t bucket_descriptor_block_header;
-	nsfdb_bucket_descriptor_block_footer_t bucket_descriptor_block_footer;
-
-	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
-	uint8_t *bucket_descriptor_block_data                   = NULL;
-	uint8_t *compressed_data                                = NULL;
-	uint8_t *uncompressed_data                              = NULL;
-	static char *function                                   = "libnsfdb_io_handle_read_bucket_descriptor_block";
-	ssize_t read_count                                      = 0;
-	uint32_t number_of_rrv_bucket_descriptors               = 0;
-	uint32_t number_of_unique_name_keys                     = 0;
-	uint32_t calculated_checksum                            = 0;
-	uint32_t rrv_bucket_descriptor_iterator                 = 0;
-	uint32_t stored_checksum                                = 0;
-	uint32_t stored_size                                    = 0;
-	uint32_t uncompressed_size                              = 0;
-	uint32_t unique_name_key_text_size                      = 0;
-	uint16_t compression_type                               = 0;
-	uint16_t header_version                                 = 0;
-	uint16_t header_signature                               = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t nsf_timedate_string[ 32 ];
+	nsfdb_superblock_header_t superblock_header;
+	nsfdb_superblock_footer_t superblock_footer;
 
-	libfdatetime_nsf_timedate_t *nsf_timedate               = NULL;
-	uint32_t value_32bit                                    = 0;
-#endif
+	static char *function     = "libnsfdb_io_handle_read_superblock_key";
+	off64_t footer_offset     = 0;
+	ssize_t read_count        = 0;
+	uint32_t stored_size      = 0;
+	uint16_t header_signature = 0;
 
 	if( io_handle == NULL )
 	{
@@ -3978,82 +4193,743 @@ int libnsfdb_io_handle_read_bucket_descriptor_block(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( superblock_write_count == NULL )
 	{
-		libcnotify_printf(
-		 "%s: reading bucket descriptor block at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 bucket_descriptor_block_offset,
-		 bucket_descriptor_block_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock write count.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock_checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock checksum.",
+		 function );
+
+		return( -1 );
 	}
-#endif
 	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
-	              (uint8_t *) &bucket_descriptor_block_header,
-	              sizeof( nsfdb_bucket_descriptor_block_header_t ),
-	              bucket_descriptor_block_offset,
+	              (uint8_t *) &superblock_header,
+	              sizeof( nsfdb_superblock_header_t ),
+	              superblock_offset,
 	              error );
 
-	if( read_count != (ssize_t) sizeof( nsfdb_bucket_descriptor_block_header_t ) )
+	if( read_count != (ssize_t) sizeof( nsfdb_superblock_header_t ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read bucket descriptor block header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to read superblock header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 bucket_descriptor_block_offset,
-		 bucket_descriptor_block_offset );
+		 superblock_offset,
+		 superblock_offset );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: bucket descriptor block header:\n",
-		 function );
-		libcnotify_print_data(
-		 (uint8_t *) &bucket_descriptor_block_header,
-		 sizeof( nsfdb_bucket_descriptor_block_header_t ),
-		 0 );
+	byte_stream_copy_to_uint16_little_endian(
+	 superblock_header.signature,
+	 header_signature );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 superblock_header.size,
+	 stored_size );
+
+	if( header_signature != 0x000e )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported superblock signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stored_size < ( sizeof( nsfdb_superblock_header_t ) + sizeof( nsfdb_superblock_footer_t ) ) )
+	 || ( stored_size > superblock_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: stored superblock size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	footer_offset = superblock_offset + stored_size - sizeof( nsfdb_superblock_footer_t );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &superblock_footer,
+	              sizeof( nsfdb_superblock_footer_t ),
+	              footer_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( nsfdb_superblock_footer_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read superblock footer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 footer_offset,
+		 footer_offset );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 superblock_header.write_count,
+	 *superblock_write_count );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 superblock_footer.checksum,
+	 *superblock_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: superblock write count\t\t: %" PRIu32 "\n",
+		 function,
+		 *superblock_write_count );
+
+		libcnotify_printf(
+		 "%s: superblock checksum\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 *superblock_checksum );
+
+		libcnotify_printf(
+		 "\n" );
 	}
 #endif
+	return( 1 );
+}
+
+/* Reads the bucket descriptor block key
+ * The key consists of the bucket descriptor block write count and checksum and is used
+ * to determine if cached information about the file is still valid
+ * Only the bucket descriptor block header and footer are read
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_io_handle_read_bucket_descriptor_block_key(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t bucket_descriptor_block_offset,
+     uint32_t bucket_descriptor_block_size,
+     uint32_t *bucket_descriptor_block_write_count,
+     uint32_t *bucket_descriptor_block_checksum,
+     libcerror_error_t **error )
+{
+	nsfdb_bucket_descriptor_block_header_t bucket_descriptor_block_header;
+	nsfdb_bucket_descriptor_block_footer_t bucket_descriptor_block_footer;
+
+	static char *function     = "libnsfdb_io_handle_read_bucket_descriptor_block_key";
+	off64_t footer_offset     = 0;
+	ssize_t read_count        = 0;
+	uint32_t stored_size      = 0;
+	uint16_t header_signature = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_descriptor_block_write_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket descriptor block write count.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_descriptor_block_checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket descriptor block checksum.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &bucket_descriptor_block_header,
+	              sizeof( nsfdb_bucket_descriptor_block_header_t ),
+	              bucket_descriptor_block_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( nsfdb_bucket_descriptor_block_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read bucket descriptor block header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 bucket_descriptor_block_offset,
+		 bucket_descriptor_block_offset );
+
+		return( -1 );
+	}
 	byte_stream_copy_to_uint16_little_endian(
 	 bucket_descriptor_block_header.signature,
 	 header_signature );
 
-	byte_stream_copy_to_uint16_little_endian(
-	 bucket_descriptor_block_header.version,
-	 header_version );
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_header.size,
+	 stored_size );
 
-	byte_stream_copy_to_uint16_little_endian(
-	 bucket_descriptor_block_header.compression_type,
-	 compression_type );
+	if( header_signature != 0x0001 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bucket descriptor block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stored_size < ( sizeof( nsfdb_bucket_descriptor_block_header_t ) + sizeof( nsfdb_bucket_descriptor_block_footer_t ) ) )
+	 || ( stored_size > bucket_descriptor_block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: stored bucket descriptor block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	footer_offset = bucket_descriptor_block_offset + stored_size - sizeof( nsfdb_bucket_descriptor_block_footer_t );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &bucket_descriptor_block_footer,
+	              sizeof( nsfdb_bucket_descriptor_block_footer_t ),
+	              footer_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( nsfdb_bucket_descriptor_block_footer_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read bucket descriptor block footer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 footer_offset,
+		 footer_offset );
 
+		return( -1 );
+	}
 	byte_stream_copy_to_uint32_little_endian(
-	 bucket_descriptor_block_header.uncompressed_size,
-	 uncompressed_size );
+	 bucket_descriptor_block_header.write_count,
+	 *bucket_descriptor_block_write_count );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 bucket_descriptor_block_header.size,
-	 stored_size );
+	 bucket_descriptor_block_footer.checksum,
+	 *bucket_descriptor_block_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: bucket descriptor block write count\t: %" PRIu32 "\n",
+		 function,
+		 *bucket_descriptor_block_write_count );
+
+		libcnotify_printf(
+		 "%s: bucket descriptor block checksum\t: 0x%08" PRIx32 "\n",
+		 function,
+		 *bucket_descriptor_block_checksum );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads the bucket descriptor block
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_io_handle_read_bucket_descriptor_block(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t bucket_descriptor_block_offset,
+     uint32_t bucket_descriptor_block_size,
+     libcerror_error_t **error )
+{
+	nsfdb_bucket_descriptor_block_header_t bucket_descriptor_block_header;
+	nsfdb_bucket_descriptor_block_footer_t bucket_descriptor_block_footer;
+
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	uint8_t *bucket_descriptor_block_data                   = NULL;
+	uint8_t *compressed_data                                = NULL;
+	uint8_t *uncompressed_data                              = NULL;
+	static char *function                                   = "libnsfdb_io_handle_read_bucket_descriptor_block";
+	ssize_t read_count                                      = 0;
+	uint32_t number_of_rrv_bucket_descriptors               = 0;
+	uint32_t number_of_unique_name_keys                     = 0;
+	uint32_t calculated_checksum                            = 0;
+	uint32_t rrv_bucket_descriptor_iterator                 = 0;
+	uint32_t stored_checksum                                = 0;
+	uint32_t stored_size                                    = 0;
+	uint32_t uncompressed_size                              = 0;
+	uint32_t unique_name_key_text_size                      = 0;
+	uint16_t compression_type                               = 0;
+	uint16_t header_version                                 = 0;
+	uint16_t header_signature                               = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint8_t nsf_timedate_string[ 32 ];
+
+	libfdatetime_nsf_timedate_t *nsf_timedate               = NULL;
+	uint32_t value_32bit                                    = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading bucket descriptor block at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 bucket_descriptor_block_offset,
+		 bucket_descriptor_block_offset );
+	}
+#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &bucket_descriptor_block_header,
+	              sizeof( nsfdb_bucket_descriptor_block_header_t ),
+	              bucket_descriptor_block_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( nsfdb_bucket_descriptor_block_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read bucket descriptor block header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 bucket_descriptor_block_offset,
+		 bucket_descriptor_block_offset );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: bucket descriptor block header:\n",
+		 function );
+		libcnotify_print_data(
+		 (uint8_t *) &bucket_descriptor_block_header,
+		 sizeof( nsfdb_bucket_descriptor_block_header_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint16_little_endian(
+	 bucket_descriptor_block_header.signature,
+	 header_signature );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 bucket_descriptor_block_header.version,
+	 header_version );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 bucket_descriptor_block_header.compression_type,
+	 compression_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_header.uncompressed_size,
+	 uncompressed_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_header.size,
+	 stored_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_header.number_of_unique_name_keys,
+	 number_of_unique_name_keys );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_header.unique_name_key_text_size,
+	 unique_name_key_text_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_header.number_of_rrv_bucket_descriptors,
+	 number_of_rrv_bucket_descriptors );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_header.checksum,
+	 stored_checksum );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libfdatetime_nsf_timedate_initialize(
+		     &nsf_timedate,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create nsf timedate.",
+			 function );
+
+			goto on_error;
+		}
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 header_signature );
+
+		libcnotify_printf(
+		 "%s: version\t\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 header_version );
+
+		libcnotify_printf(
+		 "%s: compression type\t\t\t: %" PRIu16 "\n",
+		 function,
+		 compression_type );
+
+		libcnotify_printf(
+		 "%s: uncompressed size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 uncompressed_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 bucket_descriptor_block_header.write_count,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: write count\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: size\t\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 stored_size );
+
+		if( libfdatetime_nsf_timedate_copy_from_byte_stream(
+		     nsf_timedate,
+		     bucket_descriptor_block_header.modification_time,
+		     8,
+		     LIBFDATETIME_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy nsf timedate from byte stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdatetime_nsf_timedate_copy_to_utf8_string(
+		     nsf_timedate,
+		     nsf_timedate_string,
+		     32,
+		     LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy nsf timedate to string.",
+			 function );
+
+			goto on_error;
+		}
+		libcnotify_printf(
+		 "%s: modification time\t\t\t: %s\n",
+		 function,
+		 (char *) nsf_timedate_string );
+
+		libcnotify_printf(
+		 "%s: number of unique name keys\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_unique_name_keys );
+
+		libcnotify_printf(
+		 "%s: unknown1:\n",
+		 function );
+		libcnotify_print_data(
+		 bucket_descriptor_block_header.unknown1,
+		 4,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: unique name key text size\t\t: %" PRIu32 "\n",
+		 function,
+		 unique_name_key_text_size );
+
+		libcnotify_printf(
+		 "%s: number of RRV bucket descriptors\t: %" PRIu32 "\n",
+		 function,
+		 number_of_rrv_bucket_descriptors );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 bucket_descriptor_block_header.number_of_unk_hash_table_entries,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: number of UNK hash table entries\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: unknown2:\n",
+		 function );
+		libcnotify_print_data(
+		 bucket_descriptor_block_header.unknown2,
+		 8,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_checksum );
+
+		libcnotify_printf(
+		 "%s: unknown3:\n",
+		 function );
+		libcnotify_print_data(
+		 bucket_descriptor_block_header.unknown3,
+		 8,
+		 0 );
+
+		if( libfdatetime_nsf_timedate_free(
+		     &nsf_timedate,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free nsf timedate.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( header_signature != 0x0001 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bucket descriptor block signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( header_version != 0x0002 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bucket descriptor block version.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     (uint8_t *) &bucket_descriptor_block_header,
+	     sizeof( nsfdb_bucket_descriptor_block_header_t ) - 12,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	/* Ignore the checksum itself
+	 */
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     (uint8_t *) bucket_descriptor_block_header.unknown3,
+	     8,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in bucket descriptor block header checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	if( stored_size > bucket_descriptor_block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: stored bucket descriptor block size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* TODO check stored size with total */
+	stored_size -= (uint32_t) sizeof( nsfdb_bucket_descriptor_block_header_t )
+	             + (uint32_t) sizeof( nsfdb_bucket_descriptor_block_footer_t );
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               stored_size );
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              compressed_data,
+	              stored_size,
+	              error );
+
+	if( read_count != (ssize_t) stored_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed data.",
+		 function );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 bucket_descriptor_block_header.number_of_unique_name_keys,
-	 number_of_unique_name_keys );
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: compressed data:\n",
+		 function );
+		libcnotify_print_data(
+		 compressed_data,
+		 stored_size,
+		 0 );
+	}
+#endif
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     compressed_data,
+	     stored_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 bucket_descriptor_block_header.unique_name_key_text_size,
-	 unique_name_key_text_size );
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              (uint8_t *) &bucket_descriptor_block_footer,
+	              sizeof( nsfdb_bucket_descriptor_block_footer_t ),
+	              error );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 bucket_descriptor_block_header.number_of_rrv_bucket_descriptors,
-	 number_of_rrv_bucket_descriptors );
+	if( read_count != (ssize_t) sizeof( nsfdb_bucket_descriptor_block_footer_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read bucket descriptor block footer.",
+		 function );
 
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: bucket descriptor block footer:\n",
+		 function );
+		libcnotify_print_data(
+		 (uint8_t *) &bucket_descriptor_block_footer,
+		 sizeof( nsfdb_bucket_descriptor_block_footer_t ),
+		 0 );
+	}
+#endif
 	byte_stream_copy_to_uint32_little_endian(
-	 bucket_descriptor_block_header.checksum,
+	 bucket_descriptor_block_footer.checksum,
 	 stored_checksum );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -4072,43 +4948,9 @@ int libnsfdb_io_handle_read_bucket_descriptor_block(
 
 			goto on_error;
 		}
-		libcnotify_printf(
-		 "%s: signature\t\t\t\t: 0x%04" PRIx16 "\n",
-		 function,
-		 header_signature );
-
-		libcnotify_printf(
-		 "%s: version\t\t\t\t: 0x%04" PRIx16 "\n",
-		 function,
-		 header_version );
-
-		libcnotify_printf(
-		 "%s: compression type\t\t\t: %" PRIu16 "\n",
-		 function,
-		 compression_type );
-
-		libcnotify_printf(
-		 "%s: uncompressed size\t\t\t: %" PRIu32 "\n",
-		 function,
-		 uncompressed_size );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 bucket_descriptor_block_header.write_count,
-		 value_32bit );
-
-		libcnotify_printf(
-		 "%s: write count\t\t\t\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
-
-		libcnotify_printf(
-		 "%s: size\t\t\t\t\t: %" PRIu32 "\n",
-		 function,
-		 stored_size );
-
 		if( libfdatetime_nsf_timedate_copy_from_byte_stream(
 		     nsf_timedate,
-		     bucket_descriptor_block_header.modification_time,
+		     bucket_descriptor_block_footer.modification_time,
 		     8,
 		     LIBFDATETIME_ENDIAN_LITTLE,
 		     error ) != 1 )
@@ -4132,625 +4974,880 @@ int libnsfdb_io_handle_read_bucket_descriptor_block(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy nsf timedate to string.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy nsf timedate to string.",
+			 function );
+
+			goto on_error;
+		}
+		libcnotify_printf(
+		 "%s: modification time\t\t\t: %s\n",
+		 function,
+		 (char *) nsf_timedate_string );
+
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 stored_checksum );
+
+		libcnotify_printf(
+		 "\n" );
+
+		if( libfdatetime_nsf_timedate_free(
+		     &nsf_timedate,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free nsf timedate.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	/* TODO read and print trailing data */
+
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in bucket descriptor block checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_header.write_count,
+	 io_handle->bucket_descriptor_block_write_count );
+
+	io_handle->bucket_descriptor_block_checksum = stored_checksum;
+
+	if( compression_type != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression type.",
+		 function );
+
+		goto on_error;
+	}
+	/* TODO sanity check of uncompressed size
+	 */
+
+/*
+	uncompressed_size -= sizeof( nsfdb_bucket_descriptor_block_header_t )
+	                   + sizeof( nsfdb_bucket_descriptor_block_footer_t );
+*/
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 (size_t) uncompressed_size );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     uncompressed_data,
+	     0,
+	     uncompressed_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	/* TODO check first 4 bytes of 'compressed data' */
+	if( libnsfdb_compression_cx_decompress(
+	     uncompressed_data,
+	     uncompressed_size,
+	     &( compressed_data[ 4 ] ),
+	     stored_size - 4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress bucket descriptor block data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 compressed_data );
+
+	compressed_data = NULL;
+
+	/* TODO bucket descriptor block info */
+
+	bucket_descriptor_block_data = uncompressed_data;
+
+	if( number_of_rrv_bucket_descriptors > 0 )
+	{
+		/* TODO check if size is in range */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: RRV bucket descriptor data:\n",
+			 function );
+			libcnotify_print_data(
+			 bucket_descriptor_block_data,
+			 number_of_rrv_bucket_descriptors * 8,
+			 0 );
+		}
+#endif
+		if( libcdata_array_resize(
+		     io_handle->rrv_bucket_descriptors,
+		     number_of_rrv_bucket_descriptors,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_bucket_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize RRV bucket descriptors array.",
 			 function );
 
 			goto on_error;
 		}
-		libcnotify_printf(
-		 "%s: modification time\t\t\t: %s\n",
-		 function,
-		 (char *) nsf_timedate_string );
+		for( rrv_bucket_descriptor_iterator = 0;
+		     rrv_bucket_descriptor_iterator < number_of_rrv_bucket_descriptors;
+		     rrv_bucket_descriptor_iterator++ )
+		{
+			if( libnsfdb_rrv_bucket_descriptor_initialize(
+			     &rrv_bucket_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize RRV bucket descriptor.",
+				 function );
 
-		libcnotify_printf(
-		 "%s: number of unique name keys\t\t: %" PRIu32 "\n",
-		 function,
-		 number_of_unique_name_keys );
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 bucket_descriptor_block_data,
+			 rrv_bucket_descriptor->file_offset );
 
-		libcnotify_printf(
-		 "%s: unknown1:\n",
-		 function );
-		libcnotify_print_data(
-		 bucket_descriptor_block_header.unknown1,
-		 4,
-		 0 );
+			bucket_descriptor_block_data += 4;
+			uncompressed_size            -= 4;
 
-		libcnotify_printf(
-		 "%s: unique name key text size\t\t: %" PRIu32 "\n",
-		 function,
-		 unique_name_key_text_size );
+			byte_stream_copy_to_uint32_little_endian(
+			 bucket_descriptor_block_data,
+			 rrv_bucket_descriptor->initial_rrv_identifier );
 
-		libcnotify_printf(
-		 "%s: number of RRV bucket descriptors\t: %" PRIu32 "\n",
-		 function,
-		 number_of_rrv_bucket_descriptors );
+			bucket_descriptor_block_data += 4;
+			uncompressed_size            -= 4;
 
-		byte_stream_copy_to_uint32_little_endian(
-		 bucket_descriptor_block_header.number_of_unk_hash_table_entries,
-		 value_32bit );
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: %s RRV bucket descriptor: %03d file position: 0x%08" PRIx64 " (offset: 0x%06" PRIx64 "00), initial RRV: 0x%08" PRIx32 "\n",
+				 function,
+				 ( ( ( rrv_bucket_descriptor->file_offset & 0x00000001UL ) != 0 ) ? "non-data" : "data" ),
+				 rrv_bucket_descriptor_iterator,
+				 rrv_bucket_descriptor->file_offset & 0xfffffffeUL,
+				 rrv_bucket_descriptor->file_offset & 0xfffffffeUL,
+				 rrv_bucket_descriptor->initial_rrv_identifier );
+			}
+#endif
+			if( ( rrv_bucket_descriptor->file_offset & 0x00000001UL ) != 0 )
+			{
+				rrv_bucket_descriptor->file_offset -= 1;
+				rrv_bucket_descriptor->type         = LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA;
+			}
+			else
+			{
+				rrv_bucket_descriptor->type = LIBNSFDB_RRV_BUCKET_TYPE_DATA;
+			}
+			rrv_bucket_descriptor->file_offset <<= 8;
 
-		libcnotify_printf(
-		 "%s: number of UNK hash table entries\t: %" PRIu32 "\n",
-		 function,
-		 value_32bit );
+			if( libcdata_array_set_entry_by_index(
+			     io_handle->rrv_bucket_descriptors,
+			     (int) rrv_bucket_descriptor_iterator,
+			     (intptr_t *) rrv_bucket_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set RRV bucket descriptors array entry: %" PRIu32 ".",
+				 function,
+				 rrv_bucket_descriptor_iterator );
 
-		libcnotify_printf(
-		 "%s: unknown2:\n",
+				goto on_error;
+			}
+			rrv_bucket_descriptor = NULL;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+	}
+	read_count = libnsfdb_unique_name_key_table_read(
+	              io_handle->unique_name_key_table,
+	              bucket_descriptor_block_data,
+	              uncompressed_size,
+	              number_of_unique_name_keys,
+	              unique_name_key_text_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read UNK table.",
 		 function );
-		libcnotify_print_data(
-		 bucket_descriptor_block_header.unknown2,
-		 8,
-		 0 );
 
-		libcnotify_printf(
-		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 stored_checksum );
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	bucket_descriptor_block_data += read_count;
+	uncompressed_size            -= read_count;
 
+	if( libcnotify_verbose != 0 )
+	{
 		libcnotify_printf(
-		 "%s: unknown3:\n",
+		 "%s: (remaining) uncompressed data:\n",
 		 function );
 		libcnotify_print_data(
-		 bucket_descriptor_block_header.unknown3,
-		 8,
+		 bucket_descriptor_block_data,
+		 uncompressed_size,
 		 0 );
+	}
+#endif
+	memory_free(
+	 uncompressed_data );
 
-		if( libfdatetime_nsf_timedate_free(
-		     &nsf_timedate,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free nsf timedate.",
-			 function );
+	uncompressed_data = NULL;
 
-			goto on_error;
-		}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( nsf_timedate != NULL )
+	{
+		libfdatetime_nsf_timedate_free(
+		 &nsf_timedate,
+		 NULL );
 	}
 #endif
-	if( header_signature != 0x0001 )
+	if( rrv_bucket_descriptor != NULL )
+	{
+		libnsfdb_rrv_bucket_descriptor_free(
+		 &rrv_bucket_descriptor,
+		 NULL );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+}
+
+/* Reads the Record Relocation Vector (RRV) bucket
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_io_handle_read_rrv_bucket(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_vector_t *vector,
+     libfcache_cache_t *cache,
+     int element_index,
+     int element_file_index,
+     off64_t element_offset,
+     size64_t element_size,
+     uint32_t element_flags,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	libnsfdb_rrv_bucket_t *rrv_bucket = NULL;
+	static char *function             = "libnsfdb_io_handle_read_rrv_bucket";
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported bucket descriptor block signature.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( header_version != 0x0002 )
+	if( element_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported bucket descriptor block version.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libnsfdb_checksum_calculate_little_endian_xor32(
-	     &calculated_checksum,
-	     (uint8_t *) &bucket_descriptor_block_header,
-	     sizeof( nsfdb_bucket_descriptor_block_header_t ) - 12,
-	     0,
-	     error ) != 1 )
+	if( element_size > (size64_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to calculate XOR-32 checksum.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid element size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* Ignore the checksum itself
-	 */
-	if( libnsfdb_checksum_calculate_little_endian_xor32(
-	     &calculated_checksum,
-	     (uint8_t *) bucket_descriptor_block_header.unknown3,
-	     8,
-	     calculated_checksum,
+	if( element_size != io_handle->rrv_bucket_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element size value does not match RRV bucket size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_rrv_bucket_initialize(
+	     &rrv_bucket,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to calculate XOR-32 checksum.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create RRV bucket.",
 		 function );
 
 		goto on_error;
 	}
-	if( stored_checksum != calculated_checksum )
+	if( libnsfdb_rrv_bucket_read_file_io_handle(
+	     rrv_bucket,
+	     file_io_handle,
+	     element_offset,
+	     (size_t) element_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
-		 "%s: mismatch in bucket descriptor block header checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read RRV bucket at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 stored_checksum,
-		 calculated_checksum );
+		 element_offset,
+		 element_offset );
 
 		goto on_error;
 	}
-	if( stored_size > bucket_descriptor_block_size )
+	if( libfdata_vector_set_element_value_by_index(
+	     vector,
+	     (intptr_t *) file_io_handle,
+	     (libfdata_cache_t *) cache,
+	     element_index,
+	     (intptr_t *) rrv_bucket,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_bucket_free,
+	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: stored bucket descriptor block size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set RRV bucket as element value.",
 		 function );
 
 		goto on_error;
 	}
-	/* TODO check stored size with total */
-	stored_size -= (uint32_t) sizeof( nsfdb_bucket_descriptor_block_header_t )
-	             + (uint32_t) sizeof( nsfdb_bucket_descriptor_block_footer_t );
-
-	compressed_data = (uint8_t *) memory_allocate(
-	                               stored_size );
+	return( 1 );
 
-	if( compressed_data == NULL )
+on_error:
+	if( rrv_bucket != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create compressed data.",
-		 function );
-
-		goto on_error;
+		libnsfdb_rrv_bucket_free(
+		 &rrv_bucket,
+		 NULL );
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              compressed_data,
-	              stored_size,
-	              error );
+	return( -1 );
+}
 
-	if( read_count != (ssize_t) stored_size )
+/* Reads the bucket
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_io_handle_read_bucket(
+     intptr_t *data_handle LIBNSFDB_ATTRIBUTE_UNUSED,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_element_t *list_element,
+     libfcache_cache_t *cache,
+     int element_file_index,
+     off64_t element_offset,
+     size64_t element_size,
+     uint32_t element_flags,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	libnsfdb_bucket_t *bucket = NULL;
+	static char *function     = "libnsfdb_io_handle_read_bucket";
+
+	LIBNSFDB_UNREFERENCED_PARAMETER( data_handle )
+
+	if( element_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element offset value out of bounds.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: compressed data:\n",
-		 function );
-		libcnotify_print_data(
-		 compressed_data,
-		 stored_size,
-		 0 );
+		return( -1 );
 	}
-#endif
-	if( libnsfdb_checksum_calculate_little_endian_xor32(
-	     &calculated_checksum,
-	     compressed_data,
-	     stored_size,
-	     0,
+	if( libnsfdb_bucket_initialize(
+	     &bucket,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to calculate XOR-32 checksum.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bucket.",
 		 function );
 
 		goto on_error;
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              (uint8_t *) &bucket_descriptor_block_footer,
-	              sizeof( nsfdb_bucket_descriptor_block_footer_t ),
-	              error );
-
-	if( read_count != (ssize_t) sizeof( nsfdb_bucket_descriptor_block_footer_t ) )
+	if( libnsfdb_bucket_read(
+	     bucket,
+	     file_io_handle,
+	     element_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read bucket descriptor block footer.",
+		 "%s: unable to read bucket.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libfdata_list_element_set_element_value(
+	     list_element,
+	     (intptr_t *) file_io_handle,
+	     (libfdata_cache_t *) cache,
+	     (intptr_t *) bucket,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_bucket_free,
+	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: bucket descriptor block footer:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set bucket as element value.",
 		 function );
-		libcnotify_print_data(
-		 (uint8_t *) &bucket_descriptor_block_footer,
-		 sizeof( nsfdb_bucket_descriptor_block_footer_t ),
-		 0 );
+
+		goto on_error;
 	}
-#endif
-	byte_stream_copy_to_uint32_little_endian(
-	 bucket_descriptor_block_footer.checksum,
-	 stored_checksum );
+	return( 1 );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+on_error:
+	if( bucket != NULL )
 	{
-		if( libfdatetime_nsf_timedate_initialize(
-		     &nsf_timedate,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create nsf timedate.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfdatetime_nsf_timedate_copy_from_byte_stream(
-		     nsf_timedate,
-		     bucket_descriptor_block_footer.modification_time,
-		     8,
-		     LIBFDATETIME_ENDIAN_LITTLE,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy nsf timedate from byte stream.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfdatetime_nsf_timedate_copy_to_utf8_string(
-		     nsf_timedate,
-		     nsf_timedate_string,
-		     32,
-		     LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_MILLI_SECONDS,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy nsf timedate to string.",
-			 function );
-
-			goto on_error;
-		}
-		libcnotify_printf(
-		 "%s: modification time\t\t\t: %s\n",
-		 function,
-		 (char *) nsf_timedate_string );
-
-		libcnotify_printf(
-		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 stored_checksum );
-
-		libcnotify_printf(
-		 "\n" );
-
-		if( libfdatetime_nsf_timedate_free(
-		     &nsf_timedate,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free nsf timedate.",
-			 function );
-
-			goto on_error;
-		}
+		libnsfdb_bucket_free(
+		 &bucket,
+		 NULL );
 	}
-#endif
-	/* TODO read and print trailing data */
+	return( -1 );
+}
 
-	if( stored_checksum != calculated_checksum )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_INPUT,
-		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
-		 "%s: mismatch in bucket descriptor block checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
-		 function,
-		 stored_checksum,
-		 calculated_checksum );
+/* Reads the note index
+ * The note index contains the RRV values of all notes and is used to speed up note lookups
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_io_handle_read_note_index(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *summary_bucket_list,
+     libfcache_cache_t *summary_bucket_cache,
+     libcerror_error_t **error )
+{
+	libnsfdb_bucket_t *summary_bucket                       = NULL;
+	libnsfdb_bucket_slot_t *summary_bucket_slot             = NULL;
+	libnsfdb_note_index_t *note_index                       = NULL;
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	libnsfdb_rrv_bucket_t *rrv_bucket                       = NULL;
+	libnsfdb_rrv_value_t *rrv_value                         = NULL;
+	nsfdb_note_header_t *note_header                        = NULL;
+	static char *function                                   = "libnsfdb_io_handle_read_note_index";
+	uint64_t modification_time                              = 0;
+	uint32_t parent_note_identifier                         = 0;
+	uint16_t note_class                                     = 0;
+	uint16_t note_signature                                 = 0;
+	int number_of_rrv_bucket_descriptors                    = 0;
+	int number_of_rrv_bucket_values                         = 0;
+	int rrv_bucket_descriptor_index                         = 0;
+	int rrv_value_index                                     = 0;
 
-		goto on_error;
-	}
-	if( compression_type != 1 )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compression type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* TODO sanity check of uncompressed size
-	 */
-
-/*
-	uncompressed_size -= sizeof( nsfdb_bucket_descriptor_block_header_t )
-	                   + sizeof( nsfdb_bucket_descriptor_block_footer_t );
-*/
-
-	uncompressed_data = (uint8_t *) memory_allocate(
-	                                 (size_t) uncompressed_size );
-
-	if( uncompressed_data == NULL )
+	if( io_handle->note_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create uncompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - note index value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     uncompressed_data,
-	     0,
-	     uncompressed_size ) == NULL )
+	if( libnsfdb_note_index_initialize(
+	     &note_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear uncompressed data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create note index.",
 		 function );
 
 		goto on_error;
 	}
-	/* TODO check first 4 bytes of 'compressed data' */
-	if( libnsfdb_compression_cx_decompress(
-	     uncompressed_data,
-	     uncompressed_size,
-	     &( compressed_data[ 4 ] ),
-	     stored_size - 4,
+	if( libcdata_array_get_number_of_entries(
+	     io_handle->rrv_bucket_descriptors,
+	     &number_of_rrv_bucket_descriptors,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable to decompress bucket descriptor block data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of RRV bucket descriptors.",
 		 function );
 
 		goto on_error;
 	}
-	memory_free(
-	 compressed_data );
-
-	compressed_data = NULL;
-
-	/* TODO bucket descriptor block info */
+	for( rrv_bucket_descriptor_index = 0;
+	     rrv_bucket_descriptor_index < number_of_rrv_bucket_descriptors;
+	     rrv_bucket_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     io_handle->rrv_bucket_descriptors,
+		     rrv_bucket_descriptor_index,
+		     (intptr_t **) &rrv_bucket_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve RRV bucket descriptor: %d.",
+			 function,
+			 rrv_bucket_descriptor_index );
 
-	bucket_descriptor_block_data = uncompressed_data;
+			goto on_error;
+		}
+		if( rrv_bucket_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing RRV bucket descriptor: %d.",
+			 function,
+			 rrv_bucket_descriptor_index );
 
-	if( number_of_rrv_bucket_descriptors > 0 )
-	{
-		/* TODO check if size is in range */
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+			goto on_error;
+		}
+		if( libnsfdb_io_handle_get_rrv_bucket_at_offset(
+		     io_handle,
+		     file_io_handle,
+		     rrv_bucket_descriptor->file_offset,
+		     &rrv_bucket,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: RRV bucket descriptor data:\n",
-			 function );
-			libcnotify_print_data(
-			 bucket_descriptor_block_data,
-			 number_of_rrv_bucket_descriptors * 8,
-			 0 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve RRV bucket at offset: %" PRIi64 ".",
+			 function,
+			 rrv_bucket_descriptor->file_offset );
+
+			goto on_error;
 		}
-#endif
-		if( libcdata_array_resize(
-		     io_handle->rrv_bucket_descriptors,
-		     number_of_rrv_bucket_descriptors,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_bucket_descriptor_free,
+		if( libnsfdb_rrv_bucket_get_number_of_values(
+		     rrv_bucket,
+		     &number_of_rrv_bucket_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-			 "%s: unable to resize RRV bucket descriptors array.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to number of RRV values from bucket.",
 			 function );
 
 			goto on_error;
 		}
-		for( rrv_bucket_descriptor_iterator = 0;
-		     rrv_bucket_descriptor_iterator < number_of_rrv_bucket_descriptors;
-		     rrv_bucket_descriptor_iterator++ )
+		for( rrv_value_index = 0;
+		     rrv_value_index < number_of_rrv_bucket_values;
+		     rrv_value_index++ )
 		{
-			if( libnsfdb_rrv_bucket_descriptor_initialize(
-			     &rrv_bucket_descriptor,
+			if( libnsfdb_rrv_bucket_get_value_by_index(
+			     rrv_bucket,
+			     rrv_value_index,
+			     &rrv_value,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to initialize RRV bucket descriptor.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to RRV value: %d from bucket.",
+				 function,
+				 rrv_value_index );
 
 				goto on_error;
 			}
-			byte_stream_copy_to_uint32_little_endian(
-			 bucket_descriptor_block_data,
-			 rrv_bucket_descriptor->file_offset );
-
-			bucket_descriptor_block_data += 4;
-			uncompressed_size            -= 4;
-
-			byte_stream_copy_to_uint32_little_endian(
-			 bucket_descriptor_block_data,
-			 rrv_bucket_descriptor->initial_rrv_identifier );
-
-			bucket_descriptor_block_data += 4;
-			uncompressed_size            -= 4;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( rrv_value == NULL )
 			{
-				libcnotify_printf(
-				 "%s: %s RRV bucket descriptor: %03d file position: 0x%08" PRIx64 " (offset: 0x%06" PRIx64 "00), initial RRV: 0x%08" PRIx32 "\n",
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing RRV value: %d.",
 				 function,
-				 ( ( ( rrv_bucket_descriptor->file_offset & 0x00000001UL ) != 0 ) ? "non-data" : "data" ),
-				 rrv_bucket_descriptor_iterator,
-				 rrv_bucket_descriptor->file_offset & 0xfffffffeUL,
-				 rrv_bucket_descriptor->file_offset & 0xfffffffeUL,
-				 rrv_bucket_descriptor->initial_rrv_identifier );
-			}
-#endif
-			if( ( rrv_bucket_descriptor->file_offset & 0x00000001UL ) != 0 )
-			{
-				rrv_bucket_descriptor->file_offset -= 1;
-				rrv_bucket_descriptor->type         = LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA;
+				 rrv_value_index );
+
+				goto on_error;
 			}
-			else
+			note_class             = 0;
+			modification_time      = 0;
+			parent_note_identifier = 0;
+
+			/* The note class, modification time and parent note identifier are stored in the note header
+			 */
+			if( ( summary_bucket_list != NULL )
+			 && ( rrv_value->type == LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER ) )
 			{
-				rrv_bucket_descriptor->type = LIBNSFDB_RRV_BUCKET_TYPE_DATA;
-			}
-			rrv_bucket_descriptor->file_offset <<= 8;
+				if( libnsfdb_io_handle_get_bucket_by_index(
+				     io_handle,
+				     file_io_handle,
+				     summary_bucket_list,
+				     summary_bucket_cache,
+				     LIBNSFDB_CACHE_POOL_VALUE_TYPE_SUMMARY_BUCKET,
+				     rrv_value->bucket_index,
+				     &summary_bucket,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve summary bucket: %" PRIu32 ".",
+					 function,
+					 rrv_value->bucket_index );
 
-			if( libcdata_array_set_entry_by_index(
-			     io_handle->rrv_bucket_descriptors,
-			     (int) rrv_bucket_descriptor_iterator,
-			     (intptr_t *) rrv_bucket_descriptor,
+					goto on_error;
+				}
+				if( libnsfdb_bucket_get_slot(
+				     summary_bucket,
+				     (uint32_t) rrv_value->slot_index,
+				     &summary_bucket_slot,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve summary bucket: %" PRIu32 " slot: %" PRIu16 ".",
+					 function,
+					 rrv_value->bucket_index,
+					 rrv_value->slot_index );
+
+					goto on_error;
+				}
+				if( ( summary_bucket_slot != NULL )
+				 && ( summary_bucket_slot->data != NULL )
+				 && ( summary_bucket_slot->size >= sizeof( nsfdb_note_header_t ) ) )
+				{
+					note_header = (nsfdb_note_header_t *) summary_bucket_slot->data;
+
+					byte_stream_copy_to_uint16_little_endian(
+					 note_header->signature,
+					 note_signature );
+
+					if( note_signature == 0x0004 )
+					{
+						byte_stream_copy_to_uint16_little_endian(
+						 note_header->note_class,
+						 note_class );
+
+						byte_stream_copy_to_uint64_little_endian(
+						 note_header->modification_time,
+						 modification_time );
+
+						byte_stream_copy_to_uint32_little_endian(
+						 note_header->parent_note_identifier,
+						 parent_note_identifier );
+					}
+				}
+				if( libnsfdb_io_handle_release_bucket(
+				     io_handle,
+				     &summary_bucket,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release summary bucket: %" PRIu32 ".",
+					 function,
+					 rrv_value->bucket_index );
+
+					goto on_error;
+				}
+			}
+			if( libnsfdb_note_index_append_entry(
+			     note_index,
+			     rrv_value,
+			     rrv_bucket_descriptor->type,
+			     note_class,
+			     modification_time,
+			     parent_note_identifier,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set RRV bucket descriptors array entry: %" PRIu32 ".",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append note index entry: 0x%08" PRIx32 ".",
 				 function,
-				 rrv_bucket_descriptor_iterator );
+				 rrv_value->rrv_identifier );
 
 				goto on_error;
 			}
-			rrv_bucket_descriptor = NULL;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libnsfdb_io_handle_release_rrv_bucket(
+		     io_handle,
+		     &rrv_bucket,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-	}
-	read_count = libnsfdb_unique_name_key_table_read(
-	              io_handle->unique_name_key_table,
-	              bucket_descriptor_block_data,
-	              uncompressed_size,
-	              number_of_unique_name_keys,
-	              unique_name_key_text_size,
-	              error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release RRV bucket at offset: %" PRIi64 ".",
+			 function,
+			 rrv_bucket_descriptor->file_offset );
 
-	if( read_count < 0 )
+			goto on_error;
+		}
+	}
+	if( libnsfdb_note_index_finalize(
+	     note_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read UNK table.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to finalize note index.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	bucket_descriptor_block_data += read_count;
-	uncompressed_size            -= read_count;
-
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: (remaining) uncompressed data:\n",
-		 function );
-		libcnotify_print_data(
-		 bucket_descriptor_block_data,
-		 uncompressed_size,
-		 0 );
-	}
-#endif
-	memory_free(
-	 uncompressed_data );
-
-	uncompressed_data = NULL;
+	io_handle->note_index = note_index;
 
 	return( 1 );
 
 on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( nsf_timedate != NULL )
+	if( summary_bucket != NULL )
 	{
-		libfdatetime_nsf_timedate_free(
-		 &nsf_timedate,
+		libnsfdb_io_handle_release_bucket(
+		 io_handle,
+		 &summary_bucket,
 		 NULL );
 	}
-#endif
-	if( rrv_bucket_descriptor != NULL )
+	if( rrv_bucket != NULL )
 	{
-		libnsfdb_rrv_bucket_descriptor_free(
-		 &rrv_bucket_descriptor,
+		libnsfdb_io_handle_release_rrv_bucket(
+		 io_handle,
+		 &rrv_bucket,
 		 NULL );
 	}
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
-	if( compressed_data != NULL )
+	if( note_index != NULL )
 	{
-		memory_free(
-		 compressed_data );
+		libnsfdb_note_index_free(
+		 &note_index,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads the Record Relocation Vector (RRV) bucket
+/* Retrieves the RRV bucket at a specific offset
+ * The RRV bucket is read via the cache pool if the file uses one
+ * The RRV bucket must be released with libnsfdb_io_handle_release_rrv_bucket
  * Returns 1 if successful or -1 on error
  */
-int libnsfdb_io_handle_read_rrv_bucket(
+int libnsfdb_io_handle_get_rrv_bucket_at_offset(
      libnsfdb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *vector,
-     libfcache_cache_t *cache,
-     int element_index,
-     int element_file_index,
-     off64_t element_offset,
-     size64_t element_size,
-     uint32_t element_flags,
-     uint8_t read_flags,
+     off64_t file_offset,
+     libnsfdb_rrv_bucket_t **rrv_bucket,
      libcerror_error_t **error )
 {
-	libnsfdb_rrv_bucket_t *rrv_bucket = NULL;
-	uint8_t *rrv_bucket_data          = NULL;
-	static char *function             = "libnsfdb_io_handle_read_rrv_bucket";
-	ssize_t read_count                = 0;
+	libnsfdb_rrv_bucket_t *safe_rrv_bucket = NULL;
+	static char *function                  = "libnsfdb_io_handle_get_rrv_bucket_at_offset";
+	off64_t element_data_offset            = 0;
+	int result                             = 0;
 
 	if( io_handle == NULL )
 	{
@@ -4763,85 +5860,67 @@ int libnsfdb_io_handle_read_rrv_bucket(
 
 		return( -1 );
 	}
-	if( element_offset < 0 )
+	if( rrv_bucket == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid element offset value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( element_size > (size64_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid element size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RRV bucket.",
 		 function );
 
 		return( -1 );
 	}
-	if( element_size != io_handle->rrv_bucket_size )
+	if( io_handle->cache_pool == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid element size value does not match RRV bucket size.",
-		 function );
+		if( libfdata_vector_get_element_value_at_offset(
+		     io_handle->rrv_bucket_vector,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) io_handle->rrv_bucket_cache,
+		     file_offset,
+		     &element_data_offset,
+		     (intptr_t **) rrv_bucket,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve RRV bucket at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
 
-		return( -1 );
+			return( -1 );
+		}
+		return( 1 );
 	}
-	rrv_bucket_data = (uint8_t *) memory_allocate(
-	                               sizeof( uint8_t ) * (size_t) element_size );
+	result = libnsfdb_cache_pool_get_value(
+	          io_handle->cache_pool,
+	          io_handle->cache_pool_owner_identifier,
+	          LIBNSFDB_CACHE_POOL_VALUE_TYPE_RRV_BUCKET,
+	          file_offset,
+	          (intptr_t **) rrv_bucket,
+	          error );
 
-	if( rrv_bucket_data == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create RRV bucket data.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve RRV bucket at offset: %" PRIi64 " from cache pool.",
+		 function,
+		 file_offset );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading RRV bucket at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 element_offset,
-		 element_offset );
-	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              rrv_bucket_data,
-	              (size_t) element_size,
-	              element_offset,
-	              error );
-
-	if( read_count != (ssize_t) element_size )
+	else if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read RRV bucket data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 element_offset,
-		 element_offset );
-
-		goto on_error;
+		return( 1 );
 	}
 	if( libnsfdb_rrv_bucket_initialize(
-	     &rrv_bucket,
+	     &safe_rrv_bucket,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4853,95 +5932,239 @@ int libnsfdb_io_handle_read_rrv_bucket(
 
 		goto on_error;
 	}
-	if( libnsfdb_rrv_bucket_read(
-	     rrv_bucket,
-	     rrv_bucket_data,
-	     (size_t) element_size,
+	if( libnsfdb_rrv_bucket_read_file_io_handle(
+	     safe_rrv_bucket,
+	     file_io_handle,
+	     file_offset,
+	     (size_t) io_handle->rrv_bucket_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read RRV bucket.",
-		 function );
+		 "%s: unable to read RRV bucket at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
 
 		goto on_error;
 	}
-	memory_free(
-	 rrv_bucket_data );
-
-	rrv_bucket_data = NULL;
-
-	if( libfdata_vector_set_element_value_by_index(
-	     vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) cache,
-	     element_index,
-	     (intptr_t *) rrv_bucket,
+	if( libnsfdb_cache_pool_set_value(
+	     io_handle->cache_pool,
+	     io_handle->cache_pool_owner_identifier,
+	     LIBNSFDB_CACHE_POOL_VALUE_TYPE_RRV_BUCKET,
+	     file_offset,
+	     (intptr_t *) safe_rrv_bucket,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_bucket_free,
-	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+	     sizeof( libnsfdb_rrv_bucket_t ) + (size_t) io_handle->rrv_bucket_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set RRV bucket as element value.",
-		 function );
+		 "%s: unable to set RRV bucket at offset: %" PRIi64 " in cache pool.",
+		 function,
+		 file_offset );
 
 		goto on_error;
 	}
+	*rrv_bucket = safe_rrv_bucket;
+
 	return( 1 );
 
 on_error:
-	if( rrv_bucket != NULL )
+	if( safe_rrv_bucket != NULL )
 	{
 		libnsfdb_rrv_bucket_free(
-		 &rrv_bucket,
+		 &safe_rrv_bucket,
 		 NULL );
 	}
-	if( rrv_bucket_data != NULL )
+	return( -1 );
+}
+
+/* Releases a RRV bucket retrieved with libnsfdb_io_handle_get_rrv_bucket_at_offset
+ * A value in the cache pool is referenced while it is used, so that it is not evicted
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_io_handle_release_rrv_bucket(
+     libnsfdb_io_handle_t *io_handle,
+     libnsfdb_rrv_bucket_t **rrv_bucket,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_io_handle_release_rrv_bucket";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( rrv_bucket == NULL )
 	{
-		memory_free(
-		 rrv_bucket_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RRV bucket.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	if( ( io_handle->cache_pool != NULL )
+	 && ( *rrv_bucket != NULL ) )
+	{
+		if( libnsfdb_cache_pool_release_value(
+		     io_handle->cache_pool,
+		     (intptr_t *) *rrv_bucket,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release RRV bucket in cache pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*rrv_bucket = NULL;
+
+	return( 1 );
 }
 
-/* Reads the bucket
+/* Retrieves a specific summary or non summary bucket
+ * The bucket is read via the cache pool if the file uses one
+ * otherwise via the bucket cache
+ * The bucket must be released with libnsfdb_io_handle_release_bucket
+ * Buckets are numbered from 1 to N
  * Returns 1 if successful or -1 on error
  */
-int libnsfdb_io_handle_read_bucket(
-     intptr_t *data_handle LIBNSFDB_ATTRIBUTE_UNUSED,
+int libnsfdb_io_handle_get_bucket_by_index(
+     libnsfdb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *list_element,
-     libfcache_cache_t *cache,
-     int element_file_index,
-     off64_t element_offset,
-     size64_t element_size,
-     uint32_t element_flags,
-     uint8_t read_flags,
+     libfdata_list_t *bucket_list,
+     libfcache_cache_t *bucket_cache,
+     uint8_t value_type,
+     uint32_t bucket_index,
+     libnsfdb_bucket_t **bucket,
      libcerror_error_t **error )
 {
-	libnsfdb_bucket_t *bucket = NULL;
-	static char *function     = "libnsfdb_io_handle_read_bucket";
+	libnsfdb_bucket_t *safe_bucket = NULL;
+	static char *function          = "libnsfdb_io_handle_get_bucket_by_index";
+	size64_t element_size          = 0;
+	off64_t element_offset         = 0;
+	uint32_t element_flags         = 0;
+	int element_file_index         = 0;
+	int result                     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->cache_pool == NULL )
+	{
+		if( libnsfdb_bucket_list_get_bucket_by_index(
+		     bucket_list,
+		     file_io_handle,
+		     bucket_cache,
+		     bucket_index,
+		     bucket,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bucket: %" PRIu32 ".",
+			 function,
+			 bucket_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( bucket_index == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid bucket index value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_element_by_index(
+	     bucket_list,
+	     (int) bucket_index - 1,
+	     &element_file_index,
+	     &element_offset,
+	     &element_size,
+	     &element_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bucket: %" PRIu32 " list element.",
+		 function,
+		 bucket_index );
 
-	LIBNSFDB_UNREFERENCED_PARAMETER( data_handle )
+		goto on_error;
+	}
+	result = libnsfdb_cache_pool_get_value(
+	          io_handle->cache_pool,
+	          io_handle->cache_pool_owner_identifier,
+	          value_type,
+	          element_offset,
+	          (intptr_t **) bucket,
+	          error );
 
-	if( element_offset < 0 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid element offset value out of bounds.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bucket: %" PRIu32 " from cache pool.",
+		 function,
+		 bucket_index );
 
-		return( -1 );
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
 	}
 	if( libnsfdb_bucket_initialize(
-	     &bucket,
+	     &safe_bucket,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4954,7 +6177,7 @@ int libnsfdb_io_handle_read_bucket(
 		goto on_error;
 	}
 	if( libnsfdb_bucket_read(
-	     bucket,
+	     safe_bucket,
 	     file_io_handle,
 	     element_offset,
 	     error ) != 1 )
@@ -4963,41 +6186,101 @@ int libnsfdb_io_handle_read_bucket(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read bucket.",
-		 function );
+		 "%s: unable to read bucket: %" PRIu32 ".",
+		 function,
+		 bucket_index );
 
 		goto on_error;
 	}
-	if( libfdata_list_element_set_element_value(
-	     list_element,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) cache,
-	     (intptr_t *) bucket,
+	if( libnsfdb_cache_pool_set_value(
+	     io_handle->cache_pool,
+	     io_handle->cache_pool_owner_identifier,
+	     value_type,
+	     element_offset,
+	     (intptr_t *) safe_bucket,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_bucket_free,
-	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+	     sizeof( libnsfdb_bucket_t ) + (size_t) safe_bucket->data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set bucket as element value.",
-		 function );
+		 "%s: unable to set bucket: %" PRIu32 " in cache pool.",
+		 function,
+		 bucket_index );
 
 		goto on_error;
 	}
+	*bucket = safe_bucket;
+
 	return( 1 );
 
 on_error:
-	if( bucket != NULL )
+	if( safe_bucket != NULL )
 	{
 		libnsfdb_bucket_free(
-		 &bucket,
+		 &safe_bucket,
 		 NULL );
 	}
 	return( -1 );
 }
 
+/* Releases a bucket retrieved with libnsfdb_io_handle_get_bucket_by_index
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_io_handle_release_bucket(
+     libnsfdb_io_handle_t *io_handle,
+     libnsfdb_bucket_t **bucket,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_io_handle_release_bucket";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->cache_pool != NULL )
+	 && ( *bucket != NULL ) )
+	{
+		if( libnsfdb_cache_pool_release_value(
+		     io_handle->cache_pool,
+		     (intptr_t *) *bucket,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release bucket in cache pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*bucket = NULL;
+
+	return( 1 );
+}
+
 /* Retrieves the number of RRV values
  * Returns 1 if successful or -1 on error
  */
@@ -5011,7 +6294,6 @@ int libnsfdb_io_handle_get_number_of_rrv_values(
 	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
 	libnsfdb_rrv_bucket_t *rrv_bucket                       = NULL;
 	static char *function                                   = "libnsfdb_io_handle_get_number_of_rrv_values";
-	off64_t element_data_offset                             = 0;
 	int number_of_rrv_bucket_descriptors                    = 0;
 	int number_of_rrv_bucket_values                         = 0;
 	int rrv_bucket_descriptor_index                         = 0;
@@ -5053,6 +6335,26 @@ int libnsfdb_io_handle_get_number_of_rrv_values(
 	}
 	*number_of_rrv_values = 0;
 
+	if( io_handle->note_index != NULL )
+	{
+		if( libnsfdb_note_index_get_number_of_entries(
+		     io_handle->note_index,
+		     note_type,
+		     number_of_rrv_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of note index entries.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+
 	if( libcdata_array_get_number_of_entries(
 	     io_handle->rrv_bucket_descriptors,
 	     &number_of_rrv_bucket_descriptors,
@@ -5109,14 +6411,11 @@ int libnsfdb_io_handle_get_number_of_rrv_values(
 		{
 			continue;
 		}
-		if( libfdata_vector_get_element_value_at_offset(
-		     io_handle->rrv_bucket_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) io_handle->rrv_bucket_cache,
+		if( libnsfdb_io_handle_get_rrv_bucket_at_offset(
+		     io_handle,
+		     file_io_handle,
 		     rrv_bucket_descriptor->file_offset,
-		     &element_data_offset,
-		     (intptr_t **) &rrv_bucket,
-		     0,
+		     &rrv_bucket,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -5141,14 +6440,40 @@ int libnsfdb_io_handle_get_number_of_rrv_values(
 			 "%s: unable to number of RRV values from bucket.",
 			 function );
 
+			goto on_error;
+		}
+		if( libnsfdb_io_handle_release_rrv_bucket(
+		     io_handle,
+		     &rrv_bucket,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release RRV bucket at offset: %" PRIi64 ".",
+			 function,
+			 rrv_bucket_descriptor->file_offset );
+
 			return( -1 );
 		}
 		*number_of_rrv_values += number_of_rrv_bucket_values;
 	}
 	return( 1 );
+
+on_error:
+	if( rrv_bucket != NULL )
+	{
+		libnsfdb_io_handle_release_rrv_bucket(
+		 io_handle,
+		 &rrv_bucket,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves a specific RRV value
+ * The RRV value is copied since the RRV bucket it is stored in can be evicted from the cache
  * Returns 1 if successful or -1 on error
  */
 int libnsfdb_io_handle_get_rrv_value_by_index(
@@ -5156,13 +6481,14 @@ int libnsfdb_io_handle_get_rrv_value_by_index(
      libbfio_handle_t *file_io_handle,
      uint8_t note_type,
      int rrv_value_index,
-     libnsfdb_rrv_value_t **rrv_value,
+     libnsfdb_rrv_value_t *rrv_value,
      libcerror_error_t **error )
 {
 	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	libnsfdb_note_index_entry_t *note_index_entry           = NULL;
 	libnsfdb_rrv_bucket_t *rrv_bucket                       = NULL;
+	libnsfdb_rrv_value_t *bucket_rrv_value                  = NULL;
 	static char *function                                   = "libnsfdb_io_handle_get_rrv_value_by_index";
-	off64_t element_data_offset                             = 0;
 	int number_of_rrv_bucket_descriptors                    = 0;
 	int number_of_rrv_bucket_values                         = 0;
 	int rrv_bucket_descriptor_index                         = 0;
@@ -5202,6 +6528,52 @@ int libnsfdb_io_handle_get_rrv_value_by_index(
 
 		return( -1 );
 	}
+	if( rrv_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RRV value.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->note_index != NULL )
+	{
+		if( libnsfdb_note_index_get_entry_by_index(
+		     io_handle->note_index,
+		     note_type,
+		     rrv_value_index,
+		     &note_index_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve note index entry: %d.",
+			 function,
+			 rrv_value_index );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     rrv_value,
+		     &( note_index_entry->rrv_value ),
+		     sizeof( libnsfdb_rrv_value_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy RRV value.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     io_handle->rrv_bucket_descriptors,
 	     &number_of_rrv_bucket_descriptors,
@@ -5258,14 +6630,11 @@ int libnsfdb_io_handle_get_rrv_value_by_index(
 		{
 			continue;
 		}
-		if( libfdata_vector_get_element_value_at_offset(
-		     io_handle->rrv_bucket_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) io_handle->rrv_bucket_cache,
+		if( libnsfdb_io_handle_get_rrv_bucket_at_offset(
+		     io_handle,
+		     file_io_handle,
 		     rrv_bucket_descriptor->file_offset,
-		     &element_data_offset,
-		     (intptr_t **) &rrv_bucket,
-		     0,
+		     &rrv_bucket,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -5290,14 +6659,14 @@ int libnsfdb_io_handle_get_rrv_value_by_index(
 			 "%s: unable to number of RRV values from bucket.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( rrv_value_index < number_of_rrv_bucket_values )
 		{
 			if( libnsfdb_rrv_bucket_get_value_by_index(
 			     rrv_bucket,
 			     rrv_value_index,
-			     rrv_value,
+			     &bucket_rrv_value,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -5308,8 +6677,40 @@ int libnsfdb_io_handle_get_rrv_value_by_index(
 				 function,
 				 rrv_value_index );
 
-				return( -1 );
+				goto on_error;
+			}
+			if( memory_copy(
+			     rrv_value,
+			     bucket_rrv_value,
+			     sizeof( libnsfdb_rrv_value_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy RRV value.",
+				 function );
+
+				goto on_error;
 			}
+		}
+		if( libnsfdb_io_handle_release_rrv_bucket(
+		     io_handle,
+		     &rrv_bucket,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release RRV bucket at offset: %" PRIi64 ".",
+			 function,
+			 rrv_bucket_descriptor->file_offset );
+
+			return( -1 );
+		}
+		if( rrv_value_index < number_of_rrv_bucket_values )
+		{
 			break;
 		}
 		rrv_value_index -= number_of_rrv_bucket_values;
@@ -5326,9 +6727,20 @@ int libnsfdb_io_handle_get_rrv_value_by_index(
 		return( -1 );
 	}
 	return( 1 );
+
+on_error:
+	if( rrv_bucket != NULL )
+	{
+		libnsfdb_io_handle_release_rrv_bucket(
+		 io_handle,
+		 &rrv_bucket,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves a RRV value for a specific identifier
+ * The RRV value is copied since the RRV bucket it is stored in can be evicted from the cache
  * Returns 1 if successful, 0 if no RRV value was found or -1 on error
  */
 int libnsfdb_io_handle_get_rrv_value_by_identifier(
@@ -5336,14 +6748,15 @@ int libnsfdb_io_handle_get_rrv_value_by_identifier(
      libbfio_handle_t *file_io_handle,
      uint8_t note_type,
      uint32_t rrv_identifier,
-     libnsfdb_rrv_value_t **rrv_value,
+     libnsfdb_rrv_value_t *rrv_value,
      libcerror_error_t **error )
 {
 	libnsfdb_rrv_bucket_descriptor_t *last_rrv_bucket_descriptor = NULL;
 	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor      = NULL;
+	libnsfdb_note_index_entry_t *note_index_entry                = NULL;
 	libnsfdb_rrv_bucket_t *rrv_bucket                            = NULL;
+	libnsfdb_rrv_value_t *bucket_rrv_value                       = NULL;
 	static char *function                                        = "libnsfdb_io_handle_get_rrv_value_by_identifier";
-	off64_t element_data_offset                                  = 0;
 	int number_of_rrv_bucket_descriptors                         = 0;
 	int result                                                   = 0;
 	int rrv_bucket_descriptor_index                              = 0;
@@ -5372,6 +6785,57 @@ int libnsfdb_io_handle_get_rrv_value_by_identifier(
 
 		return( -1 );
 	}
+	if( rrv_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RRV value.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->note_index != NULL )
+	{
+		result = libnsfdb_note_index_get_entry_by_identifier(
+		          io_handle->note_index,
+		          note_type,
+		          rrv_identifier,
+		          &note_index_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve note index entry: 0x%08" PRIx32 ".",
+			 function,
+			 rrv_identifier );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( memory_copy(
+			     rrv_value,
+			     &( note_index_entry->rrv_value ),
+			     sizeof( libnsfdb_rrv_value_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy RRV value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( result );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     io_handle->rrv_bucket_descriptors,
 	     &number_of_rrv_bucket_descriptors,
@@ -5430,14 +6894,11 @@ int libnsfdb_io_handle_get_rrv_value_by_identifier(
 		}
 		if( rrv_identifier == rrv_bucket_descriptor->initial_rrv_identifier )
 		{
-			if( libfdata_vector_get_element_value_at_offset(
-			     io_handle->rrv_bucket_vector,
-			     (intptr_t *) file_io_handle,
-			     (libfdata_cache_t *) io_handle->rrv_bucket_cache,
+			if( libnsfdb_io_handle_get_rrv_bucket_at_offset(
+			     io_handle,
+			     file_io_handle,
 			     rrv_bucket_descriptor->file_offset,
-			     &element_data_offset,
-			     (intptr_t **) &rrv_bucket,
-			     0,
+			     &rrv_bucket,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -5465,14 +6926,11 @@ int libnsfdb_io_handle_get_rrv_value_by_identifier(
 
 				return( -1 );
 			}
-			if( libfdata_vector_get_element_value_at_offset(
-			     io_handle->rrv_bucket_vector,
-			     (intptr_t *) file_io_handle,
-			     (libfdata_cache_t *) io_handle->rrv_bucket_cache,
+			if( libnsfdb_io_handle_get_rrv_bucket_at_offset(
+			     io_handle,
+			     file_io_handle,
 			     last_rrv_bucket_descriptor->file_offset,
-			     &element_data_offset,
-			     (intptr_t **) &rrv_bucket,
-			     0,
+			     &rrv_bucket,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -5502,14 +6960,11 @@ int libnsfdb_io_handle_get_rrv_value_by_identifier(
 
 			return( -1 );
 		}
-		if( libfdata_vector_get_element_value_at_offset(
-		     io_handle->rrv_bucket_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) io_handle->rrv_bucket_cache,
+		if( libnsfdb_io_handle_get_rrv_bucket_at_offset(
+		     io_handle,
+		     file_io_handle,
 		     last_rrv_bucket_descriptor->file_offset,
-		     &element_data_offset,
-		     (intptr_t **) &rrv_bucket,
-		     0,
+		     &rrv_bucket,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -5528,7 +6983,7 @@ int libnsfdb_io_handle_get_rrv_value_by_identifier(
 		result = libnsfdb_rrv_bucket_get_value_by_identifier(
 			  rrv_bucket,
 			  rrv_identifier,
-			  rrv_value,
+			  &bucket_rrv_value,
 			  error );
 
 		if( result == -1 )
@@ -5541,9 +6996,50 @@ int libnsfdb_io_handle_get_rrv_value_by_identifier(
 			 function,
 			 rrv_identifier );
 
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( memory_copy(
+			     rrv_value,
+			     bucket_rrv_value,
+			     sizeof( libnsfdb_rrv_value_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy RRV value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libnsfdb_io_handle_release_rrv_bucket(
+		     io_handle,
+		     &rrv_bucket,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release RRV bucket.",
+			 function );
+
 			return( -1 );
 		}
 	}
 	return( result );
+
+on_error:
+	if( rrv_bucket != NULL )
+	{
+		libnsfdb_io_handle_release_rrv_bucket(
+		 io_handle,
+		 &rrv_bucket,
+		 NULL );
+	}
+	return( -1 );
 }
 
@@ -26,11 +26,14 @@
 #include <types.h>
 
 #include "libnsfdb_bucket.h"
+#include "libnsfdb_cache_pool.h"
 #include "libnsfdb_libbfio.h"
 #include "libnsfdb_libcdata.h"
 #include "libnsfdb_libcerror.h"
 #include "libnsfdb_libfcache.h"
 #include "libnsfdb_libfdata.h"
+#include "libnsfdb_note_index.h"
+#include "libnsfdb_rrv_bucket.h"
 #include "libnsfdb_rrv_value.h"
 
 #if defined( __cplusplus )
@@ -59,6 +62,23 @@ struct libnsfdb_io_handle
 	 */
 	libfcache_cache_t *rrv_bucket_cache;
 
+	/* The note index
+	 */
+	libnsfdb_note_index_t *note_index;
+
+	/* The recovered notes (array)
+	 * Contains RRV values of the bucket data of deleted notes
+	 */
+	libcdata_array_t *recovered_notes;
+
+	/* The cache pool
+	 */
+	libnsfdb_internal_cache_pool_t *cache_pool;
+
+	/* The owner identifier of the file in the cache pool
+	 */
+	uint32_t cache_pool_owner_identifier;
+
 	/* The format version
 	 */
 	uint32_t format_version;
@@ -90,6 +110,22 @@ struct libnsfdb_io_handle
 	/* The file size
 	 */
 	size64_t file_size;
+
+	/* The superblock write count
+	 */
+	uint32_t superblock_write_count;
+
+	/* The superblock checksum
+	 */
+	uint32_t superblock_checksum;
+
+	/* The bucket descriptor block write count
+	 */
+	uint32_t bucket_descriptor_block_write_count;
+
+	/* The bucket descriptor block checksum
+	 */
+	uint32_t bucket_descriptor_block_checksum;
 };
 
 int libnsfdb_io_handle_initialize(
@@ -104,6 +140,10 @@ int libnsfdb_io_handle_clear(
      libnsfdb_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libnsfdb_io_handle_clear_bucket_descriptor_block(
+     libnsfdb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
 int libnsfdb_io_handle_read_file_header(
      libnsfdb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -141,6 +181,24 @@ int libnsfdb_io_handle_read_superblock(
      libfcache_cache_t *non_summary_bucket_cache,
      libcerror_error_t **error );
 
+int libnsfdb_io_handle_read_superblock_key(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t superblock_offset,
+     uint32_t superblock_size,
+     uint32_t *superblock_write_count,
+     uint32_t *superblock_checksum,
+     libcerror_error_t **error );
+
+int libnsfdb_io_handle_read_bucket_descriptor_block_key(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t bucket_descriptor_block_offset,
+     uint32_t bucket_descriptor_block_size,
+     uint32_t *bucket_descriptor_block_write_count,
+     uint32_t *bucket_descriptor_block_checksum,
+     libcerror_error_t **error );
+
 int libnsfdb_io_handle_read_bucket_descriptor_block(
      libnsfdb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -173,6 +231,40 @@ int libnsfdb_io_handle_read_bucket(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+int libnsfdb_io_handle_read_note_index(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *summary_bucket_list,
+     libfcache_cache_t *summary_bucket_cache,
+     libcerror_error_t **error );
+
+int libnsfdb_io_handle_get_rrv_bucket_at_offset(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libnsfdb_rrv_bucket_t **rrv_bucket,
+     libcerror_error_t **error );
+
+int libnsfdb_io_handle_release_rrv_bucket(
+     libnsfdb_io_handle_t *io_handle,
+     libnsfdb_rrv_bucket_t **rrv_bucket,
+     libcerror_error_t **error );
+
+int libnsfdb_io_handle_get_bucket_by_index(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *bucket_list,
+     libfcache_cache_t *bucket_cache,
+     uint8_t value_type,
+     uint32_t bucket_index,
+     libnsfdb_bucket_t **bucket,
+     libcerror_error_t **error );
+
+int libnsfdb_io_handle_release_bucket(
+     libnsfdb_io_handle_t *io_handle,
+     libnsfdb_bucket_t **bucket,
+     libcerror_error_t **error );
+
 int libnsfdb_io_handle_get_number_of_rrv_values(
      libnsfdb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -185,7 +277,7 @@ int libnsfdb_io_handle_get_rrv_value_by_index(
      libbfio_handle_t *file_io_handle,
      uint8_t note_type,
      int rrv_value_index,
-     libnsfdb_rrv_value_t **rrv_value,
+     libnsfdb_rrv_value_t *rrv_value,
      libcerror_error_t **error );
 
 int libnsfdb_io_handle_get_rrv_value_by_identifier(
@@ -193,7 +285,7 @@ int libnsfdb_io_handle_get_rrv_value_by_identifier(
      libbfio_handle_t *file_io_handle,
      uint8_t note_type,
      uint32_t rrv_identifier,
-     libnsfdb_rrv_value_t **rrv_value,
+     libnsfdb_rrv_value_t *rrv_value,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -25,7 +25,6 @@
 #include <types.h>
 
 #include "libnsfdb_bucket.h"
-#include "libnsfdb_bucket_list.h"
 #include "libnsfdb_checksum.h"
 #include "libnsfdb_debug.h"
 #include "libnsfdb_definitions.h"
@@ -36,6 +35,7 @@
 #include "libnsfdb_libcnotify.h"
 #include "libnsfdb_libfdatetime.h"
 #include "libnsfdb_note.h"
+#include "libnsfdb_note_filter.h"
 #include "libnsfdb_note_item_class.h"
 #include "libnsfdb_note_value.h"
 #include "libnsfdb_rrv_value.h"
@@ -313,10 +313,12 @@ int libnsfdb_note_clone(
 }
 
 /* Reads the note
- * Returns 1 if successful or -1 on error
+ * If a note filter is provided the note header is matched against it before the note values are read
+ * Returns 1 if successful, 0 if the note does not match the note filter or -1 on error
  */
 int libnsfdb_note_read(
      libnsfdb_internal_note_t *internal_note,
+     libnsfdb_internal_note_filter_t *internal_note_filter,
      libcerror_error_t **error )
 {
 	libnsfdb_bucket_t *non_summary_bucket           = NULL;
@@ -329,17 +331,18 @@ int libnsfdb_note_read(
 	static char *function                           = "libnsfdb_note_read";
 	size_t note_data_size                           = 0;
 	uint32_t non_summary_data_identifier            = 0;
+	uint32_t non_summary_data_size                  = 0;
 	uint32_t note_size                              = 0;
 	uint16_t note_item_index                        = 0;
 	uint16_t note_signature                         = 0;
 	uint16_t number_of_note_items                   = 0;
+	int result                                      = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint8_t nsf_timedate_string[ 32 ];
 
 	libfdatetime_nsf_timedate_t *nsf_timedate       = NULL;
 	uint64_t value_64bit                            = 0;
-	uint32_t non_summary_data_size                  = 0;
 	uint32_t value_32bit                            = 0;
 	uint16_t value_16bit                            = 0;
 #endif
@@ -388,7 +391,8 @@ int libnsfdb_note_read(
 
 		return( -1 );
 	}
-	if( internal_note->rrv_value->type != LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER )
+	if( ( internal_note->rrv_value->type != LIBNSFDB_RRV_VALUE_TYPE_BUCKET_DATA_RANGE )
+	 && ( internal_note->rrv_value->type != LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -401,10 +405,12 @@ int libnsfdb_note_read(
 	}
 	if( internal_note->rrv_value->type == LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER )
 	{
-		if( libnsfdb_bucket_list_get_bucket_by_index(
-		     internal_note->summary_bucket_list,
+		if( libnsfdb_io_handle_get_bucket_by_index(
+		     internal_note->io_handle,
 		     internal_note->file_io_handle,
+		     internal_note->summary_bucket_list,
 		     internal_note->summary_bucket_cache,
+		     LIBNSFDB_CACHE_POOL_VALUE_TYPE_SUMMARY_BUCKET,
 		     internal_note->rrv_value->bucket_index,
 		     &summary_bucket,
 		     error ) != 1 )
@@ -450,6 +456,58 @@ int libnsfdb_note_read(
 		note_data      = summary_bucket_slot->data;
 		note_data_size = (size_t) summary_bucket_slot->size;
 	}
+	else if( internal_note->rrv_value->type == LIBNSFDB_RRV_VALUE_TYPE_BUCKET_DATA_RANGE )
+	{
+		/* The note was recovered from bucket data that is no longer referenced by a slot
+		 */
+		if( libnsfdb_io_handle_get_bucket_by_index(
+		     internal_note->io_handle,
+		     internal_note->file_io_handle,
+		     internal_note->summary_bucket_list,
+		     internal_note->summary_bucket_cache,
+		     LIBNSFDB_CACHE_POOL_VALUE_TYPE_SUMMARY_BUCKET,
+		     internal_note->rrv_value->bucket_index,
+		     &summary_bucket,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve summary bucket: %" PRIu32 ".",
+			 function,
+			 internal_note->rrv_value->bucket_index );
+
+			goto on_error;
+		}
+		if( summary_bucket == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing summary bucket: %" PRIu32 ".",
+			 function,
+			 internal_note->rrv_value->bucket_index );
+
+			goto on_error;
+		}
+		if( ( summary_bucket->data == NULL )
+		 || ( internal_note->rrv_value->data_offset > summary_bucket->data_size )
+		 || ( internal_note->rrv_value->data_size > ( summary_bucket->data_size - internal_note->rrv_value->data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid RRV value - bucket data range value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		note_data      = &( summary_bucket->data[ internal_note->rrv_value->data_offset ] );
+		note_data_size = (size_t) internal_note->rrv_value->data_size;
+	}
 	else if( internal_note->rrv_value->type == LIBNSFDB_RRV_VALUE_TYPE_FILE_POSITION )
 	{
 		if( note_data_size > (size_t) SSIZE_MAX )
@@ -506,10 +564,22 @@ int libnsfdb_note_read(
 	 ( (nsfdb_note_header_t *) note_data )->size,
 	 note_size );
 
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->sequence_number,
+	 internal_note->sequence_number );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->status_flags,
+	 internal_note->status_flags );
+
 	byte_stream_copy_to_uint16_little_endian(
 	 ( (nsfdb_note_header_t *) note_data )->note_class,
 	 internal_note->note_class );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->modification_time,
+	 internal_note->modification_time );
+
 	byte_stream_copy_to_uint16_little_endian(
 	 ( (nsfdb_note_header_t *) note_data )->number_of_note_items,
 	 number_of_note_items );
@@ -518,11 +588,13 @@ int libnsfdb_note_read(
 	 ( (nsfdb_note_header_t *) note_data )->non_summary_data_identifier,
 	 non_summary_data_identifier );
 
-#if defined( HAVE_DEBUG_OUTPUT )
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (nsfdb_note_header_t *) note_data )->non_summary_data_size,
 	 non_summary_data_size );
 
+	internal_note->size = (uint64_t) note_size + (uint64_t) non_summary_data_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		if( libfdatetime_nsf_timedate_initialize(
@@ -964,6 +1036,51 @@ int libnsfdb_note_read(
 
 		goto on_error;
 	}
+	internal_note->header_is_read = 1;
+
+	/* The note filter is matched before the note items are read
+	 * so that the notes that are not wanted are not decoded
+	 */
+	if( internal_note_filter != NULL )
+	{
+		result = libnsfdb_note_filter_match_values(
+		          internal_note_filter,
+		          internal_note->note_class,
+		          internal_note->status_flags,
+		          internal_note->modification_time,
+		          internal_note->size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match note filter.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libnsfdb_io_handle_release_bucket(
+			     internal_note->io_handle,
+			     &summary_bucket,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release summary bucket.",
+				 function );
+
+				goto on_error;
+			}
+			return( 0 );
+		}
+	}
 	note_data      += sizeof( nsfdb_note_header_t );
 	note_data_size -= sizeof( nsfdb_note_header_t );
 
@@ -1054,10 +1171,12 @@ int libnsfdb_note_read(
 		if( ( non_summary_data_identifier != 0 )
 		 && ( ( non_summary_data_identifier & 0x80000000UL ) != 0 ) )
 		{
-			if( libnsfdb_bucket_list_get_bucket_by_index(
-			     internal_note->non_summary_bucket_list,
+			if( libnsfdb_io_handle_get_bucket_by_index(
+			     internal_note->io_handle,
 			     internal_note->file_io_handle,
+			     internal_note->non_summary_bucket_list,
 			     internal_note->non_summary_bucket_cache,
+			     LIBNSFDB_CACHE_POOL_VALUE_TYPE_NON_SUMMARY_BUCKET,
 			     non_summary_data_identifier & 0x00ffffffUL,
 			     &non_summary_bucket,
 			     error ) != 1 )
@@ -1303,6 +1422,34 @@ int libnsfdb_note_read(
 		}
 	}
 #endif
+	if( libnsfdb_io_handle_release_bucket(
+	     internal_note->io_handle,
+	     &non_summary_bucket,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release non-summary bucket.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_io_handle_release_bucket(
+	     internal_note->io_handle,
+	     &summary_bucket,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release summary bucket.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -1320,6 +1467,20 @@ on_error:
 		 &note_value,
 		 NULL );
 	}
+	if( non_summary_bucket != NULL )
+	{
+		libnsfdb_io_handle_release_bucket(
+		 internal_note->io_handle,
+		 &non_summary_bucket,
+		 NULL );
+	}
+	if( summary_bucket != NULL )
+	{
+		libnsfdb_io_handle_release_bucket(
+		 internal_note->io_handle,
+		 &summary_bucket,
+		 NULL );
+	}
 	return( -1 );
 }
 
@@ -1351,6 +1512,7 @@ int libnsfdb_note_get_number_of_values(
 	{
 		if( libnsfdb_note_read(
 		     internal_note,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1380,3 +1542,956 @@ int libnsfdb_note_get_number_of_values(
 	return( 1 );
 }
 
+/* Retrieves a specific value
+ * The values are read if this was not done before
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_value_by_index(
+     libnsfdb_internal_note_t *internal_note,
+     int value_index,
+     libnsfdb_note_value_t **note_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_note_get_value_by_index";
+
+	if( internal_note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_note->values == NULL )
+	{
+		if( libnsfdb_note_read(
+		     internal_note,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read note.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_note->values,
+	     value_index,
+	     (intptr_t **) note_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	if( *note_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing value: %d.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the unique name key of a specific value
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_value_unique_name_key(
+     libnsfdb_internal_note_t *internal_note,
+     int value_index,
+     libnsfdb_unique_name_key_t **unique_name_key,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_value_t *note_value = NULL;
+	static char *function             = "libnsfdb_note_get_value_unique_name_key";
+
+	if( internal_note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_note->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid note - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( unique_name_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unique name key.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_value_by_index(
+	     internal_note,
+	     value_index,
+	     &note_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_note->io_handle->unique_name_key_table,
+	     (int) note_value->unk_table_index,
+	     (intptr_t **) unique_name_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unique name key: %" PRIu16 ".",
+		 function,
+		 note_value->unk_table_index );
+
+		return( -1 );
+	}
+	if( ( *unique_name_key == NULL )
+	 || ( ( *unique_name_key )->name == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing unique name key: %" PRIu16 ".",
+		 function,
+		 note_value->unk_table_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the name of a specific value
+ * The name is retrieved from the unique name key (UNK) table
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_value_name_size(
+     libnsfdb_note_t *note,
+     int value_index,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_unique_name_key_t *unique_name_key = NULL;
+	static char *function                       = "libnsfdb_note_get_value_name_size";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_value_unique_name_key(
+	     (libnsfdb_internal_note_t *) note,
+	     value_index,
+	     &unique_name_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unique name key of value: %d.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	*name_size = unique_name_key->name_size;
+
+	return( 1 );
+}
+
+/* Retrieves the name of a specific value
+ * The name is retrieved from the unique name key (UNK) table
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_value_name(
+     libnsfdb_note_t *note,
+     int value_index,
+     uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_unique_name_key_t *unique_name_key = NULL;
+	static char *function                       = "libnsfdb_note_get_value_name";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_value_unique_name_key(
+	     (libnsfdb_internal_note_t *) note,
+	     value_index,
+	     &unique_name_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unique name key of value: %d.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	if( name_size < unique_name_key->name_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid name size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     name,
+	     unique_name_key->name,
+	     unique_name_key->name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data size of a specific value
+ * The data starts with a 16-bit type value of which the upper byte contains the note item class
+ * Only the data of the summary items is available, for other items the data size is 0
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_value_data_size(
+     libnsfdb_note_t *note,
+     int value_index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_value_t *note_value = NULL;
+	static char *function             = "libnsfdb_note_get_value_data_size";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_value_by_index(
+	     (libnsfdb_internal_note_t *) note,
+	     value_index,
+	     &note_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	if( note_value->data == NULL )
+	{
+		*data_size = 0;
+	}
+	else
+	{
+		*data_size = (size_t) note_value->data_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a specific value
+ * The data starts with a 16-bit type value of which the upper byte contains the note item class
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_value_data(
+     libnsfdb_note_t *note,
+     int value_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_value_t *note_value = NULL;
+	static char *function             = "libnsfdb_note_get_value_data";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_value_by_index(
+	     (libnsfdb_internal_note_t *) note,
+	     value_index,
+	     &note_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	if( note_value->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid value: %d - missing data.",
+		 function,
+		 value_index );
+
+		return( -1 );
+	}
+	if( data_size < (size_t) note_value->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     note_value->data,
+	     (size_t) note_value->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the note identifier
+ * The note identifier is the RRV identifier of the note
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_identifier(
+     libnsfdb_note_t *note,
+     uint32_t *note_identifier,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_t *internal_note = NULL;
+	static char *function                   = "libnsfdb_note_get_identifier";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note = (libnsfdb_internal_note_t *) note;
+
+	if( internal_note->rrv_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid note - missing RRV value.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*note_identifier = internal_note->rrv_value->rrv_identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the sequence number
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_sequence_number(
+     libnsfdb_note_t *note,
+     uint32_t *sequence_number,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_t *internal_note = NULL;
+	static char *function                   = "libnsfdb_note_get_sequence_number";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note = (libnsfdb_internal_note_t *) note;
+
+	if( sequence_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_note->header_is_read == 0 )
+	{
+		if( libnsfdb_note_read(
+		     internal_note,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read note.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*sequence_number = internal_note->sequence_number;
+
+	return( 1 );
+}
+
+/* Retrieves the modification time
+ * The modification time is a 64-bit NSF timedate value
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_modification_time(
+     libnsfdb_note_t *note,
+     uint64_t *modification_time,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_t *internal_note = NULL;
+	static char *function                   = "libnsfdb_note_get_modification_time";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note = (libnsfdb_internal_note_t *) note;
+
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_note->header_is_read == 0 )
+	{
+		if( libnsfdb_note_read(
+		     internal_note,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read note.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*modification_time = internal_note->modification_time;
+
+	return( 1 );
+}
+
+/* Retrieves the note class
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_note_class(
+     libnsfdb_note_t *note,
+     uint16_t *note_class,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_t *internal_note = NULL;
+	static char *function                   = "libnsfdb_note_get_note_class";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note = (libnsfdb_internal_note_t *) note;
+
+	if( note_class == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note class.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_note->header_is_read == 0 )
+	{
+		if( libnsfdb_note_read(
+		     internal_note,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read note.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*note_class = internal_note->note_class;
+
+	return( 1 );
+}
+
+/* Retrieves the status flags
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_status_flags(
+     libnsfdb_note_t *note,
+     uint16_t *status_flags,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_t *internal_note = NULL;
+	static char *function                   = "libnsfdb_note_get_status_flags";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note = (libnsfdb_internal_note_t *) note;
+
+	if( status_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_note->header_is_read == 0 )
+	{
+		if( libnsfdb_note_read(
+		     internal_note,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read note.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*status_flags = internal_note->status_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the size
+ * The size contains both the summary and non-summary data of the note
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_get_size(
+     libnsfdb_note_t *note,
+     uint64_t *size,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_t *internal_note = NULL;
+	static char *function                   = "libnsfdb_note_get_size";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note = (libnsfdb_internal_note_t *) note;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_note->header_is_read == 0 )
+	{
+		if( libnsfdb_note_read(
+		     internal_note,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read note.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*size = internal_note->size;
+
+	return( 1 );
+}
+
+/* Determines if the note was recovered
+ * A recovered note was carved from summary bucket data that is no longer referenced
+ * by a RRV value, hence its non-summary data could have been reused by another note
+ * Returns 1 if the note was recovered, 0 if not or -1 on error
+ */
+int libnsfdb_note_is_recovered(
+     libnsfdb_note_t *note,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_t *internal_note = NULL;
+	static char *function                   = "libnsfdb_note_is_recovered";
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note = (libnsfdb_internal_note_t *) note;
+
+	if( internal_note->rrv_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid note - missing RRV value.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_note->rrv_value->type == LIBNSFDB_RRV_VALUE_TYPE_BUCKET_DATA_RANGE )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines if the note matches a note filter
+ * If the note was not read before the note values are only read when the note header matches
+ * Returns 1 if the note matches, 0 if not or -1 on error
+ */
+int libnsfdb_note_match_filter(
+     libnsfdb_note_t *note,
+     libnsfdb_note_filter_t *note_filter,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_t *internal_note = NULL;
+	static char *function                   = "libnsfdb_note_match_filter";
+	int result                              = 0;
+
+	if( note == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note = (libnsfdb_internal_note_t *) note;
+
+	if( note_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_note->header_is_read == 0 )
+	{
+		result = libnsfdb_note_read(
+		          internal_note,
+		          (libnsfdb_internal_note_filter_t *) note_filter,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read note.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		result = libnsfdb_note_filter_match_values(
+		          (libnsfdb_internal_note_filter_t *) note_filter,
+		          internal_note->note_class,
+		          internal_note->status_flags,
+		          internal_note->modification_time,
+		          internal_note->size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match note filter.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
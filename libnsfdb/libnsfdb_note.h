@@ -32,8 +32,11 @@
 #include "libnsfdb_libcerror.h"
 #include "libnsfdb_libfcache.h"
 #include "libnsfdb_libfdata.h"
+#include "libnsfdb_note_filter.h"
+#include "libnsfdb_note_value.h"
 #include "libnsfdb_rrv_value.h"
 #include "libnsfdb_types.h"
+#include "libnsfdb_unique_name_key.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -71,10 +74,30 @@ struct libnsfdb_internal_note
 	 */
 	libfcache_cache_t *non_summary_bucket_cache;
 
+	/* Value to indicate the note header was read
+	 */
+	uint8_t header_is_read;
+
+	/* The status flags
+	 */
+	uint16_t status_flags;
+
 	/* The note class
 	 */
 	uint16_t note_class;
 
+	/* The sequence number
+	 */
+	uint32_t sequence_number;
+
+	/* The modification time
+	 */
+	uint64_t modification_time;
+
+	/* The size of the summary and non-summary data
+	 */
+	uint64_t size;
+
 	/* The values (array)
 	 */
 	libcdata_array_t *values;
@@ -110,6 +133,96 @@ int libnsfdb_note_get_number_of_values(
 
 int libnsfdb_note_read(
      libnsfdb_internal_note_t *internal_note,
+     libnsfdb_internal_note_filter_t *internal_note_filter,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_match_filter(
+     libnsfdb_note_t *note,
+     libnsfdb_note_filter_t *note_filter,
+     libcerror_error_t **error );
+
+int libnsfdb_note_get_value_by_index(
+     libnsfdb_internal_note_t *internal_note,
+     int value_index,
+     libnsfdb_note_value_t **note_value,
+     libcerror_error_t **error );
+
+int libnsfdb_note_get_value_unique_name_key(
+     libnsfdb_internal_note_t *internal_note,
+     int value_index,
+     libnsfdb_unique_name_key_t **unique_name_key,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_get_value_name_size(
+     libnsfdb_note_t *note,
+     int value_index,
+     size_t *name_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_get_value_name(
+     libnsfdb_note_t *note,
+     int value_index,
+     uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_get_value_data_size(
+     libnsfdb_note_t *note,
+     int value_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_get_value_data(
+     libnsfdb_note_t *note,
+     int value_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_get_identifier(
+     libnsfdb_note_t *note,
+     uint32_t *note_identifier,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_get_sequence_number(
+     libnsfdb_note_t *note,
+     uint32_t *sequence_number,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_get_modification_time(
+     libnsfdb_note_t *note,
+     uint64_t *modification_time,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_get_note_class(
+     libnsfdb_note_t *note,
+     uint16_t *note_class,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_get_status_flags(
+     libnsfdb_note_t *note,
+     uint16_t *status_flags,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_get_size(
+     libnsfdb_note_t *note,
+     uint64_t *size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_is_recovered(
+     libnsfdb_note_t *note,
      libcerror_error_t **error );
 
 /* Retrieves the number of values
@@ -0,0 +1,357 @@
+/*
+ * Note filter functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_note_filter.h"
+#include "libnsfdb_types.h"
+
+/* Creates a note filter
+ * By default the note filter matches all notes
+ * Make sure the value note_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_filter_initialize(
+     libnsfdb_note_filter_t **note_filter,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_filter_t *internal_note_filter = NULL;
+	static char *function                                 = "libnsfdb_note_filter_initialize";
+
+	if( note_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *note_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid note filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note_filter = memory_allocate_structure(
+	                        libnsfdb_internal_note_filter_t );
+
+	if( internal_note_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create note filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_note_filter,
+	     0,
+	     sizeof( libnsfdb_internal_note_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear note filter.",
+		 function );
+
+		goto on_error;
+	}
+	*note_filter = (libnsfdb_note_filter_t *) internal_note_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_note_filter != NULL )
+	{
+		memory_free(
+		 internal_note_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a note filter
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_filter_free(
+     libnsfdb_note_filter_t **note_filter,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_filter_t *internal_note_filter = NULL;
+	static char *function                                 = "libnsfdb_note_filter_free";
+
+	if( note_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *note_filter != NULL )
+	{
+		internal_note_filter = (libnsfdb_internal_note_filter_t *) *note_filter;
+		*note_filter         = NULL;
+
+		memory_free(
+		 internal_note_filter );
+	}
+	return( 1 );
+}
+
+/* Sets the note class mask
+ * A note matches if its note class contains one of the note classes in the mask
+ * A mask of 0 matches all note classes
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_filter_set_note_class_mask(
+     libnsfdb_note_filter_t *note_filter,
+     uint16_t note_class_mask,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_filter_t *internal_note_filter = NULL;
+	static char *function                                 = "libnsfdb_note_filter_set_note_class_mask";
+
+	if( note_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note_filter = (libnsfdb_internal_note_filter_t *) note_filter;
+
+	internal_note_filter->note_class_mask = note_class_mask;
+
+	return( 1 );
+}
+
+/* Sets the status flags
+ * A note matches if its status flags masked with the status flags mask equal the status flags
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_filter_set_status_flags(
+     libnsfdb_note_filter_t *note_filter,
+     uint16_t status_flags_mask,
+     uint16_t status_flags,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_filter_t *internal_note_filter = NULL;
+	static char *function                                 = "libnsfdb_note_filter_set_status_flags";
+
+	if( note_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note_filter = (libnsfdb_internal_note_filter_t *) note_filter;
+
+	if( ( status_flags & ~( status_flags_mask ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported status flags - not part of status flags mask.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note_filter->status_flags_mask = status_flags_mask;
+	internal_note_filter->status_flags      = status_flags;
+
+	return( 1 );
+}
+
+/* Sets the modification time range
+ * The modification times are 64-bit NSF timedate values and the range includes both values
+ * The time zone information in the upper 8 bits of the values is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_filter_set_modification_time_range(
+     libnsfdb_note_filter_t *note_filter,
+     uint64_t first_modification_time,
+     uint64_t last_modification_time,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_filter_t *internal_note_filter = NULL;
+	static char *function                                 = "libnsfdb_note_filter_set_modification_time_range";
+
+	if( note_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note_filter = (libnsfdb_internal_note_filter_t *) note_filter;
+
+	first_modification_time &= 0x00ffffffffffffffULL;
+	last_modification_time  &= 0x00ffffffffffffffULL;
+
+	if( first_modification_time > last_modification_time )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first modification time value exceeds last modification time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note_filter->first_modification_time     = first_modification_time;
+	internal_note_filter->last_modification_time      = last_modification_time;
+	internal_note_filter->has_modification_time_range = 1;
+
+	return( 1 );
+}
+
+/* Sets the size range
+ * The size of a note consists of the size of its summary and non-summary data
+ * and the range includes both values
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_filter_set_size_range(
+     libnsfdb_note_filter_t *note_filter,
+     uint64_t minimum_size,
+     uint64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_filter_t *internal_note_filter = NULL;
+	static char *function                                 = "libnsfdb_note_filter_set_size_range";
+
+	if( note_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note_filter = (libnsfdb_internal_note_filter_t *) note_filter;
+
+	if( minimum_size > maximum_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum size value exceeds maximum size.",
+		 function );
+
+		return( -1 );
+	}
+	internal_note_filter->minimum_size   = minimum_size;
+	internal_note_filter->maximum_size   = maximum_size;
+	internal_note_filter->has_size_range = 1;
+
+	return( 1 );
+}
+
+/* Determines if the values of a note header match the note filter
+ * Returns 1 if the values match, 0 if not or -1 on error
+ */
+int libnsfdb_note_filter_match_values(
+     libnsfdb_internal_note_filter_t *internal_note_filter,
+     uint16_t note_class,
+     uint16_t status_flags,
+     uint64_t modification_time,
+     uint64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_note_filter_match_values";
+
+	if( internal_note_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_note_filter->note_class_mask != 0 )
+	 && ( ( note_class & internal_note_filter->note_class_mask ) == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( status_flags & internal_note_filter->status_flags_mask ) != internal_note_filter->status_flags )
+	{
+		return( 0 );
+	}
+	if( internal_note_filter->has_modification_time_range != 0 )
+	{
+		modification_time &= 0x00ffffffffffffffULL;
+
+		if( ( modification_time < internal_note_filter->first_modification_time )
+		 || ( modification_time > internal_note_filter->last_modification_time ) )
+		{
+			return( 0 );
+		}
+	}
+	if( internal_note_filter->has_size_range != 0 )
+	{
+		if( ( size < internal_note_filter->minimum_size )
+		 || ( size > internal_note_filter->maximum_size ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,127 @@
+/*
+ * Note filter functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_NOTE_FILTER_H )
+#define _LIBNSFDB_NOTE_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_extern.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_internal_note_filter libnsfdb_internal_note_filter_t;
+
+struct libnsfdb_internal_note_filter
+{
+	/* The note class mask, 0 represents all note classes
+	 */
+	uint16_t note_class_mask;
+
+	/* The status flags mask
+	 */
+	uint16_t status_flags_mask;
+
+	/* The status flags
+	 */
+	uint16_t status_flags;
+
+	/* Value to indicate the modification time range is set
+	 */
+	uint8_t has_modification_time_range;
+
+	/* The first modification time
+	 */
+	uint64_t first_modification_time;
+
+	/* The last modification time
+	 */
+	uint64_t last_modification_time;
+
+	/* Value to indicate the size range is set
+	 */
+	uint8_t has_size_range;
+
+	/* The minimum size
+	 */
+	uint64_t minimum_size;
+
+	/* The maximum size
+	 */
+	uint64_t maximum_size;
+};
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_filter_initialize(
+     libnsfdb_note_filter_t **note_filter,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_filter_free(
+     libnsfdb_note_filter_t **note_filter,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_filter_set_note_class_mask(
+     libnsfdb_note_filter_t *note_filter,
+     uint16_t note_class_mask,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_filter_set_status_flags(
+     libnsfdb_note_filter_t *note_filter,
+     uint16_t status_flags_mask,
+     uint16_t status_flags,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_filter_set_modification_time_range(
+     libnsfdb_note_filter_t *note_filter,
+     uint64_t first_modification_time,
+     uint64_t last_modification_time,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_note_filter_set_size_range(
+     libnsfdb_note_filter_t *note_filter,
+     uint64_t minimum_size,
+     uint64_t maximum_size,
+     libcerror_error_t **error );
+
+int libnsfdb_note_filter_match_values(
+     libnsfdb_internal_note_filter_t *internal_note_filter,
+     uint16_t note_class,
+     uint16_t status_flags,
+     uint64_t modification_time,
+     uint64_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_NOTE_FILTER_H ) */
+
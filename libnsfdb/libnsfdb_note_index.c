@@ -0,0 +1,1680 @@
+/*
+ * Note index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_definitions.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_note_index.h"
+#include "libnsfdb_rrv_bucket_descriptor.h"
+#include "libnsfdb_rrv_value.h"
+
+/* Creates a note index
+ * Make sure the value note_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_initialize(
+     libnsfdb_note_index_t **note_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_note_index_initialize";
+
+	if( note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *note_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid note index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*note_index = memory_allocate_structure(
+	               libnsfdb_note_index_t );
+
+	if( *note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create note index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *note_index,
+	     0,
+	     sizeof( libnsfdb_note_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear note index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *note_index != NULL )
+	{
+		memory_free(
+		 *note_index );
+
+		*note_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a note index
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_free(
+     libnsfdb_note_index_t **note_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_note_index_free";
+
+	if( note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *note_index != NULL )
+	{
+		if( ( *note_index )->response_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *note_index )->response_entry_indexes );
+		}
+		if( ( *note_index )->response_entry_offsets != NULL )
+		{
+			memory_free(
+			 ( *note_index )->response_entry_offsets );
+		}
+		if( ( *note_index )->root_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *note_index )->root_entry_indexes );
+		}
+		if( ( *note_index )->parent_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *note_index )->parent_entry_indexes );
+		}
+		if( ( *note_index )->modification_time_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *note_index )->modification_time_entry_indexes );
+		}
+		if( ( *note_index )->sorted_lookup_keys != NULL )
+		{
+			memory_free(
+			 ( *note_index )->sorted_lookup_keys );
+		}
+		if( ( *note_index )->non_data_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *note_index )->non_data_entry_indexes );
+		}
+		if( ( *note_index )->data_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *note_index )->data_entry_indexes );
+		}
+		if( ( *note_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *note_index )->entries );
+		}
+		memory_free(
+		 *note_index );
+
+		*note_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an entry to the note index
+ * The note index must be finalized after the last entry was appended
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_append_entry(
+     libnsfdb_note_index_t *note_index,
+     const libnsfdb_rrv_value_t *rrv_value,
+     uint8_t note_type,
+     uint16_t note_class,
+     uint64_t modification_time,
+     uint32_t parent_note_identifier,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_index_entry_t *entry = NULL;
+	void *reallocation                 = NULL;
+	static char *function              = "libnsfdb_note_index_append_entry";
+	size_t entries_size                = 0;
+	int number_of_allocated_entries    = 0;
+
+	if( note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( rrv_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RRV value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( note_type != LIBNSFDB_RRV_BUCKET_TYPE_DATA )
+	 && ( note_type != LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported note type.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index->sorted_lookup_keys != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid note index - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index->number_of_entries >= note_index->number_of_allocated_entries )
+	{
+		if( note_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 1024;
+		}
+		else
+		{
+			number_of_allocated_entries = note_index->number_of_allocated_entries * 2;
+		}
+		if( number_of_allocated_entries <= note_index->number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libnsfdb_note_index_entry_t ) * (size_t) number_of_allocated_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                note_index->entries,
+		                entries_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		note_index->entries                     = (libnsfdb_note_index_entry_t *) reallocation;
+		note_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry = &( note_index->entries[ note_index->number_of_entries ] );
+
+	if( memory_copy(
+	     &( entry->rrv_value ),
+	     rrv_value,
+	     sizeof( libnsfdb_rrv_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy RRV value.",
+		 function );
+
+		return( -1 );
+	}
+	entry->note_type              = note_type;
+	entry->note_class             = note_class;
+	entry->modification_time      = modification_time;
+	entry->parent_note_identifier = parent_note_identifier;
+
+	note_index->number_of_entries += 1;
+
+	if( note_type == LIBNSFDB_RRV_BUCKET_TYPE_DATA )
+	{
+		note_index->number_of_data_entries += 1;
+	}
+	else
+	{
+		note_index->number_of_non_data_entries += 1;
+	}
+	return( 1 );
+}
+
+/* Moves a lookup key down the heap until the heap property is restored
+ */
+void libnsfdb_note_index_sift_down_lookup_key(
+      uint64_t *lookup_keys,
+      int parent_index,
+      int number_of_lookup_keys )
+{
+	uint64_t lookup_key = 0;
+	int child_index     = 0;
+
+	child_index = ( parent_index * 2 ) + 1;
+
+	while( child_index < number_of_lookup_keys )
+	{
+		if( ( ( child_index + 1 ) < number_of_lookup_keys )
+		 && ( lookup_keys[ child_index + 1 ] > lookup_keys[ child_index ] ) )
+		{
+			child_index++;
+		}
+		if( lookup_keys[ parent_index ] >= lookup_keys[ child_index ] )
+		{
+			break;
+		}
+		lookup_key                  = lookup_keys[ parent_index ];
+		lookup_keys[ parent_index ] = lookup_keys[ child_index ];
+		lookup_keys[ child_index ]  = lookup_key;
+
+		parent_index = child_index;
+		child_index  = ( parent_index * 2 ) + 1;
+	}
+}
+
+/* Sorts the lookup keys in ascending order
+ * Heap sort is used since the RRV identifiers are commonly already (nearly) sorted
+ */
+void libnsfdb_note_index_sort_lookup_keys(
+      uint64_t *lookup_keys,
+      int number_of_lookup_keys )
+{
+	uint64_t lookup_key = 0;
+	int key_index       = 0;
+
+	if( ( lookup_keys == NULL )
+	 || ( number_of_lookup_keys < 2 ) )
+	{
+		return;
+	}
+	for( key_index = ( number_of_lookup_keys / 2 ) - 1;
+	     key_index >= 0;
+	     key_index-- )
+	{
+		libnsfdb_note_index_sift_down_lookup_key(
+		 lookup_keys,
+		 key_index,
+		 number_of_lookup_keys );
+	}
+	for( key_index = number_of_lookup_keys - 1;
+	     key_index > 0;
+	     key_index-- )
+	{
+		lookup_key               = lookup_keys[ 0 ];
+		lookup_keys[ 0 ]         = lookup_keys[ key_index ];
+		lookup_keys[ key_index ] = lookup_key;
+
+		libnsfdb_note_index_sift_down_lookup_key(
+		 lookup_keys,
+		 0,
+		 key_index );
+	}
+}
+
+/* Determines the key to compare a modification time
+ * The upper 8 bits of a NSF timedate value contain time zone information and are ignored
+ */
+uint64_t libnsfdb_note_index_get_modification_time_key(
+          uint64_t modification_time )
+{
+	return( modification_time & 0x00ffffffffffffffULL );
+}
+
+/* Compares the modification times of 2 entries
+ * Entries with the same modification time are compared by their entry index
+ * Returns -1 if the first entry comes before the second, 1 if it comes after or 0 if they are the same
+ */
+int libnsfdb_note_index_compare_modification_time(
+     libnsfdb_note_index_t *note_index,
+     int first_entry_index,
+     int second_entry_index )
+{
+	uint64_t first_key  = 0;
+	uint64_t second_key = 0;
+
+	first_key = libnsfdb_note_index_get_modification_time_key(
+	             note_index->entries[ first_entry_index ].modification_time );
+
+	second_key = libnsfdb_note_index_get_modification_time_key(
+	              note_index->entries[ second_entry_index ].modification_time );
+
+	if( first_key < second_key )
+	{
+		return( -1 );
+	}
+	else if( first_key > second_key )
+	{
+		return( 1 );
+	}
+	if( first_entry_index < second_entry_index )
+	{
+		return( -1 );
+	}
+	else if( first_entry_index > second_entry_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Moves an entry index down the heap until the heap property is restored
+ */
+void libnsfdb_note_index_sift_down_entry_index(
+      libnsfdb_note_index_t *note_index,
+      int *entry_indexes,
+      int parent_index,
+      int number_of_entry_indexes )
+{
+	int child_index = 0;
+	int entry_index = 0;
+
+	child_index = ( parent_index * 2 ) + 1;
+
+	while( child_index < number_of_entry_indexes )
+	{
+		if( ( ( child_index + 1 ) < number_of_entry_indexes )
+		 && ( libnsfdb_note_index_compare_modification_time(
+		       note_index,
+		       entry_indexes[ child_index + 1 ],
+		       entry_indexes[ child_index ] ) > 0 ) )
+		{
+			child_index++;
+		}
+		if( libnsfdb_note_index_compare_modification_time(
+		     note_index,
+		     entry_indexes[ parent_index ],
+		     entry_indexes[ child_index ] ) >= 0 )
+		{
+			break;
+		}
+		entry_index                   = entry_indexes[ parent_index ];
+		entry_indexes[ parent_index ] = entry_indexes[ child_index ];
+		entry_indexes[ child_index ]  = entry_index;
+
+		parent_index = child_index;
+		child_index  = ( parent_index * 2 ) + 1;
+	}
+}
+
+/* Sorts the entry indexes by the modification time of the entries in ascending order
+ */
+void libnsfdb_note_index_sort_entry_indexes_by_modification_time(
+      libnsfdb_note_index_t *note_index,
+      int *entry_indexes,
+      int number_of_entry_indexes )
+{
+	int entry_index = 0;
+	int heap_index  = 0;
+
+	if( ( note_index == NULL )
+	 || ( entry_indexes == NULL )
+	 || ( number_of_entry_indexes < 2 ) )
+	{
+		return;
+	}
+	for( heap_index = ( number_of_entry_indexes / 2 ) - 1;
+	     heap_index >= 0;
+	     heap_index-- )
+	{
+		libnsfdb_note_index_sift_down_entry_index(
+		 note_index,
+		 entry_indexes,
+		 heap_index,
+		 number_of_entry_indexes );
+	}
+	for( heap_index = number_of_entry_indexes - 1;
+	     heap_index > 0;
+	     heap_index-- )
+	{
+		entry_index                 = entry_indexes[ 0 ];
+		entry_indexes[ 0 ]          = entry_indexes[ heap_index ];
+		entry_indexes[ heap_index ] = entry_index;
+
+		libnsfdb_note_index_sift_down_entry_index(
+		 note_index,
+		 entry_indexes,
+		 0,
+		 heap_index );
+	}
+}
+
+/* Finalizes the note index
+ * This builds the per note type entry indexes, the RRV identifier lookup keys
+ * and the entry indexes sorted by modification time
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_finalize(
+     libnsfdb_note_index_t *note_index,
+     libcerror_error_t **error )
+{
+	int *modified_entry_indexes = NULL;
+	static char *function       = "libnsfdb_note_index_finalize";
+	int data_entry_index        = 0;
+	int entry_index             = 0;
+	int modified_entry_index    = 0;
+	int non_data_entry_index    = 0;
+
+	if( note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index->sorted_lookup_keys != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid note index - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	/* Always allocate at least 1 element so that an empty note index can be finalized
+	 */
+	note_index->sorted_lookup_keys = (uint64_t *) memory_allocate(
+	                                               sizeof( uint64_t ) * (size_t) ( note_index->number_of_entries + 1 ) );
+
+	if( note_index->sorted_lookup_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted lookup keys.",
+		 function );
+
+		goto on_error;
+	}
+	note_index->data_entry_indexes = (int *) memory_allocate(
+	                                          sizeof( int ) * (size_t) ( note_index->number_of_data_entries + 1 ) );
+
+	if( note_index->data_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	note_index->non_data_entry_indexes = (int *) memory_allocate(
+	                                              sizeof( int ) * (size_t) ( note_index->number_of_non_data_entries + 1 ) );
+
+	if( note_index->non_data_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create non-data entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < note_index->number_of_entries;
+	     entry_index++ )
+	{
+		note_index->sorted_lookup_keys[ entry_index ] = ( (uint64_t) note_index->entries[ entry_index ].rrv_value.rrv_identifier << 32 )
+		                                              | (uint64_t) entry_index;
+
+		if( note_index->entries[ entry_index ].note_type == LIBNSFDB_RRV_BUCKET_TYPE_DATA )
+		{
+			note_index->data_entry_indexes[ data_entry_index++ ] = entry_index;
+		}
+		else
+		{
+			note_index->non_data_entry_indexes[ non_data_entry_index++ ] = entry_index;
+		}
+	}
+	libnsfdb_note_index_sort_lookup_keys(
+	 note_index->sorted_lookup_keys,
+	 note_index->number_of_entries );
+
+	note_index->modification_time_entry_indexes = (int *) memory_allocate(
+	                                                       sizeof( int ) * ( ( (size_t) note_index->number_of_entries * 2 ) + 1 ) );
+
+	if( note_index->modification_time_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create modification time entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < note_index->number_of_entries;
+	     entry_index++ )
+	{
+		note_index->modification_time_entry_indexes[ entry_index ] = entry_index;
+	}
+	libnsfdb_note_index_sort_entry_indexes_by_modification_time(
+	 note_index,
+	 note_index->modification_time_entry_indexes,
+	 note_index->number_of_entries );
+
+	/* The sorted entry indexes are split per note type, which retains their order
+	 */
+	data_entry_index     = note_index->number_of_entries;
+	non_data_entry_index = note_index->number_of_entries + note_index->number_of_data_entries;
+
+	modified_entry_indexes = note_index->modification_time_entry_indexes;
+
+	for( modified_entry_index = 0;
+	     modified_entry_index < note_index->number_of_entries;
+	     modified_entry_index++ )
+	{
+		entry_index = modified_entry_indexes[ modified_entry_index ];
+
+		if( note_index->entries[ entry_index ].note_type == LIBNSFDB_RRV_BUCKET_TYPE_DATA )
+		{
+			modified_entry_indexes[ data_entry_index++ ] = entry_index;
+		}
+		else
+		{
+			modified_entry_indexes[ non_data_entry_index++ ] = entry_index;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( note_index->non_data_entry_indexes != NULL )
+	{
+		memory_free(
+		 note_index->non_data_entry_indexes );
+
+		note_index->non_data_entry_indexes = NULL;
+	}
+	if( note_index->data_entry_indexes != NULL )
+	{
+		memory_free(
+		 note_index->data_entry_indexes );
+
+		note_index->data_entry_indexes = NULL;
+	}
+	if( note_index->sorted_lookup_keys != NULL )
+	{
+		memory_free(
+		 note_index->sorted_lookup_keys );
+
+		note_index->sorted_lookup_keys = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of entries of a specific note type
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_get_number_of_entries(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_note_index_get_number_of_entries";
+
+	if( note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	switch( note_type )
+	{
+		case LIBNSFDB_NOTE_TYPE_ALL:
+			*number_of_entries = note_index->number_of_entries;
+			break;
+
+		case LIBNSFDB_NOTE_TYPE_DATA:
+			*number_of_entries = note_index->number_of_data_entries;
+			break;
+
+		case LIBNSFDB_NOTE_TYPE_NON_DATA:
+			*number_of_entries = note_index->number_of_non_data_entries;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported note type.",
+			 function );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific entry of a specific note type
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_get_entry_by_index(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     int entry_index,
+     libnsfdb_note_index_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_note_index_get_entry_by_index";
+	int number_of_entries = 0;
+
+	if( note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index->sorted_lookup_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid note index - not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_index_get_number_of_entries(
+	     note_index,
+	     note_type,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_type == LIBNSFDB_NOTE_TYPE_DATA )
+	{
+		entry_index = note_index->data_entry_indexes[ entry_index ];
+	}
+	else if( note_type == LIBNSFDB_NOTE_TYPE_NON_DATA )
+	{
+		entry_index = note_index->non_data_entry_indexes[ entry_index ];
+	}
+	*entry = &( note_index->entries[ entry_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the entry of a specific note type for a specific RRV identifier
+ * Returns 1 if successful, 0 if no such entry was found or -1 on error
+ */
+int libnsfdb_note_index_get_entry_by_identifier(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     uint32_t rrv_identifier,
+     libnsfdb_note_index_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_note_index_get_entry_by_identifier";
+	int entry_index       = 0;
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index->sorted_lookup_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid note index - not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( note_type != LIBNSFDB_NOTE_TYPE_ALL )
+	 && ( note_type != LIBNSFDB_NOTE_TYPE_DATA )
+	 && ( note_type != LIBNSFDB_NOTE_TYPE_NON_DATA ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported note type.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the first lookup key with the RRV identifier
+	 */
+	lower_index = 0;
+	upper_index = note_index->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( (uint32_t) ( note_index->sorted_lookup_keys[ middle_index ] >> 32 ) < rrv_identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	while( lower_index < note_index->number_of_entries )
+	{
+		if( (uint32_t) ( note_index->sorted_lookup_keys[ lower_index ] >> 32 ) != rrv_identifier )
+		{
+			break;
+		}
+		entry_index = (int) ( note_index->sorted_lookup_keys[ lower_index ] & 0xffffffffUL );
+
+		if( ( note_type == LIBNSFDB_NOTE_TYPE_ALL )
+		 || ( note_type == note_index->entries[ entry_index ].note_type ) )
+		{
+			*entry = &( note_index->entries[ entry_index ] );
+
+			return( 1 );
+		}
+		lower_index++;
+	}
+	return( 0 );
+}
+
+/* Retrieves the entry indexes of a specific note type that were modified after a specific modification time
+ * The entry indexes are sorted by modification time and reference the entry indexes of the note index
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_get_modified_entry_indexes(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     uint64_t modification_time,
+     int **entry_indexes,
+     int *number_of_entry_indexes,
+     libcerror_error_t **error )
+{
+	int *safe_entry_indexes    = NULL;
+	static char *function      = "libnsfdb_note_index_get_modified_entry_indexes";
+	uint64_t modification_key  = 0;
+	int lower_index            = 0;
+	int middle_index           = 0;
+	int safe_number_of_indexes = 0;
+	int upper_index            = 0;
+
+	if( note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index->modification_time_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid note index - not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	switch( note_type )
+	{
+		case LIBNSFDB_NOTE_TYPE_ALL:
+			safe_entry_indexes     = note_index->modification_time_entry_indexes;
+			safe_number_of_indexes = note_index->number_of_entries;
+			break;
+
+		case LIBNSFDB_NOTE_TYPE_DATA:
+			safe_entry_indexes     = &( note_index->modification_time_entry_indexes[ note_index->number_of_entries ] );
+			safe_number_of_indexes = note_index->number_of_data_entries;
+			break;
+
+		case LIBNSFDB_NOTE_TYPE_NON_DATA:
+			safe_entry_indexes     = &( note_index->modification_time_entry_indexes[ note_index->number_of_entries + note_index->number_of_data_entries ] );
+			safe_number_of_indexes = note_index->number_of_non_data_entries;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported note type.",
+			 function );
+
+			return( -1 );
+	}
+	modification_key = libnsfdb_note_index_get_modification_time_key(
+	                    modification_time );
+
+	/* Find the first entry that was modified after the modification time
+	 */
+	lower_index = 0;
+	upper_index = safe_number_of_indexes;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libnsfdb_note_index_get_modification_time_key(
+		     note_index->entries[ safe_entry_indexes[ middle_index ] ].modification_time ) <= modification_key )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	*entry_indexes           = &( safe_entry_indexes[ lower_index ] );
+	*number_of_entry_indexes = safe_number_of_indexes - lower_index;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries of a specific note type that were modified after a specific modification time
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_get_number_of_modified_entries(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     uint64_t modification_time,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	int *entry_indexes    = NULL;
+	static char *function = "libnsfdb_note_index_get_number_of_modified_entries";
+
+	if( libnsfdb_note_index_get_modified_entry_indexes(
+	     note_index,
+	     note_type,
+	     modification_time,
+	     &entry_indexes,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modified entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific entry of a specific note type that was modified after a specific modification time
+ * The entries are sorted by modification time
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_get_modified_entry_by_index(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     uint64_t modification_time,
+     int entry_index,
+     libnsfdb_note_index_entry_t **entry,
+     libcerror_error_t **error )
+{
+	int *entry_indexes          = NULL;
+	static char *function       = "libnsfdb_note_index_get_modified_entry_by_index";
+	int number_of_entry_indexes = 0;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_index_get_modified_entry_indexes(
+	     note_index,
+	     note_type,
+	     modification_time,
+	     &entry_indexes,
+	     &number_of_entry_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modified entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= number_of_entry_indexes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = &( note_index->entries[ entry_indexes[ entry_index ] ] );
+
+	return( 1 );
+}
+
+/* Builds the threads of the note index
+ * This resolves the parent entry of every entry using its parent note identifier
+ * and stores the response entries of every entry in a compressed sparse row layout
+ * Entries of which the parent is not in the note index are the root of a thread
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_build_threads(
+     libnsfdb_note_index_t *note_index,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_index_entry_t *entry        = NULL;
+	libnsfdb_note_index_entry_t *parent_entry = NULL;
+	int *path_entry_indexes                   = NULL;
+	static char *function                     = "libnsfdb_note_index_build_threads";
+	size_t entry_indexes_size                 = 0;
+	int current_entry_index                   = 0;
+	int entry_index                           = 0;
+	int number_of_responses                   = 0;
+	int parent_entry_index                    = 0;
+	int path_length                           = 0;
+	int response_entry_offset                 = 0;
+	int result                                = 0;
+	int root_entry_index                      = 0;
+
+	if( note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index->sorted_lookup_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid note index - not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index->response_entry_indexes != NULL )
+	{
+		return( 1 );
+	}
+	/* Always allocate at least 1 element so that the threads of an empty note index can be built
+	 */
+	entry_indexes_size = sizeof( int ) * (size_t) ( note_index->number_of_entries + 1 );
+
+	note_index->parent_entry_indexes = (int *) memory_allocate(
+	                                            entry_indexes_size );
+
+	if( note_index->parent_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parent entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	note_index->root_entry_indexes = (int *) memory_allocate(
+	                                          entry_indexes_size );
+
+	if( note_index->root_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create root entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	note_index->response_entry_offsets = (int *) memory_allocate(
+	                                              entry_indexes_size );
+
+	if( note_index->response_entry_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create response entry offsets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     note_index->response_entry_offsets,
+	     0,
+	     entry_indexes_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear response entry offsets.",
+		 function );
+
+		goto on_error;
+	}
+	note_index->response_entry_indexes = (int *) memory_allocate(
+	                                              entry_indexes_size );
+
+	if( note_index->response_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create response entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	path_entry_indexes = (int *) memory_allocate(
+	                              entry_indexes_size );
+
+	if( path_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	/* Resolve the parent entries and count the number of responses of every entry
+	 */
+	for( entry_index = 0;
+	     entry_index < note_index->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( note_index->entries[ entry_index ] );
+
+		note_index->parent_entry_indexes[ entry_index ] = -1;
+		note_index->root_entry_indexes[ entry_index ]   = -1;
+
+		if( ( entry->parent_note_identifier == 0 )
+		 || ( entry->parent_note_identifier == entry->rrv_value.rrv_identifier ) )
+		{
+			continue;
+		}
+		result = libnsfdb_note_index_get_entry_by_identifier(
+		          note_index,
+		          entry->note_type,
+		          entry->parent_note_identifier,
+		          &parent_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent entry: 0x%08" PRIx32 ".",
+			 function,
+			 entry->parent_note_identifier );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			parent_entry_index = (int) ( parent_entry - note_index->entries );
+
+			note_index->parent_entry_indexes[ entry_index ] = parent_entry_index;
+
+			note_index->response_entry_offsets[ parent_entry_index ] += 1;
+		}
+	}
+	/* Convert the number of responses into the offsets of the first response of every entry
+	 */
+	for( entry_index = 0;
+	     entry_index < note_index->number_of_entries;
+	     entry_index++ )
+	{
+		number_of_responses = note_index->response_entry_offsets[ entry_index ];
+
+		note_index->response_entry_offsets[ entry_index ] = response_entry_offset;
+
+		response_entry_offset += number_of_responses;
+	}
+	note_index->response_entry_offsets[ note_index->number_of_entries ] = response_entry_offset;
+
+	/* Store the responses in entry order, which advances the offset of every parent
+	 * to the offset of the next entry, hence the offsets are shifted back afterwards
+	 */
+	for( entry_index = 0;
+	     entry_index < note_index->number_of_entries;
+	     entry_index++ )
+	{
+		parent_entry_index = note_index->parent_entry_indexes[ entry_index ];
+
+		if( parent_entry_index != -1 )
+		{
+			response_entry_offset = note_index->response_entry_offsets[ parent_entry_index ];
+
+			note_index->response_entry_indexes[ response_entry_offset ] = entry_index;
+
+			note_index->response_entry_offsets[ parent_entry_index ] += 1;
+		}
+	}
+	for( entry_index = note_index->number_of_entries;
+	     entry_index > 0;
+	     entry_index-- )
+	{
+		note_index->response_entry_offsets[ entry_index ] = note_index->response_entry_offsets[ entry_index - 1 ];
+	}
+	note_index->response_entry_offsets[ 0 ] = 0;
+
+	/* Resolve the root entries, every entry is only walked once since the root of
+	 * the entries on the path is stored. An entry on the path is marked with -2 so
+	 * that a parent loop can be detected, in which case the loop is broken at the
+	 * entry that was visited twice
+	 */
+	for( entry_index = 0;
+	     entry_index < note_index->number_of_entries;
+	     entry_index++ )
+	{
+		if( note_index->root_entry_indexes[ entry_index ] != -1 )
+		{
+			continue;
+		}
+		current_entry_index = entry_index;
+		path_length         = 0;
+
+		while( ( note_index->root_entry_indexes[ current_entry_index ] == -1 )
+		    && ( note_index->parent_entry_indexes[ current_entry_index ] != -1 ) )
+		{
+			note_index->root_entry_indexes[ current_entry_index ] = -2;
+
+			path_entry_indexes[ path_length++ ] = current_entry_index;
+
+			current_entry_index = note_index->parent_entry_indexes[ current_entry_index ];
+		}
+		if( note_index->root_entry_indexes[ current_entry_index ] >= 0 )
+		{
+			root_entry_index = note_index->root_entry_indexes[ current_entry_index ];
+		}
+		else
+		{
+			root_entry_index = current_entry_index;
+
+			note_index->root_entry_indexes[ current_entry_index ] = root_entry_index;
+		}
+		while( path_length > 0 )
+		{
+			path_length--;
+
+			note_index->root_entry_indexes[ path_entry_indexes[ path_length ] ] = root_entry_index;
+		}
+	}
+	memory_free(
+	 path_entry_indexes );
+
+	return( 1 );
+
+on_error:
+	if( path_entry_indexes != NULL )
+	{
+		memory_free(
+		 path_entry_indexes );
+	}
+	if( note_index->response_entry_indexes != NULL )
+	{
+		memory_free(
+		 note_index->response_entry_indexes );
+
+		note_index->response_entry_indexes = NULL;
+	}
+	if( note_index->response_entry_offsets != NULL )
+	{
+		memory_free(
+		 note_index->response_entry_offsets );
+
+		note_index->response_entry_offsets = NULL;
+	}
+	if( note_index->root_entry_indexes != NULL )
+	{
+		memory_free(
+		 note_index->root_entry_indexes );
+
+		note_index->root_entry_indexes = NULL;
+	}
+	if( note_index->parent_entry_indexes != NULL )
+	{
+		memory_free(
+		 note_index->parent_entry_indexes );
+
+		note_index->parent_entry_indexes = NULL;
+	}
+	return( -1 );
+}
+
+/* Determines the index of an entry of which the threads were built
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_get_thread_entry_index(
+     libnsfdb_note_index_t *note_index,
+     const libnsfdb_note_index_entry_t *entry,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_note_index_get_thread_entry_index";
+
+	if( note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_index->response_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid note index - missing threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry == NULL )
+	 || ( entry < note_index->entries )
+	 || ( entry >= &( note_index->entries[ note_index->number_of_entries ] ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	*entry_index = (int) ( entry - note_index->entries );
+
+	return( 1 );
+}
+
+/* Retrieves the number of response entries of a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_get_number_of_response_entries(
+     libnsfdb_note_index_t *note_index,
+     const libnsfdb_note_index_entry_t *entry,
+     int *number_of_response_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_note_index_get_number_of_response_entries";
+	int entry_index       = 0;
+
+	if( number_of_response_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of response entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_index_get_thread_entry_index(
+	     note_index,
+	     entry,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry index.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_response_entries = note_index->response_entry_offsets[ entry_index + 1 ]
+	                            - note_index->response_entry_offsets[ entry_index ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific response entry of a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_get_response_entry_by_index(
+     libnsfdb_note_index_t *note_index,
+     const libnsfdb_note_index_entry_t *entry,
+     int response_entry_index,
+     libnsfdb_note_index_entry_t **response_entry,
+     libcerror_error_t **error )
+{
+	static char *function          = "libnsfdb_note_index_get_response_entry_by_index";
+	int entry_index                = 0;
+	int number_of_response_entries = 0;
+
+	if( response_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid response entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_index_get_thread_entry_index(
+	     note_index,
+	     entry,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry index.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_response_entries = note_index->response_entry_offsets[ entry_index + 1 ]
+	                           - note_index->response_entry_offsets[ entry_index ];
+
+	if( ( response_entry_index < 0 )
+	 || ( response_entry_index >= number_of_response_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid response entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	response_entry_index = note_index->response_entry_indexes[ note_index->response_entry_offsets[ entry_index ] + response_entry_index ];
+
+	*response_entry = &( note_index->entries[ response_entry_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the thread root entry of a specific entry
+ * The thread root entry of an entry without a parent is the entry itself
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_index_get_thread_root_entry(
+     libnsfdb_note_index_t *note_index,
+     const libnsfdb_note_index_entry_t *entry,
+     libnsfdb_note_index_entry_t **root_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_note_index_get_thread_root_entry";
+	int entry_index       = 0;
+
+	if( root_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_index_get_thread_entry_index(
+	     note_index,
+	     entry,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry index.",
+		 function );
+
+		return( -1 );
+	}
+	*root_entry = &( note_index->entries[ note_index->root_entry_indexes[ entry_index ] ] );
+
+	return( 1 );
+}
+
@@ -0,0 +1,247 @@
+/*
+ * Note index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_NOTE_INDEX_H )
+#define _LIBNSFDB_NOTE_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_rrv_value.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_note_index_entry libnsfdb_note_index_entry_t;
+
+struct libnsfdb_note_index_entry
+{
+	/* The RRV value
+	 */
+	libnsfdb_rrv_value_t rrv_value;
+
+	/* The note type
+	 */
+	uint8_t note_type;
+
+	/* The note class
+	 */
+	uint16_t note_class;
+
+	/* The modification time
+	 */
+	uint64_t modification_time;
+
+	/* The parent note identifier
+	 */
+	uint32_t parent_note_identifier;
+};
+
+typedef struct libnsfdb_note_index libnsfdb_note_index_t;
+
+struct libnsfdb_note_index
+{
+	/* The entries
+	 */
+	libnsfdb_note_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The data entry indexes
+	 */
+	int *data_entry_indexes;
+
+	/* The number of data entries
+	 */
+	int number_of_data_entries;
+
+	/* The non-data entry indexes
+	 */
+	int *non_data_entry_indexes;
+
+	/* The number of non-data entries
+	 */
+	int number_of_non_data_entries;
+
+	/* The entry lookup keys sorted by RRV identifier
+	 * The upper 32-bit contain the RRV identifier and the lower 32-bit the entry index
+	 */
+	uint64_t *sorted_lookup_keys;
+
+	/* The entry indexes sorted by modification time
+	 * The entry indexes of all notes are followed by those of the data and non-data notes
+	 */
+	int *modification_time_entry_indexes;
+
+	/* The parent entry indexes, -1 if the entry has no parent
+	 */
+	int *parent_entry_indexes;
+
+	/* The thread root entry indexes
+	 */
+	int *root_entry_indexes;
+
+	/* The response entry offsets
+	 * The response entry indexes of an entry are stored in response_entry_indexes
+	 * from the offset of the entry up to the offset of the next entry
+	 */
+	int *response_entry_offsets;
+
+	/* The response entry indexes
+	 */
+	int *response_entry_indexes;
+};
+
+int libnsfdb_note_index_initialize(
+     libnsfdb_note_index_t **note_index,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_free(
+     libnsfdb_note_index_t **note_index,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_append_entry(
+     libnsfdb_note_index_t *note_index,
+     const libnsfdb_rrv_value_t *rrv_value,
+     uint8_t note_type,
+     uint16_t note_class,
+     uint64_t modification_time,
+     uint32_t parent_note_identifier,
+     libcerror_error_t **error );
+
+void libnsfdb_note_index_sift_down_lookup_key(
+      uint64_t *lookup_keys,
+      int parent_index,
+      int number_of_lookup_keys );
+
+void libnsfdb_note_index_sort_lookup_keys(
+      uint64_t *lookup_keys,
+      int number_of_lookup_keys );
+
+uint64_t libnsfdb_note_index_get_modification_time_key(
+          uint64_t modification_time );
+
+int libnsfdb_note_index_compare_modification_time(
+     libnsfdb_note_index_t *note_index,
+     int first_entry_index,
+     int second_entry_index );
+
+void libnsfdb_note_index_sift_down_entry_index(
+      libnsfdb_note_index_t *note_index,
+      int *entry_indexes,
+      int parent_index,
+      int number_of_entry_indexes );
+
+void libnsfdb_note_index_sort_entry_indexes_by_modification_time(
+      libnsfdb_note_index_t *note_index,
+      int *entry_indexes,
+      int number_of_entry_indexes );
+
+int libnsfdb_note_index_finalize(
+     libnsfdb_note_index_t *note_index,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_get_number_of_entries(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_get_entry_by_index(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     int entry_index,
+     libnsfdb_note_index_entry_t **entry,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_get_entry_by_identifier(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     uint32_t rrv_identifier,
+     libnsfdb_note_index_entry_t **entry,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_get_modified_entry_indexes(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     uint64_t modification_time,
+     int **entry_indexes,
+     int *number_of_entry_indexes,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_get_number_of_modified_entries(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     uint64_t modification_time,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_get_modified_entry_by_index(
+     libnsfdb_note_index_t *note_index,
+     uint8_t note_type,
+     uint64_t modification_time,
+     int entry_index,
+     libnsfdb_note_index_entry_t **entry,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_build_threads(
+     libnsfdb_note_index_t *note_index,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_get_thread_entry_index(
+     libnsfdb_note_index_t *note_index,
+     const libnsfdb_note_index_entry_t *entry,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_get_number_of_response_entries(
+     libnsfdb_note_index_t *note_index,
+     const libnsfdb_note_index_entry_t *entry,
+     int *number_of_response_entries,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_get_response_entry_by_index(
+     libnsfdb_note_index_t *note_index,
+     const libnsfdb_note_index_entry_t *entry,
+     int response_entry_index,
+     libnsfdb_note_index_entry_t **response_entry,
+     libcerror_error_t **error );
+
+int libnsfdb_note_index_get_thread_root_entry(
+     libnsfdb_note_index_t *note_index,
+     const libnsfdb_note_index_entry_t *entry,
+     libnsfdb_note_index_entry_t **root_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_NOTE_INDEX_H ) */
+
@@ -0,0 +1,1532 @@
+/*
+ * Note recovery functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_bucket.h"
+#include "libnsfdb_definitions.h"
+#include "libnsfdb_io_handle.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcdata.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libcnotify.h"
+#include "libnsfdb_libcthreads.h"
+#include "libnsfdb_libfdata.h"
+#include "libnsfdb_note_index.h"
+#include "libnsfdb_note_recovery.h"
+#include "libnsfdb_rrv_value.h"
+
+#include "nsfdb_bucket.h"
+#include "nsfdb_note.h"
+
+/* Appends a recovered note to a note recovery segment
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_recovery_segment_append_note(
+     libnsfdb_note_recovery_segment_t *segment,
+     uint32_t bucket_index,
+     uint32_t data_offset,
+     uint32_t data_size,
+     uint32_t rrv_identifier,
+     libcerror_error_t **error )
+{
+	libnsfdb_recovered_note_t *note = NULL;
+	void *reallocation              = NULL;
+	static char *function           = "libnsfdb_note_recovery_segment_append_note";
+	size_t notes_size               = 0;
+	int maximum_number_of_notes     = 0;
+
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment->number_of_notes >= segment->maximum_number_of_notes )
+	{
+		if( segment->maximum_number_of_notes == 0 )
+		{
+			maximum_number_of_notes = 64;
+		}
+		else
+		{
+			maximum_number_of_notes = segment->maximum_number_of_notes * 2;
+		}
+		if( maximum_number_of_notes <= segment->number_of_notes )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of notes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		notes_size = sizeof( libnsfdb_recovered_note_t ) * (size_t) maximum_number_of_notes;
+
+		if( notes_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid notes size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                segment->notes,
+		                notes_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize notes.",
+			 function );
+
+			return( -1 );
+		}
+		segment->notes                   = (libnsfdb_recovered_note_t *) reallocation;
+		segment->maximum_number_of_notes = maximum_number_of_notes;
+	}
+	note = &( segment->notes[ segment->number_of_notes ] );
+
+	note->bucket_index   = bucket_index;
+	note->data_offset    = data_offset;
+	note->data_size      = data_size;
+	note->rrv_identifier = rrv_identifier;
+
+	segment->number_of_notes += 1;
+
+	return( 1 );
+}
+
+/* Determines if a bucket slot is referenced by a RRV value
+ * The live slot keys must be sorted in ascending order
+ * Returns 1 if the slot is referenced or 0 if not
+ */
+int libnsfdb_note_recovery_is_live_slot(
+     uint64_t *live_slot_keys,
+     int number_of_live_slot_keys,
+     uint32_t bucket_index,
+     uint16_t slot_index )
+{
+	uint64_t slot_key = 0;
+	int lower_index   = 0;
+	int middle_index  = 0;
+	int upper_index   = 0;
+
+	if( live_slot_keys == NULL )
+	{
+		return( 0 );
+	}
+	slot_key    = ( (uint64_t) bucket_index << 16 ) | slot_index;
+	upper_index = number_of_live_slot_keys;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( live_slot_keys[ middle_index ] == slot_key )
+		{
+			return( 1 );
+		}
+		else if( live_slot_keys[ middle_index ] < slot_key )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	return( 0 );
+}
+
+/* Checks if the data contains a note header with a consistent size
+ * The note size must fit in the data and contain the note items
+ * and the data of the summary note items
+ * Returns 1 if a note was found, 0 if not or -1 on error
+ */
+int libnsfdb_note_recovery_check_note(
+     const uint8_t *note_data,
+     size_t note_data_size,
+     uint32_t *note_size,
+     uint32_t *rrv_identifier,
+     libcerror_error_t **error )
+{
+	const uint8_t *note_item_data        = NULL;
+	static char *function                = "libnsfdb_note_recovery_check_note";
+	size_t items_data_size               = 0;
+	size_t note_items_size               = 0;
+	uint32_t non_summary_data_identifier = 0;
+	uint32_t stored_note_size            = 0;
+	uint16_t field_flags                 = 0;
+	uint16_t item_data_size              = 0;
+	uint16_t note_item_index             = 0;
+	uint16_t note_signature              = 0;
+	uint16_t number_of_note_items        = 0;
+
+	if( note_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note data.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid note data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note size.",
+		 function );
+
+		return( -1 );
+	}
+	if( rrv_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RRV identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_data_size < sizeof( nsfdb_note_header_t ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->signature,
+	 note_signature );
+
+	if( note_signature != 0x0004 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->size,
+	 stored_note_size );
+
+	if( ( stored_note_size < sizeof( nsfdb_note_header_t ) )
+	 || ( (size_t) stored_note_size > note_data_size ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->non_summary_data_identifier,
+	 non_summary_data_identifier );
+
+	if( ( non_summary_data_identifier != 0 )
+	 && ( ( non_summary_data_identifier & 0x80000000UL ) == 0 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->number_of_note_items,
+	 number_of_note_items );
+
+	items_data_size = (size_t) stored_note_size - sizeof( nsfdb_note_header_t );
+	note_items_size = (size_t) number_of_note_items * sizeof( nsfdb_note_item_t );
+
+	if( note_items_size > items_data_size )
+	{
+		return( 0 );
+	}
+	items_data_size -= note_items_size;
+	note_item_data   = &( note_data[ sizeof( nsfdb_note_header_t ) ] );
+
+	for( note_item_index = 0;
+	     note_item_index < number_of_note_items;
+	     note_item_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (nsfdb_note_item_t *) note_item_data )->field_flags,
+		 field_flags );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (nsfdb_note_item_t *) note_item_data )->data_size,
+		 item_data_size );
+
+		if( ( field_flags & LIBNSFDB_NOTE_ITEM_FIELD_FLAG_SUMMARY ) != 0 )
+		{
+			if( (size_t) item_data_size > items_data_size )
+			{
+				return( 0 );
+			}
+			items_data_size -= item_data_size;
+		}
+		note_item_data += sizeof( nsfdb_note_item_t );
+	}
+	*note_size = stored_note_size;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->rrv_identifier,
+	 *rrv_identifier );
+
+	return( 1 );
+}
+
+/* Carves the notes from the bucket data that is not referenced by a RRV value
+ * This is both the data of slots that are no longer referenced and the free space
+ * between the slots
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_recovery_carve_bucket(
+     libnsfdb_note_recovery_segment_t *segment,
+     libnsfdb_bucket_t *bucket,
+     uint32_t bucket_index,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *bucket_index_array              = NULL;
+	libnsfdb_bucket_index_entry_t *bucket_index_entry = NULL;
+	uint8_t *live_data_map                            = NULL;
+	static char *function                             = "libnsfdb_note_recovery_carve_bucket";
+	size_t data_end_offset                            = 0;
+	size_t data_offset                                = 0;
+	size_t live_data_end_offset                       = 0;
+	size_t map_offset                                 = 0;
+	uint32_t footer_size                              = 0;
+	uint32_t note_size                                = 0;
+	uint32_t number_of_slots                          = 0;
+	uint32_t rrv_identifier                           = 0;
+	uint32_t slot_iterator                            = 0;
+	int result                                        = 0;
+
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid bucket - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket->data_size < sizeof( nsfdb_bucket_header_t ) )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_bucket_header_t *) bucket->data )->number_of_slots,
+	 number_of_slots );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_bucket_header_t *) bucket->data )->footer_size,
+	 footer_size );
+
+	/* The slot data is stored between the bucket header and the bucket index
+	 * that precedes the bucket footer
+	 */
+	data_end_offset = (size_t) bucket->data_size - sizeof( nsfdb_bucket_header_t );
+
+	if( (size_t) footer_size > data_end_offset )
+	{
+		return( 1 );
+	}
+	data_end_offset -= footer_size;
+
+	if( (size_t) number_of_slots > ( data_end_offset / 4 ) )
+	{
+		return( 1 );
+	}
+	data_end_offset -= (size_t) number_of_slots * 4;
+	data_end_offset += sizeof( nsfdb_bucket_header_t );
+
+	if( data_end_offset < ( sizeof( nsfdb_bucket_header_t ) + sizeof( nsfdb_note_header_t ) ) )
+	{
+		return( 1 );
+	}
+	live_data_map = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * data_end_offset );
+
+	if( live_data_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create live data map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     live_data_map,
+	     0,
+	     sizeof( uint8_t ) * data_end_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear live data map.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_slots > 0 )
+	{
+		if( libcdata_array_initialize(
+		     &bucket_index_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create bucket index array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libnsfdb_bucket_read_index(
+		     bucket_index_array,
+		     number_of_slots,
+		     bucket->data,
+		     (size_t) bucket->data_size - footer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read bucket index.",
+			 function );
+
+			goto on_error;
+		}
+		/* Mark the data of the slots that are referenced by a RRV value
+		 * the slot indexes in a RRV value start at 1
+		 */
+		for( slot_iterator = 0;
+		     slot_iterator < number_of_slots;
+		     slot_iterator++ )
+		{
+			if( libnsfdb_note_recovery_is_live_slot(
+			     segment->live_slot_keys,
+			     segment->number_of_live_slot_keys,
+			     bucket_index,
+			     (uint16_t) ( slot_iterator + 1 ) ) == 0 )
+			{
+				continue;
+			}
+			if( libcdata_array_get_entry_by_index(
+			     bucket_index_array,
+			     (int) slot_iterator,
+			     (intptr_t **) &bucket_index_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve bucket index entry: %" PRIu32 ".",
+				 function,
+				 slot_iterator );
+
+				goto on_error;
+			}
+			if( bucket_index_entry == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing bucket index entry: %" PRIu32 ".",
+				 function,
+				 slot_iterator );
+
+				goto on_error;
+			}
+			map_offset           = (size_t) bucket_index_entry->offset;
+			live_data_end_offset = map_offset + bucket_index_entry->size;
+
+			if( live_data_end_offset > data_end_offset )
+			{
+				live_data_end_offset = data_end_offset;
+			}
+			while( map_offset < live_data_end_offset )
+			{
+				live_data_map[ map_offset++ ] = 1;
+			}
+		}
+		if( libcdata_array_free(
+		     &bucket_index_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_bucket_index_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free the bucket index array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_offset = sizeof( nsfdb_bucket_header_t );
+
+	while( ( data_offset + sizeof( nsfdb_note_header_t ) ) <= data_end_offset )
+	{
+		if( ( live_data_map[ data_offset ] != 0 )
+		 || ( bucket->data[ data_offset ] != 0x04 )
+		 || ( bucket->data[ data_offset + 1 ] != 0x00 ) )
+		{
+			data_offset++;
+
+			continue;
+		}
+		result = libnsfdb_note_recovery_check_note(
+		          &( bucket->data[ data_offset ] ),
+		          data_end_offset - data_offset,
+		          &note_size,
+		          &rrv_identifier,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check note at bucket data offset: %" PRIzd ".",
+			 function,
+			 data_offset );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			/* A note that overlaps with the data of a referenced slot
+			 * has been (partially) overwritten
+			 */
+			for( map_offset = data_offset;
+			     map_offset < ( data_offset + note_size );
+			     map_offset++ )
+			{
+				if( live_data_map[ map_offset ] != 0 )
+				{
+					result = 0;
+
+					break;
+				}
+			}
+		}
+		if( result == 0 )
+		{
+			data_offset++;
+
+			continue;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: recovered note: 0x%08" PRIx32 " in bucket: %" PRIu32 " at offset: %" PRIzd " of size: %" PRIu32 "\n",
+			 function,
+			 rrv_identifier,
+			 bucket_index,
+			 data_offset,
+			 note_size );
+		}
+#endif
+		if( libnsfdb_note_recovery_segment_append_note(
+		     segment,
+		     bucket_index,
+		     (uint32_t) data_offset,
+		     note_size,
+		     rrv_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append recovered note.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += note_size;
+	}
+	memory_free(
+	 live_data_map );
+
+	return( 1 );
+
+on_error:
+	if( bucket_index_array != NULL )
+	{
+		libcdata_array_free(
+		 &bucket_index_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_bucket_index_entry_free,
+		 NULL );
+	}
+	if( live_data_map != NULL )
+	{
+		memory_free(
+		 live_data_map );
+	}
+	return( -1 );
+}
+
+/* Scans the summary buckets of a note recovery segment for deleted notes
+ * A summary bucket that cannot be read is skipped
+ * This function is used as the thread function of the segment
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_recovery_scan_segment(
+     libnsfdb_note_recovery_segment_t *segment )
+{
+	libcerror_error_t *bucket_error = NULL;
+	libnsfdb_bucket_t *bucket       = NULL;
+	static char *function           = "libnsfdb_note_recovery_scan_segment";
+	uint32_t bucket_index           = 0;
+	int result                      = 0;
+
+	if( segment == NULL )
+	{
+		return( -1 );
+	}
+	if( segment->bucket_offsets == NULL )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment - missing bucket offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = segment->first_bucket_index;
+	     bucket_index < segment->end_bucket_index;
+	     bucket_index++ )
+	{
+		if( ( segment->abort != NULL )
+		 && ( *( segment->abort ) != 0 ) )
+		{
+			break;
+		}
+		if( libnsfdb_bucket_initialize(
+		     &bucket,
+		     &( segment->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create bucket.",
+			 function );
+
+			goto on_error;
+		}
+		/* The bucket indexes in a RRV value start at 1
+		 */
+		result = libnsfdb_bucket_read(
+		          bucket,
+		          segment->file_io_handle,
+		          segment->bucket_offsets[ bucket_index - 1 ],
+		          &bucket_error );
+
+		if( result != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read summary bucket: %" PRIu32 ".\n",
+				 function,
+				 bucket_index );
+			}
+#endif
+			libcerror_error_free(
+			 &bucket_error );
+		}
+		else if( libnsfdb_note_recovery_carve_bucket(
+		          segment,
+		          bucket,
+		          bucket_index,
+		          &( segment->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to carve summary bucket: %" PRIu32 ".",
+			 function,
+			 bucket_index );
+
+			goto on_error;
+		}
+		if( libnsfdb_bucket_free(
+		     &bucket,
+		     &( segment->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free bucket.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	segment->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( bucket != NULL )
+	{
+		libnsfdb_bucket_free(
+		 &bucket,
+		 NULL );
+	}
+	segment->result = -1;
+
+	return( -1 );
+}
+
+/* Frees note recovery segments
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_recovery_free_segments(
+     libnsfdb_note_recovery_segment_t **segments,
+     int number_of_segments,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_recovery_segment_t *segment = NULL;
+	static char *function                     = "libnsfdb_note_recovery_free_segments";
+	int result                                = 1;
+	int segment_index                         = 0;
+
+	if( segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segments != NULL )
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( ( *segments )[ segment_index ] );
+
+			if( segment->file_io_handle_cloned != 0 )
+			{
+				if( libbfio_handle_close(
+				     segment->file_io_handle,
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close file IO handle of segment: %d.",
+					 function,
+					 segment_index );
+
+					result = -1;
+				}
+				if( libbfio_handle_free(
+				     &( segment->file_io_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free file IO handle of segment: %d.",
+					 function,
+					 segment_index );
+
+					result = -1;
+				}
+			}
+			if( segment->notes != NULL )
+			{
+				memory_free(
+				 segment->notes );
+			}
+			if( segment->error != NULL )
+			{
+				libcerror_error_free(
+				 &( segment->error ) );
+			}
+		}
+		memory_free(
+		 *segments );
+
+		*segments = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the sorted keys of the bucket slots that are referenced by a RRV value
+ * The key of a bucket slot consists of the bucket index and the slot index
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_recovery_get_live_slot_keys(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t **live_slot_keys,
+     int *number_of_live_slot_keys,
+     libcerror_error_t **error )
+{
+	libnsfdb_rrv_value_t rrv_value;
+
+	uint64_t *slot_keys      = NULL;
+	static char *function    = "libnsfdb_note_recovery_get_live_slot_keys";
+	int number_of_rrv_values = 0;
+	int number_of_slot_keys  = 0;
+	int rrv_value_index      = 0;
+
+	if( live_slot_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid live slot keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( *live_slot_keys != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid live slot keys value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_live_slot_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of live slot keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_io_handle_get_number_of_rrv_values(
+	     io_handle,
+	     file_io_handle,
+	     LIBNSFDB_NOTE_TYPE_ALL,
+	     &number_of_rrv_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of RRV values.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_rrv_values > 0 )
+	{
+		if( (size_t) number_of_rrv_values > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of RRV values value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		slot_keys = (uint64_t *) memory_allocate(
+		                          sizeof( uint64_t ) * (size_t) number_of_rrv_values );
+
+		if( slot_keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create slot keys.",
+			 function );
+
+			goto on_error;
+		}
+		for( rrv_value_index = 0;
+		     rrv_value_index < number_of_rrv_values;
+		     rrv_value_index++ )
+		{
+			if( libnsfdb_io_handle_get_rrv_value_by_index(
+			     io_handle,
+			     file_io_handle,
+			     LIBNSFDB_NOTE_TYPE_ALL,
+			     rrv_value_index,
+			     &rrv_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve RRV value: %d.",
+				 function,
+				 rrv_value_index );
+
+				goto on_error;
+			}
+			if( rrv_value.type == LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER )
+			{
+				slot_keys[ number_of_slot_keys++ ] = ( (uint64_t) rrv_value.bucket_index << 16 )
+				                                   | rrv_value.slot_index;
+			}
+		}
+		libnsfdb_note_index_sort_lookup_keys(
+		 slot_keys,
+		 number_of_slot_keys );
+	}
+	*live_slot_keys           = slot_keys;
+	*number_of_live_slot_keys = number_of_slot_keys;
+
+	return( 1 );
+
+on_error:
+	if( slot_keys != NULL )
+	{
+		memory_free(
+		 slot_keys );
+	}
+	return( -1 );
+}
+
+/* Scans the summary buckets for deleted notes
+ * The data of the bucket slots that are no longer referenced by a RRV value
+ * and the free space between the slots are carved for note headers
+ * The summary buckets are divided in ranges that are scanned by separate threads
+ * if multi-threading is supported and the file IO handle can be cloned
+ * The recovered notes are appended to the recovered notes array as RRV values
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_note_recovery_scan(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *summary_bucket_list,
+     int number_of_threads,
+     libcdata_array_t *recovered_notes,
+     int *abort,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_recovery_segment_t *segment  = NULL;
+	libnsfdb_note_recovery_segment_t *segments = NULL;
+	libnsfdb_rrv_value_t *rrv_value            = NULL;
+	off64_t *bucket_offsets                    = NULL;
+	uint64_t *live_slot_keys                   = NULL;
+	static char *function                      = "libnsfdb_note_recovery_scan";
+	size64_t element_size                      = 0;
+	uint32_t element_flags                     = 0;
+	int element_file_index                     = 0;
+	int entry_index                            = 0;
+	int note_index                             = 0;
+	int number_of_buckets                      = 0;
+	int number_of_buckets_per_segment          = 0;
+	int number_of_live_slot_keys               = 0;
+	int number_of_segments                     = 0;
+	int segment_index                          = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *clone_error             = NULL;
+	int abort_value                            = 0;
+	int result                                 = 0;
+	int use_threads                            = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBNSFDB_MAXIMUM_NUMBER_OF_RECOVERY_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_notes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered notes.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid abort.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_get_number_of_elements(
+	     summary_bucket_list,
+	     &number_of_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of summary buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_buckets <= 0 )
+	{
+		return( 1 );
+	}
+	if( libnsfdb_note_recovery_get_live_slot_keys(
+	     io_handle,
+	     file_io_handle,
+	     &live_slot_keys,
+	     &number_of_live_slot_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve live slot keys.",
+		 function );
+
+		goto on_error;
+	}
+	/* The offsets of the summary buckets are retrieved up front
+	 * since the bucket list is not safe to use from multiple threads
+	 */
+	if( (size_t) number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of summary buckets value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	bucket_offsets = (off64_t *) memory_allocate(
+	                              sizeof( off64_t ) * (size_t) number_of_buckets );
+
+	if( bucket_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_buckets;
+	     entry_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     summary_bucket_list,
+		     entry_index,
+		     &element_file_index,
+		     &( bucket_offsets[ entry_index ] ),
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve summary bucket: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	/* Every range contains at least a single summary bucket
+	 */
+	number_of_segments = number_of_threads;
+
+	if( number_of_segments > number_of_buckets )
+	{
+		number_of_segments = number_of_buckets;
+	}
+	segments = (libnsfdb_note_recovery_segment_t *) memory_allocate(
+	                                                 sizeof( libnsfdb_note_recovery_segment_t ) * (size_t) number_of_segments );
+
+	if( segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segments.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     segments,
+	     0,
+	     sizeof( libnsfdb_note_recovery_segment_t ) * (size_t) number_of_segments ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segments.",
+		 function );
+
+		memory_free(
+		 segments );
+
+		segments = NULL;
+
+		goto on_error;
+	}
+	number_of_buckets_per_segment = number_of_buckets / number_of_segments;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( segments[ segment_index ] );
+
+		segment->file_io_handle           = file_io_handle;
+		segment->bucket_offsets           = bucket_offsets;
+		segment->first_bucket_index       = (uint32_t) ( ( number_of_buckets_per_segment * segment_index ) + 1 );
+		segment->live_slot_keys           = live_slot_keys;
+		segment->number_of_live_slot_keys = number_of_live_slot_keys;
+		segment->abort                    = abort;
+
+		if( segment_index == ( number_of_segments - 1 ) )
+		{
+			segment->end_bucket_index = (uint32_t) ( number_of_buckets + 1 );
+		}
+		else
+		{
+			segment->end_bucket_index = (uint32_t) ( ( number_of_buckets_per_segment * ( segment_index + 1 ) ) + 1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Every thread reads using its own clone of the file IO handle
+	 * the ranges are scanned sequentially if the file IO handle cannot be cloned
+	 */
+	if( number_of_segments > 1 )
+	{
+		use_threads = 1;
+
+		for( segment_index = 1;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( segments[ segment_index ] );
+
+			segment->file_io_handle = NULL;
+
+			if( libbfio_handle_clone(
+			     &( segment->file_io_handle ),
+			     file_io_handle,
+			     &clone_error ) != 1 )
+			{
+				use_threads = 0;
+			}
+			else
+			{
+				segment->file_io_handle_cloned = 1;
+
+				result = libbfio_handle_is_open(
+				          segment->file_io_handle,
+				          &clone_error );
+
+				if( result == 0 )
+				{
+					result = libbfio_handle_open(
+					          segment->file_io_handle,
+					          LIBBFIO_OPEN_READ,
+					          &clone_error );
+				}
+				if( result != 1 )
+				{
+					use_threads = 0;
+				}
+			}
+			if( use_threads == 0 )
+			{
+				libcerror_error_free(
+				 &clone_error );
+
+				break;
+			}
+		}
+		if( use_threads == 0 )
+		{
+			for( segment_index = 1;
+			     segment_index < number_of_segments;
+			     segment_index++ )
+			{
+				segment = &( segments[ segment_index ] );
+
+				if( segment->file_io_handle_cloned != 0 )
+				{
+					libbfio_handle_close(
+					 segment->file_io_handle,
+					 NULL );
+					libbfio_handle_free(
+					 &( segment->file_io_handle ),
+					 NULL );
+
+					segment->file_io_handle_cloned = 0;
+				}
+				segment->file_io_handle = file_io_handle;
+			}
+		}
+	}
+	if( use_threads != 0 )
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( segments[ segment_index ] );
+
+			if( libcthreads_thread_create(
+			     &( segment->thread ),
+			     NULL,
+			     (int (*)(void *)) &libnsfdb_note_recovery_scan_segment,
+			     (void *) segment,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( segments[ segment_index ] );
+
+			if( libcthreads_thread_join(
+			     &( segment->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			libnsfdb_note_recovery_scan_segment(
+			 &( segments[ segment_index ] ) );
+		}
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( segments[ segment_index ] );
+
+		if( segment->result != 1 )
+		{
+			/* Pass the error of the segment on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error         = segment->error;
+				segment->error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+	}
+	if( *abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		goto on_error;
+	}
+	/* The segments are in order of their range hence the recovered notes
+	 * are sorted by bucket index and offset
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( segments[ segment_index ] );
+
+		for( note_index = 0;
+		     note_index < segment->number_of_notes;
+		     note_index++ )
+		{
+			if( libnsfdb_rrv_value_initialize(
+			     &rrv_value,
+			     segment->notes[ note_index ].rrv_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create RRV value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libnsfdb_rrv_value_set_bucket_data_range(
+			     rrv_value,
+			     segment->notes[ note_index ].bucket_index,
+			     segment->notes[ note_index ].data_offset,
+			     segment->notes[ note_index ].data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set bucket data range in RRV value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdata_array_append_entry(
+			     recovered_notes,
+			     &entry_index,
+			     (intptr_t *) rrv_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append RRV value to recovered notes array.",
+				 function );
+
+				goto on_error;
+			}
+			rrv_value = NULL;
+		}
+	}
+	if( libnsfdb_note_recovery_free_segments(
+	     &segments,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free segments.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 bucket_offsets );
+
+	if( live_slot_keys != NULL )
+	{
+		memory_free(
+		 live_slot_keys );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( segments != NULL )
+	{
+		/* Stop the remaining threads without overwriting the abort value of the caller
+		 */
+		abort_value = *abort;
+		*abort      = 1;
+
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			if( segments[ segment_index ].thread != NULL )
+			{
+				libcthreads_thread_join(
+				 &( segments[ segment_index ].thread ),
+				 NULL );
+			}
+		}
+		*abort = abort_value;
+	}
+#endif
+	if( rrv_value != NULL )
+	{
+		libnsfdb_rrv_value_free(
+		 &rrv_value,
+		 NULL );
+	}
+	if( segments != NULL )
+	{
+		libnsfdb_note_recovery_free_segments(
+		 &segments,
+		 number_of_segments,
+		 NULL );
+	}
+	if( bucket_offsets != NULL )
+	{
+		memory_free(
+		 bucket_offsets );
+	}
+	if( live_slot_keys != NULL )
+	{
+		memory_free(
+		 live_slot_keys );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,182 @@
+/*
+ * Note recovery functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_NOTE_RECOVERY_H )
+#define _LIBNSFDB_NOTE_RECOVERY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_bucket.h"
+#include "libnsfdb_io_handle.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcdata.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libcthreads.h"
+#include "libnsfdb_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_recovered_note libnsfdb_recovered_note_t;
+
+struct libnsfdb_recovered_note
+{
+	/* The bucket index
+	 */
+	uint32_t bucket_index;
+
+	/* The offset of the note data in the bucket
+	 */
+	uint32_t data_offset;
+
+	/* The size of the note data
+	 */
+	uint32_t data_size;
+
+	/* The RRV identifier stored in the note header
+	 */
+	uint32_t rrv_identifier;
+};
+
+typedef struct libnsfdb_note_recovery_segment libnsfdb_note_recovery_segment_t;
+
+struct libnsfdb_note_recovery_segment
+{
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was cloned for the segment
+	 */
+	uint8_t file_io_handle_cloned;
+
+	/* The summary bucket offsets
+	 * The offsets are shared by all the segments
+	 */
+	off64_t *bucket_offsets;
+
+	/* The index of the first summary bucket of the segment
+	 */
+	uint32_t first_bucket_index;
+
+	/* The index of the summary bucket after the last summary bucket of the segment
+	 */
+	uint32_t end_bucket_index;
+
+	/* The sorted keys of the bucket slots that are referenced by a RRV value
+	 * The keys are shared by all the segments
+	 */
+	uint64_t *live_slot_keys;
+
+	/* The number of live slot keys
+	 */
+	int number_of_live_slot_keys;
+
+	/* The recovered notes
+	 */
+	libnsfdb_recovered_note_t *notes;
+
+	/* The number of recovered notes
+	 */
+	int number_of_notes;
+
+	/* The maximum number of recovered notes
+	 */
+	int maximum_number_of_notes;
+
+	/* The value to indicate if abort was signalled
+	 */
+	int *abort;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+int libnsfdb_note_recovery_segment_append_note(
+     libnsfdb_note_recovery_segment_t *segment,
+     uint32_t bucket_index,
+     uint32_t data_offset,
+     uint32_t data_size,
+     uint32_t rrv_identifier,
+     libcerror_error_t **error );
+
+int libnsfdb_note_recovery_is_live_slot(
+     uint64_t *live_slot_keys,
+     int number_of_live_slot_keys,
+     uint32_t bucket_index,
+     uint16_t slot_index );
+
+int libnsfdb_note_recovery_check_note(
+     const uint8_t *note_data,
+     size_t note_data_size,
+     uint32_t *note_size,
+     uint32_t *rrv_identifier,
+     libcerror_error_t **error );
+
+int libnsfdb_note_recovery_carve_bucket(
+     libnsfdb_note_recovery_segment_t *segment,
+     libnsfdb_bucket_t *bucket,
+     uint32_t bucket_index,
+     libcerror_error_t **error );
+
+int libnsfdb_note_recovery_scan_segment(
+     libnsfdb_note_recovery_segment_t *segment );
+
+int libnsfdb_note_recovery_free_segments(
+     libnsfdb_note_recovery_segment_t **segments,
+     int number_of_segments,
+     libcerror_error_t **error );
+
+int libnsfdb_note_recovery_get_live_slot_keys(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t **live_slot_keys,
+     int *number_of_live_slot_keys,
+     libcerror_error_t **error );
+
+int libnsfdb_note_recovery_scan(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfdata_list_t *summary_bucket_list,
+     int number_of_threads,
+     libcdata_array_t *recovered_notes,
+     int *abort,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_NOTE_RECOVERY_H ) */
+
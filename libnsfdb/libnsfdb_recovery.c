@@ -0,0 +1,1719 @@
+/*
+ * Recovery functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_bucket.h"
+#include "libnsfdb_checksum.h"
+#include "libnsfdb_definitions.h"
+#include "libnsfdb_io_handle.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcdata.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libcnotify.h"
+#include "libnsfdb_libcthreads.h"
+#include "libnsfdb_libfdata.h"
+#include "libnsfdb_recovery.h"
+#include "libnsfdb_rrv_bucket_descriptor.h"
+
+#include "nsfdb_bucket.h"
+#include "nsfdb_note.h"
+#include "nsfdb_rrv_bucket.h"
+
+/* Appends a recovered structure to a recovery segment
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_recovery_segment_append_structure(
+     libnsfdb_recovery_segment_t *segment,
+     uint8_t structure_type,
+     off64_t file_offset,
+     uint32_t size,
+     uint32_t initial_rrv_identifier,
+     libcerror_error_t **error )
+{
+	libnsfdb_recovered_structure_t *structure = NULL;
+	void *reallocation                        = NULL;
+	static char *function                     = "libnsfdb_recovery_segment_append_structure";
+	size_t structures_size                    = 0;
+	int maximum_number_of_structures          = 0;
+
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment->number_of_structures >= segment->maximum_number_of_structures )
+	{
+		if( segment->maximum_number_of_structures == 0 )
+		{
+			maximum_number_of_structures = 256;
+		}
+		else
+		{
+			maximum_number_of_structures = segment->maximum_number_of_structures * 2;
+		}
+		if( maximum_number_of_structures <= segment->number_of_structures )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of structures value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		structures_size = sizeof( libnsfdb_recovered_structure_t ) * (size_t) maximum_number_of_structures;
+
+		if( structures_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid structures size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                segment->structures,
+		                structures_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize structures.",
+			 function );
+
+			return( -1 );
+		}
+		segment->structures                   = (libnsfdb_recovered_structure_t *) reallocation;
+		segment->maximum_number_of_structures = maximum_number_of_structures;
+	}
+	structure = &( segment->structures[ segment->number_of_structures ] );
+
+	structure->type                   = structure_type;
+	structure->file_offset            = file_offset;
+	structure->size                   = size;
+	structure->initial_rrv_identifier = initial_rrv_identifier;
+
+	segment->number_of_structures += 1;
+
+	return( 1 );
+}
+
+/* Checks if the data at a specific offset contains a bucket
+ * The header data must contain the data at the file offset
+ * Buckets do not contain a verifiable checksum, hence the bucket is
+ * validated by reading its slot index and slots
+ * Returns 1 if a bucket was found, 0 if not or -1 on error
+ */
+int libnsfdb_recovery_check_bucket(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     const uint8_t *header_data,
+     size_t header_data_size,
+     off64_t file_offset,
+     uint8_t *structure_type,
+     uint32_t *bucket_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_bucket_t *bucket           = NULL;
+	libnsfdb_bucket_slot_t *bucket_slot = NULL;
+	libcerror_error_t *read_error       = NULL;
+	static char *function               = "libnsfdb_recovery_check_bucket";
+	uint32_t number_of_slots            = 0;
+	uint32_t stored_size                = 0;
+	uint16_t note_signature             = 0;
+	uint8_t is_non_summary_size         = 0;
+	uint8_t is_summary_size             = 0;
+	int result                          = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid header data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( structure_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure type.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket size.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_data_size < sizeof( nsfdb_bucket_header_t ) )
+	{
+		return( 0 );
+	}
+	if( ( ( (nsfdb_bucket_header_t *) header_data )->signature != 0x02 )
+	 || ( ( (nsfdb_bucket_header_t *) header_data )->header_size != 0x42 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_bucket_header_t *) header_data )->size,
+	 stored_size );
+
+	if( ( stored_size <= ( sizeof( nsfdb_bucket_header_t ) + sizeof( nsfdb_bucket_footer_t ) ) )
+	 || ( (size64_t) file_offset >= file_size )
+	 || ( (size64_t) stored_size > ( file_size - (size64_t) file_offset ) )
+	 || ( (size64_t) stored_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	/* A minimum or maximum size of 0 represents a size that is not bounded
+	 */
+	if( ( ( io_handle->minimum_summary_bucket_size == 0 )
+	  ||  ( stored_size >= io_handle->minimum_summary_bucket_size ) )
+	 && ( ( io_handle->maximum_summary_bucket_size == 0 )
+	  ||  ( stored_size <= io_handle->maximum_summary_bucket_size ) ) )
+	{
+		is_summary_size = 1;
+	}
+	if( ( ( io_handle->minimum_non_summary_bucket_size == 0 )
+	  ||  ( stored_size >= io_handle->minimum_non_summary_bucket_size ) )
+	 && ( ( io_handle->maximum_non_summary_bucket_size == 0 )
+	  ||  ( stored_size <= io_handle->maximum_non_summary_bucket_size ) ) )
+	{
+		is_non_summary_size = 1;
+	}
+	if( ( is_summary_size == 0 )
+	 && ( is_non_summary_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libnsfdb_bucket_initialize(
+	     &bucket,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bucket.",
+		 function );
+
+		goto on_error;
+	}
+	/* A bucket of which the slot index or slots cannot be read is not considered a bucket
+	 */
+	if( libnsfdb_bucket_read(
+	     bucket,
+	     file_io_handle,
+	     file_offset,
+	     &read_error ) != 1 )
+	{
+		libcerror_error_free(
+		 &read_error );
+
+		result = 0;
+	}
+	else
+	{
+		if( libnsfdb_bucket_get_number_of_slots(
+		     bucket,
+		     &number_of_slots,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of slots.",
+			 function );
+
+			goto on_error;
+		}
+		/* The slots of a summary bucket contain the note headers
+		 * The size is only used if it matches a single type of bucket
+		 */
+		if( is_non_summary_size == 0 )
+		{
+			*structure_type = LIBNSFDB_RECOVERED_STRUCTURE_TYPE_SUMMARY_BUCKET;
+		}
+		else
+		{
+			*structure_type = LIBNSFDB_RECOVERED_STRUCTURE_TYPE_NON_SUMMARY_BUCKET;
+		}
+		if( ( is_summary_size != 0 )
+		 && ( is_non_summary_size != 0 )
+		 && ( number_of_slots > 0 ) )
+		{
+			if( libnsfdb_bucket_get_slot(
+			     bucket,
+			     0,
+			     &bucket_slot,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve slot: 0.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( bucket_slot != NULL )
+			 && ( bucket_slot->data != NULL )
+			 && ( bucket_slot->size >= sizeof( nsfdb_note_header_t ) ) )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 ( (nsfdb_note_header_t *) bucket_slot->data )->signature,
+				 note_signature );
+
+				if( note_signature == 0x0004 )
+				{
+					*structure_type = LIBNSFDB_RECOVERED_STRUCTURE_TYPE_SUMMARY_BUCKET;
+				}
+			}
+		}
+		*bucket_size = stored_size;
+
+		result = 1;
+	}
+	if( libnsfdb_bucket_free(
+	     &bucket,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bucket.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( bucket != NULL )
+	{
+		libnsfdb_bucket_free(
+		 &bucket,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Checks if the data contains a RRV bucket
+ * The RRV bucket is validated by its XOR-32 checksum
+ * Returns 1 if a RRV bucket was found, 0 if not or -1 on error
+ */
+int libnsfdb_recovery_check_rrv_bucket(
+     const uint8_t *rrv_bucket_data,
+     size_t rrv_bucket_data_size,
+     uint32_t *initial_rrv_identifier,
+     libcerror_error_t **error )
+{
+	static char *function        = "libnsfdb_recovery_check_rrv_bucket";
+	uint32_t calculated_checksum = 0;
+	uint32_t stored_checksum     = 0;
+
+	if( rrv_bucket_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RRV bucket data.",
+		 function );
+
+		return( -1 );
+	}
+	if( rrv_bucket_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid RRV bucket data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( initial_rrv_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid initial RRV identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( rrv_bucket_data_size <= sizeof( nsfdb_rrv_bucket_header_t ) )
+	{
+		return( 0 );
+	}
+	if( ( ( (nsfdb_rrv_bucket_header_t *) rrv_bucket_data )->signature != 0x06 )
+	 || ( ( (nsfdb_rrv_bucket_header_t *) rrv_bucket_data )->header_size != 0x20 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_rrv_bucket_header_t *) rrv_bucket_data )->checksum,
+	 stored_checksum );
+
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     &( rrv_bucket_data[ sizeof( nsfdb_rrv_bucket_header_t ) ] ),
+	     rrv_bucket_data_size - sizeof( nsfdb_rrv_bucket_header_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_rrv_bucket_header_t *) rrv_bucket_data )->initial_rrv_identifier,
+	 *initial_rrv_identifier );
+
+	return( 1 );
+}
+
+/* Scans the file region of a recovery segment for buckets and RRV buckets
+ * The file is read in blocks, the structures are 256 bytes aligned
+ * This function is used as the thread function of the segment
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_recovery_scan_segment(
+     libnsfdb_recovery_segment_t *segment )
+{
+	libnsfdb_io_handle_t *io_handle  = NULL;
+	uint8_t *block_data              = NULL;
+	uint8_t *rrv_bucket_data         = NULL;
+	static char *function            = "libnsfdb_recovery_scan_segment";
+	size_t block_offset              = 0;
+	size_t read_size                 = 0;
+	ssize_t read_count               = 0;
+	off64_t file_offset              = 0;
+	off64_t structure_offset         = 0;
+	uint32_t initial_rrv_identifier  = 0;
+	uint32_t structure_size          = 0;
+	uint8_t structure_type           = 0;
+	int result                       = 0;
+
+	if( segment == NULL )
+	{
+		return( -1 );
+	}
+	io_handle = segment->io_handle;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment - missing IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( segment->start_offset < 0 )
+	 || ( ( segment->start_offset % 256 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment - start offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	block_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * LIBNSFDB_RECOVERY_SCAN_BLOCK_SIZE );
+
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+	/* RRV buckets are only searched for if the RRV bucket size is known
+	 */
+	if( io_handle->rrv_bucket_size > sizeof( nsfdb_rrv_bucket_header_t ) )
+	{
+		rrv_bucket_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * io_handle->rrv_bucket_size );
+
+		if( rrv_bucket_data == NULL )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create RRV bucket data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	file_offset = segment->start_offset;
+
+	while( ( file_offset < segment->end_offset )
+	    && ( (size64_t) file_offset < segment->file_size ) )
+	{
+		if( ( segment->abort != NULL )
+		 && ( *( segment->abort ) != 0 ) )
+		{
+			break;
+		}
+		read_size = LIBNSFDB_RECOVERY_SCAN_BLOCK_SIZE;
+
+		if( (size64_t) read_size > ( segment->file_size - (size64_t) file_offset ) )
+		{
+			read_size = (size_t) ( segment->file_size - (size64_t) file_offset );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              segment->file_io_handle,
+		              block_data,
+		              read_size,
+		              file_offset,
+		              &( segment->error ) );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		block_offset = 0;
+
+		while( ( block_offset + sizeof( nsfdb_rrv_bucket_header_t ) ) <= read_size )
+		{
+			structure_offset = file_offset + (off64_t) block_offset;
+
+			if( structure_offset >= segment->end_offset )
+			{
+				break;
+			}
+			structure_size = 0;
+
+			if( ( block_data[ block_offset ] == 0x02 )
+			 && ( block_data[ block_offset + 1 ] == 0x42 ) )
+			{
+				result = libnsfdb_recovery_check_bucket(
+				          io_handle,
+				          segment->file_io_handle,
+				          segment->file_size,
+				          &( block_data[ block_offset ] ),
+				          read_size - block_offset,
+				          structure_offset,
+				          &structure_type,
+				          &structure_size,
+				          &( segment->error ) );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 &( segment->error ),
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to check bucket at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 structure_offset,
+					 structure_offset );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					if( libnsfdb_recovery_segment_append_structure(
+					     segment,
+					     structure_type,
+					     structure_offset,
+					     structure_size,
+					     0,
+					     &( segment->error ) ) != 1 )
+					{
+						libcerror_error_set(
+						 &( segment->error ),
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append bucket.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				else
+				{
+					structure_size = 0;
+				}
+			}
+			/* RRV buckets are aligned to the RRV bucket size
+			 */
+			else if( ( rrv_bucket_data != NULL )
+			      && ( block_data[ block_offset ] == 0x06 )
+			      && ( block_data[ block_offset + 1 ] == 0x20 )
+			      && ( ( structure_offset % io_handle->rrv_bucket_size ) == 0 )
+			      && ( (size64_t) io_handle->rrv_bucket_size <= ( segment->file_size - (size64_t) structure_offset ) ) )
+			{
+				if( ( block_offset + io_handle->rrv_bucket_size ) <= read_size )
+				{
+					result = libnsfdb_recovery_check_rrv_bucket(
+					          &( block_data[ block_offset ] ),
+					          (size_t) io_handle->rrv_bucket_size,
+					          &initial_rrv_identifier,
+					          &( segment->error ) );
+				}
+				else
+				{
+					/* The RRV bucket continues in the next block
+					 */
+					read_count = libbfio_handle_read_buffer_at_offset(
+					              segment->file_io_handle,
+					              rrv_bucket_data,
+					              (size_t) io_handle->rrv_bucket_size,
+					              structure_offset,
+					              &( segment->error ) );
+
+					if( read_count != (ssize_t) io_handle->rrv_bucket_size )
+					{
+						libcerror_error_set(
+						 &( segment->error ),
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read RRV bucket at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+						 function,
+						 structure_offset,
+						 structure_offset );
+
+						goto on_error;
+					}
+					result = libnsfdb_recovery_check_rrv_bucket(
+					          rrv_bucket_data,
+					          (size_t) io_handle->rrv_bucket_size,
+					          &initial_rrv_identifier,
+					          &( segment->error ) );
+				}
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 &( segment->error ),
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to check RRV bucket at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 structure_offset,
+					 structure_offset );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					structure_size = io_handle->rrv_bucket_size;
+
+					if( libnsfdb_recovery_segment_append_structure(
+					     segment,
+					     LIBNSFDB_RECOVERED_STRUCTURE_TYPE_RRV_BUCKET,
+					     structure_offset,
+					     structure_size,
+					     initial_rrv_identifier,
+					     &( segment->error ) ) != 1 )
+					{
+						libcerror_error_set(
+						 &( segment->error ),
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append RRV bucket.",
+						 function );
+
+						goto on_error;
+					}
+				}
+			}
+			/* Continue after a recovered structure, at the next 256 bytes aligned offset
+			 */
+			if( structure_size > 0 )
+			{
+				block_offset += ( (size_t) structure_size + 255 ) & ~( (size_t) 255 );
+			}
+			else
+			{
+				block_offset += 256;
+			}
+		}
+		/* The remainder of a block that is too small to contain a structure
+		 * is only at the end of the file
+		 */
+		if( block_offset < read_size )
+		{
+			block_offset = read_size;
+		}
+		file_offset += (off64_t) block_offset;
+	}
+	if( rrv_bucket_data != NULL )
+	{
+		memory_free(
+		 rrv_bucket_data );
+	}
+	memory_free(
+	 block_data );
+
+	segment->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( rrv_bucket_data != NULL )
+	{
+		memory_free(
+		 rrv_bucket_data );
+	}
+	if( block_data != NULL )
+	{
+		memory_free(
+		 block_data );
+	}
+	segment->result = -1;
+
+	return( -1 );
+}
+
+/* Frees recovery segments
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_recovery_free_segments(
+     libnsfdb_recovery_segment_t **segments,
+     int number_of_segments,
+     libcerror_error_t **error )
+{
+	libnsfdb_recovery_segment_t *segment = NULL;
+	static char *function                = "libnsfdb_recovery_free_segments";
+	int result                           = 1;
+	int segment_index                    = 0;
+
+	if( segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segments != NULL )
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( ( *segments )[ segment_index ] );
+
+			if( segment->file_io_handle_cloned != 0 )
+			{
+				if( libbfio_handle_close(
+				     segment->file_io_handle,
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close file IO handle of segment: %d.",
+					 function,
+					 segment_index );
+
+					result = -1;
+				}
+				if( libbfio_handle_free(
+				     &( segment->file_io_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free file IO handle of segment: %d.",
+					 function,
+					 segment_index );
+
+					result = -1;
+				}
+			}
+			if( segment->structures != NULL )
+			{
+				memory_free(
+				 segment->structures );
+			}
+			if( segment->error != NULL )
+			{
+				libcerror_error_free(
+				 &( segment->error ) );
+			}
+		}
+		memory_free(
+		 *segments );
+
+		*segments = NULL;
+	}
+	return( result );
+}
+
+/* Rebuilds the bucket lists and RRV bucket descriptors from the recovered structures
+ * The recovered structures must be sorted by file offset
+ * The buckets are numbered in order of their file offset
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_recovery_rebuild(
+     libnsfdb_io_handle_t *io_handle,
+     libnsfdb_recovered_structure_t *structures,
+     int number_of_structures,
+     off64_t non_data_rrv_bucket_offset,
+     off64_t data_rrv_bucket_offset,
+     libfdata_list_t *summary_bucket_list,
+     libfdata_list_t *non_summary_bucket_list,
+     libcerror_error_t **error )
+{
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	int *rrv_bucket_indexes                                 = NULL;
+	static char *function                                   = "libnsfdb_recovery_rebuild";
+	uint32_t data_initial_rrv_identifier                    = 0;
+	uint32_t initial_rrv_identifier                         = 0;
+	uint32_t non_data_initial_rrv_identifier                = 0;
+	uint8_t data_rrv_bucket_found                           = 0;
+	uint8_t non_data_rrv_bucket_found                       = 0;
+	int number_of_non_summary_buckets                       = 0;
+	int number_of_rrv_buckets                               = 0;
+	int number_of_summary_buckets                           = 0;
+	int non_summary_bucket_index                            = 0;
+	int rrv_bucket_index                                    = 0;
+	int sort_index                                          = 0;
+	int structure_index                                     = 0;
+	int summary_bucket_index                                = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( structures == NULL )
+	 && ( number_of_structures != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structures.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_structures < 0 )
+	 || ( (size_t) number_of_structures > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of structures value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( structure_index = 0;
+	     structure_index < number_of_structures;
+	     structure_index++ )
+	{
+		switch( structures[ structure_index ].type )
+		{
+			case LIBNSFDB_RECOVERED_STRUCTURE_TYPE_NON_SUMMARY_BUCKET:
+				number_of_non_summary_buckets++;
+				break;
+
+			case LIBNSFDB_RECOVERED_STRUCTURE_TYPE_RRV_BUCKET:
+				if( structures[ structure_index ].file_offset == data_rrv_bucket_offset )
+				{
+					data_initial_rrv_identifier = structures[ structure_index ].initial_rrv_identifier;
+					data_rrv_bucket_found       = 1;
+				}
+				else if( structures[ structure_index ].file_offset == non_data_rrv_bucket_offset )
+				{
+					non_data_initial_rrv_identifier = structures[ structure_index ].initial_rrv_identifier;
+					non_data_rrv_bucket_found       = 1;
+				}
+				number_of_rrv_buckets++;
+				break;
+
+			case LIBNSFDB_RECOVERED_STRUCTURE_TYPE_SUMMARY_BUCKET:
+				number_of_summary_buckets++;
+				break;
+
+			default:
+				break;
+		}
+	}
+	if( libfdata_list_resize(
+	     summary_bucket_list,
+	     number_of_summary_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_resize(
+	     non_summary_bucket_list,
+	     number_of_non_summary_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize non-summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_rrv_buckets > 0 )
+	{
+		rrv_bucket_indexes = (int *) memory_allocate(
+		                              sizeof( int ) * (size_t) number_of_rrv_buckets );
+
+		if( rrv_bucket_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create RRV bucket indexes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	number_of_rrv_buckets = 0;
+
+	for( structure_index = 0;
+	     structure_index < number_of_structures;
+	     structure_index++ )
+	{
+		if( structures[ structure_index ].type == LIBNSFDB_RECOVERED_STRUCTURE_TYPE_SUMMARY_BUCKET )
+		{
+			if( libfdata_list_set_element_by_index(
+			     summary_bucket_list,
+			     summary_bucket_index,
+			     0,
+			     structures[ structure_index ].file_offset,
+			     (size64_t) 0,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set summary bucket: %d.",
+				 function,
+				 summary_bucket_index );
+
+				goto on_error;
+			}
+			summary_bucket_index++;
+		}
+		else if( structures[ structure_index ].type == LIBNSFDB_RECOVERED_STRUCTURE_TYPE_NON_SUMMARY_BUCKET )
+		{
+			if( libfdata_list_set_element_by_index(
+			     non_summary_bucket_list,
+			     non_summary_bucket_index,
+			     0,
+			     structures[ structure_index ].file_offset,
+			     (size64_t) 0,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set non-summary bucket: %d.",
+				 function,
+				 non_summary_bucket_index );
+
+				goto on_error;
+			}
+			non_summary_bucket_index++;
+		}
+		else if( structures[ structure_index ].type == LIBNSFDB_RECOVERED_STRUCTURE_TYPE_RRV_BUCKET )
+		{
+			initial_rrv_identifier = structures[ structure_index ].initial_rrv_identifier;
+
+			/* Insert the RRV bucket sorted by initial RRV identifier
+			 * the first of the RRV buckets with the same initial RRV identifier is kept
+			 */
+			for( sort_index = number_of_rrv_buckets;
+			     sort_index > 0;
+			     sort_index-- )
+			{
+				if( structures[ rrv_bucket_indexes[ sort_index - 1 ] ].initial_rrv_identifier <= initial_rrv_identifier )
+				{
+					break;
+				}
+			}
+			if( ( sort_index > 0 )
+			 && ( structures[ rrv_bucket_indexes[ sort_index - 1 ] ].initial_rrv_identifier == initial_rrv_identifier ) )
+			{
+				continue;
+			}
+			for( rrv_bucket_index = number_of_rrv_buckets;
+			     rrv_bucket_index > sort_index;
+			     rrv_bucket_index-- )
+			{
+				rrv_bucket_indexes[ rrv_bucket_index ] = rrv_bucket_indexes[ rrv_bucket_index - 1 ];
+			}
+			rrv_bucket_indexes[ sort_index ] = structure_index;
+
+			number_of_rrv_buckets++;
+		}
+	}
+	if( libcdata_array_empty(
+	     io_handle->rrv_bucket_descriptors,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_bucket_descriptor_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty RRV bucket descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_rrv_buckets > 0 )
+	{
+		if( libcdata_array_resize(
+		     io_handle->rrv_bucket_descriptors,
+		     number_of_rrv_buckets,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_bucket_descriptor_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize RRV bucket descriptors array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( rrv_bucket_index = 0;
+	     rrv_bucket_index < number_of_rrv_buckets;
+	     rrv_bucket_index++ )
+	{
+		structure_index        = rrv_bucket_indexes[ rrv_bucket_index ];
+		initial_rrv_identifier = structures[ structure_index ].initial_rrv_identifier;
+
+		if( libnsfdb_rrv_bucket_descriptor_initialize(
+		     &rrv_bucket_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create RRV bucket descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		rrv_bucket_descriptor->file_offset            = structures[ structure_index ].file_offset;
+		rrv_bucket_descriptor->initial_rrv_identifier = initial_rrv_identifier;
+
+		/* The type of a RRV bucket is determined by the first data and non-data RRV buckets
+		 * referenced by the database header, the non-data RRV identifiers precede
+		 * the data RRV identifiers unless the database header indicates otherwise
+		 */
+		if( data_rrv_bucket_found == 0 )
+		{
+			rrv_bucket_descriptor->type = LIBNSFDB_RRV_BUCKET_TYPE_DATA;
+		}
+		else if( ( non_data_rrv_bucket_found != 0 )
+		      && ( non_data_initial_rrv_identifier > data_initial_rrv_identifier ) )
+		{
+			if( initial_rrv_identifier >= non_data_initial_rrv_identifier )
+			{
+				rrv_bucket_descriptor->type = LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA;
+			}
+			else
+			{
+				rrv_bucket_descriptor->type = LIBNSFDB_RRV_BUCKET_TYPE_DATA;
+			}
+		}
+		else if( initial_rrv_identifier >= data_initial_rrv_identifier )
+		{
+			rrv_bucket_descriptor->type = LIBNSFDB_RRV_BUCKET_TYPE_DATA;
+		}
+		else
+		{
+			rrv_bucket_descriptor->type = LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     io_handle->rrv_bucket_descriptors,
+		     rrv_bucket_index,
+		     (intptr_t *) rrv_bucket_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set RRV bucket descriptors array entry: %d.",
+			 function,
+			 rrv_bucket_index );
+
+			goto on_error;
+		}
+		rrv_bucket_descriptor = NULL;
+	}
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: recovered %d summary buckets, %d non-summary buckets and %d RRV buckets.\n",
+		 function,
+		 number_of_summary_buckets,
+		 number_of_non_summary_buckets,
+		 number_of_rrv_buckets );
+	}
+#endif
+	if( rrv_bucket_indexes != NULL )
+	{
+		memory_free(
+		 rrv_bucket_indexes );
+	}
+	return( 1 );
+
+on_error:
+	if( rrv_bucket_descriptor != NULL )
+	{
+		libnsfdb_rrv_bucket_descriptor_free(
+		 &rrv_bucket_descriptor,
+		 NULL );
+	}
+	if( rrv_bucket_indexes != NULL )
+	{
+		memory_free(
+		 rrv_bucket_indexes );
+	}
+	libcdata_array_empty(
+	 io_handle->rrv_bucket_descriptors,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_bucket_descriptor_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Scans a file for buckets and RRV buckets and rebuilds the bucket lists
+ * and RRV bucket descriptors from the structures that were found
+ * The file is divided in regions that are scanned by separate threads
+ * if multi-threading is supported and the file IO handle can be cloned
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_recovery_scan_file(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     off64_t non_data_rrv_bucket_offset,
+     off64_t data_rrv_bucket_offset,
+     libfdata_list_t *summary_bucket_list,
+     libfdata_list_t *non_summary_bucket_list,
+     int *abort,
+     libcerror_error_t **error )
+{
+	libnsfdb_recovered_structure_t *structures = NULL;
+	libnsfdb_recovery_segment_t *segment       = NULL;
+	libnsfdb_recovery_segment_t *segments      = NULL;
+	static char *function                      = "libnsfdb_recovery_scan_file";
+	size64_t file_size                         = 0;
+	size64_t region_size                       = 0;
+	off64_t end_of_structure_offset            = 0;
+	int number_of_segments                     = 0;
+	int number_of_structures                   = 0;
+	int segment_index                          = 0;
+	int structure_index                        = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *clone_error             = NULL;
+	int abort_value                            = 0;
+	int result                                 = 0;
+	int use_threads                            = 0;
+#endif
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LIBNSFDB_MAXIMUM_NUMBER_OF_RECOVERY_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid abort.",
+		 function );
+
+		return( -1 );
+	}
+	/* The size of the file is used instead of the file size in the database header
+	 * since the database header could be inconsistent with the damaged file
+	 */
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every region contains at least a single block
+	 */
+	number_of_segments = number_of_threads;
+
+	if( (size64_t) number_of_segments > ( file_size / LIBNSFDB_RECOVERY_SCAN_BLOCK_SIZE ) )
+	{
+		number_of_segments = (int) ( file_size / LIBNSFDB_RECOVERY_SCAN_BLOCK_SIZE );
+	}
+	if( number_of_segments < 1 )
+	{
+		number_of_segments = 1;
+	}
+	segments = (libnsfdb_recovery_segment_t *) memory_allocate(
+	                                            sizeof( libnsfdb_recovery_segment_t ) * (size_t) number_of_segments );
+
+	if( segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segments.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     segments,
+	     0,
+	     sizeof( libnsfdb_recovery_segment_t ) * (size_t) number_of_segments ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segments.",
+		 function );
+
+		memory_free(
+		 segments );
+
+		segments = NULL;
+
+		goto on_error;
+	}
+	/* The regions start at a 256 bytes aligned offset, a structure that starts
+	 * in a region is recovered by the segment of that region
+	 */
+	region_size = ( file_size / number_of_segments ) & ~( (size64_t) 255 );
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( segments[ segment_index ] );
+
+		segment->io_handle      = io_handle;
+		segment->file_io_handle = file_io_handle;
+		segment->file_size      = file_size;
+		segment->start_offset   = (off64_t) ( region_size * segment_index );
+		segment->abort          = abort;
+
+		if( segment_index == ( number_of_segments - 1 ) )
+		{
+			segment->end_offset = (off64_t) file_size;
+		}
+		else
+		{
+			segment->end_offset = (off64_t) ( region_size * ( segment_index + 1 ) );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Every thread reads using its own clone of the file IO handle
+	 * the regions are scanned sequentially if the file IO handle cannot be cloned
+	 */
+	if( number_of_segments > 1 )
+	{
+		use_threads = 1;
+
+		for( segment_index = 1;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( segments[ segment_index ] );
+
+			segment->file_io_handle = NULL;
+
+			if( libbfio_handle_clone(
+			     &( segment->file_io_handle ),
+			     file_io_handle,
+			     &clone_error ) != 1 )
+			{
+				use_threads = 0;
+			}
+			else
+			{
+				segment->file_io_handle_cloned = 1;
+
+				result = libbfio_handle_is_open(
+				          segment->file_io_handle,
+				          &clone_error );
+
+				if( result == 0 )
+				{
+					result = libbfio_handle_open(
+					          segment->file_io_handle,
+					          LIBBFIO_OPEN_READ,
+					          &clone_error );
+				}
+				if( result != 1 )
+				{
+					use_threads = 0;
+				}
+			}
+			if( use_threads == 0 )
+			{
+				libcerror_error_free(
+				 &clone_error );
+
+				break;
+			}
+		}
+		if( use_threads == 0 )
+		{
+			for( segment_index = 1;
+			     segment_index < number_of_segments;
+			     segment_index++ )
+			{
+				segment = &( segments[ segment_index ] );
+
+				if( segment->file_io_handle_cloned != 0 )
+				{
+					libbfio_handle_close(
+					 segment->file_io_handle,
+					 NULL );
+					libbfio_handle_free(
+					 &( segment->file_io_handle ),
+					 NULL );
+
+					segment->file_io_handle_cloned = 0;
+				}
+				segment->file_io_handle = file_io_handle;
+			}
+		}
+	}
+	if( use_threads != 0 )
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( segments[ segment_index ] );
+
+			if( libcthreads_thread_create(
+			     &( segment->thread ),
+			     NULL,
+			     (int (*)(void *)) &libnsfdb_recovery_scan_segment,
+			     (void *) segment,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( segments[ segment_index ] );
+
+			if( libcthreads_thread_join(
+			     &( segment->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			libnsfdb_recovery_scan_segment(
+			 &( segments[ segment_index ] ) );
+		}
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( segments[ segment_index ] );
+
+		if( segment->result != 1 )
+		{
+			/* Pass the error of the segment on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error         = segment->error;
+				segment->error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( segment->number_of_structures > ( INT_MAX - number_of_structures ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of structures value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_structures += segment->number_of_structures;
+	}
+	if( *abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_structures > 0 )
+	{
+		if( (size_t) number_of_structures > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libnsfdb_recovered_structure_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of structures value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		structures = (libnsfdb_recovered_structure_t *) memory_allocate(
+		                                                 sizeof( libnsfdb_recovered_structure_t ) * (size_t) number_of_structures );
+
+		if( structures == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create structures.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The segments are in order of their region hence the structures are sorted by file offset
+	 * A structure that starts inside a structure that was recovered by the preceding segment
+	 * is ignored
+	 */
+	number_of_structures = 0;
+
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( segments[ segment_index ] );
+
+		for( structure_index = 0;
+		     structure_index < segment->number_of_structures;
+		     structure_index++ )
+		{
+			if( segment->structures[ structure_index ].file_offset < end_of_structure_offset )
+			{
+				continue;
+			}
+			structures[ number_of_structures++ ] = segment->structures[ structure_index ];
+
+			end_of_structure_offset = segment->structures[ structure_index ].file_offset
+			                        + segment->structures[ structure_index ].size;
+		}
+	}
+	if( libnsfdb_recovery_free_segments(
+	     &segments,
+	     number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free segments.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_recovery_rebuild(
+	     io_handle,
+	     structures,
+	     number_of_structures,
+	     non_data_rrv_bucket_offset,
+	     data_rrv_bucket_offset,
+	     summary_bucket_list,
+	     non_summary_bucket_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to rebuild bucket lists.",
+		 function );
+
+		goto on_error;
+	}
+	if( structures != NULL )
+	{
+		memory_free(
+		 structures );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( segments != NULL )
+	{
+		/* Stop the remaining threads without overwriting the abort value of the caller
+		 */
+		abort_value = *abort;
+		*abort      = 1;
+
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			if( segments[ segment_index ].thread != NULL )
+			{
+				libcthreads_thread_join(
+				 &( segments[ segment_index ].thread ),
+				 NULL );
+			}
+		}
+		*abort = abort_value;
+	}
+#endif
+	if( structures != NULL )
+	{
+		memory_free(
+		 structures );
+	}
+	if( segments != NULL )
+	{
+		libnsfdb_recovery_free_segments(
+		 &segments,
+		 number_of_segments,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,185 @@
+/*
+ * Recovery functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_RECOVERY_H )
+#define _LIBNSFDB_RECOVERY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_io_handle.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libcthreads.h"
+#include "libnsfdb_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum LIBNSFDB_RECOVERED_STRUCTURE_TYPES
+{
+	LIBNSFDB_RECOVERED_STRUCTURE_TYPE_NON_SUMMARY_BUCKET	= (uint8_t) 'n',
+	LIBNSFDB_RECOVERED_STRUCTURE_TYPE_RRV_BUCKET		= (uint8_t) 'r',
+	LIBNSFDB_RECOVERED_STRUCTURE_TYPE_SUMMARY_BUCKET	= (uint8_t) 's'
+};
+
+typedef struct libnsfdb_recovered_structure libnsfdb_recovered_structure_t;
+
+struct libnsfdb_recovered_structure
+{
+	/* The structure type
+	 */
+	uint8_t type;
+
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The size
+	 */
+	uint32_t size;
+
+	/* The initial RRV identifier
+	 * Only used by RRV buckets
+	 */
+	uint32_t initial_rrv_identifier;
+};
+
+typedef struct libnsfdb_recovery_segment libnsfdb_recovery_segment_t;
+
+struct libnsfdb_recovery_segment
+{
+	/* The IO handle
+	 */
+	libnsfdb_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was cloned for the segment
+	 */
+	uint8_t file_io_handle_cloned;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The start offset of the file region
+	 */
+	off64_t start_offset;
+
+	/* The end offset of the file region
+	 */
+	off64_t end_offset;
+
+	/* The recovered structures
+	 */
+	libnsfdb_recovered_structure_t *structures;
+
+	/* The number of recovered structures
+	 */
+	int number_of_structures;
+
+	/* The maximum number of recovered structures
+	 */
+	int maximum_number_of_structures;
+
+	/* The value to indicate if abort was signalled
+	 */
+	int *abort;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+int libnsfdb_recovery_segment_append_structure(
+     libnsfdb_recovery_segment_t *segment,
+     uint8_t structure_type,
+     off64_t file_offset,
+     uint32_t size,
+     uint32_t initial_rrv_identifier,
+     libcerror_error_t **error );
+
+int libnsfdb_recovery_check_bucket(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     const uint8_t *header_data,
+     size_t header_data_size,
+     off64_t file_offset,
+     uint8_t *structure_type,
+     uint32_t *bucket_size,
+     libcerror_error_t **error );
+
+int libnsfdb_recovery_check_rrv_bucket(
+     const uint8_t *rrv_bucket_data,
+     size_t rrv_bucket_data_size,
+     uint32_t *initial_rrv_identifier,
+     libcerror_error_t **error );
+
+int libnsfdb_recovery_scan_segment(
+     libnsfdb_recovery_segment_t *segment );
+
+int libnsfdb_recovery_free_segments(
+     libnsfdb_recovery_segment_t **segments,
+     int number_of_segments,
+     libcerror_error_t **error );
+
+int libnsfdb_recovery_rebuild(
+     libnsfdb_io_handle_t *io_handle,
+     libnsfdb_recovered_structure_t *structures,
+     int number_of_structures,
+     off64_t non_data_rrv_bucket_offset,
+     off64_t data_rrv_bucket_offset,
+     libfdata_list_t *summary_bucket_list,
+     libfdata_list_t *non_summary_bucket_list,
+     libcerror_error_t **error );
+
+int libnsfdb_recovery_scan_file(
+     libnsfdb_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     off64_t non_data_rrv_bucket_offset,
+     off64_t data_rrv_bucket_offset,
+     libfdata_list_t *summary_bucket_list,
+     libfdata_list_t *non_summary_bucket_list,
+     int *abort,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_RECOVERY_H ) */
+
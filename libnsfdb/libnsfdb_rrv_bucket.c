@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libnsfdb_checksum.h"
+#include "libnsfdb_libbfio.h"
 #include "libnsfdb_libcdata.h"
 #include "libnsfdb_libcerror.h"
 #include "libnsfdb_libcnotify.h"
@@ -623,6 +624,116 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the Record Relocation Vector (RRV) bucket at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_rrv_bucket_read_file_io_handle(
+     libnsfdb_rrv_bucket_t *rrv_bucket,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size_t rrv_bucket_size,
+     libcerror_error_t **error )
+{
+	uint8_t *rrv_bucket_data = NULL;
+	static char *function    = "libnsfdb_rrv_bucket_read_file_io_handle";
+	ssize_t read_count       = 0;
+
+	if( rrv_bucket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RRV bucket.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( rrv_bucket_size == 0 )
+	 || ( rrv_bucket_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid RRV bucket size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	rrv_bucket_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * rrv_bucket_size );
+
+	if( rrv_bucket_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create RRV bucket data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading RRV bucket at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              rrv_bucket_data,
+	              rrv_bucket_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) rrv_bucket_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read RRV bucket data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libnsfdb_rrv_bucket_read(
+	     rrv_bucket,
+	     rrv_bucket_data,
+	     rrv_bucket_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read RRV bucket.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 rrv_bucket_data );
+
+	return( 1 );
+
+on_error:
+	if( rrv_bucket_data != NULL )
+	{
+		memory_free(
+		 rrv_bucket_data );
+	}
+	return( -1 );
+}
+
 /* Retrieves the number of RRV values
  * Returns 1 if successful or -1 on error
  */
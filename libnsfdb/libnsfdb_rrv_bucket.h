@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libnsfdb_libbfio.h"
 #include "libnsfdb_libcdata.h"
 #include "libnsfdb_libcerror.h"
 #include "libnsfdb_rrv_value.h"
@@ -56,6 +57,13 @@ int libnsfdb_rrv_bucket_read(
      size_t rrv_bucket_data_size,
      libcerror_error_t **error );
 
+int libnsfdb_rrv_bucket_read_file_io_handle(
+     libnsfdb_rrv_bucket_t *rrv_bucket,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size_t rrv_bucket_size,
+     libcerror_error_t **error );
+
 int libnsfdb_rrv_bucket_get_number_of_values(
      libnsfdb_rrv_bucket_t *rrv_bucket,
      int *number_of_rrv_values,
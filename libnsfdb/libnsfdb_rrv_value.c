@@ -242,6 +242,40 @@ int libnsfdb_rrv_value_set_bucket_slot_identifier(
 	return( 1 );
 }
 
+/* Sets the bucket data range
+ * The bucket data range is used for notes that were recovered from unreferenced bucket data
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_rrv_value_set_bucket_data_range(
+     libnsfdb_rrv_value_t *rrv_value,
+     uint32_t bucket_index,
+     uint32_t data_offset,
+     uint32_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_rrv_value_set_bucket_data_range";
+
+	if( rrv_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid RRV value.",
+		 function );
+
+		return( -1 );
+	}
+	rrv_value->type         = LIBNSFDB_RRV_VALUE_TYPE_BUCKET_DATA_RANGE;
+	rrv_value->bucket_index = bucket_index;
+	rrv_value->slot_index   = 0;
+	rrv_value->nonsum       = 0;
+	rrv_value->data_offset  = data_offset;
+	rrv_value->data_size    = data_size;
+
+	return( 1 );
+}
+
 /* Sets the file position
  * Returns 1 if successful or -1 on error
  */
@@ -33,6 +33,7 @@ extern "C" {
 
 enum LIBNSFDB_RRV_VALUE_TYPES
 {
+	LIBNSFDB_RRV_VALUE_TYPE_BUCKET_DATA_RANGE	= (uint8_t) 'r',
 	LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER	= (uint8_t) 'i',
 	LIBNSFDB_RRV_VALUE_TYPE_FILE_POSITION		= (uint8_t) 'p'
 };
@@ -70,6 +71,16 @@ struct libnsfdb_rrv_value
 			/* Unknown non-summary
 			 */
 			uint32_t nonsum;
+
+			/* The offset of the data in the bucket
+			 * Only used by recovered notes
+			 */
+			uint32_t data_offset;
+
+			/* The size of the data in the bucket
+			 * Only used by recovered notes
+			 */
+			uint32_t data_size;
 		};
 	};
 };
@@ -95,6 +106,13 @@ int libnsfdb_rrv_value_set_bucket_slot_identifier(
      uint32_t nonsum,
      libcerror_error_t **error );
 
+int libnsfdb_rrv_value_set_bucket_data_range(
+     libnsfdb_rrv_value_t *rrv_value,
+     uint32_t bucket_index,
+     uint32_t data_offset,
+     uint32_t data_size,
+     libcerror_error_t **error );
+
 int libnsfdb_rrv_value_set_file_position(
      libnsfdb_rrv_value_t *rrv_value,
      uint32_t file_position,
@@ -0,0 +1,560 @@
+/*
+ * Scan predicate functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_definitions.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_scan_predicate.h"
+
+/* Creates a scan predicate
+ * Make sure the value scan_predicate is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_scan_predicate_initialize(
+     libnsfdb_scan_predicate_t **scan_predicate,
+     int column_index,
+     uint8_t predicate_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_scan_predicate_initialize";
+
+	if( scan_predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_predicate != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan predicate value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid column index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS )
+	 && ( predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_CONTAINS )
+	 && ( predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_PREFIX )
+	 && ( predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_NUMBER_RANGE )
+	 && ( predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TIME_RANGE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported predicate type.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_predicate = memory_allocate_structure(
+	                   libnsfdb_scan_predicate_t );
+
+	if( *scan_predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan predicate.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_predicate,
+	     0,
+	     sizeof( libnsfdb_scan_predicate_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan predicate.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_predicate )->column_index   = column_index;
+	( *scan_predicate )->predicate_type = predicate_type;
+
+	return( 1 );
+
+on_error:
+	if( *scan_predicate != NULL )
+	{
+		memory_free(
+		 *scan_predicate );
+
+		*scan_predicate = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan predicate
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_scan_predicate_free(
+     libnsfdb_scan_predicate_t **scan_predicate,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_scan_predicate_free";
+
+	if( scan_predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_predicate != NULL )
+	{
+		if( ( *scan_predicate )->text != NULL )
+		{
+			memory_free(
+			 ( *scan_predicate )->text );
+		}
+		memory_free(
+		 *scan_predicate );
+
+		*scan_predicate = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the text of a text predicate
+ * The text is compared with the raw text data of the item
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_scan_predicate_set_text(
+     libnsfdb_scan_predicate_t *scan_predicate,
+     const uint8_t *text,
+     size_t text_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_scan_predicate_set_text";
+
+	if( scan_predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_predicate->predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS )
+	 && ( scan_predicate->predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_CONTAINS )
+	 && ( scan_predicate->predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_PREFIX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported predicate type.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_predicate->text != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan predicate - text value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( text_size == 0 )
+	 || ( text_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid text size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	scan_predicate->text = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * text_size );
+
+	if( scan_predicate->text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create text.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     scan_predicate->text,
+	     text,
+	     text_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy text.",
+		 function );
+
+		goto on_error;
+	}
+	scan_predicate->text_size = text_size;
+
+	return( 1 );
+
+on_error:
+	if( scan_predicate->text != NULL )
+	{
+		memory_free(
+		 scan_predicate->text );
+
+		scan_predicate->text = NULL;
+	}
+	return( -1 );
+}
+
+/* Sets the range of a number range predicate
+ * The range includes both values
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_scan_predicate_set_number_range(
+     libnsfdb_scan_predicate_t *scan_predicate,
+     double minimum_number,
+     double maximum_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_scan_predicate_set_number_range";
+
+	if( scan_predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_predicate->predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_NUMBER_RANGE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported predicate type.",
+		 function );
+
+		return( -1 );
+	}
+	/* Note that the negated comparison also catches NaN values
+	 */
+	if( !( minimum_number <= maximum_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	scan_predicate->minimum_number = minimum_number;
+	scan_predicate->maximum_number = maximum_number;
+
+	return( 1 );
+}
+
+/* Sets the range of a time range predicate
+ * The times are 64-bit NSF timedate values and the range includes both values
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_scan_predicate_set_time_range(
+     libnsfdb_scan_predicate_t *scan_predicate,
+     uint64_t first_time,
+     uint64_t last_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_scan_predicate_set_time_range";
+
+	if( scan_predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_predicate->predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TIME_RANGE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported predicate type.",
+		 function );
+
+		return( -1 );
+	}
+	first_time &= 0x00ffffffffffffffULL;
+	last_time  &= 0x00ffffffffffffffULL;
+
+	if( first_time > last_time )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first time value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	scan_predicate->first_time = first_time;
+	scan_predicate->last_time  = last_time;
+
+	return( 1 );
+}
+
+/* Determines if the raw data of an item matches the scan predicate
+ * The item data starts with a 16-bit type value of which the upper byte contains the note item class
+ * Returns 1 if the data matches, 0 if not or -1 on error
+ */
+int libnsfdb_scan_predicate_match_value_data(
+     libnsfdb_scan_predicate_t *scan_predicate,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	byte_stream_float64_t number_value;
+
+	static char *function    = "libnsfdb_scan_predicate_match_value_data";
+	size_t text_data_offset  = 0;
+	size_t text_data_size    = 0;
+	uint64_t time_value      = 0;
+	uint16_t item_value_type = 0;
+	uint8_t note_item_class  = 0;
+
+	if( scan_predicate == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan predicate.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size < 2 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 value_data,
+	 item_value_type );
+
+	note_item_class = (uint8_t) ( item_value_type >> 8 );
+
+	switch( scan_predicate->predicate_type )
+	{
+		case LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS:
+		case LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_CONTAINS:
+		case LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_PREFIX:
+			if( note_item_class != LIBNSFDB_NOTE_ITEM_CLASS_TEXT )
+			{
+				return( 0 );
+			}
+			if( scan_predicate->text == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid scan predicate - missing text.",
+				 function );
+
+				return( -1 );
+			}
+			text_data_size = value_data_size - 2;
+
+			if( text_data_size < scan_predicate->text_size )
+			{
+				return( 0 );
+			}
+			if( ( scan_predicate->predicate_type == LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS )
+			 && ( text_data_size != scan_predicate->text_size ) )
+			{
+				return( 0 );
+			}
+			if( scan_predicate->predicate_type != LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_CONTAINS )
+			{
+				if( memory_compare(
+				     &( value_data[ 2 ] ),
+				     scan_predicate->text,
+				     scan_predicate->text_size ) != 0 )
+				{
+					return( 0 );
+				}
+				return( 1 );
+			}
+			for( text_data_offset = 2;
+			     ( text_data_offset + scan_predicate->text_size ) <= value_data_size;
+			     text_data_offset++ )
+			{
+				/* Only compare the remainder of the text if the first byte matches
+				 */
+				if( ( value_data[ text_data_offset ] == scan_predicate->text[ 0 ] )
+				 && ( memory_compare(
+				       &( value_data[ text_data_offset ] ),
+				       scan_predicate->text,
+				       scan_predicate->text_size ) == 0 ) )
+				{
+					return( 1 );
+				}
+			}
+			return( 0 );
+
+		case LIBNSFDB_SCAN_PREDICATE_TYPE_NUMBER_RANGE:
+			if( ( note_item_class != LIBNSFDB_NOTE_ITEM_CLASS_NUMBER )
+			 || ( value_data_size < 10 ) )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 &( value_data[ 2 ] ),
+			 number_value.integer );
+
+			if( ( number_value.floating_point < scan_predicate->minimum_number )
+			 || ( number_value.floating_point > scan_predicate->maximum_number )
+			 || ( number_value.floating_point != number_value.floating_point ) )
+			{
+				return( 0 );
+			}
+			return( 1 );
+
+		case LIBNSFDB_SCAN_PREDICATE_TYPE_TIME_RANGE:
+			if( ( note_item_class != LIBNSFDB_NOTE_ITEM_CLASS_TIME )
+			 || ( value_data_size < 10 ) )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 &( value_data[ 2 ] ),
+			 time_value );
+
+			time_value &= 0x00ffffffffffffffULL;
+
+			if( ( time_value < scan_predicate->first_time )
+			 || ( time_value > scan_predicate->last_time ) )
+			{
+				return( 0 );
+			}
+			return( 1 );
+
+		default:
+			break;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported predicate type.",
+	 function );
+
+	return( -1 );
+}
+
@@ -0,0 +1,110 @@
+/*
+ * Scan predicate functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_SCAN_PREDICATE_H )
+#define _LIBNSFDB_SCAN_PREDICATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_scan_predicate libnsfdb_scan_predicate_t;
+
+struct libnsfdb_scan_predicate
+{
+	/* The column index
+	 */
+	int column_index;
+
+	/* The predicate type
+	 */
+	uint8_t predicate_type;
+
+	/* The text
+	 */
+	uint8_t *text;
+
+	/* The text size
+	 */
+	size_t text_size;
+
+	/* The minimum number
+	 */
+	double minimum_number;
+
+	/* The maximum number
+	 */
+	double maximum_number;
+
+	/* The first time
+	 */
+	uint64_t first_time;
+
+	/* The last time
+	 */
+	uint64_t last_time;
+};
+
+int libnsfdb_scan_predicate_initialize(
+     libnsfdb_scan_predicate_t **scan_predicate,
+     int column_index,
+     uint8_t predicate_type,
+     libcerror_error_t **error );
+
+int libnsfdb_scan_predicate_free(
+     libnsfdb_scan_predicate_t **scan_predicate,
+     libcerror_error_t **error );
+
+int libnsfdb_scan_predicate_set_text(
+     libnsfdb_scan_predicate_t *scan_predicate,
+     const uint8_t *text,
+     size_t text_size,
+     libcerror_error_t **error );
+
+int libnsfdb_scan_predicate_set_number_range(
+     libnsfdb_scan_predicate_t *scan_predicate,
+     double minimum_number,
+     double maximum_number,
+     libcerror_error_t **error );
+
+int libnsfdb_scan_predicate_set_time_range(
+     libnsfdb_scan_predicate_t *scan_predicate,
+     uint64_t first_time,
+     uint64_t last_time,
+     libcerror_error_t **error );
+
+int libnsfdb_scan_predicate_match_value_data(
+     libnsfdb_scan_predicate_t *scan_predicate,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_SCAN_PREDICATE_H ) */
+
@@ -0,0 +1,2646 @@
+/*
+ * Structure map functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libnsfdb_bucket.h"
+#include "libnsfdb_checksum.h"
+#include "libnsfdb_definitions.h"
+#include "libnsfdb_io_handle.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcdata.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libfcache.h"
+#include "libnsfdb_libfdata.h"
+#include "libnsfdb_rrv_bucket_descriptor.h"
+#include "libnsfdb_structure_map.h"
+#include "libnsfdb_types.h"
+
+#include "nsfdb_bucket.h"
+#include "nsfdb_bucket_descriptor_block.h"
+#include "nsfdb_rrv_bucket.h"
+#include "nsfdb_superblock.h"
+
+/* Creates a structure map
+ * Make sure the value structure_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_initialize(
+     libnsfdb_structure_map_t **structure_map,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	static char *function                                     = "libnsfdb_structure_map_initialize";
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *structure_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid structure map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = memory_allocate_structure(
+	                          libnsfdb_internal_structure_map_t );
+
+	if( internal_structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create structure map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_structure_map,
+	     0,
+	     sizeof( libnsfdb_internal_structure_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear structure map.",
+		 function );
+
+		memory_free(
+		 internal_structure_map );
+
+		return( -1 );
+	}
+	if( libnsfdb_io_handle_initialize(
+	     &( internal_structure_map->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	*structure_map = (libnsfdb_structure_map_t *) internal_structure_map;
+
+	return( 1 );
+
+on_error:
+	if( internal_structure_map != NULL )
+	{
+		memory_free(
+		 internal_structure_map );
+	}
+	return( -1 );
+}
+
+/* Frees a structure map
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_free(
+     libnsfdb_structure_map_t **structure_map,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	static char *function                                     = "libnsfdb_structure_map_free";
+	int result                                                = 1;
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *structure_map != NULL )
+	{
+		internal_structure_map = (libnsfdb_internal_structure_map_t *) *structure_map;
+		*structure_map         = NULL;
+
+		if( libnsfdb_io_handle_free(
+		     &( internal_structure_map->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_structure_map->superblock_data != NULL )
+		{
+			memory_free(
+			 internal_structure_map->superblock_data );
+		}
+		if( internal_structure_map->entries != NULL )
+		{
+			memory_free(
+			 internal_structure_map->entries );
+		}
+		memory_free(
+		 internal_structure_map );
+	}
+	return( result );
+}
+
+/* Appends an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_append_entry(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     uint8_t type,
+     int copy_number,
+     off64_t file_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libnsfdb_structure_map_entry_t *entry = NULL;
+	void *reallocation                    = NULL;
+	static char *function                 = "libnsfdb_structure_map_append_entry";
+	size_t entries_size                   = 0;
+	int maximum_number_of_entries         = 0;
+
+	if( internal_structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_structure_map->number_of_entries >= internal_structure_map->maximum_number_of_entries )
+	{
+		if( internal_structure_map->maximum_number_of_entries == 0 )
+		{
+			maximum_number_of_entries = 256;
+		}
+		else
+		{
+			maximum_number_of_entries = internal_structure_map->maximum_number_of_entries * 2;
+		}
+		if( maximum_number_of_entries <= internal_structure_map->number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libnsfdb_structure_map_entry_t ) * (size_t) maximum_number_of_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                internal_structure_map->entries,
+		                entries_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_structure_map->entries                   = (libnsfdb_structure_map_entry_t *) reallocation;
+		internal_structure_map->maximum_number_of_entries = maximum_number_of_entries;
+	}
+	entry = &( internal_structure_map->entries[ internal_structure_map->number_of_entries ] );
+
+	entry->type        = type;
+	entry->copy_number = copy_number;
+	entry->file_offset = file_offset;
+	entry->size        = size;
+
+	internal_structure_map->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Appends the buckets in a bucket list as entries
+ * Unused bucket numbers have no file offset and are not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_append_bucket_list(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libfdata_list_t *bucket_list,
+     uint8_t type,
+     libcerror_error_t **error )
+{
+	static char *function  = "libnsfdb_structure_map_append_bucket_list";
+	off64_t element_offset = 0;
+	size64_t element_size  = 0;
+	uint32_t element_flags = 0;
+	int element_file_index = 0;
+	int element_index      = 0;
+	int number_of_elements = 0;
+
+	if( libfdata_list_get_number_of_elements(
+	     bucket_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of buckets.",
+		 function );
+
+		return( -1 );
+	}
+	for( element_index = 0;
+	     element_index < number_of_elements;
+	     element_index++ )
+	{
+		if( libfdata_list_get_element_by_index(
+		     bucket_list,
+		     element_index,
+		     &element_file_index,
+		     &element_offset,
+		     &element_size,
+		     &element_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bucket: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( element_offset == 0 )
+		{
+			continue;
+		}
+		if( libnsfdb_structure_map_append_entry(
+		     internal_structure_map,
+		     type,
+		     0,
+		     element_offset,
+		     element_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append bucket: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the locations of the structures in a file using a Basic File IO (bfio) handle
+ * Reads the file header, database header, superblock and bucket descriptor block in that order
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_read_file_io_handle(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_structure_map_read_file_io_handle";
+
+	if( libnsfdb_structure_map_read_file_header(
+	     structure_map,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_structure_map_read_database_header(
+	     structure_map,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read database header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_structure_map_read_superblock(
+	     structure_map,
+	     file_io_handle,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_structure_map_read_bucket_descriptor_block(
+	     structure_map,
+	     file_io_handle,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read bucket descriptor block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the file header
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_read_file_header(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	static char *function                                     = "libnsfdb_structure_map_read_file_header";
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( internal_structure_map->read_phase != LIBNSFDB_STRUCTURE_MAP_READ_PHASE_NONE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid structure map - file header already read.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_structure_map->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Without a readable file and database header the locations of the other structures are unknown
+	 */
+	if( libnsfdb_io_handle_read_file_header(
+	     internal_structure_map->io_handle,
+	     file_io_handle,
+	     &( internal_structure_map->database_header_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map->read_phase = LIBNSFDB_STRUCTURE_MAP_READ_PHASE_FILE_HEADER;
+
+	return( 1 );
+}
+
+/* Reads the database header
+ * The superblock and bucket descriptor block copies are added to the structure map
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_read_database_header(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	static char *function                                     = "libnsfdb_structure_map_read_database_header";
+	off64_t data_rrv_bucket_offset                            = 0;
+	off64_t non_data_rrv_bucket_offset                        = 0;
+	int copy_index                                            = 0;
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( internal_structure_map->read_phase != LIBNSFDB_STRUCTURE_MAP_READ_PHASE_FILE_HEADER )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid structure map - read phase value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_io_handle_read_database_header(
+	     internal_structure_map->io_handle,
+	     file_io_handle,
+	     internal_structure_map->database_header_size,
+	     &( internal_structure_map->superblock_offsets[ 0 ] ),
+	     &( internal_structure_map->superblock_sizes[ 0 ] ),
+	     &( internal_structure_map->superblock_offsets[ 1 ] ),
+	     &( internal_structure_map->superblock_sizes[ 1 ] ),
+	     &( internal_structure_map->superblock_offsets[ 2 ] ),
+	     &( internal_structure_map->superblock_sizes[ 2 ] ),
+	     &( internal_structure_map->superblock_offsets[ 3 ] ),
+	     &( internal_structure_map->superblock_sizes[ 3 ] ),
+	     &( internal_structure_map->bucket_descriptor_block_offsets[ 0 ] ),
+	     &( internal_structure_map->bucket_descriptor_block_sizes[ 0 ] ),
+	     &( internal_structure_map->bucket_descriptor_block_offsets[ 1 ] ),
+	     &( internal_structure_map->bucket_descriptor_block_sizes[ 1 ] ),
+	     &non_data_rrv_bucket_offset,
+	     &data_rrv_bucket_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read database header.",
+		 function );
+
+		return( -1 );
+	}
+	for( copy_index = 0;
+	     copy_index < 4;
+	     copy_index++ )
+	{
+		if( ( internal_structure_map->superblock_offsets[ copy_index ] == 0 )
+		 || ( internal_structure_map->superblock_sizes[ copy_index ] == 0 ) )
+		{
+			continue;
+		}
+		if( libnsfdb_structure_map_append_entry(
+		     internal_structure_map,
+		     LIBNSFDB_STRUCTURE_TYPE_SUPERBLOCK,
+		     copy_index + 1,
+		     internal_structure_map->superblock_offsets[ copy_index ],
+		     (size64_t) internal_structure_map->superblock_sizes[ copy_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append superblock: %d.",
+			 function,
+			 copy_index + 1 );
+
+			return( -1 );
+		}
+	}
+	for( copy_index = 0;
+	     copy_index < 2;
+	     copy_index++ )
+	{
+		if( ( internal_structure_map->bucket_descriptor_block_offsets[ copy_index ] == 0 )
+		 || ( internal_structure_map->bucket_descriptor_block_sizes[ copy_index ] == 0 ) )
+		{
+			continue;
+		}
+		if( libnsfdb_structure_map_append_entry(
+		     internal_structure_map,
+		     LIBNSFDB_STRUCTURE_TYPE_BUCKET_DESCRIPTOR_BLOCK,
+		     copy_index + 1,
+		     internal_structure_map->bucket_descriptor_block_offsets[ copy_index ],
+		     (size64_t) internal_structure_map->bucket_descriptor_block_sizes[ copy_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append bucket descriptor block: %d.",
+			 function,
+			 copy_index + 1 );
+
+			return( -1 );
+		}
+	}
+	internal_structure_map->read_phase = LIBNSFDB_STRUCTURE_MAP_READ_PHASE_DATABASE_HEADER;
+
+	return( 1 );
+}
+
+/* Reads the CX compressed data of a superblock
+ * The first 4 bytes of the superblock data are not part of the CX compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_read_superblock_data(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libbfio_handle_t *file_io_handle,
+     off64_t superblock_offset,
+     uint32_t superblock_size,
+     libcerror_error_t **error )
+{
+	nsfdb_superblock_header_t superblock_header;
+
+	static char *function         = "libnsfdb_structure_map_read_superblock_data";
+	ssize_t read_count            = 0;
+	uint32_t stored_size          = 0;
+	uint32_t uncompressed_size    = 0;
+
+	if( internal_structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_structure_map->superblock_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid structure map - superblock data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &superblock_header,
+	              sizeof( nsfdb_superblock_header_t ),
+	              superblock_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( nsfdb_superblock_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read superblock header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 superblock_offset,
+		 superblock_offset );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 superblock_header.uncompressed_size,
+	 uncompressed_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 superblock_header.size,
+	 stored_size );
+
+	if( ( stored_size > superblock_size )
+	 || ( stored_size <= ( sizeof( nsfdb_superblock_header_t ) + sizeof( nsfdb_superblock_footer_t ) + 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid superblock size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( uncompressed_size == 0 )
+	 || ( (size_t) uncompressed_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid superblock uncompressed size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	internal_structure_map->superblock_data_size = (size_t) stored_size
+	                                             - ( sizeof( nsfdb_superblock_header_t ) + sizeof( nsfdb_superblock_footer_t ) + 4 );
+
+	internal_structure_map->superblock_data = (uint8_t *) memory_allocate(
+	                                                       internal_structure_map->superblock_data_size );
+
+	if( internal_structure_map->superblock_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create superblock data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              internal_structure_map->superblock_data,
+	              internal_structure_map->superblock_data_size,
+	              superblock_offset + sizeof( nsfdb_superblock_header_t ) + 4,
+	              error );
+
+	if( read_count != (ssize_t) internal_structure_map->superblock_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read superblock data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_structure_map->superblock_uncompressed_data_size = (size_t) uncompressed_size;
+
+	return( 1 );
+
+on_error:
+	if( internal_structure_map->superblock_data != NULL )
+	{
+		memory_free(
+		 internal_structure_map->superblock_data );
+
+		internal_structure_map->superblock_data = NULL;
+	}
+	internal_structure_map->superblock_data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the superblock
+ * A corrupted copy is reported by a check hence the first copy that can be read
+ * is used to locate the summary and non-summary buckets
+ * Returns 1 if successful, 0 if no copy could be read or -1 on error
+ */
+int libnsfdb_structure_map_read_superblock(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	libfcache_cache_t *non_summary_bucket_cache               = NULL;
+	libfcache_cache_t *summary_bucket_cache                   = NULL;
+	libfdata_list_t *non_summary_bucket_list                  = NULL;
+	libfdata_list_t *summary_bucket_list                      = NULL;
+	static char *function                                     = "libnsfdb_structure_map_read_superblock";
+	int copy_index                                            = 0;
+	int result                                                = 0;
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( internal_structure_map->read_phase != LIBNSFDB_STRUCTURE_MAP_READ_PHASE_DATABASE_HEADER )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid structure map - read phase value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_list_initialize(
+	     &summary_bucket_list,
+	     NULL,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &summary_bucket_cache,
+	     LIBNSFDB_MAXIMUM_CACHE_ENTRIES_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create summary bucket cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_initialize(
+	     &non_summary_bucket_list,
+	     NULL,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create non summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &non_summary_bucket_cache,
+	     LIBNSFDB_MAXIMUM_CACHE_ENTRIES_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create non summary bucket cache.",
+		 function );
+
+		goto on_error;
+	}
+	for( copy_index = 0;
+	     copy_index < 4;
+	     copy_index++ )
+	{
+		if( ( internal_structure_map->superblock_offsets[ copy_index ] == 0 )
+		 || ( internal_structure_map->superblock_sizes[ copy_index ] == 0 ) )
+		{
+			continue;
+		}
+		result = libnsfdb_io_handle_read_superblock(
+		          internal_structure_map->io_handle,
+		          file_io_handle,
+		          internal_structure_map->superblock_offsets[ copy_index ],
+		          internal_structure_map->superblock_sizes[ copy_index ],
+		          summary_bucket_list,
+		          summary_bucket_cache,
+		          non_summary_bucket_list,
+		          non_summary_bucket_cache,
+		          error );
+
+		if( result == 1 )
+		{
+			break;
+		}
+		libcerror_error_free(
+		 error );
+
+		if( ( libfdata_list_empty(
+		       summary_bucket_list,
+		       error ) != 1 )
+		 || ( libfdata_list_empty(
+		       non_summary_bucket_list,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to empty bucket lists.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 1 )
+	{
+		internal_structure_map->flags |= LIBNSFDB_STRUCTURE_MAP_FLAG_BUCKETS_MISSING;
+	}
+	else
+	{
+		internal_structure_map->rrv_bucket_size = (uint32_t) internal_structure_map->io_handle->rrv_bucket_size;
+
+		if( libnsfdb_structure_map_append_bucket_list(
+		     internal_structure_map,
+		     summary_bucket_list,
+		     LIBNSFDB_STRUCTURE_TYPE_SUMMARY_BUCKET,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append summary buckets.",
+			 function );
+
+			goto on_error;
+		}
+		if( libnsfdb_structure_map_append_bucket_list(
+		     internal_structure_map,
+		     non_summary_bucket_list,
+		     LIBNSFDB_STRUCTURE_TYPE_NON_SUMMARY_BUCKET,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append non summary buckets.",
+			 function );
+
+			goto on_error;
+		}
+		if( libnsfdb_structure_map_read_superblock_data(
+		     internal_structure_map,
+		     file_io_handle,
+		     internal_structure_map->superblock_offsets[ copy_index ],
+		     internal_structure_map->superblock_sizes[ copy_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read superblock: %d data.",
+			 function,
+			 copy_index + 1 );
+
+			goto on_error;
+		}
+	}
+	if( libfcache_cache_free(
+	     &non_summary_bucket_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free non summary bucket cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_free(
+	     &non_summary_bucket_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free non summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_free(
+	     &summary_bucket_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free summary bucket cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_list_free(
+	     &summary_bucket_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free summary bucket list.",
+		 function );
+
+		goto on_error;
+	}
+	internal_structure_map->read_phase = LIBNSFDB_STRUCTURE_MAP_READ_PHASE_SUPERBLOCK;
+
+	return( result );
+
+on_error:
+	if( non_summary_bucket_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &non_summary_bucket_cache,
+		 NULL );
+	}
+	if( non_summary_bucket_list != NULL )
+	{
+		libfdata_list_free(
+		 &non_summary_bucket_list,
+		 NULL );
+	}
+	if( summary_bucket_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &summary_bucket_cache,
+		 NULL );
+	}
+	if( summary_bucket_list != NULL )
+	{
+		libfdata_list_free(
+		 &summary_bucket_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the bucket descriptor block
+ * The first copy that can be read is used to locate the RRV buckets
+ * Returns 1 if successful, 0 if no copy could be read or -1 on error
+ */
+int libnsfdb_structure_map_read_bucket_descriptor_block(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor   = NULL;
+	static char *function                                     = "libnsfdb_structure_map_read_bucket_descriptor_block";
+	int copy_index                                            = 0;
+	int descriptor_index                                      = 0;
+	int number_of_descriptors                                 = 0;
+	int result                                                = 0;
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( internal_structure_map->read_phase != LIBNSFDB_STRUCTURE_MAP_READ_PHASE_SUPERBLOCK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid structure map - read phase value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( copy_index = 0;
+	     copy_index < 2;
+	     copy_index++ )
+	{
+		if( ( internal_structure_map->bucket_descriptor_block_offsets[ copy_index ] == 0 )
+		 || ( internal_structure_map->bucket_descriptor_block_sizes[ copy_index ] == 0 ) )
+		{
+			continue;
+		}
+		result = libnsfdb_io_handle_read_bucket_descriptor_block(
+		          internal_structure_map->io_handle,
+		          file_io_handle,
+		          internal_structure_map->bucket_descriptor_block_offsets[ copy_index ],
+		          internal_structure_map->bucket_descriptor_block_sizes[ copy_index ],
+		          error );
+
+		if( result == 1 )
+		{
+			break;
+		}
+		libcerror_error_free(
+		 error );
+
+		if( libnsfdb_io_handle_clear_bucket_descriptor_block(
+		     internal_structure_map->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear bucket descriptor block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The size of the RRV buckets is stored in the superblock
+	 */
+	if( ( result != 1 )
+	 || ( internal_structure_map->rrv_bucket_size == 0 ) )
+	{
+		internal_structure_map->flags |= LIBNSFDB_STRUCTURE_MAP_FLAG_RRV_BUCKETS_MISSING;
+	}
+	else
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_structure_map->io_handle->rrv_bucket_descriptors,
+		     &number_of_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of RRV bucket descriptors.",
+			 function );
+
+			return( -1 );
+		}
+		for( descriptor_index = 0;
+		     descriptor_index < number_of_descriptors;
+		     descriptor_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_structure_map->io_handle->rrv_bucket_descriptors,
+			     descriptor_index,
+			     (intptr_t **) &rrv_bucket_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve RRV bucket descriptor: %d.",
+				 function,
+				 descriptor_index );
+
+				return( -1 );
+			}
+			if( ( rrv_bucket_descriptor == NULL )
+			 || ( rrv_bucket_descriptor->file_offset == 0 ) )
+			{
+				continue;
+			}
+			if( libnsfdb_structure_map_append_entry(
+			     internal_structure_map,
+			     LIBNSFDB_STRUCTURE_TYPE_RRV_BUCKET,
+			     0,
+			     rrv_bucket_descriptor->file_offset,
+			     (size64_t) internal_structure_map->rrv_bucket_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append RRV bucket: %d.",
+				 function,
+				 descriptor_index );
+
+				return( -1 );
+			}
+		}
+	}
+	internal_structure_map->read_phase = LIBNSFDB_STRUCTURE_MAP_READ_PHASE_BUCKET_DESCRIPTOR_BLOCK;
+
+	return( result );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_get_format_version(
+     libnsfdb_structure_map_t *structure_map,
+     uint32_t *format_version,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	static char *function                                     = "libnsfdb_structure_map_get_format_version";
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	*format_version = internal_structure_map->io_handle->format_version;
+
+	return( 1 );
+}
+
+/* Retrieves the flags
+ * The flags indicate which structures could not be located
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_get_flags(
+     libnsfdb_structure_map_t *structure_map,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	static char *function                                     = "libnsfdb_structure_map_get_flags";
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*flags = internal_structure_map->flags;
+
+	return( 1 );
+}
+
+/* Retrieves the number of structures
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_get_number_of_structures(
+     libnsfdb_structure_map_t *structure_map,
+     int *number_of_structures,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	static char *function                                     = "libnsfdb_structure_map_get_number_of_structures";
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( number_of_structures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of structures.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_structures = internal_structure_map->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific structure
+ * The copy number is 0 for structures that have no copies
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_get_structure(
+     libnsfdb_structure_map_t *structure_map,
+     int structure_index,
+     uint8_t *structure_type,
+     int *copy_number,
+     off64_t *file_offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	libnsfdb_structure_map_entry_t *entry                     = NULL;
+	static char *function                                     = "libnsfdb_structure_map_get_structure";
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( ( structure_index < 0 )
+	 || ( structure_index >= internal_structure_map->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid structure index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( structure_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure type.",
+		 function );
+
+		return( -1 );
+	}
+	if( copy_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy number.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_structure_map->entries[ structure_index ] );
+
+	*structure_type = entry->type;
+	*copy_number    = entry->copy_number;
+	*file_offset    = entry->file_offset;
+	*size           = entry->size;
+
+	return( 1 );
+}
+
+/* Checks a superblock
+ * Returns 1 if valid, 0 if corrupted or -1 on error
+ */
+int libnsfdb_structure_map_check_superblock(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libbfio_handle_t *file_io_handle,
+     libnsfdb_structure_map_entry_t *entry,
+     uint8_t *problem,
+     uint32_t *stored_checksum,
+     uint32_t *calculated_checksum,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	nsfdb_superblock_footer_t *superblock_footer = NULL;
+	nsfdb_superblock_header_t superblock_header;
+	uint8_t *data                                = NULL;
+	static char *function                        = "libnsfdb_structure_map_check_superblock";
+	size_t data_size                             = 0;
+	ssize_t read_count                           = 0;
+	uint32_t stored_size                         = 0;
+	uint16_t header_signature                    = 0;
+
+	if( internal_structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &superblock_header,
+	              sizeof( nsfdb_superblock_header_t ),
+	              entry->file_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( nsfdb_superblock_header_t ) )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_READ_FAILED;
+
+		goto on_corrupted;
+	}
+	*number_of_bytes += sizeof( nsfdb_superblock_header_t );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 superblock_header.signature,
+	 header_signature );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 superblock_header.size,
+	 stored_size );
+
+	if( header_signature != 0x000e )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_SIGNATURE;
+
+		goto on_corrupted;
+	}
+	if( ( stored_size < ( sizeof( nsfdb_superblock_header_t ) + sizeof( nsfdb_superblock_footer_t ) ) )
+	 || ( (size64_t) stored_size > entry->size )
+	 || ( (size64_t) stored_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_SIZE;
+
+		goto on_corrupted;
+	}
+	/* The data and the footer that follow the header are read at once
+	 */
+	data_size = (size_t) stored_size - sizeof( nsfdb_superblock_header_t );
+
+	data = (uint8_t *) memory_allocate(
+	                    data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_READ_FAILED;
+
+		goto on_corrupted;
+	}
+	*number_of_bytes += data_size;
+
+	data_size -= sizeof( nsfdb_superblock_footer_t );
+
+	superblock_footer = (nsfdb_superblock_footer_t *) &( data[ data_size ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 superblock_footer->checksum,
+	 *stored_checksum );
+
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     calculated_checksum,
+	     data,
+	     data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( *stored_checksum != *calculated_checksum )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_CHECKSUM;
+
+		goto on_corrupted;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_corrupted:
+	/* A structure that cannot be read is reported as corrupted instead of as an error
+	 */
+	libcerror_error_free(
+	 error );
+
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Checks a bucket descriptor block
+ * Returns 1 if valid, 0 if corrupted or -1 on error
+ */
+int libnsfdb_structure_map_check_bucket_descriptor_block(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libbfio_handle_t *file_io_handle,
+     libnsfdb_structure_map_entry_t *entry,
+     uint8_t *problem,
+     uint32_t *stored_checksum,
+     uint32_t *calculated_checksum,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	nsfdb_bucket_descriptor_block_footer_t *bucket_descriptor_block_footer = NULL;
+	nsfdb_bucket_descriptor_block_header_t bucket_descriptor_block_header;
+	uint8_t *data                                                          = NULL;
+	static char *function                                                  = "libnsfdb_structure_map_check_bucket_descriptor_block";
+	size_t data_size                                                       = 0;
+	ssize_t read_count                                                     = 0;
+	uint32_t stored_size                                                   = 0;
+	uint16_t header_signature                                              = 0;
+	uint16_t header_version                                                = 0;
+
+	if( internal_structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &bucket_descriptor_block_header,
+	              sizeof( nsfdb_bucket_descriptor_block_header_t ),
+	              entry->file_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( nsfdb_bucket_descriptor_block_header_t ) )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_READ_FAILED;
+
+		goto on_corrupted;
+	}
+	*number_of_bytes += sizeof( nsfdb_bucket_descriptor_block_header_t );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 bucket_descriptor_block_header.signature,
+	 header_signature );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 bucket_descriptor_block_header.version,
+	 header_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_header.size,
+	 stored_size );
+
+	if( ( header_signature != 0x0001 )
+	 || ( header_version != 0x0002 ) )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_SIGNATURE;
+
+		goto on_corrupted;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_header.checksum,
+	 *stored_checksum );
+
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     calculated_checksum,
+	     (uint8_t *) &bucket_descriptor_block_header,
+	     sizeof( nsfdb_bucket_descriptor_block_header_t ) - 12,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	/* Ignore the checksum itself
+	 */
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     calculated_checksum,
+	     (uint8_t *) bucket_descriptor_block_header.unknown3,
+	     8,
+	     *calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( *stored_checksum != *calculated_checksum )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_HEADER_CHECKSUM;
+
+		goto on_corrupted;
+	}
+	if( ( stored_size < ( sizeof( nsfdb_bucket_descriptor_block_header_t ) + sizeof( nsfdb_bucket_descriptor_block_footer_t ) ) )
+	 || ( (size64_t) stored_size > entry->size )
+	 || ( (size64_t) stored_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_SIZE;
+
+		goto on_corrupted;
+	}
+	/* The data and the footer that follow the header are read at once
+	 */
+	data_size = (size_t) stored_size - sizeof( nsfdb_bucket_descriptor_block_header_t );
+
+	data = (uint8_t *) memory_allocate(
+	                    data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_READ_FAILED;
+
+		goto on_corrupted;
+	}
+	*number_of_bytes += data_size;
+
+	data_size -= sizeof( nsfdb_bucket_descriptor_block_footer_t );
+
+	bucket_descriptor_block_footer = (nsfdb_bucket_descriptor_block_footer_t *) &( data[ data_size ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_descriptor_block_footer->checksum,
+	 *stored_checksum );
+
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     calculated_checksum,
+	     data,
+	     data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( *stored_checksum != *calculated_checksum )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_CHECKSUM;
+
+		goto on_corrupted;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_corrupted:
+	/* A structure that cannot be read is reported as corrupted instead of as an error
+	 */
+	libcerror_error_free(
+	 error );
+
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Checks a RRV bucket
+ * Returns 1 if valid, 0 if corrupted or -1 on error
+ */
+int libnsfdb_structure_map_check_rrv_bucket(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libbfio_handle_t *file_io_handle,
+     libnsfdb_structure_map_entry_t *entry,
+     uint8_t *problem,
+     uint32_t *stored_checksum,
+     uint32_t *calculated_checksum,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	nsfdb_rrv_bucket_header_t *rrv_bucket_header = NULL;
+	uint8_t *data                                = NULL;
+	static char *function                        = "libnsfdb_structure_map_check_rrv_bucket";
+	size_t data_size                             = 0;
+	ssize_t read_count                           = 0;
+
+	if( internal_structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry->size <= sizeof( nsfdb_rrv_bucket_header_t ) )
+	 || ( entry->size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_SIZE;
+
+		goto on_corrupted;
+	}
+	data_size = (size_t) entry->size;
+
+	data = (uint8_t *) memory_allocate(
+	                    data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              entry->file_offset,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_READ_FAILED;
+
+		goto on_corrupted;
+	}
+	*number_of_bytes += data_size;
+
+	rrv_bucket_header = (nsfdb_rrv_bucket_header_t *) data;
+
+	if( rrv_bucket_header->signature != 0x06 )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_SIGNATURE;
+
+		goto on_corrupted;
+	}
+	if( rrv_bucket_header->header_size != 0x20 )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_HEADER_SIZE;
+
+		goto on_corrupted;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 rrv_bucket_header->checksum,
+	 *stored_checksum );
+
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     calculated_checksum,
+	     &( data[ sizeof( nsfdb_rrv_bucket_header_t ) ] ),
+	     data_size - sizeof( nsfdb_rrv_bucket_header_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( *stored_checksum != *calculated_checksum )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_CHECKSUM;
+
+		goto on_corrupted;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_corrupted:
+	/* A structure that cannot be read is reported as corrupted instead of as an error
+	 */
+	libcerror_error_free(
+	 error );
+
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Checks a summary or non-summary bucket
+ * The checksum of a bucket is not verified since the data it covers is not known,
+ * instead the header values are checked and the bucket is read completely
+ * Returns 1 if valid, 0 if corrupted or -1 on error
+ */
+int libnsfdb_structure_map_check_bucket(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libbfio_handle_t *file_io_handle,
+     libnsfdb_structure_map_entry_t *entry,
+     uint8_t *problem,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	nsfdb_bucket_header_t bucket_header;
+
+	uint8_t *data                = NULL;
+	static char *function        = "libnsfdb_structure_map_check_bucket";
+	size_t data_size             = 0;
+	ssize_t read_count           = 0;
+	uint32_t maximum_bucket_size = 0;
+	uint32_t minimum_bucket_size = 0;
+	uint32_t stored_size         = 0;
+
+	if( internal_structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_structure_map->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid structure map - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->type == LIBNSFDB_STRUCTURE_TYPE_SUMMARY_BUCKET )
+	{
+		minimum_bucket_size = internal_structure_map->io_handle->minimum_summary_bucket_size;
+		maximum_bucket_size = internal_structure_map->io_handle->maximum_summary_bucket_size;
+	}
+	else
+	{
+		minimum_bucket_size = internal_structure_map->io_handle->minimum_non_summary_bucket_size;
+		maximum_bucket_size = internal_structure_map->io_handle->maximum_non_summary_bucket_size;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &bucket_header,
+	              sizeof( nsfdb_bucket_header_t ),
+	              entry->file_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( nsfdb_bucket_header_t ) )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_READ_FAILED;
+
+		goto on_corrupted;
+	}
+	*number_of_bytes += sizeof( nsfdb_bucket_header_t );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 bucket_header.size,
+	 stored_size );
+
+	if( bucket_header.signature != 0x02 )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_SIGNATURE;
+
+		goto on_corrupted;
+	}
+	if( bucket_header.header_size != 0x42 )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_HEADER_SIZE;
+
+		goto on_corrupted;
+	}
+	/* A minimum or maximum size of 0 represents a size that is not bounded
+	 */
+	if( ( stored_size <= ( sizeof( nsfdb_bucket_header_t ) + sizeof( nsfdb_bucket_footer_t ) ) )
+	 || ( ( minimum_bucket_size != 0 )
+	  &&  ( stored_size < minimum_bucket_size ) )
+	 || ( ( maximum_bucket_size != 0 )
+	  &&  ( stored_size > maximum_bucket_size ) )
+	 || ( (size64_t) entry->file_offset + stored_size > internal_structure_map->file_size )
+	 || ( (size64_t) stored_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_SIZE;
+
+		goto on_corrupted;
+	}
+	data_size = (size_t) stored_size - sizeof( nsfdb_bucket_header_t );
+
+	data = (uint8_t *) memory_allocate(
+	                    data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		*problem = LIBNSFDB_STRUCTURE_PROBLEM_READ_FAILED;
+
+		goto on_corrupted;
+	}
+	*number_of_bytes += data_size;
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_corrupted:
+	/* A structure that cannot be read is reported as corrupted instead of as an error
+	 */
+	libcerror_error_free(
+	 error );
+
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Checks a specific structure
+ * The structure map is not changed hence structures can be checked concurrently
+ * as long as every thread uses its own file IO handle
+ * The stored and calculated checksum are 0 if the structure has no checksum
+ * Returns 1 if the structure is valid, 0 if corrupted or -1 on error
+ */
+int libnsfdb_structure_map_check_structure(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     int structure_index,
+     uint8_t *problem,
+     uint32_t *stored_checksum,
+     uint32_t *calculated_checksum,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	libnsfdb_structure_map_entry_t *entry                     = NULL;
+	static char *function                                     = "libnsfdb_structure_map_check_structure";
+	int result                                                = 0;
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( ( structure_index < 0 )
+	 || ( structure_index >= internal_structure_map->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid structure index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( problem == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid problem.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stored checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( calculated_checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid calculated checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_structure_map->entries[ structure_index ] );
+
+	*problem             = LIBNSFDB_STRUCTURE_PROBLEM_NONE;
+	*stored_checksum     = 0;
+	*calculated_checksum = 0;
+	*number_of_bytes     = 0;
+
+	switch( entry->type )
+	{
+		case LIBNSFDB_STRUCTURE_TYPE_BUCKET_DESCRIPTOR_BLOCK:
+			result = libnsfdb_structure_map_check_bucket_descriptor_block(
+			          internal_structure_map,
+			          file_io_handle,
+			          entry,
+			          problem,
+			          stored_checksum,
+			          calculated_checksum,
+			          number_of_bytes,
+			          error );
+			break;
+
+		case LIBNSFDB_STRUCTURE_TYPE_RRV_BUCKET:
+			result = libnsfdb_structure_map_check_rrv_bucket(
+			          internal_structure_map,
+			          file_io_handle,
+			          entry,
+			          problem,
+			          stored_checksum,
+			          calculated_checksum,
+			          number_of_bytes,
+			          error );
+			break;
+
+		case LIBNSFDB_STRUCTURE_TYPE_SUPERBLOCK:
+			result = libnsfdb_structure_map_check_superblock(
+			          internal_structure_map,
+			          file_io_handle,
+			          entry,
+			          problem,
+			          stored_checksum,
+			          calculated_checksum,
+			          number_of_bytes,
+			          error );
+			break;
+
+		default:
+			result = libnsfdb_structure_map_check_bucket(
+			          internal_structure_map,
+			          file_io_handle,
+			          entry,
+			          problem,
+			          number_of_bytes,
+			          error );
+			break;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check structure: %d.",
+		 function,
+		 structure_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads the usage of a specific summary or non-summary bucket
+ * The data size is the size of the bucket data and the slots data size
+ * the number of bytes of it used by the slots
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_structure_map_read_bucket_usage(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     int structure_index,
+     uint32_t *data_size,
+     uint32_t *number_of_slots,
+     uint64_t *slots_data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_bucket_slot_t *bucket_slot                       = NULL;
+	libnsfdb_bucket_t *bucket                                 = NULL;
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	libnsfdb_structure_map_entry_t *entry                     = NULL;
+	static char *function                                     = "libnsfdb_structure_map_read_bucket_usage";
+	uint64_t safe_slots_data_size                             = 0;
+	uint32_t safe_number_of_slots                             = 0;
+	uint32_t slot_index                                       = 0;
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( ( structure_index < 0 )
+	 || ( structure_index >= internal_structure_map->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid structure index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_structure_map->entries[ structure_index ] );
+
+	if( ( entry->type != LIBNSFDB_STRUCTURE_TYPE_NON_SUMMARY_BUCKET )
+	 && ( entry->type != LIBNSFDB_STRUCTURE_TYPE_SUMMARY_BUCKET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported structure type.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( slots_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slots data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_bucket_initialize(
+	     &bucket,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bucket.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_bucket_read(
+	     bucket,
+	     file_io_handle,
+	     entry->file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read bucket at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 entry->file_offset,
+		 entry->file_offset );
+
+		goto on_error;
+	}
+	if( libnsfdb_bucket_get_number_of_slots(
+	     bucket,
+	     &safe_number_of_slots,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of slots.",
+		 function );
+
+		goto on_error;
+	}
+	for( slot_index = 0;
+	     slot_index < safe_number_of_slots;
+	     slot_index++ )
+	{
+		if( libnsfdb_bucket_get_slot(
+		     bucket,
+		     slot_index,
+		     &bucket_slot,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve slot: %" PRIu32 ".",
+			 function,
+			 slot_index );
+
+			goto on_error;
+		}
+		if( ( bucket_slot == NULL )
+		 || ( bucket_slot->data == NULL ) )
+		{
+			continue;
+		}
+		safe_slots_data_size += bucket_slot->size;
+	}
+	*data_size       = bucket->data_size;
+	*number_of_slots = safe_number_of_slots;
+	*slots_data_size = safe_slots_data_size;
+
+	if( libnsfdb_bucket_free(
+	     &bucket,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bucket.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( bucket != NULL )
+	{
+		libnsfdb_bucket_free(
+		 &bucket,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the CX compressed data of the superblock
+ * This is the superblock that was used to locate the buckets
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libnsfdb_structure_map_get_superblock_data_size(
+     libnsfdb_structure_map_t *structure_map,
+     size_t *compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	static char *function                                     = "libnsfdb_structure_map_get_superblock_data_size";
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_structure_map->superblock_data == NULL )
+	{
+		return( 0 );
+	}
+	*compressed_data_size   = internal_structure_map->superblock_data_size;
+	*uncompressed_data_size = internal_structure_map->superblock_uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Copies the CX compressed data of the superblock
+ * This is the superblock that was used to locate the buckets
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libnsfdb_structure_map_copy_superblock_data(
+     libnsfdb_structure_map_t *structure_map,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_structure_map_t *internal_structure_map = NULL;
+	static char *function                                     = "libnsfdb_structure_map_copy_superblock_data";
+
+	if( structure_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure map.",
+		 function );
+
+		return( -1 );
+	}
+	internal_structure_map = (libnsfdb_internal_structure_map_t *) structure_map;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_structure_map->superblock_data == NULL )
+	{
+		return( 0 );
+	}
+	if( compressed_data_size < internal_structure_map->superblock_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     compressed_data,
+	     internal_structure_map->superblock_data,
+	     internal_structure_map->superblock_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
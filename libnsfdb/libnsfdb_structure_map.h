@@ -0,0 +1,296 @@
+/*
+ * Structure map functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_STRUCTURE_MAP_H )
+#define _LIBNSFDB_STRUCTURE_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_extern.h"
+#include "libnsfdb_io_handle.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_libfdata.h"
+#include "libnsfdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_structure_map_entry libnsfdb_structure_map_entry_t;
+
+struct libnsfdb_structure_map_entry
+{
+	/* The structure type
+	 */
+	uint8_t type;
+
+	/* The number of the copy, used for the superblocks and bucket descriptor blocks
+	 */
+	int copy_number;
+
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The size, where 0 represents a size that is stored in the header
+	 */
+	size64_t size;
+};
+
+typedef struct libnsfdb_internal_structure_map libnsfdb_internal_structure_map_t;
+
+struct libnsfdb_internal_structure_map
+{
+	/* The IO handle
+	 */
+	libnsfdb_io_handle_t *io_handle;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The database header size
+	 */
+	uint32_t database_header_size;
+
+	/* The superblock offsets
+	 */
+	off64_t superblock_offsets[ 4 ];
+
+	/* The superblock sizes
+	 */
+	uint32_t superblock_sizes[ 4 ];
+
+	/* The bucket descriptor block offsets
+	 */
+	off64_t bucket_descriptor_block_offsets[ 2 ];
+
+	/* The bucket descriptor block sizes
+	 */
+	uint32_t bucket_descriptor_block_sizes[ 2 ];
+
+	/* The RRV bucket size
+	 */
+	uint32_t rrv_bucket_size;
+
+	/* The entries
+	 */
+	libnsfdb_structure_map_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The CX compressed data of the superblock used to locate the buckets
+	 */
+	uint8_t *superblock_data;
+
+	/* The superblock data size
+	 */
+	size_t superblock_data_size;
+
+	/* The uncompressed superblock data size
+	 */
+	size_t superblock_uncompressed_data_size;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The phase that was read last
+	 */
+	uint8_t read_phase;
+};
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_initialize(
+     libnsfdb_structure_map_t **structure_map,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_free(
+     libnsfdb_structure_map_t **structure_map,
+     libcerror_error_t **error );
+
+int libnsfdb_structure_map_append_entry(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     uint8_t type,
+     int copy_number,
+     off64_t file_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libnsfdb_structure_map_append_bucket_list(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libfdata_list_t *bucket_list,
+     uint8_t type,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_read_file_io_handle(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_read_file_header(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_read_database_header(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libnsfdb_structure_map_read_superblock_data(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libbfio_handle_t *file_io_handle,
+     off64_t superblock_offset,
+     uint32_t superblock_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_read_superblock(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_read_bucket_descriptor_block(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_get_format_version(
+     libnsfdb_structure_map_t *structure_map,
+     uint32_t *format_version,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_get_flags(
+     libnsfdb_structure_map_t *structure_map,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_get_number_of_structures(
+     libnsfdb_structure_map_t *structure_map,
+     int *number_of_structures,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_get_structure(
+     libnsfdb_structure_map_t *structure_map,
+     int structure_index,
+     uint8_t *structure_type,
+     int *copy_number,
+     off64_t *file_offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libnsfdb_structure_map_check_superblock(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libbfio_handle_t *file_io_handle,
+     libnsfdb_structure_map_entry_t *entry,
+     uint8_t *problem,
+     uint32_t *stored_checksum,
+     uint32_t *calculated_checksum,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error );
+
+int libnsfdb_structure_map_check_bucket_descriptor_block(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libbfio_handle_t *file_io_handle,
+     libnsfdb_structure_map_entry_t *entry,
+     uint8_t *problem,
+     uint32_t *stored_checksum,
+     uint32_t *calculated_checksum,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error );
+
+int libnsfdb_structure_map_check_rrv_bucket(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libbfio_handle_t *file_io_handle,
+     libnsfdb_structure_map_entry_t *entry,
+     uint8_t *problem,
+     uint32_t *stored_checksum,
+     uint32_t *calculated_checksum,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error );
+
+int libnsfdb_structure_map_check_bucket(
+     libnsfdb_internal_structure_map_t *internal_structure_map,
+     libbfio_handle_t *file_io_handle,
+     libnsfdb_structure_map_entry_t *entry,
+     uint8_t *problem,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_check_structure(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     int structure_index,
+     uint8_t *problem,
+     uint32_t *stored_checksum,
+     uint32_t *calculated_checksum,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_read_bucket_usage(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     int structure_index,
+     uint32_t *data_size,
+     uint32_t *number_of_slots,
+     uint64_t *slots_data_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_get_superblock_data_size(
+     libnsfdb_structure_map_t *structure_map,
+     size_t *compressed_data_size,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_structure_map_copy_superblock_data(
+     libnsfdb_structure_map_t *structure_map,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_STRUCTURE_MAP_H ) */
+
@@ -25,6 +25,8 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libnsfdb_checksum.h"
+#include "libnsfdb_compression.h"
 #include "libnsfdb_definitions.h"
 #include "libnsfdb_io_handle.h"
 #include "libnsfdb_libbfio.h"
@@ -427,3 +429,127 @@ on_error:
 	return( -1 );
 }
 
+/* Calculates a little-endian XOR-32 checksum of data
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_calculate_xor32_checksum(
+     uint32_t *checksum,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_calculate_xor32_checksum";
+
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     checksum,
+	     data,
+	     data_size,
+	     initial_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum size of CX compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cx_get_maximum_compressed_data_size(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_cx_get_maximum_compressed_data_size";
+
+	if( libnsfdb_compression_cx_get_maximum_compressed_data_size(
+	     uncompressed_data_size,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compresses data using CX compression
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cx_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_cx_compress";
+
+	if( libnsfdb_compression_cx_compress(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data,
+	     compressed_data_size,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses CX compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_cx_decompress(
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_cx_decompress";
+
+	/* The compressed data is not modified by the decompression
+	 */
+	if( libnsfdb_compression_cx_decompress(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     (uint8_t *) compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
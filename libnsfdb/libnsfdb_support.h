@@ -74,6 +74,37 @@ int libnsfdb_check_file_signature_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBNSFDB_EXTERN \
+int libnsfdb_calculate_xor32_checksum(
+     uint32_t *checksum,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_cx_get_maximum_compressed_data_size(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_cx_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_cx_decompress(
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
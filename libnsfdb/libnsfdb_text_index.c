@@ -0,0 +1,3032 @@
+/*
+ * Text index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libnsfdb_checksum.h"
+#include "libnsfdb_definitions.h"
+#include "libnsfdb_libbfio.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_text_index.h"
+#include "libnsfdb_types.h"
+
+#include "nsfdb_note.h"
+#include "nsfdb_text_index.h"
+
+const uint8_t nsfdb_text_index_signature[ 8 ] = { 'n', 's', 'f', 'd', 'b', 't', 'x', 'i' };
+
+/* Creates a text index term
+ * Make sure the value text_index_term is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_term_initialize(
+     libnsfdb_text_index_term_t **text_index_term,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_text_index_term_initialize";
+
+	if( text_index_term == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index term.",
+		 function );
+
+		return( -1 );
+	}
+	if( *text_index_term != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid text index term value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) LIBNSFDB_TEXT_INDEX_MAXIMUM_TERM_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*text_index_term = memory_allocate_structure(
+	                    libnsfdb_text_index_term_t );
+
+	if( *text_index_term == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create text index term.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *text_index_term,
+	     0,
+	     sizeof( libnsfdb_text_index_term_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear text index term.",
+		 function );
+
+		memory_free(
+		 *text_index_term );
+
+		*text_index_term = NULL;
+
+		return( -1 );
+	}
+	( *text_index_term )->data = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * data_size );
+
+	if( ( *text_index_term )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *text_index_term )->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	( *text_index_term )->data_size = data_size;
+	( *text_index_term )->hash      = hash;
+	( *text_index_term )->is_sorted = 1;
+
+	return( 1 );
+
+on_error:
+	if( *text_index_term != NULL )
+	{
+		if( ( *text_index_term )->data != NULL )
+		{
+			memory_free(
+			 ( *text_index_term )->data );
+		}
+		memory_free(
+		 *text_index_term );
+
+		*text_index_term = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a text index term
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_term_free(
+     libnsfdb_text_index_term_t **text_index_term,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_text_index_term_free";
+
+	if( text_index_term == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index term.",
+		 function );
+
+		return( -1 );
+	}
+	if( *text_index_term != NULL )
+	{
+		/* The next_hash_term reference is freed elsewhere
+		 */
+		if( ( *text_index_term )->note_identifiers != NULL )
+		{
+			memory_free(
+			 ( *text_index_term )->note_identifiers );
+		}
+		if( ( *text_index_term )->data != NULL )
+		{
+			memory_free(
+			 ( *text_index_term )->data );
+		}
+		memory_free(
+		 *text_index_term );
+
+		*text_index_term = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a note identifier to a text index term
+ * A note identifier that is the same as the last appended note identifier is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_term_append_note_identifier(
+     libnsfdb_text_index_term_t *text_index_term,
+     uint32_t note_identifier,
+     libcerror_error_t **error )
+{
+	void *reallocation                       = NULL;
+	static char *function                    = "libnsfdb_text_index_term_append_note_identifier";
+	size_t note_identifiers_size             = 0;
+	uint32_t last_note_identifier            = 0;
+	int number_of_allocated_note_identifiers = 0;
+
+	if( text_index_term == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index term.",
+		 function );
+
+		return( -1 );
+	}
+	if( text_index_term->number_of_note_identifiers > 0 )
+	{
+		last_note_identifier = text_index_term->note_identifiers[ text_index_term->number_of_note_identifiers - 1 ];
+
+		/* A term commonly occurs multiple times in the same note
+		 */
+		if( note_identifier == last_note_identifier )
+		{
+			return( 1 );
+		}
+		if( note_identifier < last_note_identifier )
+		{
+			text_index_term->is_sorted = 0;
+		}
+	}
+	if( text_index_term->number_of_note_identifiers >= text_index_term->number_of_allocated_note_identifiers )
+	{
+		if( text_index_term->number_of_allocated_note_identifiers == 0 )
+		{
+			number_of_allocated_note_identifiers = 16;
+		}
+		else
+		{
+			number_of_allocated_note_identifiers = text_index_term->number_of_allocated_note_identifiers * 2;
+		}
+		if( number_of_allocated_note_identifiers <= text_index_term->number_of_note_identifiers )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated note identifiers value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		note_identifiers_size = sizeof( uint32_t ) * (size_t) number_of_allocated_note_identifiers;
+
+		if( note_identifiers_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid note identifiers size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                text_index_term->note_identifiers,
+		                note_identifiers_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize note identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		text_index_term->note_identifiers                     = (uint32_t *) reallocation;
+		text_index_term->number_of_allocated_note_identifiers = number_of_allocated_note_identifiers;
+	}
+	text_index_term->note_identifiers[ text_index_term->number_of_note_identifiers ] = note_identifier;
+
+	text_index_term->number_of_note_identifiers += 1;
+
+	return( 1 );
+}
+
+/* Moves a note identifier down the heap until the heap property is restored
+ */
+void libnsfdb_text_index_term_sift_down_note_identifier(
+      uint32_t *note_identifiers,
+      int parent_index,
+      int number_of_note_identifiers )
+{
+	uint32_t note_identifier = 0;
+	int child_index          = 0;
+
+	child_index = ( parent_index * 2 ) + 1;
+
+	while( child_index < number_of_note_identifiers )
+	{
+		if( ( ( child_index + 1 ) < number_of_note_identifiers )
+		 && ( note_identifiers[ child_index + 1 ] > note_identifiers[ child_index ] ) )
+		{
+			child_index++;
+		}
+		if( note_identifiers[ parent_index ] >= note_identifiers[ child_index ] )
+		{
+			break;
+		}
+		note_identifier                  = note_identifiers[ parent_index ];
+		note_identifiers[ parent_index ] = note_identifiers[ child_index ];
+		note_identifiers[ child_index ]  = note_identifier;
+
+		parent_index = child_index;
+		child_index  = ( parent_index * 2 ) + 1;
+	}
+}
+
+/* Sorts the note identifiers of a text index term in ascending order and removes duplicates
+ */
+void libnsfdb_text_index_term_sort_note_identifiers(
+      libnsfdb_text_index_term_t *text_index_term )
+{
+	uint32_t *note_identifiers = NULL;
+	uint32_t note_identifier   = 0;
+	int identifier_index       = 0;
+	int number_of_identifiers  = 0;
+
+	if( ( text_index_term == NULL )
+	 || ( text_index_term->is_sorted != 0 ) )
+	{
+		return;
+	}
+	note_identifiers      = text_index_term->note_identifiers;
+	number_of_identifiers = text_index_term->number_of_note_identifiers;
+
+	for( identifier_index = ( number_of_identifiers / 2 ) - 1;
+	     identifier_index >= 0;
+	     identifier_index-- )
+	{
+		libnsfdb_text_index_term_sift_down_note_identifier(
+		 note_identifiers,
+		 identifier_index,
+		 number_of_identifiers );
+	}
+	for( identifier_index = number_of_identifiers - 1;
+	     identifier_index > 0;
+	     identifier_index-- )
+	{
+		note_identifier                      = note_identifiers[ 0 ];
+		note_identifiers[ 0 ]                = note_identifiers[ identifier_index ];
+		note_identifiers[ identifier_index ] = note_identifier;
+
+		libnsfdb_text_index_term_sift_down_note_identifier(
+		 note_identifiers,
+		 0,
+		 identifier_index );
+	}
+	/* Remove the duplicates, which occur when notes were added out of order
+	 */
+	number_of_identifiers = 0;
+
+	for( identifier_index = 0;
+	     identifier_index < text_index_term->number_of_note_identifiers;
+	     identifier_index++ )
+	{
+		if( ( number_of_identifiers == 0 )
+		 || ( note_identifiers[ identifier_index ] != note_identifiers[ number_of_identifiers - 1 ] ) )
+		{
+			note_identifiers[ number_of_identifiers++ ] = note_identifiers[ identifier_index ];
+		}
+	}
+	text_index_term->number_of_note_identifiers = number_of_identifiers;
+	text_index_term->is_sorted                  = 1;
+}
+
+/* Creates a text index
+ * Make sure the value text_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_initialize(
+     libnsfdb_text_index_t **text_index,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_text_index_t *internal_text_index = NULL;
+	static char *function                               = "libnsfdb_text_index_initialize";
+	size_t hash_table_size                              = 0;
+
+	if( text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *text_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid text index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_text_index = memory_allocate_structure(
+	                       libnsfdb_internal_text_index_t );
+
+	if( internal_text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create text index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_text_index,
+	     0,
+	     sizeof( libnsfdb_internal_text_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear text index.",
+		 function );
+
+		memory_free(
+		 internal_text_index );
+
+		return( -1 );
+	}
+	hash_table_size = sizeof( libnsfdb_text_index_term_t * ) * LIBNSFDB_TEXT_INDEX_HASH_TABLE_SIZE;
+
+	internal_text_index->hash_table = (libnsfdb_text_index_term_t **) memory_allocate(
+	                                                                   hash_table_size );
+
+	if( internal_text_index->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_text_index->hash_table,
+	     0,
+	     hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	*text_index = (libnsfdb_text_index_t *) internal_text_index;
+
+	return( 1 );
+
+on_error:
+	if( internal_text_index != NULL )
+	{
+		if( internal_text_index->hash_table != NULL )
+		{
+			memory_free(
+			 internal_text_index->hash_table );
+		}
+		memory_free(
+		 internal_text_index );
+	}
+	return( -1 );
+}
+
+/* Frees a text index
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_free(
+     libnsfdb_text_index_t **text_index,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_text_index_t *internal_text_index = NULL;
+	static char *function                               = "libnsfdb_text_index_free";
+	int result                                          = 1;
+	int term_index                                      = 0;
+
+	if( text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *text_index != NULL )
+	{
+		internal_text_index = (libnsfdb_internal_text_index_t *) *text_index;
+		*text_index         = NULL;
+
+		if( internal_text_index->terms != NULL )
+		{
+			for( term_index = 0;
+			     term_index < internal_text_index->number_of_terms;
+			     term_index++ )
+			{
+				if( libnsfdb_text_index_term_free(
+				     &( internal_text_index->terms[ term_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free term: %d.",
+					 function,
+					 term_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 internal_text_index->terms );
+		}
+		if( internal_text_index->search_note_identifiers != NULL )
+		{
+			memory_free(
+			 internal_text_index->search_note_identifiers );
+		}
+		if( internal_text_index->hash_table != NULL )
+		{
+			memory_free(
+			 internal_text_index->hash_table );
+		}
+		memory_free(
+		 internal_text_index );
+	}
+	return( result );
+}
+
+/* Calculates the hash of term data
+ * Returns the hash
+ */
+uint32_t libnsfdb_text_index_get_hash(
+          const uint8_t *data,
+          size_t data_size )
+{
+	size_t data_offset  = 0;
+	uint32_t hash_value = 0x811c9dc5UL;
+
+	/* The hash is a 32-bit FNV-1a
+	 */
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		hash_value ^= data[ data_offset ];
+		hash_value *= 0x01000193UL;
+	}
+	return( hash_value );
+}
+
+/* Retrieves the next term in text
+ * A term consists of ASCII letters and digits and bytes of 0x80 or higher.
+ * A byte less than 0x20 followed by a byte of 0x80 or higher is considered a LMBCS group byte
+ * and is part of the term. The ASCII letters are converted to lower case and a term that
+ * is larger than the term data size is truncated.
+ * Returns 1 if successful, 0 if there are no more terms or -1 on error
+ */
+int libnsfdb_text_index_get_next_term(
+     const uint8_t *text,
+     size_t text_size,
+     size_t *text_offset,
+     uint8_t *term_data,
+     size_t term_data_size,
+     size_t *term_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libnsfdb_text_index_get_next_term";
+	size_t safe_term_size = 0;
+	size_t text_index     = 0;
+	uint8_t byte_value    = 0;
+	uint8_t is_term_byte  = 0;
+
+	if( text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text.",
+		 function );
+
+		return( -1 );
+	}
+	if( text_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid text size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( text_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( term_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid term data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( term_data_size == 0 )
+	 || ( term_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid term data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( term_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid term size.",
+		 function );
+
+		return( -1 );
+	}
+	for( text_index = *text_offset;
+	     text_index < text_size;
+	     text_index++ )
+	{
+		byte_value = text[ text_index ];
+
+		if( ( ( byte_value >= (uint8_t) '0' )
+		  &&  ( byte_value <= (uint8_t) '9' ) )
+		 || ( ( byte_value >= (uint8_t) 'A' )
+		  &&  ( byte_value <= (uint8_t) 'Z' ) )
+		 || ( ( byte_value >= (uint8_t) 'a' )
+		  &&  ( byte_value <= (uint8_t) 'z' ) )
+		 || ( byte_value >= 0x80 ) )
+		{
+			is_term_byte = 1;
+		}
+		else if( ( byte_value > 0 )
+		      && ( byte_value < 0x20 )
+		      && ( ( text_index + 1 ) < text_size )
+		      && ( text[ text_index + 1 ] >= 0x80 ) )
+		{
+			is_term_byte = 1;
+		}
+		else
+		{
+			is_term_byte = 0;
+		}
+		if( is_term_byte == 0 )
+		{
+			if( safe_term_size > 0 )
+			{
+				break;
+			}
+			continue;
+		}
+		if( ( byte_value >= (uint8_t) 'A' )
+		 && ( byte_value <= (uint8_t) 'Z' ) )
+		{
+			byte_value += (uint8_t) ( 'a' - 'A' );
+		}
+		if( safe_term_size < term_data_size )
+		{
+			term_data[ safe_term_size ] = byte_value;
+		}
+		safe_term_size++;
+	}
+	*text_offset = text_index;
+
+	if( safe_term_size == 0 )
+	{
+		*term_size = 0;
+
+		return( 0 );
+	}
+	if( safe_term_size > term_data_size )
+	{
+		safe_term_size = term_data_size;
+	}
+	*term_size = safe_term_size;
+
+	return( 1 );
+}
+
+/* Retrieves a specific term
+ * Returns 1 if successful, 0 if no such term was found or -1 on error
+ */
+int libnsfdb_text_index_get_term(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t hash,
+     libnsfdb_text_index_term_t **text_index_term,
+     libcerror_error_t **error )
+{
+	libnsfdb_text_index_term_t *hash_term = NULL;
+	static char *function                 = "libnsfdb_text_index_get_term";
+
+	if( internal_text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_text_index->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid text index - missing hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( text_index_term == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index term.",
+		 function );
+
+		return( -1 );
+	}
+	hash_term = internal_text_index->hash_table[ hash % LIBNSFDB_TEXT_INDEX_HASH_TABLE_SIZE ];
+
+	while( hash_term != NULL )
+	{
+		if( ( hash_term->hash == hash )
+		 && ( hash_term->data_size == data_size )
+		 && ( memory_compare(
+		       hash_term->data,
+		       data,
+		       data_size ) == 0 ) )
+		{
+			*text_index_term = hash_term;
+
+			return( 1 );
+		}
+		hash_term = hash_term->next_hash_term;
+	}
+	*text_index_term = NULL;
+
+	return( 0 );
+}
+
+/* Appends a term if it is not already in the text index
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_append_term(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     const uint8_t *data,
+     size_t data_size,
+     libnsfdb_text_index_term_t **text_index_term,
+     libcerror_error_t **error )
+{
+	libnsfdb_text_index_term_t *safe_text_index_term = NULL;
+	void *reallocation                               = NULL;
+	static char *function                            = "libnsfdb_text_index_append_term";
+	size_t terms_size                                = 0;
+	uint32_t hash                                    = 0;
+	uint32_t hash_table_index                        = 0;
+	int number_of_allocated_terms                    = 0;
+	int result                                       = 0;
+
+	if( internal_text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	if( text_index_term == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index term.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libnsfdb_text_index_get_hash(
+	        data,
+	        data_size );
+
+	result = libnsfdb_text_index_get_term(
+	          internal_text_index,
+	          data,
+	          data_size,
+	          hash,
+	          &safe_text_index_term,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve term.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*text_index_term = safe_text_index_term;
+
+		return( 1 );
+	}
+	if( internal_text_index->number_of_terms >= internal_text_index->number_of_allocated_terms )
+	{
+		if( internal_text_index->number_of_allocated_terms == 0 )
+		{
+			number_of_allocated_terms = 1024;
+		}
+		else
+		{
+			number_of_allocated_terms = internal_text_index->number_of_allocated_terms * 2;
+		}
+		if( number_of_allocated_terms <= internal_text_index->number_of_terms )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated terms value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		terms_size = sizeof( libnsfdb_text_index_term_t * ) * (size_t) number_of_allocated_terms;
+
+		if( terms_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid terms size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                internal_text_index->terms,
+		                terms_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize terms.",
+			 function );
+
+			return( -1 );
+		}
+		internal_text_index->terms                     = (libnsfdb_text_index_term_t **) reallocation;
+		internal_text_index->number_of_allocated_terms = number_of_allocated_terms;
+	}
+	if( libnsfdb_text_index_term_initialize(
+	     &safe_text_index_term,
+	     data,
+	     data_size,
+	     hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create term.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_index = hash % LIBNSFDB_TEXT_INDEX_HASH_TABLE_SIZE;
+
+	safe_text_index_term->next_hash_term                = internal_text_index->hash_table[ hash_table_index ];
+	internal_text_index->hash_table[ hash_table_index ] = safe_text_index_term;
+
+	internal_text_index->terms[ internal_text_index->number_of_terms ] = safe_text_index_term;
+
+	internal_text_index->number_of_terms += 1;
+
+	*text_index_term = safe_text_index_term;
+
+	return( 1 );
+}
+
+/* Reads the terms of text
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_read_text(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     const uint8_t *text,
+     size_t text_size,
+     uint32_t note_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t term_data[ LIBNSFDB_TEXT_INDEX_MAXIMUM_TERM_SIZE ];
+
+	libnsfdb_text_index_term_t *text_index_term = NULL;
+	static char *function                       = "libnsfdb_text_index_read_text";
+	size_t term_size                            = 0;
+	size_t text_offset                          = 0;
+	int result                                  = 0;
+
+	if( internal_text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libnsfdb_text_index_get_next_term(
+		          text,
+		          text_size,
+		          &text_offset,
+		          term_data,
+		          LIBNSFDB_TEXT_INDEX_MAXIMUM_TERM_SIZE,
+		          &term_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next term.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libnsfdb_text_index_append_term(
+		     internal_text_index,
+		     term_data,
+		     term_size,
+		     &text_index_term,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append term.",
+			 function );
+
+			return( -1 );
+		}
+		if( libnsfdb_text_index_term_append_note_identifier(
+		     text_index_term,
+		     note_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append note identifier to term.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( text_offset < text_size );
+
+	return( 1 );
+}
+
+/* Reads the terms of the text items in the note data
+ * Only the items of the text class are read
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_read_note_data(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     const uint8_t *note_data,
+     size_t note_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *note_item_data = NULL;
+	static char *function         = "libnsfdb_text_index_read_note_data";
+	size_t item_data_offset       = 0;
+	uint32_t note_identifier      = 0;
+	uint32_t note_size            = 0;
+	uint16_t data_size            = 0;
+	uint16_t field_flags          = 0;
+	uint16_t item_value_type      = 0;
+	uint16_t note_item_index      = 0;
+	uint16_t note_signature       = 0;
+	uint16_t number_of_note_items = 0;
+
+	if( internal_text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( note_data_size < sizeof( nsfdb_note_header_t ) )
+	 || ( note_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid note data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->signature,
+	 note_signature );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->size,
+	 note_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->rrv_identifier,
+	 note_identifier );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (nsfdb_note_header_t *) note_data )->number_of_note_items,
+	 number_of_note_items );
+
+	if( note_signature != 0x0004 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported note signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) note_size != note_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid note size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	item_data_offset = sizeof( nsfdb_note_header_t ) + ( (size_t) number_of_note_items * sizeof( nsfdb_note_item_t ) );
+
+	if( item_data_offset > note_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of note items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	note_item_data = &( note_data[ sizeof( nsfdb_note_header_t ) ] );
+
+	for( note_item_index = 0;
+	     note_item_index < number_of_note_items;
+	     note_item_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (nsfdb_note_item_t *) note_item_data )->field_flags,
+		 field_flags );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (nsfdb_note_item_t *) note_item_data )->data_size,
+		 data_size );
+
+		note_item_data += sizeof( nsfdb_note_item_t );
+
+		/* Only the data of the summary items is stored in the note data
+		 */
+		if( ( ( field_flags & LIBNSFDB_NOTE_ITEM_FIELD_FLAG_SUMMARY ) == 0 )
+		 || ( data_size == 0 ) )
+		{
+			continue;
+		}
+		if( (size_t) data_size > ( note_data_size - item_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid note item: %" PRIu16 " data size value out of bounds.",
+			 function,
+			 note_item_index );
+
+			return( -1 );
+		}
+		/* The item data starts with a 16-bit type value of which the upper byte contains the note item class
+		 */
+		if( data_size > 2 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( note_data[ item_data_offset ] ),
+			 item_value_type );
+
+			if( (uint8_t) ( item_value_type >> 8 ) == LIBNSFDB_NOTE_ITEM_CLASS_TEXT )
+			{
+				if( libnsfdb_text_index_read_text(
+				     internal_text_index,
+				     &( note_data[ item_data_offset + 2 ] ),
+				     (size_t) data_size - 2,
+				     note_identifier,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read note item: %" PRIu16 " text.",
+					 function,
+					 note_item_index );
+
+					return( -1 );
+				}
+			}
+		}
+		item_data_offset += data_size;
+	}
+	return( 1 );
+}
+
+/* Merges the terms of a source text index into the text index
+ * This is used to combine text indexes that were built for different ranges of notes
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_merge(
+     libnsfdb_text_index_t *text_index,
+     libnsfdb_text_index_t *source_text_index,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_text_index_t *internal_source_text_index = NULL;
+	libnsfdb_internal_text_index_t *internal_text_index        = NULL;
+	libnsfdb_text_index_term_t *source_text_index_term         = NULL;
+	libnsfdb_text_index_term_t *text_index_term                = NULL;
+	static char *function                                      = "libnsfdb_text_index_merge";
+	int identifier_index                                       = 0;
+	int term_index                                             = 0;
+
+	if( text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_text_index = (libnsfdb_internal_text_index_t *) text_index;
+
+	if( source_text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source text index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_text_index = (libnsfdb_internal_text_index_t *) source_text_index;
+
+	if( internal_source_text_index == internal_text_index )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source text index value same as text index.",
+		 function );
+
+		return( -1 );
+	}
+	for( term_index = 0;
+	     term_index < internal_source_text_index->number_of_terms;
+	     term_index++ )
+	{
+		source_text_index_term = internal_source_text_index->terms[ term_index ];
+
+		if( libnsfdb_text_index_append_term(
+		     internal_text_index,
+		     source_text_index_term->data,
+		     source_text_index_term->data_size,
+		     &text_index_term,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append term: %d.",
+			 function,
+			 term_index );
+
+			return( -1 );
+		}
+		for( identifier_index = 0;
+		     identifier_index < source_text_index_term->number_of_note_identifiers;
+		     identifier_index++ )
+		{
+			if( libnsfdb_text_index_term_append_note_identifier(
+			     text_index_term,
+			     source_text_index_term->note_identifiers[ identifier_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append note identifier to term: %d.",
+				 function,
+				 term_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of terms
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_get_number_of_terms(
+     libnsfdb_text_index_t *text_index,
+     int *number_of_terms,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_text_index_t *internal_text_index = NULL;
+	static char *function                               = "libnsfdb_text_index_get_number_of_terms";
+
+	if( text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_text_index = (libnsfdb_internal_text_index_t *) text_index;
+
+	if( number_of_terms == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of terms.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_terms = internal_text_index->number_of_terms;
+
+	return( 1 );
+}
+
+/* Determines the size of a variable-length integer
+ * Returns the size
+ */
+size_t libnsfdb_text_index_get_varint_size(
+        uint32_t value )
+{
+	size_t value_size = 1;
+
+	while( value >= 0x80 )
+	{
+		value >>= 7;
+
+		value_size++;
+	}
+	return( value_size );
+}
+
+/* Copies a variable-length integer to data
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_copy_varint_to_data(
+     uint32_t value,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libnsfdb_text_index_copy_varint_to_data";
+	size_t safe_data_offset = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	if( ( safe_data_offset >= data_size )
+	 || ( libnsfdb_text_index_get_varint_size( value ) > ( data_size - safe_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	while( value >= 0x80 )
+	{
+		data[ safe_data_offset++ ] = (uint8_t) ( value & 0x7f ) | 0x80;
+
+		value >>= 7;
+	}
+	data[ safe_data_offset++ ] = (uint8_t) value;
+
+	*data_offset = safe_data_offset;
+
+	return( 1 );
+}
+
+/* Copies a variable-length integer from data
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_copy_varint_from_data(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint32_t *value,
+     libcerror_error_t **error )
+{
+	static char *function   = "libnsfdb_text_index_copy_varint_from_data";
+	size_t safe_data_offset = 0;
+	uint32_t safe_value     = 0;
+	uint8_t bit_shift       = 0;
+	uint8_t byte_value      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	do
+	{
+		if( safe_data_offset >= data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_value = data[ safe_data_offset++ ];
+
+		/* The 5th byte of a 32-bit value can only contain 4 bits
+		 */
+		if( ( bit_shift == 28 )
+		 && ( byte_value > 0x0f ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value |= (uint32_t) ( byte_value & 0x7f ) << bit_shift;
+
+		bit_shift += 7;
+	}
+	while( ( byte_value & 0x80 ) != 0 );
+
+	*data_offset = safe_data_offset;
+	*value       = safe_value;
+
+	return( 1 );
+}
+
+/* Compares the data of 2 terms
+ * Returns -1 if the first term comes before the second, 1 if it comes after or 0 if they are the same
+ */
+int libnsfdb_text_index_compare_terms(
+     libnsfdb_text_index_term_t *first_text_index_term,
+     libnsfdb_text_index_term_t *second_text_index_term )
+{
+	size_t compare_size = 0;
+	int result          = 0;
+
+	compare_size = first_text_index_term->data_size;
+
+	if( compare_size > second_text_index_term->data_size )
+	{
+		compare_size = second_text_index_term->data_size;
+	}
+	result = memory_compare(
+	          first_text_index_term->data,
+	          second_text_index_term->data,
+	          compare_size );
+
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	if( first_text_index_term->data_size < second_text_index_term->data_size )
+	{
+		return( -1 );
+	}
+	else if( first_text_index_term->data_size > second_text_index_term->data_size )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Moves a term down the heap until the heap property is restored
+ */
+void libnsfdb_text_index_sift_down_term(
+      libnsfdb_text_index_term_t **terms,
+      int parent_index,
+      int number_of_terms )
+{
+	libnsfdb_text_index_term_t *text_index_term = NULL;
+	int child_index                             = 0;
+
+	child_index = ( parent_index * 2 ) + 1;
+
+	while( child_index < number_of_terms )
+	{
+		if( ( ( child_index + 1 ) < number_of_terms )
+		 && ( libnsfdb_text_index_compare_terms(
+		       terms[ child_index + 1 ],
+		       terms[ child_index ] ) > 0 ) )
+		{
+			child_index++;
+		}
+		if( libnsfdb_text_index_compare_terms(
+		     terms[ parent_index ],
+		     terms[ child_index ] ) >= 0 )
+		{
+			break;
+		}
+		text_index_term       = terms[ parent_index ];
+		terms[ parent_index ] = terms[ child_index ];
+		terms[ child_index ]  = text_index_term;
+
+		parent_index = child_index;
+		child_index  = ( parent_index * 2 ) + 1;
+	}
+}
+
+/* Sorts terms by their data in ascending order
+ */
+void libnsfdb_text_index_sort_terms(
+      libnsfdb_text_index_term_t **terms,
+      int number_of_terms )
+{
+	libnsfdb_text_index_term_t *text_index_term = NULL;
+	int term_index                              = 0;
+
+	if( ( terms == NULL )
+	 || ( number_of_terms < 2 ) )
+	{
+		return;
+	}
+	for( term_index = ( number_of_terms / 2 ) - 1;
+	     term_index >= 0;
+	     term_index-- )
+	{
+		libnsfdb_text_index_sift_down_term(
+		 terms,
+		 term_index,
+		 number_of_terms );
+	}
+	for( term_index = number_of_terms - 1;
+	     term_index > 0;
+	     term_index-- )
+	{
+		text_index_term     = terms[ 0 ];
+		terms[ 0 ]          = terms[ term_index ];
+		terms[ term_index ] = text_index_term;
+
+		libnsfdb_text_index_sift_down_term(
+		 terms,
+		 0,
+		 term_index );
+	}
+}
+
+/* Writes the text index to data
+ * The data contains the text index file header followed by the terms
+ * The data is allocated and must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_write_data(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_text_index_term_t **sorted_terms    = NULL;
+	libnsfdb_text_index_term_t *text_index_term  = NULL;
+	nsfdb_text_index_header_t *text_index_header = NULL;
+	uint8_t *safe_data                           = NULL;
+	static char *function                        = "libnsfdb_text_index_write_data";
+	size64_t number_of_note_identifiers          = 0;
+	size64_t terms_data_size                     = 0;
+	size_t data_offset                           = 0;
+	size_t safe_data_size                        = 0;
+	uint32_t calculated_checksum                 = 0;
+	uint32_t previous_note_identifier            = 0;
+	int identifier_index                         = 0;
+	int term_index                               = 0;
+
+	if( internal_text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The note identifiers are sorted first since this removes duplicates
+	 */
+	for( term_index = 0;
+	     term_index < internal_text_index->number_of_terms;
+	     term_index++ )
+	{
+		text_index_term = internal_text_index->terms[ term_index ];
+
+		libnsfdb_text_index_term_sort_note_identifiers(
+		 text_index_term );
+
+		terms_data_size += libnsfdb_text_index_get_varint_size(
+		                    (uint32_t) text_index_term->data_size );
+
+		terms_data_size += text_index_term->data_size;
+
+		terms_data_size += libnsfdb_text_index_get_varint_size(
+		                    (uint32_t) text_index_term->number_of_note_identifiers );
+
+		previous_note_identifier = 0;
+
+		for( identifier_index = 0;
+		     identifier_index < text_index_term->number_of_note_identifiers;
+		     identifier_index++ )
+		{
+			terms_data_size += libnsfdb_text_index_get_varint_size(
+			                    text_index_term->note_identifiers[ identifier_index ] - previous_note_identifier );
+
+			previous_note_identifier = text_index_term->note_identifiers[ identifier_index ];
+		}
+		number_of_note_identifiers += (size64_t) text_index_term->number_of_note_identifiers;
+	}
+	if( number_of_note_identifiers > (size64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of note identifiers value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( terms_data_size > (size64_t) UINT32_MAX )
+	 || ( terms_data_size > (size64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( nsfdb_text_index_header_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid terms data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_data_size = sizeof( nsfdb_text_index_header_t ) + (size_t) terms_data_size;
+
+	safe_data = (uint8_t *) memory_allocate(
+	                         safe_data_size );
+
+	if( safe_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_data,
+	     0,
+	     sizeof( nsfdb_text_index_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear text index header.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_text_index->number_of_terms > 0 )
+	{
+		/* The terms are sorted in a separate array since the order
+		 * of the terms array is used by the merge
+		 */
+		sorted_terms = (libnsfdb_text_index_term_t **) memory_allocate(
+		                                                sizeof( libnsfdb_text_index_term_t * ) * (size_t) internal_text_index->number_of_terms );
+
+		if( sorted_terms == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sorted terms.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     sorted_terms,
+		     internal_text_index->terms,
+		     sizeof( libnsfdb_text_index_term_t * ) * (size_t) internal_text_index->number_of_terms ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sorted terms.",
+			 function );
+
+			goto on_error;
+		}
+		libnsfdb_text_index_sort_terms(
+		 sorted_terms,
+		 internal_text_index->number_of_terms );
+	}
+	data_offset = sizeof( nsfdb_text_index_header_t );
+
+	for( term_index = 0;
+	     term_index < internal_text_index->number_of_terms;
+	     term_index++ )
+	{
+		text_index_term = sorted_terms[ term_index ];
+
+		if( libnsfdb_text_index_copy_varint_to_data(
+		     (uint32_t) text_index_term->data_size,
+		     safe_data,
+		     safe_data_size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy term: %d size to data.",
+			 function,
+			 term_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( safe_data[ data_offset ] ),
+		     text_index_term->data,
+		     text_index_term->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy term: %d data.",
+			 function,
+			 term_index );
+
+			goto on_error;
+		}
+		data_offset += text_index_term->data_size;
+
+		if( libnsfdb_text_index_copy_varint_to_data(
+		     (uint32_t) text_index_term->number_of_note_identifiers,
+		     safe_data,
+		     safe_data_size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy term: %d number of note identifiers to data.",
+			 function,
+			 term_index );
+
+			goto on_error;
+		}
+		previous_note_identifier = 0;
+
+		for( identifier_index = 0;
+		     identifier_index < text_index_term->number_of_note_identifiers;
+		     identifier_index++ )
+		{
+			if( libnsfdb_text_index_copy_varint_to_data(
+			     text_index_term->note_identifiers[ identifier_index ] - previous_note_identifier,
+			     safe_data,
+			     safe_data_size,
+			     &data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to copy term: %d note identifier: %d to data.",
+				 function,
+				 term_index,
+				 identifier_index );
+
+				goto on_error;
+			}
+			previous_note_identifier = text_index_term->note_identifiers[ identifier_index ];
+		}
+	}
+	if( sorted_terms != NULL )
+	{
+		memory_free(
+		 sorted_terms );
+
+		sorted_terms = NULL;
+	}
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     &( safe_data[ sizeof( nsfdb_text_index_header_t ) ] ),
+	     (size_t) terms_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	text_index_header = (nsfdb_text_index_header_t *) safe_data;
+
+	if( memory_copy(
+	     text_index_header->signature,
+	     nsfdb_text_index_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 text_index_header->format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 text_index_header->number_of_terms,
+	 (uint32_t) internal_text_index->number_of_terms );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 text_index_header->number_of_note_identifiers,
+	 (uint32_t) number_of_note_identifiers );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 text_index_header->data_size,
+	 (uint32_t) terms_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 text_index_header->checksum,
+	 calculated_checksum );
+
+	*data      = safe_data;
+	*data_size = safe_data_size;
+
+	return( 1 );
+
+on_error:
+	if( sorted_terms != NULL )
+	{
+		memory_free(
+		 sorted_terms );
+	}
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	return( -1 );
+}
+
+/* Reads the text index from data
+ * The data contains the text index file header followed by the terms
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_read_data(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_text_index_term_t *text_index_term = NULL;
+	static char *function                       = "libnsfdb_text_index_read_data";
+	size_t data_offset                          = 0;
+	uint32_t calculated_checksum                = 0;
+	uint32_t format_version                     = 0;
+	uint32_t identifier_index                   = 0;
+	uint32_t note_identifier                    = 0;
+	uint32_t note_identifier_delta              = 0;
+	uint32_t number_of_note_identifiers         = 0;
+	uint32_t number_of_term_note_identifiers    = 0;
+	uint32_t number_of_terms                    = 0;
+	uint32_t stored_checksum                    = 0;
+	uint32_t term_index                         = 0;
+	uint32_t term_size                          = 0;
+	uint32_t terms_data_size                    = 0;
+	uint32_t total_number_of_note_identifiers   = 0;
+
+	if( internal_text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( nsfdb_text_index_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (nsfdb_text_index_header_t *) data )->signature,
+	     nsfdb_text_index_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported text index signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_text_index_header_t *) data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_text_index_header_t *) data )->number_of_terms,
+	 number_of_terms );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_text_index_header_t *) data )->number_of_note_identifiers,
+	 total_number_of_note_identifiers );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_text_index_header_t *) data )->data_size,
+	 terms_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (nsfdb_text_index_header_t *) data )->checksum,
+	 stored_checksum );
+
+	if( format_version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( (size_t) terms_data_size != ( data_size - sizeof( nsfdb_text_index_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     &( data[ sizeof( nsfdb_text_index_header_t ) ] ),
+	     (size_t) terms_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	data_offset = sizeof( nsfdb_text_index_header_t );
+
+	for( term_index = 0;
+	     term_index < number_of_terms;
+	     term_index++ )
+	{
+		if( libnsfdb_text_index_copy_varint_from_data(
+		     data,
+		     data_size,
+		     &data_offset,
+		     &term_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to copy term: %" PRIu32 " size from data.",
+			 function,
+			 term_index );
+
+			return( -1 );
+		}
+		if( ( term_size == 0 )
+		 || ( term_size > LIBNSFDB_TEXT_INDEX_MAXIMUM_TERM_SIZE )
+		 || ( (size_t) term_size > ( data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid term: %" PRIu32 " size value out of bounds.",
+			 function,
+			 term_index );
+
+			return( -1 );
+		}
+		if( libnsfdb_text_index_append_term(
+		     internal_text_index,
+		     &( data[ data_offset ] ),
+		     (size_t) term_size,
+		     &text_index_term,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append term: %" PRIu32 ".",
+			 function,
+			 term_index );
+
+			return( -1 );
+		}
+		data_offset += term_size;
+
+		if( libnsfdb_text_index_copy_varint_from_data(
+		     data,
+		     data_size,
+		     &data_offset,
+		     &number_of_term_note_identifiers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to copy term: %" PRIu32 " number of note identifiers from data.",
+			 function,
+			 term_index );
+
+			return( -1 );
+		}
+		/* Every note identifier consists of at least 1 byte
+		 */
+		if( (size_t) number_of_term_note_identifiers > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid term: %" PRIu32 " number of note identifiers value out of bounds.",
+			 function,
+			 term_index );
+
+			return( -1 );
+		}
+		note_identifier = 0;
+
+		for( identifier_index = 0;
+		     identifier_index < number_of_term_note_identifiers;
+		     identifier_index++ )
+		{
+			if( libnsfdb_text_index_copy_varint_from_data(
+			     data,
+			     data_size,
+			     &data_offset,
+			     &note_identifier_delta,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to copy term: %" PRIu32 " note identifier: %" PRIu32 " from data.",
+				 function,
+				 term_index,
+				 identifier_index );
+
+				return( -1 );
+			}
+			if( note_identifier_delta > ( UINT32_MAX - note_identifier ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid term: %" PRIu32 " note identifier: %" PRIu32 " value out of bounds.",
+				 function,
+				 term_index,
+				 identifier_index );
+
+				return( -1 );
+			}
+			note_identifier += note_identifier_delta;
+
+			if( libnsfdb_text_index_term_append_note_identifier(
+			     text_index_term,
+			     note_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append note identifier to term: %" PRIu32 ".",
+				 function,
+				 term_index );
+
+				return( -1 );
+			}
+		}
+		number_of_note_identifiers += number_of_term_note_identifiers;
+	}
+	if( data_offset != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_note_identifiers != total_number_of_note_identifiers )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in number of note identifiers ( %" PRIu32 " != %" PRIu32 " ).",
+		 function,
+		 total_number_of_note_identifiers,
+		 number_of_note_identifiers );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the text index to a file
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_write(
+     libnsfdb_text_index_t *text_index,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *text_index_io_handle = NULL;
+	uint8_t *data                          = NULL;
+	static char *function                  = "libnsfdb_text_index_write";
+	size_t data_size                       = 0;
+	size_t filename_length                 = 0;
+	ssize_t write_count                    = 0;
+
+	if( text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_text_index_write_data(
+	     (libnsfdb_internal_text_index_t *) text_index,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write text index data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &text_index_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create text index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     text_index_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in text index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     text_index_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open text index file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               text_index_io_handle,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write text index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     text_index_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close text index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &text_index_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free text index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( text_index_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 text_index_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &text_index_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Reads the text index from a file
+ * The terms of the file are added to the terms already in the text index
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_read(
+     libnsfdb_text_index_t *text_index,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *text_index_io_handle = NULL;
+	uint8_t *data                          = NULL;
+	static char *function                  = "libnsfdb_text_index_read";
+	size64_t data_size                     = 0;
+	size_t filename_length                 = 0;
+	ssize_t read_count                     = 0;
+
+	if( text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &text_index_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create text index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     text_index_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in text index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     text_index_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open text index file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     text_index_io_handle,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve text index file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_size < (size64_t) sizeof( nsfdb_text_index_header_t ) )
+	 || ( data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid text index file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    (size_t) data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              text_index_io_handle,
+	              data,
+	              (size_t) data_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read text index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     text_index_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close text index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &text_index_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free text index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_text_index_read_data(
+	     (libnsfdb_internal_text_index_t *) text_index,
+	     data,
+	     (size_t) data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read text index data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( text_index_io_handle != NULL )
+	{
+		libbfio_handle_close(
+		 text_index_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &text_index_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Searches the text index for the notes that contain all the terms of a query
+ * The query is split into terms in the same way as the text of the notes
+ * The note identifiers of the notes found are sorted in ascending order
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_search(
+     libnsfdb_text_index_t *text_index,
+     const uint8_t *query,
+     size_t query_size,
+     int *number_of_note_identifiers,
+     libcerror_error_t **error )
+{
+	uint8_t term_data[ LIBNSFDB_TEXT_INDEX_MAXIMUM_TERM_SIZE ];
+
+	libnsfdb_internal_text_index_t *internal_text_index = NULL;
+	libnsfdb_text_index_term_t *text_index_term         = NULL;
+	uint32_t *search_note_identifiers                   = NULL;
+	static char *function                               = "libnsfdb_text_index_search";
+	size_t query_offset                                 = 0;
+	size_t term_size                                    = 0;
+	int identifier_index                                = 0;
+	int number_of_search_note_identifiers               = 0;
+	int number_of_terms                                 = 0;
+	int result                                          = 0;
+	int search_identifier_index                         = 0;
+
+	if( text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_text_index = (libnsfdb_internal_text_index_t *) text_index;
+
+	if( number_of_note_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of note identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_text_index->search_note_identifiers != NULL )
+	{
+		memory_free(
+		 internal_text_index->search_note_identifiers );
+
+		internal_text_index->search_note_identifiers = NULL;
+	}
+	internal_text_index->number_of_search_note_identifiers = 0;
+
+	do
+	{
+		result = libnsfdb_text_index_get_next_term(
+		          query,
+		          query_size,
+		          &query_offset,
+		          term_data,
+		          LIBNSFDB_TEXT_INDEX_MAXIMUM_TERM_SIZE,
+		          &term_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next query term.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libnsfdb_text_index_get_term(
+		          internal_text_index,
+		          term_data,
+		          term_size,
+		          libnsfdb_text_index_get_hash(
+		           term_data,
+		           term_size ),
+		          &text_index_term,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve term.",
+			 function );
+
+			goto on_error;
+		}
+		/* A note needs to contain all the terms of the query
+		 */
+		else if( result == 0 )
+		{
+			number_of_search_note_identifiers = 0;
+
+			break;
+		}
+		libnsfdb_text_index_term_sort_note_identifiers(
+		 text_index_term );
+
+		if( number_of_terms == 0 )
+		{
+			if( text_index_term->number_of_note_identifiers > 0 )
+			{
+				search_note_identifiers = (uint32_t *) memory_allocate(
+				                                        sizeof( uint32_t ) * (size_t) text_index_term->number_of_note_identifiers );
+
+				if( search_note_identifiers == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create search note identifiers.",
+					 function );
+
+					goto on_error;
+				}
+				if( memory_copy(
+				     search_note_identifiers,
+				     text_index_term->note_identifiers,
+				     sizeof( uint32_t ) * (size_t) text_index_term->number_of_note_identifiers ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy search note identifiers.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			number_of_search_note_identifiers = text_index_term->number_of_note_identifiers;
+		}
+		else
+		{
+			/* Both lists of note identifiers are sorted, so the intersection
+			 * is determined in a single pass and stored in place
+			 */
+			identifier_index = 0;
+			result           = 0;
+
+			for( search_identifier_index = 0;
+			     search_identifier_index < number_of_search_note_identifiers;
+			     search_identifier_index++ )
+			{
+				while( ( identifier_index < text_index_term->number_of_note_identifiers )
+				    && ( text_index_term->note_identifiers[ identifier_index ] < search_note_identifiers[ search_identifier_index ] ) )
+				{
+					identifier_index++;
+				}
+				if( identifier_index >= text_index_term->number_of_note_identifiers )
+				{
+					break;
+				}
+				if( text_index_term->note_identifiers[ identifier_index ] == search_note_identifiers[ search_identifier_index ] )
+				{
+					search_note_identifiers[ result++ ] = search_note_identifiers[ search_identifier_index ];
+				}
+			}
+			number_of_search_note_identifiers = result;
+		}
+		number_of_terms++;
+	}
+	while( ( query_offset < query_size )
+	    && ( number_of_search_note_identifiers > 0 ) );
+
+	if( number_of_search_note_identifiers == 0 )
+	{
+		if( search_note_identifiers != NULL )
+		{
+			memory_free(
+			 search_note_identifiers );
+		}
+	}
+	else
+	{
+		internal_text_index->search_note_identifiers           = search_note_identifiers;
+		internal_text_index->number_of_search_note_identifiers = number_of_search_note_identifiers;
+	}
+	*number_of_note_identifiers = number_of_search_note_identifiers;
+
+	return( 1 );
+
+on_error:
+	if( search_note_identifiers != NULL )
+	{
+		memory_free(
+		 search_note_identifiers );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific note identifier of the last search
+ * Returns 1 if successful or -1 on error
+ */
+int libnsfdb_text_index_get_search_note_identifier(
+     libnsfdb_text_index_t *text_index,
+     int note_identifier_index,
+     uint32_t *note_identifier,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_text_index_t *internal_text_index = NULL;
+	static char *function                               = "libnsfdb_text_index_get_search_note_identifier";
+
+	if( text_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid text index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_text_index = (libnsfdb_internal_text_index_t *) text_index;
+
+	if( ( note_identifier_index < 0 )
+	 || ( note_identifier_index >= internal_text_index->number_of_search_note_identifiers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid note identifier index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( note_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid note identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*note_identifier = internal_text_index->search_note_identifiers[ note_identifier_index ];
+
+	return( 1 );
+}
+
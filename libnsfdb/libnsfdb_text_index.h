@@ -0,0 +1,263 @@
+/*
+ * Text index functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBNSFDB_TEXT_INDEX_H )
+#define _LIBNSFDB_TEXT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libnsfdb_extern.h"
+#include "libnsfdb_libcerror.h"
+#include "libnsfdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libnsfdb_text_index_term libnsfdb_text_index_term_t;
+
+struct libnsfdb_text_index_term
+{
+	/* The term data
+	 */
+	uint8_t *data;
+
+	/* The term data size
+	 */
+	size_t data_size;
+
+	/* The hash of the term data
+	 */
+	uint32_t hash;
+
+	/* The note identifiers
+	 */
+	uint32_t *note_identifiers;
+
+	/* The number of note identifiers
+	 */
+	int number_of_note_identifiers;
+
+	/* The number of allocated note identifiers
+	 */
+	int number_of_allocated_note_identifiers;
+
+	/* Value to indicate the note identifiers are sorted and unique
+	 */
+	uint8_t is_sorted;
+
+	/* The next term in the hash table
+	 */
+	libnsfdb_text_index_term_t *next_hash_term;
+};
+
+typedef struct libnsfdb_internal_text_index libnsfdb_internal_text_index_t;
+
+struct libnsfdb_internal_text_index
+{
+	/* The hash table
+	 */
+	libnsfdb_text_index_term_t **hash_table;
+
+	/* The terms
+	 */
+	libnsfdb_text_index_term_t **terms;
+
+	/* The number of terms
+	 */
+	int number_of_terms;
+
+	/* The number of allocated terms
+	 */
+	int number_of_allocated_terms;
+
+	/* The note identifiers of the last search
+	 */
+	uint32_t *search_note_identifiers;
+
+	/* The number of note identifiers of the last search
+	 */
+	int number_of_search_note_identifiers;
+};
+
+int libnsfdb_text_index_term_initialize(
+     libnsfdb_text_index_term_t **text_index_term,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t hash,
+     libcerror_error_t **error );
+
+int libnsfdb_text_index_term_free(
+     libnsfdb_text_index_term_t **text_index_term,
+     libcerror_error_t **error );
+
+int libnsfdb_text_index_term_append_note_identifier(
+     libnsfdb_text_index_term_t *text_index_term,
+     uint32_t note_identifier,
+     libcerror_error_t **error );
+
+void libnsfdb_text_index_term_sift_down_note_identifier(
+      uint32_t *note_identifiers,
+      int parent_index,
+      int number_of_note_identifiers );
+
+void libnsfdb_text_index_term_sort_note_identifiers(
+      libnsfdb_text_index_term_t *text_index_term );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_text_index_initialize(
+     libnsfdb_text_index_t **text_index,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_text_index_free(
+     libnsfdb_text_index_t **text_index,
+     libcerror_error_t **error );
+
+uint32_t libnsfdb_text_index_get_hash(
+          const uint8_t *data,
+          size_t data_size );
+
+int libnsfdb_text_index_get_next_term(
+     const uint8_t *text,
+     size_t text_size,
+     size_t *text_offset,
+     uint8_t *term_data,
+     size_t term_data_size,
+     size_t *term_size,
+     libcerror_error_t **error );
+
+int libnsfdb_text_index_get_term(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t hash,
+     libnsfdb_text_index_term_t **text_index_term,
+     libcerror_error_t **error );
+
+int libnsfdb_text_index_append_term(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     const uint8_t *data,
+     size_t data_size,
+     libnsfdb_text_index_term_t **text_index_term,
+     libcerror_error_t **error );
+
+int libnsfdb_text_index_read_text(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     const uint8_t *text,
+     size_t text_size,
+     uint32_t note_identifier,
+     libcerror_error_t **error );
+
+int libnsfdb_text_index_read_note_data(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     const uint8_t *note_data,
+     size_t note_data_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_text_index_merge(
+     libnsfdb_text_index_t *text_index,
+     libnsfdb_text_index_t *source_text_index,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_text_index_get_number_of_terms(
+     libnsfdb_text_index_t *text_index,
+     int *number_of_terms,
+     libcerror_error_t **error );
+
+size_t libnsfdb_text_index_get_varint_size(
+        uint32_t value );
+
+int libnsfdb_text_index_copy_varint_to_data(
+     uint32_t value,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int libnsfdb_text_index_copy_varint_from_data(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint32_t *value,
+     libcerror_error_t **error );
+
+int libnsfdb_text_index_compare_terms(
+     libnsfdb_text_index_term_t *first_text_index_term,
+     libnsfdb_text_index_term_t *second_text_index_term );
+
+void libnsfdb_text_index_sift_down_term(
+      libnsfdb_text_index_term_t **terms,
+      int parent_index,
+      int number_of_terms );
+
+void libnsfdb_text_index_sort_terms(
+      libnsfdb_text_index_term_t **terms,
+      int number_of_terms );
+
+int libnsfdb_text_index_write_data(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libnsfdb_text_index_read_data(
+     libnsfdb_internal_text_index_t *internal_text_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_text_index_write(
+     libnsfdb_text_index_t *text_index,
+     const char *filename,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_text_index_read(
+     libnsfdb_text_index_t *text_index,
+     const char *filename,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_text_index_search(
+     libnsfdb_text_index_t *text_index,
+     const uint8_t *query,
+     size_t query_size,
+     int *number_of_note_identifiers,
+     libcerror_error_t **error );
+
+LIBNSFDB_EXTERN \
+int libnsfdb_text_index_get_search_note_identifier(
+     libnsfdb_text_index_t *text_index,
+     int note_identifier_index,
+     uint32_t *note_identifier,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBNSFDB_TEXT_INDEX_H ) */
+
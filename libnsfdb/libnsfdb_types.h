@@ -34,12 +34,22 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libnsfdb_cache_pool {}	libnsfdb_cache_pool_t;
+typedef struct libnsfdb_column_scan {}	libnsfdb_column_scan_t;
 typedef struct libnsfdb_file {}	libnsfdb_file_t;
 typedef struct libnsfdb_note {}	libnsfdb_note_t;
+typedef struct libnsfdb_note_filter {}	libnsfdb_note_filter_t;
+typedef struct libnsfdb_structure_map {}	libnsfdb_structure_map_t;
+typedef struct libnsfdb_text_index {}	libnsfdb_text_index_t;
 
 #else
+typedef intptr_t libnsfdb_cache_pool_t;
+typedef intptr_t libnsfdb_column_scan_t;
 typedef intptr_t libnsfdb_file_t;
 typedef intptr_t libnsfdb_note_t;
+typedef intptr_t libnsfdb_note_filter_t;
+typedef intptr_t libnsfdb_structure_map_t;
+typedef intptr_t libnsfdb_text_index_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -0,0 +1,175 @@
+/*
+ * The index file definition of a Notes Storage Facility (NSF) database file
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _NSFDB_INDEX_FILE_H )
+#define _NSFDB_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct nsfdb_index_file_header nsfdb_index_file_header_t;
+
+struct nsfdb_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "nsfdbidx"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The size of the database file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The superblock write count
+	 * Consists of 4 bytes
+	 */
+	uint8_t superblock_write_count[ 4 ];
+
+	/* The superblock checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t superblock_checksum[ 4 ];
+
+	/* The bucket descriptor block write count
+	 * Consists of 4 bytes
+	 */
+	uint8_t bucket_descriptor_block_write_count[ 4 ];
+
+	/* The bucket descriptor block checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t bucket_descriptor_block_checksum[ 4 ];
+
+	/* The number of summary buckets
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_summary_buckets[ 4 ];
+
+	/* The number of non-summary buckets
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_non_summary_buckets[ 4 ];
+
+	/* The number of RRV bucket descriptors
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_rrv_bucket_descriptors[ 4 ];
+
+	/* The number of unique name keys
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_unique_name_keys[ 4 ];
+
+	/* The unique name key text size
+	 * Consists of 4 bytes
+	 */
+	uint8_t unique_name_key_text_size[ 4 ];
+
+	/* The number of note entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_note_entries[ 4 ];
+
+	/* The data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+
+	/* The checksum
+	 * Consists of 4 bytes
+	 * Contains a XOR-32 of the data
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct nsfdb_index_file_note_entry nsfdb_index_file_note_entry_t;
+
+struct nsfdb_index_file_note_entry
+{
+	/* The RRV identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t rrv_identifier[ 4 ];
+
+	/* The RRV value type
+	 * Consists of 1 byte
+	 */
+	uint8_t rrv_value_type;
+
+	/* The note type
+	 * Consists of 1 byte
+	 */
+	uint8_t note_type;
+
+	/* The note class
+	 * Consists of 2 bytes
+	 */
+	uint8_t note_class[ 2 ];
+
+	/* The bucket index or file position
+	 * Consists of 4 bytes
+	 */
+	uint8_t bucket_index[ 4 ];
+
+	/* The slot index
+	 * Consists of 2 bytes
+	 */
+	uint8_t slot_index[ 2 ];
+
+	/* Padding
+	 * Consists of 2 bytes
+	 */
+	uint8_t padding1[ 2 ];
+
+	/* The non-summary value
+	 * Consists of 4 bytes
+	 */
+	uint8_t non_summary[ 4 ];
+
+	/* The (last) modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* The parent note identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t parent_note_identifier[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _NSFDB_INDEX_FILE_H ) */
+
@@ -0,0 +1,87 @@
+/*
+ * The text index file definition of a Notes Storage Facility (NSF) database file
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _NSFDB_TEXT_INDEX_H )
+#define _NSFDB_TEXT_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct nsfdb_text_index_header nsfdb_text_index_header_t;
+
+struct nsfdb_text_index_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "nsfdbtxi"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of terms
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_terms[ 4 ];
+
+	/* The number of note identifiers
+	 * Consists of 4 bytes
+	 * Contains the sum of the number of note identifiers of all the terms
+	 */
+	uint8_t number_of_note_identifiers[ 4 ];
+
+	/* The data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+
+	/* The checksum
+	 * Consists of 4 bytes
+	 * Contains a XOR-32 of the data
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+/* The header is followed by the terms, sorted by their term data
+ * Every term consists of:
+ *   the term size, stored as a variable-length integer
+ *   the term data, which contains lower case text
+ *   the number of note identifiers, stored as a variable-length integer
+ *   the note identifiers in ascending order, every note identifier is stored
+ *   as a variable-length integer of the difference with the previous note identifier
+ *
+ * A variable-length integer stores 7 bits per byte, least significant bits first,
+ * the most significant bit of a byte indicates that another byte follows
+ */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _NSFDB_TEXT_INDEX_H ) */
+
@@ -282,6 +282,7 @@ AC_DEFUN([AX_TESTS_CHECK_LOCAL],
   AC_PATH_PROG(GZIP_COMMAND, [gzip])
   AC_PATH_PROGS([MD5SUM], [md5sum md5])
   AC_PATH_PROG(ZCAT, [zcat])
+  AC_PATH_PROGS([PYTHON3], [python3])
 
   AC_SUBST(
     [TESTS_MANPAGE_LINTER],
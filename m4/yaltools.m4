@@ -84,6 +84,9 @@ AC_DEFUN([AX_NSFDBTOOLS_CHECK_LOCAL],
      [1])
   ])
 
+  dnl Headers included in nsfdbtools/batch_handle.c
+  AC_CHECK_HEADERS([dirent.h])
+
   dnl Headers included in nsfdbtools/log_handle.c
   AC_CHECK_HEADERS([stdarg.h varargs.h])
 
@@ -0,0 +1,2472 @@
+/*
+ * Apache Arrow IPC stream writer
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "arrow_writer.h"
+#include "nsfdbtools_libcerror.h"
+#include "output_writer.h"
+
+/* The Arrow metadata version V5
+ */
+#define ARROW_WRITER_METADATA_VERSION			4
+
+/* The Arrow type union identifiers
+ */
+#define ARROW_WRITER_TYPE_INT				2
+#define ARROW_WRITER_TYPE_UTF8				5
+#define ARROW_WRITER_TYPE_BOOL				6
+
+/* The maximum number of rows in a record batch
+ */
+#define ARROW_WRITER_MAXIMUM_NUMBER_OF_ROWS		( 1024 * 1024 )
+
+/* The string data size of a column at which the record batch is written
+ * This bounds the memory used by a record batch and keeps the 32-bit string offsets in range
+ */
+#define ARROW_WRITER_MAXIMUM_BATCH_DATA_SIZE		( 64 * 1024 * 1024 )
+
+/* The initial allocated string data size of a column
+ */
+#define ARROW_WRITER_INITIAL_DATA_SIZE			( 64 * 1024 )
+
+/* Determines the size of a buffer padded to a multitude of 8 bytes
+ */
+#define arrow_writer_padded_size( size ) \
+	( ( ( size ) + 7 ) & ~( (size_t) 7 ) )
+
+static const char *arrow_writer_hexadecimal_digits = "0123456789abcdef";
+
+/* Creates an Arrow writer
+ * The output writer is not managed by the Arrow writer
+ * Make sure the value arrow_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_initialize(
+     arrow_writer_t **arrow_writer,
+     output_writer_t *output_writer,
+     int maximum_number_of_rows,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_initialize";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arrow_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Arrow writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_rows <= 0 )
+	 || ( maximum_number_of_rows > ARROW_WRITER_MAXIMUM_NUMBER_OF_ROWS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of rows value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arrow_writer = memory_allocate_structure(
+	                 arrow_writer_t );
+
+	if( *arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Arrow writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arrow_writer,
+	     0,
+	     sizeof( arrow_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Arrow writer.",
+		 function );
+
+		goto on_error;
+	}
+	( *arrow_writer )->output_writer          = output_writer;
+	( *arrow_writer )->maximum_number_of_rows = maximum_number_of_rows;
+
+	return( 1 );
+
+on_error:
+	if( *arrow_writer != NULL )
+	{
+		memory_free(
+		 *arrow_writer );
+
+		*arrow_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an Arrow writer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_free(
+     arrow_writer_t **arrow_writer,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_free";
+	int column_index              = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arrow_writer != NULL )
+	{
+		if( ( *arrow_writer )->columns != NULL )
+		{
+			for( column_index = 0;
+			     column_index < ( *arrow_writer )->number_of_columns;
+			     column_index++ )
+			{
+				column = &( ( ( *arrow_writer )->columns )[ column_index ] );
+
+				if( column->name != NULL )
+				{
+					memory_free(
+					 column->name );
+				}
+				if( column->validity != NULL )
+				{
+					memory_free(
+					 column->validity );
+				}
+				if( column->values != NULL )
+				{
+					memory_free(
+					 column->values );
+				}
+				if( column->data != NULL )
+				{
+					memory_free(
+					 column->data );
+				}
+			}
+			memory_free(
+			 ( *arrow_writer )->columns );
+		}
+		if( ( *arrow_writer )->metadata != NULL )
+		{
+			memory_free(
+			 ( *arrow_writer )->metadata );
+		}
+		memory_free(
+		 *arrow_writer );
+
+		*arrow_writer = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a column
+ * The columns must be appended before the schema is written
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_column(
+     arrow_writer_t *arrow_writer,
+     const char *name,
+     size_t name_length,
+     int column_type,
+     uint8_t nullable,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column  = NULL;
+	arrow_writer_column_t *columns = NULL;
+	static char *function          = "arrow_writer_append_column";
+	size_t values_size             = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->schema_written != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Arrow writer - schema already written.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->number_of_columns >= (int) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Arrow writer - number of columns value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( column_type )
+	{
+		case ARROW_WRITER_COLUMN_TYPE_BOOLEAN:
+			values_size = ( (size_t) arrow_writer->maximum_number_of_rows + 7 ) / 8;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_UINT16:
+			values_size = (size_t) arrow_writer->maximum_number_of_rows * 2;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_UINT32:
+			values_size = (size_t) arrow_writer->maximum_number_of_rows * 4;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_UINT64:
+			values_size = (size_t) arrow_writer->maximum_number_of_rows * 8;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_UTF8:
+			values_size = ( (size_t) arrow_writer->maximum_number_of_rows + 1 ) * 4;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type.",
+			 function );
+
+			return( -1 );
+	}
+	columns = (arrow_writer_column_t *) memory_reallocate(
+	                                     arrow_writer->columns,
+	                                     sizeof( arrow_writer_column_t ) * ( arrow_writer->number_of_columns + 1 ) );
+
+	if( columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize columns.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer->columns = columns;
+
+	column = &( columns[ arrow_writer->number_of_columns ] );
+
+	if( memory_set(
+	     column,
+	     0,
+	     sizeof( arrow_writer_column_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear column.",
+		 function );
+
+		return( -1 );
+	}
+	/* The column is counted before its buffers are allocated so that
+	 * they are freed by arrow_writer_free on error
+	 */
+	arrow_writer->number_of_columns += 1;
+
+	column->name = (char *) memory_allocate(
+	                         sizeof( char ) * ( name_length + 1 ) );
+
+	if( column->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     column->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	column->name[ name_length ] = 0;
+
+	column->name_length = name_length;
+	column->type        = column_type;
+	column->nullable    = nullable;
+
+	column->validity = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * ( ( (size_t) arrow_writer->maximum_number_of_rows + 7 ) / 8 ) );
+
+	if( column->validity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create validity bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     column->validity,
+	     0,
+	     sizeof( uint8_t ) * ( ( (size_t) arrow_writer->maximum_number_of_rows + 7 ) / 8 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear validity bitmap.",
+		 function );
+
+		return( -1 );
+	}
+	column->values = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * values_size );
+
+	if( column->values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     column->values,
+	     0,
+	     sizeof( uint8_t ) * values_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Pads the message metadata to a specific alignment
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_align(
+     arrow_writer_t *arrow_writer,
+     size_t alignment,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_align";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( arrow_writer->metadata_offset % alignment ) != 0 )
+	{
+		if( arrow_writer->metadata_offset >= arrow_writer->metadata_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid metadata offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		arrow_writer->metadata[ arrow_writer->metadata_offset++ ] = 0;
+	}
+	return( 1 );
+}
+
+/* Writes a FlatBuffers table and its vtable to the message metadata
+ * A field size of 0 represents an absent field. The fields are stored
+ * from large to small so that they are naturally aligned
+ * The offsets of the fields in the message metadata are returned in field_offsets
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_write_table(
+     arrow_writer_t *arrow_writer,
+     const uint8_t *field_sizes,
+     int number_of_fields,
+     size_t *table_offset,
+     size_t *field_offsets,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_write_table";
+	size_t field_offset   = 0;
+	size_t table_size     = 0;
+	size_t vtable_offset  = 0;
+	size_t vtable_size    = 0;
+	uint8_t field_size    = 0;
+	int field_index       = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_fields < 0 )
+	 || ( number_of_fields > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of fields value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_fields > 0 )
+	 && ( ( field_sizes == NULL )
+	  ||  ( field_offsets == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field sizes or offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_align(
+	     arrow_writer,
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to align vtable.",
+		 function );
+
+		return( -1 );
+	}
+	vtable_offset = arrow_writer->metadata_offset;
+	vtable_size   = 4 + ( (size_t) number_of_fields * 2 );
+	table_size    = 4;
+
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		table_size += field_sizes[ field_index ];
+	}
+	/* The table starts 4 bytes before an 8 byte boundary so that the fields
+	 * that follow the 32-bit vtable offset are 8 byte aligned
+	 */
+	*table_offset = vtable_offset + vtable_size;
+
+	while( ( *table_offset % 8 ) != 4 )
+	{
+		*table_offset += 2;
+	}
+	if( ( *table_offset + table_size ) > arrow_writer->metadata_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( arrow_writer->metadata[ vtable_offset ] ),
+	     0,
+	     ( *table_offset + table_size ) - vtable_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear table.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( arrow_writer->metadata[ vtable_offset ] ),
+	 (uint16_t) vtable_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( arrow_writer->metadata[ vtable_offset + 2 ] ),
+	 (uint16_t) table_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( arrow_writer->metadata[ *table_offset ] ),
+	 (uint32_t) ( *table_offset - vtable_offset ) );
+
+	field_offset = *table_offset + 4;
+
+	for( field_size = 8;
+	     field_size > 0;
+	     field_size /= 2 )
+	{
+		for( field_index = 0;
+		     field_index < number_of_fields;
+		     field_index++ )
+		{
+			if( field_sizes[ field_index ] != field_size )
+			{
+				continue;
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 &( arrow_writer->metadata[ vtable_offset + 4 + ( (size_t) field_index * 2 ) ] ),
+			 (uint16_t) ( field_offset - *table_offset ) );
+
+			field_offsets[ field_index ] = field_offset;
+			field_offset                += field_size;
+		}
+	}
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		if( field_sizes[ field_index ] == 0 )
+		{
+			field_offsets[ field_index ] = 0;
+		}
+	}
+	arrow_writer->metadata_offset = *table_offset + table_size;
+
+	return( 1 );
+}
+
+/* Writes a FlatBuffers vector to the message metadata
+ * The elements are cleared and aligned to their size, up to 8 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_write_vector(
+     arrow_writer_t *arrow_writer,
+     size_t element_size,
+     int number_of_elements,
+     size_t *vector_offset,
+     size_t *elements_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_write_vector";
+	size_t alignment      = 0;
+	size_t elements_size  = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element_size != 4 )
+	 && ( element_size != 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported element size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_elements < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of elements value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( vector_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid vector offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( elements_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elements offset.",
+		 function );
+
+		return( -1 );
+	}
+	alignment = ( element_size >= 8 ) ? 8 : element_size;
+
+	if( arrow_writer_metadata_align(
+	     arrow_writer,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to align vector.",
+		 function );
+
+		return( -1 );
+	}
+	/* The elements directly follow the 32-bit number of elements
+	 */
+	if( ( ( arrow_writer->metadata_offset + 4 ) % alignment ) != 0 )
+	{
+		if( ( arrow_writer->metadata_offset + 4 ) > arrow_writer->metadata_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid metadata offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( arrow_writer->metadata[ arrow_writer->metadata_offset ] ),
+		 0 );
+
+		arrow_writer->metadata_offset += 4;
+	}
+	elements_size = element_size * (size_t) number_of_elements;
+
+	if( ( elements_size > arrow_writer->metadata_size )
+	 || ( ( arrow_writer->metadata_offset + 4 ) > ( arrow_writer->metadata_size - elements_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid vector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*vector_offset   = arrow_writer->metadata_offset;
+	*elements_offset = arrow_writer->metadata_offset + 4;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( arrow_writer->metadata[ *vector_offset ] ),
+	 (uint32_t) number_of_elements );
+
+	if( elements_size > 0 )
+	{
+		if( memory_set(
+		     &( arrow_writer->metadata[ *elements_offset ] ),
+		     0,
+		     elements_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear elements.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	arrow_writer->metadata_offset = *elements_offset + elements_size;
+
+	return( 1 );
+}
+
+/* Writes a FlatBuffers string to the message metadata
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_write_string(
+     arrow_writer_t *arrow_writer,
+     const char *string,
+     size_t string_length,
+     size_t *string_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_write_string";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_align(
+	     arrow_writer,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to align string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length > arrow_writer->metadata_size )
+	 || ( ( arrow_writer->metadata_offset + 5 ) > ( arrow_writer->metadata_size - string_length ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*string_offset = arrow_writer->metadata_offset;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( arrow_writer->metadata[ *string_offset ] ),
+	 (uint32_t) string_length );
+
+	if( memory_copy(
+	     &( arrow_writer->metadata[ *string_offset + 4 ] ),
+	     string,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer->metadata[ *string_offset + 4 + string_length ] = 0;
+
+	arrow_writer->metadata_offset = *string_offset + 5 + string_length;
+
+	return( 1 );
+}
+
+/* Sets a FlatBuffers offset field to refer to an object that was written after it
+ */
+void arrow_writer_metadata_set_offset(
+      arrow_writer_t *arrow_writer,
+      size_t field_offset,
+      size_t target_offset )
+{
+	byte_stream_copy_from_uint32_little_endian(
+	 &( arrow_writer->metadata[ field_offset ] ),
+	 (uint32_t) ( target_offset - field_offset ) );
+}
+
+/* Starts the message metadata with the root offset and the Message table
+ * The offset of the header field is returned so that it can be set once the header is written
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_start_message(
+     arrow_writer_t *arrow_writer,
+     uint8_t header_type,
+     uint64_t body_length,
+     size_t *header_field_offset,
+     libcerror_error_t **error )
+{
+	/* version, header_type, header, bodyLength
+	 */
+	const uint8_t field_sizes[ 4 ] = { 2, 1, 4, 8 };
+
+	size_t field_offsets[ 4 ];
+
+	static char *function = "arrow_writer_metadata_start_message";
+	size_t table_offset   = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Arrow writer - missing metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_field_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header field offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The root offset is stored at the start of the metadata
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 arrow_writer->metadata,
+	 0 );
+
+	arrow_writer->metadata_offset = 4;
+
+	if( arrow_writer_metadata_write_table(
+	     arrow_writer,
+	     field_sizes,
+	     4,
+	     &table_offset,
+	     field_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write Message table.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer_metadata_set_offset(
+	 arrow_writer,
+	 0,
+	 table_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( arrow_writer->metadata[ field_offsets[ 0 ] ] ),
+	 ARROW_WRITER_METADATA_VERSION );
+
+	arrow_writer->metadata[ field_offsets[ 1 ] ] = header_type;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( arrow_writer->metadata[ field_offsets[ 3 ] ] ),
+	 body_length );
+
+	*header_field_offset = field_offsets[ 2 ];
+
+	return( 1 );
+}
+
+/* Writes the encapsulated message metadata
+ * The metadata is preceded by the continuation marker and its size
+ * and padded to a multitude of 8 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_message_metadata(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	uint8_t message_prefix[ 8 ];
+
+	static char *function = "arrow_writer_write_message_metadata";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_align(
+	     arrow_writer,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to pad metadata.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 message_prefix,
+	 0xffffffffUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( message_prefix[ 4 ] ),
+	 (uint32_t) arrow_writer->metadata_offset );
+
+	if( output_writer_write_buffer(
+	     arrow_writer->output_writer,
+	     message_prefix,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_buffer(
+	     arrow_writer->output_writer,
+	     arrow_writer->metadata,
+	     arrow_writer->metadata_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message metadata.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes padding
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_padding(
+     arrow_writer_t *arrow_writer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t padding[ 8 ] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	static char *function = "arrow_writer_write_padding";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( output_writer_write_buffer(
+	     arrow_writer->output_writer,
+	     padding,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write padding.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Allocates the message metadata
+ * The metadata buffer is allocated once and sized for both the schema
+ * and the record batch messages
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_allocate_metadata(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_allocate_metadata";
+	size_t metadata_size  = 0;
+	int column_index      = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->metadata != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Arrow writer - metadata value already set.",
+		 function );
+
+		return( -1 );
+	}
+	metadata_size = 512 + ( (size_t) arrow_writer->number_of_columns * 64 );
+
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		metadata_size += 128 + arrow_writer->columns[ column_index ].name_length;
+	}
+	arrow_writer->metadata = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * metadata_size );
+
+	if( arrow_writer->metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer->metadata_size = metadata_size;
+
+	return( 1 );
+}
+
+/* Writes the schema message
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_schema(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	/* endianness (default little-endian), fields
+	 */
+	const uint8_t schema_field_sizes[ 2 ] = { 0, 4 };
+
+	/* name, nullable, type_type, type, dictionary, children
+	 */
+	const uint8_t field_field_sizes[ 6 ] = { 4, 1, 1, 4, 0, 4 };
+
+	/* bitWidth, is_signed
+	 */
+	const uint8_t int_field_sizes[ 2 ] = { 4, 1 };
+
+	size_t field_offsets[ 6 ];
+
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_write_schema";
+	size_t elements_offset        = 0;
+	size_t header_field_offset    = 0;
+	size_t offset                 = 0;
+	size_t table_offset           = 0;
+	size_t vector_offset          = 0;
+	uint8_t type_type             = 0;
+	uint8_t bit_width             = 0;
+	int column_index              = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->schema_written != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Arrow writer - schema already written.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_allocate_metadata(
+	     arrow_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_start_message(
+	     arrow_writer,
+	     ARROW_WRITER_MESSAGE_HEADER_TYPE_SCHEMA,
+	     0,
+	     &header_field_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_metadata_write_table(
+	     arrow_writer,
+	     schema_field_sizes,
+	     2,
+	     &table_offset,
+	     field_offsets,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 arrow_writer,
+	 header_field_offset,
+	 table_offset );
+
+	offset = field_offsets[ 1 ];
+
+	if( arrow_writer_metadata_write_vector(
+	     arrow_writer,
+	     4,
+	     arrow_writer->number_of_columns,
+	     &vector_offset,
+	     &elements_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 arrow_writer,
+	 offset,
+	 vector_offset );
+
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( arrow_writer->columns[ column_index ] );
+
+		if( arrow_writer_metadata_write_table(
+		     arrow_writer,
+		     field_field_sizes,
+		     6,
+		     &table_offset,
+		     field_offsets,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		arrow_writer_metadata_set_offset(
+		 arrow_writer,
+		 elements_offset + ( (size_t) column_index * 4 ),
+		 table_offset );
+
+		switch( column->type )
+		{
+			case ARROW_WRITER_COLUMN_TYPE_BOOLEAN:
+				type_type = ARROW_WRITER_TYPE_BOOL;
+				break;
+
+			case ARROW_WRITER_COLUMN_TYPE_UINT16:
+				type_type = ARROW_WRITER_TYPE_INT;
+				bit_width = 16;
+				break;
+
+			case ARROW_WRITER_COLUMN_TYPE_UINT32:
+				type_type = ARROW_WRITER_TYPE_INT;
+				bit_width = 32;
+				break;
+
+			case ARROW_WRITER_COLUMN_TYPE_UINT64:
+				type_type = ARROW_WRITER_TYPE_INT;
+				bit_width = 64;
+				break;
+
+			case ARROW_WRITER_COLUMN_TYPE_UTF8:
+				type_type = ARROW_WRITER_TYPE_UTF8;
+				break;
+		}
+		arrow_writer->metadata[ field_offsets[ 1 ] ] = column->nullable;
+		arrow_writer->metadata[ field_offsets[ 2 ] ] = type_type;
+
+		/* The offsets of the name, type and children fields are kept
+		 * since field_offsets is reused for the nested tables
+		 */
+		offset = field_offsets[ 0 ];
+
+		if( arrow_writer_metadata_write_string(
+		     arrow_writer,
+		     column->name,
+		     column->name_length,
+		     &vector_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		arrow_writer_metadata_set_offset(
+		 arrow_writer,
+		 offset,
+		 vector_offset );
+
+		offset        = field_offsets[ 3 ];
+		vector_offset = field_offsets[ 5 ];
+
+		if( type_type == ARROW_WRITER_TYPE_INT )
+		{
+			if( arrow_writer_metadata_write_table(
+			     arrow_writer,
+			     int_field_sizes,
+			     2,
+			     &table_offset,
+			     field_offsets,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 &( arrow_writer->metadata[ field_offsets[ 0 ] ] ),
+			 (uint32_t) bit_width );
+
+			arrow_writer->metadata[ field_offsets[ 1 ] ] = 0;
+		}
+		else
+		{
+			if( arrow_writer_metadata_write_table(
+			     arrow_writer,
+			     NULL,
+			     0,
+			     &table_offset,
+			     NULL,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		arrow_writer_metadata_set_offset(
+		 arrow_writer,
+		 offset,
+		 table_offset );
+
+		/* Readers require the children vector to be present
+		 */
+		offset = vector_offset;
+
+		if( arrow_writer_metadata_write_vector(
+		     arrow_writer,
+		     4,
+		     0,
+		     &vector_offset,
+		     &table_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		arrow_writer_metadata_set_offset(
+		 arrow_writer,
+		 offset,
+		 vector_offset );
+	}
+	if( arrow_writer_write_message_metadata(
+	     arrow_writer,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer->schema_written = 1;
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write schema.",
+	 function );
+
+	return( -1 );
+}
+
+/* Continues a stream of which the schema was written previously
+ * The record batches are appended to the output without writing the schema again
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_continue_stream(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_continue_stream";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->schema_written != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Arrow writer - schema already written.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_allocate_metadata(
+	     arrow_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer->schema_written = 1;
+
+	return( 1 );
+}
+
+/* Retrieves a specific column of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_get_column(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     int column_type,
+     arrow_writer_column_t **column,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_get_column";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index >= arrow_writer->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	*column = &( arrow_writer->columns[ column_index ] );
+
+	if( ( column_type != 0 )
+	 && ( ( *column )->type != column_type ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column: %d type.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the boolean value of a specific column in the current row
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_set_boolean_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     uint8_t value,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_set_boolean_value";
+	int row_index                 = 0;
+
+	if( arrow_writer_get_column(
+	     arrow_writer,
+	     column_index,
+	     ARROW_WRITER_COLUMN_TYPE_BOOLEAN,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	row_index = arrow_writer->number_of_rows;
+
+	if( value != 0 )
+	{
+		column->values[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+	}
+	else
+	{
+		column->values[ row_index / 8 ] &= (uint8_t) ~( 1 << ( row_index % 8 ) );
+	}
+	column->validity[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+	column->value_is_set = 1;
+
+	return( 1 );
+}
+
+/* Sets the integer value of a specific column in the current row
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_set_integer_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_set_integer_value";
+	size_t row_index              = 0;
+
+	if( arrow_writer_get_column(
+	     arrow_writer,
+	     column_index,
+	     0,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	row_index = (size_t) arrow_writer->number_of_rows;
+
+	switch( column->type )
+	{
+		case ARROW_WRITER_COLUMN_TYPE_UINT16:
+			if( value > (uint64_t) UINT16_MAX )
+			{
+				goto on_out_of_bounds;
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 &( column->values[ row_index * 2 ] ),
+			 (uint16_t) value );
+
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_UINT32:
+			if( value > (uint64_t) UINT32_MAX )
+			{
+				goto on_out_of_bounds;
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 &( column->values[ row_index * 4 ] ),
+			 (uint32_t) value );
+
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_UINT64:
+			byte_stream_copy_from_uint64_little_endian(
+			 &( column->values[ row_index * 8 ] ),
+			 value );
+
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column: %d type.",
+			 function,
+			 column_index );
+
+			return( -1 );
+	}
+	column->validity[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+	column->value_is_set = 1;
+
+	return( 1 );
+
+on_out_of_bounds:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid value out of bounds.",
+	 function );
+
+	return( -1 );
+}
+
+/* Reserves space for additional string data of a column
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_column_reserve_data(
+     arrow_writer_column_t *column,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *data              = NULL;
+	static char *function      = "arrow_writer_column_reserve_data";
+	size_t allocated_data_size = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	/* The string offsets are 32-bit signed integers
+	 */
+	if( size > ( (size_t) INT32_MAX - column->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column->data_size + size ) <= column->allocated_data_size )
+	{
+		return( 1 );
+	}
+	allocated_data_size = column->allocated_data_size * 2;
+
+	if( allocated_data_size < ARROW_WRITER_INITIAL_DATA_SIZE )
+	{
+		allocated_data_size = ARROW_WRITER_INITIAL_DATA_SIZE;
+	}
+	if( allocated_data_size < ( column->data_size + size ) )
+	{
+		allocated_data_size = column->data_size + size;
+	}
+	data = (uint8_t *) memory_reallocate(
+	                    column->data,
+	                    sizeof( uint8_t ) * allocated_data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	column->data                = data;
+	column->allocated_data_size = allocated_data_size;
+
+	return( 1 );
+}
+
+/* Appends a string to the value of a specific column in the current row
+ * The string can be appended in multiple parts. Bytes of 0x80 and higher
+ * are considered ISO 8859-1 characters and are converted to UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_string_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     const uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	uint8_t *data                 = NULL;
+	static char *function         = "arrow_writer_append_string_value";
+	size_t row_index              = 0;
+	size_t string_index           = 0;
+	uint8_t byte_value            = 0;
+
+	if( arrow_writer_get_column(
+	     arrow_writer,
+	     column_index,
+	     ARROW_WRITER_COLUMN_TYPE_UTF8,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) ( INT32_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every byte is stored as at most 2 bytes of UTF-8
+	 */
+	if( arrow_writer_column_reserve_data(
+	     column,
+	     string_size * 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve data.",
+		 function );
+
+		return( -1 );
+	}
+	data = &( column->data[ column->data_size ] );
+
+	for( string_index = 0;
+	     string_index < string_size;
+	     string_index++ )
+	{
+		byte_value = string[ string_index ];
+
+		if( byte_value < 0x80 )
+		{
+			*data++ = byte_value;
+		}
+		else
+		{
+			*data++ = (uint8_t) ( 0xc0 | ( byte_value >> 6 ) );
+			*data++ = (uint8_t) ( 0x80 | ( byte_value & 0x3f ) );
+		}
+	}
+	column->data_size = (size_t) ( data - column->data );
+
+	row_index = (size_t) arrow_writer->number_of_rows;
+
+	column->validity[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+	column->value_is_set = 1;
+
+	return( 1 );
+}
+
+/* Appends data as a string of hexadecimal digits to the value of a specific column in the current row
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_hexadecimal_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_hexadecimal_value";
+	size_t data_offset            = 0;
+	size_t row_index              = 0;
+
+	if( arrow_writer_get_column(
+	     arrow_writer,
+	     column_index,
+	     ARROW_WRITER_COLUMN_TYPE_UTF8,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) ( INT32_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_column_reserve_data(
+	     column,
+	     data_size * 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve data.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		column->data[ column->data_size++ ] = (uint8_t) arrow_writer_hexadecimal_digits[ data[ data_offset ] >> 4 ];
+		column->data[ column->data_size++ ] = (uint8_t) arrow_writer_hexadecimal_digits[ data[ data_offset ] & 0x0f ];
+	}
+	row_index = (size_t) arrow_writer->number_of_rows;
+
+	column->validity[ row_index / 8 ] |= (uint8_t) ( 1 << ( row_index % 8 ) );
+
+	column->value_is_set = 1;
+
+	return( 1 );
+}
+
+/* Appends the current row to the record batch
+ * The columns of which no value was set contain a null value
+ * The record batch is written when it is full
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_row(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_row";
+	size_t row_index              = 0;
+	uint8_t write_record_batch    = 0;
+	int column_index              = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	row_index = (size_t) arrow_writer->number_of_rows;
+
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( arrow_writer->columns[ column_index ] );
+
+		if( column->value_is_set == 0 )
+		{
+			if( column->nullable == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing value of column: %d.",
+				 function,
+				 column_index );
+
+				return( -1 );
+			}
+			column->number_of_nulls += 1;
+		}
+		if( column->type == ARROW_WRITER_COLUMN_TYPE_UTF8 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( column->values[ ( row_index + 1 ) * 4 ] ),
+			 (uint32_t) column->data_size );
+
+			if( column->data_size >= ARROW_WRITER_MAXIMUM_BATCH_DATA_SIZE )
+			{
+				write_record_batch = 1;
+			}
+		}
+		column->value_is_set = 0;
+	}
+	arrow_writer->number_of_rows += 1;
+
+	if( arrow_writer->number_of_rows >= arrow_writer->maximum_number_of_rows )
+	{
+		write_record_batch = 1;
+	}
+	if( write_record_batch != 0 )
+	{
+		if( arrow_writer_write_record_batch(
+		     arrow_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record batch.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the sizes of the buffers of a column in the current record batch
+ * The validity bitmap is omitted when the column contains no null values
+ */
+void arrow_writer_get_column_buffer_sizes(
+      arrow_writer_t *arrow_writer,
+      arrow_writer_column_t *column,
+      size_t *buffer_sizes,
+      int *number_of_buffers )
+{
+	size_t number_of_rows = (size_t) arrow_writer->number_of_rows;
+
+	buffer_sizes[ 0 ] = 0;
+	buffer_sizes[ 2 ] = 0;
+
+	if( column->number_of_nulls > 0 )
+	{
+		buffer_sizes[ 0 ] = ( number_of_rows + 7 ) / 8;
+	}
+	*number_of_buffers = 2;
+
+	switch( column->type )
+	{
+		case ARROW_WRITER_COLUMN_TYPE_BOOLEAN:
+			buffer_sizes[ 1 ] = ( number_of_rows + 7 ) / 8;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_UINT16:
+			buffer_sizes[ 1 ] = number_of_rows * 2;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_UINT32:
+			buffer_sizes[ 1 ] = number_of_rows * 4;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_UINT64:
+			buffer_sizes[ 1 ] = number_of_rows * 8;
+			break;
+
+		case ARROW_WRITER_COLUMN_TYPE_UTF8:
+			buffer_sizes[ 1 ] = ( number_of_rows + 1 ) * 4;
+			buffer_sizes[ 2 ] = column->data_size;
+
+			*number_of_buffers = 3;
+
+			break;
+	}
+}
+
+/* Writes the rows that were appended as a record batch message
+ * The columns are reset afterwards so that their buffers are reused by the next record batch
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_record_batch(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	/* length, nodes, buffers
+	 */
+	const uint8_t record_batch_field_sizes[ 3 ] = { 8, 4, 4 };
+
+	size_t field_offsets[ 3 ];
+
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_write_record_batch";
+	size_t body_offset            = 0;
+	size_t buffer_sizes[ 3 ]      = { 0, 0, 0 };
+	size_t elements_offset        = 0;
+	size_t header_field_offset    = 0;
+	size_t table_offset           = 0;
+	size_t validity_size          = 0;
+	size_t vector_offset          = 0;
+	uint64_t body_length          = 0;
+	int buffer_index              = 0;
+	int column_index              = 0;
+	int number_of_buffers         = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->schema_written == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Arrow writer - schema not written.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->number_of_rows == 0 )
+	{
+		return( 1 );
+	}
+	validity_size = ( (size_t) arrow_writer->number_of_rows + 7 ) / 8;
+
+	/* Determine the sizes of the buffers of every column to determine the body length
+	 */
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( arrow_writer->columns[ column_index ] );
+
+		arrow_writer_get_column_buffer_sizes(
+		 arrow_writer,
+		 column,
+		 buffer_sizes,
+		 &number_of_buffers );
+
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			body_length += arrow_writer_padded_size( buffer_sizes[ buffer_index ] );
+		}
+	}
+	if( arrow_writer_metadata_start_message(
+	     arrow_writer,
+	     ARROW_WRITER_MESSAGE_HEADER_TYPE_RECORD_BATCH,
+	     body_length,
+	     &header_field_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_metadata_write_table(
+	     arrow_writer,
+	     record_batch_field_sizes,
+	     3,
+	     &table_offset,
+	     field_offsets,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 arrow_writer,
+	 header_field_offset,
+	 table_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( arrow_writer->metadata[ field_offsets[ 0 ] ] ),
+	 (uint64_t) arrow_writer->number_of_rows );
+
+	/* The field nodes contain the length and null count of every column
+	 */
+	if( arrow_writer_metadata_write_vector(
+	     arrow_writer,
+	     16,
+	     arrow_writer->number_of_columns,
+	     &vector_offset,
+	     &elements_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 arrow_writer,
+	 field_offsets[ 1 ],
+	 vector_offset );
+
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( arrow_writer->columns[ column_index ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( arrow_writer->metadata[ elements_offset ] ),
+		 (uint64_t) arrow_writer->number_of_rows );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( arrow_writer->metadata[ elements_offset + 8 ] ),
+		 (uint64_t) column->number_of_nulls );
+
+		elements_offset += 16;
+	}
+	/* The buffers contain the offset and length of every buffer in the body
+	 */
+	number_of_buffers = 0;
+
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		number_of_buffers += ( arrow_writer->columns[ column_index ].type == ARROW_WRITER_COLUMN_TYPE_UTF8 ) ? 3 : 2;
+	}
+	if( arrow_writer_metadata_write_vector(
+	     arrow_writer,
+	     16,
+	     number_of_buffers,
+	     &vector_offset,
+	     &elements_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	arrow_writer_metadata_set_offset(
+	 arrow_writer,
+	 field_offsets[ 2 ],
+	 vector_offset );
+
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( arrow_writer->columns[ column_index ] );
+
+		arrow_writer_get_column_buffer_sizes(
+		 arrow_writer,
+		 column,
+		 buffer_sizes,
+		 &number_of_buffers );
+
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( arrow_writer->metadata[ elements_offset ] ),
+			 (uint64_t) body_offset );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( arrow_writer->metadata[ elements_offset + 8 ] ),
+			 (uint64_t) buffer_sizes[ buffer_index ] );
+
+			elements_offset += 16;
+			body_offset     += arrow_writer_padded_size( buffer_sizes[ buffer_index ] );
+		}
+	}
+	if( arrow_writer_write_message_metadata(
+	     arrow_writer,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* The body is written directly from the column buffers
+	 */
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( arrow_writer->columns[ column_index ] );
+
+		arrow_writer_get_column_buffer_sizes(
+		 arrow_writer,
+		 column,
+		 buffer_sizes,
+		 &number_of_buffers );
+
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			if( buffer_sizes[ buffer_index ] == 0 )
+			{
+				continue;
+			}
+			if( output_writer_write_buffer(
+			     arrow_writer->output_writer,
+			     ( buffer_index == 0 ) ? column->validity : ( ( buffer_index == 1 ) ? column->values : column->data ),
+			     buffer_sizes[ buffer_index ],
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( arrow_writer_write_padding(
+			     arrow_writer,
+			     arrow_writer_padded_size( buffer_sizes[ buffer_index ] ) - buffer_sizes[ buffer_index ],
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( memory_set(
+		     column->validity,
+		     0,
+		     validity_size ) == NULL )
+		{
+			goto on_error;
+		}
+		if( column->type == ARROW_WRITER_COLUMN_TYPE_BOOLEAN )
+		{
+			if( memory_set(
+			     column->values,
+			     0,
+			     validity_size ) == NULL )
+			{
+				goto on_error;
+			}
+		}
+		column->number_of_nulls = 0;
+		column->data_size       = 0;
+	}
+	arrow_writer->number_of_rows            = 0;
+	arrow_writer->number_of_record_batches += 1;
+
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write record batch.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes the end of stream marker
+ * The rows that were appended but not yet written are written as a last record batch
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_end_of_stream(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	uint8_t end_of_stream[ 8 ];
+
+	static char *function = "arrow_writer_write_end_of_stream";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_write_record_batch(
+	     arrow_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record batch.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 end_of_stream,
+	 0xffffffffUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( end_of_stream[ 4 ] ),
+	 0 );
+
+	if( output_writer_write_buffer(
+	     arrow_writer->output_writer,
+	     end_of_stream,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of stream marker.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,284 @@
+/*
+ * Apache Arrow IPC stream writer
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ARROW_WRITER_H )
+#define _ARROW_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "nsfdbtools_libcerror.h"
+#include "output_writer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum ARROW_WRITER_COLUMN_TYPES
+{
+	ARROW_WRITER_COLUMN_TYPE_BOOLEAN	= 1,
+	ARROW_WRITER_COLUMN_TYPE_UINT16		= 2,
+	ARROW_WRITER_COLUMN_TYPE_UINT32		= 3,
+	ARROW_WRITER_COLUMN_TYPE_UINT64		= 4,
+	ARROW_WRITER_COLUMN_TYPE_UTF8		= 5
+};
+
+enum ARROW_WRITER_MESSAGE_HEADER_TYPES
+{
+	ARROW_WRITER_MESSAGE_HEADER_TYPE_SCHEMA		= 1,
+	ARROW_WRITER_MESSAGE_HEADER_TYPE_RECORD_BATCH	= 3
+};
+
+typedef struct arrow_writer_column arrow_writer_column_t;
+
+struct arrow_writer_column
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The column type
+	 */
+	int type;
+
+	/* Value to indicate the column can contain null values
+	 */
+	uint8_t nullable;
+
+	/* Value to indicate the value of the current row was set
+	 */
+	uint8_t value_is_set;
+
+	/* The validity bitmap
+	 */
+	uint8_t *validity;
+
+	/* The number of null values in the batch
+	 */
+	int number_of_nulls;
+
+	/* The fixed-size values or the 32-bit string offsets
+	 */
+	uint8_t *values;
+
+	/* The string data
+	 */
+	uint8_t *data;
+
+	/* The string data size
+	 */
+	size_t data_size;
+
+	/* The allocated string data size
+	 */
+	size_t allocated_data_size;
+};
+
+typedef struct arrow_writer arrow_writer_t;
+
+struct arrow_writer
+{
+	/* The output writer
+	 */
+	output_writer_t *output_writer;
+
+	/* The columns
+	 */
+	arrow_writer_column_t *columns;
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* Value to indicate the schema was written
+	 */
+	uint8_t schema_written;
+
+	/* The maximum number of rows in a record batch
+	 */
+	int maximum_number_of_rows;
+
+	/* The number of rows in the current record batch
+	 */
+	int number_of_rows;
+
+	/* The number of record batches written
+	 */
+	int number_of_record_batches;
+
+	/* The message metadata
+	 */
+	uint8_t *metadata;
+
+	/* The message metadata size
+	 */
+	size_t metadata_size;
+
+	/* The offset in the message metadata
+	 */
+	size_t metadata_offset;
+};
+
+int arrow_writer_initialize(
+     arrow_writer_t **arrow_writer,
+     output_writer_t *output_writer,
+     int maximum_number_of_rows,
+     libcerror_error_t **error );
+
+int arrow_writer_free(
+     arrow_writer_t **arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_append_column(
+     arrow_writer_t *arrow_writer,
+     const char *name,
+     size_t name_length,
+     int column_type,
+     uint8_t nullable,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_align(
+     arrow_writer_t *arrow_writer,
+     size_t alignment,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_write_table(
+     arrow_writer_t *arrow_writer,
+     const uint8_t *field_sizes,
+     int number_of_fields,
+     size_t *table_offset,
+     size_t *field_offsets,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_write_vector(
+     arrow_writer_t *arrow_writer,
+     size_t element_size,
+     int number_of_elements,
+     size_t *vector_offset,
+     size_t *elements_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_write_string(
+     arrow_writer_t *arrow_writer,
+     const char *string,
+     size_t string_length,
+     size_t *string_offset,
+     libcerror_error_t **error );
+
+void arrow_writer_metadata_set_offset(
+      arrow_writer_t *arrow_writer,
+      size_t field_offset,
+      size_t target_offset );
+
+int arrow_writer_metadata_start_message(
+     arrow_writer_t *arrow_writer,
+     uint8_t header_type,
+     uint64_t body_length,
+     size_t *header_field_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_write_message_metadata(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_write_padding(
+     arrow_writer_t *arrow_writer,
+     size_t size,
+     libcerror_error_t **error );
+
+int arrow_writer_allocate_metadata(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_write_schema(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_continue_stream(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_get_column(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     int column_type,
+     arrow_writer_column_t **column,
+     libcerror_error_t **error );
+
+int arrow_writer_set_boolean_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     uint8_t value,
+     libcerror_error_t **error );
+
+int arrow_writer_set_integer_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int arrow_writer_column_reserve_data(
+     arrow_writer_column_t *column,
+     size_t size,
+     libcerror_error_t **error );
+
+int arrow_writer_append_string_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     const uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int arrow_writer_append_hexadecimal_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int arrow_writer_append_row(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+void arrow_writer_get_column_buffer_sizes(
+      arrow_writer_t *arrow_writer,
+      arrow_writer_column_t *column,
+      size_t *buffer_sizes,
+      int *number_of_buffers );
+
+int arrow_writer_write_record_batch(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_write_end_of_stream(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ARROW_WRITER_H ) */
+
@@ -0,0 +1,1505 @@
+/*
+ * Batch handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_DIRENT_H ) && !defined( WINAPI )
+#include <dirent.h>
+#endif
+
+#include "batch_handle.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcfile.h"
+#include "nsfdbtools_libcnotify.h"
+#include "nsfdbtools_libcpath.h"
+#include "nsfdbtools_libcthreads.h"
+
+#define BATCH_HANDLE_NOTIFY_STREAM	stdout
+
+/* The maximum size of a line in a list file
+ */
+#define BATCH_HANDLE_MAXIMUM_LINE_SIZE	4096
+
+/* Creates a batch handle
+ * Make sure the value batch_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_initialize(
+     batch_handle_t **batch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_initialize";
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*batch_handle = memory_allocate_structure(
+	                 batch_handle_t );
+
+	if( *batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch_handle,
+	     0,
+	     sizeof( batch_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *batch_handle )->number_of_threads = 1;
+	( *batch_handle )->notify_stream     = BATCH_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *batch_handle != NULL )
+	{
+		memory_free(
+		 *batch_handle );
+
+		*batch_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a batch handle
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_free(
+     batch_handle_t **batch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_free";
+	int file_index        = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_handle != NULL )
+	{
+		if( ( *batch_handle )->files != NULL )
+		{
+			for( file_index = 0;
+			     file_index < ( *batch_handle )->number_of_files;
+			     file_index++ )
+			{
+				if( ( *batch_handle )->files[ file_index ] != NULL )
+				{
+					if( ( *batch_handle )->files[ file_index ]->filename != NULL )
+					{
+						memory_free(
+						 ( *batch_handle )->files[ file_index ]->filename );
+					}
+					memory_free(
+					 ( *batch_handle )->files[ file_index ] );
+				}
+			}
+			memory_free(
+			 ( *batch_handle )->files );
+		}
+		memory_free(
+		 *batch_handle );
+
+		*batch_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Signals the batch handle to abort
+ * The source files that are being processed are completed, the remaining source files are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_signal_abort(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_signal_abort";
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	batch_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int batch_handle_set_number_of_threads(
+     batch_handle_t *batch_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	int number_of_threads = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( number_of_threads > BATCH_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			return( 0 );
+		}
+	}
+	if( number_of_threads == 0 )
+	{
+		return( 0 );
+	}
+	batch_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Appends a source file
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_append_file(
+     batch_handle_t *batch_handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	batch_handle_file_t **reallocation = NULL;
+	batch_handle_file_t *batch_file    = NULL;
+	libcfile_file_t *file              = NULL;
+	static char *function              = "batch_handle_append_file";
+	int number_of_allocated_files      = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_handle->number_of_files >= BATCH_HANDLE_MAXIMUM_NUMBER_OF_FILES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid batch handle - number of files value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_handle->number_of_files >= batch_handle->number_of_allocated_files )
+	{
+		number_of_allocated_files = batch_handle->number_of_allocated_files * 2;
+
+		if( number_of_allocated_files == 0 )
+		{
+			number_of_allocated_files = 256;
+		}
+		else if( number_of_allocated_files > BATCH_HANDLE_MAXIMUM_NUMBER_OF_FILES )
+		{
+			number_of_allocated_files = BATCH_HANDLE_MAXIMUM_NUMBER_OF_FILES;
+		}
+		reallocation = (batch_handle_file_t **) memory_reallocate(
+		                                         batch_handle->files,
+		                                         sizeof( batch_handle_file_t * ) * number_of_allocated_files );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize files.",
+			 function );
+
+			return( -1 );
+		}
+		batch_handle->files                     = reallocation;
+		batch_handle->number_of_allocated_files = number_of_allocated_files;
+	}
+	batch_file = memory_allocate_structure(
+	              batch_handle_file_t );
+
+	if( batch_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     batch_file,
+	     0,
+	     sizeof( batch_handle_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch file.",
+		 function );
+
+		memory_free(
+		 batch_file );
+
+		batch_file = NULL;
+
+		goto on_error;
+	}
+	batch_file->filename_size = filename_length + 1;
+
+	batch_file->filename = narrow_string_allocate(
+	                        batch_file->filename_size );
+
+	if( batch_file->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     batch_file->filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	batch_file->filename[ filename_length ] = 0;
+
+	batch_file->name = narrow_string_search_character_reverse(
+	                    batch_file->filename,
+	                    (char) LIBCPATH_SEPARATOR,
+	                    batch_file->filename_size );
+
+	if( batch_file->name == NULL )
+	{
+		batch_file->name = batch_file->filename;
+	}
+	else
+	{
+		batch_file->name++;
+	}
+
+	/* The file size is used to schedule the largest files first,
+	 * a file that cannot be opened is reported when it is processed
+	 */
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_open(
+	     file,
+	     batch_file->filename,
+	     LIBCFILE_OPEN_READ,
+	     NULL ) == 1 )
+	{
+		if( libcfile_file_get_size(
+		     file,
+		     &( batch_file->file_size ),
+		     NULL ) != 1 )
+		{
+			batch_file->file_size = 0;
+		}
+		libcfile_file_close(
+		 file,
+		 NULL );
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	batch_handle->files[ batch_handle->number_of_files ] = batch_file;
+
+	batch_handle->number_of_files += 1;
+
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	if( batch_file != NULL )
+	{
+		if( batch_file->filename != NULL )
+		{
+			memory_free(
+			 batch_file->filename );
+		}
+		memory_free(
+		 batch_file );
+	}
+	return( -1 );
+}
+
+/* Reads a list file that contains a source filename per line
+ * Empty lines and lines that start with # are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_read_list_file(
+     batch_handle_t *batch_handle,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	char line[ BATCH_HANDLE_MAXIMUM_LINE_SIZE ];
+
+	FILE *list_stream     = NULL;
+	static char *function = "batch_handle_read_list_file";
+	size_t line_length    = 0;
+	int line_number       = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	list_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_OPEN_READ );
+
+	if( list_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open list file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	while( file_stream_get_string(
+	        list_stream,
+	        line,
+	        BATCH_HANDLE_MAXIMUM_LINE_SIZE ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] != '\n' )
+		 && ( file_stream_at_end(
+		       list_stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: line: %d value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == '\n' )
+		     ||  ( line[ line_length - 1 ] == '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == '#' ) )
+		{
+			continue;
+		}
+		if( batch_handle_append_file(
+		     batch_handle,
+		     line,
+		     line_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file of line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     list_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close list file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 list_stream );
+
+	return( -1 );
+}
+
+/* Appends a directory entry as a source file
+ * Only the files with the .nsf or .ntf extension are appended
+ * Returns 1 if successful, 0 if the directory entry was not appended or -1 on error
+ */
+int batch_handle_append_directory_entry(
+     batch_handle_t *batch_handle,
+     const char *path,
+     size_t path_length,
+     const char *entry_name,
+     libcerror_error_t **error )
+{
+	char *entry_path         = NULL;
+	static char *function    = "batch_handle_append_directory_entry";
+	size_t entry_name_length = 0;
+	size_t entry_path_size   = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
+		 function );
+
+		return( -1 );
+	}
+	entry_name_length = narrow_string_length(
+	                     entry_name );
+
+	if( entry_name_length <= 4 )
+	{
+		return( 0 );
+	}
+	if( ( narrow_string_compare_no_case(
+	       &( entry_name[ entry_name_length - 4 ] ),
+	       ".nsf",
+	       4 ) != 0 )
+	 && ( narrow_string_compare_no_case(
+	       &( entry_name[ entry_name_length - 4 ] ),
+	       ".ntf",
+	       4 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libcpath_path_join(
+	     &entry_path,
+	     &entry_path_size,
+	     path,
+	     path_length,
+	     entry_name,
+	     entry_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path of directory entry: %s.",
+		 function,
+		 entry_name );
+
+		return( -1 );
+	}
+	if( batch_handle_append_file(
+	     batch_handle,
+	     entry_path,
+	     entry_path_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file: %s.",
+		 function,
+		 entry_path );
+
+		memory_free(
+		 entry_path );
+
+		return( -1 );
+	}
+	memory_free(
+	 entry_path );
+
+	return( 1 );
+}
+
+/* Reads the source files in a directory
+ * Sub directories are not read
+ * Returns 1 if successful, 0 if the path is not a directory or -1 on error
+ */
+int batch_handle_read_directory(
+     batch_handle_t *batch_handle,
+     const char *path,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	WIN32_FIND_DATAA find_data;
+
+	HANDLE find_handle         = INVALID_HANDLE_VALUE;
+	char *search_pattern       = NULL;
+	size_t search_pattern_size = 0;
+	DWORD attributes           = 0;
+
+#elif defined( HAVE_DIRENT_H )
+	struct dirent *directory_entry = NULL;
+	DIR *directory                 = NULL;
+#endif
+
+	static char *function = "batch_handle_read_directory";
+	size_t path_length    = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = narrow_string_length(
+	               path );
+
+#if defined( WINAPI )
+	attributes = GetFileAttributesA(
+	              (LPCSTR) path );
+
+	if( ( attributes == INVALID_FILE_ATTRIBUTES )
+	 || ( ( attributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libcpath_path_join(
+	     &search_pattern,
+	     &search_pattern_size,
+	     path,
+	     path_length,
+	     "*",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create search pattern.",
+		 function );
+
+		return( -1 );
+	}
+	find_handle = FindFirstFileA(
+	               (LPCSTR) search_pattern,
+	               &find_data );
+
+	memory_free(
+	 search_pattern );
+
+	if( find_handle == INVALID_HANDLE_VALUE )
+	{
+		if( GetLastError() == ERROR_FILE_NOT_FOUND )
+		{
+			return( 1 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	do
+	{
+		if( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+		{
+			continue;
+		}
+		if( batch_handle_append_directory_entry(
+		     batch_handle,
+		     path,
+		     path_length,
+		     (const char *) find_data.cFileName,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory entry.",
+			 function );
+
+			FindClose(
+			 find_handle );
+
+			return( -1 );
+		}
+	}
+	while( FindNextFileA(
+	        find_handle,
+	        &find_data ) != 0 );
+
+	FindClose(
+	 find_handle );
+
+	return( 1 );
+
+#elif defined( HAVE_DIRENT_H )
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		return( 0 );
+	}
+	while( ( directory_entry = readdir(
+	                            directory ) ) != NULL )
+	{
+		if( batch_handle_append_directory_entry(
+		     batch_handle,
+		     path,
+		     path_length,
+		     directory_entry->d_name,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory entry.",
+			 function );
+
+			closedir(
+			 directory );
+
+			return( -1 );
+		}
+	}
+	closedir(
+	 directory );
+
+	return( 1 );
+
+#else
+	return( 0 );
+#endif
+}
+
+/* Reads the source files of a source, which is either a directory or a list file
+ * Source files with the same name, e.g. from different directories in a list file, are rejected
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_read_source(
+     batch_handle_t *batch_handle,
+     const char *source,
+     libcerror_error_t **error )
+{
+	static char *function = "batch_handle_read_source";
+	int result            = 0;
+
+	result = batch_handle_read_directory(
+	          batch_handle,
+	          source,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( batch_handle_read_list_file(
+		     batch_handle,
+		     source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read list file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = batch_handle_check_unique_names(
+	          batch_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if the names of the source files are unique.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: source files with the same name are not supported.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares two source files
+ * The source files are ordered by descending file size and then by filename
+ * Returns -1, 0 or 1 as used by qsort
+ */
+int batch_handle_compare_files(
+     const void *first_file,
+     const void *second_file )
+{
+	const batch_handle_file_t *first_batch_file  = NULL;
+	const batch_handle_file_t *second_batch_file = NULL;
+	size_t compare_size                          = 0;
+	int result                                   = 0;
+
+	first_batch_file  = *( (const batch_handle_file_t * const *) first_file );
+	second_batch_file = *( (const batch_handle_file_t * const *) second_file );
+
+	if( first_batch_file->file_size > second_batch_file->file_size )
+	{
+		return( -1 );
+	}
+	else if( first_batch_file->file_size < second_batch_file->file_size )
+	{
+		return( 1 );
+	}
+	compare_size = first_batch_file->filename_size;
+
+	if( compare_size > second_batch_file->filename_size )
+	{
+		compare_size = second_batch_file->filename_size;
+	}
+	result = narrow_string_compare(
+	          first_batch_file->filename,
+	          second_batch_file->filename,
+	          compare_size );
+
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Compares the names of two source files
+ * Returns -1, 0 or 1 as used by qsort
+ */
+int batch_handle_compare_names(
+     const void *first_file,
+     const void *second_file )
+{
+	const batch_handle_file_t *first_batch_file  = NULL;
+	const batch_handle_file_t *second_batch_file = NULL;
+	size_t compare_size                          = 0;
+	size_t second_name_length                    = 0;
+	int result                                   = 0;
+
+	first_batch_file  = *( (const batch_handle_file_t * const *) first_file );
+	second_batch_file = *( (const batch_handle_file_t * const *) second_file );
+
+	compare_size = narrow_string_length(
+	                first_batch_file->name );
+
+	second_name_length = narrow_string_length(
+	                      second_batch_file->name );
+
+	if( compare_size > second_name_length )
+	{
+		compare_size = second_name_length;
+	}
+	/* The end-of-string character is compared as well so that a name sorts before
+	 * a longer name it is the start of
+	 */
+	result = narrow_string_compare(
+	          first_batch_file->name,
+	          second_batch_file->name,
+	          compare_size + 1 );
+
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Checks if the names of the source files are unique
+ * The output of a source file is named after the name of the source file, hence source
+ * files with the same name in different directories would overwrite each other's output
+ * Returns 1 if the names are unique, 0 if not or -1 on error
+ */
+int batch_handle_check_unique_names(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error )
+{
+	batch_handle_file_t **sorted_files = NULL;
+	static char *function              = "batch_handle_check_unique_names";
+	int file_index                     = 0;
+	int result                         = 1;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_handle->number_of_files <= 1 )
+	{
+		return( 1 );
+	}
+	sorted_files = (batch_handle_file_t **) memory_allocate(
+	                                         sizeof( batch_handle_file_t * ) * batch_handle->number_of_files );
+
+	if( sorted_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted files.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     sorted_files,
+	     batch_handle->files,
+	     sizeof( batch_handle_file_t * ) * batch_handle->number_of_files ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy files.",
+		 function );
+
+		memory_free(
+		 sorted_files );
+
+		return( -1 );
+	}
+	qsort(
+	 sorted_files,
+	 (size_t) batch_handle->number_of_files,
+	 sizeof( batch_handle_file_t * ),
+	 &batch_handle_compare_names );
+
+	for( file_index = 1;
+	     file_index < batch_handle->number_of_files;
+	     file_index++ )
+	{
+		if( batch_handle_compare_names(
+		     &( sorted_files[ file_index - 1 ] ),
+		     &( sorted_files[ file_index ] ) ) == 0 )
+		{
+			fprintf(
+			 batch_handle->notify_stream,
+			 "Source files: %s and %s have the same name.\n",
+			 sorted_files[ file_index - 1 ]->filename,
+			 sorted_files[ file_index ]->filename );
+
+			result = 0;
+		}
+	}
+	memory_free(
+	 sorted_files );
+
+	return( result );
+}
+
+/* Processes a source file
+ * This function is used as a thread pool callback hence the result is stored in the source file
+ * The value contains the source file and the arguments the batch handle
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_process_file(
+     intptr_t *value,
+     void *arguments )
+{
+	batch_handle_file_t *batch_file = NULL;
+	batch_handle_t *batch_handle    = NULL;
+	libcerror_error_t *error        = NULL;
+	static char *function           = "batch_handle_process_file";
+
+	batch_file   = (batch_handle_file_t *) value;
+	batch_handle = (batch_handle_t *) arguments;
+
+	if( batch_file == NULL )
+	{
+		return( -1 );
+	}
+	if( batch_handle == NULL )
+	{
+		batch_file->result = -1;
+
+		return( -1 );
+	}
+	if( batch_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	fprintf(
+	 batch_handle->notify_stream,
+	 "Processing file: %s.\n",
+	 batch_file->filename );
+
+	batch_file->result = batch_handle->process_file_function(
+	                      batch_file,
+	                      batch_handle->process_file_function_arguments,
+	                      &error );
+
+	if( batch_file->result != 1 )
+	{
+		batch_file->result = -1;
+
+		fprintf(
+		 batch_handle->notify_stream,
+		 "Unable to process file: %s.\n",
+		 batch_file->filename );
+
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to process file: %s.\n",
+			 function,
+			 batch_file->filename );
+		}
+		if( error != NULL )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	else
+	{
+		fprintf(
+		 batch_handle->notify_stream,
+		 "Processed file: %s.\n",
+		 batch_file->filename );
+	}
+	return( 1 );
+}
+
+/* Processes the source files
+ * The largest source files are scheduled first on a shared queue, from which every
+ * thread takes the next source file when done, so that the threads remain balanced
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_process_files(
+     batch_handle_t *batch_handle,
+     int (*process_file_function)(
+            batch_handle_file_t *batch_file,
+            void *arguments,
+            libcerror_error_t **error ),
+     void *process_file_function_arguments,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	int maximum_number_of_values           = 0;
+#endif
+
+	static char *function                  = "batch_handle_process_files";
+	int file_index                         = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_file_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process file function.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_handle->number_of_files == 0 )
+	{
+		return( 1 );
+	}
+	batch_handle->process_file_function           = process_file_function;
+	batch_handle->process_file_function_arguments = process_file_function_arguments;
+
+	qsort(
+	 batch_handle->files,
+	 (size_t) batch_handle->number_of_files,
+	 sizeof( batch_handle_file_t * ),
+	 &batch_handle_compare_files );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch_handle->number_of_threads > 1 )
+	{
+		/* Pushing a source file blocks when the queue is full until a thread takes a source file
+		 */
+		maximum_number_of_values = batch_handle->number_of_files;
+
+		if( maximum_number_of_values > 1024 )
+		{
+			maximum_number_of_values = 1024;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     batch_handle->number_of_threads,
+		     maximum_number_of_values,
+		     &batch_handle_process_file,
+		     (void *) batch_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			return( -1 );
+		}
+		for( file_index = 0;
+		     file_index < batch_handle->number_of_files;
+		     file_index++ )
+		{
+			if( batch_handle->abort != 0 )
+			{
+				break;
+			}
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) batch_handle->files[ file_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push file: %d onto queue.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( file_index = 0;
+	     file_index < batch_handle->number_of_files;
+	     file_index++ )
+	{
+		if( batch_handle->abort != 0 )
+		{
+			break;
+		}
+		batch_handle_process_file(
+		 (intptr_t *) batch_handle->files[ file_index ],
+		 (void *) batch_handle );
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Prints a summary of the processed source files
+ * Returns 1 if successful or -1 on error
+ */
+int batch_handle_summary_fprint(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error )
+{
+	batch_handle_file_t *batch_file = NULL;
+	static char *function           = "batch_handle_summary_fprint";
+	size64_t processed_size         = 0;
+	size64_t total_size             = 0;
+	int file_index                  = 0;
+	int number_of_failed_files      = 0;
+	int number_of_processed_files   = 0;
+
+	if( batch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < batch_handle->number_of_files;
+	     file_index++ )
+	{
+		batch_file = batch_handle->files[ file_index ];
+
+		total_size += batch_file->file_size;
+
+		if( batch_file->result == 1 )
+		{
+			processed_size += batch_file->file_size;
+
+			number_of_processed_files++;
+		}
+		else if( batch_file->result == -1 )
+		{
+			number_of_failed_files++;
+		}
+	}
+	fprintf(
+	 batch_handle->notify_stream,
+	 "\nBatch summary:\n" );
+
+	fprintf(
+	 batch_handle->notify_stream,
+	 "\tNumber of threads\t\t: %d\n",
+	 batch_handle->number_of_threads );
+
+	fprintf(
+	 batch_handle->notify_stream,
+	 "\tNumber of files\t\t\t: %d\n",
+	 batch_handle->number_of_files );
+
+	fprintf(
+	 batch_handle->notify_stream,
+	 "\tNumber of processed files\t: %d\n",
+	 number_of_processed_files );
+
+	fprintf(
+	 batch_handle->notify_stream,
+	 "\tNumber of failed files\t\t: %d\n",
+	 number_of_failed_files );
+
+	fprintf(
+	 batch_handle->notify_stream,
+	 "\tNumber of skipped files\t\t: %d\n",
+	 batch_handle->number_of_files - number_of_processed_files - number_of_failed_files );
+
+	fprintf(
+	 batch_handle->notify_stream,
+	 "\tTotal size\t\t\t: %" PRIu64 " bytes\n",
+	 total_size );
+
+	fprintf(
+	 batch_handle->notify_stream,
+	 "\tProcessed size\t\t\t: %" PRIu64 " bytes\n",
+	 processed_size );
+
+	if( number_of_failed_files > 0 )
+	{
+		fprintf(
+		 batch_handle->notify_stream,
+		 "\nFailed files:\n" );
+
+		for( file_index = 0;
+		     file_index < batch_handle->number_of_files;
+		     file_index++ )
+		{
+			batch_file = batch_handle->files[ file_index ];
+
+			if( batch_file->result == -1 )
+			{
+				fprintf(
+				 batch_handle->notify_stream,
+				 "\t%s\n",
+				 batch_file->filename );
+			}
+		}
+	}
+	fprintf(
+	 batch_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
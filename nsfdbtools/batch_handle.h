@@ -0,0 +1,186 @@
+/*
+ * Batch handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BATCH_HANDLE_H )
+#define _BATCH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "nsfdbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define BATCH_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The maximum number of source files
+ */
+#define BATCH_HANDLE_MAXIMUM_NUMBER_OF_FILES	( 1024 * 1024 )
+
+typedef struct batch_handle_file batch_handle_file_t;
+
+struct batch_handle_file
+{
+	/* The filename
+	 */
+	char *filename;
+
+	/* The filename size
+	 */
+	size_t filename_size;
+
+	/* The name of the file, which is the part of the filename after the last path separator
+	 */
+	const char *name;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The result, which is 1 if the file was processed successfully,
+	 * -1 if the file could not be processed or 0 if the file was not processed
+	 */
+	int result;
+};
+
+typedef struct batch_handle batch_handle_t;
+
+struct batch_handle
+{
+	/* The source files
+	 */
+	batch_handle_file_t **files;
+
+	/* The number of source files
+	 */
+	int number_of_files;
+
+	/* The number of allocated source files
+	 */
+	int number_of_allocated_files;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The function to process a source file
+	 */
+	int (*process_file_function)(
+	       batch_handle_file_t *batch_file,
+	       void *arguments,
+	       libcerror_error_t **error );
+
+	/* The arguments of the function to process a source file
+	 */
+	void *process_file_function_arguments;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int batch_handle_initialize(
+     batch_handle_t **batch_handle,
+     libcerror_error_t **error );
+
+int batch_handle_free(
+     batch_handle_t **batch_handle,
+     libcerror_error_t **error );
+
+int batch_handle_signal_abort(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error );
+
+int batch_handle_set_number_of_threads(
+     batch_handle_t *batch_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int batch_handle_append_file(
+     batch_handle_t *batch_handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int batch_handle_read_list_file(
+     batch_handle_t *batch_handle,
+     const char *filename,
+     libcerror_error_t **error );
+
+int batch_handle_append_directory_entry(
+     batch_handle_t *batch_handle,
+     const char *path,
+     size_t path_length,
+     const char *entry_name,
+     libcerror_error_t **error );
+
+int batch_handle_read_directory(
+     batch_handle_t *batch_handle,
+     const char *path,
+     libcerror_error_t **error );
+
+int batch_handle_read_source(
+     batch_handle_t *batch_handle,
+     const char *source,
+     libcerror_error_t **error );
+
+int batch_handle_compare_files(
+     const void *first_file,
+     const void *second_file );
+
+int batch_handle_compare_names(
+     const void *first_file,
+     const void *second_file );
+
+int batch_handle_check_unique_names(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error );
+
+int batch_handle_process_file(
+     intptr_t *value,
+     void *arguments );
+
+int batch_handle_process_files(
+     batch_handle_t *batch_handle,
+     int (*process_file_function)(
+            batch_handle_file_t *batch_file,
+            void *arguments,
+            libcerror_error_t **error ),
+     void *process_file_function_arguments,
+     libcerror_error_t **error );
+
+int batch_handle_summary_fprint(
+     batch_handle_t *batch_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BATCH_HANDLE_H ) */
+
@@ -0,0 +1,2440 @@
+/*
+ * Benchmark handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "bench_handle.h"
+#include "nsfdbtools_libbfio.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libnsfdb.h"
+
+#define BENCH_HANDLE_NOTIFY_STREAM		stdout
+
+/* The minimum number of bytes processed by the throughput benchmarks
+ */
+#define BENCH_HANDLE_THROUGHPUT_DATA_SIZE	( 64 * 1024 * 1024 )
+
+/* Creates a benchmark handle
+ * Make sure the value bench_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_initialize(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_initialize";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bench_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid benchmark handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*bench_handle = memory_allocate_structure(
+	                 bench_handle_t );
+
+	if( *bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create benchmark handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bench_handle,
+	     0,
+	     sizeof( bench_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear benchmark handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *bench_handle )->mode              = BENCH_HANDLE_MODE_WARM;
+	( *bench_handle )->number_of_runs    = 5;
+	( *bench_handle )->number_of_lookups = 1000;
+	( *bench_handle )->seed              = 1;
+	( *bench_handle )->notify_stream     = BENCH_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *bench_handle != NULL )
+	{
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a benchmark handle
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_free(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_free";
+	int result            = 1;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bench_handle != NULL )
+	{
+		if( ( *bench_handle )->input_file != NULL )
+		{
+			if( libnsfdb_file_free(
+			     &( ( *bench_handle )->input_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *bench_handle )->note_identifiers != NULL )
+		{
+			memory_free(
+			 ( *bench_handle )->note_identifiers );
+		}
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the benchmark handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_signal_abort(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_signal_abort";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->abort = 1;
+
+	if( bench_handle->input_file != NULL )
+	{
+		if( libnsfdb_file_signal_abort(
+		     bench_handle->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Copies a 32-bit value from a decimal string
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_copy_from_decimal_string(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_copy_from_decimal_string";
+	size_t string_index   = 0;
+	uint64_t value_64bit  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		value_64bit *= 10;
+		value_64bit += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( value_64bit > (uint64_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*value_32bit = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the mode
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_mode(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_mode";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "cold" ),
+		     4 ) == 0 )
+		{
+			bench_handle->mode = BENCH_HANDLE_MODE_COLD;
+			result             = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "warm" ),
+		          4 ) == 0 )
+		{
+			bench_handle->mode = BENCH_HANDLE_MODE_WARM;
+			result             = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the number of runs
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_number_of_runs(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_number_of_runs";
+	uint32_t value_32bit  = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of runs from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_32bit == 0 )
+	 || ( value_32bit > (uint32_t) INT_MAX ) )
+	{
+		return( 0 );
+	}
+	bench_handle->number_of_runs = (int) value_32bit;
+
+	return( 1 );
+}
+
+/* Sets the number of note lookups per run
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_number_of_lookups(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_number_of_lookups";
+	uint32_t value_32bit  = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of lookups from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit > (uint32_t) INT_MAX )
+	{
+		return( 0 );
+	}
+	bench_handle->number_of_lookups = (int) value_32bit;
+
+	return( 1 );
+}
+
+/* Sets the seed of the note lookup sequence
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_set_seed(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_seed";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_copy_from_decimal_string(
+	     string,
+	     &( bench_handle->seed ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy seed from string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current value of a monotonic clock in micro seconds
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_get_time(
+     uint64_t *time_value,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_specification;
+#endif
+
+	static char *function = "bench_handle_get_time";
+
+	if( time_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*time_value = (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000
+	            + (uint64_t) ( ( counter.QuadPart % frequency.QuadPart ) * 1000000 / frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_specification ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock.",
+		 function );
+
+		return( -1 );
+	}
+	*time_value = (uint64_t) time_specification.tv_sec * 1000000
+	            + (uint64_t) time_specification.tv_nsec / 1000;
+#else
+	*time_value = (uint64_t) time( NULL ) * 1000000;
+#endif
+	return( 1 );
+}
+
+/* Requests the operating system to drop the cached pages of the input file
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int bench_handle_drop_file_cache(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_drop_file_cache";
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int file_descriptor   = -1;
+	int result            = 0;
+#endif
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_POSIX_FADVISE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_descriptor = open(
+	                   bench_handle->filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only clean pages are dropped, which is sufficient for a file opened read-only
+	 */
+	result = posix_fadvise(
+	          file_descriptor,
+	          0,
+	          0,
+	          POSIX_FADV_DONTNEED );
+
+	close(
+	 file_descriptor );
+
+	if( result != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Opens a file IO handle of the input file
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_open_file_io_handle(
+     bench_handle_t *bench_handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "bench_handle_open_file_io_handle";
+	size_t filename_length = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   bench_handle->filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     *file_io_handle,
+	     bench_handle->filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     *file_io_handle,
+	     bench_handle->filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     *file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a file IO handle of the input file
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_close_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_close_file_io_handle";
+	int result            = 1;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     *file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_handle_free(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Runs the open phases benchmark
+ * Times the individual read steps of an open using the phased reads of a structure map
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_run_open_phases(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libnsfdb_structure_map_t *structure_map  = NULL;
+	static char *function                    = "bench_handle_run_open_phases";
+	uint64_t end_time                        = 0;
+	uint64_t start_time                      = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_open_file_io_handle(
+	     bench_handle,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_structure_map_initialize(
+	     &structure_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create structure map.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_structure_map_read_file_header(
+	     structure_map,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.file_header_time = end_time - start_time;
+
+	start_time = end_time;
+
+	if( libnsfdb_structure_map_read_database_header(
+	     structure_map,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read database header.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.database_header_time = end_time - start_time;
+
+	start_time = end_time;
+
+	if( libnsfdb_structure_map_read_superblock(
+	     structure_map,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read superblock.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.superblock_time = end_time - start_time;
+
+	start_time = end_time;
+
+	if( libnsfdb_structure_map_read_bucket_descriptor_block(
+	     structure_map,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read bucket descriptor block.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.bucket_descriptor_block_time = end_time - start_time;
+
+	if( libnsfdb_structure_map_free(
+	     &structure_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free structure map.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_close_file_io_handle(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( structure_map != NULL )
+	{
+		libnsfdb_structure_map_free(
+		 &structure_map,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the checksum and decompression throughput benchmark
+ * The CX compressed data of the superblock is used as input
+ * Returns 1 if successful, 0 if no superblock could be read or -1 on error
+ */
+int bench_handle_run_throughput(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libnsfdb_structure_map_t *structure_map = NULL;
+	uint8_t *compressed_data                = NULL;
+	uint8_t *recompressed_data              = NULL;
+	uint8_t *uncompressed_data              = NULL;
+	static char *function                   = "bench_handle_run_throughput";
+	size_t compressed_data_size             = 0;
+	size_t maximum_recompressed_data_size   = 0;
+	size_t recompressed_data_size           = 0;
+	size_t uncompressed_data_size           = 0;
+	uint64_t end_time                       = 0;
+	uint64_t iteration                      = 0;
+	uint64_t number_of_iterations           = 0;
+	uint64_t start_time                     = 0;
+	uint32_t calculated_checksum            = 0;
+	int result                              = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_open_file_io_handle(
+	     bench_handle,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_structure_map_initialize(
+	     &structure_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create structure map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_structure_map_read_file_io_handle(
+	     structure_map,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read structure map.",
+		 function );
+
+		goto on_error;
+	}
+	result = libnsfdb_structure_map_get_superblock_data_size(
+	          structure_map,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve superblock data size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		compressed_data = (uint8_t *) memory_allocate(
+		                               compressed_data_size );
+
+		if( compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libnsfdb_structure_map_copy_superblock_data(
+		     structure_map,
+		     compressed_data,
+		     compressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy superblock data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libnsfdb_structure_map_free(
+	     &structure_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free structure map.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_close_file_io_handle(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( compressed_data == NULL )
+	{
+		return( 0 );
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_iterations = BENCH_HANDLE_THROUGHPUT_DATA_SIZE / compressed_data_size;
+
+	if( number_of_iterations == 0 )
+	{
+		number_of_iterations = 1;
+	}
+	if( bench_handle_get_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libnsfdb_calculate_xor32_checksum(
+		     &calculated_checksum,
+		     compressed_data,
+		     compressed_data_size,
+		     calculated_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate XOR-32 checksum.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.checksum_time      = end_time - start_time;
+	bench_handle->run_values.checksum_data_size = number_of_iterations * compressed_data_size;
+
+	number_of_iterations = BENCH_HANDLE_THROUGHPUT_DATA_SIZE / uncompressed_data_size;
+
+	if( number_of_iterations == 0 )
+	{
+		number_of_iterations = 1;
+	}
+	start_time = end_time;
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libnsfdb_cx_decompress(
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     compressed_data,
+		     compressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress superblock data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.decompress_time      = end_time - start_time;
+	bench_handle->run_values.decompress_data_size = number_of_iterations * uncompressed_data_size;
+
+	/* The decompressed superblock data is used as a realistic payload
+	 * to measure the compression and the decompression of the recompressed data
+	 */
+	if( libnsfdb_cx_get_maximum_compressed_data_size(
+	     uncompressed_data_size,
+	     &maximum_recompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum compressed data size.",
+		 function );
+
+		goto on_error;
+	}
+	recompressed_data = (uint8_t *) memory_allocate(
+	                                 maximum_recompressed_data_size );
+
+	if( recompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create recompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	start_time = end_time;
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		recompressed_data_size = maximum_recompressed_data_size;
+
+		if( libnsfdb_cx_compress(
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     recompressed_data,
+		     &recompressed_data_size,
+		     LIBNSFDB_COMPRESSION_LEVEL_DEFAULT,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress superblock data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.compress_time          = end_time - start_time;
+	bench_handle->run_values.compress_data_size     = number_of_iterations * uncompressed_data_size;
+	bench_handle->run_values.recompressed_data_size = (uint64_t) recompressed_data_size;
+
+	start_time = end_time;
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libnsfdb_cx_decompress(
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     recompressed_data,
+		     recompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress recompressed superblock data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.recompressed_decompress_time      = end_time - start_time;
+	bench_handle->run_values.recompressed_decompress_data_size = number_of_iterations * uncompressed_data_size;
+
+	memory_free(
+	 recompressed_data );
+
+	memory_free(
+	 uncompressed_data );
+
+	memory_free(
+	 compressed_data );
+
+	return( 1 );
+
+on_error:
+	if( recompressed_data != NULL )
+	{
+		memory_free(
+		 recompressed_data );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( structure_map != NULL )
+	{
+		libnsfdb_structure_map_free(
+		 &structure_map,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the open benchmark
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_run_open(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "bench_handle_run_open";
+	size_t filename_length = 0;
+	uint64_t end_time      = 0;
+	uint64_t start_time    = 0;
+	int result             = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->input_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid benchmark handle - input file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* A new file object is used for every run so that no library caches are shared between runs
+	 */
+	if( libnsfdb_file_initialize(
+	     &( bench_handle->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle->index_filename != NULL )
+	{
+		filename_length = system_string_length(
+		                   bench_handle->index_filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libnsfdb_file_set_index_filename_wide(
+		          bench_handle->input_file,
+		          bench_handle->index_filename,
+		          filename_length,
+		          error );
+#else
+		result = libnsfdb_file_set_index_filename(
+		          bench_handle->input_file,
+		          bench_handle->index_filename,
+		          filename_length,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libnsfdb_file_open_wide(
+	     bench_handle->input_file,
+	     bench_handle->filename,
+	     LIBNSFDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libnsfdb_file_open(
+	     bench_handle->input_file,
+	     bench_handle->filename,
+	     LIBNSFDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.open_time = end_time - start_time;
+
+	return( 1 );
+
+on_error:
+	if( bench_handle->input_file != NULL )
+	{
+		libnsfdb_file_free(
+		 &( bench_handle->input_file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the enumeration benchmark
+ * The identifiers of the enumerated notes are stored for the lookup benchmark
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_run_enumerate(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_t *note     = NULL;
+	static char *function     = "bench_handle_run_enumerate";
+	uint64_t end_time         = 0;
+	uint64_t start_time       = 0;
+	uint32_t note_identifier  = 0;
+	int note_index            = 0;
+	int number_of_notes       = 0;
+	int number_of_values      = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle_get_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_file_get_number_of_notes(
+	     bench_handle->input_file,
+	     LIBNSFDB_NOTE_TYPE_ALL,
+	     &number_of_notes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of notes.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( bench_handle->note_identifiers == NULL )
+	 && ( number_of_notes > 0 ) )
+	{
+		if( (size_t) number_of_notes > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of notes value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		bench_handle->note_identifiers = (uint32_t *) memory_allocate(
+		                                               sizeof( uint32_t ) * number_of_notes );
+
+		if( bench_handle->note_identifiers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create note identifiers.",
+			 function );
+
+			goto on_error;
+		}
+		bench_handle->number_of_note_identifiers = number_of_notes;
+	}
+	for( note_index = 0;
+	     note_index < number_of_notes;
+	     note_index++ )
+	{
+		if( bench_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libnsfdb_file_get_note(
+		     bench_handle->input_file,
+		     LIBNSFDB_NOTE_TYPE_ALL,
+		     note_index,
+		     &note,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve note: %d.",
+			 function,
+			 note_index );
+
+			goto on_error;
+		}
+		if( libnsfdb_note_get_identifier(
+		     note,
+		     &note_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve note: %d identifier.",
+			 function,
+			 note_index );
+
+			goto on_error;
+		}
+		if( libnsfdb_note_get_number_of_values(
+		     note,
+		     &number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve note: %d number of values.",
+			 function,
+			 note_index );
+
+			goto on_error;
+		}
+		if( libnsfdb_note_free(
+		     &note,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free note: %d.",
+			 function,
+			 note_index );
+
+			goto on_error;
+		}
+		if( note_index < bench_handle->number_of_note_identifiers )
+		{
+			bench_handle->note_identifiers[ note_index ] = note_identifier;
+		}
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.enumerate_time  = end_time - start_time;
+	bench_handle->run_values.number_of_notes = note_index;
+
+	return( 1 );
+
+on_error:
+	if( note != NULL )
+	{
+		libnsfdb_note_free(
+		 &note,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the note lookup benchmark
+ * The notes are looked up in a pseudo random order that is determined by the seed
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_run_lookups(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_t *note      = NULL;
+	static char *function      = "bench_handle_run_lookups";
+	uint64_t end_time          = 0;
+	uint64_t start_time        = 0;
+	uint32_t note_identifier   = 0;
+	uint32_t random_value      = 0;
+	int lookup_index           = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->number_of_note_identifiers == 0 )
+	{
+		bench_handle->run_values.lookup_time       = 0;
+		bench_handle->run_values.number_of_lookups = 0;
+
+		return( 1 );
+	}
+	random_value = bench_handle->seed;
+
+	if( bench_handle_get_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	for( lookup_index = 0;
+	     lookup_index < bench_handle->number_of_lookups;
+	     lookup_index++ )
+	{
+		if( bench_handle->abort != 0 )
+		{
+			break;
+		}
+		/* A linear congruential generator is used so that every run uses the same sequence
+		 */
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		note_identifier = bench_handle->note_identifiers[ ( random_value >> 8 ) % (uint32_t) bench_handle->number_of_note_identifiers ];
+
+		if( libnsfdb_file_get_note_by_identifier(
+		     bench_handle->input_file,
+		     LIBNSFDB_NOTE_TYPE_ALL,
+		     note_identifier,
+		     &note,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve note: 0x%08" PRIx32 ".",
+			 function,
+			 note_identifier );
+
+			goto on_error;
+		}
+		if( libnsfdb_note_free(
+		     &note,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free note: 0x%08" PRIx32 ".",
+			 function,
+			 note_identifier );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.lookup_time       = end_time - start_time;
+	bench_handle->run_values.number_of_lookups = lookup_index;
+
+	return( 1 );
+
+on_error:
+	if( note != NULL )
+	{
+		libnsfdb_note_free(
+		 &note,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input file of a run
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_run_close(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_run_close";
+	int result            = 1;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->input_file != NULL )
+	{
+		if( libnsfdb_file_close(
+		     bench_handle->input_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file.",
+			 function );
+
+			result = -1;
+		}
+		if( libnsfdb_file_free(
+		     &( bench_handle->input_file ),
+		     ( result == 1 ) ? error : NULL ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Runs a single benchmark run
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_run(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_run";
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( bench_handle->run_values ),
+	     0,
+	     sizeof( bench_handle_run_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear run values.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->mode == BENCH_HANDLE_MODE_COLD )
+	{
+		result = bench_handle_drop_file_cache(
+		          bench_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to drop file cache.",
+			 function );
+
+			goto on_error;
+		}
+		bench_handle->run_values.file_cache_dropped = (uint8_t) result;
+	}
+	if( bench_handle_run_open_phases(
+	     bench_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run open phases benchmark.",
+		 function );
+
+		goto on_error;
+	}
+	/* In cold mode the cached pages read by the open phases benchmark are dropped again
+	 */
+	if( ( bench_handle->mode == BENCH_HANDLE_MODE_COLD )
+	 && ( bench_handle->run_values.file_cache_dropped != 0 ) )
+	{
+		if( bench_handle_drop_file_cache(
+		     bench_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to drop file cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_run_open(
+	     bench_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run open benchmark.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_run_enumerate(
+	     bench_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run enumerate benchmark.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_run_lookups(
+	     bench_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run lookups benchmark.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_run_close(
+	     bench_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	result = bench_handle_run_throughput(
+	          bench_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run throughput benchmark.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->run_values.superblock_data_available = (uint8_t) result;
+
+	return( 1 );
+
+on_error:
+	bench_handle_run_close(
+	 bench_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Prints a string as a JSON string
+ */
+void bench_handle_json_string_fprint(
+      bench_handle_t *bench_handle,
+      const system_character_t *string )
+{
+	size_t string_index = 0;
+
+	if( ( bench_handle == NULL )
+	 || ( string == NULL ) )
+	{
+		return;
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\"" );
+
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] == (system_character_t) '"' )
+		 || ( string[ string_index ] == (system_character_t) '\\' ) )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\\" );
+		}
+		else if( ( string[ string_index ] >= 0 )
+		      && ( string[ string_index ] < 0x20 ) )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\\u%04x",
+			 (unsigned int) string[ string_index ] );
+
+			continue;
+		}
+		fprintf(
+		 bench_handle->notify_stream,
+		 "%" PRIc_SYSTEM "",
+		 string[ string_index ] );
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\"" );
+}
+
+/* Prints the values of a benchmark run as a JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_run_values_fprint(
+     bench_handle_t *bench_handle,
+     int run_number,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_run_values_fprint";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "    {\n" );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "      \"run\": %d,\n",
+	 run_number );
+
+	if( bench_handle->mode == BENCH_HANDLE_MODE_COLD )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "      \"file_cache_dropped\": %s,\n",
+		 ( bench_handle->run_values.file_cache_dropped != 0 ) ? "true" : "false" );
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "      \"open_phases_usec\": {\n" );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "        \"file_header\": %" PRIu64 ",\n",
+	 bench_handle->run_values.file_header_time );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "        \"database_header\": %" PRIu64 ",\n",
+	 bench_handle->run_values.database_header_time );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "        \"superblock\": %" PRIu64 ",\n",
+	 bench_handle->run_values.superblock_time );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "        \"bucket_descriptor_block\": %" PRIu64 "\n",
+	 bench_handle->run_values.bucket_descriptor_block_time );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "      },\n" );
+	fprintf(
+	 bench_handle->notify_stream,
+	 "      \"open_usec\": %" PRIu64 ",\n",
+	 bench_handle->run_values.open_time );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "      \"number_of_notes\": %d,\n",
+	 bench_handle->run_values.number_of_notes );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "      \"enumerate_usec\": %" PRIu64 ",\n",
+	 bench_handle->run_values.enumerate_time );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "      \"number_of_lookups\": %d,\n",
+	 bench_handle->run_values.number_of_lookups );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "      \"lookup_usec\": %" PRIu64 "",
+	 bench_handle->run_values.lookup_time );
+
+	if( bench_handle->run_values.superblock_data_available != 0 )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 ",\n" );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "      \"checksum_bytes\": %" PRIu64 ",\n",
+		 bench_handle->run_values.checksum_data_size );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "      \"checksum_usec\": %" PRIu64 ",\n",
+		 bench_handle->run_values.checksum_time );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "      \"decompress_bytes\": %" PRIu64 ",\n",
+		 bench_handle->run_values.decompress_data_size );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "      \"decompress_usec\": %" PRIu64 ",\n",
+		 bench_handle->run_values.decompress_time );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "      \"compress_bytes\": %" PRIu64 ",\n",
+		 bench_handle->run_values.compress_data_size );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "      \"compress_usec\": %" PRIu64 ",\n",
+		 bench_handle->run_values.compress_time );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "      \"recompressed_size\": %" PRIu64 ",\n",
+		 bench_handle->run_values.recompressed_data_size );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "      \"recompressed_decompress_bytes\": %" PRIu64 ",\n",
+		 bench_handle->run_values.recompressed_decompress_data_size );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "      \"recompressed_decompress_usec\": %" PRIu64 "",
+		 bench_handle->run_values.recompressed_decompress_time );
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\n    }" );
+
+	return( 1 );
+}
+
+/* Runs the benchmark and prints the results as a JSON document
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_runs_fprint(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_runs_fprint";
+	int run_number        = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid benchmark handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid benchmark handle - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	/* In warm mode an initial run, that is not reported, is used to populate the operating system file cache
+	 */
+	if( bench_handle->mode == BENCH_HANDLE_MODE_WARM )
+	{
+		if( bench_handle_run(
+		     bench_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run warm up.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "{\n" );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "  \"filename\": " );
+
+	bench_handle_json_string_fprint(
+	 bench_handle,
+	 bench_handle->filename );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 ",\n" );
+
+	if( bench_handle->index_filename != NULL )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "  \"index_filename\": " );
+
+		bench_handle_json_string_fprint(
+		 bench_handle,
+		 bench_handle->index_filename );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 ",\n" );
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "  \"mode\": \"%s\",\n",
+	 ( bench_handle->mode == BENCH_HANDLE_MODE_COLD ) ? "cold" : "warm" );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "  \"seed\": %" PRIu32 ",\n",
+	 bench_handle->seed );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "  \"runs\": [\n" );
+
+	for( run_number = 1;
+	     run_number <= bench_handle->number_of_runs;
+	     run_number++ )
+	{
+		if( bench_handle->abort != 0 )
+		{
+			break;
+		}
+		if( bench_handle_run(
+		     bench_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run benchmark: %d.",
+			 function,
+			 run_number );
+
+			return( -1 );
+		}
+		if( run_number > 1 )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 ",\n" );
+		}
+		if( bench_handle_run_values_fprint(
+		     bench_handle,
+		     run_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print run: %d values.",
+			 function,
+			 run_number );
+
+			return( -1 );
+		}
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\n  ]\n"
+	 "}\n" );
+
+	return( 1 );
+}
+
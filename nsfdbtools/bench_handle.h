@@ -0,0 +1,281 @@
+/*
+ * Benchmark handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BENCH_HANDLE_H )
+#define _BENCH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "nsfdbtools_libbfio.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libnsfdb.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum BENCH_HANDLE_MODES
+{
+	BENCH_HANDLE_MODE_COLD			= (int) 'c',
+	BENCH_HANDLE_MODE_WARM			= (int) 'w'
+};
+
+typedef struct bench_handle_run_values bench_handle_run_values_t;
+
+struct bench_handle_run_values
+{
+	/* Value to indicate the operating system file cache was dropped
+	 */
+	uint8_t file_cache_dropped;
+
+	/* Value to indicate the superblock data was available for the throughput benchmark
+	 */
+	uint8_t superblock_data_available;
+
+	/* The time spent reading the file header, in micro seconds
+	 */
+	uint64_t file_header_time;
+
+	/* The time spent reading the database header, in micro seconds
+	 */
+	uint64_t database_header_time;
+
+	/* The time spent reading and decompressing the superblock, in micro seconds
+	 */
+	uint64_t superblock_time;
+
+	/* The time spent reading the bucket descriptor block and UNK table, in micro seconds
+	 */
+	uint64_t bucket_descriptor_block_time;
+
+	/* The time spent opening the file, in micro seconds
+	 */
+	uint64_t open_time;
+
+	/* The time spent enumerating the notes, in micro seconds
+	 */
+	uint64_t enumerate_time;
+
+	/* The number of notes enumerated
+	 */
+	int number_of_notes;
+
+	/* The time spent on the note lookups, in micro seconds
+	 */
+	uint64_t lookup_time;
+
+	/* The number of note lookups
+	 */
+	int number_of_lookups;
+
+	/* The time spent calculating checksums, in micro seconds
+	 */
+	uint64_t checksum_time;
+
+	/* The number of bytes checksummed
+	 */
+	uint64_t checksum_data_size;
+
+	/* The time spent decompressing, in micro seconds
+	 */
+	uint64_t decompress_time;
+
+	/* The number of bytes decompressed
+	 */
+	uint64_t decompress_data_size;
+
+	/* The time spent compressing, in micro seconds
+	 */
+	uint64_t compress_time;
+
+	/* The number of bytes compressed
+	 */
+	uint64_t compress_data_size;
+
+	/* The size of the recompressed data
+	 */
+	uint64_t recompressed_data_size;
+
+	/* The time spent decompressing the recompressed data, in micro seconds
+	 */
+	uint64_t recompressed_decompress_time;
+
+	/* The number of bytes of recompressed data decompressed
+	 */
+	uint64_t recompressed_decompress_data_size;
+};
+
+typedef struct bench_handle bench_handle_t;
+
+struct bench_handle
+{
+	/* The input filename
+	 */
+	const system_character_t *filename;
+
+	/* The index filename
+	 */
+	const system_character_t *index_filename;
+
+	/* The mode
+	 */
+	int mode;
+
+	/* The number of runs
+	 */
+	int number_of_runs;
+
+	/* The number of note lookups per run
+	 */
+	int number_of_lookups;
+
+	/* The seed of the note lookup sequence
+	 */
+	uint32_t seed;
+
+	/* The input file
+	 */
+	libnsfdb_file_t *input_file;
+
+	/* The note identifiers
+	 */
+	uint32_t *note_identifiers;
+
+	/* The number of note identifiers
+	 */
+	int number_of_note_identifiers;
+
+	/* The run values
+	 */
+	bench_handle_run_values_t run_values;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int bench_handle_initialize(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_free(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_signal_abort(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_copy_from_decimal_string(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int bench_handle_set_mode(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_number_of_runs(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_number_of_lookups(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_set_seed(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_get_time(
+     uint64_t *time_value,
+     libcerror_error_t **error );
+
+int bench_handle_drop_file_cache(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_open_file_io_handle(
+     bench_handle_t *bench_handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int bench_handle_close_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int bench_handle_run_open_phases(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_run_throughput(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_run_open(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_run_enumerate(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_run_lookups(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_run_close(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_run(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+void bench_handle_json_string_fprint(
+      bench_handle_t *bench_handle,
+      const system_character_t *string );
+
+int bench_handle_run_values_fprint(
+     bench_handle_t *bench_handle,
+     int run_number,
+     libcerror_error_t **error );
+
+int bench_handle_runs_fprint(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCH_HANDLE_H ) */
+
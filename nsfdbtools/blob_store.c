@@ -0,0 +1,1092 @@
+/*
+ * Content-addressed blob store
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <errno.h>
+
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if !defined( WINAPI )
+#include <stdio.h>
+#include <time.h>
+#endif
+
+#include "blob_store.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcfile.h"
+#include "nsfdbtools_libcpath.h"
+#include "sha256_context.h"
+
+/* Creates a blob store
+ * Make sure the value blob_store is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_initialize(
+     blob_store_t **blob_store,
+     libcerror_error_t **error )
+{
+	static char *function = "blob_store_initialize";
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *blob_store != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid blob store value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*blob_store = memory_allocate_structure(
+	               blob_store_t );
+
+	if( *blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blob store.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *blob_store,
+	     0,
+	     sizeof( blob_store_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear blob store.",
+		 function );
+
+		goto on_error;
+	}
+	if( sha256_context_initialize(
+	     &( ( *blob_store )->sha256_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize SHA-256 context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *blob_store != NULL )
+	{
+		memory_free(
+		 *blob_store );
+
+		*blob_store = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a blob store
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_free(
+     blob_store_t **blob_store,
+     libcerror_error_t **error )
+{
+	static char *function = "blob_store_free";
+	int result            = 1;
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *blob_store != NULL )
+	{
+		if( ( *blob_store )->path != NULL )
+		{
+			memory_free(
+			 ( *blob_store )->path );
+		}
+		if( ( *blob_store )->blob_filename != NULL )
+		{
+			memory_free(
+			 ( *blob_store )->blob_filename );
+		}
+		if( ( *blob_store )->temporary_blob_filename != NULL )
+		{
+			memory_free(
+			 ( *blob_store )->temporary_blob_filename );
+		}
+		if( sha256_context_free(
+		     &( ( *blob_store )->sha256_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free SHA-256 context.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *blob_store );
+
+		*blob_store = NULL;
+	}
+	return( result );
+}
+
+/* Opens the blob store
+ * The directory is created if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_open(
+     blob_store_t *blob_store,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	static char *function = "blob_store_open";
+	size_t path_length    = 0;
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( blob_store->path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid blob store - path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( system_character_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	blob_store->path_size = path_length + 1;
+
+	blob_store->path = system_string_allocate(
+	                    blob_store->path_size );
+
+	if( blob_store->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     blob_store->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	blob_store->path[ path_length ] = 0;
+
+	/* The blob filename consists of the path, the subdirectory name and the hash
+	 * as hexadecimal digits and the temporary blob filename has the suffix: .################.tmp
+	 * where the hexadecimal digits contain the process identifier and a pseudo random value
+	 */
+	blob_store->blob_filename_size = path_length + 1 + BLOB_STORE_SUBDIRECTORY_NAME_LENGTH + 1 + ( SHA256_HASH_SIZE * 2 ) + 1;
+
+	blob_store->blob_filename = system_string_allocate(
+	                             blob_store->blob_filename_size );
+
+	if( blob_store->blob_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blob filename.",
+		 function );
+
+		goto on_error;
+	}
+	blob_store->temporary_blob_filename_size = blob_store->blob_filename_size + 21;
+
+	blob_store->temporary_blob_filename = system_string_allocate(
+	                                       blob_store->temporary_blob_filename_size );
+
+	if( blob_store->temporary_blob_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary blob filename.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	blob_store->random_value = (uint32_t) GetTickCount();
+#else
+	blob_store->random_value = (uint32_t) time( NULL );
+#endif
+	blob_store->random_value ^= (uint32_t) (intptr_t) blob_store;
+
+	if( blob_store_make_directory(
+	     blob_store->path,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to make directory: %" PRIs_SYSTEM ".",
+		 function,
+		 blob_store->path );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( blob_store->temporary_blob_filename != NULL )
+	{
+		memory_free(
+		 blob_store->temporary_blob_filename );
+
+		blob_store->temporary_blob_filename = NULL;
+	}
+	blob_store->temporary_blob_filename_size = 0;
+
+	if( blob_store->blob_filename != NULL )
+	{
+		memory_free(
+		 blob_store->blob_filename );
+
+		blob_store->blob_filename = NULL;
+	}
+	blob_store->blob_filename_size = 0;
+
+	if( blob_store->path != NULL )
+	{
+		memory_free(
+		 blob_store->path );
+
+		blob_store->path = NULL;
+	}
+	blob_store->path_size = 0;
+
+	return( -1 );
+}
+
+/* Makes a directory if it does not exist
+ * The directory can be shared with other exports that run concurrently
+ * Returns 1 if successful, 0 if the directory already exists or -1 on error
+ */
+int blob_store_make_directory(
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	static char *function = "blob_store_make_directory";
+	int result            = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+		  path,
+		  error );
+#else
+	result = libcfile_file_exists(
+		  path,
+		  error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_path_make_directory_wide(
+	          path,
+	          error );
+#else
+	result = libcpath_path_make_directory(
+	          path,
+	          error );
+#endif
+	if( result == 1 )
+	{
+		return( 1 );
+	}
+	/* Another export could have made the directory in the meantime
+	 */
+	libcerror_error_free(
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+		  path,
+		  error );
+#else
+	result = libcfile_file_exists(
+		  path,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to make directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Sets the blob filename of a hash
+ * The blob filename is copied to the start of the temporary blob filename
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_set_blob_filenames(
+     blob_store_t *blob_store,
+     const uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "blob_store_set_blob_filenames";
+	size_t filename_index = 0;
+	size_t hash_index     = 0;
+	uint8_t nibble        = 0;
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( blob_store->path == NULL )
+	 || ( blob_store->blob_filename == NULL )
+	 || ( blob_store->temporary_blob_filename == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid blob store - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size != SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported hash size.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     blob_store->blob_filename,
+	     blob_store->path,
+	     blob_store->path_size - 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path to blob filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_index = blob_store->path_size - 1;
+
+	blob_store->blob_filename[ filename_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
+
+	/* The subdirectory name consists of the first hexadecimal digits of the hash
+	 */
+	filename_index += BLOB_STORE_SUBDIRECTORY_NAME_LENGTH;
+
+	blob_store->blob_filename[ filename_index++ ] = (system_character_t) LIBCPATH_SEPARATOR;
+
+	for( hash_index = 0;
+	     hash_index < hash_size;
+	     hash_index++ )
+	{
+		nibble = hash[ hash_index ] >> 4;
+
+		if( nibble <= 9 )
+		{
+			blob_store->blob_filename[ filename_index++ ] = (system_character_t) '0' + nibble;
+		}
+		else
+		{
+			blob_store->blob_filename[ filename_index++ ] = (system_character_t) 'a' + nibble - 10;
+		}
+		nibble = hash[ hash_index ] & 0x0f;
+
+		if( nibble <= 9 )
+		{
+			blob_store->blob_filename[ filename_index++ ] = (system_character_t) '0' + nibble;
+		}
+		else
+		{
+			blob_store->blob_filename[ filename_index++ ] = (system_character_t) 'a' + nibble - 10;
+		}
+	}
+	blob_store->blob_filename[ filename_index ] = 0;
+
+	if( memory_copy(
+	     &( blob_store->blob_filename[ blob_store->path_size ] ),
+	     &( blob_store->blob_filename[ blob_store->path_size + BLOB_STORE_SUBDIRECTORY_NAME_LENGTH + 1 ] ),
+	     sizeof( system_character_t ) * BLOB_STORE_SUBDIRECTORY_NAME_LENGTH ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy subdirectory name to blob filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     blob_store->temporary_blob_filename,
+	     blob_store->blob_filename,
+	     filename_index ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy blob filename to temporary blob filename.",
+		 function );
+
+		return( -1 );
+	}
+	blob_store->temporary_blob_filename[ filename_index ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the next pseudo random value
+ * The pseudo random values are only used to make a collision of temporary blob filenames
+ * unlikely, a temporary blob file is always created exclusively
+ * Returns the pseudo random value
+ */
+uint32_t blob_store_get_random_value(
+          blob_store_t *blob_store )
+{
+	uint32_t random_value = 0;
+
+	if( blob_store == NULL )
+	{
+		return( 0 );
+	}
+	random_value = blob_store->random_value;
+
+	if( random_value == 0 )
+	{
+		random_value = 0x9e3779b9UL;
+	}
+	random_value ^= random_value << 13;
+	random_value ^= random_value >> 17;
+	random_value ^= random_value << 5;
+
+	blob_store->random_value = random_value;
+
+	return( random_value );
+}
+
+/* Creates the temporary blob file
+ * The temporary blob filename is the blob filename followed by the process identifier
+ * and a pseudo random value, the file is created exclusively and another pseudo random
+ * value is tried if the file already exists
+ * Returns 1 if successful or -1 on error
+ */
+int blob_store_create_temporary_file(
+     blob_store_t *blob_store,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	HANDLE file_handle     = INVALID_HANDLE_VALUE;
+#else
+	int file_descriptor    = -1;
+#endif
+
+	static char *function  = "blob_store_create_temporary_file";
+	size_t filename_index  = 0;
+	uint64_t unique_value  = 0;
+	uint32_t process_value = 0;
+	uint8_t bit_shift      = 0;
+	uint8_t nibble         = 0;
+	int attempt            = 0;
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( blob_store->blob_filename == NULL )
+	 || ( blob_store->temporary_blob_filename == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid blob store - not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	process_value = (uint32_t) GetCurrentProcessId();
+#else
+	process_value = (uint32_t) getpid();
+#endif
+	for( attempt = 0;
+	     attempt < BLOB_STORE_MAXIMUM_NUMBER_OF_ATTEMPTS;
+	     attempt++ )
+	{
+		unique_value = ( (uint64_t) process_value << 32 )
+		             | blob_store_get_random_value(
+		                blob_store );
+
+		filename_index = blob_store->blob_filename_size - 1;
+
+		blob_store->temporary_blob_filename[ filename_index++ ] = (system_character_t) '.';
+
+		for( bit_shift = 64;
+		     bit_shift > 0;
+		     bit_shift -= 4 )
+		{
+			nibble = (uint8_t) ( ( unique_value >> ( bit_shift - 4 ) ) & 0x0f );
+
+			if( nibble <= 9 )
+			{
+				blob_store->temporary_blob_filename[ filename_index++ ] = (system_character_t) '0' + nibble;
+			}
+			else
+			{
+				blob_store->temporary_blob_filename[ filename_index++ ] = (system_character_t) 'a' + nibble - 10;
+			}
+		}
+		blob_store->temporary_blob_filename[ filename_index++ ] = (system_character_t) '.';
+		blob_store->temporary_blob_filename[ filename_index++ ] = (system_character_t) 't';
+		blob_store->temporary_blob_filename[ filename_index++ ] = (system_character_t) 'm';
+		blob_store->temporary_blob_filename[ filename_index++ ] = (system_character_t) 'p';
+		blob_store->temporary_blob_filename[ filename_index ]   = 0;
+
+#if defined( WINAPI ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		file_handle = CreateFileW(
+		               (LPCWSTR) blob_store->temporary_blob_filename,
+		               GENERIC_WRITE,
+		               0,
+		               NULL,
+		               CREATE_NEW,
+		               FILE_ATTRIBUTE_NORMAL,
+		               NULL );
+#elif defined( WINAPI )
+		file_handle = CreateFileA(
+		               (LPCSTR) blob_store->temporary_blob_filename,
+		               GENERIC_WRITE,
+		               0,
+		               NULL,
+		               CREATE_NEW,
+		               FILE_ATTRIBUTE_NORMAL,
+		               NULL );
+#elif defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#error Missing wide character open function
+#else
+		file_descriptor = open(
+		                   blob_store->temporary_blob_filename,
+		                   O_WRONLY | O_CREAT | O_EXCL,
+		                   0644 );
+#endif
+
+#if defined( WINAPI )
+		if( file_handle != INVALID_HANDLE_VALUE )
+		{
+			CloseHandle(
+			 file_handle );
+
+			return( 1 );
+		}
+		if( GetLastError() != ERROR_FILE_EXISTS )
+		{
+			break;
+		}
+#else
+		if( file_descriptor != -1 )
+		{
+			close(
+			 file_descriptor );
+
+			return( 1 );
+		}
+		if( errno != EEXIST )
+		{
+			break;
+		}
+#endif
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_OPEN_FAILED,
+	 "%s: unable to create temporary file: %" PRIs_SYSTEM ".",
+	 function,
+	 blob_store->temporary_blob_filename );
+
+	return( -1 );
+}
+
+/* Writes a blob to the blob store
+ * The blob is named by the SHA-256 hash of its data and is only written if it is not already stored
+ * Returns 1 if the blob was written, 0 if the blob was already stored or -1 on error
+ */
+int blob_store_write_blob(
+     blob_store_t *blob_store,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *file          = NULL;
+	static char *function          = "blob_store_write_blob";
+	size_t directory_end           = 0;
+	ssize_t write_count            = 0;
+	int result                     = 0;
+	int temporary_file_was_created = 0;
+
+	if( blob_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blob store.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sha256_context_update(
+	     blob_store->sha256_context,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update SHA-256 context.",
+		 function );
+
+		return( -1 );
+	}
+	if( sha256_context_finalize(
+	     blob_store->sha256_context,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize SHA-256 context.",
+		 function );
+
+		return( -1 );
+	}
+	if( blob_store_set_blob_filenames(
+	     blob_store,
+	     hash,
+	     hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set blob filenames.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+		  blob_store->blob_filename,
+		  error );
+#else
+	result = libcfile_file_exists(
+		  blob_store->blob_filename,
+		  error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+		 function,
+		 blob_store->blob_filename );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		blob_store->number_of_deduplicated_blobs += 1;
+		blob_store->deduplicated_data_size       += data_size;
+
+		return( 0 );
+	}
+	/* Temporarily terminate the blob filename after the subdirectory name
+	 */
+	directory_end = blob_store->path_size + BLOB_STORE_SUBDIRECTORY_NAME_LENGTH;
+
+	blob_store->blob_filename[ directory_end ] = 0;
+
+	result = blob_store_make_directory(
+	          blob_store->blob_filename,
+	          error );
+
+	blob_store->blob_filename[ directory_end ] = (system_character_t) LIBCPATH_SEPARATOR;
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to make blob subdirectory.",
+		 function );
+
+		return( -1 );
+	}
+	/* The blob is written to a temporary file first so that a blob file
+	 * is never visible while incomplete
+	 */
+	if( blob_store_create_temporary_file(
+	     blob_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file.",
+		 function );
+
+		return( -1 );
+	}
+	temporary_file_was_created = 1;
+
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     file,
+	     blob_store->temporary_blob_filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     file,
+	     blob_store->temporary_blob_filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 blob_store->temporary_blob_filename );
+
+		goto on_error;
+	}
+	if( data_size > 0 )
+	{
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               data,
+		               data_size,
+		               error );
+
+		if( write_count != (ssize_t) data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write blob data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	/* Another export that stored the same blob in the meantime wrote the same data
+	 */
+#if defined( WINAPI ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( MoveFileExW(
+	     blob_store->temporary_blob_filename,
+	     blob_store->blob_filename,
+	     MOVEFILE_REPLACE_EXISTING ) == 0 )
+#elif defined( WINAPI )
+	if( MoveFileExA(
+	     blob_store->temporary_blob_filename,
+	     blob_store->blob_filename,
+	     MOVEFILE_REPLACE_EXISTING ) == 0 )
+#elif defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#error Missing wide character rename function
+#else
+	if( rename(
+	     blob_store->temporary_blob_filename,
+	     blob_store->blob_filename ) != 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to rename file: %" PRIs_SYSTEM ".",
+		 function,
+		 blob_store->temporary_blob_filename );
+
+		goto on_error;
+	}
+	blob_store->number_of_stored_blobs += 1;
+	blob_store->stored_data_size       += data_size;
+
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	if( temporary_file_was_created != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		libcfile_file_remove_wide(
+		 blob_store->temporary_blob_filename,
+		 NULL );
+#else
+		libcfile_file_remove(
+		 blob_store->temporary_blob_filename,
+		 NULL );
+#endif
+	}
+	return( -1 );
+}
+
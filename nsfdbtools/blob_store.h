@@ -0,0 +1,139 @@
+/*
+ * Content-addressed blob store
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BLOB_STORE_H )
+#define _BLOB_STORE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "nsfdbtools_libcerror.h"
+#include "sha256_context.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of characters of the hash that are used as subdirectory name
+ */
+#define BLOB_STORE_SUBDIRECTORY_NAME_LENGTH	2
+
+/* The maximum number of attempts to create a temporary blob file with a unique name
+ */
+#define BLOB_STORE_MAXIMUM_NUMBER_OF_ATTEMPTS	16
+
+typedef struct blob_store blob_store_t;
+
+struct blob_store
+{
+	/* The path of the directory the blobs are stored in
+	 */
+	system_character_t *path;
+
+	/* The path size
+	 */
+	size_t path_size;
+
+	/* The blob filename
+	 */
+	system_character_t *blob_filename;
+
+	/* The blob filename size
+	 */
+	size_t blob_filename_size;
+
+	/* The temporary blob filename
+	 */
+	system_character_t *temporary_blob_filename;
+
+	/* The temporary blob filename size
+	 */
+	size_t temporary_blob_filename_size;
+
+	/* The pseudo random value used to create unique temporary blob filenames
+	 */
+	uint32_t random_value;
+
+	/* The SHA-256 context
+	 */
+	sha256_context_t *sha256_context;
+
+	/* The number of blobs stored
+	 */
+	int number_of_stored_blobs;
+
+	/* The number of bytes stored
+	 */
+	uint64_t stored_data_size;
+
+	/* The number of blobs that were already stored
+	 */
+	int number_of_deduplicated_blobs;
+
+	/* The number of bytes that were not stored since the blob was already stored
+	 */
+	uint64_t deduplicated_data_size;
+};
+
+int blob_store_initialize(
+     blob_store_t **blob_store,
+     libcerror_error_t **error );
+
+int blob_store_free(
+     blob_store_t **blob_store,
+     libcerror_error_t **error );
+
+int blob_store_open(
+     blob_store_t *blob_store,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int blob_store_make_directory(
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int blob_store_set_blob_filenames(
+     blob_store_t *blob_store,
+     const uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+uint32_t blob_store_get_random_value(
+          blob_store_t *blob_store );
+
+int blob_store_create_temporary_file(
+     blob_store_t *blob_store,
+     libcerror_error_t **error );
+
+int blob_store_write_blob(
+     blob_store_t *blob_store,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BLOB_STORE_H ) */
+
@@ -0,0 +1,1816 @@
+/*
+ * Check handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "check_handle.h"
+#include "nsfdbtools_libbfio.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcthreads.h"
+#include "nsfdbtools_libnsfdb.h"
+
+#define CHECK_HANDLE_NOTIFY_STREAM		stdout
+
+/* Creates a check handle
+ * Make sure the value check_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_initialize(
+     check_handle_t **check_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_initialize";
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *check_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid check handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*check_handle = memory_allocate_structure(
+	                 check_handle_t );
+
+	if( *check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create check handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *check_handle,
+	     0,
+	     sizeof( check_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear check handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *check_handle )->number_of_threads = 1;
+	( *check_handle )->notify_stream     = CHECK_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *check_handle != NULL )
+	{
+		memory_free(
+		 *check_handle );
+
+		*check_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a check handle
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_free(
+     check_handle_t **check_handle,
+     libcerror_error_t **error )
+{
+	check_handle_segment_t *segment = NULL;
+	static char *function           = "check_handle_free";
+	int result                      = 1;
+	int segment_index               = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *check_handle != NULL )
+	{
+		if( ( *check_handle )->segments != NULL )
+		{
+			for( segment_index = 0;
+			     segment_index < ( *check_handle )->number_of_segments;
+			     segment_index++ )
+			{
+				segment = &( ( *check_handle )->segments[ segment_index ] );
+
+				if( segment->file_io_handle != NULL )
+				{
+					libbfio_handle_free(
+					 &( segment->file_io_handle ),
+					 NULL );
+				}
+				if( segment->error != NULL )
+				{
+					libcerror_error_free(
+					 &( segment->error ) );
+				}
+			}
+			memory_free(
+			 ( *check_handle )->segments );
+		}
+		if( ( *check_handle )->structures != NULL )
+		{
+			memory_free(
+			 ( *check_handle )->structures );
+		}
+		if( ( *check_handle )->structure_map != NULL )
+		{
+			if( libnsfdb_structure_map_free(
+			     &( ( *check_handle )->structure_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free structure map.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *check_handle );
+
+		*check_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the check handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_signal_abort(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_signal_abort";
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The segments check the abort value of the check handle before every structure
+	 */
+	check_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Copies a 32-bit value from a decimal string
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_copy_from_decimal_string(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_copy_from_decimal_string";
+	size_t string_index   = 0;
+	uint64_t value_64bit  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		value_64bit *= 10;
+		value_64bit += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( value_64bit > (uint64_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*value_32bit = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int check_handle_set_number_of_threads(
+     check_handle_t *check_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_set_number_of_threads";
+	uint32_t value_32bit  = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of threads from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_32bit == 0 )
+	 || ( value_32bit > CHECK_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+	check_handle->number_of_threads = (int) value_32bit;
+
+	return( 1 );
+}
+
+/* Retrieves the current value of a monotonic clock in micro seconds
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_get_time(
+     uint64_t *time_value,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_specification;
+#endif
+
+	static char *function = "check_handle_get_time";
+
+	if( time_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*time_value = (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000
+	            + (uint64_t) ( ( counter.QuadPart % frequency.QuadPart ) * 1000000 / frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_specification ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock.",
+		 function );
+
+		return( -1 );
+	}
+	*time_value = (uint64_t) time_specification.tv_sec * 1000000
+	            + (uint64_t) time_specification.tv_nsec / 1000;
+#else
+	*time_value = (uint64_t) time( NULL ) * 1000000;
+#endif
+	return( 1 );
+}
+
+/* Opens a file IO handle of the input file
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_open_file_io_handle(
+     check_handle_t *check_handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "check_handle_open_file_io_handle";
+	size_t filename_length = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid check handle - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   check_handle->filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     *file_io_handle,
+	     check_handle->filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     *file_io_handle,
+	     check_handle->filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     *file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_close_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_close_file_io_handle";
+	int result            = 1;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( libbfio_handle_close(
+		     *file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Appends a structure to be checked
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_append_structure(
+     check_handle_t *check_handle,
+     uint8_t type,
+     int copy_number,
+     off64_t file_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	check_handle_structure_t *structure = NULL;
+	void *reallocation                  = NULL;
+	static char *function               = "check_handle_append_structure";
+	size_t structures_size              = 0;
+	int maximum_number_of_structures    = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->number_of_structures >= check_handle->maximum_number_of_structures )
+	{
+		if( check_handle->maximum_number_of_structures == 0 )
+		{
+			maximum_number_of_structures = 256;
+		}
+		else
+		{
+			maximum_number_of_structures = check_handle->maximum_number_of_structures * 2;
+		}
+		if( maximum_number_of_structures <= check_handle->number_of_structures )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of structures value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		structures_size = sizeof( check_handle_structure_t ) * (size_t) maximum_number_of_structures;
+
+		if( structures_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid structures size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                check_handle->structures,
+		                structures_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize structures.",
+			 function );
+
+			return( -1 );
+		}
+		check_handle->structures                   = (check_handle_structure_t *) reallocation;
+		check_handle->maximum_number_of_structures = maximum_number_of_structures;
+	}
+	structure = &( check_handle->structures[ check_handle->number_of_structures ] );
+
+	if( memory_set(
+	     structure,
+	     0,
+	     sizeof( check_handle_structure_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear structure.",
+		 function );
+
+		return( -1 );
+	}
+	structure->type        = type;
+	structure->copy_number = copy_number;
+	structure->file_offset = file_offset;
+	structure->size        = size;
+
+	check_handle->number_of_structures += 1;
+
+	return( 1 );
+}
+
+/* Reads the locations of the structures to be checked
+ * The first superblock and bucket descriptor block copy that can be read is used
+ * to determine the locations of the buckets and RRV buckets
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_read_structures(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "check_handle_read_structures";
+	off64_t file_offset              = 0;
+	size64_t size                    = 0;
+	uint8_t flags                    = 0;
+	uint8_t structure_type           = 0;
+	int copy_number                  = 0;
+	int number_of_structures         = 0;
+	int structure_index              = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->structure_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid check handle - structure map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle_open_file_io_handle(
+	     check_handle,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( check_handle->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_structure_map_initialize(
+	     &( check_handle->structure_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create structure map.",
+		 function );
+
+		goto on_error;
+	}
+	/* Without a readable file and database header the locations of the other structures are unknown
+	 */
+	if( libnsfdb_structure_map_read_file_io_handle(
+	     check_handle->structure_map,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read structure map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_structure_map_get_flags(
+	     check_handle->structure_map,
+	     &flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve structure map flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( flags & LIBNSFDB_STRUCTURE_MAP_FLAG_BUCKETS_MISSING ) != 0 )
+	{
+		check_handle->buckets_missing = 1;
+	}
+	if( ( flags & LIBNSFDB_STRUCTURE_MAP_FLAG_RRV_BUCKETS_MISSING ) != 0 )
+	{
+		check_handle->rrv_buckets_missing = 1;
+	}
+	if( libnsfdb_structure_map_get_number_of_structures(
+	     check_handle->structure_map,
+	     &number_of_structures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of structures.",
+		 function );
+
+		goto on_error;
+	}
+	/* The structures are appended in the order of the structure map
+	 * hence the index of a structure is the same in both
+	 */
+	for( structure_index = 0;
+	     structure_index < number_of_structures;
+	     structure_index++ )
+	{
+		if( libnsfdb_structure_map_get_structure(
+		     check_handle->structure_map,
+		     structure_index,
+		     &structure_type,
+		     &copy_number,
+		     &file_offset,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve structure: %d.",
+			 function,
+			 structure_index );
+
+			goto on_error;
+		}
+		if( check_handle_append_structure(
+		     check_handle,
+		     structure_type,
+		     copy_number,
+		     file_offset,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append structure: %d.",
+			 function,
+			 structure_index );
+
+			goto on_error;
+		}
+	}
+	if( check_handle_close_file_io_handle(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( check_handle->structure_map != NULL )
+	{
+		libnsfdb_structure_map_free(
+		 &( check_handle->structure_map ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Checks the structures in the file region of a segment
+ * Every segment uses its own file IO handle since a file IO handle cannot be shared between threads
+ * This function is used as a thread callback hence the result is stored in the segment
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_check_segment(
+     check_handle_segment_t *segment )
+{
+	check_handle_structure_t *structure = NULL;
+	check_handle_t *check_handle        = NULL;
+	static char *function               = "check_handle_check_segment";
+	size64_t number_of_bytes            = 0;
+	int result                          = 0;
+	int structure_index                 = 0;
+
+	if( segment == NULL )
+	{
+		return( -1 );
+	}
+	check_handle = segment->check_handle;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment - missing check handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( check_handle->abort != 0 )
+	{
+		segment->result = 1;
+
+		return( 1 );
+	}
+	if( check_handle_open_file_io_handle(
+	     check_handle,
+	     &( segment->file_io_handle ),
+	     &( segment->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file regions of the segments do not overlap hence every structure
+	 * is only changed by a single segment
+	 */
+	for( structure_index = 0;
+	     structure_index < check_handle->number_of_structures;
+	     structure_index++ )
+	{
+		if( check_handle->abort != 0 )
+		{
+			break;
+		}
+		structure = &( check_handle->structures[ structure_index ] );
+
+		if( ( structure->file_offset < segment->start_offset )
+		 || ( structure->file_offset >= segment->end_offset ) )
+		{
+			continue;
+		}
+		result = libnsfdb_structure_map_check_structure(
+		          check_handle->structure_map,
+		          segment->file_io_handle,
+		          structure_index,
+		          &( structure->problem ),
+		          &( structure->stored_checksum ),
+		          &( structure->calculated_checksum ),
+		          &number_of_bytes,
+		          &( segment->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check %s at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 check_handle_get_structure_type_string(
+			  structure->type ),
+			 structure->file_offset,
+			 structure->file_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			structure->status = CHECK_HANDLE_STRUCTURE_STATUS_CORRUPTED;
+		}
+		else
+		{
+			structure->status = CHECK_HANDLE_STRUCTURE_STATUS_VALID;
+		}
+		segment->number_of_bytes += number_of_bytes;
+		segment->number_of_structures += 1;
+	}
+	if( check_handle_close_file_io_handle(
+	     &( segment->file_io_handle ),
+	     &( segment->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	segment->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( segment->file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( segment->file_io_handle ),
+		 NULL );
+	}
+	segment->result = -1;
+
+	return( -1 );
+}
+
+/* Checks the structures of the input file
+ * The file is divided into a region per thread and every thread checks
+ * the structures that start in its region
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_check(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	check_handle_segment_t *segment = NULL;
+	static char *function           = "check_handle_check";
+	uint64_t end_time               = 0;
+	uint64_t start_time             = 0;
+	int number_of_segments          = 0;
+	int segment_index               = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->segments != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid check handle - segments value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle_get_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	if( check_handle_read_structures(
+	     check_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read structures.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_segments = check_handle->number_of_threads;
+
+	if( number_of_segments > check_handle->number_of_structures )
+	{
+		number_of_segments = check_handle->number_of_structures;
+	}
+	if( number_of_segments < 1 )
+	{
+		number_of_segments = 1;
+	}
+	check_handle->segments = (check_handle_segment_t *) memory_allocate(
+	                                                     sizeof( check_handle_segment_t ) * (size_t) number_of_segments );
+
+	if( check_handle->segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segments.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     check_handle->segments,
+	     0,
+	     sizeof( check_handle_segment_t ) * (size_t) number_of_segments ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segments.",
+		 function );
+
+		memory_free(
+		 check_handle->segments );
+
+		check_handle->segments = NULL;
+
+		goto on_error;
+	}
+	check_handle->number_of_segments = number_of_segments;
+
+	/* The last segment also covers the structures beyond the end of the file
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( check_handle->segments[ segment_index ] );
+
+		segment->check_handle = check_handle;
+		segment->start_offset = (off64_t) ( ( check_handle->file_size / number_of_segments ) * segment_index );
+
+		if( segment_index == ( number_of_segments - 1 ) )
+		{
+			segment->end_offset = INT64_MAX;
+		}
+		else
+		{
+			segment->end_offset = (off64_t) ( ( check_handle->file_size / number_of_segments ) * ( segment_index + 1 ) );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_segments > 1 )
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( check_handle->segments[ segment_index ] );
+
+			if( libcthreads_thread_create(
+			     &( segment->thread ),
+			     NULL,
+			     (int (*)(void *)) &check_handle_check_segment,
+			     (void *) segment,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( check_handle->segments[ segment_index ] );
+
+			if( libcthreads_thread_join(
+			     &( segment->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			check_handle_check_segment(
+			 &( check_handle->segments[ segment_index ] ) );
+		}
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( check_handle->segments[ segment_index ] );
+
+		if( segment->result != 1 )
+		{
+			/* Pass the error of the segment on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error         = segment->error;
+				segment->error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		check_handle->number_of_bytes += segment->number_of_bytes;
+	}
+	if( check_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	check_handle->check_time = end_time - start_time;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( check_handle->segments != NULL )
+	{
+		check_handle->abort = 1;
+
+		for( segment_index = 0;
+		     segment_index < check_handle->number_of_segments;
+		     segment_index++ )
+		{
+			if( check_handle->segments[ segment_index ].thread != NULL )
+			{
+				libcthreads_thread_join(
+				 &( check_handle->segments[ segment_index ].thread ),
+				 NULL );
+			}
+		}
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of corrupted structures
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_get_number_of_corrupted_structures(
+     check_handle_t *check_handle,
+     int *number_of_corrupted_structures,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_get_number_of_corrupted_structures";
+	int structure_index   = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_corrupted_structures == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of corrupted structures.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_corrupted_structures = 0;
+
+	for( structure_index = 0;
+	     structure_index < check_handle->number_of_structures;
+	     structure_index++ )
+	{
+		if( check_handle->structures[ structure_index ].status == CHECK_HANDLE_STRUCTURE_STATUS_CORRUPTED )
+		{
+			*number_of_corrupted_structures += 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a string representation of a structure type
+ */
+const char *check_handle_get_structure_type_string(
+             uint8_t type )
+{
+	switch( type )
+	{
+		case LIBNSFDB_STRUCTURE_TYPE_BUCKET_DESCRIPTOR_BLOCK:
+			return( "bucket descriptor block" );
+
+		case LIBNSFDB_STRUCTURE_TYPE_NON_SUMMARY_BUCKET:
+			return( "non-summary bucket" );
+
+		case LIBNSFDB_STRUCTURE_TYPE_RRV_BUCKET:
+			return( "RRV bucket" );
+
+		case LIBNSFDB_STRUCTURE_TYPE_SUMMARY_BUCKET:
+			return( "summary bucket" );
+
+		case LIBNSFDB_STRUCTURE_TYPE_SUPERBLOCK:
+			return( "superblock" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+/* Retrieves a string representation of a problem
+ */
+const char *check_handle_get_problem_string(
+             uint8_t problem )
+{
+	switch( problem )
+	{
+		case LIBNSFDB_STRUCTURE_PROBLEM_NONE:
+			return( "none" );
+
+		case LIBNSFDB_STRUCTURE_PROBLEM_READ_FAILED:
+			return( "read failed" );
+
+		case LIBNSFDB_STRUCTURE_PROBLEM_SIGNATURE:
+			return( "unsupported signature" );
+
+		case LIBNSFDB_STRUCTURE_PROBLEM_HEADER_SIZE:
+			return( "unsupported header size" );
+
+		case LIBNSFDB_STRUCTURE_PROBLEM_SIZE:
+			return( "size out of bounds" );
+
+		case LIBNSFDB_STRUCTURE_PROBLEM_HEADER_CHECKSUM:
+			return( "header checksum mismatch" );
+
+		case LIBNSFDB_STRUCTURE_PROBLEM_CHECKSUM:
+			return( "checksum mismatch" );
+
+		default:
+			break;
+	}
+	return( "unknown" );
+}
+
+/* Prints a string as a JSON string
+ */
+void check_handle_json_string_fprint(
+      check_handle_t *check_handle,
+      const system_character_t *string )
+{
+	size_t string_index = 0;
+
+	if( ( check_handle == NULL )
+	 || ( string == NULL ) )
+	{
+		return;
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "\"" );
+
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] == (system_character_t) '"' )
+		 || ( string[ string_index ] == (system_character_t) '\\' ) )
+		{
+			fprintf(
+			 check_handle->notify_stream,
+			 "\\" );
+		}
+		else if( ( string[ string_index ] >= 0 )
+		      && ( string[ string_index ] < 0x20 ) )
+		{
+			fprintf(
+			 check_handle->notify_stream,
+			 "\\u%04x",
+			 (unsigned int) string[ string_index ] );
+
+			continue;
+		}
+		fprintf(
+		 check_handle->notify_stream,
+		 "%" PRIc_SYSTEM "",
+		 string[ string_index ] );
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "\"" );
+}
+
+/* Prints the check report
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_report_fprint(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	uint8_t structure_types[ 5 ] = {
+		LIBNSFDB_STRUCTURE_TYPE_SUPERBLOCK,
+		LIBNSFDB_STRUCTURE_TYPE_BUCKET_DESCRIPTOR_BLOCK,
+		LIBNSFDB_STRUCTURE_TYPE_RRV_BUCKET,
+		LIBNSFDB_STRUCTURE_TYPE_SUMMARY_BUCKET,
+		LIBNSFDB_STRUCTURE_TYPE_NON_SUMMARY_BUCKET };
+
+	check_handle_structure_t *structure = NULL;
+	static char *function               = "check_handle_report_fprint";
+	uint64_t throughput                 = 0;
+	int number_of_checked_structures    = 0;
+	int number_of_corrupted_structures  = 0;
+	int structure_index                 = 0;
+	int type_index                      = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "Integrity check:\n" );
+
+	for( type_index = 0;
+	     type_index < 5;
+	     type_index++ )
+	{
+		number_of_checked_structures   = 0;
+		number_of_corrupted_structures = 0;
+
+		for( structure_index = 0;
+		     structure_index < check_handle->number_of_structures;
+		     structure_index++ )
+		{
+			structure = &( check_handle->structures[ structure_index ] );
+
+			if( structure->type != structure_types[ type_index ] )
+			{
+				continue;
+			}
+			if( structure->status != CHECK_HANDLE_STRUCTURE_STATUS_UNCHECKED )
+			{
+				number_of_checked_structures += 1;
+			}
+			if( structure->status == CHECK_HANDLE_STRUCTURE_STATUS_CORRUPTED )
+			{
+				number_of_corrupted_structures += 1;
+			}
+		}
+		fprintf(
+		 check_handle->notify_stream,
+		 "\t%-24s: %d checked, %d corrupted\n",
+		 check_handle_get_structure_type_string(
+		  structure_types[ type_index ] ),
+		 number_of_checked_structures,
+		 number_of_corrupted_structures );
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tNumber of threads\t: %d\n",
+	 check_handle->number_of_segments );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tNumber of bytes read\t: %" PRIu64 "\n",
+	 check_handle->number_of_bytes );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tTime\t\t\t: %" PRIu64 ".%06" PRIu64 " seconds\n",
+	 check_handle->check_time / 1000000,
+	 check_handle->check_time % 1000000 );
+
+	/* The number of bytes per micro second equals the number of MB (10^6 bytes) per second
+	 */
+	if( check_handle->check_time > 0 )
+	{
+		throughput = ( check_handle->number_of_bytes * 10 ) / check_handle->check_time;
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "\tThroughput\t\t: %" PRIu64 ".%" PRIu64 " MB/s\n",
+	 throughput / 10,
+	 throughput % 10 );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "\n" );
+
+	if( check_handle->buckets_missing != 0 )
+	{
+		fprintf(
+		 check_handle->notify_stream,
+		 "No superblock could be read, the summary and non-summary buckets were not checked.\n\n" );
+	}
+	if( check_handle->rrv_buckets_missing != 0 )
+	{
+		fprintf(
+		 check_handle->notify_stream,
+		 "No bucket descriptor block could be read, the RRV buckets were not checked.\n\n" );
+	}
+	if( check_handle_get_number_of_corrupted_structures(
+	     check_handle,
+	     &number_of_corrupted_structures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of corrupted structures.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_corrupted_structures == 0 )
+	{
+		fprintf(
+		 check_handle->notify_stream,
+		 "No corrupted structures found.\n\n" );
+
+		return( 1 );
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "Corrupted structures:\n" );
+
+	for( structure_index = 0;
+	     structure_index < check_handle->number_of_structures;
+	     structure_index++ )
+	{
+		structure = &( check_handle->structures[ structure_index ] );
+
+		if( structure->status != CHECK_HANDLE_STRUCTURE_STATUS_CORRUPTED )
+		{
+			continue;
+		}
+		fprintf(
+		 check_handle->notify_stream,
+		 "\t%s",
+		 check_handle_get_structure_type_string(
+		  structure->type ) );
+
+		if( structure->copy_number != 0 )
+		{
+			fprintf(
+			 check_handle->notify_stream,
+			 " %d",
+			 structure->copy_number );
+		}
+		fprintf(
+		 check_handle->notify_stream,
+		 " at offset: %" PRIi64 " (0x%08" PRIx64 "): %s",
+		 structure->file_offset,
+		 structure->file_offset,
+		 check_handle_get_problem_string(
+		  structure->problem ) );
+
+		if( ( structure->problem == LIBNSFDB_STRUCTURE_PROBLEM_HEADER_CHECKSUM )
+		 || ( structure->problem == LIBNSFDB_STRUCTURE_PROBLEM_CHECKSUM ) )
+		{
+			fprintf(
+			 check_handle->notify_stream,
+			 " (stored: 0x%08" PRIx32 ", calculated: 0x%08" PRIx32 ")",
+			 structure->stored_checksum,
+			 structure->calculated_checksum );
+		}
+		fprintf(
+		 check_handle->notify_stream,
+		 "\n" );
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Prints the check report as a JSON document
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_report_json_fprint(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	check_handle_structure_t *structure = NULL;
+	static char *function               = "check_handle_report_json_fprint";
+	uint64_t throughput                 = 0;
+	int number_of_corrupted_structures  = 0;
+	int structure_index                 = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid check handle - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle_get_number_of_corrupted_structures(
+	     check_handle,
+	     &number_of_corrupted_structures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of corrupted structures.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->check_time > 0 )
+	{
+		throughput = ( check_handle->number_of_bytes * 10 ) / check_handle->check_time;
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "{\n" );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"filename\": " );
+
+	check_handle_json_string_fprint(
+	 check_handle,
+	 check_handle->filename );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 ",\n" );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"file_size\": %" PRIu64 ",\n",
+	 check_handle->file_size );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"number_of_threads\": %d,\n",
+	 check_handle->number_of_segments );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"number_of_structures\": %d,\n",
+	 check_handle->number_of_structures );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"number_of_corrupted_structures\": %d,\n",
+	 number_of_corrupted_structures );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"buckets_checked\": %s,\n",
+	 ( check_handle->buckets_missing == 0 ) ? "true" : "false" );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"rrv_buckets_checked\": %s,\n",
+	 ( check_handle->rrv_buckets_missing == 0 ) ? "true" : "false" );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"number_of_bytes\": %" PRIu64 ",\n",
+	 check_handle->number_of_bytes );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"check_time\": %" PRIu64 ",\n",
+	 check_handle->check_time );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"throughput\": %" PRIu64 ".%" PRIu64 ",\n",
+	 throughput / 10,
+	 throughput % 10 );
+
+	fprintf(
+	 check_handle->notify_stream,
+	 "  \"corrupted_structures\": [" );
+
+	number_of_corrupted_structures = 0;
+
+	for( structure_index = 0;
+	     structure_index < check_handle->number_of_structures;
+	     structure_index++ )
+	{
+		structure = &( check_handle->structures[ structure_index ] );
+
+		if( structure->status != CHECK_HANDLE_STRUCTURE_STATUS_CORRUPTED )
+		{
+			continue;
+		}
+		if( number_of_corrupted_structures > 0 )
+		{
+			fprintf(
+			 check_handle->notify_stream,
+			 "," );
+		}
+		fprintf(
+		 check_handle->notify_stream,
+		 "\n    {\n"
+		 "      \"type\": \"%s\",\n"
+		 "      \"copy_number\": %d,\n"
+		 "      \"offset\": %" PRIi64 ",\n"
+		 "      \"problem\": \"%s\",\n"
+		 "      \"stored_checksum\": %" PRIu32 ",\n"
+		 "      \"calculated_checksum\": %" PRIu32 "\n"
+		 "    }",
+		 check_handle_get_structure_type_string(
+		  structure->type ),
+		 structure->copy_number,
+		 structure->file_offset,
+		 check_handle_get_problem_string(
+		  structure->problem ),
+		 structure->stored_checksum,
+		 structure->calculated_checksum );
+
+		number_of_corrupted_structures += 1;
+	}
+	if( number_of_corrupted_structures > 0 )
+	{
+		fprintf(
+		 check_handle->notify_stream,
+		 "\n  " );
+	}
+	fprintf(
+	 check_handle->notify_stream,
+	 "]\n"
+	 "}\n" );
+
+	return( 1 );
+}
+
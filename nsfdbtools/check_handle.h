@@ -0,0 +1,282 @@
+/*
+ * Check handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CHECK_HANDLE_H )
+#define _CHECK_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "nsfdbtools_libbfio.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcthreads.h"
+#include "nsfdbtools_libnsfdb.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of threads
+ */
+#define CHECK_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+
+enum CHECK_HANDLE_STRUCTURE_STATUSES
+{
+	CHECK_HANDLE_STRUCTURE_STATUS_UNCHECKED			= 0,
+	CHECK_HANDLE_STRUCTURE_STATUS_VALID			= 1,
+	CHECK_HANDLE_STRUCTURE_STATUS_CORRUPTED			= 2
+};
+
+typedef struct check_handle_structure check_handle_structure_t;
+
+struct check_handle_structure
+{
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The number of the copy, used for the superblocks and bucket descriptor blocks
+	 */
+	int copy_number;
+
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The size, where 0 represents a size that is stored in the header
+	 */
+	size64_t size;
+
+	/* The status
+	 */
+	uint8_t status;
+
+	/* The problem
+	 */
+	uint8_t problem;
+
+	/* The stored checksum
+	 */
+	uint32_t stored_checksum;
+
+	/* The calculated checksum
+	 */
+	uint32_t calculated_checksum;
+};
+
+typedef struct check_handle check_handle_t;
+
+typedef struct check_handle_segment check_handle_segment_t;
+
+struct check_handle_segment
+{
+	/* The check handle
+	 */
+	check_handle_t *check_handle;
+
+	/* The start offset of the file region
+	 */
+	off64_t start_offset;
+
+	/* The end offset of the file region
+	 */
+	off64_t end_offset;
+
+	/* The number of structures checked
+	 */
+	int number_of_structures;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The number of bytes read
+	 */
+	size64_t number_of_bytes;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+struct check_handle
+{
+	/* The input filename
+	 */
+	const system_character_t *filename;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* Value to indicate the report is printed as a JSON document
+	 */
+	uint8_t json_output;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The structure map
+	 */
+	libnsfdb_structure_map_t *structure_map;
+
+	/* The structures
+	 */
+	check_handle_structure_t *structures;
+
+	/* The number of structures
+	 */
+	int number_of_structures;
+
+	/* The maximum number of structures
+	 */
+	int maximum_number_of_structures;
+
+	/* Value to indicate the bucket lists could not be read
+	 * hence the buckets were not checked
+	 */
+	uint8_t buckets_missing;
+
+	/* Value to indicate the RRV bucket descriptors could not be read
+	 * hence the RRV buckets were not checked
+	 */
+	uint8_t rrv_buckets_missing;
+
+	/* The segments
+	 */
+	check_handle_segment_t *segments;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The number of bytes read
+	 */
+	size64_t number_of_bytes;
+
+	/* The time spent checking, in micro seconds
+	 */
+	uint64_t check_time;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int check_handle_initialize(
+     check_handle_t **check_handle,
+     libcerror_error_t **error );
+
+int check_handle_free(
+     check_handle_t **check_handle,
+     libcerror_error_t **error );
+
+int check_handle_signal_abort(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+int check_handle_copy_from_decimal_string(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int check_handle_set_number_of_threads(
+     check_handle_t *check_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int check_handle_get_time(
+     uint64_t *time_value,
+     libcerror_error_t **error );
+
+int check_handle_open_file_io_handle(
+     check_handle_t *check_handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int check_handle_close_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int check_handle_append_structure(
+     check_handle_t *check_handle,
+     uint8_t type,
+     int copy_number,
+     off64_t file_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int check_handle_read_structures(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+int check_handle_check_segment(
+     check_handle_segment_t *segment );
+
+int check_handle_check(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+int check_handle_get_number_of_corrupted_structures(
+     check_handle_t *check_handle,
+     int *number_of_corrupted_structures,
+     libcerror_error_t **error );
+
+const char *check_handle_get_structure_type_string(
+             uint8_t type );
+
+const char *check_handle_get_problem_string(
+             uint8_t problem );
+
+void check_handle_json_string_fprint(
+      check_handle_t *check_handle,
+      const system_character_t *string );
+
+int check_handle_report_fprint(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+int check_handle_report_json_fprint(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CHECK_HANDLE_H ) */
+
@@ -28,6 +28,7 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "arrow_writer.h"
 #include "export_handle.h"
 #include "nsfdbtools_libcerror.h"
 #include "nsfdbtools_libcfile.h"
@@ -35,10 +36,54 @@
 #include "nsfdbtools_libcpath.h"
 #include "nsfdbtools_libfdatetime.h"
 #include "nsfdbtools_libnsfdb.h"
+#include "nsfdbtools_unused.h"
+#include "output_writer.h"
 
 #define EXPORT_HANDLE_BUFFER_SIZE	8192
 #define EXPORT_HANDLE_NOTIFY_STREAM	stdout
 
+/* The number of notes of which the buckets are prefetched at once
+ */
+#define EXPORT_HANDLE_NUMBER_OF_PREFETCH_NOTES	256
+
+/* The size of the buffer of the output writer
+ */
+#define EXPORT_HANDLE_OUTPUT_BUFFER_SIZE	( 1024 * 1024 )
+
+/* The size of the value data buffer, which fits the largest value name and data
+ */
+#define EXPORT_HANDLE_VALUE_DATA_SIZE		( UINT16_MAX + 1 )
+
+/* The maximum number of notes in an Arrow record batch
+ */
+#define EXPORT_HANDLE_ARROW_NUMBER_OF_ROWS	16384
+
+/* The number of Arrow columns that contain the note header values
+ * The columns of the item names follow these columns
+ */
+#define EXPORT_HANDLE_NUMBER_OF_ARROW_HEADER_COLUMNS	6
+
+/* The minimum number of notes between stored resume states
+ */
+#define EXPORT_HANDLE_RESUME_STATE_INTERVAL		1024
+
+/* The maximum number of shards
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_SHARDS		9999
+
+/* The minimum size of the value data that is stored as a blob
+ * Smaller value data is written as hexadecimal digits
+ * Note that only the data of summary items is available
+ */
+#define EXPORT_HANDLE_MINIMUM_BLOB_DATA_SIZE		4096
+
+/* The note classes of the design notes
+ */
+#define EXPORT_HANDLE_DESIGN_NOTE_CLASSES \
+	( LIBNSFDB_NOTE_CLASS_INFO | LIBNSFDB_NOTE_CLASS_FORM | LIBNSFDB_NOTE_CLASS_VIEW | LIBNSFDB_NOTE_CLASS_ICON \
+	| LIBNSFDB_NOTE_CLASS_DESIGN | LIBNSFDB_NOTE_CLASS_ACL | LIBNSFDB_NOTE_CLASS_HELP_INDEX | LIBNSFDB_NOTE_CLASS_HELP \
+	| LIBNSFDB_NOTE_CLASS_FILTER | LIBNSFDB_NOTE_CLASS_FIELD | LIBNSFDB_NOTE_CLASS_REPLFORMULA | LIBNSFDB_NOTE_CLASS_PRIVATE )
+
 /* Creates an export handle
  * Make sure the value export_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -112,7 +157,9 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
-	( *export_handle )->notify_stream = EXPORT_HANDLE_NOTIFY_STREAM;
+	( *export_handle )->export_mode      = EXPORT_HANDLE_MODE_ITEMS;
+	( *export_handle )->number_of_shards = 1;
+	( *export_handle )->notify_stream    = EXPORT_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
 
@@ -163,6 +210,22 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( ( *export_handle )->note_filter != NULL )
+		{
+			if( libnsfdb_note_filter_free(
+			     &( ( *export_handle )->note_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free note filter.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *export_handle )->target_path != NULL )
 		{
 			memory_free(
@@ -173,6 +236,90 @@ int export_handle_free(
 			memory_free(
 			 ( *export_handle )->items_export_path );
 		}
+		if( ( *export_handle )->output_writer != NULL )
+		{
+			if( output_writer_free(
+			     &( ( *export_handle )->output_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->arrow_writer != NULL )
+		{
+			if( arrow_writer_free(
+			     &( ( *export_handle )->arrow_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free Arrow writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->item_names != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->item_names );
+		}
+		if( ( *export_handle )->value_data != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->value_data );
+		}
+		if( ( *export_handle )->blob_store != NULL )
+		{
+			if( blob_store_free(
+			     &( ( *export_handle )->blob_store ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free blob store.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->resume_state != NULL )
+		{
+			if( resume_state_free(
+			     &( ( *export_handle )->resume_state ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free resume state.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->resume_state_path != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->resume_state_path );
+		}
+		if( ( *export_handle )->temporary_resume_state_path != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->temporary_resume_state_path );
+		}
 		memory_free(
 		 *export_handle );
 
@@ -364,20 +511,19 @@ on_error:
 	return( -1 );
 }
 
-/* Sets an export path consisting of a base path and a suffix
+/* Sets the checkpoint
+ * The checkpoint is a decimal representation of a 64-bit NSF timedate value
  * Returns 1 if successful or -1 on error
  */
-int export_handle_set_export_path(
+int export_handle_set_checkpoint(
      export_handle_t *export_handle,
-     const system_character_t *base_path,
-     size_t base_path_length,
-     const system_character_t *suffix,
-     size_t suffix_length,
-     system_character_t **export_path,
-     size_t *export_path_size,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_set_export_path";
+	static char *function = "export_handle_set_checkpoint";
+	size_t string_index   = 0;
+	uint64_t digit        = 0;
+	uint64_t value_64bit  = 0;
 
 	if( export_handle == NULL )
 	{
@@ -390,148 +536,247 @@ int export_handle_set_export_path(
 
 		return( -1 );
 	}
-	if( base_path == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid base path.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	if( base_path_length > (size_t) SSIZE_MAX )
+	if( string[ 0 ] == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid base path length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string value too small.",
 		 function );
 
 		return( -1 );
 	}
-	if( suffix == NULL )
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		digit = (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( value_64bit > ( ( UINT64_MAX - digit ) / 10 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		value_64bit *= 10;
+		value_64bit += digit;
+	}
+	export_handle->checkpoint     = value_64bit;
+	export_handle->use_checkpoint = 1;
+
+	return( 1 );
+}
+
+/* Sets the note classes to export
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_note_classes(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function    = "export_handle_set_note_classes";
+	size_t string_length     = 0;
+	uint16_t note_class_mask = 0;
+	int result               = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid suffix.",
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( suffix_length > (size_t) SSIZE_MAX )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid suffix length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_path == NULL )
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "all" ),
+		     3 ) == 0 )
+		{
+			note_class_mask = 0;
+			result          = 1;
+		}
+	}
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "design" ),
+		     6 ) == 0 )
+		{
+			note_class_mask = EXPORT_HANDLE_DESIGN_NOTE_CLASSES;
+			result          = 1;
+		}
+	}
+	else if( string_length == 9 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "documents" ),
+		     9 ) == 0 )
+		{
+			note_class_mask = LIBNSFDB_NOTE_CLASS_DOCUMENT;
+			result          = 1;
+		}
+	}
+	if( result != 1 )
+	{
+		return( result );
+	}
+	if( export_handle_set_note_class_mask(
+	     export_handle,
+	     note_class_mask,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set note class mask.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_path_size == NULL )
+	return( 1 );
+}
+
+/* Sets the note class mask of the note filter
+ * A note class mask of 0 removes the note filter
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_note_class_mask(
+     export_handle_t *export_handle,
+     uint16_t note_class_mask,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_note_class_mask";
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export path size.",
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( *export_path != NULL )
+	if( note_class_mask == 0 )
 	{
-		memory_free(
-		 *export_path );
-
-		*export_path      = NULL;
-		*export_path_size = 0;
-	}
-	*export_path_size = base_path_length + suffix_length + 1;
-
-	*export_path = system_string_allocate(
-	                *export_path_size );
+		if( export_handle->note_filter != NULL )
+		{
+			if( libnsfdb_note_filter_free(
+			     &( export_handle->note_filter ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free note filter.",
+				 function );
 
-	if( *export_path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create export path.",
-		 function );
+				return( -1 );
+			}
+		}
+		export_handle->note_class_mask = 0;
 
-		goto on_error;
+		return( 1 );
 	}
-	if( system_string_copy(
-	     *export_path,
-	     base_path,
-	     base_path_length ) == NULL )
+	if( export_handle->note_filter == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy base path to item export path.",
-		 function );
+		if( libnsfdb_note_filter_initialize(
+		     &( export_handle->note_filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create note filter.",
+			 function );
 
-		goto on_error;
+			return( -1 );
+		}
 	}
-	if( system_string_copy(
-	     &( ( *export_path )[ base_path_length ] ),
-	     suffix,
-	     suffix_length ) == NULL )
+	if( libnsfdb_note_filter_set_note_class_mask(
+	     export_handle->note_filter,
+	     note_class_mask,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy suffix to item export path.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set note class mask.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	( *export_path )[ *export_path_size - 1 ] = 0;
+	export_handle->note_class_mask = note_class_mask;
 
 	return( 1 );
-
-on_error:
-	if( *export_path != NULL )
-	{
-		memory_free(
-		 *export_path );
-
-		*export_path      = NULL;
-		*export_path_size = 0;
-	}
-	return( -1 );
 }
 
-/* Creates the items export path
- * Returns 1 if successful, 0 if already exists or -1 on error
+/* Sets the export mode
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_create_items_export_path(
+int export_handle_set_export_mode(
      export_handle_t *export_handle,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_create_items_export_path";
+	static char *function = "export_handle_set_export_mode";
+	size_t string_length  = 0;
 	int result            = 0;
 
 	if( export_handle == NULL )
@@ -545,62 +790,63 @@ int export_handle_create_items_export_path(
 
 		return( -1 );
 	}
-	if( export_handle_set_export_path(
-	     export_handle,
-	     export_handle->target_path,
-	     export_handle->target_path_size - 1,
-	     _SYSTEM_STRING( ".export" ),
-	     7,
-	     &( export_handle->items_export_path ),
-	     &( export_handle->items_export_path_size ),
-	     error ) != 1 )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set items export path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcfile_file_exists_wide(
-		  export_handle->items_export_path,
-		  error );
-#else
-	result = libcfile_file_exists(
-		  export_handle->items_export_path,
-		  error );
-#endif
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
-		 function,
-		 export_handle->items_export_path );
+	string_length = system_string_length(
+	                 string );
 
-		return( -1 );
-	}
-	else if( result == 1 )
+	if( string_length == 5 )
 	{
-		return( 0 );
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "arrow" ),
+		     5 ) == 0 )
+		{
+			export_handle->export_mode = EXPORT_HANDLE_MODE_ARROW;
+			result                     = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "items" ),
+		          5 ) == 0 )
+		{
+			export_handle->export_mode = EXPORT_HANDLE_MODE_ITEMS;
+			result                     = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "jsonl" ),
+		          5 ) == 0 )
+		{
+			export_handle->export_mode = EXPORT_HANDLE_MODE_JSON_LINES;
+			result                     = 1;
+		}
 	}
-	return( 1 );
+	return( result );
 }
 
-/* Opens the input
+/* Sets the names of the items that are exported as columns in the Arrow export mode
+ * The string contains the item names separated by a comma
  * Returns 1 if successful or -1 on error
  */
-int export_handle_open_input(
+int export_handle_set_item_names(
      export_handle_t *export_handle,
-     const system_character_t *filename,
+     const char *string,
+     size_t string_length,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_open_input";
+	static char *function = "export_handle_set_item_names";
+	size_t name_length    = 0;
+	size_t string_index   = 0;
 
 	if( export_handle == NULL )
 	{
@@ -613,41 +859,3095 @@ int export_handle_open_input(
 
 		return( -1 );
 	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length == 0 )
+	 || ( string_length > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->item_names != NULL )
+	{
+		memory_free(
+		 export_handle->item_names );
+
+		export_handle->item_names           = NULL;
+		export_handle->item_names_size      = 0;
+		export_handle->number_of_item_names = 0;
+	}
+	export_handle->item_names = narrow_string_allocate(
+	                             string_length + 1 );
+
+	if( export_handle->item_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item names.",
+		 function );
+
+		return( -1 );
+	}
+	/* The separators are replaced by end-of-string characters and empty names are skipped
+	 */
+	for( string_index = 0;
+	     string_index <= string_length;
+	     string_index++ )
+	{
+		if( ( string_index < string_length )
+		 && ( string[ string_index ] != ',' ) )
+		{
+			export_handle->item_names[ export_handle->item_names_size++ ] = string[ string_index ];
+
+			name_length++;
+		}
+		else if( name_length > 0 )
+		{
+			export_handle->item_names[ export_handle->item_names_size++ ] = 0;
+
+			export_handle->number_of_item_names += 1;
+
+			name_length = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the shard
+ * The shard is a string formatted as k/n, where n is the number of shards and k the shard
+ * to export, where 1 <= k <= n. The notes are partitioned deterministically into n disjoint
+ * ranges so that the shards can be exported by separate processes
+ * The shard is appended to the target path so that the shards do not overlap
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_shard(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	system_character_t suffix[ 32 ];
+
+	system_character_t *target_path = NULL;
+	static char *function           = "export_handle_set_shard";
+	size_t string_index             = 0;
+	size_t target_path_size         = 0;
+	int number_of_shards            = 0;
+	int print_count                 = 0;
+	int shard_number                = 0;
+	int value                       = 0;
+	int value_index                 = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		value = 0;
+
+		while( ( string[ string_index ] >= (system_character_t) '0' )
+		    && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			value *= 10;
+			value += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+			if( value > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_SHARDS )
+			{
+				return( 0 );
+			}
+			string_index++;
+		}
+		if( value_index == 0 )
+		{
+			if( string[ string_index ] != (system_character_t) '/' )
+			{
+				return( 0 );
+			}
+			shard_number = value;
+
+			string_index++;
+		}
+		else
+		{
+			if( string[ string_index ] != 0 )
+			{
+				return( 0 );
+			}
+			number_of_shards = value;
+		}
+	}
+	if( ( shard_number == 0 )
+	 || ( shard_number > number_of_shards ) )
+	{
+		return( 0 );
+	}
+	print_count = system_string_sprintf(
+	               suffix,
+	               32,
+	               _SYSTEM_STRING( ".shard%d-of-%d" ),
+	               shard_number,
+	               number_of_shards );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set shard suffix.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_set_export_path(
+	     export_handle,
+	     export_handle->target_path,
+	     export_handle->target_path_size - 1,
+	     suffix,
+	     (size_t) print_count,
+	     &target_path,
+	     &target_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set shard target path.",
+		 function );
+
+		return( -1 );
+	}
+	memory_free(
+	 export_handle->target_path );
+
+	export_handle->target_path      = target_path;
+	export_handle->target_path_size = target_path_size;
+	export_handle->shard_index      = shard_number - 1;
+	export_handle->number_of_shards = number_of_shards;
+
+	return( 1 );
+}
+
+/* Copies the export options of another export handle
+ * The export options are the export mode, checkpoint, note classes and item names
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_copy_options(
+     export_handle_t *destination_export_handle,
+     export_handle_t *source_export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_copy_options";
+
+	if( destination_export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_export_handle->item_names != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination export handle - item names value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_set_note_class_mask(
+	     destination_export_handle,
+	     source_export_handle->note_class_mask,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set note class mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_export_handle->item_names != NULL )
+	{
+		destination_export_handle->item_names = narrow_string_allocate(
+		                                         source_export_handle->item_names_size );
+
+		if( destination_export_handle->item_names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create item names.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     destination_export_handle->item_names,
+		     source_export_handle->item_names,
+		     source_export_handle->item_names_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy item names.",
+			 function );
+
+			memory_free(
+			 destination_export_handle->item_names );
+
+			destination_export_handle->item_names = NULL;
+
+			return( -1 );
+		}
+		destination_export_handle->item_names_size      = source_export_handle->item_names_size;
+		destination_export_handle->number_of_item_names = source_export_handle->number_of_item_names;
+	}
+	destination_export_handle->export_mode     = source_export_handle->export_mode;
+	destination_export_handle->use_checkpoint  = source_export_handle->use_checkpoint;
+	destination_export_handle->checkpoint      = source_export_handle->checkpoint;
+	destination_export_handle->blob_store_path = source_export_handle->blob_store_path;
+
+	return( 1 );
+}
+
+/* Sets an export path consisting of a base path and a suffix
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_export_path(
+     export_handle_t *export_handle,
+     const system_character_t *base_path,
+     size_t base_path_length,
+     const system_character_t *suffix,
+     size_t suffix_length,
+     system_character_t **export_path,
+     size_t *export_path_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_export_path";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base path.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( suffix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid suffix.",
+		 function );
+
+		return( -1 );
+	}
+	if( suffix_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid suffix length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_path != NULL )
+	{
+		memory_free(
+		 *export_path );
+
+		*export_path      = NULL;
+		*export_path_size = 0;
+	}
+	*export_path_size = base_path_length + suffix_length + 1;
+
+	*export_path = system_string_allocate(
+	                *export_path_size );
+
+	if( *export_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     *export_path,
+	     base_path,
+	     base_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy base path to item export path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( ( *export_path )[ base_path_length ] ),
+	     suffix,
+	     suffix_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy suffix to item export path.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_path )[ *export_path_size - 1 ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( *export_path != NULL )
+	{
+		memory_free(
+		 *export_path );
+
+		*export_path      = NULL;
+		*export_path_size = 0;
+	}
+	return( -1 );
+}
+
+/* Creates the items export path
+ * Returns 1 if successful, 0 if already exists or -1 on error
+ */
+int export_handle_create_items_export_path(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	const system_character_t *suffix = NULL;
+	static char *function            = "export_handle_create_items_export_path";
+	size_t suffix_length             = 0;
+	int result                       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_mode == EXPORT_HANDLE_MODE_ARROW )
+	{
+		suffix        = _SYSTEM_STRING( ".arrows" );
+		suffix_length = 7;
+	}
+	else if( export_handle->export_mode == EXPORT_HANDLE_MODE_JSON_LINES )
+	{
+		suffix        = _SYSTEM_STRING( ".jsonl" );
+		suffix_length = 6;
+	}
+	else
+	{
+		suffix        = _SYSTEM_STRING( ".export" );
+		suffix_length = 7;
+	}
+	if( export_handle_set_export_path(
+	     export_handle,
+	     export_handle->target_path,
+	     export_handle->target_path_size - 1,
+	     suffix,
+	     suffix_length,
+	     &( export_handle->items_export_path ),
+	     &( export_handle->items_export_path_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set items export path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+		  export_handle->items_export_path,
+		  error );
+#else
+	result = libcfile_file_exists(
+		  export_handle->items_export_path,
+		  error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+		 function,
+		 export_handle->items_export_path );
+
+		return( -1 );
+	}
+	else if( result == 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads the resume state that is stored next to the target path
+ * The resume state is initialized from the export options if no resume state was stored
+ * Returns 1 if successful, 0 if no resume state was stored or -1 on error
+ */
+int export_handle_read_resume_state(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_read_resume_state";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->resume_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - resume state value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_set_export_path(
+	     export_handle,
+	     export_handle->target_path,
+	     export_handle->target_path_size - 1,
+	     _SYSTEM_STRING( ".resume" ),
+	     7,
+	     &( export_handle->resume_state_path ),
+	     &( export_handle->resume_state_path_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resume state path.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_set_export_path(
+	     export_handle,
+	     export_handle->target_path,
+	     export_handle->target_path_size - 1,
+	     _SYSTEM_STRING( ".resume.tmp" ),
+	     11,
+	     &( export_handle->temporary_resume_state_path ),
+	     &( export_handle->temporary_resume_state_path_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set temporary resume state path.",
+		 function );
+
+		return( -1 );
+	}
+	if( resume_state_initialize(
+	     &( export_handle->resume_state ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize resume state.",
+		 function );
+
+		return( -1 );
+	}
+	result = resume_state_read(
+	          export_handle->resume_state,
+	          export_handle->resume_state_path,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read resume state: %" PRIs_SYSTEM ".",
+		 function,
+		 export_handle->resume_state_path );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		export_handle->resume_state->export_mode        = export_handle->export_mode;
+		export_handle->resume_state->note_class_mask    = export_handle->note_class_mask;
+		export_handle->resume_state->use_checkpoint     = export_handle->use_checkpoint;
+		export_handle->resume_state->initial_checkpoint = export_handle->checkpoint;
+		export_handle->resume_state->checkpoint         = export_handle->checkpoint;
+
+		if( resume_state_set_item_names(
+		     export_handle->resume_state,
+		     export_handle->item_names,
+		     export_handle->item_names_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set item names of resume state.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	/* Only an export with the same options can be resumed
+	 */
+	if( export_handle->resume_state->export_mode != export_handle->export_mode )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: export mode of resume state does not match.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( export_handle->resume_state->use_checkpoint != export_handle->use_checkpoint )
+	 || ( export_handle->resume_state->initial_checkpoint != export_handle->checkpoint ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: checkpoint of resume state does not match.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->resume_state->note_class_mask != export_handle->note_class_mask )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: note classes of resume state do not match.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->resume_state->item_names_size != export_handle->item_names_size )
+	{
+		result = 0;
+	}
+	else if( export_handle->item_names_size == 0 )
+	{
+		result = 1;
+	}
+	else
+	{
+		result = ( memory_compare(
+		            export_handle->resume_state->item_names,
+		            export_handle->item_names,
+		            export_handle->item_names_size ) == 0 );
+	}
+	if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: item names of resume state do not match.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->number_of_exported_notes = export_handle->resume_state->number_of_exported_notes;
+	export_handle->stored_note_index        = export_handle->resume_state->next_note_index;
+	export_handle->is_resumed               = 1;
+
+	return( 1 );
+
+on_error:
+	resume_state_free(
+	 &( export_handle->resume_state ),
+	 NULL );
+
+	return( -1 );
+}
+
+/* Stores the resume state
+ * The resume state is stored periodically and only when the output contains
+ * complete notes, which in the Arrow export mode is after a record batch was written
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_store_resume_state(
+     export_handle_t *export_handle,
+     int next_note_index,
+     int number_of_notes,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_store_resume_state";
+	off64_t output_offset = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->resume_state == NULL )
+	{
+		return( 1 );
+	}
+	if( ( next_note_index - export_handle->stored_note_index ) < EXPORT_HANDLE_RESUME_STATE_INTERVAL )
+	{
+		return( 1 );
+	}
+	if( export_handle->arrow_writer != NULL )
+	{
+		if( export_handle->arrow_writer->number_of_rows != 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( ( export_handle->output_writer != NULL )
+	 && ( export_handle->export_mode != EXPORT_HANDLE_MODE_ITEMS ) )
+	{
+		/* The buffered data is written first so that the output offset
+		 * corresponds to the data that is stored in the file
+		 */
+		if( output_writer_flush(
+		     export_handle->output_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output writer.",
+			 function );
+
+			return( -1 );
+		}
+		if( output_writer_get_offset(
+		     export_handle->output_writer,
+		     &output_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve output offset.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	export_handle->resume_state->checkpoint               = export_handle->checkpoint;
+	export_handle->resume_state->has_failed_notes         = export_handle->has_failed_notes;
+	export_handle->resume_state->number_of_notes          = number_of_notes;
+	export_handle->resume_state->next_note_index          = next_note_index;
+	export_handle->resume_state->number_of_exported_notes = export_handle->number_of_exported_notes;
+	export_handle->resume_state->output_offset            = output_offset;
+
+	if( resume_state_write(
+	     export_handle->resume_state,
+	     export_handle->resume_state_path,
+	     export_handle->temporary_resume_state_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write resume state: %" PRIs_SYSTEM ".",
+		 function,
+		 export_handle->resume_state_path );
+
+		return( -1 );
+	}
+	export_handle->stored_note_index = next_note_index;
+
+	return( 1 );
+}
+
+/* Retrieves the range of the notes to export
+ * The range contains the notes of the shard and starts at the next note
+ * of the resume state if the export is resumed
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_note_range(
+     export_handle_t *export_handle,
+     int number_of_notes,
+     int *first_note_index,
+     int *end_note_index,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_note_range";
+	int shard_end_index   = 0;
+	int shard_start_index = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->number_of_shards < 1 )
+	 || ( export_handle->number_of_shards > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_SHARDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of shards value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->shard_index < 0 )
+	 || ( export_handle->shard_index >= export_handle->number_of_shards ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_notes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of notes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first note index.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_note_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end note index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The notes are ordered by their RRV identifier, hence the shards
+	 * consist of consecutive ranges of the RRV buckets
+	 */
+	shard_start_index = (int) ( ( (int64_t) number_of_notes * export_handle->shard_index ) / export_handle->number_of_shards );
+	shard_end_index   = (int) ( ( (int64_t) number_of_notes * ( export_handle->shard_index + 1 ) ) / export_handle->number_of_shards );
+
+	if( export_handle->is_resumed == 0 )
+	{
+		*first_note_index = shard_start_index;
+		*end_note_index   = shard_end_index;
+
+		return( 1 );
+	}
+	/* The note indexes of the resume state are only valid for the same set of notes
+	 */
+	if( export_handle->resume_state->number_of_notes != number_of_notes )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: number of notes of resume state does not match.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->resume_state->next_note_index < shard_start_index )
+	 || ( export_handle->resume_state->next_note_index > shard_end_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: next note index of resume state value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->checkpoint       = export_handle->resume_state->checkpoint;
+	export_handle->has_failed_notes = export_handle->resume_state->has_failed_notes;
+
+	*first_note_index = export_handle->resume_state->next_note_index;
+	*end_note_index   = shard_end_index;
+
+	return( 1 );
+}
+
+/* Initializes the output writer and the value data used to write the JSON objects
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize_output_writer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize_output_writer";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->value_data == NULL )
+	{
+		export_handle->value_data = (uint8_t *) memory_allocate(
+		                                         sizeof( uint8_t ) * EXPORT_HANDLE_VALUE_DATA_SIZE );
+
+		if( export_handle->value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value data.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->value_data_size = EXPORT_HANDLE_VALUE_DATA_SIZE;
+	}
+	if( export_handle->output_writer == NULL )
+	{
+		if( output_writer_initialize(
+		     &( export_handle->output_writer ),
+		     EXPORT_HANDLE_OUTPUT_BUFFER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize output writer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the output writer of the JSON Lines and Arrow export modes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_output_writer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_output_writer";
+	int result            = 0;
+
+	if( export_handle_initialize_output_writer(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->is_resumed != 0 )
+	{
+		/* The data written after the resume state was stored is overwritten
+		 */
+		result = output_writer_open_at_offset(
+		          export_handle->output_writer,
+		          export_handle->items_export_path,
+		          export_handle->resume_state->output_offset,
+		          error );
+	}
+	else
+	{
+		result = output_writer_open(
+		          export_handle->output_writer,
+		          export_handle->items_export_path,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output writer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the Arrow writer and writes the schema
+ * The columns contain the note header values followed by the values of the item names
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_arrow_writer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_open_arrow_writer";
+	size_t item_name_index = 0;
+	size_t name_length     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->arrow_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - Arrow writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_initialize(
+	     &( export_handle->arrow_writer ),
+	     export_handle->output_writer,
+	     EXPORT_HANDLE_ARROW_NUMBER_OF_ROWS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_append_column(
+	     export_handle->arrow_writer,
+	     "identifier",
+	     10,
+	     ARROW_WRITER_COLUMN_TYPE_UINT32,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_append_column(
+	     export_handle->arrow_writer,
+	     "sequence_number",
+	     15,
+	     ARROW_WRITER_COLUMN_TYPE_UINT32,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_append_column(
+	     export_handle->arrow_writer,
+	     "modification_time",
+	     17,
+	     ARROW_WRITER_COLUMN_TYPE_UINT64,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_append_column(
+	     export_handle->arrow_writer,
+	     "note_class",
+	     10,
+	     ARROW_WRITER_COLUMN_TYPE_UINT16,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_append_column(
+	     export_handle->arrow_writer,
+	     "status_flags",
+	     12,
+	     ARROW_WRITER_COLUMN_TYPE_UINT16,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( arrow_writer_append_column(
+	     export_handle->arrow_writer,
+	     "recovered",
+	     9,
+	     ARROW_WRITER_COLUMN_TYPE_BOOLEAN,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	while( item_name_index < export_handle->item_names_size )
+	{
+		name_length = narrow_string_length(
+		               &( export_handle->item_names[ item_name_index ] ) );
+
+		if( arrow_writer_append_column(
+		     export_handle->arrow_writer,
+		     &( export_handle->item_names[ item_name_index ] ),
+		     name_length,
+		     ARROW_WRITER_COLUMN_TYPE_UTF8,
+		     1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		item_name_index += name_length + 1;
+	}
+	/* A resumed export continues the stream of which the schema was already written
+	 */
+	if( export_handle->is_resumed != 0 )
+	{
+		if( arrow_writer_continue_stream(
+		     export_handle->arrow_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to continue stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( arrow_writer_write_schema(
+	          export_handle->arrow_writer,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write schema.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+	 "%s: unable to create Arrow columns.",
+	 function );
+
+	arrow_writer_free(
+	 &( export_handle->arrow_writer ),
+	 NULL );
+
+	return( -1 );
+}
+
+/* Opens the blob store
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_blob_store(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_blob_store";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->blob_store != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - blob store value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( blob_store_initialize(
+	     &( export_handle->blob_store ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize blob store.",
+		 function );
+
+		goto on_error;
+	}
+	if( blob_store_open(
+	     export_handle->blob_store,
+	     export_handle->blob_store_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open blob store.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( export_handle->blob_store != NULL )
+	{
+		blob_store_free(
+		 &( export_handle->blob_store ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->index_filename != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libnsfdb_file_set_index_filename_wide(
+		          export_handle->input_file,
+		          export_handle->index_filename,
+		          wide_string_length(
+		           export_handle->index_filename ),
+		          error );
+#else
+		result = libnsfdb_file_set_index_filename(
+		          export_handle->input_file,
+		          export_handle->index_filename,
+		          narrow_string_length(
+		           export_handle->index_filename ),
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set index filename.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libnsfdb_file_open_wide(
+	     export_handle->input_file,
+	     filename,
+	     LIBNSFDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libnsfdb_file_open(
+	     export_handle->input_file,
+	     filename,
+	     LIBNSFDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	/* The notes are exported once hence do not let them evict reused buckets
+	 */
+	if( libnsfdb_file_set_access_hint(
+	     export_handle->input_file,
+	     LIBNSFDB_ACCESS_HINT_SCAN,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access hint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if successful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_close(
+	     export_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Exports the note
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_note(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     int note_index,
+     int number_of_notes,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_note";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_export_note_values(
+	     export_handle,
+	     note,
+	     note_index,
+	     export_path,
+	     export_path_size,
+	     log_handle,
+	     error ) != 1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to export values of note: %d out of: %d.\n",
+			 function,
+			 note_index + 1,
+			 number_of_notes );
+		}
+		if( ( error != NULL )
+		 && ( *error != NULL ) )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+		libcerror_error_free(
+		 error );
+
+		log_handle_printf(
+		 log_handle,
+		 "Unable to export values of note: %d out of: %d.\n",
+		 note_index + 1,
+		 number_of_notes );
+	}
+	else
+	{
+		export_handle->number_of_exported_notes += 1;
+	}
+	return( 1 );
+}
+
+/* Exports the note values
+ * The arrow export mode appends the note as a row, the jsonl export mode writes the note
+ * as a JSON object to the output file and the items export mode writes the note
+ * as a JSON object to a separate file in the export path
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_note_values(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     int note_index,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     log_handle_t *log_handle NSFDBTOOLS_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_note_values";
+	off64_t record_offset = 0;
+
+	NSFDBTOOLS_UNREFERENCED_PARAMETER( log_handle )
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->export_mode == EXPORT_HANDLE_MODE_ARROW )
+	{
+		if( export_handle_append_arrow_row(
+		     export_handle,
+		     note,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to append Arrow row.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_handle->export_mode == EXPORT_HANDLE_MODE_JSON_LINES )
+	{
+		if( output_writer_get_offset(
+		     export_handle->output_writer,
+		     &record_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve output offset.",
+			 function );
+
+			return( -1 );
+		}
+		if( export_handle_write_json_note(
+		     export_handle,
+		     note,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write note.",
+			 function );
+
+			/* The partially written record is discarded so that every line remains a complete JSON object
+			 */
+			if( output_writer_truncate(
+			     export_handle->output_writer,
+			     record_offset,
+			     NULL ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to discard partially written note at offset: %" PRIi64 ".",
+				 function,
+				 record_offset );
+			}
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( export_handle_write_json_note_file(
+		     export_handle,
+		     note,
+		     note_index,
+		     export_path,
+		     export_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write note file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes a note as a JSON object followed by an end of line character
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_json_note(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_json_note";
+	int number_of_values  = 0;
+	int value_index       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_number_of_values(
+	     note,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_write_json_note_header(
+	     export_handle,
+	     note,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write note header.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( value_index > 0 )
+		{
+			if( output_writer_write_buffer(
+			     export_handle->output_writer,
+			     (uint8_t *) ",",
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write value separator.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( export_handle_write_json_value(
+		     export_handle,
+		     note,
+		     value_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	if( output_writer_write_buffer(
+	     export_handle->output_writer,
+	     (uint8_t *) "]}\n",
+	     3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write note footer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a note as a JSON object to a separate file in the export path
+ * The file is named after the note index, e.g. Note00001.json, and is removed if the note
+ * could not be written completely
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_json_note_file(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     int note_index,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     libcerror_error_t **error )
+{
+	system_character_t filename[ 32 ];
+
+	system_character_t *note_path = NULL;
+	static char *function         = "export_handle_write_json_note_file";
+	size_t note_path_size         = 0;
+	int file_was_created          = 0;
+	int print_count               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_path_size == 0 )
+	 || ( export_path_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = system_string_sprintf(
+	               filename,
+	               32,
+	               _SYSTEM_STRING( "Note%05d.json" ),
+	               note_index + 1 );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set note filename.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libnsfdb_file_open_wide(
-	     export_handle->input_file,
+	if( libcpath_path_join_wide(
+	     &note_path,
+	     &note_path_size,
+	     export_path,
+	     export_path_size - 1,
 	     filename,
-	     LIBNSFDB_OPEN_READ,
+	     (size_t) print_count,
+	     error ) != 1 )
+#else
+	if( libcpath_path_join(
+	     &note_path,
+	     &note_path_size,
+	     export_path,
+	     export_path_size - 1,
+	     filename,
+	     (size_t) print_count,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create note path.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_open(
+	     export_handle->output_writer,
+	     note_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output writer.",
+		 function );
+
+		goto on_error;
+	}
+	file_was_created = 1;
+
+	if( export_handle_write_json_note(
+	     export_handle,
+	     note,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write note.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_writer_close(
+	     export_handle->output_writer,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output writer.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 note_path );
+
+	return( 1 );
+
+on_error:
+	if( file_was_created != 0 )
+	{
+		output_writer_close(
+		 export_handle->output_writer,
+		 NULL );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		libcfile_file_remove_wide(
+		 note_path,
+		 NULL );
+#else
+		libcfile_file_remove(
+		 note_path,
+		 NULL );
+#endif
+	}
+	if( note_path != NULL )
+	{
+		memory_free(
+		 note_path );
+	}
+	return( -1 );
+}
+
+/* Writes the header values of a note as the start of a JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_json_note_header(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     libcerror_error_t **error )
+{
+	char json_string[ 256 ];
+
+	static char *function      = "export_handle_write_json_note_header";
+	uint64_t modification_time = 0;
+	uint32_t note_identifier   = 0;
+	uint32_t sequence_number   = 0;
+	uint16_t note_class        = 0;
+	uint16_t status_flags      = 0;
+	int print_count            = 0;
+	int result                 = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_identifier(
+	     note,
+	     &note_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_sequence_number(
+	     note,
+	     &sequence_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_modification_time(
+	     note,
+	     &modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_note_class(
+	     note,
+	     &note_class,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve note class.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_status_flags(
+	     note,
+	     &status_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve status flags.",
+		 function );
+
+		return( -1 );
+	}
+	result = libnsfdb_note_is_recovered(
+	          note,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if note was recovered.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               json_string,
+	               256,
+	               "{\"identifier\":%" PRIu32 ",\"sequence_number\":%" PRIu32 ",\"modification_time\":%" PRIu64 ",\"note_class\":%" PRIu16 ",\"status_flags\":%" PRIu16 ",\"recovered\":%s,\"items\":[",
+	               note_identifier,
+	               sequence_number,
+	               modification_time,
+	               note_class,
+	               status_flags,
+	               ( result != 0 ) ? "true" : "false" );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format note header.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_buffer(
+	     export_handle->output_writer,
+	     (uint8_t *) json_string,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write note header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a value as a JSON object
+ * The name of the value is retrieved from the unique name key (UNK) table
+ * The value is null if the value data is not available
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_json_value(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     int value_index,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_write_json_value";
+	size_t name_size       = 0;
+	size_t value_data_size = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_value_name_size(
+	     note,
+	     value_index,
+	     &name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > export_handle->value_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The value data buffer is used to hold the name until it is written
+	 */
+	if( libnsfdb_note_get_value_name(
+	     note,
+	     value_index,
+	     export_handle->value_data,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_buffer(
+	     export_handle->output_writer,
+	     (uint8_t *) "{\"name\":",
+	     8,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_json_string(
+	     export_handle->output_writer,
+	     export_handle->value_data,
+	     name_size - 1,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_buffer(
+	     export_handle->output_writer,
+	     (uint8_t *) ",\"value\":",
+	     9,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libnsfdb_note_get_value_data_size(
+	     note,
+	     value_index,
+	     &value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size > export_handle->value_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == 0 )
+	{
+		if( output_writer_write_buffer(
+		     export_handle->output_writer,
+		     (uint8_t *) "null",
+		     4,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	else
+	{
+		if( libnsfdb_note_get_value_data(
+		     note,
+		     value_index,
+		     export_handle->value_data,
+		     value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data.",
+			 function );
+
+			return( -1 );
+		}
+		if( export_handle_write_json_value_data(
+		     export_handle,
+		     export_handle->value_data,
+		     value_data_size,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( output_writer_write_buffer(
+	     export_handle->output_writer,
+	     (uint8_t *) "}",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write value.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes value data as a JSON value
+ * The data starts with a 16-bit type value of which the upper byte contains the note item class.
+ * Text is written as a string, a text list as an array of strings, a number as a number
+ * and a date and time value as its 64-bit NSF timedate value, other data is written
+ * as a string of hexadecimal digits
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_json_value_data(
+     export_handle_t *export_handle,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	byte_stream_float64_t number_value;
+
+	char json_string[ 32 ];
+
+	static char *function      = "export_handle_write_json_value_data";
+	size_t entry_data_offset   = 0;
+	size_t entry_size_offset   = 0;
+	uint64_t time_value        = 0;
+	uint16_t entry_index       = 0;
+	uint16_t entry_size        = 0;
+	uint16_t item_value_type   = 0;
+	uint16_t number_of_entries = 0;
+	int print_count            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size >= 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 value_data,
+		 item_value_type );
+
+		switch( item_value_type )
+		{
+			case ( LIBNSFDB_NOTE_ITEM_CLASS_TEXT << 8 ):
+				if( output_writer_write_json_string(
+				     export_handle->output_writer,
+				     &( value_data[ 2 ] ),
+				     value_data_size - 2,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				return( 1 );
+
+			case ( LIBNSFDB_NOTE_ITEM_CLASS_TEXT << 8 ) | 0x01:
+				if( value_data_size < 4 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( value_data[ 2 ] ),
+				 number_of_entries );
+
+				entry_size_offset = 4;
+				entry_data_offset = 4 + ( (size_t) number_of_entries * 2 );
+
+				if( entry_data_offset > value_data_size )
+				{
+					break;
+				}
+				for( entry_index = 0;
+				     entry_index < number_of_entries;
+				     entry_index++ )
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 &( value_data[ entry_size_offset + ( (size_t) entry_index * 2 ) ] ),
+					 entry_size );
+
+					if( (size_t) entry_size > ( value_data_size - entry_data_offset ) )
+					{
+						break;
+					}
+					entry_data_offset += entry_size;
+				}
+				/* Fall back to hexadecimal digits if the text list is corrupted
+				 */
+				if( entry_index < number_of_entries )
+				{
+					break;
+				}
+				entry_data_offset = 4 + ( (size_t) number_of_entries * 2 );
+
+				if( output_writer_write_buffer(
+				     export_handle->output_writer,
+				     (uint8_t *) "[",
+				     1,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				for( entry_index = 0;
+				     entry_index < number_of_entries;
+				     entry_index++ )
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 &( value_data[ entry_size_offset + ( (size_t) entry_index * 2 ) ] ),
+					 entry_size );
+
+					if( entry_index > 0 )
+					{
+						if( output_writer_write_buffer(
+						     export_handle->output_writer,
+						     (uint8_t *) ",",
+						     1,
+						     error ) != 1 )
+						{
+							goto on_write_error;
+						}
+					}
+					if( output_writer_write_json_string(
+					     export_handle->output_writer,
+					     &( value_data[ entry_data_offset ] ),
+					     (size_t) entry_size,
+					     error ) != 1 )
+					{
+						goto on_write_error;
+					}
+					entry_data_offset += entry_size;
+				}
+				if( output_writer_write_buffer(
+				     export_handle->output_writer,
+				     (uint8_t *) "]",
+				     1,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				return( 1 );
+
+			case ( LIBNSFDB_NOTE_ITEM_CLASS_NUMBER << 8 ):
+				if( value_data_size != 10 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint64_little_endian(
+				 &( value_data[ 2 ] ),
+				 number_value.integer );
+
+				/* JSON has no representation of NaN and infinity
+				 */
+				if( ( number_value.floating_point != number_value.floating_point )
+				 || ( ( number_value.floating_point - number_value.floating_point ) != 0.0 ) )
+				{
+					print_count = narrow_string_snprintf(
+					               json_string,
+					               32,
+					               "null" );
+				}
+				else
+				{
+					print_count = narrow_string_snprintf(
+					               json_string,
+					               32,
+					               "%.17g",
+					               number_value.floating_point );
+				}
+				if( ( print_count < 0 )
+				 || ( print_count >= 32 ) )
+				{
+					break;
+				}
+				if( output_writer_write_buffer(
+				     export_handle->output_writer,
+				     (uint8_t *) json_string,
+				     (size_t) print_count,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				return( 1 );
+
+			case ( LIBNSFDB_NOTE_ITEM_CLASS_TIME << 8 ):
+				if( value_data_size != 10 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint64_little_endian(
+				 &( value_data[ 2 ] ),
+				 time_value );
+
+				print_count = narrow_string_snprintf(
+				               json_string,
+				               32,
+				               "%" PRIu64,
+				               time_value );
+
+				if( ( print_count < 0 )
+				 || ( print_count >= 32 ) )
+				{
+					break;
+				}
+				if( output_writer_write_buffer(
+				     export_handle->output_writer,
+				     (uint8_t *) json_string,
+				     (size_t) print_count,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				return( 1 );
+
+			default:
+				break;
+		}
+	}
+	if( ( export_handle->blob_store != NULL )
+	 && ( value_data_size >= EXPORT_HANDLE_MINIMUM_BLOB_DATA_SIZE ) )
+	{
+		if( export_handle_write_json_blob_reference(
+		     export_handle,
+		     value_data,
+		     value_data_size,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		return( 1 );
+	}
+	if( output_writer_write_hexadecimal_string(
+	     export_handle->output_writer,
+	     value_data,
+	     value_data_size,
 	     error ) != 1 )
-#else
-	if( libnsfdb_file_open(
-	     export_handle->input_file,
-	     filename,
-	     LIBNSFDB_OPEN_READ,
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write value data.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes value data as a JSON reference to a blob in the blob store
+ * The reference is an object that contains the SHA-256 hash and the size of the value data
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_json_blob_reference(
+     export_handle_t *export_handle,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t hash[ SHA256_HASH_SIZE ];
+
+	char json_string[ 32 ];
+
+	static char *function = "export_handle_write_json_blob_reference";
+	int print_count       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( blob_store_write_blob(
+	     export_handle->blob_store,
+	     value_data,
+	     value_data_size,
+	     hash,
+	     SHA256_HASH_SIZE,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write blob.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               json_string,
+	               32,
+	               ",\"size\":%" PRIzd "}",
+	               value_data_size );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set size string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_buffer(
+	     export_handle->output_writer,
+	     (uint8_t *) "{\"blob\":",
+	     8,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_hexadecimal_string(
+	     export_handle->output_writer,
+	     hash,
+	     SHA256_HASH_SIZE,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( output_writer_write_buffer(
+	     export_handle->output_writer,
+	     (uint8_t *) json_string,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write blob reference.",
+	 function );
+
+	return( -1 );
+}
+
+/* Appends the header values and the values of the item names of a note as an Arrow row
+ * The value of an item name is null if the note does not contain the item
+ * or if the value data is not available
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_arrow_row(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     libcerror_error_t **error )
+{
+	const char *item_name      = NULL;
+	static char *function      = "export_handle_append_arrow_row";
+	size_t item_name_index     = 0;
+	size_t item_name_length    = 0;
+	size_t name_size           = 0;
+	size_t value_data_size     = 0;
+	uint64_t modification_time = 0;
+	uint32_t note_identifier   = 0;
+	uint32_t sequence_number   = 0;
+	uint16_t note_class        = 0;
+	uint16_t status_flags      = 0;
+	int column_index           = 0;
+	int number_of_values       = 0;
+	int result                 = 0;
+	int value_index            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_identifier(
+	     note,
+	     &note_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_sequence_number(
+	     note,
+	     &sequence_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sequence number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_modification_time(
+	     note,
+	     &modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_note_class(
+	     note,
+	     &note_class,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve note class.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_note_get_status_flags(
+	     note,
+	     &status_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve status flags.",
+		 function );
+
+		return( -1 );
+	}
+	result = libnsfdb_note_is_recovered(
+	          note,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if note was recovered.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_set_integer_value(
+	     export_handle->arrow_writer,
+	     0,
+	     (uint64_t) note_identifier,
+	     error ) != 1 )
+	{
+		goto on_set_error;
+	}
+	if( arrow_writer_set_integer_value(
+	     export_handle->arrow_writer,
+	     1,
+	     (uint64_t) sequence_number,
+	     error ) != 1 )
+	{
+		goto on_set_error;
+	}
+	if( arrow_writer_set_integer_value(
+	     export_handle->arrow_writer,
+	     2,
+	     modification_time,
+	     error ) != 1 )
+	{
+		goto on_set_error;
+	}
+	if( arrow_writer_set_integer_value(
+	     export_handle->arrow_writer,
+	     3,
+	     (uint64_t) note_class,
+	     error ) != 1 )
+	{
+		goto on_set_error;
+	}
+	if( arrow_writer_set_integer_value(
+	     export_handle->arrow_writer,
+	     4,
+	     (uint64_t) status_flags,
+	     error ) != 1 )
+	{
+		goto on_set_error;
+	}
+	if( arrow_writer_set_boolean_value(
+	     export_handle->arrow_writer,
+	     5,
+	     (uint8_t) result,
+	     error ) != 1 )
+	{
+		goto on_set_error;
+	}
+	if( export_handle->number_of_item_names > 0 )
+	{
+		if( libnsfdb_note_get_number_of_values(
+		     note,
+		     &number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libnsfdb_note_get_value_name_size(
+		     note,
+		     value_index,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name size of value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( ( name_size == 0 )
+		 || ( name_size > export_handle->value_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name size of value: %d value out of bounds.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( libnsfdb_note_get_value_name(
+		     note,
+		     value_index,
+		     export_handle->value_data,
+		     name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve name of value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		/* Item names are case insensitive, the first value of an item name is exported
+		 */
+		column_index    = EXPORT_HANDLE_NUMBER_OF_ARROW_HEADER_COLUMNS;
+		item_name_index = 0;
+
+		while( item_name_index < export_handle->item_names_size )
+		{
+			item_name        = &( export_handle->item_names[ item_name_index ] );
+			item_name_length = narrow_string_length(
+			                    item_name );
+
+			if( ( item_name_length == ( name_size - 1 ) )
+			 && ( export_handle->arrow_writer->columns[ column_index ].value_is_set == 0 )
+			 && ( narrow_string_compare_no_case(
+			       (char *) export_handle->value_data,
+			       item_name,
+			       item_name_length ) == 0 ) )
+			{
+				break;
+			}
+			item_name_index += item_name_length + 1;
+
+			column_index++;
+		}
+		if( item_name_index >= export_handle->item_names_size )
+		{
+			continue;
+		}
+		if( libnsfdb_note_get_value_data_size(
+		     note,
+		     value_index,
+		     &value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data size of value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( value_data_size > export_handle->value_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data size of value: %d value out of bounds.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( value_data_size == 0 )
+		{
+			continue;
+		}
+		if( libnsfdb_note_get_value_data(
+		     note,
+		     value_index,
+		     export_handle->value_data,
+		     value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data of value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( export_handle_append_arrow_value_data(
+		     export_handle,
+		     column_index,
+		     export_handle->value_data,
+		     value_data_size,
+		     error ) != 1 )
+		{
+			goto on_set_error;
+		}
+	}
+	if( arrow_writer_append_row(
+	     export_handle->arrow_writer,
 	     error ) != 1 )
-#endif
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input file.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to append row.",
 		 function );
 
 		return( -1 );
 	}
 	return( 1 );
+
+on_set_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+	 "%s: unable to set column value.",
+	 function );
+
+	return( -1 );
 }
 
-/* Closes the input
- * Returns the 0 if successful or -1 on error
+/* Appends value data to a string column of the Arrow writer
+ * Text is appended as a string, the entries of a text list are separated by a comma
+ * and a space, a number is appended in decimal notation and a date and time value as
+ * its 64-bit NSF timedate value, other data is appended as hexadecimal digits
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_close_input(
+int export_handle_append_arrow_value_data(
      export_handle_t *export_handle,
+     int column_index,
+     const uint8_t *value_data,
+     size_t value_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_close_input";
-	int result            = 0;
+	byte_stream_float64_t number_value;
+
+	char value_string[ 32 ];
+
+	static char *function      = "export_handle_append_arrow_value_data";
+	size_t entry_data_offset   = 0;
+	size_t entry_size_offset   = 0;
+	uint64_t time_value        = 0;
+	uint16_t entry_index       = 0;
+	uint16_t entry_size        = 0;
+	uint16_t item_value_type   = 0;
+	uint16_t number_of_entries = 0;
+	int print_count            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -660,36 +3960,271 @@ int export_handle_close_input(
 
 		return( -1 );
 	}
-	if( libnsfdb_file_close(
-	     export_handle->input_file,
-	     error ) != 0 )
+	if( value_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close input file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	return( result );
+	if( value_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size >= 2 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 value_data,
+		 item_value_type );
+
+		switch( item_value_type )
+		{
+			case ( LIBNSFDB_NOTE_ITEM_CLASS_TEXT << 8 ):
+				if( arrow_writer_append_string_value(
+				     export_handle->arrow_writer,
+				     column_index,
+				     &( value_data[ 2 ] ),
+				     value_data_size - 2,
+				     error ) != 1 )
+				{
+					goto on_append_error;
+				}
+				return( 1 );
+
+			case ( LIBNSFDB_NOTE_ITEM_CLASS_TEXT << 8 ) | 0x01:
+				if( value_data_size < 4 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( value_data[ 2 ] ),
+				 number_of_entries );
+
+				entry_size_offset = 4;
+				entry_data_offset = 4 + ( (size_t) number_of_entries * 2 );
+
+				if( entry_data_offset > value_data_size )
+				{
+					break;
+				}
+				for( entry_index = 0;
+				     entry_index < number_of_entries;
+				     entry_index++ )
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 &( value_data[ entry_size_offset + ( (size_t) entry_index * 2 ) ] ),
+					 entry_size );
+
+					if( (size_t) entry_size > ( value_data_size - entry_data_offset ) )
+					{
+						break;
+					}
+					entry_data_offset += entry_size;
+				}
+				/* Fall back to hexadecimal digits if the text list is corrupted
+				 */
+				if( entry_index < number_of_entries )
+				{
+					break;
+				}
+				entry_data_offset = 4 + ( (size_t) number_of_entries * 2 );
+
+				/* An empty text list is an empty string and not a null value
+				 */
+				if( arrow_writer_append_string_value(
+				     export_handle->arrow_writer,
+				     column_index,
+				     &( value_data[ entry_data_offset ] ),
+				     0,
+				     error ) != 1 )
+				{
+					goto on_append_error;
+				}
+				for( entry_index = 0;
+				     entry_index < number_of_entries;
+				     entry_index++ )
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 &( value_data[ entry_size_offset + ( (size_t) entry_index * 2 ) ] ),
+					 entry_size );
+
+					if( entry_index > 0 )
+					{
+						if( arrow_writer_append_string_value(
+						     export_handle->arrow_writer,
+						     column_index,
+						     (uint8_t *) ", ",
+						     2,
+						     error ) != 1 )
+						{
+							goto on_append_error;
+						}
+					}
+					if( arrow_writer_append_string_value(
+					     export_handle->arrow_writer,
+					     column_index,
+					     &( value_data[ entry_data_offset ] ),
+					     (size_t) entry_size,
+					     error ) != 1 )
+					{
+						goto on_append_error;
+					}
+					entry_data_offset += entry_size;
+				}
+				return( 1 );
+
+			case ( LIBNSFDB_NOTE_ITEM_CLASS_NUMBER << 8 ):
+				if( value_data_size != 10 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint64_little_endian(
+				 &( value_data[ 2 ] ),
+				 number_value.integer );
+
+				print_count = narrow_string_snprintf(
+				               value_string,
+				               32,
+				               "%.17g",
+				               number_value.floating_point );
+
+				if( ( print_count < 0 )
+				 || ( print_count >= 32 ) )
+				{
+					break;
+				}
+				if( arrow_writer_append_string_value(
+				     export_handle->arrow_writer,
+				     column_index,
+				     (uint8_t *) value_string,
+				     (size_t) print_count,
+				     error ) != 1 )
+				{
+					goto on_append_error;
+				}
+				return( 1 );
+
+			case ( LIBNSFDB_NOTE_ITEM_CLASS_TIME << 8 ):
+				if( value_data_size != 10 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint64_little_endian(
+				 &( value_data[ 2 ] ),
+				 time_value );
+
+				print_count = narrow_string_snprintf(
+				               value_string,
+				               32,
+				               "%" PRIu64,
+				               time_value );
+
+				if( ( print_count < 0 )
+				 || ( print_count >= 32 ) )
+				{
+					break;
+				}
+				if( arrow_writer_append_string_value(
+				     export_handle->arrow_writer,
+				     column_index,
+				     (uint8_t *) value_string,
+				     (size_t) print_count,
+				     error ) != 1 )
+				{
+					goto on_append_error;
+				}
+				return( 1 );
+
+			default:
+				break;
+		}
+	}
+	if( arrow_writer_append_hexadecimal_value(
+	     export_handle->arrow_writer,
+	     column_index,
+	     value_data,
+	     value_data_size,
+	     error ) != 1 )
+	{
+		goto on_append_error;
+	}
+	return( 1 );
+
+on_append_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append value data.",
+	 function );
+
+	return( -1 );
 }
 
-/* Exports the note
+/* Prefetches the buckets of a range of notes
+ * A failed prefetch is not fatal since the notes are read individually
+ */
+void export_handle_prefetch_notes(
+      libnsfdb_file_t *file,
+      int first_note_index,
+      int number_of_notes )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "export_handle_prefetch_notes";
+
+	if( libnsfdb_file_prefetch_notes(
+	     file,
+	     LIBNSFDB_NOTE_TYPE_ALL,
+	     first_note_index,
+	     number_of_notes,
+	     &error ) != 1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to prefetch notes: %d to %d.\n",
+			 function,
+			 first_note_index + 1,
+			 first_note_index + number_of_notes );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+	}
+}
+
+/* Exports the notes
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_note(
+int export_handle_export_notes(
      export_handle_t *export_handle,
-     libnsfdb_note_t *note,
-     int note_index,
-     int number_of_notes,
+     libnsfdb_file_t *file,
      const system_character_t *export_path,
      size_t export_path_size,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_export_note";
+	libnsfdb_note_t *note   = NULL;
+	static char *function   = "export_handle_export_notes";
+	int end_note_index      = 0;
+	int first_note_index    = 0;
+	int note_index          = 0;
+	int number_of_notes     = 0;
+	int prefetch_note_index = 0;
+	int result              = 0;
 
 	if( export_handle == NULL )
 	{
@@ -702,54 +4237,209 @@ int export_handle_export_note(
 
 		return( -1 );
 	}
-	if( export_handle_export_note_values(
+	if( libnsfdb_file_get_number_of_notes(
+	     file,
+	     LIBNSFDB_NOTE_TYPE_ALL,
+	     &number_of_notes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of notes.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_get_note_range(
 	     export_handle,
-	     note,
-	     export_path,
-	     export_path_size,
-	     log_handle,
+	     number_of_notes,
+	     &first_note_index,
+	     &end_note_index,
 	     error ) != 1 )
 	{
-		if( libcnotify_verbose != 0 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve note range.",
+		 function );
+
+		return( -1 );
+	}
+	for( note_index = first_note_index;
+	     note_index < end_note_index;
+	     note_index++ )
+	{
+		if( export_handle->abort != 0 )
 		{
-			libcnotify_printf(
-			 "%s: unable to export values of note: %d out of: %d.\n",
-			 function,
-			 note_index + 1,
-			 number_of_notes );
+			return( -1 );
 		}
-		if( ( error != NULL )
-		 && ( *error != NULL ) )
+		if( export_handle_store_resume_state(
+		     export_handle,
+		     note_index,
+		     number_of_notes,
+		     error ) != 1 )
 		{
-			libcnotify_print_error_backtrace(
-			 *error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to store resume state.",
+			 function );
+
+			return( -1 );
 		}
-		libcerror_error_free(
-		 error );
+		/* The buckets of the next range of notes are prefetched while
+		 * the notes of the current range are exported
+		 */
+		if( note_index == first_note_index )
+		{
+			prefetch_note_index = note_index + EXPORT_HANDLE_NUMBER_OF_PREFETCH_NOTES
+			                    - ( note_index % EXPORT_HANDLE_NUMBER_OF_PREFETCH_NOTES );
 
-		log_handle_printf(
-		 log_handle,
-		 "Unable to export values of note: %d out of: %d.\n",
+			export_handle_prefetch_notes(
+			 file,
+			 note_index,
+			 prefetch_note_index - note_index );
+		}
+		if( ( note_index == first_note_index )
+		 || ( ( note_index % EXPORT_HANDLE_NUMBER_OF_PREFETCH_NOTES ) == 0 ) )
+		{
+			if( prefetch_note_index < end_note_index )
+			{
+				export_handle_prefetch_notes(
+				 file,
+				 prefetch_note_index,
+				 EXPORT_HANDLE_NUMBER_OF_PREFETCH_NOTES );
+
+				prefetch_note_index += EXPORT_HANDLE_NUMBER_OF_PREFETCH_NOTES;
+			}
+		}
+		if( export_handle->note_filter != NULL )
+		{
+			result = libnsfdb_file_get_filtered_note(
+			          file,
+			          LIBNSFDB_NOTE_TYPE_ALL,
+			          note_index,
+			          export_handle->note_filter,
+			          &note,
+			          error );
+		}
+		else
+		{
+			result = libnsfdb_file_get_note(
+			          file,
+			          LIBNSFDB_NOTE_TYPE_ALL,
+			          note_index,
+			          &note,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve note: %d.",
+			 function,
+			 note_index + 1 );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "Exporting note %d out of %d.\n",
 		 note_index + 1,
 		 number_of_notes );
+
+		if( export_handle_export_note(
+		     export_handle,
+		     note,
+		     note_index,
+		     number_of_notes,
+		     export_path,
+		     export_path_size,
+		     log_handle,
+		     error ) != 1 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to export note %d out of %d.\n",
+			 note_index + 1,
+			 number_of_notes );
+
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to export note: %d.\n",
+				 function,
+				 note_index + 1 );
+			}
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+			libcerror_error_free(
+			 error );
+
+			log_handle_printf(
+			 log_handle,
+			 "Unable to export note: %d.\n",
+			 note_index + 1 );
+		}
+		if( libnsfdb_note_free(
+		     &note,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free note.",
+			 function );
+
+			return( -1 );
+		}
 	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "\n" );
+
 	return( 1 );
 }
 
-/* Exports the note values
+/* Exports the notes that were modified after the checkpoint
+ * The notes are exported in order of their modification time and the checkpoint
+ * is updated to the modification time of the last exported note, up to the first
+ * note that could not be exported
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_note_values(
+int export_handle_export_modified_notes(
      export_handle_t *export_handle,
-     libnsfdb_note_t *note,
+     libnsfdb_file_t *file,
      const system_character_t *export_path,
      size_t export_path_size,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_export_note_values";
-	int number_of_values  = 0;
-	int value_index       = 0;
+	libnsfdb_note_t *note      = NULL;
+	static char *function      = "export_handle_export_modified_notes";
+	uint64_t checkpoint        = 0;
+	uint64_t modification_key  = 0;
+	uint64_t modification_time = 0;
+	int end_note_index         = 0;
+	int first_note_index       = 0;
+	int note_index             = 0;
+	int number_of_notes        = 0;
+	int result                 = 1;
 
 	if( export_handle == NULL )
 	{
@@ -762,82 +4452,67 @@ int export_handle_export_note_values(
 
 		return( -1 );
 	}
-	if( libnsfdb_note_get_number_of_values(
-	     note,
-	     &number_of_values,
+	checkpoint = export_handle->checkpoint;
+
+	if( libnsfdb_file_get_number_of_notes_modified_since(
+	     file,
+	     LIBNSFDB_NOTE_TYPE_ALL,
+	     checkpoint,
+	     &number_of_notes,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
-		 function );
-
-		return( -1 );
-	}
-	for( value_index = 0;
-	     value_index < number_of_values;
-	     value_index++ )
-	{
-		/* TODO */
-	}
-	return( 1 );
-}
-
-/* Exports the notes
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_notes(
-     export_handle_t *export_handle,
-     libnsfdb_file_t *file,
-     const system_character_t *export_path,
-     size_t export_path_size,
-     log_handle_t *log_handle,
-     libcerror_error_t **error )
-{
-	libnsfdb_note_t *note = NULL;
-	static char *function = "export_handle_export_notes";
-	int note_index        = 0;
-	int number_of_notes   = 0;
-
-	if( export_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 "%s: unable to retrieve number of modified notes.",
 		 function );
 
 		return( -1 );
 	}
-	if( libnsfdb_file_get_number_of_notes(
-	     file,
-	     LIBNSFDB_NOTE_TYPE_ALL,
-	     &number_of_notes,
+	if( export_handle_get_note_range(
+	     export_handle,
+	     number_of_notes,
+	     &first_note_index,
+	     &end_note_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of notes.",
+		 "%s: unable to retrieve note range.",
 		 function );
 
 		return( -1 );
 	}
-	for( note_index = 0;
-	     note_index < number_of_notes;
+	for( note_index = first_note_index;
+	     note_index < end_note_index;
 	     note_index++ )
 	{
 		if( export_handle->abort != 0 )
 		{
 			return( -1 );
 		}
-		if( libnsfdb_file_get_note(
+		if( export_handle_store_resume_state(
+		     export_handle,
+		     note_index,
+		     number_of_notes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to store resume state.",
+			 function );
+
+			return( -1 );
+		}
+		if( libnsfdb_file_get_note_modified_since(
 		     file,
 		     LIBNSFDB_NOTE_TYPE_ALL,
+		     checkpoint,
 		     note_index,
 		     &note,
 		     error ) != 1 )
@@ -846,54 +4521,120 @@ int export_handle_export_notes(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve note: %d.",
+			 "%s: unable to retrieve modified note: %d.",
 			 function,
 			 note_index + 1 );
 
 			return( -1 );
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Exporting note %d out of %d.\n",
-		 note_index + 1,
-		 number_of_notes );
-
-		if( export_handle_export_note(
-		     export_handle,
+		if( libnsfdb_note_get_modification_time(
 		     note,
-		     note_index,
-		     number_of_notes,
-		     export_path,
-		     export_path_size,
-		     log_handle,
+		     &modification_time,
 		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve modification time of note: %d.",
+			 function,
+			 note_index + 1 );
+
+			libnsfdb_note_free(
+			 &note,
+			 NULL );
+
+			return( -1 );
+		}
+		if( export_handle->note_filter != NULL )
+		{
+			result = libnsfdb_note_match_filter(
+			          note,
+			          export_handle->note_filter,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to match modified note: %d against note filter.",
+				 function,
+				 note_index + 1 );
+
+				libnsfdb_note_free(
+				 &note,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( result != 0 )
 		{
 			fprintf(
 			 export_handle->notify_stream,
-			 "Unable to export note %d out of %d.\n",
+			 "Exporting modified note %d out of %d.\n",
 			 note_index + 1,
 			 number_of_notes );
 
-			if( libcnotify_verbose != 0 )
+			if( export_handle_export_note(
+			     export_handle,
+			     note,
+			     note_index,
+			     number_of_notes,
+			     export_path,
+			     export_path_size,
+			     log_handle,
+			     error ) != 1 )
 			{
-				libcnotify_printf(
-				 "%s: unable to export note: %d.\n",
-				 function,
+				fprintf(
+				 export_handle->notify_stream,
+				 "Unable to export modified note %d out of %d.\n",
+				 note_index + 1,
+				 number_of_notes );
+
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to export modified note: %d.\n",
+					 function,
+					 note_index + 1 );
+				}
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+				libcerror_error_free(
+				 error );
+
+				log_handle_printf(
+				 log_handle,
+				 "Unable to export modified note: %d.\n",
 				 note_index + 1 );
-			}
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-			libcerror_error_free(
-			 error );
 
-			log_handle_printf(
-			 log_handle,
-			 "Unable to export note: %d.\n",
-			 note_index + 1 );
+				/* The checkpoint is kept below the modification time of the first
+				 * failed note so that the next export includes the note again
+				 */
+				if( export_handle->has_failed_notes == 0 )
+				{
+					modification_key = modification_time & 0x00ffffffffffffffULL;
+
+					if( ( ( export_handle->checkpoint & 0x00ffffffffffffffULL ) >= modification_key )
+					 && ( modification_key > 0 ) )
+					{
+						export_handle->checkpoint = modification_key - 1;
+					}
+					export_handle->has_failed_notes = 1;
+
+					log_handle_printf(
+					 log_handle,
+					 "Checkpoint not advanced after modified note: %d.\n",
+					 note_index + 1 );
+				}
+			}
 		}
 		if( libnsfdb_note_free(
 		     &note,
@@ -908,6 +4649,13 @@ int export_handle_export_notes(
 
 			return( -1 );
 		}
+		/* The notes are sorted by modification time hence the checkpoint
+		 * is only advanced after the note was handled
+		 */
+		if( export_handle->has_failed_notes == 0 )
+		{
+			export_handle->checkpoint = modification_time;
+		}
 	}
 	fprintf(
 	 export_handle->notify_stream,
@@ -942,34 +4690,132 @@ int export_handle_export_file(
 	 export_handle->notify_stream,
 	 "Exporting notes.\n" );
 
+	if( export_handle->is_resumed != 0 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Resuming export at note %d out of %d.\n",
+		 export_handle->resume_state->next_note_index + 1,
+		 export_handle->resume_state->number_of_notes );
+	}
+
+	if( ( export_handle->export_mode == EXPORT_HANDLE_MODE_ARROW )
+	 || ( export_handle->export_mode == EXPORT_HANDLE_MODE_JSON_LINES ) )
+	{
+		if( export_handle_open_output_writer(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open output writer.",
+			 function );
+
+			return( -1 );
+		}
+		if( export_handle->export_mode == EXPORT_HANDLE_MODE_ARROW )
+		{
+			if( export_handle_open_arrow_writer(
+			     export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open Arrow writer.",
+				 function );
+
+				output_writer_close(
+				 export_handle->output_writer,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( ( export_handle->export_mode == EXPORT_HANDLE_MODE_JSON_LINES )
+		 && ( export_handle->blob_store_path != NULL ) )
+		{
+			if( export_handle_open_blob_store(
+			     export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open blob store.",
+				 function );
+
+				output_writer_close(
+				 export_handle->output_writer,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+	}
+	else if( export_handle->is_resumed == 0 )
+	{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libcpath_path_make_directory_wide(
-	     export_handle->items_export_path,
-	     error ) != 1 )
+		if( libcpath_path_make_directory_wide(
+		     export_handle->items_export_path,
+		     error ) != 1 )
 #else
-	if( libcpath_path_make_directory(
-	     export_handle->items_export_path,
-	     error ) != 1 )
+		if( libcpath_path_make_directory(
+		     export_handle->items_export_path,
+		     error ) != 1 )
 #endif
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to make directory: %" PRIs_SYSTEM ".",
-		 function,
-		 export_handle->items_export_path );
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to make directory: %" PRIs_SYSTEM ".",
+			 function,
+			 export_handle->items_export_path );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	result = export_handle_export_notes(
-	          export_handle,
-	          export_handle->input_file,
-	          export_handle->items_export_path,
-	          export_handle->items_export_path_size,
-	          log_handle,
-	          error );
+	if( export_handle->export_mode == EXPORT_HANDLE_MODE_ITEMS )
+	{
+		if( export_handle_initialize_output_writer(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize output writer.",
+			 function );
 
+			return( -1 );
+		}
+	}
+	if( export_handle->use_checkpoint != 0 )
+	{
+		result = export_handle_export_modified_notes(
+		          export_handle,
+		          export_handle->input_file,
+		          export_handle->items_export_path,
+		          export_handle->items_export_path_size,
+		          log_handle,
+		          error );
+	}
+	else
+	{
+		result = export_handle_export_notes(
+		          export_handle,
+		          export_handle->input_file,
+		          export_handle->items_export_path,
+		          export_handle->items_export_path_size,
+		          log_handle,
+		          error );
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -979,6 +4825,139 @@ int export_handle_export_file(
 		 "%s: unable to export notes.",
 		 function );
 	}
+	if( export_handle->arrow_writer != NULL )
+	{
+		/* The last record batch is written on error as well so that the stream remains readable
+		 */
+		if( arrow_writer_write_end_of_stream(
+		     export_handle->arrow_writer,
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write end of Arrow stream.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( export_handle->output_writer != NULL )
+	{
+		/* The output writer is closed on error as well to write the buffered notes
+		 */
+		if( output_writer_close(
+		     export_handle->output_writer,
+		     ( result == -1 ) ? NULL : error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close output writer.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( export_handle->number_of_shards > 1 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Exported %d notes of shard %d out of %d.\n",
+		 export_handle->number_of_exported_notes,
+		 export_handle->shard_index + 1,
+		 export_handle->number_of_shards );
+
+		/* The count is logged as well so that the logs of the shards can be combined
+		 */
+		log_handle_printf(
+		 log_handle,
+		 "Exported notes of shard %d out of %d: %d.\n",
+		 export_handle->shard_index + 1,
+		 export_handle->number_of_shards,
+		 export_handle->number_of_exported_notes );
+	}
+	if( export_handle->blob_store != NULL )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Stored %d blobs of %" PRIu64 " bytes, %d blobs of %" PRIu64 " bytes were already stored.\n",
+		 export_handle->blob_store->number_of_stored_blobs,
+		 export_handle->blob_store->stored_data_size,
+		 export_handle->blob_store->number_of_deduplicated_blobs,
+		 export_handle->blob_store->deduplicated_data_size );
+
+		log_handle_printf(
+		 log_handle,
+		 "Stored blobs: %d (%" PRIu64 " bytes), already stored blobs: %d (%" PRIu64 " bytes).\n",
+		 export_handle->blob_store->number_of_stored_blobs,
+		 export_handle->blob_store->stored_data_size,
+		 export_handle->blob_store->number_of_deduplicated_blobs,
+		 export_handle->blob_store->deduplicated_data_size );
+	}
+	/* The resume state is kept when the export did not complete
+	 */
+	if( ( result == 1 )
+	 && ( export_handle->resume_state != NULL ) )
+	{
+		if( resume_state_remove(
+		     export_handle->resume_state_path,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 "%s: unable to remove resume state: %" PRIs_SYSTEM ".",
+			 function,
+			 export_handle->resume_state_path );
+
+			result = -1;
+		}
+	}
+	if( export_handle->use_checkpoint != 0 )
+	{
+		if( export_handle->has_failed_notes != 0 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Checkpoint was not advanced after the first modified note that could not be exported.\n" );
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "Checkpoint: %" PRIu64 "\n",
+		 export_handle->checkpoint );
+	}
+	/* The note index is stored so that the next export does not need to rebuild it
+	 */
+	if( ( result == 1 )
+	 && ( export_handle->index_filename != NULL ) )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libnsfdb_file_write_index_wide(
+		          export_handle->input_file,
+		          export_handle->index_filename,
+		          error );
+#else
+		result = libnsfdb_file_write_index(
+		          export_handle->input_file,
+		          export_handle->index_filename,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write index file.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( export_handle->abort != 0 )
 	{
 		export_handle->abort = 0;
@@ -25,14 +25,25 @@
 #include <common.h>
 #include <types.h>
 
+#include "arrow_writer.h"
+#include "blob_store.h"
 #include "log_handle.h"
 #include "nsfdbtools_libcerror.h"
 #include "nsfdbtools_libnsfdb.h"
+#include "output_writer.h"
+#include "resume_state.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+enum EXPORT_HANDLE_MODES
+{
+	EXPORT_HANDLE_MODE_ARROW		= (int) 'a',
+	EXPORT_HANDLE_MODE_ITEMS		= (int) 'i',
+	EXPORT_HANDLE_MODE_JSON_LINES		= (int) 'j'
+};
+
 typedef struct export_handle export_handle_t;
 
 struct export_handle
@@ -49,6 +60,39 @@ struct export_handle
 	 */
 	int number_of_exported_notes;
 
+	/* The index filename
+	 */
+	const system_character_t *index_filename;
+
+	/* Value to indicate only the notes modified after the checkpoint should be exported
+	 */
+	uint8_t use_checkpoint;
+
+	/* The checkpoint, which contains the modification time of the last exported note
+	 */
+	uint64_t checkpoint;
+
+	/* Value to indicate a modified note could not be exported
+	 * after which the checkpoint is no longer advanced
+	 */
+	uint8_t has_failed_notes;
+
+	/* The note filter
+	 */
+	libnsfdb_note_filter_t *note_filter;
+
+	/* The note class mask of the note filter
+	 */
+	uint16_t note_class_mask;
+
+	/* The index of the shard to export
+	 */
+	int shard_index;
+
+	/* The number of shards the notes are partitioned into
+	 */
+	int number_of_shards;
+
 	/* The target path
 	 */
 	system_character_t *target_path;
@@ -57,7 +101,12 @@ struct export_handle
 	 */
 	size_t target_path_size;
 
+	/* The export mode
+	 */
+	int export_mode;
+
 	/* The items export path
+	 * In the JSON Lines and Arrow export modes this is the path of the output file
 	 */
 	system_character_t *items_export_path;
 
@@ -65,6 +114,71 @@ struct export_handle
 	 */
 	size_t items_export_path_size;
 
+	/* The output writer
+	 */
+	output_writer_t *output_writer;
+
+	/* The Arrow writer
+	 */
+	arrow_writer_t *arrow_writer;
+
+	/* The names of the items that are exported as columns in the Arrow export mode
+	 * The names are stored as consecutive end-of-string terminated strings
+	 */
+	char *item_names;
+
+	/* The item names size
+	 */
+	size_t item_names_size;
+
+	/* The number of item names
+	 */
+	int number_of_item_names;
+
+	/* The value data buffer, which is reused for every value
+	 */
+	uint8_t *value_data;
+
+	/* The value data buffer size
+	 */
+	size_t value_data_size;
+
+	/* The path of the directory the value data is stored in as content-addressed blobs
+	 */
+	const system_character_t *blob_store_path;
+
+	/* The blob store
+	 */
+	blob_store_t *blob_store;
+
+	/* The resume state
+	 */
+	resume_state_t *resume_state;
+
+	/* The resume state path
+	 */
+	system_character_t *resume_state_path;
+
+	/* The resume state path size
+	 */
+	size_t resume_state_path_size;
+
+	/* The temporary resume state path
+	 */
+	system_character_t *temporary_resume_state_path;
+
+	/* The temporary resume state path size
+	 */
+	size_t temporary_resume_state_path_size;
+
+	/* Value to indicate the export continues a previous export
+	 */
+	uint8_t is_resumed;
+
+	/* The index of the next note at the time the resume state was last stored
+	 */
+	int stored_note_index;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -91,6 +205,42 @@ int export_handle_set_target_path(
      const system_character_t *target_path,
      libcerror_error_t **error );
 
+int export_handle_set_checkpoint(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_note_classes(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_note_class_mask(
+     export_handle_t *export_handle,
+     uint16_t note_class_mask,
+     libcerror_error_t **error );
+
+int export_handle_set_export_mode(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_item_names(
+     export_handle_t *export_handle,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int export_handle_set_shard(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_copy_options(
+     export_handle_t *destination_export_handle,
+     export_handle_t *source_export_handle,
+     libcerror_error_t **error );
+
 int export_handle_set_export_path(
      export_handle_t *export_handle,
      const system_character_t *base_path,
@@ -105,6 +255,39 @@ int export_handle_create_items_export_path(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
+int export_handle_read_resume_state(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_store_resume_state(
+     export_handle_t *export_handle,
+     int next_note_index,
+     int number_of_notes,
+     libcerror_error_t **error );
+
+int export_handle_get_note_range(
+     export_handle_t *export_handle,
+     int number_of_notes,
+     int *first_note_index,
+     int *end_note_index,
+     libcerror_error_t **error );
+
+int export_handle_initialize_output_writer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_output_writer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_arrow_writer(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_blob_store(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
 int export_handle_open_input(
      export_handle_t *export_handle,
      const system_character_t *filename,
@@ -129,13 +312,71 @@ int export_handle_export_note(
 int export_handle_export_note_values(
      export_handle_t *export_handle,
      libnsfdb_note_t *note,
+     int note_index,
      const system_character_t *export_path,
      size_t export_path_size,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+/* JSON Lines export functions
+ */
+int export_handle_write_json_note(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     libcerror_error_t **error );
+
+int export_handle_write_json_note_file(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     int note_index,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     libcerror_error_t **error );
+
+int export_handle_write_json_note_header(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     libcerror_error_t **error );
+
+int export_handle_write_json_value(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     int value_index,
+     libcerror_error_t **error );
+
+int export_handle_write_json_value_data(
+     export_handle_t *export_handle,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int export_handle_write_json_blob_reference(
+     export_handle_t *export_handle,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+/* Arrow export functions
+ */
+int export_handle_append_arrow_row(
+     export_handle_t *export_handle,
+     libnsfdb_note_t *note,
+     libcerror_error_t **error );
+
+int export_handle_append_arrow_value_data(
+     export_handle_t *export_handle,
+     int column_index,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
 /* File export functions
  */
+void export_handle_prefetch_notes(
+      libnsfdb_file_t *file,
+      int first_note_index,
+      int number_of_notes );
+
 int export_handle_export_notes(
      export_handle_t *export_handle,
      libnsfdb_file_t *file,
@@ -144,6 +385,14 @@ int export_handle_export_notes(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_modified_notes(
+     export_handle_t *export_handle,
+     libnsfdb_file_t *file,
+     const system_character_t *export_path,
+     size_t export_path_size,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int export_handle_export_file(
      export_handle_t *export_handle,
      log_handle_t *log_handle,
@@ -0,0 +1,1150 @@
+/*
+ * The on-disk format structures written by the generator
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GENERATE_FORMAT_H )
+#define _GENERATE_FORMAT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The note item flag that indicates the item is stored in the summary buffer
+ */
+#define NSFDB_NOTE_ITEM_FLAG_SUMMARY	0x0004
+
+typedef struct nsfdb_file_header nsfdb_file_header_t;
+
+struct nsfdb_file_header
+{
+	/* The signature
+	 * Consists of 2 bytes
+	 * Contains: 0x1a 0x00
+	 */
+	uint8_t signature[ 2 ];
+
+	/* The database header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t database_header_size[ 4 ];
+};
+
+typedef struct nsfdb_database_information nsfdb_database_information_t;
+
+struct nsfdb_database_information
+{
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* Database identifier (DBID)
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value used as an identifier
+	 */
+	uint8_t database_identifier[ 8 ];
+
+	/* The application version
+	 * Consists of 2 bytes
+	 */
+	uint8_t application_version[ 2 ];
+
+	/* The non-data Record Relocation Vector (RRV) bucket position
+	 * Consists of 4 bytes
+	 */
+	uint8_t non_data_rrv_bucket_position[ 4 ];
+
+	/* The (next) available non-data Record Relocation Vector (RRV) identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t available_non_data_rrv_identifier[ 4 ];
+
+	/* The number of available non-data Record Relocation Vectors (RRVs)
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_available_non_data_rrvs[ 2 ];
+
+	/* The activity log offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t activity_log_offset[ 4 ];
+
+	/* The bucket (last) modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t bucket_modification_time[ 8 ];
+
+	/* The database class
+	 * Consists of 2 bytes
+	 */
+	uint8_t database_class[ 2 ];
+
+	/* The database flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t database_flags[ 2 ];
+
+	/* The Bucket Descriptor Block (BDB) size
+	 * Consists of 4 bytes
+	 */
+	uint8_t bucket_descriptor_block_size[ 4 ];
+
+	/* The Bucket Descriptor Block (BDB) position
+	 * Consists of 4 bytes
+	 */
+	uint8_t bucket_descriptor_block_position[ 4 ];
+
+	/* The Bucket Descriptor Table (BDT) size
+	 * Consists of 2 bytes
+	 */
+	uint8_t bdt_size[ 2 ];
+
+	/* The Bucket Descriptor Table (BDT) position
+	 * Consists of 4 bytes
+	 */
+	uint8_t bdt_position[ 4 ];
+
+	/* The Bucket Descriptor Table (BDT) bitmaps
+	 * Consists of 2 bytes
+	 */
+	uint8_t bdt_bitmaps[ 2 ];
+
+	/* The data Record Relocation Vector (RRV) bucket position
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_rrv_bucket_position[ 4 ];
+
+	/* The first data Record Relocation Vector (RRV) identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t first_data_rrv_identifier[ 4 ];
+
+	/* The (next) available data Record Relocation Vector (RRV) identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t available_data_rrv_identifier[ 4 ];
+
+	/* The number of available data Record Relocation Vectors (RRVs)
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_available_data_rrvs[ 2 ];
+
+	/* The Record Relocation Vector (RRV) bucket size
+	 * Consists of 2 bytes
+	 */
+	uint8_t rrv_bucket_size[ 2 ];
+
+	/* The summary bucket size
+	 * Consists of 2 bytes
+	 */
+	uint8_t summary_bucket_size[ 2 ];
+
+	/* The bitmap size
+	 * Consists of 2 bytes
+	 */
+	uint8_t bitmap_size[ 2 ];
+
+	/* The allocation granularity
+	 * Consists of 2 bytes
+	 */
+	uint8_t allocation_granularity[ 2 ];
+
+	/* The extension granularity
+	 * Consists of 4 bytes
+	 */
+	uint8_t extension_granularity[ 4 ];
+
+	/* File size
+	 * Consists of 4 bytes
+	 * Contains a file size in 256 byte increments
+	 */
+	uint8_t file_size[ 4 ];
+
+	/* The number of file truncations
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_file_truncations[ 4 ];
+
+	/* Delivery sequence number
+	 * Consists of 4 bytes
+	 */
+	uint8_t delivery_sequence_number[ 4 ];
+
+	/* The number of Bucket Descriptor Block (BDB) replacements
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_bdb_replacements[ 4 ];
+
+	/* The number of allocated Record Relocation Vectors (RRVs)
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_allocated_rrvs[ 4 ];
+
+	/* The number of de-allocations
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_deallocations[ 4 ];
+
+	/* The number of non-bucket allocations
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_non_bucket_allocations[ 4 ];
+
+	/* The number of bucket allocations
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_bucket_allocations[ 4 ];
+
+	/* The folder (last) modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t folder_modification_time[ 8 ];
+
+	/* The data note identifier table position
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_note_identifier_table_position[ 4 ];
+
+	/* The data note identifier table size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_note_identifier_table_size[ 4 ];
+
+	/* The data (last) modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t data_modification_time[ 8 ];
+
+	/* The next purge date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t next_purge_time[ 8 ];
+
+	/* Version 3 named object hash position
+	 * Consists of 4 bytes
+	 */
+	uint8_t named_object_hash_position_version3[ 4 ];
+
+	/* Named object hash position
+	 * Consists of 4 bytes
+	 */
+	uint8_t named_object_hash_position[ 4 ];
+
+	/* The private (last) modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t private_modification_time[ 8 ];
+
+	/* The maximum number of privates
+	 * Consists of 2 bytes
+	 */
+	uint8_t maximum_number_of_privates[ 2 ];
+
+	/* Named object hash version
+	 * Consists of 2 bytes
+	 */
+	uint8_t named_object_hash_version[ 2 ];
+
+	/* The non-data (last) modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t non_data_modification_time[ 8 ];
+};
+
+typedef struct nsfdb_database_replication_information nsfdb_database_replication_information_t;
+
+struct nsfdb_database_replication_information
+{
+	/* Replication identifier
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value used as an identifier
+	 */
+	uint8_t replication_identifier[ 8 ];
+
+	/* Replication flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t replication_flags[ 2 ];
+
+	/* Replication cutoff interval
+	 * Consists of 2 bytes
+	 * Contains number of days
+	 */
+	uint8_t replication_cutoff_interval[ 2 ];
+
+	/* Replication cutoff date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t replication_cutoff_time[ 8 ];
+};
+
+typedef struct nsfdb_database_header nsfdb_database_header_t;
+
+struct nsfdb_database_header
+{
+	/* The database information buffer
+	 * Consists of 128 bytes
+	 */
+	uint8_t database_information_buffer[ 128 ];
+
+	/* The special note identifiers
+	 * Consists of 128 bytes
+	 */
+	uint8_t special_note_identifiers[ 128 ];
+
+	/* Unknown (padding)
+	 * Consists of 64 bytes
+	 */
+	uint8_t unknown1[ 64 ];
+};
+
+typedef struct nsfdb_database_information2 nsfdb_database_information2_t;
+
+struct nsfdb_database_information2
+{
+	/* Last fix-up date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t last_fixup_time[ 8 ];
+
+	/* Database quota limit
+	 * Consists of 4 bytes
+	 */
+	uint8_t database_quota_limit[ 4 ];
+
+	/* Database quota warn threshold
+	 * Consists of 16 bytes
+	 */
+	uint8_t database_quota_warn_threshold[ 4 ];
+
+	/* Unknown date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t unknown_time1[ 8 ];
+
+	/* Unknown date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t unknown_time2[ 8 ];
+
+	/* Object store replica identifier
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value used as an identifier
+	 */
+	uint8_t object_store_replica_identifier[ 8 ];
+
+	/* Superblock 1 position
+	 * Consists of 4 bytes
+	 */
+	uint8_t superblock1_position[ 4 ];
+
+	/* Superblock 1 size
+	 * Consists of 4 bytes
+	 */
+	uint8_t superblock1_size[ 4 ];
+
+	/* Superblock 2 position
+	 * Consists of 4 bytes
+	 */
+	uint8_t superblock2_position[ 4 ];
+
+	/* Superblock 2 size
+	 * Consists of 4 bytes
+	 */
+	uint8_t superblock2_size[ 4 ];
+
+	/* Superblock 3 position
+	 * Consists of 4 bytes
+	 */
+	uint8_t superblock3_position[ 4 ];
+
+	/* Superblock 3 size
+	 * Consists of 4 bytes
+	 */
+	uint8_t superblock3_size[ 4 ];
+
+	/* Superblock 4 position
+	 * Consists of 4 bytes
+	 */
+	uint8_t superblock4_position[ 4 ];
+
+	/* Superblock 4 size
+	 * Consists of 4 bytes
+	 */
+	uint8_t superblock4_size[ 4 ];
+
+	/* Maximum extension granularity
+	 * Consists of 4 bytes
+	 */
+	uint8_t maximum_extension_granularity[ 4 ];
+
+	/* Summary bucket granularity
+	 * Consists of 2 bytes
+	 */
+	uint8_t summary_bucket_granularity[ 2 ];
+
+	/* Non-summary bucket granularity
+	 * Consists of 2 bytes
+	 */
+	uint8_t non_summary_bucket_granularity[ 2 ];
+
+	/* Minimum summary bucket size
+	 * Consists of 4 bytes
+	 */
+	uint8_t minimum_summary_bucket_size[ 4 ];
+
+	/* Minimum non-summary bucket size
+	 * Consists of 4 bytes
+	 */
+	uint8_t minimum_non_summary_bucket_size[ 4 ];
+
+	/* Maximum summary bucket size
+	 * Consists of 4 bytes
+	 */
+	uint8_t maximum_summary_bucket_size[ 4 ];
+
+	/* Maximum non-summary bucket size
+	 * Consists of 4 bytes
+	 */
+	uint8_t maximum_non_summary_bucket_size[ 4 ];
+
+	/* Non-summary append size
+	 * Consists of 2 bytes
+	 */
+	uint8_t non_summary_append_size[ 2 ];
+
+	/* Non-summary append factor
+	 * Consists of 2 bytes
+	 */
+	uint8_t non_summary_append_factor[ 2 ];
+
+	/* Summary bucket fill factor
+	 * Consists of 2 bytes
+	 */
+	uint8_t summary_bucket_fill_factor[ 2 ];
+
+	/* Non-summary bucket fill factor
+	 * Consists of 2 bytes
+	 */
+	uint8_t non_summary_bucket_fill_factor[ 2 ];
+
+	/* Bucket Descriptor Block (BDB) 1 size
+	 * Consists of 4 bytes
+	 */
+	uint8_t bucket_descriptor_block1_size[ 4 ];
+
+	/* Bucket Descriptor Block (BDB) 1 position
+	 * Consists of 4 bytes
+	 */
+	uint8_t bucket_descriptor_block1_position[ 4 ];
+
+	/* Bucket Descriptor Block (BDB) 2 size
+	 * Consists of 4 bytes
+	 */
+	uint8_t bucket_descriptor_block2_size[ 4 ];
+
+	/* Bucket Descriptor Block (BDB) 2 position
+	 * Consists of 4 bytes
+	 */
+	uint8_t bucket_descriptor_block2_position[ 4 ];
+
+	/* Unknown
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown2[ 4 ];
+};
+
+typedef struct nsfdb_superblock_header nsfdb_superblock_header_t;
+
+struct nsfdb_superblock_header
+{
+	/* The signature
+	 * Consists of 2 bytes
+	 * Contains 0x0e 0x00
+	 */
+	uint8_t signature[ 2 ];
+
+	/* Modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* The uncompressed size
+	 * Consists of 4 bytes
+	 */
+	uint8_t uncompressed_size[ 4 ];
+
+	/* The number of summary buckets
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_summary_buckets[ 4 ];
+
+	/* The number of non-summary buckets
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_non_summary_buckets[ 4 ];
+
+	/* The number of bitmaps
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_bitmaps[ 4 ];
+
+	/* The Record Relocation Vector (RRV) bucket size
+	 * Consists of 4 bytes
+	 */
+	uint8_t rrv_bucket_size[ 4 ];
+
+	/* The data Record Relocation Vector (RRV) bucket position
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_rrv_bucket_position[ 4 ];
+
+	/* The Record Relocation Vector (RRV) identifier low
+	 * Consists of 4 bytes
+	 */
+	uint8_t rrv_identifier_low[ 4 ];
+
+	/* The Record Relocation Vector (RRV) identifier high
+	 * Consists of 4 bytes
+	 */
+	uint8_t rrv_identifier_high[ 4 ];
+
+	/* The bitmap size
+	 * Consists of 4 bytes
+	 */
+	uint8_t bitmap_size[ 4 ];
+
+	/* The data note identifier table size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_note_identifier_table_size[ 4 ];
+
+	/* The modified note log size
+	 * Consists of 4 bytes
+	 */
+	uint8_t modified_note_log_size[ 4 ];
+
+	/* The Folder Directory Object (FDO) size
+	 * Consists of 4 bytes
+	 */
+	uint8_t folder_directory_object_size[ 4 ];
+
+	/* Flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t flags[ 2 ];
+
+	/* The write count
+	 * Consists of 4 bytes
+	 */
+	uint8_t write_count[ 4 ];
+
+	/* The size of the superblock
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The compression type
+	 * Consists of 2 bytes
+	 */
+	uint8_t compression_type[ 2 ];
+
+	/* The number of summary bucket descriptor pages
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_summary_bucket_descriptor_pages[ 4 ];
+
+	/* The number of non-summary bucket descriptor pages
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_non_summary_bucket_descriptor_pages[ 4 ];
+
+	/* The number of soft deleted note entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_soft_deleted_note_entries[ 4 ];
+
+	/* The shared template information size
+	 * Consists of 2 bytes
+	 */
+	uint8_t shared_template_information_size[ 2 ];
+
+	/* Unknown (reserved)
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown1[ 2 ];
+
+	/* The number of form names
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_form_names[ 2 ];
+
+	/* The form bitmap size
+	 * Consists of 4 bytes
+	 */
+	uint8_t form_bitmap_size[ 4 ];
+
+	/* Unknown
+	 * Consists of 8 bytes
+	 */
+	uint8_t unknown2[ 8 ];
+};
+
+typedef struct nsfdb_superblock_footer nsfdb_superblock_footer_t;
+
+struct nsfdb_superblock_footer
+{
+	/* Modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 * Contains a 32-bit XOR of the superblock information data
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct nsfdb_bucket_descriptor_block_header nsfdb_bucket_descriptor_block_header_t;
+
+struct nsfdb_bucket_descriptor_block_header
+{
+	/* The signature
+	 * Consists of 2 bytes
+	 * Contains 0x01 0x00
+	 */
+	uint8_t signature[ 2 ];
+
+	/* The version
+	 * Consists of 2 bytes
+	 */
+	uint8_t version[ 2 ];
+
+	/* The compression type
+	 * Consists of 2 bytes
+	 */
+	uint8_t compression_type[ 2 ];
+
+	/* The uncompressed size
+	 * Consists of 4 bytes
+	 */
+	uint8_t uncompressed_size[ 4 ];
+
+	/* The write count
+	 * Consists of 4 bytes
+	 */
+	uint8_t write_count[ 4 ];
+
+	/* The size of the bucket descriptor block
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* Modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* The number of Unique Name Keys (UNKs)
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_unique_name_keys[ 4 ];
+
+	/* Unknown
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+
+	/* The Unique Name Key (UNK) text size
+	 * Consists of 4 bytes
+	 */
+	uint8_t unique_name_key_text_size[ 4 ];
+
+	/* The number of Record Relocation Vector (RRV) bucket descriptors
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_rrv_bucket_descriptors[ 4 ];
+
+	/* The number of Unique Name Key (UNK) hash table entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_unk_hash_table_entries[ 4 ];
+
+	/* Unknown
+	 * Consists of 8 bytes
+	 */
+	uint8_t unknown2[ 8 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 * Contains a 32-bit XOR of the bucket descriptor block header
+	 * without the checksum itself
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* Unknown
+	 * Consists of 8 bytes
+	 */
+	uint8_t unknown3[ 8 ];
+};
+
+typedef struct nsfdb_bucket_descriptor_block_footer nsfdb_bucket_descriptor_block_footer_t;
+
+struct nsfdb_bucket_descriptor_block_footer
+{
+	/* Modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 * Contains a 32-bit XOR of the bucket descriptor block information data
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct nsfdb_summary_bucket_page_descriptor nsfdb_summary_bucket_page_descriptor_t;
+
+struct nsfdb_summary_bucket_page_descriptor
+{
+	/* Modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* Largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t largest_number_of_free_bytes;
+
+	/* Second largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t second_largest_number_of_free_bytes;
+};
+
+typedef struct nsfdb_summary_bucket_group_descriptor nsfdb_summary_bucket_group_descriptor_t;
+
+struct nsfdb_summary_bucket_group_descriptor
+{
+	/* Modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* Largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t largest_number_of_free_bytes;
+
+	/* Second largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t second_largest_number_of_free_bytes;
+};
+
+typedef struct nsfdb_summary_bucket_descriptor nsfdb_summary_bucket_descriptor_t;
+
+struct nsfdb_summary_bucket_descriptor
+{
+	/* File position
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_position[ 4 ];
+
+	/* Modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* Largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t largest_number_of_free_bytes;
+
+	/* Second largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t second_largest_number_of_free_bytes;
+};
+
+typedef struct nsfdb_non_summary_bucket_page_descriptor nsfdb_non_summary_bucket_page_descriptor_t;
+
+struct nsfdb_non_summary_bucket_page_descriptor
+{
+	/* Largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t largest_number_of_free_bytes;
+
+	/* Second largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t second_largest_number_of_free_bytes;
+};
+
+typedef struct nsfdb_non_summary_bucket_group_descriptor nsfdb_non_summary_bucket_group_descriptor_t;
+
+struct nsfdb_non_summary_bucket_group_descriptor
+{
+	/* Largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t largest_number_of_free_bytes;
+
+	/* Second largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t second_largest_number_of_free_bytes;
+};
+
+typedef struct nsfdb_non_summary_bucket_descriptor nsfdb_non_summary_bucket_descriptor_t;
+
+struct nsfdb_non_summary_bucket_descriptor
+{
+	/* File position
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_position[ 4 ];
+
+	/* Largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t largest_number_of_free_bytes;
+
+	/* Second largest number of free bytes
+	 * Consists of 1 byte
+	 */
+	uint8_t second_largest_number_of_free_bytes;
+};
+
+typedef struct nsfdb_rrv_bucket_header nsfdb_rrv_bucket_header_t;
+
+struct nsfdb_rrv_bucket_header
+{
+	/* The signature
+	 * Consists of 1 byte
+	 * Contains 0x06
+	 */
+	uint8_t signature;
+
+	/* The header size
+	 * Consists of 1 byte
+	 */
+	uint8_t header_size;
+
+	/* Unknown
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+
+	/* Initial RRV identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t initial_rrv_identifier[ 4 ];
+
+	/* Unknown
+	 * Consists of 6 bytes
+	 */
+	uint8_t unknown2[ 6 ];
+
+	/* Unknown size
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown_size[ 2 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 * Contains a 32-bit XOR of the RRV bucket
+	 * without the checksum itself
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* Unknown
+	 * Consists of 10 bytes
+	 */
+	uint8_t unknown3[ 10 ];
+};
+
+typedef struct nsfdb_bucket_header nsfdb_bucket_header_t;
+
+struct nsfdb_bucket_header
+{
+	/* The signature
+	 * Consists of 1 byte
+	 * Contains 0x02
+	 */
+	uint8_t signature;
+
+	/* The header size
+	 * Consists of 1 byte
+	 */
+	uint8_t header_size;
+
+	/* Unknown
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+
+	/* The bucket size
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* Modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* Unknown
+	 * Consists of 20 bytes
+	 */
+	uint8_t unknown2[ 20 ];
+
+	/* Unknown
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown3[ 2 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 * Contains a 32-bit XOR of the bucket header
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* The number of slots
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_slots[ 4 ];
+
+	/* Unknown
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown4[ 2 ];
+
+	/* Footer size
+	 * Consists of 4 bytes
+	 */
+	uint8_t footer_size[ 4 ];
+
+	/* Unknown
+	 * Consists of 12 bytes
+	 */
+	uint8_t unknown5[ 12 ];
+};
+
+typedef struct nsfdb_bucket_footer nsfdb_bucket_footer_t;
+
+struct nsfdb_bucket_footer
+{
+	/* Modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* Checksum
+	 * Consists of 4 bytes
+	 * Contains a 32-bit XOR of the bucket data
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct nsfdb_note_header nsfdb_note_header_t;
+
+struct nsfdb_note_header
+{
+	/* The signature
+	 * Consists of 2 bytes
+	 * Contains 0x0004
+	 */
+	uint8_t signature[ 2 ];
+
+	/* The size of the note
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The RRV identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t rrv_identifier[ 4 ];
+
+	/* File identifier
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value used as an identifier
+	 */
+	uint8_t file_identifier[ 8 ];
+
+	/* Note identifier
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value used as an identifier
+	 */
+	uint8_t note_identifier[ 8 ];
+
+	/* The sequence number
+	 * Consists of 4 bytes
+	 */
+	uint8_t sequence_number[ 4 ];
+
+	/* The sequence date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t sequence_time[ 8 ];
+
+	/* Status flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t status_flags[ 2 ];
+
+	/* The note class
+	 * Consists of 2 bytes
+	 */
+	uint8_t note_class[ 2 ];
+
+	/* The (last) modification date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* The number of note items
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_note_items[ 2 ];
+
+	/* Unknown
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown1[ 2 ];
+
+	/* The number of responses
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_responses[ 2 ];
+
+	/* The non-summary data identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t non_summary_data_identifier[ 4 ];
+
+	/* The non-summary data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t non_summary_data_size[ 4 ];
+
+	/* The (last) access date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t access_time[ 8 ];
+
+	/* The (file) creation date and time
+	 * Consists of 8 bytes
+	 * Contains a NSF timedate value
+	 */
+	uint8_t creation_time[ 8 ];
+
+	/* The parent note identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t parent_note_identifier[ 4 ];
+
+	/* Unknown
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown3[ 2 ];
+
+	/* The folder reference count
+	 * Consists of 4 bytes
+	 */
+	uint8_t folder_reference_count[ 4 ];
+
+	/* Unknown
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown4[ 4 ];
+
+	/* The folder note identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t folder_note_identifier[ 4 ];
+
+	/* Unknown
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown5[ 2 ];
+};
+
+typedef struct nsfdb_note_item nsfdb_note_item_t;
+
+struct nsfdb_note_item
+{
+	/* The unique name key (UNK) table index
+	 * Consists of 2 bytes
+	 */
+	uint8_t unk_table_index[ 2 ];
+
+	/* The field flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t field_flags[ 2 ];
+
+	/* The data size
+	 * Consists of 2 bytes
+	 */
+	uint8_t data_size[ 2 ];
+
+	/* Unknown
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown1[ 2 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _GENERATE_FORMAT_H ) */
+
@@ -0,0 +1,3682 @@
+/*
+ * Generate handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "generate_format.h"
+#include "generate_handle.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcfile.h"
+#include "nsfdbtools_libnsfdb.h"
+
+#define GENERATE_HANDLE_NOTIFY_STREAM				stdout
+
+/* The size of the database header
+ */
+#define GENERATE_HANDLE_DATABASE_HEADER_SIZE			1024
+
+/* The size of the summary and non-summary buckets
+ * The bucket index stores 16-bit slot offsets hence the size must be smaller than 64 KiB
+ */
+#define GENERATE_HANDLE_BUCKET_SIZE				16384
+
+/* The size of the RRV buckets
+ */
+#define GENERATE_HANDLE_RRV_BUCKET_SIZE				4096
+
+/* The number of RRV entries in a RRV bucket
+ */
+#define GENERATE_HANDLE_NUMBER_OF_RRV_BUCKET_ENTRIES		( ( GENERATE_HANDLE_RRV_BUCKET_SIZE - 32 ) / 8 )
+
+/* The size of the bitmap
+ */
+#define GENERATE_HANDLE_BITMAP_SIZE				8192
+
+/* The maximum number of buckets that fit in a single bucket descriptor page of the superblock
+ */
+#define GENERATE_HANDLE_MAXIMUM_NUMBER_OF_SUMMARY_BUCKETS	( 7982 / 14 )
+#define GENERATE_HANDLE_MAXIMUM_NUMBER_OF_NON_SUMMARY_BUCKETS	( 8128 / 6 )
+
+/* The maximum number of slots that can be referenced by a bucket slot identifier (BSID)
+ * and a non-summary data identifier
+ */
+#define GENERATE_HANDLE_MAXIMUM_NUMBER_OF_SUMMARY_SLOTS		0x000007ffUL
+#define GENERATE_HANDLE_MAXIMUM_NUMBER_OF_NON_SUMMARY_SLOTS	0x0000007fUL
+
+/* The words used to generate text
+ */
+const char *generate_handle_words[ 16 ] = {
+	"the", "meeting", "notes", "database", "replication", "server", "agenda", "of",
+	"mail", "please", "review", "attached", "document", "and", "schedule", "update" };
+
+/* Creates a bucket
+ * Make sure the value bucket is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_bucket_initialize(
+     generate_handle_bucket_t **bucket,
+     size_t data_size,
+     uint32_t maximum_number_of_slots,
+     uint32_t maximum_number_of_buckets,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_bucket_initialize";
+
+	if( bucket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bucket != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bucket value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) 65536 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_buckets == 0 )
+	 || ( (size_t) maximum_number_of_buckets > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*bucket = memory_allocate_structure(
+	           generate_handle_bucket_t );
+
+	if( *bucket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bucket,
+	     0,
+	     sizeof( generate_handle_bucket_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bucket.",
+		 function );
+
+		memory_free(
+		 *bucket );
+
+		*bucket = NULL;
+
+		return( -1 );
+	}
+	( *bucket )->data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * data_size );
+
+	if( ( *bucket )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *bucket )->data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	( *bucket )->file_positions = (uint32_t *) memory_allocate(
+	                                            sizeof( uint32_t ) * maximum_number_of_buckets );
+
+	if( ( *bucket )->file_positions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file positions.",
+		 function );
+
+		goto on_error;
+	}
+	( *bucket )->data_size                 = data_size;
+	( *bucket )->maximum_number_of_slots   = maximum_number_of_slots;
+	( *bucket )->maximum_number_of_buckets = maximum_number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( *bucket != NULL )
+	{
+		if( ( *bucket )->data != NULL )
+		{
+			memory_free(
+			 ( *bucket )->data );
+		}
+		memory_free(
+		 *bucket );
+
+		*bucket = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a bucket
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_bucket_free(
+     generate_handle_bucket_t **bucket,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_bucket_free";
+
+	if( bucket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bucket != NULL )
+	{
+		if( ( *bucket )->file_positions != NULL )
+		{
+			memory_free(
+			 ( *bucket )->file_positions );
+		}
+		if( ( *bucket )->data != NULL )
+		{
+			memory_free(
+			 ( *bucket )->data );
+		}
+		memory_free(
+		 *bucket );
+
+		*bucket = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates a generate handle
+ * Make sure the value generate_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_initialize(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_initialize";
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generate_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generate handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*generate_handle = memory_allocate_structure(
+	                    generate_handle_t );
+
+	if( *generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create generate handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *generate_handle,
+	     0,
+	     sizeof( generate_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear generate handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *generate_handle )->number_of_notes          = 1000;
+	( *generate_handle )->number_of_non_data_notes = 8;
+	( *generate_handle )->number_of_items          = 8;
+	( *generate_handle )->summary_percentage       = 50;
+	( *generate_handle )->text_percentage          = 50;
+	( *generate_handle )->maximum_text_size        = 64;
+	( *generate_handle )->bucket_fill              = 90;
+	( *generate_handle )->seed                     = 1;
+	( *generate_handle )->notify_stream            = GENERATE_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *generate_handle != NULL )
+	{
+		memory_free(
+		 *generate_handle );
+
+		*generate_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a generate handle
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_free(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_free";
+	int result            = 1;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generate_handle != NULL )
+	{
+		if( ( *generate_handle )->output_file != NULL )
+		{
+			if( generate_handle_close_output(
+			     *generate_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( generate_handle_bucket_free(
+		     &( ( *generate_handle )->summary_bucket ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free summary bucket.",
+			 function );
+
+			result = -1;
+		}
+		if( generate_handle_bucket_free(
+		     &( ( *generate_handle )->non_summary_bucket ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free non-summary bucket.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *generate_handle )->rrv_bucket_descriptors_data != NULL )
+		{
+			memory_free(
+			 ( *generate_handle )->rrv_bucket_descriptors_data );
+		}
+		if( ( *generate_handle )->rrv_entries_data != NULL )
+		{
+			memory_free(
+			 ( *generate_handle )->rrv_entries_data );
+		}
+		if( ( *generate_handle )->non_summary_data != NULL )
+		{
+			memory_free(
+			 ( *generate_handle )->non_summary_data );
+		}
+		if( ( *generate_handle )->note_data != NULL )
+		{
+			memory_free(
+			 ( *generate_handle )->note_data );
+		}
+		if( ( *generate_handle )->unique_name_key_classes != NULL )
+		{
+			memory_free(
+			 ( *generate_handle )->unique_name_key_classes );
+		}
+		memory_free(
+		 *generate_handle );
+
+		*generate_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the generate handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_signal_abort(
+     generate_handle_t *generate_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_signal_abort";
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	generate_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Copies a 32-bit value from a decimal string
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_copy_from_decimal_string(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_copy_from_decimal_string";
+	size_t string_index   = 0;
+	uint64_t value_64bit  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		value_64bit *= 10;
+		value_64bit += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( value_64bit > (uint64_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*value_32bit = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of data notes
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_notes(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_notes";
+	uint32_t value_32bit  = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of data notes from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit > (uint32_t) 0x00ffffffUL )
+	{
+		return( 0 );
+	}
+	generate_handle->number_of_notes = value_32bit;
+
+	return( 1 );
+}
+
+/* Sets the number of non-data notes
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_non_data_notes(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_non_data_notes";
+	uint32_t value_32bit  = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of non-data notes from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit > (uint32_t) 0x00ffffffUL )
+	{
+		return( 0 );
+	}
+	generate_handle->number_of_non_data_notes = value_32bit;
+
+	return( 1 );
+}
+
+/* Sets the number of items per note
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_items(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_items";
+	uint32_t value_32bit  = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of items from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_32bit == 0 )
+	 || ( value_32bit > 64 ) )
+	{
+		return( 0 );
+	}
+	generate_handle->number_of_items = value_32bit;
+
+	return( 1 );
+}
+
+/* Sets the percentage of items stored in the summary buckets
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_summary_percentage(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_summary_percentage";
+	uint32_t value_32bit  = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy summary percentage from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit > 100 )
+	{
+		return( 0 );
+	}
+	generate_handle->summary_percentage = value_32bit;
+
+	return( 1 );
+}
+
+/* Sets the percentage of text items
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_text_percentage(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_text_percentage";
+	uint32_t value_32bit  = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy text percentage from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit > 100 )
+	{
+		return( 0 );
+	}
+	generate_handle->text_percentage = value_32bit;
+
+	return( 1 );
+}
+
+/* Sets the maximum size of the text of a text item
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_maximum_text_size(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_maximum_text_size";
+	uint32_t value_32bit  = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy maximum text size from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_32bit == 0 )
+	 || ( value_32bit > 1024 ) )
+	{
+		return( 0 );
+	}
+	generate_handle->maximum_text_size = value_32bit;
+
+	return( 1 );
+}
+
+/* Sets the percentage of a bucket that is filled before a new bucket is started
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_bucket_fill(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_bucket_fill";
+	uint32_t value_32bit  = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy bucket fill from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_32bit == 0 )
+	 || ( value_32bit > 100 ) )
+	{
+		return( 0 );
+	}
+	generate_handle->bucket_fill = value_32bit;
+
+	return( 1 );
+}
+
+/* Sets the seed of the pseudo random sequence
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_set_seed(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_seed";
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle_copy_from_decimal_string(
+	     string,
+	     &( generate_handle->seed ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy seed from string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next pseudo random value
+ * Returns a value in the range 0 to maximum_value - 1 or 0 if maximum_value is 0
+ */
+uint32_t generate_handle_get_random_value(
+          generate_handle_t *generate_handle,
+          uint32_t maximum_value )
+{
+	if( ( generate_handle == NULL )
+	 || ( maximum_value == 0 ) )
+	{
+		return( 0 );
+	}
+	generate_handle->random_value = ( generate_handle->random_value * 1103515245UL ) + 12345;
+
+	return( ( generate_handle->random_value >> 8 ) % maximum_value );
+}
+
+/* Opens the output
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_open_output(
+     generate_handle_t *generate_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_open_output";
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle->output_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generate handle - output file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &( generate_handle->output_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     generate_handle->output_file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     generate_handle->output_file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		goto on_error;
+	}
+	generate_handle->output_offset = 0;
+
+	return( 1 );
+
+on_error:
+	if( generate_handle->output_file != NULL )
+	{
+		libcfile_file_free(
+		 &( generate_handle->output_file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the output
+ * Returns the 0 if succesful or -1 on error
+ */
+int generate_handle_close_output(
+     generate_handle_t *generate_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_close_output";
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle->output_file == NULL )
+	{
+		return( 0 );
+	}
+	if( libcfile_file_close(
+	     generate_handle->output_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
+		 function );
+
+		result = -1;
+	}
+	if( libcfile_file_free(
+	     &( generate_handle->output_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Writes a buffer to the output
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_buffer(
+     generate_handle_t *generate_handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_write_buffer";
+	ssize_t write_count   = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libcfile_file_write_buffer(
+	               generate_handle->output_file,
+	               buffer,
+	               buffer_size,
+	               error );
+
+	if( write_count != (ssize_t) buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 generate_handle->output_offset,
+		 generate_handle->output_offset );
+
+		return( -1 );
+	}
+	generate_handle->output_offset += (off64_t) buffer_size;
+
+	return( 1 );
+}
+
+/* Writes padding to the output
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_padding(
+     generate_handle_t *generate_handle,
+     size_t padding_size,
+     libcerror_error_t **error )
+{
+	uint8_t padding_data[ 512 ];
+
+	static char *function = "generate_handle_write_padding";
+	size_t write_size     = 0;
+
+	if( memory_set(
+	     padding_data,
+	     0,
+	     512 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear padding data.",
+		 function );
+
+		return( -1 );
+	}
+	while( padding_size > 0 )
+	{
+		write_size = padding_size;
+
+		if( write_size > 512 )
+		{
+			write_size = 512;
+		}
+		if( generate_handle_write_buffer(
+		     generate_handle,
+		     padding_data,
+		     write_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write padding.",
+			 function );
+
+			return( -1 );
+		}
+		padding_size -= write_size;
+	}
+	return( 1 );
+}
+
+/* Writes padding to the output up to the next multitude of the alignment size
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_alignment_padding(
+     generate_handle_t *generate_handle,
+     size_t alignment_size,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_write_alignment_padding";
+	size_t padding_size   = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( alignment_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid alignment size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	padding_size = (size_t) ( generate_handle->output_offset % alignment_size );
+
+	if( padding_size != 0 )
+	{
+		if( generate_handle_write_padding(
+		     generate_handle,
+		     alignment_size - padding_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write alignment padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a NSF timedate for a specific note number
+ * The notes are spaced 1 minute apart starting at January 1, 2024 00:00:00
+ */
+void generate_handle_get_timedate(
+      uint32_t note_number,
+      uint8_t *timedate )
+{
+	uint64_t number_of_ticks = 0;
+	uint32_t julian_day      = 0;
+	uint32_t time_of_day     = 0;
+
+	if( timedate == NULL )
+	{
+		return;
+	}
+	/* The time of day is stored in 1/100th seconds
+	 */
+	number_of_ticks = (uint64_t) note_number * 6000;
+	time_of_day     = (uint32_t) ( number_of_ticks % 8640000 );
+	julian_day      = 2460311 + (uint32_t) ( number_of_ticks / 8640000 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 timedate,
+	 time_of_day );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( timedate[ 4 ] ),
+	 julian_day & 0x00ffffffUL );
+}
+
+/* Generates the data of a note item
+ * The data consists of a 16-bit data type followed by the value
+ * The item data must be at least 2 + maximum text size bytes of size
+ * Returns the size of the item data
+ */
+size_t generate_handle_generate_item_data(
+        generate_handle_t *generate_handle,
+        uint8_t note_item_class,
+        uint8_t *item_data )
+{
+	byte_stream_float64_t number_value;
+
+	const char *word      = NULL;
+	size_t item_data_size = 0;
+	size_t text_size      = 0;
+	size_t word_index     = 0;
+
+	if( ( generate_handle == NULL )
+	 || ( item_data == NULL ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 item_data,
+	 (uint16_t) note_item_class << 8 );
+
+	item_data_size = 2;
+
+	if( note_item_class == LIBNSFDB_NOTE_ITEM_CLASS_NUMBER )
+	{
+		number_value.floating_point = (double) generate_handle_get_random_value(
+		                                        generate_handle,
+		                                        1000000 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( item_data[ item_data_size ] ),
+		 number_value.integer );
+
+		item_data_size += 8;
+	}
+	else if( note_item_class == LIBNSFDB_NOTE_ITEM_CLASS_TIME )
+	{
+		generate_handle_get_timedate(
+		 generate_handle_get_random_value(
+		  generate_handle,
+		  0x00100000UL ),
+		 &( item_data[ item_data_size ] ) );
+
+		item_data_size += 8;
+	}
+	else
+	{
+		text_size = 1 + (size_t) generate_handle_get_random_value(
+		                          generate_handle,
+		                          generate_handle->maximum_text_size );
+
+		while( text_size > 0 )
+		{
+			word = generate_handle_words[ generate_handle_get_random_value(
+			                               generate_handle,
+			                               16 ) ];
+
+			for( word_index = 0;
+			     ( word[ word_index ] != 0 ) && ( text_size > 0 );
+			     word_index++ )
+			{
+				item_data[ item_data_size++ ] = (uint8_t) word[ word_index ];
+
+				text_size--;
+			}
+			if( text_size > 0 )
+			{
+				item_data[ item_data_size++ ] = (uint8_t) ' ';
+
+				text_size--;
+			}
+		}
+	}
+	return( item_data_size );
+}
+
+/* Writes a bucket
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_bucket(
+     generate_handle_t *generate_handle,
+     generate_handle_bucket_t *bucket,
+     libcerror_error_t **error )
+{
+	nsfdb_bucket_header_t *bucket_header = NULL;
+	static char *function                = "generate_handle_write_bucket";
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket->number_of_slots == 0 )
+	{
+		return( 1 );
+	}
+	if( bucket->number_of_buckets >= bucket->maximum_number_of_buckets )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid bucket - number of buckets value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_header = (nsfdb_bucket_header_t *) bucket->data;
+
+	bucket_header->signature   = 0x02;
+	bucket_header->header_size = (uint8_t) sizeof( nsfdb_bucket_header_t );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_header->size,
+	 (uint32_t) bucket->data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_header->number_of_slots,
+	 bucket->number_of_slots );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_header->footer_size,
+	 (uint32_t) sizeof( nsfdb_bucket_footer_t ) );
+
+	/* The buckets are stored at file positions, which are offsets in units of 256 bytes
+	 */
+	if( generate_handle_write_alignment_padding(
+	     generate_handle,
+	     256,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write alignment padding.",
+		 function );
+
+		return( -1 );
+	}
+	bucket->file_positions[ bucket->number_of_buckets ] = (uint32_t) ( generate_handle->output_offset >> 8 );
+
+	if( generate_handle_write_buffer(
+	     generate_handle,
+	     bucket->data,
+	     bucket->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write bucket: %" PRIu32 ".",
+		 function,
+		 bucket->number_of_buckets + 1 );
+
+		return( -1 );
+	}
+	bucket->number_of_buckets += 1;
+
+	if( memory_set(
+	     bucket->data,
+	     0,
+	     bucket->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bucket data.",
+		 function );
+
+		return( -1 );
+	}
+	bucket->slot_data_offset = 0;
+	bucket->number_of_slots  = 0;
+
+	return( 1 );
+}
+
+/* Appends a slot to a bucket
+ * The bucket is written when the slot does not fit within the bucket fill
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_append_bucket_slot(
+     generate_handle_t *generate_handle,
+     generate_handle_bucket_t *bucket,
+     const uint8_t *slot_data,
+     size_t slot_data_size,
+     uint32_t *bucket_index,
+     uint32_t *slot_index,
+     libcerror_error_t **error )
+{
+	static char *function    = "generate_handle_append_bucket_slot";
+	size_t bucket_fill_size  = 0;
+	size_t index_data_offset = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot data.",
+		 function );
+
+		return( -1 );
+	}
+	/* A bucket consists of the header, the slot data, the slot index and the footer
+	 */
+	if( slot_data_size > ( bucket->data_size - ( sizeof( nsfdb_bucket_header_t ) + 4 + sizeof( nsfdb_bucket_footer_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid slot data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket index.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot index.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket->number_of_slots > 0 )
+	{
+		bucket_fill_size = ( ( bucket->data_size - ( sizeof( nsfdb_bucket_header_t ) + sizeof( nsfdb_bucket_footer_t ) ) )
+		                 * generate_handle->bucket_fill ) / 100;
+
+		if( ( bucket->number_of_slots >= bucket->maximum_number_of_slots )
+		 || ( ( bucket->slot_data_offset + slot_data_size + ( ( bucket->number_of_slots + 1 ) * 4 ) ) > ( sizeof( nsfdb_bucket_header_t ) + bucket_fill_size ) ) )
+		{
+			if( generate_handle_write_bucket(
+			     generate_handle,
+			     bucket,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write bucket.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( bucket->number_of_slots == 0 )
+	{
+		bucket->slot_data_offset = sizeof( nsfdb_bucket_header_t );
+	}
+	if( memory_copy(
+	     &( bucket->data[ bucket->slot_data_offset ] ),
+	     slot_data,
+	     slot_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy slot data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The bucket index is stored back to front before the footer
+	 * and contains a 16-bit offset and size per slot
+	 */
+	index_data_offset = bucket->data_size - ( sizeof( nsfdb_bucket_footer_t ) + ( ( bucket->number_of_slots + 1 ) * 4 ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( bucket->data[ index_data_offset ] ),
+	 (uint16_t) bucket->slot_data_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( bucket->data[ index_data_offset + 2 ] ),
+	 (uint16_t) slot_data_size );
+
+	bucket->slot_data_offset += slot_data_size;
+	bucket->number_of_slots  += 1;
+
+	*bucket_index = bucket->number_of_buckets + 1;
+	*slot_index   = bucket->number_of_slots;
+
+	return( 1 );
+}
+
+/* Writes a note
+ * The summary items are stored in a summary bucket slot and the non-summary items in a non-summary bucket slot
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_note(
+     generate_handle_t *generate_handle,
+     uint16_t note_class,
+     uint32_t rrv_identifier,
+     uint32_t note_number,
+     libcerror_error_t **error )
+{
+	uint8_t item_data[ 2 + 1024 ];
+
+	nsfdb_note_header_t *note_header     = NULL;
+	nsfdb_note_item_t *note_item         = NULL;
+	uint8_t *rrv_entry_data              = NULL;
+	static char *function                = "generate_handle_write_note";
+	size_t item_data_size                = 0;
+	size_t non_summary_data_size         = 0;
+	size_t note_data_size                = 0;
+	uint32_t bucket_index                = 0;
+	uint32_t item_index                  = 0;
+	uint32_t non_summary_data_identifier = 0;
+	uint32_t slot_index                  = 0;
+	uint16_t field_flags                 = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle->note_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid generate handle - missing note data.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle->maximum_text_size > 1024 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid generate handle - maximum text size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     generate_handle->note_data,
+	     0,
+	     GENERATE_HANDLE_BUCKET_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear note data.",
+		 function );
+
+		return( -1 );
+	}
+	note_data_size = sizeof( nsfdb_note_header_t )
+	               + ( sizeof( nsfdb_note_item_t ) * generate_handle->number_of_items );
+
+	for( item_index = 0;
+	     item_index < generate_handle->number_of_items;
+	     item_index++ )
+	{
+		item_data_size = generate_handle_generate_item_data(
+		                  generate_handle,
+		                  generate_handle->unique_name_key_classes[ item_index ],
+		                  item_data );
+
+		if( generate_handle_get_random_value(
+		     generate_handle,
+		     100 ) < generate_handle->summary_percentage )
+		{
+			field_flags = NSFDB_NOTE_ITEM_FLAG_SUMMARY;
+
+			if( ( note_data_size + item_data_size ) > GENERATE_HANDLE_BUCKET_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: note data size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( generate_handle->note_data[ note_data_size ] ),
+			     item_data,
+			     item_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy item: %" PRIu32 " data.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+			note_data_size += item_data_size;
+		}
+		else
+		{
+			field_flags = 0;
+
+			if( ( non_summary_data_size + item_data_size ) > GENERATE_HANDLE_BUCKET_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: non-summary data size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( generate_handle->non_summary_data[ non_summary_data_size ] ),
+			     item_data,
+			     item_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy item: %" PRIu32 " data.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+			non_summary_data_size += item_data_size;
+		}
+		note_item = (nsfdb_note_item_t *) &( generate_handle->note_data[ sizeof( nsfdb_note_header_t ) + ( sizeof( nsfdb_note_item_t ) * item_index ) ] );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 note_item->unk_table_index,
+		 (uint16_t) item_index );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 note_item->field_flags,
+		 field_flags );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 note_item->data_size,
+		 (uint16_t) item_data_size );
+	}
+	if( non_summary_data_size > 0 )
+	{
+		if( generate_handle_append_bucket_slot(
+		     generate_handle,
+		     generate_handle->non_summary_bucket,
+		     generate_handle->non_summary_data,
+		     non_summary_data_size,
+		     &bucket_index,
+		     &slot_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append non-summary bucket slot.",
+			 function );
+
+			return( -1 );
+		}
+		non_summary_data_identifier = 0x80000000UL
+		                            | ( slot_index << 24 )
+		                            | bucket_index;
+	}
+	note_header = (nsfdb_note_header_t *) generate_handle->note_data;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 note_header->signature,
+	 0x0004 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 note_header->size,
+	 (uint32_t) note_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 note_header->rrv_identifier,
+	 rrv_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 note_header->note_identifier,
+	 generate_handle_get_random_value(
+	  generate_handle,
+	  0xffffffffUL ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( note_header->note_identifier[ 4 ] ),
+	 note_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 note_header->sequence_number,
+	 1 );
+
+	generate_handle_get_timedate(
+	 note_number,
+	 note_header->sequence_time );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 note_header->note_class,
+	 note_class );
+
+	generate_handle_get_timedate(
+	 note_number,
+	 note_header->modification_time );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 note_header->number_of_note_items,
+	 (uint16_t) generate_handle->number_of_items );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 note_header->non_summary_data_identifier,
+	 non_summary_data_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 note_header->non_summary_data_size,
+	 (uint32_t) non_summary_data_size );
+
+	generate_handle_get_timedate(
+	 note_number,
+	 note_header->access_time );
+
+	generate_handle_get_timedate(
+	 note_number,
+	 note_header->creation_time );
+
+	if( generate_handle_append_bucket_slot(
+	     generate_handle,
+	     generate_handle->summary_bucket,
+	     generate_handle->note_data,
+	     note_data_size,
+	     &bucket_index,
+	     &slot_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append summary bucket slot.",
+		 function );
+
+		return( -1 );
+	}
+	/* The RRV entry contains a bucket slot identifier (BSID)
+	 */
+	rrv_entry_data = &( generate_handle->rrv_entries_data[ generate_handle->number_of_rrv_entries * 8 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 rrv_entry_data,
+	 0x80000000UL | bucket_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( rrv_entry_data[ 4 ] ),
+	 slot_index );
+
+	generate_handle->number_of_rrv_entries += 1;
+
+	return( 1 );
+}
+
+/* Writes the RRV buckets of a range of RRV entries
+ * At least 1 RRV bucket is written
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_rrv_buckets(
+     generate_handle_t *generate_handle,
+     uint32_t first_rrv_entry_index,
+     uint32_t number_of_rrv_entries,
+     uint32_t initial_rrv_identifier,
+     uint8_t is_non_data,
+     uint32_t *first_rrv_bucket_position,
+     libcerror_error_t **error )
+{
+	uint8_t rrv_bucket_data[ GENERATE_HANDLE_RRV_BUCKET_SIZE ];
+
+	nsfdb_rrv_bucket_header_t *rrv_bucket_header = NULL;
+	uint8_t *rrv_bucket_descriptor_data          = NULL;
+	static char *function                        = "generate_handle_write_rrv_buckets";
+	size_t rrv_entries_data_size                 = 0;
+	uint32_t calculated_checksum                 = 0;
+	uint32_t number_of_bucket_entries            = 0;
+	uint32_t rrv_bucket_position                 = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (uint64_t) first_rrv_entry_index + number_of_rrv_entries ) > (uint64_t) generate_handle->number_of_rrv_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of RRV entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_rrv_bucket_position == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first RRV bucket position.",
+		 function );
+
+		return( -1 );
+	}
+	*first_rrv_bucket_position = 0;
+
+	do
+	{
+		if( generate_handle->abort != 0 )
+		{
+			return( -1 );
+		}
+		number_of_bucket_entries = number_of_rrv_entries;
+
+		if( number_of_bucket_entries > GENERATE_HANDLE_NUMBER_OF_RRV_BUCKET_ENTRIES )
+		{
+			number_of_bucket_entries = GENERATE_HANDLE_NUMBER_OF_RRV_BUCKET_ENTRIES;
+		}
+		rrv_entries_data_size = (size_t) number_of_bucket_entries * 8;
+
+		if( memory_set(
+		     rrv_bucket_data,
+		     0,
+		     GENERATE_HANDLE_RRV_BUCKET_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear RRV bucket data.",
+			 function );
+
+			return( -1 );
+		}
+		if( rrv_entries_data_size > 0 )
+		{
+			if( memory_copy(
+			     &( rrv_bucket_data[ sizeof( nsfdb_rrv_bucket_header_t ) ] ),
+			     &( generate_handle->rrv_entries_data[ first_rrv_entry_index * 8 ] ),
+			     rrv_entries_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy RRV entries data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		rrv_bucket_header = (nsfdb_rrv_bucket_header_t *) rrv_bucket_data;
+
+		rrv_bucket_header->signature   = 0x06;
+		rrv_bucket_header->header_size = (uint8_t) sizeof( nsfdb_rrv_bucket_header_t );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 rrv_bucket_header->initial_rrv_identifier,
+		 initial_rrv_identifier );
+
+		if( libnsfdb_calculate_xor32_checksum(
+		     &calculated_checksum,
+		     &( rrv_bucket_data[ sizeof( nsfdb_rrv_bucket_header_t ) ] ),
+		     GENERATE_HANDLE_RRV_BUCKET_SIZE - sizeof( nsfdb_rrv_bucket_header_t ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate checksum.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 rrv_bucket_header->checksum,
+		 calculated_checksum );
+
+		/* The RRV buckets are read as elements of a vector hence they must be aligned to the RRV bucket size
+		 */
+		if( generate_handle_write_alignment_padding(
+		     generate_handle,
+		     GENERATE_HANDLE_RRV_BUCKET_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write alignment padding.",
+			 function );
+
+			return( -1 );
+		}
+		rrv_bucket_position = (uint32_t) ( generate_handle->output_offset >> 8 );
+
+		if( generate_handle_write_buffer(
+		     generate_handle,
+		     rrv_bucket_data,
+		     GENERATE_HANDLE_RRV_BUCKET_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write RRV bucket.",
+			 function );
+
+			return( -1 );
+		}
+		if( *first_rrv_bucket_position == 0 )
+		{
+			*first_rrv_bucket_position = rrv_bucket_position;
+		}
+		/* The lower bit of the RRV bucket descriptor file position indicates a non-data RRV bucket
+		 */
+		rrv_bucket_descriptor_data = &( generate_handle->rrv_bucket_descriptors_data[ generate_handle->number_of_rrv_bucket_descriptors * 8 ] );
+
+		if( is_non_data != 0 )
+		{
+			rrv_bucket_position |= 0x00000001UL;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 rrv_bucket_descriptor_data,
+		 rrv_bucket_position );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( rrv_bucket_descriptor_data[ 4 ] ),
+		 initial_rrv_identifier );
+
+		generate_handle->number_of_rrv_bucket_descriptors += 1;
+
+		first_rrv_entry_index  += number_of_bucket_entries;
+		number_of_rrv_entries  -= number_of_bucket_entries;
+		initial_rrv_identifier += GENERATE_HANDLE_NUMBER_OF_RRV_BUCKET_ENTRIES * 4;
+	}
+	while( number_of_rrv_entries > 0 );
+
+	return( 1 );
+}
+
+/* Writes the superblocks
+ * The same superblock is written 4 times
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_superblocks(
+     generate_handle_t *generate_handle,
+     uint32_t data_rrv_bucket_position,
+     uint32_t first_rrv_identifier,
+     uint32_t last_rrv_identifier,
+     uint32_t *superblock_positions,
+     uint32_t *superblock_size,
+     libcerror_error_t **error )
+{
+	nsfdb_superblock_footer_t *superblock_footer = NULL;
+	nsfdb_superblock_header_t *superblock_header = NULL;
+	uint8_t *superblock_data                     = NULL;
+	uint8_t *uncompressed_data                   = NULL;
+	static char *function                        = "generate_handle_write_superblocks";
+	size_t compressed_data_size                  = 0;
+	size_t superblock_data_size                  = 0;
+	size_t uncompressed_data_offset              = 0;
+	size_t uncompressed_data_size                = 0;
+	uint32_t bucket_iterator                     = 0;
+	uint32_t calculated_checksum                 = 0;
+	uint32_t stored_size                         = 0;
+	int superblock_index                         = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock_positions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock positions.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The uncompressed superblock data contains 1 summary and 1 non-summary bucket descriptor page
+	 */
+	uncompressed_data_size = 8206 + 8198;
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     uncompressed_data,
+	     0,
+	     uncompressed_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	uncompressed_data_offset = 4
+	                         + sizeof( nsfdb_summary_bucket_page_descriptor_t )
+	                         + sizeof( nsfdb_summary_bucket_group_descriptor_t )
+	                         + 200;
+
+	for( bucket_iterator = 0;
+	     bucket_iterator < generate_handle->summary_bucket->number_of_buckets;
+	     bucket_iterator++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (nsfdb_summary_bucket_descriptor_t *) &( uncompressed_data[ uncompressed_data_offset ] ) )->file_position,
+		 generate_handle->summary_bucket->file_positions[ bucket_iterator ] );
+
+		uncompressed_data_offset += sizeof( nsfdb_summary_bucket_descriptor_t );
+	}
+	uncompressed_data_offset = 8206
+	                         + 4
+	                         + sizeof( nsfdb_non_summary_bucket_page_descriptor_t )
+	                         + sizeof( nsfdb_non_summary_bucket_group_descriptor_t )
+	                         + 62;
+
+	for( bucket_iterator = 0;
+	     bucket_iterator < generate_handle->non_summary_bucket->number_of_buckets;
+	     bucket_iterator++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (nsfdb_non_summary_bucket_descriptor_t *) &( uncompressed_data[ uncompressed_data_offset ] ) )->file_position,
+		 generate_handle->non_summary_bucket->file_positions[ bucket_iterator ] );
+
+		uncompressed_data_offset += sizeof( nsfdb_non_summary_bucket_descriptor_t );
+	}
+	if( libnsfdb_cx_get_maximum_compressed_data_size(
+	     uncompressed_data_size,
+	     &compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum compressed data size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The superblock data is padded to a multitude of 256 bytes
+	 */
+	superblock_data_size = sizeof( nsfdb_superblock_header_t )
+	                     + 4
+	                     + compressed_data_size
+	                     + sizeof( nsfdb_superblock_footer_t )
+	                     + 255;
+
+	superblock_data_size &= ~( (size_t) 255 );
+
+	superblock_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * superblock_data_size );
+
+	if( superblock_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create superblock data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     superblock_data,
+	     0,
+	     superblock_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear superblock data.",
+		 function );
+
+		goto on_error;
+	}
+	/* TODO determine the meaning of the first 4 bytes of the compressed data
+	 */
+	if( libnsfdb_cx_compress(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     &( superblock_data[ sizeof( nsfdb_superblock_header_t ) + 4 ] ),
+	     &compressed_data_size,
+	     LIBNSFDB_COMPRESSION_LEVEL_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress superblock data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	if( libnsfdb_calculate_xor32_checksum(
+	     &calculated_checksum,
+	     &( superblock_data[ sizeof( nsfdb_superblock_header_t ) ] ),
+	     4 + compressed_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	stored_size = (uint32_t) ( sizeof( nsfdb_superblock_header_t ) + 4 + compressed_data_size + sizeof( nsfdb_superblock_footer_t ) );
+
+	superblock_header = (nsfdb_superblock_header_t *) superblock_data;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 superblock_header->signature,
+	 0x000e );
+
+	generate_handle_get_timedate(
+	 generate_handle->number_of_non_data_notes + generate_handle->number_of_notes,
+	 superblock_header->modification_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->uncompressed_size,
+	 (uint32_t) uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->number_of_summary_buckets,
+	 generate_handle->summary_bucket->number_of_buckets );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->number_of_non_summary_buckets,
+	 generate_handle->non_summary_bucket->number_of_buckets );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->rrv_bucket_size,
+	 GENERATE_HANDLE_RRV_BUCKET_SIZE );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->data_rrv_bucket_position,
+	 data_rrv_bucket_position );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->rrv_identifier_low,
+	 first_rrv_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->rrv_identifier_high,
+	 last_rrv_identifier );
+
+	/* The bitmaps, data note identifier table, modified note log and folder directory object
+	 * are not generated but their sizes are required to be set
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->bitmap_size,
+	 GENERATE_HANDLE_BITMAP_SIZE );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->data_note_identifier_table_size,
+	 256 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->modified_note_log_size,
+	 256 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->folder_directory_object_size,
+	 256 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->write_count,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->size,
+	 stored_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 superblock_header->compression_type,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->number_of_summary_bucket_descriptor_pages,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_header->number_of_non_summary_bucket_descriptor_pages,
+	 1 );
+
+	superblock_footer = (nsfdb_superblock_footer_t *) &( superblock_data[ stored_size - sizeof( nsfdb_superblock_footer_t ) ] );
+
+	if( memory_copy(
+	     superblock_footer->modification_time,
+	     superblock_header->modification_time,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy modification time.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 superblock_footer->checksum,
+	 calculated_checksum );
+
+	for( superblock_index = 0;
+	     superblock_index < 4;
+	     superblock_index++ )
+	{
+		if( generate_handle_write_alignment_padding(
+		     generate_handle,
+		     256,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write alignment padding.",
+			 function );
+
+			goto on_error;
+		}
+		superblock_positions[ superblock_index ] = (uint32_t) ( generate_handle->output_offset >> 8 );
+
+		if( generate_handle_write_buffer(
+		     generate_handle,
+		     superblock_data,
+		     superblock_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write superblock: %d.",
+			 function,
+			 superblock_index + 1 );
+
+			goto on_error;
+		}
+	}
+	*superblock_size = (uint32_t) superblock_data_size;
+
+	memory_free(
+	 superblock_data );
+
+	return( 1 );
+
+on_error:
+	if( superblock_data != NULL )
+	{
+		memory_free(
+		 superblock_data );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Writes the bucket descriptor blocks (BDBs)
+ * The same bucket descriptor block is written 2 times
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_bucket_descriptor_blocks(
+     generate_handle_t *generate_handle,
+     uint32_t *bucket_descriptor_block_positions,
+     uint32_t *bucket_descriptor_block_size,
+     libcerror_error_t **error )
+{
+	nsfdb_bucket_descriptor_block_footer_t *bucket_descriptor_block_footer = NULL;
+	nsfdb_bucket_descriptor_block_header_t *bucket_descriptor_block_header = NULL;
+	uint8_t *bucket_descriptor_block_data                                  = NULL;
+	uint8_t *compressed_data                                               = NULL;
+	uint8_t *uncompressed_data                                             = NULL;
+	uint8_t *unique_name_key_data                                          = NULL;
+	uint8_t *unique_name_key_text                                          = NULL;
+	static char *function                                                  = "generate_handle_write_bucket_descriptor_blocks";
+	size_t bucket_descriptor_block_data_size                               = 0;
+	size_t compressed_data_size                                            = 0;
+	size_t uncompressed_data_size                                          = 0;
+	uint32_t calculated_checksum                                           = 0;
+	uint32_t item_index                                                    = 0;
+	uint32_t stored_size                                                   = 0;
+	uint32_t unique_name_key_text_size                                     = 0;
+	int bucket_descriptor_block_index                                      = 0;
+	int print_count                                                        = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_descriptor_block_positions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket descriptor block positions.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_descriptor_block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket descriptor block size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The uncompressed bucket descriptor block data contains the RRV bucket descriptors
+	 * followed by the unique name key (UNK) table, which consists of 10 bytes per entry,
+	 * 4 bytes and the name text. The names are at most 6 characters "Item64"
+	 */
+	uncompressed_data_size = ( (size_t) generate_handle->number_of_rrv_bucket_descriptors * 8 )
+	                       + ( (size_t) generate_handle->number_of_items * 10 )
+	                       + 4
+	                       + ( (size_t) generate_handle->number_of_items * 6 );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     uncompressed_data,
+	     0,
+	     uncompressed_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     uncompressed_data,
+	     generate_handle->rrv_bucket_descriptors_data,
+	     (size_t) generate_handle->number_of_rrv_bucket_descriptors * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy RRV bucket descriptors data.",
+		 function );
+
+		goto on_error;
+	}
+	unique_name_key_data = &( uncompressed_data[ generate_handle->number_of_rrv_bucket_descriptors * 8 ] );
+	unique_name_key_text = &( unique_name_key_data[ ( generate_handle->number_of_items * 10 ) + 4 ] );
+
+	for( item_index = 0;
+	     item_index < generate_handle->number_of_items;
+	     item_index++ )
+	{
+		print_count = narrow_string_snprintf(
+		               (char *) &( unique_name_key_text[ unique_name_key_text_size ] ),
+		               7,
+		               "Item%" PRIu32 "",
+		               item_index + 1 );
+
+		if( ( print_count < 0 )
+		 || ( print_count > 6 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set unique name key: %" PRIu32 " name.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 unique_name_key_data,
+		 unique_name_key_text_size );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( unique_name_key_data[ 4 ] ),
+		 (uint16_t) print_count );
+
+		unique_name_key_data[ 6 ] = generate_handle->unique_name_key_classes[ item_index ];
+		unique_name_key_data[ 7 ] = generate_handle->unique_name_key_classes[ item_index ];
+
+		unique_name_key_data      += 10;
+		unique_name_key_text_size += (uint32_t) print_count;
+	}
+	uncompressed_data_size -= ( (size_t) generate_handle->number_of_items * 6 ) - unique_name_key_text_size;
+
+	if( libnsfdb_cx_get_maximum_compressed_data_size(
+	     uncompressed_data_size,
+	     &compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum compressed data size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The compressed data is stored in a separate buffer so that the checksum
+	 * is calculated over 32-bit aligned data like when the data is read
+	 */
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * ( 4 + compressed_data_size ) );
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     compressed_data,
+	     0,
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	/* TODO determine the meaning of the first 4 bytes of the compressed data
+	 */
+	if( libnsfdb_cx_compress(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     &( compressed_data[ 4 ] ),
+	     &compressed_data_size,
+	     LIBNSFDB_COMPRESSION_LEVEL_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress bucket descriptor block data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	compressed_data_size += 4;
+
+	/* The bucket descriptor block data is padded to a multitude of 256 bytes
+	 */
+	bucket_descriptor_block_data_size = sizeof( nsfdb_bucket_descriptor_block_header_t )
+	                                  + compressed_data_size
+	                                  + sizeof( nsfdb_bucket_descriptor_block_footer_t )
+	                                  + 255;
+
+	bucket_descriptor_block_data_size &= ~( (size_t) 255 );
+
+	bucket_descriptor_block_data = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * bucket_descriptor_block_data_size );
+
+	if( bucket_descriptor_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bucket descriptor block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     bucket_descriptor_block_data,
+	     0,
+	     bucket_descriptor_block_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bucket descriptor block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( bucket_descriptor_block_data[ sizeof( nsfdb_bucket_descriptor_block_header_t ) ] ),
+	     compressed_data,
+	     compressed_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	stored_size = (uint32_t) ( sizeof( nsfdb_bucket_descriptor_block_header_t ) + compressed_data_size + sizeof( nsfdb_bucket_descriptor_block_footer_t ) );
+
+	bucket_descriptor_block_header = (nsfdb_bucket_descriptor_block_header_t *) bucket_descriptor_block_data;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 bucket_descriptor_block_header->signature,
+	 0x0001 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 bucket_descriptor_block_header->version,
+	 0x0002 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 bucket_descriptor_block_header->compression_type,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_descriptor_block_header->uncompressed_size,
+	 (uint32_t) uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_descriptor_block_header->write_count,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_descriptor_block_header->size,
+	 stored_size );
+
+	generate_handle_get_timedate(
+	 generate_handle->number_of_non_data_notes + generate_handle->number_of_notes,
+	 bucket_descriptor_block_header->modification_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_descriptor_block_header->number_of_unique_name_keys,
+	 generate_handle->number_of_items );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_descriptor_block_header->unique_name_key_text_size,
+	 unique_name_key_text_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_descriptor_block_header->number_of_rrv_bucket_descriptors,
+	 generate_handle->number_of_rrv_bucket_descriptors );
+
+	/* The header checksum is calculated over the header without the checksum
+	 */
+	if( libnsfdb_calculate_xor32_checksum(
+	     &calculated_checksum,
+	     bucket_descriptor_block_data,
+	     sizeof( nsfdb_bucket_descriptor_block_header_t ) - 12,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate header checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_calculate_xor32_checksum(
+	     &calculated_checksum,
+	     bucket_descriptor_block_header->unknown3,
+	     8,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate header checksum.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_descriptor_block_header->checksum,
+	 calculated_checksum );
+
+	if( libnsfdb_calculate_xor32_checksum(
+	     &calculated_checksum,
+	     compressed_data,
+	     compressed_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	bucket_descriptor_block_footer = (nsfdb_bucket_descriptor_block_footer_t *) &( bucket_descriptor_block_data[ stored_size - sizeof( nsfdb_bucket_descriptor_block_footer_t ) ] );
+
+	if( memory_copy(
+	     bucket_descriptor_block_footer->modification_time,
+	     bucket_descriptor_block_header->modification_time,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy modification time.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 bucket_descriptor_block_footer->checksum,
+	 calculated_checksum );
+
+	for( bucket_descriptor_block_index = 0;
+	     bucket_descriptor_block_index < 2;
+	     bucket_descriptor_block_index++ )
+	{
+		if( generate_handle_write_alignment_padding(
+		     generate_handle,
+		     256,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write alignment padding.",
+			 function );
+
+			goto on_error;
+		}
+		bucket_descriptor_block_positions[ bucket_descriptor_block_index ] = (uint32_t) ( generate_handle->output_offset >> 8 );
+
+		if( generate_handle_write_buffer(
+		     generate_handle,
+		     bucket_descriptor_block_data,
+		     bucket_descriptor_block_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write bucket descriptor block: %d.",
+			 function,
+			 bucket_descriptor_block_index + 1 );
+
+			goto on_error;
+		}
+	}
+	*bucket_descriptor_block_size = (uint32_t) bucket_descriptor_block_data_size;
+
+	memory_free(
+	 bucket_descriptor_block_data );
+
+	memory_free(
+	 compressed_data );
+
+	return( 1 );
+
+on_error:
+	if( bucket_descriptor_block_data != NULL )
+	{
+		memory_free(
+		 bucket_descriptor_block_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Writes the file and database header
+ * The database header is written at the start of the file
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_database_header(
+     generate_handle_t *generate_handle,
+     uint32_t non_data_rrv_bucket_position,
+     uint32_t data_rrv_bucket_position,
+     uint32_t first_data_rrv_identifier,
+     uint32_t *superblock_positions,
+     uint32_t superblock_size,
+     uint32_t *bucket_descriptor_block_positions,
+     uint32_t bucket_descriptor_block_size,
+     libcerror_error_t **error )
+{
+	uint8_t database_header_data[ GENERATE_HANDLE_DATABASE_HEADER_SIZE ];
+
+	nsfdb_database_information_t *database_information                         = NULL;
+	nsfdb_database_information2_t *database_information2                       = NULL;
+	nsfdb_database_replication_information_t *database_replication_information = NULL;
+	nsfdb_file_header_t *file_header                                           = NULL;
+	static char *function                                                      = "generate_handle_write_database_header";
+	size_t data_offset                                                         = 0;
+	uint32_t file_position                                                     = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( superblock_positions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid superblock positions.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_descriptor_block_positions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket descriptor block positions.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( generate_handle->output_offset <= 0 )
+	 || ( ( generate_handle->output_offset >> 8 ) > (off64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid generate handle - output offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_position = (uint32_t) ( generate_handle->output_offset >> 8 );
+
+	if( memory_set(
+	     database_header_data,
+	     0,
+	     GENERATE_HANDLE_DATABASE_HEADER_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear database header data.",
+		 function );
+
+		return( -1 );
+	}
+	file_header = (nsfdb_file_header_t *) database_header_data;
+
+	file_header->signature[ 0 ] = 0x1a;
+	file_header->signature[ 1 ] = 0x00;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->database_header_size,
+	 GENERATE_HANDLE_DATABASE_HEADER_SIZE );
+
+	data_offset = sizeof( nsfdb_file_header_t );
+
+	database_information = (nsfdb_database_information_t *) &( database_header_data[ data_offset ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information->format_version,
+	 43 );
+
+	generate_handle_get_timedate(
+	 0,
+	 database_information->database_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information->non_data_rrv_bucket_position,
+	 non_data_rrv_bucket_position );
+
+	generate_handle_get_timedate(
+	 generate_handle->number_of_non_data_notes + generate_handle->number_of_notes,
+	 database_information->bucket_modification_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information->bucket_descriptor_block_size,
+	 bucket_descriptor_block_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information->bucket_descriptor_block_position,
+	 bucket_descriptor_block_positions[ 0 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information->data_rrv_bucket_position,
+	 data_rrv_bucket_position );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information->first_data_rrv_identifier,
+	 first_data_rrv_identifier );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 database_information->rrv_bucket_size,
+	 GENERATE_HANDLE_RRV_BUCKET_SIZE );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 database_information->summary_bucket_size,
+	 GENERATE_HANDLE_BUCKET_SIZE );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 database_information->bitmap_size,
+	 GENERATE_HANDLE_BITMAP_SIZE );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 database_information->allocation_granularity,
+	 256 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information->file_size,
+	 file_position );
+
+	generate_handle_get_timedate(
+	 generate_handle->number_of_non_data_notes + generate_handle->number_of_notes,
+	 database_information->data_modification_time );
+
+	generate_handle_get_timedate(
+	 generate_handle->number_of_non_data_notes,
+	 database_information->non_data_modification_time );
+
+	data_offset += sizeof( nsfdb_database_information_t );
+
+	database_replication_information = (nsfdb_database_replication_information_t *) &( database_header_data[ data_offset ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_replication_information->replication_identifier,
+	 generate_handle_get_random_value(
+	  generate_handle,
+	  0xffffffffUL ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( database_replication_information->replication_identifier[ 4 ] ),
+	 generate_handle_get_random_value(
+	  generate_handle,
+	  0xffffffffUL ) );
+
+	data_offset += sizeof( nsfdb_database_replication_information_t )
+	             + sizeof( nsfdb_database_header_t );
+
+	database_information2 = (nsfdb_database_information2_t *) &( database_header_data[ data_offset ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->superblock1_position,
+	 superblock_positions[ 0 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->superblock1_size,
+	 superblock_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->superblock2_position,
+	 superblock_positions[ 1 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->superblock2_size,
+	 superblock_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->superblock3_position,
+	 superblock_positions[ 2 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->superblock3_size,
+	 superblock_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->superblock4_position,
+	 superblock_positions[ 3 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->superblock4_size,
+	 superblock_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->minimum_summary_bucket_size,
+	 GENERATE_HANDLE_BUCKET_SIZE );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->minimum_non_summary_bucket_size,
+	 GENERATE_HANDLE_BUCKET_SIZE );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->maximum_summary_bucket_size,
+	 GENERATE_HANDLE_BUCKET_SIZE );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->maximum_non_summary_bucket_size,
+	 GENERATE_HANDLE_BUCKET_SIZE );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 database_information2->summary_bucket_fill_factor,
+	 (uint16_t) generate_handle->bucket_fill );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 database_information2->non_summary_bucket_fill_factor,
+	 (uint16_t) generate_handle->bucket_fill );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->bucket_descriptor_block1_size,
+	 bucket_descriptor_block_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->bucket_descriptor_block1_position,
+	 bucket_descriptor_block_positions[ 0 ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->bucket_descriptor_block2_size,
+	 bucket_descriptor_block_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_information2->bucket_descriptor_block2_position,
+	 bucket_descriptor_block_positions[ 1 ] );
+
+	if( libcfile_file_seek_offset(
+	     generate_handle->output_file,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: 0 in output file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_write_buffer(
+	     generate_handle->output_file,
+	     database_header_data,
+	     GENERATE_HANDLE_DATABASE_HEADER_SIZE,
+	     error ) != (ssize_t) GENERATE_HANDLE_DATABASE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write database header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Generates a database file
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_generate(
+     generate_handle_t *generate_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint32_t bucket_descriptor_block_positions[ 2 ];
+	uint32_t superblock_positions[ 4 ];
+
+	static char *function                   = "generate_handle_generate";
+	size_t maximum_note_data_size           = 0;
+	uint32_t bucket_descriptor_block_size   = 0;
+	uint32_t data_rrv_bucket_position       = 0;
+	uint32_t first_data_rrv_identifier      = 0;
+	uint32_t item_index                     = 0;
+	uint32_t non_data_rrv_bucket_position   = 0;
+	uint32_t note_index                     = 0;
+	uint32_t number_of_data_rrv_buckets     = 0;
+	uint32_t number_of_non_data_rrv_buckets = 0;
+	uint32_t superblock_size                = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle->output_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generate handle - output file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( generate_handle->note_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generate handle - note data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* A note must fit in a single bucket slot
+	 */
+	maximum_note_data_size = sizeof( nsfdb_note_header_t )
+	                       + ( (size_t) generate_handle->number_of_items * ( sizeof( nsfdb_note_item_t ) + 2 + generate_handle->maximum_text_size ) );
+
+	if( maximum_note_data_size > ( GENERATE_HANDLE_BUCKET_SIZE - sizeof( nsfdb_bucket_header_t ) - sizeof( nsfdb_bucket_footer_t ) - 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid generate handle - maximum note data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_non_data_rrv_buckets = ( generate_handle->number_of_non_data_notes + GENERATE_HANDLE_NUMBER_OF_RRV_BUCKET_ENTRIES - 1 )
+	                               / GENERATE_HANDLE_NUMBER_OF_RRV_BUCKET_ENTRIES;
+
+	if( number_of_non_data_rrv_buckets == 0 )
+	{
+		number_of_non_data_rrv_buckets = 1;
+	}
+	number_of_data_rrv_buckets = ( generate_handle->number_of_notes + GENERATE_HANDLE_NUMBER_OF_RRV_BUCKET_ENTRIES - 1 )
+	                           / GENERATE_HANDLE_NUMBER_OF_RRV_BUCKET_ENTRIES;
+
+	if( number_of_data_rrv_buckets == 0 )
+	{
+		number_of_data_rrv_buckets = 1;
+	}
+	/* The RRV identifiers are a multitude of 4 and the data RRV identifiers follow the non-data RRV identifiers
+	 */
+	first_data_rrv_identifier = 4 + ( number_of_non_data_rrv_buckets * GENERATE_HANDLE_NUMBER_OF_RRV_BUCKET_ENTRIES * 4 );
+
+	generate_handle->random_value = generate_handle->seed;
+
+	generate_handle->unique_name_key_classes = (uint8_t *) memory_allocate(
+	                                                        sizeof( uint8_t ) * generate_handle->number_of_items );
+
+	if( generate_handle->unique_name_key_classes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create unique name key classes.",
+		 function );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < generate_handle->number_of_items;
+	     item_index++ )
+	{
+		if( generate_handle_get_random_value(
+		     generate_handle,
+		     100 ) < generate_handle->text_percentage )
+		{
+			generate_handle->unique_name_key_classes[ item_index ] = LIBNSFDB_NOTE_ITEM_CLASS_TEXT;
+		}
+		else if( ( item_index % 2 ) == 0 )
+		{
+			generate_handle->unique_name_key_classes[ item_index ] = LIBNSFDB_NOTE_ITEM_CLASS_NUMBER;
+		}
+		else
+		{
+			generate_handle->unique_name_key_classes[ item_index ] = LIBNSFDB_NOTE_ITEM_CLASS_TIME;
+		}
+	}
+	generate_handle->note_data = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * GENERATE_HANDLE_BUCKET_SIZE );
+
+	if( generate_handle->note_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create note data.",
+		 function );
+
+		goto on_error;
+	}
+	generate_handle->non_summary_data = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * GENERATE_HANDLE_BUCKET_SIZE );
+
+	if( generate_handle->non_summary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create non-summary data.",
+		 function );
+
+		goto on_error;
+	}
+	generate_handle->rrv_entries_data = (uint8_t *) memory_allocate(
+	                                                 sizeof( uint8_t ) * 8 * ( (size_t) generate_handle->number_of_non_data_notes + generate_handle->number_of_notes + 1 ) );
+
+	if( generate_handle->rrv_entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create RRV entries data.",
+		 function );
+
+		goto on_error;
+	}
+	generate_handle->rrv_bucket_descriptors_data = (uint8_t *) memory_allocate(
+	                                                            sizeof( uint8_t ) * 8 * ( (size_t) number_of_non_data_rrv_buckets + number_of_data_rrv_buckets ) );
+
+	if( generate_handle->rrv_bucket_descriptors_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create RRV bucket descriptors data.",
+		 function );
+
+		goto on_error;
+	}
+	generate_handle->number_of_rrv_entries            = 0;
+	generate_handle->number_of_rrv_bucket_descriptors = 0;
+
+	if( generate_handle_bucket_initialize(
+	     &( generate_handle->summary_bucket ),
+	     GENERATE_HANDLE_BUCKET_SIZE,
+	     GENERATE_HANDLE_MAXIMUM_NUMBER_OF_SUMMARY_SLOTS,
+	     GENERATE_HANDLE_MAXIMUM_NUMBER_OF_SUMMARY_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create summary bucket.",
+		 function );
+
+		goto on_error;
+	}
+	if( generate_handle_bucket_initialize(
+	     &( generate_handle->non_summary_bucket ),
+	     GENERATE_HANDLE_BUCKET_SIZE,
+	     GENERATE_HANDLE_MAXIMUM_NUMBER_OF_NON_SUMMARY_SLOTS,
+	     GENERATE_HANDLE_MAXIMUM_NUMBER_OF_NON_SUMMARY_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create non-summary bucket.",
+		 function );
+
+		goto on_error;
+	}
+	if( generate_handle_open_output(
+	     generate_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file.",
+		 function );
+
+		goto on_error;
+	}
+	/* Reserve the space of the database header, which is written last
+	 */
+	if( generate_handle_write_padding(
+	     generate_handle,
+	     GENERATE_HANDLE_RRV_BUCKET_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write database header padding.",
+		 function );
+
+		goto on_error;
+	}
+	for( note_index = 0;
+	     note_index < generate_handle->number_of_non_data_notes;
+	     note_index++ )
+	{
+		if( generate_handle->abort != 0 )
+		{
+			break;
+		}
+		if( generate_handle_write_note(
+		     generate_handle,
+		     ( ( note_index % 2 ) == 0 ) ? LIBNSFDB_NOTE_CLASS_FORM : LIBNSFDB_NOTE_CLASS_VIEW,
+		     4 + ( note_index * 4 ),
+		     note_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write non-data note: %" PRIu32 ".",
+			 function,
+			 note_index );
+
+			goto on_error;
+		}
+	}
+	for( note_index = 0;
+	     note_index < generate_handle->number_of_notes;
+	     note_index++ )
+	{
+		if( generate_handle->abort != 0 )
+		{
+			break;
+		}
+		if( generate_handle_write_note(
+		     generate_handle,
+		     LIBNSFDB_NOTE_CLASS_DOCUMENT,
+		     first_data_rrv_identifier + ( note_index * 4 ),
+		     generate_handle->number_of_non_data_notes + note_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data note: %" PRIu32 ".",
+			 function,
+			 note_index );
+
+			goto on_error;
+		}
+	}
+	if( generate_handle->abort != 0 )
+	{
+		goto on_error;
+	}
+	if( generate_handle_write_bucket(
+	     generate_handle,
+	     generate_handle->summary_bucket,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write summary bucket.",
+		 function );
+
+		goto on_error;
+	}
+	if( generate_handle_write_bucket(
+	     generate_handle,
+	     generate_handle->non_summary_bucket,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write non-summary bucket.",
+		 function );
+
+		goto on_error;
+	}
+	if( generate_handle_write_rrv_buckets(
+	     generate_handle,
+	     0,
+	     generate_handle->number_of_non_data_notes,
+	     4,
+	     1,
+	     &non_data_rrv_bucket_position,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write non-data RRV buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( generate_handle_write_rrv_buckets(
+	     generate_handle,
+	     generate_handle->number_of_non_data_notes,
+	     generate_handle->number_of_notes,
+	     first_data_rrv_identifier,
+	     0,
+	     &data_rrv_bucket_position,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data RRV buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( generate_handle_write_superblocks(
+	     generate_handle,
+	     data_rrv_bucket_position,
+	     4,
+	     first_data_rrv_identifier + ( generate_handle->number_of_notes * 4 ),
+	     superblock_positions,
+	     &superblock_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write superblocks.",
+		 function );
+
+		goto on_error;
+	}
+	if( generate_handle_write_bucket_descriptor_blocks(
+	     generate_handle,
+	     bucket_descriptor_block_positions,
+	     &bucket_descriptor_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write bucket descriptor blocks.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file size is padded to a multitude of the RRV bucket size
+	 */
+	if( generate_handle_write_alignment_padding(
+	     generate_handle,
+	     GENERATE_HANDLE_RRV_BUCKET_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write alignment padding.",
+		 function );
+
+		goto on_error;
+	}
+	if( generate_handle_write_database_header(
+	     generate_handle,
+	     non_data_rrv_bucket_position,
+	     data_rrv_bucket_position,
+	     first_data_rrv_identifier,
+	     superblock_positions,
+	     superblock_size,
+	     bucket_descriptor_block_positions,
+	     bucket_descriptor_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write database header.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 generate_handle->notify_stream,
+	 "Generated: %" PRIu32 " data notes and: %" PRIu32 " non-data notes in: %" PRIu32 " summary and: %" PRIu32 " non-summary buckets, file size: %" PRIi64 " bytes.\n",
+	 generate_handle->number_of_notes,
+	 generate_handle->number_of_non_data_notes,
+	 generate_handle->summary_bucket->number_of_buckets,
+	 generate_handle->non_summary_bucket->number_of_buckets,
+	 generate_handle->output_offset );
+
+	if( generate_handle_close_output(
+	     generate_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( generate_handle->output_file != NULL )
+	{
+		generate_handle_close_output(
+		 generate_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
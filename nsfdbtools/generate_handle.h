@@ -0,0 +1,338 @@
+/*
+ * Generate handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GENERATE_HANDLE_H )
+#define _GENERATE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcfile.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct generate_handle_bucket generate_handle_bucket_t;
+
+struct generate_handle_bucket
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The offset of the data of the next slot
+	 */
+	size_t slot_data_offset;
+
+	/* The number of slots
+	 */
+	uint32_t number_of_slots;
+
+	/* The maximum number of slots
+	 */
+	uint32_t maximum_number_of_slots;
+
+	/* The file positions of the written buckets
+	 */
+	uint32_t *file_positions;
+
+	/* The number of written buckets
+	 */
+	uint32_t number_of_buckets;
+
+	/* The maximum number of buckets
+	 */
+	uint32_t maximum_number_of_buckets;
+};
+
+typedef struct generate_handle generate_handle_t;
+
+struct generate_handle
+{
+	/* The number of data notes
+	 */
+	uint32_t number_of_notes;
+
+	/* The number of non-data notes
+	 */
+	uint32_t number_of_non_data_notes;
+
+	/* The number of items per note
+	 */
+	uint32_t number_of_items;
+
+	/* The percentage of items stored in the summary buckets
+	 */
+	uint32_t summary_percentage;
+
+	/* The percentage of text items
+	 */
+	uint32_t text_percentage;
+
+	/* The maximum size of the text of a text item
+	 */
+	uint32_t maximum_text_size;
+
+	/* The percentage of a bucket that is filled before a new bucket is started
+	 */
+	uint32_t bucket_fill;
+
+	/* The seed of the pseudo random sequence
+	 */
+	uint32_t seed;
+
+	/* The current pseudo random value
+	 */
+	uint32_t random_value;
+
+	/* The output file
+	 */
+	libcfile_file_t *output_file;
+
+	/* The current output offset
+	 */
+	off64_t output_offset;
+
+	/* The note item classes of the unique name keys
+	 */
+	uint8_t *unique_name_key_classes;
+
+	/* The note data
+	 */
+	uint8_t *note_data;
+
+	/* The non-summary data
+	 */
+	uint8_t *non_summary_data;
+
+	/* The summary bucket
+	 */
+	generate_handle_bucket_t *summary_bucket;
+
+	/* The non-summary bucket
+	 */
+	generate_handle_bucket_t *non_summary_bucket;
+
+	/* The RRV entries data
+	 */
+	uint8_t *rrv_entries_data;
+
+	/* The number of RRV entries
+	 */
+	uint32_t number_of_rrv_entries;
+
+	/* The RRV bucket descriptors data
+	 */
+	uint8_t *rrv_bucket_descriptors_data;
+
+	/* The number of RRV bucket descriptors
+	 */
+	uint32_t number_of_rrv_bucket_descriptors;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int generate_handle_bucket_initialize(
+     generate_handle_bucket_t **bucket,
+     size_t data_size,
+     uint32_t maximum_number_of_slots,
+     uint32_t maximum_number_of_buckets,
+     libcerror_error_t **error );
+
+int generate_handle_bucket_free(
+     generate_handle_bucket_t **bucket,
+     libcerror_error_t **error );
+
+int generate_handle_initialize(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error );
+
+int generate_handle_free(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error );
+
+int generate_handle_signal_abort(
+     generate_handle_t *generate_handle,
+     libcerror_error_t **error );
+
+int generate_handle_copy_from_decimal_string(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_notes(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_non_data_notes(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_items(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_summary_percentage(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_text_percentage(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_maximum_text_size(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_bucket_fill(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_seed(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+uint32_t generate_handle_get_random_value(
+          generate_handle_t *generate_handle,
+          uint32_t maximum_value );
+
+int generate_handle_open_output(
+     generate_handle_t *generate_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int generate_handle_close_output(
+     generate_handle_t *generate_handle,
+     libcerror_error_t **error );
+
+int generate_handle_write_buffer(
+     generate_handle_t *generate_handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int generate_handle_write_padding(
+     generate_handle_t *generate_handle,
+     size_t padding_size,
+     libcerror_error_t **error );
+
+int generate_handle_write_alignment_padding(
+     generate_handle_t *generate_handle,
+     size_t alignment_size,
+     libcerror_error_t **error );
+
+int generate_handle_write_bucket(
+     generate_handle_t *generate_handle,
+     generate_handle_bucket_t *bucket,
+     libcerror_error_t **error );
+
+int generate_handle_append_bucket_slot(
+     generate_handle_t *generate_handle,
+     generate_handle_bucket_t *bucket,
+     const uint8_t *slot_data,
+     size_t slot_data_size,
+     uint32_t *bucket_index,
+     uint32_t *slot_index,
+     libcerror_error_t **error );
+
+void generate_handle_get_timedate(
+      uint32_t note_number,
+      uint8_t *timedate );
+
+size_t generate_handle_generate_item_data(
+        generate_handle_t *generate_handle,
+        uint8_t note_item_class,
+        uint8_t *item_data );
+
+int generate_handle_write_note(
+     generate_handle_t *generate_handle,
+     uint16_t note_class,
+     uint32_t rrv_identifier,
+     uint32_t note_number,
+     libcerror_error_t **error );
+
+int generate_handle_write_rrv_buckets(
+     generate_handle_t *generate_handle,
+     uint32_t first_rrv_entry_index,
+     uint32_t number_of_rrv_entries,
+     uint32_t initial_rrv_identifier,
+     uint8_t is_non_data,
+     uint32_t *first_rrv_bucket_position,
+     libcerror_error_t **error );
+
+int generate_handle_write_superblocks(
+     generate_handle_t *generate_handle,
+     uint32_t data_rrv_bucket_position,
+     uint32_t first_rrv_identifier,
+     uint32_t last_rrv_identifier,
+     uint32_t *superblock_positions,
+     uint32_t *superblock_size,
+     libcerror_error_t **error );
+
+int generate_handle_write_bucket_descriptor_blocks(
+     generate_handle_t *generate_handle,
+     uint32_t *bucket_descriptor_block_positions,
+     uint32_t *bucket_descriptor_block_size,
+     libcerror_error_t **error );
+
+int generate_handle_write_database_header(
+     generate_handle_t *generate_handle,
+     uint32_t non_data_rrv_bucket_position,
+     uint32_t data_rrv_bucket_position,
+     uint32_t first_data_rrv_identifier,
+     uint32_t *superblock_positions,
+     uint32_t superblock_size,
+     uint32_t *bucket_descriptor_block_positions,
+     uint32_t bucket_descriptor_block_size,
+     libcerror_error_t **error );
+
+int generate_handle_generate(
+     generate_handle_t *generate_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _GENERATE_HANDLE_H ) */
+
@@ -0,0 +1,1252 @@
+/*
+ * Index handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "index_handle.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcthreads.h"
+#include "nsfdbtools_libnsfdb.h"
+
+#define INDEX_HANDLE_NOTIFY_STREAM		stdout
+
+/* Creates an index handle
+ * Make sure the value index_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_initialize(
+     index_handle_t **index_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_initialize";
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*index_handle = memory_allocate_structure(
+	                 index_handle_t );
+
+	if( *index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index_handle,
+	     0,
+	     sizeof( index_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *index_handle )->number_of_threads = 1;
+	( *index_handle )->notify_stream     = INDEX_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *index_handle != NULL )
+	{
+		memory_free(
+		 *index_handle );
+
+		*index_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index handle
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_free(
+     index_handle_t **index_handle,
+     libcerror_error_t **error )
+{
+	index_handle_segment_t *segment = NULL;
+	static char *function           = "index_handle_free";
+	int result                      = 1;
+	int segment_index               = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_handle != NULL )
+	{
+		if( ( *index_handle )->segments != NULL )
+		{
+			for( segment_index = 0;
+			     segment_index < ( *index_handle )->number_of_segments;
+			     segment_index++ )
+			{
+				segment = &( ( *index_handle )->segments[ segment_index ] );
+
+				if( segment->input_file != NULL )
+				{
+					libnsfdb_file_free(
+					 &( segment->input_file ),
+					 NULL );
+				}
+				if( segment->text_index != NULL )
+				{
+					libnsfdb_text_index_free(
+					 &( segment->text_index ),
+					 NULL );
+				}
+				if( segment->error != NULL )
+				{
+					libcerror_error_free(
+					 &( segment->error ) );
+				}
+			}
+			memory_free(
+			 ( *index_handle )->segments );
+		}
+		if( ( *index_handle )->input_file != NULL )
+		{
+			if( libnsfdb_file_free(
+			     &( ( *index_handle )->input_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *index_handle )->text_index != NULL )
+		{
+			if( libnsfdb_text_index_free(
+			     &( ( *index_handle )->text_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free text index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *index_handle );
+
+		*index_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the index handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_signal_abort(
+     index_handle_t *index_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_signal_abort";
+	int segment_index     = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	index_handle->abort = 1;
+
+	if( index_handle->input_file != NULL )
+	{
+		if( libnsfdb_file_signal_abort(
+		     index_handle->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The segments check the abort value of the index handle before they open
+	 * their input file, hence only the input files already opened are signalled
+	 */
+	if( index_handle->segments != NULL )
+	{
+		for( segment_index = 0;
+		     segment_index < index_handle->number_of_segments;
+		     segment_index++ )
+		{
+			if( index_handle->segments[ segment_index ].input_file == NULL )
+			{
+				continue;
+			}
+			if( libnsfdb_file_signal_abort(
+			     index_handle->segments[ segment_index ].input_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to signal segment: %d input file to abort.",
+				 function,
+				 segment_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Copies a 32-bit value from a decimal string
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_copy_from_decimal_string(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_copy_from_decimal_string";
+	size_t string_index   = 0;
+	uint64_t value_64bit  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		value_64bit *= 10;
+		value_64bit += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( value_64bit > (uint64_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*value_32bit = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int index_handle_set_number_of_threads(
+     index_handle_t *index_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_set_number_of_threads";
+	uint32_t value_32bit  = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of threads from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_32bit == 0 )
+	 || ( value_32bit > INDEX_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+	index_handle->number_of_threads = (int) value_32bit;
+
+	return( 1 );
+}
+
+/* Opens the input file
+ * Make sure the value input_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_open_input(
+     index_handle_t *index_handle,
+     libnsfdb_file_t **input_file,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_open_input";
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_initialize(
+	     input_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libnsfdb_file_open_wide(
+	     *input_file,
+	     index_handle->filename,
+	     LIBNSFDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libnsfdb_file_open(
+	     *input_file,
+	     index_handle->filename,
+	     LIBNSFDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *input_file != NULL )
+	{
+		libnsfdb_file_free(
+		 input_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input file
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_close_input(
+     libnsfdb_file_t **input_file,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_close_input";
+	int result            = 1;
+
+	if( input_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *input_file != NULL )
+	{
+		if( libnsfdb_file_close(
+		     *input_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file.",
+			 function );
+
+			result = -1;
+		}
+		if( libnsfdb_file_free(
+		     input_file,
+		     ( result == 1 ) ? error : NULL ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Builds the text index of a segment of the notes
+ * Every segment uses its own input file since a file cannot be shared between threads
+ * This function is used as a thread callback hence the result is stored in the segment
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_build_segment(
+     index_handle_segment_t *segment )
+{
+	static char *function = "index_handle_build_segment";
+
+	if( segment == NULL )
+	{
+		return( -1 );
+	}
+	if( segment->index_handle == NULL )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment - missing index handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment->index_handle->abort != 0 )
+	{
+		segment->result = 1;
+
+		return( 1 );
+	}
+	if( index_handle_open_input(
+	     segment->index_handle,
+	     &( segment->input_file ),
+	     &( segment->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_text_index_initialize(
+	     &( segment->text_index ),
+	     &( segment->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create text index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_file_build_text_index(
+	     segment->input_file,
+	     LIBNSFDB_NOTE_TYPE_DATA,
+	     segment->note_index,
+	     segment->number_of_notes,
+	     segment->text_index,
+	     &( segment->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build text index of notes: %d - %d.",
+		 function,
+		 segment->note_index,
+		 segment->note_index + segment->number_of_notes - 1 );
+
+		goto on_error;
+	}
+	if( index_handle_close_input(
+	     &( segment->input_file ),
+	     &( segment->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	segment->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( segment->input_file != NULL )
+	{
+		libnsfdb_file_free(
+		 &( segment->input_file ),
+		 NULL );
+	}
+	segment->result = -1;
+
+	return( -1 );
+}
+
+/* Builds the text index and writes it to the index file
+ * The data notes are divided into a segment per thread and the text indexes
+ * of the segments are merged when all the threads have finished
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_build(
+     index_handle_t *index_handle,
+     const char *index_filename,
+     libcerror_error_t **error )
+{
+	index_handle_segment_t *segment = NULL;
+	static char *function           = "index_handle_build";
+	int note_index                  = 0;
+	int number_of_notes             = 0;
+	int number_of_segments          = 0;
+	int number_of_terms             = 0;
+	int segment_index               = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_handle->segments != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index handle - segments value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_handle->text_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index handle - text index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_handle_open_input(
+	     index_handle,
+	     &( index_handle->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_file_get_number_of_notes(
+	     index_handle->input_file,
+	     LIBNSFDB_NOTE_TYPE_DATA,
+	     &number_of_notes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of notes.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_handle_close_input(
+	     &( index_handle->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_segments = index_handle->number_of_threads;
+
+	if( number_of_segments > number_of_notes )
+	{
+		number_of_segments = number_of_notes;
+	}
+	if( number_of_segments < 1 )
+	{
+		number_of_segments = 1;
+	}
+	index_handle->segments = (index_handle_segment_t *) memory_allocate(
+	                                                     sizeof( index_handle_segment_t ) * (size_t) number_of_segments );
+
+	if( index_handle->segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segments.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     index_handle->segments,
+	     0,
+	     sizeof( index_handle_segment_t ) * (size_t) number_of_segments ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segments.",
+		 function );
+
+		memory_free(
+		 index_handle->segments );
+
+		index_handle->segments = NULL;
+
+		goto on_error;
+	}
+	index_handle->number_of_segments = number_of_segments;
+
+	/* The notes that remain after an even division are spread over the first segments
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( index_handle->segments[ segment_index ] );
+
+		segment->index_handle    = index_handle;
+		segment->note_index      = note_index;
+		segment->number_of_notes = number_of_notes / number_of_segments;
+
+		if( segment_index < ( number_of_notes % number_of_segments ) )
+		{
+			segment->number_of_notes += 1;
+		}
+		note_index += segment->number_of_notes;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_segments > 1 )
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( index_handle->segments[ segment_index ] );
+
+			if( libcthreads_thread_create(
+			     &( segment->thread ),
+			     NULL,
+			     (int (*)(void *)) &index_handle_build_segment,
+			     (void *) segment,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( index_handle->segments[ segment_index ] );
+
+			if( libcthreads_thread_join(
+			     &( segment->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			index_handle_build_segment(
+			 &( index_handle->segments[ segment_index ] ) );
+		}
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( index_handle->segments[ segment_index ] );
+
+		if( segment->result != 1 )
+		{
+			/* Pass the error of the segment on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error         = segment->error;
+				segment->error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to build segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+	}
+	if( index_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	/* The text index of the first segment is used as the text index
+	 * into which the text indexes of the other segments are merged
+	 */
+	index_handle->text_index               = index_handle->segments[ 0 ].text_index;
+	index_handle->segments[ 0 ].text_index = NULL;
+
+	for( segment_index = 1;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( index_handle->segments[ segment_index ] );
+
+		if( libnsfdb_text_index_merge(
+		     index_handle->text_index,
+		     segment->text_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to merge text index of segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		if( libnsfdb_text_index_free(
+		     &( segment->text_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free text index of segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+	}
+	if( libnsfdb_text_index_get_number_of_terms(
+	     index_handle->text_index,
+	     &number_of_terms,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of terms.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_text_index_write(
+	     index_handle->text_index,
+	     index_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write text index.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 index_handle->notify_stream,
+	 "Text index:\n" );
+
+	fprintf(
+	 index_handle->notify_stream,
+	 "\tNumber of notes\t\t: %d\n",
+	 number_of_notes );
+
+	fprintf(
+	 index_handle->notify_stream,
+	 "\tNumber of terms\t\t: %d\n",
+	 number_of_terms );
+
+	fprintf(
+	 index_handle->notify_stream,
+	 "\tNumber of segments\t: %d\n",
+	 number_of_segments );
+
+	fprintf(
+	 index_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( index_handle->segments != NULL )
+	{
+		index_handle->abort = 1;
+
+		for( segment_index = 0;
+		     segment_index < index_handle->number_of_segments;
+		     segment_index++ )
+		{
+			if( index_handle->segments[ segment_index ].thread != NULL )
+			{
+				libcthreads_thread_join(
+				 &( index_handle->segments[ segment_index ].thread ),
+				 NULL );
+			}
+		}
+	}
+#endif
+	if( index_handle->input_file != NULL )
+	{
+		libnsfdb_file_free(
+		 &( index_handle->input_file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Searches the text index in the index file and prints the matching notes
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_query(
+     index_handle_t *index_handle,
+     const char *index_filename,
+     const char *query,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_t *note          = NULL;
+	static char *function          = "index_handle_query";
+	uint32_t note_identifier       = 0;
+	int note_identifier_index      = 0;
+	int number_of_note_identifiers = 0;
+	int number_of_values           = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_handle->text_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index handle - text index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( query == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid query.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_text_index_initialize(
+	     &( index_handle->text_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create text index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_text_index_read(
+	     index_handle->text_index,
+	     index_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read text index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_text_index_search(
+	     index_handle->text_index,
+	     (uint8_t *) query,
+	     narrow_string_length(
+	      query ),
+	     &number_of_note_identifiers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to search text index.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_handle_open_input(
+	     index_handle,
+	     &( index_handle->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 index_handle->notify_stream,
+	 "Query results:\n" );
+
+	fprintf(
+	 index_handle->notify_stream,
+	 "\tNumber of notes\t\t: %d\n",
+	 number_of_note_identifiers );
+
+	for( note_identifier_index = 0;
+	     note_identifier_index < number_of_note_identifiers;
+	     note_identifier_index++ )
+	{
+		if( index_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libnsfdb_text_index_get_search_note_identifier(
+		     index_handle->text_index,
+		     note_identifier_index,
+		     &note_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve note identifier: %d.",
+			 function,
+			 note_identifier_index );
+
+			goto on_error;
+		}
+		if( libnsfdb_file_get_note_by_identifier(
+		     index_handle->input_file,
+		     LIBNSFDB_NOTE_TYPE_DATA,
+		     note_identifier,
+		     &note,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve note: 0x%08" PRIx32 ".",
+			 function,
+			 note_identifier );
+
+			goto on_error;
+		}
+		if( libnsfdb_note_get_number_of_values(
+		     note,
+		     &number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of values of note: 0x%08" PRIx32 ".",
+			 function,
+			 note_identifier );
+
+			goto on_error;
+		}
+		fprintf(
+		 index_handle->notify_stream,
+		 "\tNote: 0x%08" PRIx32 "\t: %d values\n",
+		 note_identifier,
+		 number_of_values );
+
+		if( libnsfdb_note_free(
+		     &note,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free note: 0x%08" PRIx32 ".",
+			 function,
+			 note_identifier );
+
+			goto on_error;
+		}
+	}
+	fprintf(
+	 index_handle->notify_stream,
+	 "\n" );
+
+	if( index_handle_close_input(
+	     &( index_handle->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( note != NULL )
+	{
+		libnsfdb_note_free(
+		 &note,
+		 NULL );
+	}
+	if( index_handle->input_file != NULL )
+	{
+		libnsfdb_file_free(
+		 &( index_handle->input_file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,167 @@
+/*
+ * Index handle
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INDEX_HANDLE_H )
+#define _INDEX_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcthreads.h"
+#include "nsfdbtools_libnsfdb.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of threads
+ */
+#define INDEX_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+
+typedef struct index_handle index_handle_t;
+
+typedef struct index_handle_segment index_handle_segment_t;
+
+struct index_handle_segment
+{
+	/* The index handle
+	 */
+	index_handle_t *index_handle;
+
+	/* The index of the first note
+	 */
+	int note_index;
+
+	/* The number of notes
+	 */
+	int number_of_notes;
+
+	/* The input file
+	 */
+	libnsfdb_file_t *input_file;
+
+	/* The text index
+	 */
+	libnsfdb_text_index_t *text_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+struct index_handle
+{
+	/* The input filename
+	 */
+	const system_character_t *filename;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The segments
+	 */
+	index_handle_segment_t *segments;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The input file
+	 */
+	libnsfdb_file_t *input_file;
+
+	/* The text index
+	 */
+	libnsfdb_text_index_t *text_index;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int index_handle_initialize(
+     index_handle_t **index_handle,
+     libcerror_error_t **error );
+
+int index_handle_free(
+     index_handle_t **index_handle,
+     libcerror_error_t **error );
+
+int index_handle_signal_abort(
+     index_handle_t *index_handle,
+     libcerror_error_t **error );
+
+int index_handle_copy_from_decimal_string(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int index_handle_set_number_of_threads(
+     index_handle_t *index_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int index_handle_open_input(
+     index_handle_t *index_handle,
+     libnsfdb_file_t **input_file,
+     libcerror_error_t **error );
+
+int index_handle_close_input(
+     libnsfdb_file_t **input_file,
+     libcerror_error_t **error );
+
+int index_handle_build_segment(
+     index_handle_segment_t *segment );
+
+int index_handle_build(
+     index_handle_t *index_handle,
+     const char *index_filename,
+     libcerror_error_t **error );
+
+int index_handle_query(
+     index_handle_t *index_handle,
+     const char *index_filename,
+     const char *query,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INDEX_HANDLE_H ) */
+
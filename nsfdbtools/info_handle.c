@@ -22,11 +22,18 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
 #include "info_handle.h"
+#include "nsfdbtools_libbfio.h"
 #include "nsfdbtools_libcerror.h"
 #include "nsfdbtools_libclocale.h"
+#include "nsfdbtools_libcthreads.h"
 #include "nsfdbtools_libnsfdb.h"
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
@@ -104,7 +111,8 @@ int info_handle_initialize(
 
 		goto on_error;
 	}
-	( *info_handle )->notify_stream = INFO_HANDLE_NOTIFY_STREAM;
+	( *info_handle )->number_of_threads = 1;
+	( *info_handle )->notify_stream     = INFO_HANDLE_NOTIFY_STREAM;
 
 	return( 1 );
 
@@ -126,8 +134,10 @@ int info_handle_free(
      info_handle_t **info_handle,
      libcerror_error_t **error )
 {
-	static char *function = "info_handle_free";
-	int result            = 1;
+	info_handle_segment_t *segment = NULL;
+	static char *function          = "info_handle_free";
+	int result                     = 1;
+	int segment_index              = 0;
 
 	if( info_handle == NULL )
 	{
@@ -155,6 +165,56 @@ int info_handle_free(
 
 			result = -1;
 		}
+		if( ( *info_handle )->segments != NULL )
+		{
+			for( segment_index = 0;
+			     segment_index < ( *info_handle )->number_of_segments;
+			     segment_index++ )
+			{
+				segment = &( ( *info_handle )->segments[ segment_index ] );
+
+				if( segment->input_file != NULL )
+				{
+					libnsfdb_file_free(
+					 &( segment->input_file ),
+					 NULL );
+				}
+				if( segment->file_io_handle != NULL )
+				{
+					libbfio_handle_free(
+					 &( segment->file_io_handle ),
+					 NULL );
+				}
+				if( segment->error != NULL )
+				{
+					libcerror_error_free(
+					 &( segment->error ) );
+				}
+			}
+			memory_free(
+			 ( *info_handle )->segments );
+		}
+		if( ( *info_handle )->buckets != NULL )
+		{
+			memory_free(
+			 ( *info_handle )->buckets );
+		}
+		if( ( *info_handle )->structure_map != NULL )
+		{
+			if( libnsfdb_structure_map_free(
+			     &( ( *info_handle )->structure_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free structure map.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *info_handle );
 
@@ -204,6 +264,201 @@ int info_handle_signal_abort(
 	return( 1 );
 }
 
+/* Copies a 32-bit value from a decimal string
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_copy_from_decimal_string(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_copy_from_decimal_string";
+	size_t string_index   = 0;
+	uint64_t value_64bit  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid string value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in string.",
+			 function );
+
+			return( -1 );
+		}
+		value_64bit *= 10;
+		value_64bit += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( value_64bit > (uint64_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*value_32bit = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_number_of_threads";
+	uint32_t value_32bit  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_copy_from_decimal_string(
+	     string,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of threads from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_32bit == 0 )
+	 || ( value_32bit > INFO_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+	info_handle->number_of_threads = (int) value_32bit;
+
+	return( 1 );
+}
+
+/* Retrieves the current value of a monotonic clock in micro seconds
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_get_time(
+     uint64_t *time_value,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_specification;
+#endif
+
+	static char *function = "info_handle_get_time";
+
+	if( time_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid time value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*time_value = (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000
+	            + (uint64_t) ( ( counter.QuadPart % frequency.QuadPart ) * 1000000 / frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_specification ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock.",
+		 function );
+
+		return( -1 );
+	}
+	*time_value = (uint64_t) time_specification.tv_sec * 1000000
+	            + (uint64_t) time_specification.tv_nsec / 1000;
+#else
+	*time_value = (uint64_t) time( NULL ) * 1000000;
+#endif
+	return( 1 );
+}
+
 /* Opens the info handle
  * Returns 1 if successful or -1 on error
  */
@@ -248,6 +503,10 @@ int info_handle_open_input(
 
 		return( -1 );
 	}
+	/* The statistics are read using a file IO handle per thread
+	 */
+	info_handle->filename = filename;
+
 	return( 1 );
 }
 
@@ -287,6 +546,167 @@ int info_handle_close_input(
 	return( 0 );
 }
 
+/* Opens a file IO handle of the input file
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_open_file_io_handle(
+     info_handle_t *info_handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "info_handle_open_file_io_handle";
+	size_t filename_length = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   info_handle->filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     *file_io_handle,
+	     info_handle->filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     *file_io_handle,
+	     info_handle->filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     *file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_close_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_close_file_io_handle";
+	int result            = 1;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( libbfio_handle_close(
+		     *file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
 /* Prints file information
  * Returns 1 if successful or -1 on error
  */
@@ -320,3 +740,1376 @@ int info_handle_file_fprint(
 	return( 1 );
 }
 
+/* Retrieves the power of 2 size class of a size
+ * Returns the size class
+ */
+int info_handle_get_size_class(
+     uint32_t size )
+{
+	int size_class = 0;
+
+	while( size > 1 )
+	{
+		size >>= 1;
+
+		size_class++;
+	}
+	if( size_class >= INFO_HANDLE_NUMBER_OF_SIZE_CLASSES )
+	{
+		size_class = INFO_HANDLE_NUMBER_OF_SIZE_CLASSES - 1;
+	}
+	return( size_class );
+}
+
+/* Reads the buckets of the input file
+ * The locations of the buckets are read into a structure map using a separate file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_read_buckets(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	info_handle_bucket_t *bucket     = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "info_handle_read_buckets";
+	off64_t file_offset              = 0;
+	size64_t size                    = 0;
+	uint8_t structure_type           = 0;
+	int copy_number                  = 0;
+	int number_of_structures         = 0;
+	int structure_index              = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->buckets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - buckets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->structure_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - structure map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_get_number_of_unique_name_keys(
+	     info_handle->input_file,
+	     &( info_handle->number_of_unk_table_entries ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of UNK table entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_file_get_number_of_notes(
+	     info_handle->input_file,
+	     LIBNSFDB_NOTE_TYPE_ALL,
+	     &( info_handle->number_of_notes ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of notes.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_open_file_io_handle(
+	     info_handle,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( info_handle->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_structure_map_initialize(
+	     &( info_handle->structure_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create structure map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_structure_map_read_file_io_handle(
+	     info_handle->structure_map,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read structure map.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_close_file_io_handle(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_structure_map_get_format_version(
+	     info_handle->structure_map,
+	     &( info_handle->format_version ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_structure_map_get_number_of_structures(
+	     info_handle->structure_map,
+	     &number_of_structures,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of structures.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_structures == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_structures > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( info_handle_bucket_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of structures value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	/* The number of structures is an upper bound of the number of buckets
+	 */
+	info_handle->buckets = (info_handle_bucket_t *) memory_allocate(
+	                                                 sizeof( info_handle_bucket_t ) * (size_t) number_of_structures );
+
+	if( info_handle->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	info_handle->number_of_buckets     = 0;
+	info_handle->number_of_rrv_buckets = 0;
+
+	for( structure_index = 0;
+	     structure_index < number_of_structures;
+	     structure_index++ )
+	{
+		if( libnsfdb_structure_map_get_structure(
+		     info_handle->structure_map,
+		     structure_index,
+		     &structure_type,
+		     &copy_number,
+		     &file_offset,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve structure: %d.",
+			 function,
+			 structure_index );
+
+			goto on_error;
+		}
+		if( structure_type == LIBNSFDB_STRUCTURE_TYPE_RRV_BUCKET )
+		{
+			info_handle->number_of_rrv_buckets += 1;
+
+			continue;
+		}
+		if( ( structure_type != LIBNSFDB_STRUCTURE_TYPE_NON_SUMMARY_BUCKET )
+		 && ( structure_type != LIBNSFDB_STRUCTURE_TYPE_SUMMARY_BUCKET ) )
+		{
+			continue;
+		}
+		bucket = &( info_handle->buckets[ info_handle->number_of_buckets ] );
+
+		if( structure_type == LIBNSFDB_STRUCTURE_TYPE_SUMMARY_BUCKET )
+		{
+			bucket->type = INFO_HANDLE_BUCKET_TYPE_SUMMARY;
+		}
+		else
+		{
+			bucket->type = INFO_HANDLE_BUCKET_TYPE_NON_SUMMARY;
+		}
+		bucket->structure_index = structure_index;
+		bucket->file_offset     = file_offset;
+		bucket->size            = size;
+
+		info_handle->number_of_buckets += 1;
+	}
+	return( 1 );
+
+on_error:
+	if( info_handle->buckets != NULL )
+	{
+		memory_free(
+		 info_handle->buckets );
+
+		info_handle->buckets = NULL;
+	}
+	info_handle->number_of_buckets = 0;
+
+	if( info_handle->structure_map != NULL )
+	{
+		libnsfdb_structure_map_free(
+		 &( info_handle->structure_map ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the statistics of a note
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_read_note_statistics(
+     libnsfdb_file_t *input_file,
+     int note_index,
+     info_handle_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	libnsfdb_note_t *note    = NULL;
+	static char *function    = "info_handle_read_note_statistics";
+	size_t value_data_size   = 0;
+	uint64_t note_size       = 0;
+	uint16_t note_class      = 0;
+	uint16_t status_flags    = 0;
+	int bit_index            = 0;
+	int number_of_values     = 0;
+	int value_index          = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_file_get_note(
+	     input_file,
+	     LIBNSFDB_NOTE_TYPE_ALL,
+	     note_index,
+	     &note,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve note: %d.",
+		 function,
+		 note_index );
+
+		goto on_error;
+	}
+	if( libnsfdb_note_get_note_class(
+	     note,
+	     &note_class,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve note class.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_note_get_status_flags(
+	     note,
+	     &status_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve status flags.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_note_get_size(
+	     note,
+	     &note_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_note_get_number_of_values(
+	     note,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libnsfdb_note_get_value_data_size(
+		     note,
+		     value_index,
+		     &value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data size of value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( value_data_size > (size_t) UINT32_MAX )
+		{
+			value_data_size = (size_t) UINT32_MAX;
+		}
+		statistics->item_sizes[ info_handle_get_size_class( (uint32_t) value_data_size ) ] += 1;
+	}
+	if( libnsfdb_note_free(
+	     &note,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free note.",
+		 function );
+
+		goto on_error;
+	}
+	for( bit_index = 0;
+	     bit_index < 16;
+	     bit_index++ )
+	{
+		if( ( note_class & ( 1 << bit_index ) ) != 0 )
+		{
+			statistics->note_classes[ bit_index ] += 1;
+		}
+		if( ( status_flags & ( 1 << bit_index ) ) != 0 )
+		{
+			statistics->status_flags[ bit_index ] += 1;
+		}
+	}
+	if( note_size > (uint64_t) UINT32_MAX )
+	{
+		note_size = (uint64_t) UINT32_MAX;
+	}
+	statistics->number_of_notes += 1;
+
+	statistics->note_sizes[ info_handle_get_size_class( (uint32_t) note_size ) ] += 1;
+
+	statistics->number_of_note_items += (uint64_t) number_of_values;
+
+	return( 1 );
+
+on_error:
+	if( note != NULL )
+	{
+		libnsfdb_note_free(
+		 &note,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the statistics of a bucket
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_read_bucket_statistics(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     info_handle_bucket_t *bucket_reference,
+     info_handle_statistics_t *statistics,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error )
+{
+	static char *function    = "info_handle_read_bucket_statistics";
+	uint64_t slots_data_size = 0;
+	uint32_t data_size       = 0;
+	uint32_t number_of_slots = 0;
+
+	if( bucket_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libnsfdb_structure_map_read_bucket_usage(
+	     structure_map,
+	     file_io_handle,
+	     bucket_reference->structure_index,
+	     &data_size,
+	     &number_of_slots,
+	     &slots_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read bucket at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 bucket_reference->file_offset,
+		 bucket_reference->file_offset );
+
+		return( -1 );
+	}
+	if( bucket_reference->type == INFO_HANDLE_BUCKET_TYPE_SUMMARY )
+	{
+		statistics->number_of_summary_buckets += 1;
+		statistics->summary_bucket_data_size  += data_size;
+		statistics->summary_slots_data_size   += slots_data_size;
+	}
+	else
+	{
+		statistics->number_of_non_summary_buckets += 1;
+		statistics->non_summary_bucket_data_size  += data_size;
+		statistics->non_summary_slots_data_size   += slots_data_size;
+	}
+	statistics->number_of_slots += number_of_slots;
+
+	*number_of_bytes += data_size;
+
+	return( 1 );
+}
+
+/* Reads the statistics of the buckets and notes of a segment
+ * Every segment uses its own file IO handle and input file since these cannot be shared between threads
+ * This function is used as a thread callback hence the result is stored in the segment
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_read_segment_statistics(
+     info_handle_segment_t *segment )
+{
+	info_handle_t *info_handle = NULL;
+	static char *function      = "info_handle_read_segment_statistics";
+	int bucket_index           = 0;
+	int note_index             = 0;
+
+	if( segment == NULL )
+	{
+		return( -1 );
+	}
+	info_handle = segment->info_handle;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment - missing info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle->abort != 0 )
+	{
+		segment->result = 1;
+
+		return( 1 );
+	}
+	if( info_handle_open_file_io_handle(
+	     info_handle,
+	     &( segment->file_io_handle ),
+	     &( segment->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = segment->start_index;
+	     bucket_index < segment->end_index;
+	     bucket_index++ )
+	{
+		if( info_handle->abort != 0 )
+		{
+			break;
+		}
+		if( info_handle_read_bucket_statistics(
+		     info_handle->structure_map,
+		     segment->file_io_handle,
+		     &( info_handle->buckets[ bucket_index ] ),
+		     &( segment->statistics ),
+		     &( segment->number_of_bytes ),
+		     &( segment->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read statistics of bucket: %d.",
+			 function,
+			 bucket_index );
+
+			goto on_error;
+		}
+	}
+	if( segment->note_start_index < segment->note_end_index )
+	{
+		if( libnsfdb_file_initialize(
+		     &( segment->input_file ),
+		     &( segment->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create input file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libnsfdb_file_open_file_io_handle(
+		     segment->input_file,
+		     segment->file_io_handle,
+		     LIBNSFDB_OPEN_READ,
+		     &( segment->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input file.",
+			 function );
+
+			goto on_error;
+		}
+		for( note_index = segment->note_start_index;
+		     note_index < segment->note_end_index;
+		     note_index++ )
+		{
+			if( info_handle->abort != 0 )
+			{
+				break;
+			}
+			if( info_handle_read_note_statistics(
+			     segment->input_file,
+			     note_index,
+			     &( segment->statistics ),
+			     &( segment->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( segment->error ),
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read statistics of note: %d.",
+				 function,
+				 note_index );
+
+				goto on_error;
+			}
+		}
+		if( libnsfdb_file_close(
+		     segment->input_file,
+		     &( segment->error ) ) != 0 )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libnsfdb_file_free(
+		     &( segment->input_file ),
+		     &( segment->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( segment->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle_close_file_io_handle(
+	     &( segment->file_io_handle ),
+	     &( segment->error ) ) != 1 )
+	{
+		libcerror_error_set(
+		 &( segment->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	segment->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( segment->input_file != NULL )
+	{
+		libnsfdb_file_free(
+		 &( segment->input_file ),
+		 NULL );
+	}
+	if( segment->file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( segment->file_io_handle ),
+		 NULL );
+	}
+	segment->result = -1;
+
+	return( -1 );
+}
+
+/* Adds the statistics of a segment to the statistics
+ */
+void info_handle_statistics_merge(
+      info_handle_statistics_t *statistics,
+      const info_handle_statistics_t *segment_statistics )
+{
+	int value_index = 0;
+
+	if( ( statistics == NULL )
+	 || ( segment_statistics == NULL ) )
+	{
+		return;
+	}
+	statistics->number_of_summary_buckets     += segment_statistics->number_of_summary_buckets;
+	statistics->summary_bucket_data_size      += segment_statistics->summary_bucket_data_size;
+	statistics->summary_slots_data_size       += segment_statistics->summary_slots_data_size;
+	statistics->number_of_non_summary_buckets += segment_statistics->number_of_non_summary_buckets;
+	statistics->non_summary_bucket_data_size  += segment_statistics->non_summary_bucket_data_size;
+	statistics->non_summary_slots_data_size   += segment_statistics->non_summary_slots_data_size;
+	statistics->number_of_slots               += segment_statistics->number_of_slots;
+	statistics->number_of_notes               += segment_statistics->number_of_notes;
+	statistics->number_of_note_items          += segment_statistics->number_of_note_items;
+
+	for( value_index = 0;
+	     value_index < 16;
+	     value_index++ )
+	{
+		statistics->note_classes[ value_index ] += segment_statistics->note_classes[ value_index ];
+		statistics->status_flags[ value_index ] += segment_statistics->status_flags[ value_index ];
+	}
+	for( value_index = 0;
+	     value_index < INFO_HANDLE_NUMBER_OF_SIZE_CLASSES;
+	     value_index++ )
+	{
+		statistics->note_sizes[ value_index ] += segment_statistics->note_sizes[ value_index ];
+		statistics->item_sizes[ value_index ] += segment_statistics->item_sizes[ value_index ];
+	}
+}
+
+/* Reads the statistics of the input file
+ * The buckets and notes are divided over the threads and the statistics of every thread are merged afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_read_statistics(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	info_handle_segment_t *segment = NULL;
+	static char *function          = "info_handle_read_statistics";
+	uint64_t end_time              = 0;
+	uint64_t start_time            = 0;
+	int number_of_segments         = 0;
+	int segment_index              = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->segments != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - segments value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_get_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_read_buckets(
+	     info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buckets.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_segments = info_handle->number_of_threads;
+
+	if( ( number_of_segments > info_handle->number_of_buckets )
+	 && ( number_of_segments > info_handle->number_of_notes ) )
+	{
+		if( info_handle->number_of_buckets > info_handle->number_of_notes )
+		{
+			number_of_segments = info_handle->number_of_buckets;
+		}
+		else
+		{
+			number_of_segments = info_handle->number_of_notes;
+		}
+	}
+	if( number_of_segments < 1 )
+	{
+		number_of_segments = 1;
+	}
+	info_handle->segments = (info_handle_segment_t *) memory_allocate(
+	                                                   sizeof( info_handle_segment_t ) * (size_t) number_of_segments );
+
+	if( info_handle->segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segments.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     info_handle->segments,
+	     0,
+	     sizeof( info_handle_segment_t ) * (size_t) number_of_segments ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segments.",
+		 function );
+
+		memory_free(
+		 info_handle->segments );
+
+		info_handle->segments = NULL;
+
+		goto on_error;
+	}
+	info_handle->number_of_segments = number_of_segments;
+
+	/* Every segment reads an equal share of the buckets and notes
+	 */
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( info_handle->segments[ segment_index ] );
+
+		segment->info_handle = info_handle;
+		segment->start_index = (int) ( ( (int64_t) info_handle->number_of_buckets * segment_index ) / number_of_segments );
+		segment->end_index   = (int) ( ( (int64_t) info_handle->number_of_buckets * ( segment_index + 1 ) ) / number_of_segments );
+
+		segment->note_start_index = (int) ( ( (int64_t) info_handle->number_of_notes * segment_index ) / number_of_segments );
+		segment->note_end_index   = (int) ( ( (int64_t) info_handle->number_of_notes * ( segment_index + 1 ) ) / number_of_segments );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_segments > 1 )
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( info_handle->segments[ segment_index ] );
+
+			if( libcthreads_thread_create(
+			     &( segment->thread ),
+			     NULL,
+			     (int (*)(void *)) &info_handle_read_segment_statistics,
+			     (void *) segment,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			segment = &( info_handle->segments[ segment_index ] );
+
+			if( libcthreads_thread_join(
+			     &( segment->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread: %d.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( segment_index = 0;
+		     segment_index < number_of_segments;
+		     segment_index++ )
+		{
+			info_handle_read_segment_statistics(
+			 &( info_handle->segments[ segment_index ] ) );
+		}
+	}
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( info_handle->segments[ segment_index ] );
+
+		if( segment->result != 1 )
+		{
+			/* Pass the error of the segment on to the caller
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error         = segment->error;
+				segment->error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to read statistics of segment: %d.",
+			 function,
+			 segment_index );
+
+			goto on_error;
+		}
+		info_handle_statistics_merge(
+		 &( info_handle->statistics ),
+		 &( segment->statistics ) );
+
+		info_handle->number_of_bytes += segment->number_of_bytes;
+	}
+	if( info_handle_get_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	info_handle->statistics_time = end_time - start_time;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( info_handle->segments != NULL )
+	{
+		info_handle->abort = 1;
+
+		for( segment_index = 0;
+		     segment_index < info_handle->number_of_segments;
+		     segment_index++ )
+		{
+			if( info_handle->segments[ segment_index ].thread != NULL )
+			{
+				libcthreads_thread_join(
+				 &( info_handle->segments[ segment_index ].thread ),
+				 NULL );
+			}
+		}
+	}
+#endif
+	return( -1 );
+}
+
+/* Prints the non-empty size classes
+ */
+void info_handle_size_classes_fprint(
+      info_handle_t *info_handle,
+      const uint64_t *size_classes )
+{
+	uint64_t lower_bound = 0;
+	int size_class       = 0;
+
+	if( ( info_handle == NULL )
+	 || ( size_classes == NULL ) )
+	{
+		return;
+	}
+	for( size_class = 0;
+	     size_class < INFO_HANDLE_NUMBER_OF_SIZE_CLASSES;
+	     size_class++ )
+	{
+		if( size_classes[ size_class ] == 0 )
+		{
+			continue;
+		}
+		if( size_class == 0 )
+		{
+			lower_bound = 0;
+		}
+		else
+		{
+			lower_bound = (uint64_t) 1 << size_class;
+		}
+		if( size_class == ( INFO_HANDLE_NUMBER_OF_SIZE_CLASSES - 1 ) )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t%" PRIu64 " and more bytes\t: %" PRIu64 "\n",
+			 lower_bound,
+			 size_classes[ size_class ] );
+		}
+		else
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t%" PRIu64 " - %" PRIu64 " bytes\t: %" PRIu64 "\n",
+			 lower_bound,
+			 ( (uint64_t) 2 << size_class ) - 1,
+			 size_classes[ size_class ] );
+		}
+	}
+}
+
+/* Prints the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	const char *note_class_strings[ 16 ] = {
+		"Document", "Info", "Form", "View", "Icon", "Design", "ACL", "Help index",
+		"Help", "Filter", "Field", "Replication formula", "Private", "Unknown (0x2000)", "Unknown (0x4000)", "Default" };
+
+	info_handle_statistics_t *statistics = NULL;
+	static char *function                = "info_handle_statistics_fprint";
+	uint64_t fill_factor                 = 0;
+	uint64_t non_summary_fraction        = 0;
+	uint64_t throughput                  = 0;
+	uint64_t total_data_size             = 0;
+	int bit_index                        = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	statistics = &( info_handle->statistics );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Notes Storage Facility statistics:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tFormat version\t\t\t: %" PRIu32 "\n",
+	 info_handle->format_version );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tFile size\t\t\t: %" PRIu64 " bytes\n",
+	 info_handle->file_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of RRV buckets\t\t: %d\n",
+	 info_handle->number_of_rrv_buckets );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of UNK table entries\t: %d\n",
+	 info_handle->number_of_unk_table_entries );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	/* The fill factor is the fraction of the bucket data used by slots, in 0.1 percent
+	 */
+	fprintf(
+	 info_handle->notify_stream,
+	 "Buckets:\n" );
+
+	if( statistics->summary_bucket_data_size > 0 )
+	{
+		fill_factor = ( statistics->summary_slots_data_size * 1000 ) / statistics->summary_bucket_data_size;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of summary buckets\t: %d\n",
+	 statistics->number_of_summary_buckets );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tSummary bucket data size\t: %" PRIu64 " bytes\n",
+	 statistics->summary_bucket_data_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tSummary bucket fill factor\t: %" PRIu64 ".%" PRIu64 "%%\n",
+	 fill_factor / 10,
+	 fill_factor % 10 );
+
+	fill_factor = 0;
+
+	if( statistics->non_summary_bucket_data_size > 0 )
+	{
+		fill_factor = ( statistics->non_summary_slots_data_size * 1000 ) / statistics->non_summary_bucket_data_size;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of non-summary buckets\t: %d\n",
+	 statistics->number_of_non_summary_buckets );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNon-summary bucket data size\t: %" PRIu64 " bytes\n",
+	 statistics->non_summary_bucket_data_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNon-summary bucket fill factor\t: %" PRIu64 ".%" PRIu64 "%%\n",
+	 fill_factor / 10,
+	 fill_factor % 10 );
+
+	total_data_size = statistics->summary_bucket_data_size
+	                + statistics->non_summary_bucket_data_size;
+
+	if( total_data_size > 0 )
+	{
+		non_summary_fraction = ( statistics->non_summary_bucket_data_size * 1000 ) / total_data_size;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNon-summary data\t\t: %" PRIu64 ".%" PRIu64 "%%\n",
+	 non_summary_fraction / 10,
+	 non_summary_fraction % 10 );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of slots\t\t\t: %" PRIu64 "\n",
+	 statistics->number_of_slots );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Notes:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of notes\t\t\t: %" PRIu64 "\n",
+	 statistics->number_of_notes );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of note items\t\t: %" PRIu64 "\n",
+	 statistics->number_of_note_items );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Notes per class:\n" );
+
+	for( bit_index = 0;
+	     bit_index < 16;
+	     bit_index++ )
+	{
+		if( statistics->note_classes[ bit_index ] == 0 )
+		{
+			continue;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t%-24s: %" PRIu64 "\n",
+		 note_class_strings[ bit_index ],
+		 statistics->note_classes[ bit_index ] );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Notes per status flag:\n" );
+
+	for( bit_index = 0;
+	     bit_index < 16;
+	     bit_index++ )
+	{
+		if( statistics->status_flags[ bit_index ] == 0 )
+		{
+			continue;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t0x%04x\t\t\t\t: %" PRIu64 "\n",
+		 1 << bit_index,
+		 statistics->status_flags[ bit_index ] );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Note sizes:\n" );
+
+	info_handle_size_classes_fprint(
+	 info_handle,
+	 statistics->note_sizes );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Note item data sizes:\n" );
+
+	info_handle_size_classes_fprint(
+	 info_handle,
+	 statistics->item_sizes );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Performance:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of threads\t\t: %d\n",
+	 info_handle->number_of_segments );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of bytes read\t\t: %" PRIu64 "\n",
+	 info_handle->number_of_bytes );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tTime\t\t\t\t: %" PRIu64 ".%06" PRIu64 " seconds\n",
+	 info_handle->statistics_time / 1000000,
+	 info_handle->statistics_time % 1000000 );
+
+	/* The number of bytes per micro second equals the number of MB (10^6 bytes) per second
+	 */
+	if( info_handle->statistics_time > 0 )
+	{
+		throughput = ( info_handle->number_of_bytes * 10 ) / info_handle->statistics_time;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tThroughput\t\t\t: %" PRIu64 ".%" PRIu64 " MB/s\n",
+	 throughput / 10,
+	 throughput % 10 );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
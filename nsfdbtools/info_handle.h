@@ -26,21 +26,229 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "nsfdbtools_libbfio.h"
 #include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcthreads.h"
 #include "nsfdbtools_libnsfdb.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+#define INFO_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The sizes are counted in power of 2 size classes, the last class
+ * also contains all sizes that exceed it
+ */
+#define INFO_HANDLE_NUMBER_OF_SIZE_CLASSES	24
+
+enum INFO_HANDLE_BUCKET_TYPES
+{
+	INFO_HANDLE_BUCKET_TYPE_NON_SUMMARY	= (uint8_t) 'n',
+	INFO_HANDLE_BUCKET_TYPE_SUMMARY		= (uint8_t) 's'
+};
+
+typedef struct info_handle_bucket info_handle_bucket_t;
+
+struct info_handle_bucket
+{
+	/* The bucket type
+	 */
+	uint8_t type;
+
+	/* The index of the bucket in the structure map
+	 */
+	int structure_index;
+
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The size
+	 */
+	size64_t size;
+};
+
+typedef struct info_handle_statistics info_handle_statistics_t;
+
+struct info_handle_statistics
+{
+	/* The number of summary buckets read
+	 */
+	int number_of_summary_buckets;
+
+	/* The number of bytes in summary buckets
+	 */
+	uint64_t summary_bucket_data_size;
+
+	/* The number of bytes in summary bucket slots
+	 */
+	uint64_t summary_slots_data_size;
+
+	/* The number of non-summary buckets read
+	 */
+	int number_of_non_summary_buckets;
+
+	/* The number of bytes in non-summary buckets
+	 */
+	uint64_t non_summary_bucket_data_size;
+
+	/* The number of bytes in non-summary bucket slots
+	 */
+	uint64_t non_summary_slots_data_size;
+
+	/* The number of slots
+	 */
+	uint64_t number_of_slots;
+
+	/* The number of notes
+	 */
+	uint64_t number_of_notes;
+
+	/* The number of notes per note class bit
+	 */
+	uint64_t note_classes[ 16 ];
+
+	/* The number of notes per status flag bit
+	 */
+	uint64_t status_flags[ 16 ];
+
+	/* The number of notes per size class
+	 */
+	uint64_t note_sizes[ INFO_HANDLE_NUMBER_OF_SIZE_CLASSES ];
+
+	/* The number of note items
+	 */
+	uint64_t number_of_note_items;
+
+	/* The number of note items per data size class
+	 */
+	uint64_t item_sizes[ INFO_HANDLE_NUMBER_OF_SIZE_CLASSES ];
+};
+
 typedef struct info_handle info_handle_t;
 
+typedef struct info_handle_segment info_handle_segment_t;
+
+struct info_handle_segment
+{
+	/* The info handle
+	 */
+	info_handle_t *info_handle;
+
+	/* The index of the first bucket
+	 */
+	int start_index;
+
+	/* The index of the bucket after the last bucket
+	 */
+	int end_index;
+
+	/* The index of the first note
+	 */
+	int note_start_index;
+
+	/* The index of the note after the last note
+	 */
+	int note_end_index;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The input file used to read the notes
+	 */
+	libnsfdb_file_t *input_file;
+
+	/* The statistics of the buckets and notes in the segment
+	 */
+	info_handle_statistics_t statistics;
+
+	/* The number of bytes read
+	 */
+	size64_t number_of_bytes;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
 struct info_handle
 {
+	/* The input filename
+	 */
+	const system_character_t *filename;
+
 	/* The input file
 	 */
 	libnsfdb_file_t *input_file;
 
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The format version
+	 */
+	uint32_t format_version;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The number of RRV buckets
+	 */
+	int number_of_rrv_buckets;
+
+	/* The number of unique name key (UNK) table entries
+	 */
+	int number_of_unk_table_entries;
+
+	/* The number of notes
+	 */
+	int number_of_notes;
+
+	/* The structure map
+	 */
+	libnsfdb_structure_map_t *structure_map;
+
+	/* The buckets
+	 */
+	info_handle_bucket_t *buckets;
+
+	/* The number of buckets
+	 */
+	int number_of_buckets;
+
+	/* The segments
+	 */
+	info_handle_segment_t *segments;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The statistics
+	 */
+	info_handle_statistics_t statistics;
+
+	/* The number of bytes read
+	 */
+	size64_t number_of_bytes;
+
+	/* The time spent on gathering the statistics, in micro seconds
+	 */
+	uint64_t statistics_time;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -71,10 +279,73 @@ int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_copy_from_decimal_string(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
+int info_handle_set_number_of_threads(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_get_time(
+     uint64_t *time_value,
+     libcerror_error_t **error );
+
+int info_handle_open_file_io_handle(
+     info_handle_t *info_handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int info_handle_close_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
 int info_handle_file_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_get_size_class(
+     uint32_t size );
+
+int info_handle_read_buckets(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_read_note_statistics(
+     libnsfdb_file_t *input_file,
+     int note_index,
+     info_handle_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int info_handle_read_bucket_statistics(
+     libnsfdb_structure_map_t *structure_map,
+     libbfio_handle_t *file_io_handle,
+     info_handle_bucket_t *bucket_reference,
+     info_handle_statistics_t *statistics,
+     size64_t *number_of_bytes,
+     libcerror_error_t **error );
+
+int info_handle_read_segment_statistics(
+     info_handle_segment_t *segment );
+
+void info_handle_statistics_merge(
+      info_handle_statistics_t *statistics,
+      const info_handle_statistics_t *segment_statistics );
+
+int info_handle_read_statistics(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+void info_handle_size_classes_fprint(
+      info_handle_t *info_handle,
+      const uint64_t *size_classes );
+
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,451 @@
+/*
+ * Benchmarks reading a Notes Storage Facility (NSF) database file.
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "bench_handle.h"
+#include "nsfdbtools_getopt.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libclocale.h"
+#include "nsfdbtools_libcnotify.h"
+#include "nsfdbtools_libnsfdb.h"
+#include "nsfdbtools_output.h"
+#include "nsfdbtools_signal.h"
+#include "nsfdbtools_unused.h"
+
+bench_handle_t *nsfdbbench_bench_handle = NULL;
+int nsfdbbench_abort                    = 0;
+
+/* Signal handler for nsfdbbench
+ */
+void nsfdbbench_signal_handler(
+      nsfdbtools_signal_t signal NSFDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "nsfdbbench_signal_handler";
+
+	NSFDBTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	nsfdbbench_abort = 1;
+
+	if( nsfdbbench_bench_handle != NULL )
+	{
+		if( bench_handle_signal_abort(
+		     nsfdbbench_bench_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal benchmark handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use nsfdbbench to measure the performance of reading a Notes Storage Facility (NSF) database file.\n"
+		"The results are written to stdout as a JSON document.";
+
+	nsfdbtools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'i', "index_file", "use the index file to open the source file" },
+		{ 'l', "number_of_lookups", "the number of note lookups per run, default is 1000" },
+		{ 'm', "mode", "the benchmark mode, options: cold, warm (default). Cold tries to drop the cached file data before every run" },
+		{ 'r', "number_of_runs", "the number of runs, default is 5" },
+		{ 's', "seed", "the seed of the note lookup sequence, default is 1" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libnsfdb_error_t *error                      = NULL;
+	system_character_t *option_index_file        = NULL;
+	system_character_t *option_mode              = NULL;
+	system_character_t *option_number_of_lookups = NULL;
+	system_character_t *option_number_of_runs    = NULL;
+	system_character_t *option_seed              = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "nsfdbbench";
+	system_integer_t option                      = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( nsfdbtools_option_t ) );
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "nsfdbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( nsfdbtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	/* The version is printed to stderr since stdout contains the JSON document
+	 */
+	nsfdbtools_output_version_fprint(
+	 stderr,
+	 program );
+
+	if( nsfdbtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = nsfdbtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				nsfdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				nsfdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_index_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'l':
+				option_number_of_lookups = optarg;
+
+				break;
+
+			case (system_integer_t) 'm':
+				option_mode = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_number_of_runs = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_seed = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				nsfdbtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		nsfdbtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libnsfdb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libnsfdb_notify_set_verbose(
+	 verbose );
+
+	if( bench_handle_initialize(
+	     &nsfdbbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize benchmark handle.\n" );
+
+		goto on_error;
+	}
+	nsfdbbench_bench_handle->filename = source;
+
+	if( option_index_file != NULL )
+	{
+		nsfdbbench_bench_handle->index_filename = option_index_file;
+	}
+	if( option_mode != NULL )
+	{
+		result = bench_handle_set_mode(
+		          nsfdbbench_bench_handle,
+		          option_mode,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set mode.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported mode defaulting to: warm.\n" );
+		}
+	}
+	if( option_number_of_lookups != NULL )
+	{
+		result = bench_handle_set_number_of_lookups(
+		          nsfdbbench_bench_handle,
+		          option_number_of_lookups,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of lookups.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of lookups defaulting to: %d.\n",
+			 nsfdbbench_bench_handle->number_of_lookups );
+		}
+	}
+	if( option_number_of_runs != NULL )
+	{
+		result = bench_handle_set_number_of_runs(
+		          nsfdbbench_bench_handle,
+		          option_number_of_runs,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of runs.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of runs defaulting to: %d.\n",
+			 nsfdbbench_bench_handle->number_of_runs );
+		}
+	}
+	if( option_seed != NULL )
+	{
+		if( bench_handle_set_seed(
+		     nsfdbbench_bench_handle,
+		     option_seed,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set seed.\n" );
+
+			goto on_error;
+		}
+	}
+	if( nsfdbtools_signal_attach(
+	     nsfdbbench_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle_runs_fprint(
+	     nsfdbbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run benchmark.\n" );
+
+		goto on_error;
+	}
+	if( nsfdbtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle_free(
+	     &nsfdbbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free benchmark handle.\n" );
+
+		goto on_error;
+	}
+	if( nsfdbbench_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Benchmark aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( nsfdbbench_bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &nsfdbbench_bench_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,411 @@
+/*
+ * Checks the integrity of a Notes Storage Facility (NSF) database file.
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "check_handle.h"
+#include "nsfdbtools_getopt.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libclocale.h"
+#include "nsfdbtools_libcnotify.h"
+#include "nsfdbtools_libnsfdb.h"
+#include "nsfdbtools_output.h"
+#include "nsfdbtools_signal.h"
+#include "nsfdbtools_unused.h"
+
+/* The exit status used when corrupted structures were found
+ */
+#define NSFDBCHECK_EXIT_CORRUPTED	2
+
+check_handle_t *nsfdbcheck_check_handle = NULL;
+int nsfdbcheck_abort                     = 0;
+
+/* Signal handler for nsfdbcheck
+ */
+void nsfdbcheck_signal_handler(
+      nsfdbtools_signal_t signal NSFDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "nsfdbcheck_signal_handler";
+
+	NSFDBTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	nsfdbcheck_abort = 1;
+
+	if( nsfdbcheck_check_handle != NULL )
+	{
+		if( check_handle_signal_abort(
+		     nsfdbcheck_check_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal check handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use nsfdbcheck to verify the checksums and sizes of the structures in a Notes Storage Facility (NSF) database file.\n"
+		"The exit status is 0 if no corruption was found, 2 if corrupted structures were found and 1 on error.";
+
+	nsfdbtools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'j', NULL, "print the report to stdout as a JSON document" },
+		{ 't', "number_of_threads", "the number of threads, default is 1" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libnsfdb_error_t *error                      = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "nsfdbcheck";
+	system_integer_t option                      = 0;
+	uint8_t json_output                          = 0;
+	int number_of_corrupted_structures           = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( nsfdbtools_option_t ) );
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "nsfdbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( nsfdbtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	/* The version is printed to stderr since stdout can contain the JSON document
+	 */
+	nsfdbtools_output_version_fprint(
+	 stderr,
+	 program );
+
+	if( nsfdbtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = nsfdbtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				nsfdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				nsfdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				json_output = 1;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				nsfdbtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		nsfdbtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libnsfdb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libnsfdb_notify_set_verbose(
+	 verbose );
+
+	if( check_handle_initialize(
+	     &nsfdbcheck_check_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize check handle.\n" );
+
+		goto on_error;
+	}
+	nsfdbcheck_check_handle->filename    = source;
+	nsfdbcheck_check_handle->json_output = json_output;
+
+	if( option_number_of_threads != NULL )
+	{
+		result = check_handle_set_number_of_threads(
+		          nsfdbcheck_check_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 nsfdbcheck_check_handle->number_of_threads );
+		}
+	}
+	if( nsfdbtools_signal_attach(
+	     nsfdbcheck_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( check_handle_check(
+	     nsfdbcheck_check_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to check file.\n" );
+
+		goto on_error;
+	}
+	if( nsfdbtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( nsfdbcheck_abort == 0 )
+	{
+		if( json_output != 0 )
+		{
+			result = check_handle_report_json_fprint(
+			          nsfdbcheck_check_handle,
+			          &error );
+		}
+		else
+		{
+			result = check_handle_report_fprint(
+			          nsfdbcheck_check_handle,
+			          &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print report.\n" );
+
+			goto on_error;
+		}
+		if( check_handle_get_number_of_corrupted_structures(
+		     nsfdbcheck_check_handle,
+		     &number_of_corrupted_structures,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of corrupted structures.\n" );
+
+			goto on_error;
+		}
+	}
+	if( check_handle_free(
+	     &nsfdbcheck_check_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free check handle.\n" );
+
+		goto on_error;
+	}
+	if( nsfdbcheck_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Check aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( number_of_corrupted_structures > 0 )
+	{
+		return( NSFDBCHECK_EXIT_CORRUPTED );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( nsfdbcheck_check_handle != NULL )
+	{
+		check_handle_free(
+		 &nsfdbcheck_check_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -42,6 +42,7 @@
 #include <unistd.h>
 #endif
 
+#include "batch_handle.h"
 #include "export_handle.h"
 #include "log_handle.h"
 #include "nsfdbtools_getopt.h"
@@ -54,6 +55,7 @@
 #include "nsfdbtools_signal.h"
 #include "nsfdbtools_unused.h"
 
+batch_handle_t *nsfdbexport_batch_handle   = NULL;
 export_handle_t *nsfdbexport_export_handle = NULL;
 int nsfdbexport_abort                      = 0;
 
@@ -69,6 +71,22 @@ void nsfdbexport_signal_handler(
 
 	nsfdbexport_abort = 1;
 
+	if( nsfdbexport_batch_handle != NULL )
+	{
+		if( batch_handle_signal_abort(
+		     nsfdbexport_batch_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal batch handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	if( nsfdbexport_export_handle != NULL )
 	{
 		if( export_handle_signal_abort(
@@ -101,6 +119,344 @@ void nsfdbexport_signal_handler(
 	}
 }
 
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+/* Exports a source file in batch mode
+ * The export options are copied from the export handle passed as arguments and the
+ * export is written to the target path followed by the name of the source file
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdbexport_export_batch_file(
+     batch_handle_file_t *batch_file,
+     void *arguments,
+     libcerror_error_t **error )
+{
+	export_handle_t *batch_export_handle = NULL;
+	export_handle_t *export_handle       = NULL;
+	log_handle_t *log_handle             = NULL;
+	char *log_filename                   = NULL;
+	char *target_path                    = NULL;
+	const char *source_name              = NULL;
+	static char *function                = "nsfdbexport_export_batch_file";
+	size_t log_filename_size             = 0;
+	size_t source_name_length            = 0;
+	size_t target_path_size              = 0;
+	int result                           = 0;
+
+	if( batch_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch file.",
+		 function );
+
+		return( -1 );
+	}
+	if( arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arguments.",
+		 function );
+
+		return( -1 );
+	}
+	batch_export_handle = (export_handle_t *) arguments;
+
+	source_name        = batch_file->name;
+	source_name_length = narrow_string_length(
+	                      source_name );
+
+	if( batch_export_handle->target_path != NULL )
+	{
+		if( libcpath_path_join(
+		     &target_path,
+		     &target_path_size,
+		     batch_export_handle->target_path,
+		     batch_export_handle->target_path_size - 1,
+		     source_name,
+		     source_name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create target path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_initialize(
+	     &export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_copy_options(
+	     export_handle,
+	     batch_export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy export options.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_set_target_path(
+	     export_handle,
+	     ( target_path != NULL ) ? target_path : source_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set target path.",
+		 function );
+
+		goto on_error;
+	}
+	result = export_handle_create_items_export_path(
+	          export_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create items export path.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: %s already exists.",
+		 function,
+		 export_handle->items_export_path );
+
+		goto on_error;
+	}
+	/* Every source file has its own log, which also contains the export progress
+	 */
+	if( export_handle_set_export_path(
+	     export_handle,
+	     export_handle->target_path,
+	     export_handle->target_path_size - 1,
+	     ".log",
+	     4,
+	     &log_filename,
+	     &log_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set log filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( log_handle_initialize(
+	     &log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize log handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( log_handle_open(
+	     log_handle,
+	     log_filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open log file: %s.",
+		 function,
+		 log_filename );
+
+		goto on_error;
+	}
+	export_handle->notify_stream = log_handle->log_stream;
+
+	if( export_handle_open_input(
+	     export_handle,
+	     batch_file->filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 batch_file->filename );
+
+		log_handle_printf(
+		 log_handle,
+		 "Unable to open file: %s.\n",
+		 batch_file->filename );
+
+		goto on_error;
+	}
+	result = export_handle_export_file(
+	          export_handle,
+	          log_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export file: %s.",
+		 function,
+		 batch_file->filename );
+
+		log_handle_printf(
+		 log_handle,
+		 "Unable to export file: %s.\n",
+		 batch_file->filename );
+
+		export_handle_close_input(
+		 export_handle,
+		 NULL );
+
+		goto on_error;
+	}
+	log_handle_printf(
+	 log_handle,
+	 "Exported notes: %d.\n",
+	 export_handle->number_of_exported_notes );
+
+	if( export_handle_close_input(
+	     export_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file: %s.",
+		 function,
+		 batch_file->filename );
+
+		goto on_error;
+	}
+	if( export_handle_free(
+	     &export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( log_handle_close(
+	     log_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close log file: %s.",
+		 function,
+		 log_filename );
+
+		goto on_error;
+	}
+	if( log_handle_free(
+	     &log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free log handle.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 log_filename );
+
+	if( target_path != NULL )
+	{
+		memory_free(
+		 target_path );
+	}
+	return( 1 );
+
+on_error:
+	if( export_handle != NULL )
+	{
+		export_handle_free(
+		 &export_handle,
+		 NULL );
+	}
+	if( log_handle != NULL )
+	{
+		log_handle_close(
+		 log_handle,
+		 NULL );
+		log_handle_free(
+		 &log_handle,
+		 NULL );
+	}
+	if( log_filename != NULL )
+	{
+		memory_free(
+		 log_filename );
+	}
+	if( target_path != NULL )
+	{
+		memory_free(
+		 target_path );
+	}
+	return( -1 );
+}
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -113,8 +469,18 @@ int main( int argc, char * const argv[] )
 		"Use nsfdbexport to export items stored in a Notes Storage Facility (NSF) database file.";
 
 	nsfdbtools_option_t options[ ] = {
+		{ 'b', NULL, "batch mode, where the source is a directory or a file that contains a list of source files" },
+		{ 'c', "checkpoint", "only export the notes modified after the checkpoint, where the checkpoint is the value printed by a previous export" },
+		{ 'd', "blob_directory", "store summary item values of 4096 bytes or more once in the blob directory, named by their SHA-256 hash, in the jsonl export mode" },
+		{ 'f', "note_classes", "only export the notes of specific note classes, options: all (default), design, documents" },
 		{ 'h', NULL, "shows this help" },
+		{ 'i', "index_file", "use the index file to open the source file and store the note index after the export" },
+		{ 'j', "number_of_jobs", "the number of source files exported concurrently in batch mode, default is 1" },
 		{ 'l', "log_file", "logs information about the exported items" },
+		{ 'm', "mode", "export mode, options: arrow, items (default), jsonl" },
+		{ 'n', "item_names", "comma separated names of the items to export as columns in the arrow export mode" },
+		{ 'r', NULL, "resume an interrupted export, the progress is stored in the target path followed by .resume" },
+		{ 's', "shard", "only export shard k out of n shards, specified as k/n, where the notes are partitioned into n disjoint ranges" },
 		{ 't', "target", "specify the target directory to export to (default is the source filename followed by .export)" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
@@ -122,18 +488,28 @@ int main( int argc, char * const argv[] )
 	};
 	system_character_t options_string[ 32 ];
 
-	libcerror_error_t *error               = NULL;
-	log_handle_t *log_handle               = NULL;
-	system_character_t *log_filename       = NULL;
-	system_character_t *option_target_path = NULL;
-	system_character_t *path_separator     = NULL;
-	system_character_t *source             = NULL;
-	char *program                          = "nsfdbexport";
-	system_integer_t option                = 0;
-	size_t source_length                   = 0;
-	int number_of_options                  = (int) ( sizeof( options ) / sizeof( nsfdbtools_option_t ) );
-	int result                             = 0;
-	int verbose                            = 0;
+	libcerror_error_t *error                  = NULL;
+	log_handle_t *log_handle                  = NULL;
+	system_character_t *log_filename          = NULL;
+	system_character_t *option_blob_directory = NULL;
+	system_character_t *option_checkpoint     = NULL;
+	system_character_t *option_export_mode    = NULL;
+	system_character_t *option_index_file     = NULL;
+	system_character_t *option_item_names     = NULL;
+	system_character_t *option_note_classes   = NULL;
+	system_character_t *option_number_of_jobs = NULL;
+	system_character_t *option_shard          = NULL;
+	system_character_t *option_target_path    = NULL;
+	system_character_t *path_separator        = NULL;
+	system_character_t *source                = NULL;
+	char *program                             = "nsfdbexport";
+	system_integer_t option                   = 0;
+	size_t source_length                      = 0;
+	int batch_mode                            = 0;
+	int number_of_options                     = (int) ( sizeof( options ) / sizeof( nsfdbtools_option_t ) );
+	int result                                = 0;
+	int resume                                = 0;
+	int verbose                               = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -205,6 +581,26 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'b':
+				batch_mode = 1;
+
+				break;
+
+			case (system_integer_t) 'c':
+				option_checkpoint = optarg;
+
+				break;
+
+			case (system_integer_t) 'd':
+				option_blob_directory = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_note_classes = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				nsfdbtools_getopt_usage_fprint(
 				 stdout,
@@ -215,11 +611,41 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'i':
+				option_index_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'j':
+				option_number_of_jobs = optarg;
+
+				break;
+
 			case (system_integer_t) 'l':
 				log_filename = optarg;
 
 				break;
 
+			case (system_integer_t) 'm':
+				option_export_mode = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_item_names = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				resume = 1;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_shard = optarg;
+
+				break;
+
 			case (system_integer_t) 't':
 				option_target_path = optarg;
 
@@ -254,7 +680,8 @@ int main( int argc, char * const argv[] )
 	}
 	source = argv[ optind ];
 
-	if( option_target_path == NULL )
+	if( ( option_target_path == NULL )
+	 && ( batch_mode == 0 ) )
 	{
 		source_length = system_string_length(
 		                 source );
@@ -305,6 +732,252 @@ int main( int argc, char * const argv[] )
 #if defined( __clang_analyzer__ )
 	__builtin_assume( nsfdbexport_export_handle != NULL );
 #endif
+	if( option_checkpoint != NULL )
+	{
+		if( export_handle_set_checkpoint(
+		     nsfdbexport_export_handle,
+		     option_checkpoint,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set checkpoint.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_note_classes != NULL )
+	{
+		result = export_handle_set_note_classes(
+		          nsfdbexport_export_handle,
+		          option_note_classes,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set note classes.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported note classes defaulting to: all.\n" );
+		}
+	}
+	if( option_export_mode != NULL )
+	{
+		result = export_handle_set_export_mode(
+		          nsfdbexport_export_handle,
+		          option_export_mode,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set export mode.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported export mode defaulting to: items.\n" );
+		}
+	}
+	if( option_blob_directory != NULL )
+	{
+		if( nsfdbexport_export_handle->export_mode != EXPORT_HANDLE_MODE_JSON_LINES )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported blob directory in export mode other than jsonl.\n" );
+
+			goto on_error;
+		}
+		nsfdbexport_export_handle->blob_store_path = option_blob_directory;
+	}
+	if( option_index_file != NULL )
+	{
+		nsfdbexport_export_handle->index_filename = option_index_file;
+	}
+	if( option_item_names != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		fprintf(
+		 stderr,
+		 "Unsupported item names option.\n" );
+
+		goto on_error;
+#else
+		if( export_handle_set_item_names(
+		     nsfdbexport_export_handle,
+		     option_item_names,
+		     system_string_length(
+		      option_item_names ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set item names.\n" );
+
+			goto on_error;
+		}
+#endif
+	}
+	if( batch_mode != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		fprintf(
+		 stderr,
+		 "Unsupported batch mode.\n" );
+
+		goto on_error;
+#else
+		if( ( log_filename != NULL )
+		 || ( option_index_file != NULL )
+		 || ( option_shard != NULL )
+		 || ( resume != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported log file, index file, resume or shard option in batch mode.\n" );
+
+			goto on_error;
+		}
+		/* In batch mode the target path is the directory the source files are exported to
+		 */
+		if( option_target_path != NULL )
+		{
+			if( export_handle_set_target_path(
+			     nsfdbexport_export_handle,
+			     option_target_path,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set target path.\n" );
+
+				goto on_error;
+			}
+		}
+		if( batch_handle_initialize(
+		     &nsfdbexport_batch_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize batch handle.\n" );
+
+			goto on_error;
+		}
+		if( option_number_of_jobs != NULL )
+		{
+			result = batch_handle_set_number_of_threads(
+			          nsfdbexport_batch_handle,
+			          option_number_of_jobs,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set number of jobs.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported number of jobs defaulting to: %d.\n",
+				 nsfdbexport_batch_handle->number_of_threads );
+			}
+		}
+		if( batch_handle_read_source(
+		     nsfdbexport_batch_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read source files from: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
+		if( batch_handle_process_files(
+		     nsfdbexport_batch_handle,
+		     &nsfdbexport_export_batch_file,
+		     (void *) nsfdbexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export files.\n" );
+
+			goto on_error;
+		}
+		if( batch_handle_summary_fprint(
+		     nsfdbexport_batch_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print batch summary.\n" );
+
+			goto on_error;
+		}
+		if( batch_handle_free(
+		     &nsfdbexport_batch_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free batch handle.\n" );
+
+			goto on_error;
+		}
+		if( export_handle_free(
+		     &nsfdbexport_export_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free export handle.\n" );
+
+			goto on_error;
+		}
+		if( log_handle_free(
+		     &log_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free log handle.\n" );
+
+			goto on_error;
+		}
+		if( nsfdbexport_abort != 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Export aborted.\n" );
+
+			return( EXIT_FAILURE );
+		}
+		fprintf(
+		 stdout,
+		 "Export completed.\n" );
+
+		return( EXIT_SUCCESS );
+#endif
+	}
 	if( export_handle_set_target_path(
 	     nsfdbexport_export_handle,
 	     option_target_path,
@@ -316,6 +989,31 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( option_shard != NULL )
+	{
+		result = export_handle_set_shard(
+		          nsfdbexport_export_handle,
+		          option_shard,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set shard.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported shard: %" PRIs_SYSTEM ".\n",
+			 option_shard );
+
+			goto on_error;
+		}
+	}
 	result = export_handle_create_items_export_path(
 	          nsfdbexport_export_handle,
 	          &error );
@@ -328,6 +1026,31 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( resume != 0 )
+	{
+		if( export_handle_read_resume_state(
+		     nsfdbexport_export_handle,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read resume state.\n" );
+
+			goto on_error;
+		}
+	}
+	if( nsfdbexport_export_handle->is_resumed != 0 )
+	{
+		if( result != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "%" PRIs_SYSTEM " does not exist, unable to resume export.\n",
+			 nsfdbexport_export_handle->items_export_path );
+
+			goto on_error;
+		}
+	}
 	else if( result == 0 )
 	{
 		fprintf(
@@ -475,6 +1198,12 @@ on_error:
 		 &log_handle,
 		 NULL );
 	}
+	if( nsfdbexport_batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &nsfdbexport_batch_handle,
+		 NULL );
+	}
 	if( nsfdbexport_export_handle != NULL )
 	{
 		export_handle_free(
@@ -0,0 +1,575 @@
+/*
+ * Generates a synthetic Notes Storage Facility (NSF) database file.
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "generate_handle.h"
+#include "nsfdbtools_getopt.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libclocale.h"
+#include "nsfdbtools_libcnotify.h"
+#include "nsfdbtools_libnsfdb.h"
+#include "nsfdbtools_output.h"
+#include "nsfdbtools_signal.h"
+#include "nsfdbtools_unused.h"
+
+generate_handle_t *nsfdbgenerate_generate_handle = NULL;
+int nsfdbgenerate_abort                          = 0;
+
+/* Signal handler for nsfdbgenerate
+ */
+void nsfdbgenerate_signal_handler(
+      nsfdbtools_signal_t signal NSFDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "nsfdbgenerate_signal_handler";
+
+	NSFDBTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	nsfdbgenerate_abort = 1;
+
+	if( nsfdbgenerate_generate_handle != NULL )
+	{
+		if( generate_handle_signal_abort(
+		     nsfdbgenerate_generate_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal generate handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use nsfdbgenerate to generate a synthetic Notes Storage Facility (NSF) database file.\n"
+		"The generated file contains deterministic pseudo random notes and can be used for testing and benchmarking.";
+
+	nsfdbtools_option_t options[ ] = {
+		{ 'b', "bucket_fill", "the bucket fill percentage, default is 90" },
+		{ 'd', "number_of_non_data_notes", "the number of non-data notes, default is 8" },
+		{ 'h', NULL, "shows this help" },
+		{ 'i', "number_of_items", "the number of items per note, default is 8" },
+		{ 'n', "number_of_notes", "the number of data notes, default is 1000" },
+		{ 's', "summary_percentage", "the percentage of summary items, default is 50" },
+		{ 'S', "seed", "the seed of the generated values, default is 1" },
+		{ 't', "maximum_text_size", "the maximum size of a text item, default is 64" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 'x', "text_percentage", "the percentage of text items, default is 50" },
+		{ 0, "destination", "the destination file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libnsfdb_error_t *error                             = NULL;
+	system_character_t *option_bucket_fill              = NULL;
+	system_character_t *option_maximum_text_size        = NULL;
+	system_character_t *option_number_of_items          = NULL;
+	system_character_t *option_number_of_non_data_notes = NULL;
+	system_character_t *option_number_of_notes          = NULL;
+	system_character_t *option_seed                     = NULL;
+	system_character_t *option_summary_percentage       = NULL;
+	system_character_t *option_text_percentage          = NULL;
+	system_character_t *destination                     = NULL;
+	char *program                                       = "nsfdbgenerate";
+	system_integer_t option                             = 0;
+	int number_of_options                               = (int) ( sizeof( options ) / sizeof( nsfdbtools_option_t ) );
+	int result                                          = 0;
+	int verbose                                         = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "nsfdbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( nsfdbtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	nsfdbtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( nsfdbtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = nsfdbtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				nsfdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_bucket_fill = optarg;
+
+				break;
+
+			case (system_integer_t) 'd':
+				option_number_of_non_data_notes = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				nsfdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_number_of_items = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_number_of_notes = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_summary_percentage = optarg;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_seed = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_maximum_text_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				nsfdbtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'x':
+				option_text_percentage = optarg;
+
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing destination file.\n" );
+
+		nsfdbtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	destination = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libnsfdb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libnsfdb_notify_set_verbose(
+	 verbose );
+
+	if( generate_handle_initialize(
+	     &nsfdbgenerate_generate_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize generate handle.\n" );
+
+		goto on_error;
+	}
+	if( option_number_of_notes != NULL )
+	{
+		result = generate_handle_set_number_of_notes(
+		          nsfdbgenerate_generate_handle,
+		          option_number_of_notes,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of data notes.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of data notes defaulting to: %" PRIu32 ".\n",
+			 nsfdbgenerate_generate_handle->number_of_notes );
+		}
+	}
+	if( option_number_of_non_data_notes != NULL )
+	{
+		result = generate_handle_set_number_of_non_data_notes(
+		          nsfdbgenerate_generate_handle,
+		          option_number_of_non_data_notes,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of non-data notes.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of non-data notes defaulting to: %" PRIu32 ".\n",
+			 nsfdbgenerate_generate_handle->number_of_non_data_notes );
+		}
+	}
+	if( option_number_of_items != NULL )
+	{
+		result = generate_handle_set_number_of_items(
+		          nsfdbgenerate_generate_handle,
+		          option_number_of_items,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of items.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of items defaulting to: %" PRIu32 ".\n",
+			 nsfdbgenerate_generate_handle->number_of_items );
+		}
+	}
+	if( option_summary_percentage != NULL )
+	{
+		result = generate_handle_set_summary_percentage(
+		          nsfdbgenerate_generate_handle,
+		          option_summary_percentage,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set summary percentage.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported summary percentage defaulting to: %" PRIu32 ".\n",
+			 nsfdbgenerate_generate_handle->summary_percentage );
+		}
+	}
+	if( option_text_percentage != NULL )
+	{
+		result = generate_handle_set_text_percentage(
+		          nsfdbgenerate_generate_handle,
+		          option_text_percentage,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set text percentage.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported text percentage defaulting to: %" PRIu32 ".\n",
+			 nsfdbgenerate_generate_handle->text_percentage );
+		}
+	}
+	if( option_maximum_text_size != NULL )
+	{
+		result = generate_handle_set_maximum_text_size(
+		          nsfdbgenerate_generate_handle,
+		          option_maximum_text_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum text size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported maximum text size defaulting to: %" PRIu32 ".\n",
+			 nsfdbgenerate_generate_handle->maximum_text_size );
+		}
+	}
+	if( option_bucket_fill != NULL )
+	{
+		result = generate_handle_set_bucket_fill(
+		          nsfdbgenerate_generate_handle,
+		          option_bucket_fill,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set bucket fill.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported bucket fill defaulting to: %" PRIu32 ".\n",
+			 nsfdbgenerate_generate_handle->bucket_fill );
+		}
+	}
+	if( option_seed != NULL )
+	{
+		if( generate_handle_set_seed(
+		     nsfdbgenerate_generate_handle,
+		     option_seed,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set seed.\n" );
+
+			goto on_error;
+		}
+	}
+	if( nsfdbtools_signal_attach(
+	     nsfdbgenerate_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = generate_handle_generate(
+	          nsfdbgenerate_generate_handle,
+	          destination,
+	          &error );
+
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate database file.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( nsfdbtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( generate_handle_free(
+	     &nsfdbgenerate_generate_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free generate handle.\n" );
+
+		goto on_error;
+	}
+	if( nsfdbgenerate_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Generate aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 stdout,
+		 "Generate failed.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	fprintf(
+	 stdout,
+	 "Generate completed.\n" );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( nsfdbgenerate_generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &nsfdbgenerate_generate_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,399 @@
+/*
+ * Builds and searches a full-text index of a Notes Storage Facility (NSF) database file.
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "index_handle.h"
+#include "nsfdbtools_getopt.h"
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libclocale.h"
+#include "nsfdbtools_libcnotify.h"
+#include "nsfdbtools_libnsfdb.h"
+#include "nsfdbtools_output.h"
+#include "nsfdbtools_signal.h"
+#include "nsfdbtools_unused.h"
+
+index_handle_t *nsfdbindex_index_handle = NULL;
+int nsfdbindex_abort                    = 0;
+
+/* Signal handler for nsfdbindex
+ */
+void nsfdbindex_signal_handler(
+      nsfdbtools_signal_t signal NSFDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "nsfdbindex_signal_handler";
+
+	NSFDBTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	nsfdbindex_abort = 1;
+
+	if( nsfdbindex_index_handle != NULL )
+	{
+		if( index_handle_signal_abort(
+		     nsfdbindex_index_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal index handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use nsfdbindex to build a full-text index of the text items of the notes\n"
+		"in a Notes Storage Facility (NSF) database file or to search such an index.";
+
+	nsfdbtools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'q', "query", "search the index file for the notes that contain all the words of the query instead of building it" },
+		{ 't', "number_of_threads", "the number of threads used to build the index file, default is 1" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file" },
+		{ 0, "index_file", "the index file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libnsfdb_error_t *error                      = NULL;
+	system_character_t *index_file               = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *option_query             = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "nsfdbindex";
+	system_integer_t option                      = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( nsfdbtools_option_t ) );
+	int result                                   = 0;
+	int verbose                                  = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "nsfdbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( nsfdbtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	nsfdbtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( nsfdbtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = nsfdbtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				nsfdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				nsfdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'q':
+				option_query = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				nsfdbtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( optind + 1 ) >= argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source or index file.\n" );
+
+		nsfdbtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source     = argv[ optind ];
+	index_file = argv[ optind + 1 ];
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The text index functions only support narrow character strings
+	 */
+	fprintf(
+	 stderr,
+	 "Unsupported index file.\n" );
+
+	return( EXIT_FAILURE );
+#endif
+	libcnotify_verbose_set(
+	 verbose );
+	libnsfdb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libnsfdb_notify_set_verbose(
+	 verbose );
+
+	if( index_handle_initialize(
+	     &nsfdbindex_index_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize index handle.\n" );
+
+		goto on_error;
+	}
+	nsfdbindex_index_handle->filename = source;
+
+	if( option_number_of_threads != NULL )
+	{
+		result = index_handle_set_number_of_threads(
+		          nsfdbindex_index_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 nsfdbindex_index_handle->number_of_threads );
+		}
+	}
+	if( nsfdbtools_signal_attach(
+	     nsfdbindex_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( option_query != NULL )
+	{
+		result = index_handle_query(
+		          nsfdbindex_index_handle,
+		          (char *) index_file,
+		          (char *) option_query,
+		          &error );
+	}
+	else
+	{
+		result = index_handle_build(
+		          nsfdbindex_index_handle,
+		          (char *) index_file,
+		          &error );
+	}
+	if( result != 1 )
+	{
+		if( option_query != NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to search index file.\n" );
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "Unable to build index file.\n" );
+		}
+		goto on_error;
+	}
+	if( nsfdbtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_handle_free(
+	     &nsfdbindex_index_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free index handle.\n" );
+
+		goto on_error;
+	}
+	if( nsfdbindex_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Index aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( nsfdbindex_index_handle != NULL )
+	{
+		index_handle_free(
+		 &nsfdbindex_index_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
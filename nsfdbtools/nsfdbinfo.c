@@ -40,18 +40,23 @@
 #include <unistd.h>
 #endif
 
+#include "batch_handle.h"
 #include "info_handle.h"
 #include "nsfdbtools_getopt.h"
 #include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcfile.h"
 #include "nsfdbtools_libclocale.h"
 #include "nsfdbtools_libcnotify.h"
+#include "nsfdbtools_libcpath.h"
 #include "nsfdbtools_libnsfdb.h"
 #include "nsfdbtools_output.h"
 #include "nsfdbtools_signal.h"
 #include "nsfdbtools_unused.h"
 
-info_handle_t *nsfdbinfo_info_handle = NULL;
-int nsfdbinfo_abort                  = 0;
+batch_handle_t *nsfdbinfo_batch_handle = NULL;
+info_handle_t *nsfdbinfo_info_handle   = NULL;
+uint8_t nsfdbinfo_print_statistics     = 0;
+int nsfdbinfo_abort                    = 0;
 
 /* Signal handler for nsfdbinfo
  */
@@ -65,6 +70,22 @@ void nsfdbinfo_signal_handler(
 
 	nsfdbinfo_abort = 1;
 
+	if( nsfdbinfo_batch_handle != NULL )
+	{
+		if( batch_handle_signal_abort(
+		     nsfdbinfo_batch_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal batch handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	if( nsfdbinfo_info_handle != NULL )
 	{
 		if( info_handle_signal_abort(
@@ -97,6 +118,293 @@ void nsfdbinfo_signal_handler(
 	}
 }
 
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+/* Prints information about a source file in batch mode
+ * The number of threads is copied from the info handle passed as arguments and the
+ * information is written to the name of the source file followed by .info
+ * in the current working directory
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdbinfo_info_batch_file(
+     batch_handle_file_t *batch_file,
+     void *arguments,
+     libcerror_error_t **error )
+{
+	FILE *output_stream              = NULL;
+	info_handle_t *batch_info_handle = NULL;
+	info_handle_t *info_handle       = NULL;
+	char *output_filename            = NULL;
+	const char *source_name          = NULL;
+	static char *function            = "nsfdbinfo_info_batch_file";
+	size_t output_filename_size      = 0;
+	size_t source_name_length        = 0;
+	int result                       = 0;
+
+	if( batch_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch file.",
+		 function );
+
+		return( -1 );
+	}
+	if( arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arguments.",
+		 function );
+
+		return( -1 );
+	}
+	batch_info_handle = (info_handle_t *) arguments;
+
+	source_name        = batch_file->name;
+	source_name_length = narrow_string_length(
+	                      source_name );
+
+	output_filename_size = source_name_length + 6;
+
+	output_filename = narrow_string_allocate(
+	                   output_filename_size );
+
+	if( output_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     output_filename,
+	     source_name,
+	     source_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source name to output filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     &( output_filename[ source_name_length ] ),
+	     ".info",
+	     5 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy suffix to output filename.",
+		 function );
+
+		goto on_error;
+	}
+	output_filename[ output_filename_size - 1 ] = 0;
+
+	/* Source files with the same name would otherwise overwrite each others output
+	 */
+	result = libcfile_file_exists(
+	          output_filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if output file: %s exists.",
+		 function,
+		 output_filename );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: %s already exists.",
+		 function,
+		 output_filename );
+
+		goto on_error;
+	}
+	output_stream = file_stream_open(
+	                 output_filename,
+	                 FILE_STREAM_OPEN_WRITE );
+
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output file: %s.",
+		 function,
+		 output_filename );
+
+		goto on_error;
+	}
+	if( info_handle_initialize(
+	     &info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize info handle.",
+		 function );
+
+		goto on_error;
+	}
+	info_handle->number_of_threads = batch_info_handle->number_of_threads;
+	info_handle->notify_stream     = output_stream;
+
+	if( info_handle_open_input(
+	     info_handle,
+	     batch_file->filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source file: %s.",
+		 function,
+		 batch_file->filename );
+
+		goto on_error;
+	}
+	if( nsfdbinfo_print_statistics != 0 )
+	{
+		if( info_handle_read_statistics(
+		     info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read statistics.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle_statistics_fprint(
+		     info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print statistics.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( info_handle_file_fprint(
+		     info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print file information.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle_close_input(
+	     info_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_free(
+	     &info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free info handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     output_stream ) != 0 )
+	{
+		output_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output file: %s.",
+		 function,
+		 output_filename );
+
+		goto on_error;
+	}
+	memory_free(
+	 output_filename );
+
+	return( 1 );
+
+on_error:
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	if( output_stream != NULL )
+	{
+		file_stream_close(
+		 output_stream );
+	}
+	if( output_filename != NULL )
+	{
+		memory_free(
+		 output_filename );
+	}
+	return( -1 );
+}
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -109,19 +417,27 @@ int main( int argc, char * const argv[] )
 		"Use nsfdbinfo to determine information about a Notes Storage Facility (NSF) database file.";
 
 	nsfdbtools_option_t options[ ] = {
+		{ 'b', NULL, "batch mode, where the source is a directory or a file that contains a list of source files" },
 		{ 'h', NULL, "shows this help" },
+		{ 'j', "number_of_jobs", "the number of source files processed concurrently in batch mode, default is 1" },
+		{ 's', NULL, "print statistics of the buckets and notes" },
+		{ 't', "number_of_threads", "the number of threads used for the statistics, default is 1" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
 		{ 0, "source", "the source file" },
 	};
 	system_character_t options_string[ 32 ];
 
-	libnsfdb_error_t *error    = NULL;
-	system_character_t *source = NULL;
-	char *program              = "nsfdbinfo";
-	system_integer_t option    = 0;
-	int number_of_options      = (int) ( sizeof( options ) / sizeof( nsfdbtools_option_t ) );
-	int verbose                = 0;
+	libnsfdb_error_t *error                      = NULL;
+	system_character_t *option_number_of_jobs    = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *source                   = NULL;
+	char *program                                = "nsfdbinfo";
+	system_integer_t option                      = 0;
+	int batch_mode                               = 0;
+	int number_of_options                        = (int) ( sizeof( options ) / sizeof( nsfdbtools_option_t ) );
+	int result                                   = 0;
+	int verbose                                  = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -193,6 +509,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'b':
+				batch_mode = 1;
+
+				break;
+
 			case (system_integer_t) 'h':
 				nsfdbtools_getopt_usage_fprint(
 				 stdout,
@@ -203,6 +524,21 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				option_number_of_jobs = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				nsfdbinfo_print_statistics = 1;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -250,27 +586,179 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( info_handle_open_input(
-	     nsfdbinfo_info_handle,
-	     source,
-	     &error ) != 1 )
+	if( option_number_of_threads != NULL )
+	{
+		result = info_handle_set_number_of_threads(
+		          nsfdbinfo_info_handle,
+		          option_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: %d.\n",
+			 nsfdbinfo_info_handle->number_of_threads );
+		}
+	}
+	if( batch_mode != 0 )
 	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		fprintf(
 		 stderr,
-		 "Unable to open source file.\n" );
+		 "Unsupported batch mode.\n" );
 
 		goto on_error;
+#else
+		if( batch_handle_initialize(
+		     &nsfdbinfo_batch_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize batch handle.\n" );
+
+			goto on_error;
+		}
+		if( option_number_of_jobs != NULL )
+		{
+			result = batch_handle_set_number_of_threads(
+			          nsfdbinfo_batch_handle,
+			          option_number_of_jobs,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set number of jobs.\n" );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported number of jobs defaulting to: %d.\n",
+				 nsfdbinfo_batch_handle->number_of_threads );
+			}
+		}
+		if( batch_handle_read_source(
+		     nsfdbinfo_batch_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read source files from: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
+		if( batch_handle_process_files(
+		     nsfdbinfo_batch_handle,
+		     &nsfdbinfo_info_batch_file,
+		     (void *) nsfdbinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process files.\n" );
+
+			goto on_error;
+		}
+		if( batch_handle_summary_fprint(
+		     nsfdbinfo_batch_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print batch summary.\n" );
+
+			goto on_error;
+		}
+		if( batch_handle_free(
+		     &nsfdbinfo_batch_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free batch handle.\n" );
+
+			goto on_error;
+		}
+		if( info_handle_free(
+		     &nsfdbinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free info handle.\n" );
+
+			goto on_error;
+		}
+		if( nsfdbinfo_abort != 0 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+#endif
 	}
-	if( info_handle_file_fprint(
+	if( info_handle_open_input(
 	     nsfdbinfo_info_handle,
+	     source,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to print file information.\n" );
+		 "Unable to open source file.\n" );
 
 		goto on_error;
 	}
+	if( nsfdbinfo_print_statistics != 0 )
+	{
+		if( info_handle_read_statistics(
+		     nsfdbinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read statistics.\n" );
+
+			goto on_error;
+		}
+		if( info_handle_statistics_fprint(
+		     nsfdbinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print statistics.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( info_handle_file_fprint(
+		     nsfdbinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print file information.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close_input(
 	     nsfdbinfo_info_handle,
 	     &error ) != 0 )
@@ -301,6 +789,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( nsfdbinfo_batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &nsfdbinfo_batch_handle,
+		 NULL );
+	}
 	if( nsfdbinfo_info_handle != NULL )
 	{
 		info_handle_free(
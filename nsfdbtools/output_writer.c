@@ -0,0 +1,1115 @@
+/*
+ * Output writer
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcfile.h"
+#include "output_writer.h"
+
+/* The hexadecimal digits used to escape characters and to format data
+ */
+static const char *output_writer_hexadecimal_digits = "0123456789abcdef";
+
+/* Creates an output writer
+ * Make sure the value output_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_initialize(
+     output_writer_t **output_writer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_initialize";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size < 16 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*output_writer = memory_allocate_structure(
+	                  output_writer_t );
+
+	if( *output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_writer,
+	     0,
+	     sizeof( output_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output writer.",
+		 function );
+
+		memory_free(
+		 *output_writer );
+
+		*output_writer = NULL;
+
+		return( -1 );
+	}
+	( *output_writer )->buffer = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * buffer_size );
+
+	if( ( *output_writer )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_writer )->buffer_size = buffer_size;
+
+	return( 1 );
+
+on_error:
+	if( *output_writer != NULL )
+	{
+		memory_free(
+		 *output_writer );
+
+		*output_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output writer
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_free(
+     output_writer_t **output_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_free";
+	int result            = 1;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_writer != NULL )
+	{
+		if( ( *output_writer )->file != NULL )
+		{
+			if( output_writer_close(
+			     *output_writer,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close output writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *output_writer )->buffer );
+
+		memory_free(
+		 *output_writer );
+
+		*output_writer = NULL;
+	}
+	return( result );
+}
+
+/* Opens the output writer
+ * An existing file is truncated
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_open(
+     output_writer_t *output_writer,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_open";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output writer - file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &( output_writer->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     output_writer->file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     output_writer->file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	output_writer->buffer_offset = 0;
+	output_writer->file_offset   = 0;
+
+	return( 1 );
+
+on_error:
+	if( output_writer->file != NULL )
+	{
+		libcfile_file_free(
+		 &( output_writer->file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the output writer to continue writing at a specific offset of an existing file
+ * The data after the offset is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_open_at_offset(
+     output_writer_t *output_writer,
+     const system_character_t *filename,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_open_at_offset";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output writer - file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_initialize(
+	     &( output_writer->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     output_writer->file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     output_writer->file,
+	     filename,
+	     LIBCFILE_OPEN_WRITE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libcfile_file_resize(
+	     output_writer->file,
+	     (size64_t) file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to resize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_seek_offset(
+	     output_writer->file,
+	     file_offset,
+	     SEEK_SET,
+	     error ) != file_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file offset: %" PRIi64 ".",
+		 function,
+		 file_offset );
+
+		goto on_error;
+	}
+	output_writer->buffer_offset = 0;
+	output_writer->file_offset   = file_offset;
+
+	return( 1 );
+
+on_error:
+	if( output_writer->file != NULL )
+	{
+		libcfile_file_free(
+		 &( output_writer->file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the output writer
+ * The buffered data is written before the file is closed
+ * Returns 0 if successful or -1 on error
+ */
+int output_writer_close(
+     output_writer_t *output_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_close";
+	int result            = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->file == NULL )
+	{
+		return( 0 );
+	}
+	if( output_writer_flush(
+	     output_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffer.",
+		 function );
+
+		result = -1;
+	}
+	if( libcfile_file_close(
+	     output_writer->file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libcfile_file_free(
+	     &( output_writer->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Writes the buffered data to the file
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_flush(
+     output_writer_t *output_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_flush";
+	ssize_t write_count   = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid output writer - missing file.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->buffer_offset == 0 )
+	{
+		return( 1 );
+	}
+	write_count = libcfile_file_write_buffer(
+	               output_writer->file,
+	               output_writer->buffer,
+	               output_writer->buffer_offset,
+	               error );
+
+	if( write_count != (ssize_t) output_writer->buffer_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 output_writer->file_offset,
+		 output_writer->file_offset );
+
+		return( -1 );
+	}
+	output_writer->file_offset  += (off64_t) output_writer->buffer_offset;
+	output_writer->buffer_offset = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the current offset, which includes the buffered data
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_get_offset(
+     output_writer_t *output_writer,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_get_offset";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = output_writer->file_offset + (off64_t) output_writer->buffer_offset;
+
+	return( 1 );
+}
+
+/* Truncates the output at a specific offset
+ * This is used to discard partially written data, the buffered data after the offset
+ * is discarded and data that was already written to the file is removed from the file
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_truncate(
+     output_writer_t *output_writer,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_truncate";
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer->file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid output writer - missing file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( offset > ( output_writer->file_offset + (off64_t) output_writer->buffer_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset >= output_writer->file_offset )
+	{
+		output_writer->buffer_offset = (size_t) ( offset - output_writer->file_offset );
+
+		return( 1 );
+	}
+	if( libcfile_file_resize(
+	     output_writer->file,
+	     (size64_t) offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to resize file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcfile_file_seek_offset(
+	     output_writer->file,
+	     offset,
+	     SEEK_SET,
+	     error ) != offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	output_writer->buffer_offset = 0;
+	output_writer->file_offset   = offset;
+
+	return( 1 );
+}
+
+/* Writes a buffer
+ * The data is copied into the buffer of the output writer, data that is larger
+ * than the buffer is written directly
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_buffer(
+     output_writer_t *output_writer,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_write_buffer";
+	ssize_t write_count   = 0;
+
+	if( output_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > ( output_writer->buffer_size - output_writer->buffer_offset ) )
+	{
+		if( output_writer_flush(
+		     output_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( buffer_size >= output_writer->buffer_size )
+		{
+			write_count = libcfile_file_write_buffer(
+			               output_writer->file,
+			               buffer,
+			               buffer_size,
+			               error );
+
+			if( write_count != (ssize_t) buffer_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 output_writer->file_offset,
+				 output_writer->file_offset );
+
+				return( -1 );
+			}
+			output_writer->file_offset += (off64_t) buffer_size;
+
+			return( 1 );
+		}
+	}
+	if( memory_copy(
+	     &( output_writer->buffer[ output_writer->buffer_offset ] ),
+	     buffer,
+	     buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_writer->buffer_offset += buffer_size;
+
+	return( 1 );
+}
+
+/* Writes a string
+ * The end of string character is not written
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_string(
+     output_writer_t *output_writer,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "output_writer_write_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_buffer(
+	     output_writer,
+	     (uint8_t *) string,
+	     narrow_string_length(
+	      string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes data as a quoted JSON string
+ * The characters that need to be escaped are the quotation mark, the reverse solidus
+ * and the control characters. Since the encoding of the data is not known bytes
+ * of 0x80 and higher are escaped as their corresponding Unicode code point
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_json_string(
+     output_writer_t *output_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t escaped_character[ 6 ];
+
+	static char *function         = "output_writer_write_json_string";
+	size_t block_end_offset       = 0;
+	size_t data_offset            = 0;
+	size_t escaped_character_size = 0;
+	size_t run_start_offset       = 0;
+	uint64_t value_64bit          = 0;
+	uint8_t byte_value            = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_writer_write_buffer(
+	     output_writer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	while( data_offset < data_size )
+	{
+		/* Skip 8 bytes at a time as long as none of them needs to be escaped.
+		 * A byte needs to be escaped if its most significant bit is set,
+		 * if it is smaller than 0x20 or if it equals '"' or '\'.
+		 * The subtractions only set the most significant bit of a byte that
+		 * is smaller than the subtrahend, or when a borrow propagates from
+		 * a lower byte that already needs to be escaped.
+		 */
+		if( ( data_size - data_offset ) >= 8 )
+		{
+			memory_copy(
+			 &value_64bit,
+			 &( data[ data_offset ] ),
+			 8 );
+
+			if( ( ( value_64bit
+			      | ( value_64bit - 0x2020202020202020ULL )
+			      | ( ( value_64bit ^ 0x2222222222222222ULL ) - 0x0101010101010101ULL )
+			      | ( ( value_64bit ^ 0x5c5c5c5c5c5c5c5cULL ) - 0x0101010101010101ULL ) )
+			    & 0x8080808080808080ULL ) == 0 )
+			{
+				data_offset += 8;
+
+				continue;
+			}
+			block_end_offset = data_offset + 8;
+		}
+		else
+		{
+			block_end_offset = data_size;
+		}
+		while( data_offset < block_end_offset )
+		{
+			byte_value = data[ data_offset ];
+
+			escaped_character_size = 0;
+
+			if( byte_value == (uint8_t) '"' )
+			{
+				escaped_character[ 1 ] = (uint8_t) '"';
+				escaped_character_size = 2;
+			}
+			else if( byte_value == (uint8_t) '\\' )
+			{
+				escaped_character[ 1 ] = (uint8_t) '\\';
+				escaped_character_size = 2;
+			}
+			else if( byte_value == (uint8_t) '\b' )
+			{
+				escaped_character[ 1 ] = (uint8_t) 'b';
+				escaped_character_size = 2;
+			}
+			else if( byte_value == (uint8_t) '\f' )
+			{
+				escaped_character[ 1 ] = (uint8_t) 'f';
+				escaped_character_size = 2;
+			}
+			else if( byte_value == (uint8_t) '\n' )
+			{
+				escaped_character[ 1 ] = (uint8_t) 'n';
+				escaped_character_size = 2;
+			}
+			else if( byte_value == (uint8_t) '\r' )
+			{
+				escaped_character[ 1 ] = (uint8_t) 'r';
+				escaped_character_size = 2;
+			}
+			else if( byte_value == (uint8_t) '\t' )
+			{
+				escaped_character[ 1 ] = (uint8_t) 't';
+				escaped_character_size = 2;
+			}
+			else if( ( byte_value < 0x20 )
+			      || ( byte_value >= 0x80 ) )
+			{
+				escaped_character[ 1 ] = (uint8_t) 'u';
+				escaped_character[ 2 ] = (uint8_t) '0';
+				escaped_character[ 3 ] = (uint8_t) '0';
+				escaped_character[ 4 ] = (uint8_t) output_writer_hexadecimal_digits[ byte_value >> 4 ];
+				escaped_character[ 5 ] = (uint8_t) output_writer_hexadecimal_digits[ byte_value & 0x0f ];
+				escaped_character_size = 6;
+			}
+			if( escaped_character_size != 0 )
+			{
+				escaped_character[ 0 ] = (uint8_t) '\\';
+
+				if( data_offset > run_start_offset )
+				{
+					if( output_writer_write_buffer(
+					     output_writer,
+					     &( data[ run_start_offset ] ),
+					     data_offset - run_start_offset,
+					     error ) != 1 )
+					{
+						goto on_write_error;
+					}
+				}
+				if( output_writer_write_buffer(
+				     output_writer,
+				     escaped_character,
+				     escaped_character_size,
+				     error ) != 1 )
+				{
+					goto on_write_error;
+				}
+				run_start_offset = data_offset + 1;
+			}
+			data_offset++;
+		}
+	}
+	if( data_size > run_start_offset )
+	{
+		if( output_writer_write_buffer(
+		     output_writer,
+		     &( data[ run_start_offset ] ),
+		     data_size - run_start_offset,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( output_writer_write_buffer(
+	     output_writer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write JSON string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes data as a quoted string of hexadecimal digits
+ * Returns 1 if successful or -1 on error
+ */
+int output_writer_write_hexadecimal_string(
+     output_writer_t *output_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t hexadecimal_string[ 64 ];
+
+	static char *function           = "output_writer_write_hexadecimal_string";
+	size_t data_offset              = 0;
+	size_t hexadecimal_string_index = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	hexadecimal_string[ hexadecimal_string_index++ ] = (uint8_t) '"';
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( ( hexadecimal_string_index + 2 ) > 64 )
+		{
+			if( output_writer_write_buffer(
+			     output_writer,
+			     hexadecimal_string,
+			     hexadecimal_string_index,
+			     error ) != 1 )
+			{
+				goto on_write_error;
+			}
+			hexadecimal_string_index = 0;
+		}
+		hexadecimal_string[ hexadecimal_string_index++ ] = (uint8_t) output_writer_hexadecimal_digits[ data[ data_offset ] >> 4 ];
+		hexadecimal_string[ hexadecimal_string_index++ ] = (uint8_t) output_writer_hexadecimal_digits[ data[ data_offset ] & 0x0f ];
+	}
+	if( ( hexadecimal_string_index + 1 ) > 64 )
+	{
+		if( output_writer_write_buffer(
+		     output_writer,
+		     hexadecimal_string,
+		     hexadecimal_string_index,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		hexadecimal_string_index = 0;
+	}
+	hexadecimal_string[ hexadecimal_string_index++ ] = (uint8_t) '"';
+
+	if( output_writer_write_buffer(
+	     output_writer,
+	     hexadecimal_string,
+	     hexadecimal_string_index,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write hexadecimal string.",
+	 function );
+
+	return( -1 );
+}
+
@@ -0,0 +1,126 @@
+/*
+ * Output writer
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OUTPUT_WRITER_H )
+#define _OUTPUT_WRITER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcfile.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct output_writer output_writer_t;
+
+struct output_writer
+{
+	/* The output file
+	 */
+	libcfile_file_t *file;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The offset of the buffered data that was not yet written
+	 */
+	size_t buffer_offset;
+
+	/* The offset of the buffer in the output file
+	 */
+	off64_t file_offset;
+};
+
+int output_writer_initialize(
+     output_writer_t **output_writer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int output_writer_free(
+     output_writer_t **output_writer,
+     libcerror_error_t **error );
+
+int output_writer_open(
+     output_writer_t *output_writer,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int output_writer_open_at_offset(
+     output_writer_t *output_writer,
+     const system_character_t *filename,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int output_writer_close(
+     output_writer_t *output_writer,
+     libcerror_error_t **error );
+
+int output_writer_flush(
+     output_writer_t *output_writer,
+     libcerror_error_t **error );
+
+int output_writer_get_offset(
+     output_writer_t *output_writer,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+int output_writer_truncate(
+     output_writer_t *output_writer,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int output_writer_write_buffer(
+     output_writer_t *output_writer,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int output_writer_write_string(
+     output_writer_t *output_writer,
+     const char *string,
+     libcerror_error_t **error );
+
+int output_writer_write_json_string(
+     output_writer_t *output_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int output_writer_write_hexadecimal_string(
+     output_writer_t *output_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _OUTPUT_WRITER_H ) */
+
@@ -0,0 +1,939 @@
+/*
+ * Resume state
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if !defined( WINAPI )
+#include <stdio.h>
+#endif
+
+#include "nsfdbtools_libcerror.h"
+#include "nsfdbtools_libcfile.h"
+#include "resume_state.h"
+
+/* The signature of the resume state file
+ */
+const uint8_t resume_state_signature[ 8 ] = { 'n', 's', 'f', 'd', 'b', 'r', 's', 'm' };
+
+/* The format version of the resume state file
+ */
+#define RESUME_STATE_FORMAT_VERSION	2
+
+/* The resume state flags
+ */
+#define RESUME_STATE_FLAG_USE_CHECKPOINT	0x00000001UL
+#define RESUME_STATE_FLAG_HAS_FAILED_NOTES	0x00000002UL
+
+/* Creates a resume state
+ * Make sure the value resume_state is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int resume_state_initialize(
+     resume_state_t **resume_state,
+     libcerror_error_t **error )
+{
+	static char *function = "resume_state_initialize";
+
+	if( resume_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resume state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resume_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resume state value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*resume_state = memory_allocate_structure(
+	                 resume_state_t );
+
+	if( *resume_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resume state.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *resume_state,
+	     0,
+	     sizeof( resume_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear resume state.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *resume_state != NULL )
+	{
+		memory_free(
+		 *resume_state );
+
+		*resume_state = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a resume state
+ * Returns 1 if successful or -1 on error
+ */
+int resume_state_free(
+     resume_state_t **resume_state,
+     libcerror_error_t **error )
+{
+	static char *function = "resume_state_free";
+
+	if( resume_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resume state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resume_state != NULL )
+	{
+		if( ( *resume_state )->item_names != NULL )
+		{
+			memory_free(
+			 ( *resume_state )->item_names );
+		}
+		memory_free(
+		 *resume_state );
+
+		*resume_state = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the item names
+ * The item names are stored as consecutive end-of-string terminated strings
+ * Returns 1 if successful or -1 on error
+ */
+int resume_state_set_item_names(
+     resume_state_t *resume_state,
+     const char *item_names,
+     size_t item_names_size,
+     libcerror_error_t **error )
+{
+	static char *function = "resume_state_set_item_names";
+
+	if( resume_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resume state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( item_names == NULL )
+	 && ( item_names_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item names.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_names_size > (size_t) RESUME_STATE_MAXIMUM_ITEM_NAMES_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid item names size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( resume_state->item_names != NULL )
+	{
+		memory_free(
+		 resume_state->item_names );
+
+		resume_state->item_names      = NULL;
+		resume_state->item_names_size = 0;
+	}
+	if( item_names_size == 0 )
+	{
+		return( 1 );
+	}
+	resume_state->item_names = (char *) memory_allocate(
+	                                     sizeof( char ) * item_names_size );
+
+	if( resume_state->item_names == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item names.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     resume_state->item_names,
+	     item_names,
+	     item_names_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy item names.",
+		 function );
+
+		memory_free(
+		 resume_state->item_names );
+
+		resume_state->item_names = NULL;
+
+		return( -1 );
+	}
+	resume_state->item_names_size = item_names_size;
+
+	return( 1 );
+}
+
+/* Reads the resume state from a file
+ * Returns 1 if successful, 0 if the file does not exist or -1 on error
+ */
+int resume_state_read(
+     resume_state_t *resume_state,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t resume_state_data[ RESUME_STATE_SIZE ];
+
+	libcfile_file_t *file    = NULL;
+	static char *function    = "resume_state_read";
+	ssize_t read_count       = 0;
+	uint32_t flags           = 0;
+	uint32_t item_names_size = 0;
+	uint32_t value_32bit     = 0;
+	uint64_t value_64bit     = 0;
+	int result               = 0;
+
+	if( resume_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resume state.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+		  filename,
+		  error );
+#else
+	result = libcfile_file_exists(
+		  filename,
+		  error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     file,
+	     filename,
+	     LIBCFILE_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     file,
+	     filename,
+	     LIBCFILE_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_read_buffer(
+	              file,
+	              resume_state_data,
+	              RESUME_STATE_SIZE,
+	              error );
+
+	if( read_count != (ssize_t) RESUME_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read resume state data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_compare(
+	     resume_state_data,
+	     resume_state_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported resume state signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( resume_state_data[ 8 ] ),
+	 value_32bit );
+
+	/* A resume state of another format version does not contain all the options
+	 * the export depends on and is therefore not resumed
+	 */
+	if( value_32bit != RESUME_STATE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported resume state format version: %" PRIu32 ".",
+		 function,
+		 value_32bit );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( resume_state_data[ 60 ] ),
+	 item_names_size );
+
+	if( item_names_size > (uint32_t) RESUME_STATE_MAXIMUM_ITEM_NAMES_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item names size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( resume_state->item_names != NULL )
+	{
+		memory_free(
+		 resume_state->item_names );
+
+		resume_state->item_names      = NULL;
+		resume_state->item_names_size = 0;
+	}
+	if( item_names_size > 0 )
+	{
+		resume_state->item_names = (char *) memory_allocate(
+		                                     sizeof( char ) * item_names_size );
+
+		if( resume_state->item_names == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create item names.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libcfile_file_read_buffer(
+		              file,
+		              (uint8_t *) resume_state->item_names,
+		              (size_t) item_names_size,
+		              error );
+
+		if( read_count != (ssize_t) item_names_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read item names.",
+			 function );
+
+			goto on_error;
+		}
+		resume_state->item_names_size = (size_t) item_names_size;
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( resume_state_data[ 12 ] ),
+	 value_32bit );
+
+	resume_state->export_mode = (int) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( resume_state_data[ 16 ] ),
+	 flags );
+
+	resume_state->use_checkpoint   = (uint8_t) ( ( flags & RESUME_STATE_FLAG_USE_CHECKPOINT ) != 0 );
+	resume_state->has_failed_notes = (uint8_t) ( ( flags & RESUME_STATE_FLAG_HAS_FAILED_NOTES ) != 0 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( resume_state_data[ 20 ] ),
+	 value_32bit );
+
+	if( value_32bit > (uint32_t) INT_MAX )
+	{
+		goto on_out_of_bounds;
+	}
+	resume_state->number_of_notes = (int) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( resume_state_data[ 24 ] ),
+	 value_32bit );
+
+	if( value_32bit > (uint32_t) resume_state->number_of_notes )
+	{
+		goto on_out_of_bounds;
+	}
+	resume_state->next_note_index = (int) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( resume_state_data[ 28 ] ),
+	 value_32bit );
+
+	if( value_32bit > (uint32_t) resume_state->next_note_index )
+	{
+		goto on_out_of_bounds;
+	}
+	resume_state->number_of_exported_notes = (int) value_32bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( resume_state_data[ 32 ] ),
+	 resume_state->initial_checkpoint );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( resume_state_data[ 40 ] ),
+	 resume_state->checkpoint );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( resume_state_data[ 48 ] ),
+	 value_64bit );
+
+	if( value_64bit > (uint64_t) INT64_MAX )
+	{
+		goto on_out_of_bounds;
+	}
+	resume_state->output_offset = (off64_t) value_64bit;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( resume_state_data[ 56 ] ),
+	 resume_state->note_class_mask );
+
+	return( 1 );
+
+on_out_of_bounds:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid resume state value out of bounds.",
+	 function );
+
+	return( -1 );
+
+on_error:
+	if( resume_state->item_names != NULL )
+	{
+		memory_free(
+		 resume_state->item_names );
+
+		resume_state->item_names      = NULL;
+		resume_state->item_names_size = 0;
+	}
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the resume state to a file
+ * The resume state is written to the temporary file which then replaces the file,
+ * so that an interruption never leaves a partially written resume state behind
+ * Returns 1 if successful or -1 on error
+ */
+int resume_state_write(
+     resume_state_t *resume_state,
+     const system_character_t *filename,
+     const system_character_t *temporary_filename,
+     libcerror_error_t **error )
+{
+	uint8_t resume_state_data[ RESUME_STATE_SIZE ];
+
+	libcfile_file_t *file = NULL;
+	static char *function = "resume_state_write";
+	ssize_t write_count   = 0;
+	uint32_t flags        = 0;
+
+	if( resume_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resume state.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( temporary_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid temporary filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resume_state->number_of_notes < 0 )
+	 || ( resume_state->next_note_index < 0 )
+	 || ( resume_state->number_of_exported_notes < 0 )
+	 || ( resume_state->output_offset < 0 )
+	 || ( resume_state->item_names_size > (size_t) RESUME_STATE_MAXIMUM_ITEM_NAMES_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid resume state value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     resume_state_data,
+	     0,
+	     RESUME_STATE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear resume state data.",
+		 function );
+
+		return( -1 );
+	}
+	if( resume_state->use_checkpoint != 0 )
+	{
+		flags |= RESUME_STATE_FLAG_USE_CHECKPOINT;
+	}
+	if( resume_state->has_failed_notes != 0 )
+	{
+		flags |= RESUME_STATE_FLAG_HAS_FAILED_NOTES;
+	}
+	if( memory_copy(
+	     resume_state_data,
+	     resume_state_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( resume_state_data[ 8 ] ),
+	 RESUME_STATE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( resume_state_data[ 12 ] ),
+	 (uint32_t) resume_state->export_mode );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( resume_state_data[ 16 ] ),
+	 flags );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( resume_state_data[ 20 ] ),
+	 (uint32_t) resume_state->number_of_notes );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( resume_state_data[ 24 ] ),
+	 (uint32_t) resume_state->next_note_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( resume_state_data[ 28 ] ),
+	 (uint32_t) resume_state->number_of_exported_notes );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( resume_state_data[ 32 ] ),
+	 resume_state->initial_checkpoint );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( resume_state_data[ 40 ] ),
+	 resume_state->checkpoint );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( resume_state_data[ 48 ] ),
+	 (uint64_t) resume_state->output_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( resume_state_data[ 56 ] ),
+	 resume_state->note_class_mask );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( resume_state_data[ 60 ] ),
+	 (uint32_t) resume_state->item_names_size );
+
+	if( libcfile_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_open_wide(
+	     file,
+	     temporary_filename,
+	     LIBCFILE_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+#else
+	if( libcfile_file_open(
+	     file,
+	     temporary_filename,
+	     LIBCFILE_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %" PRIs_SYSTEM ".",
+		 function,
+		 temporary_filename );
+
+		goto on_error;
+	}
+	write_count = libcfile_file_write_buffer(
+	               file,
+	               resume_state_data,
+	               RESUME_STATE_SIZE,
+	               error );
+
+	if( write_count != (ssize_t) RESUME_STATE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write resume state data.",
+		 function );
+
+		goto on_error;
+	}
+	if( resume_state->item_names_size > 0 )
+	{
+		write_count = libcfile_file_write_buffer(
+		               file,
+		               (uint8_t *) resume_state->item_names,
+		               resume_state->item_names_size,
+		               error );
+
+		if( write_count != (ssize_t) resume_state->item_names_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write item names.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcfile_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( MoveFileExW(
+	     temporary_filename,
+	     filename,
+	     MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH ) == 0 )
+#elif defined( WINAPI )
+	if( MoveFileExA(
+	     temporary_filename,
+	     filename,
+	     MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH ) == 0 )
+#elif defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#error Missing wide character rename function
+#else
+	if( rename(
+	     temporary_filename,
+	     filename ) != 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to replace file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libcfile_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Removes the resume state file
+ * Returns 1 if successful, 0 if the file does not exist or -1 on error
+ */
+int resume_state_remove(
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "resume_state_remove";
+	int result            = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_exists_wide(
+		  filename,
+		  error );
+#else
+	result = libcfile_file_exists(
+		  filename,
+		  error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if %" PRIs_SYSTEM " exists.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcfile_file_remove_wide(
+		  filename,
+		  error );
+#else
+	result = libcfile_file_remove(
+		  filename,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 "%s: unable to remove file: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,130 @@
+/*
+ * Resume state
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RESUME_STATE_H )
+#define _RESUME_STATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "nsfdbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the resume state file header, which is followed by the item names
+ */
+#define RESUME_STATE_SIZE		64
+
+/* The maximum size of the item names in the resume state file
+ */
+#define RESUME_STATE_MAXIMUM_ITEM_NAMES_SIZE	( UINT16_MAX + 1 )
+
+typedef struct resume_state resume_state_t;
+
+struct resume_state
+{
+	/* The export mode
+	 */
+	int export_mode;
+
+	/* The note class mask, where 0 represents all note classes
+	 */
+	uint16_t note_class_mask;
+
+	/* The names of the items that are exported as columns in the Arrow export mode
+	 * The names are stored as consecutive end-of-string terminated strings
+	 */
+	char *item_names;
+
+	/* The item names size
+	 */
+	size_t item_names_size;
+
+	/* Value to indicate only the notes modified after the checkpoint are exported
+	 */
+	uint8_t use_checkpoint;
+
+	/* The checkpoint the export was started with
+	 */
+	uint64_t initial_checkpoint;
+
+	/* The checkpoint, which contains the modification time of the last exported note
+	 */
+	uint64_t checkpoint;
+
+	/* Value to indicate a modified note could not be exported
+	 */
+	uint8_t has_failed_notes;
+
+	/* The number of notes
+	 */
+	int number_of_notes;
+
+	/* The index of the next note to export
+	 */
+	int next_note_index;
+
+	/* The number of exported notes
+	 */
+	int number_of_exported_notes;
+
+	/* The offset of the end of the output data that was written
+	 */
+	off64_t output_offset;
+};
+
+int resume_state_initialize(
+     resume_state_t **resume_state,
+     libcerror_error_t **error );
+
+int resume_state_free(
+     resume_state_t **resume_state,
+     libcerror_error_t **error );
+
+int resume_state_set_item_names(
+     resume_state_t *resume_state,
+     const char *item_names,
+     size_t item_names_size,
+     libcerror_error_t **error );
+
+int resume_state_read(
+     resume_state_t *resume_state,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int resume_state_write(
+     resume_state_t *resume_state,
+     const system_character_t *filename,
+     const system_character_t *temporary_filename,
+     libcerror_error_t **error );
+
+int resume_state_remove(
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RESUME_STATE_H ) */
+
@@ -0,0 +1,508 @@
+/*
+ * SHA-256 context
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "nsfdbtools_libcerror.h"
+#include "sha256_context.h"
+
+/* The first 32-bits of the fractional parts of the cube roots of the first 64 primes
+ */
+static const uint32_t sha256_context_prime_cube_roots[ 64 ] = {
+	0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL, 0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+	0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL, 0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+	0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL, 0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+	0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL, 0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+	0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL, 0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+	0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL, 0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+	0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL, 0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+	0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL, 0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL };
+
+/* The first 32-bits of the fractional parts of the square roots of the first 8 primes
+ */
+static const uint32_t sha256_context_prime_square_roots[ 8 ] = {
+	0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL, 0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL };
+
+#define sha256_context_rotate_right( value, number_of_bits ) \
+	( ( ( value ) >> ( number_of_bits ) ) | ( ( value ) << ( 32 - ( number_of_bits ) ) ) )
+
+/* Creates a SHA-256 context
+ * Make sure the value context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_context_initialize(
+     sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*context = memory_allocate_structure(
+	            sha256_context_t );
+
+	if( *context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( sha256_context_reset(
+	     *context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to reset context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a SHA-256 context
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_context_free(
+     sha256_context_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_context_free";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets a SHA-256 context so it can be used to calculate a new hash
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_context_reset(
+     sha256_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_context_reset";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     context->hash_values,
+	     sha256_context_prime_square_roots,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initial hash values.",
+		 function );
+
+		return( -1 );
+	}
+	context->hash_count   = 0;
+	context->block_offset = 0;
+
+	return( 1 );
+}
+
+/* Calculates the hash values of a single block
+ */
+void sha256_context_transform(
+      sha256_context_t *context,
+      const uint8_t *block )
+{
+	uint32_t schedule[ 64 ];
+
+	uint32_t hash_values[ 8 ];
+
+	uint32_t s0           = 0;
+	uint32_t s1           = 0;
+	uint32_t value_32bit1 = 0;
+	uint32_t value_32bit2 = 0;
+	uint8_t value_index   = 0;
+
+	for( value_index = 0;
+	     value_index < 16;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( block[ value_index * 4 ] ),
+		 schedule[ value_index ] );
+	}
+	for( value_index = 16;
+	     value_index < 64;
+	     value_index++ )
+	{
+		s0 = sha256_context_rotate_right( schedule[ value_index - 15 ], 7 )
+		   ^ sha256_context_rotate_right( schedule[ value_index - 15 ], 18 )
+		   ^ ( schedule[ value_index - 15 ] >> 3 );
+
+		s1 = sha256_context_rotate_right( schedule[ value_index - 2 ], 17 )
+		   ^ sha256_context_rotate_right( schedule[ value_index - 2 ], 19 )
+		   ^ ( schedule[ value_index - 2 ] >> 10 );
+
+		schedule[ value_index ] = schedule[ value_index - 16 ] + s0 + schedule[ value_index - 7 ] + s1;
+	}
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		hash_values[ value_index ] = context->hash_values[ value_index ];
+	}
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		s1 = sha256_context_rotate_right( hash_values[ 4 ], 6 )
+		   ^ sha256_context_rotate_right( hash_values[ 4 ], 11 )
+		   ^ sha256_context_rotate_right( hash_values[ 4 ], 25 );
+
+		value_32bit1 = hash_values[ 7 ]
+		             + s1
+		             + ( ( hash_values[ 4 ] & hash_values[ 5 ] ) ^ ( ~( hash_values[ 4 ] ) & hash_values[ 6 ] ) )
+		             + sha256_context_prime_cube_roots[ value_index ]
+		             + schedule[ value_index ];
+
+		s0 = sha256_context_rotate_right( hash_values[ 0 ], 2 )
+		   ^ sha256_context_rotate_right( hash_values[ 0 ], 13 )
+		   ^ sha256_context_rotate_right( hash_values[ 0 ], 22 );
+
+		value_32bit2 = s0
+		             + ( ( hash_values[ 0 ] & hash_values[ 1 ] ) ^ ( hash_values[ 0 ] & hash_values[ 2 ] ) ^ ( hash_values[ 1 ] & hash_values[ 2 ] ) );
+
+		hash_values[ 7 ] = hash_values[ 6 ];
+		hash_values[ 6 ] = hash_values[ 5 ];
+		hash_values[ 5 ] = hash_values[ 4 ];
+		hash_values[ 4 ] = hash_values[ 3 ] + value_32bit1;
+		hash_values[ 3 ] = hash_values[ 2 ];
+		hash_values[ 2 ] = hash_values[ 1 ];
+		hash_values[ 1 ] = hash_values[ 0 ];
+		hash_values[ 0 ] = value_32bit1 + value_32bit2;
+	}
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		context->hash_values[ value_index ] += hash_values[ value_index ];
+	}
+}
+
+/* Updates the SHA-256 context
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_context_update(
+     sha256_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_context_update";
+	size_t buffer_offset  = 0;
+	size_t copy_size      = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	context->hash_count += size;
+
+	/* Complete a partially filled block first
+	 */
+	if( context->block_offset > 0 )
+	{
+		copy_size = SHA256_BLOCK_SIZE - context->block_offset;
+
+		if( copy_size > size )
+		{
+			copy_size = size;
+		}
+		if( memory_copy(
+		     &( context->block[ context->block_offset ] ),
+		     buffer,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_offset += copy_size;
+		buffer_offset         += copy_size;
+
+		if( context->block_offset < SHA256_BLOCK_SIZE )
+		{
+			return( 1 );
+		}
+		sha256_context_transform(
+		 context,
+		 context->block );
+
+		context->block_offset = 0;
+	}
+	while( ( size - buffer_offset ) >= SHA256_BLOCK_SIZE )
+	{
+		sha256_context_transform(
+		 context,
+		 &( buffer[ buffer_offset ] ) );
+
+		buffer_offset += SHA256_BLOCK_SIZE;
+	}
+	if( buffer_offset < size )
+	{
+		if( memory_copy(
+		     context->block,
+		     &( buffer[ buffer_offset ] ),
+		     size - buffer_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_offset = size - buffer_offset;
+	}
+	return( 1 );
+}
+
+/* Finalizes the SHA-256 context
+ * The context is reset afterwards so it can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int sha256_context_finalize(
+     sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "sha256_context_finalize";
+	uint64_t bit_count    = 0;
+	uint8_t value_index   = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	bit_count = context->hash_count * 8;
+
+	/* The padding consists of a single 1-bit followed by 0-bits up to the 64-bit bit count
+	 */
+	context->block[ context->block_offset++ ] = 0x80;
+
+	if( context->block_offset > ( SHA256_BLOCK_SIZE - 8 ) )
+	{
+		if( memory_set(
+		     &( context->block[ context->block_offset ] ),
+		     0,
+		     SHA256_BLOCK_SIZE - context->block_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear block.",
+			 function );
+
+			return( -1 );
+		}
+		sha256_context_transform(
+		 context,
+		 context->block );
+
+		context->block_offset = 0;
+	}
+	if( memory_set(
+	     &( context->block[ context->block_offset ] ),
+	     0,
+	     SHA256_BLOCK_SIZE - 8 - context->block_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 &( context->block[ SHA256_BLOCK_SIZE - 8 ] ),
+	 bit_count );
+
+	sha256_context_transform(
+	 context,
+	 context->block );
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ value_index * 4 ] ),
+		 context->hash_values[ value_index ] );
+	}
+	if( sha256_context_reset(
+	     context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
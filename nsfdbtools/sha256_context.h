@@ -0,0 +1,91 @@
+/*
+ * SHA-256 context
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SHA256_CONTEXT_H )
+#define _SHA256_CONTEXT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "nsfdbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define SHA256_BLOCK_SIZE		64
+#define SHA256_HASH_SIZE		32
+
+typedef struct sha256_context sha256_context_t;
+
+struct sha256_context
+{
+	/* The hash values
+	 */
+	uint32_t hash_values[ 8 ];
+
+	/* The number of bytes hashed
+	 */
+	uint64_t hash_count;
+
+	/* The block data
+	 */
+	uint8_t block[ SHA256_BLOCK_SIZE ];
+
+	/* The block offset
+	 */
+	size_t block_offset;
+};
+
+int sha256_context_initialize(
+     sha256_context_t **context,
+     libcerror_error_t **error );
+
+int sha256_context_free(
+     sha256_context_t **context,
+     libcerror_error_t **error );
+
+int sha256_context_reset(
+     sha256_context_t *context,
+     libcerror_error_t **error );
+
+void sha256_context_transform(
+      sha256_context_t *context,
+      const uint8_t *block );
+
+int sha256_context_update(
+     sha256_context_t *context,
+     const uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int sha256_context_finalize(
+     sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SHA256_CONTEXT_H ) */
+
@@ -0,0 +1,472 @@
+/*
+ * Library bucket_history type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_bucket_history.h"
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* Tests the libnsfdb_bucket_history_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_bucket_history_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libnsfdb_bucket_history_t *bucket_history = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 3;
+	int number_of_memset_fail_tests           = 3;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_bucket_history_initialize(
+	          &bucket_history,
+	          16,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "bucket_history",
+	 bucket_history );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_bucket_history_free(
+	          &bucket_history,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "bucket_history",
+	 bucket_history );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_bucket_history_initialize(
+	          NULL,
+	          16,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bucket_history = (libnsfdb_bucket_history_t *) 0x12345678UL;
+
+	result = libnsfdb_bucket_history_initialize(
+	          &bucket_history,
+	          16,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bucket_history = NULL;
+
+	result = libnsfdb_bucket_history_initialize(
+	          &bucket_history,
+	          0,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_bucket_history_initialize with malloc failing
+		 */
+		nsfdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libnsfdb_bucket_history_initialize(
+		          &bucket_history,
+		          16,
+		          4,
+		          &error );
+
+		if( nsfdb_test_malloc_attempts_before_fail != -1 )
+		{
+			nsfdb_test_malloc_attempts_before_fail = -1;
+
+			if( bucket_history != NULL )
+			{
+				libnsfdb_bucket_history_free(
+				 &bucket_history,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "bucket_history",
+			 bucket_history );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_bucket_history_initialize with memset failing
+		 */
+		nsfdb_test_memset_attempts_before_fail = test_number;
+
+		result = libnsfdb_bucket_history_initialize(
+		          &bucket_history,
+		          16,
+		          4,
+		          &error );
+
+		if( nsfdb_test_memset_attempts_before_fail != -1 )
+		{
+			nsfdb_test_memset_attempts_before_fail = -1;
+
+			if( bucket_history != NULL )
+			{
+				libnsfdb_bucket_history_free(
+				 &bucket_history,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "bucket_history",
+			 bucket_history );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_NSFDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bucket_history != NULL )
+	{
+		libnsfdb_bucket_history_free(
+		 &bucket_history,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_bucket_history_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_bucket_history_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_bucket_history_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_bucket_history_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_bucket_history_reference(
+     void )
+{
+	uint32_t bucket_indexes[ 9 ] = {
+		1, 1, 2, 3, 4, 1, 17, 1, 1 };
+
+	int expected_results[ 9 ]    = {
+		0, 0, 0, 0, 0, 1, 0, 0, 0 };
+
+	libcerror_error_t *error                  = NULL;
+	libnsfdb_bucket_history_t *bucket_history = NULL;
+	int reference_index                       = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_bucket_history_initialize(
+	          &bucket_history,
+	          16,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "bucket_history",
+	 bucket_history );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * bucket 1 is only promoted when referenced after the correlated reference period,
+	 * bucket 17 maps to the same history entry as bucket 1 and replaces it
+	 */
+	for( reference_index = 0;
+	     reference_index < 9;
+	     reference_index++ )
+	{
+		result = libnsfdb_bucket_history_reference(
+		          bucket_history,
+		          bucket_indexes[ reference_index ],
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_results[ reference_index ] );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libnsfdb_bucket_history_reference(
+	          NULL,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_bucket_history_reference(
+	          bucket_history,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_bucket_history_free(
+	          &bucket_history,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "bucket_history",
+	 bucket_history );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bucket_history != NULL )
+	{
+		libnsfdb_bucket_history_free(
+		 &bucket_history,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_bucket_history_initialize",
+	 nsfdb_test_bucket_history_initialize );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_bucket_history_free",
+	 nsfdb_test_bucket_history_free );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_bucket_history_reference",
+	 nsfdb_test_bucket_history_reference );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
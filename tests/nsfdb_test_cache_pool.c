@@ -0,0 +1,1617 @@
+/*
+ * Library cache_pool type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_cache_pool.h"
+
+/* Tests the libnsfdb_cache_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_cache_pool_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libnsfdb_cache_pool_t *cache_pool = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 2;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_cache_pool_initialize(
+	          &cache_pool,
+	          1024,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_free(
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_cache_pool_initialize(
+	          NULL,
+	          1024,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache_pool = (libnsfdb_cache_pool_t *) 0x12345678UL;
+
+	result = libnsfdb_cache_pool_initialize(
+	          &cache_pool,
+	          1024,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache_pool = NULL;
+
+	result = libnsfdb_cache_pool_initialize(
+	          &cache_pool,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_cache_pool_initialize with malloc failing
+		 */
+		nsfdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libnsfdb_cache_pool_initialize(
+		          &cache_pool,
+		          1024,
+		          &error );
+
+		if( nsfdb_test_malloc_attempts_before_fail != -1 )
+		{
+			nsfdb_test_malloc_attempts_before_fail = -1;
+
+			if( cache_pool != NULL )
+			{
+				libnsfdb_cache_pool_free(
+				 &cache_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "cache_pool",
+			 cache_pool );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_cache_pool_initialize with memset failing
+		 */
+		nsfdb_test_memset_attempts_before_fail = test_number;
+
+		result = libnsfdb_cache_pool_initialize(
+		          &cache_pool,
+		          1024,
+		          &error );
+
+		if( nsfdb_test_memset_attempts_before_fail != -1 )
+		{
+			nsfdb_test_memset_attempts_before_fail = -1;
+
+			if( cache_pool != NULL )
+			{
+				libnsfdb_cache_pool_free(
+				 &cache_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "cache_pool",
+			 cache_pool );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_NSFDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_pool != NULL )
+	{
+		libnsfdb_cache_pool_free(
+		 &cache_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_cache_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_cache_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_cache_pool_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_cache_pool_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_cache_pool_get_size(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libnsfdb_cache_pool_t *cache_pool = NULL;
+	size64_t size                     = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_cache_pool_initialize(
+	          &cache_pool,
+	          1024,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_cache_pool_get_size(
+	          cache_pool,
+	          &size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_cache_pool_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_cache_pool_get_size(
+	          cache_pool,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_cache_pool_free(
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_pool != NULL )
+	{
+		libnsfdb_cache_pool_free(
+		 &cache_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* Frees a test value
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_cache_pool_value_free(
+     intptr_t **value,
+     libcerror_error_t **error NSFDB_TEST_ATTRIBUTE_UNUSED )
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		memory_free(
+		 *value );
+
+		*value = NULL;
+	}
+	return( 1 );
+}
+
+/* Tests the libnsfdb_cache_pool_attach_owner and libnsfdb_cache_pool_detach_owner functions
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_cache_pool_attach_owner(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libnsfdb_cache_pool_t *cache_pool = NULL;
+	uint32_t owner_identifier1        = 0;
+	uint32_t owner_identifier2        = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_cache_pool_initialize(
+	          &cache_pool,
+	          1024,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_cache_pool_attach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          &owner_identifier1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "owner_identifier1",
+	 owner_identifier1,
+	 (uint32_t) 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_attach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          &owner_identifier2,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "owner_identifier2",
+	 owner_identifier2,
+	 (uint32_t) 2 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the cache pool cannot be freed while owners are attached
+	 */
+	result = libnsfdb_cache_pool_free(
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_cache_pool_detach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_detach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier2,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_cache_pool_attach_owner(
+	          NULL,
+	          &owner_identifier1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_cache_pool_attach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_cache_pool_detach_owner(
+	          NULL,
+	          owner_identifier1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test detach without an attached owner
+	 */
+	result = libnsfdb_cache_pool_detach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_cache_pool_free(
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_pool != NULL )
+	{
+		( (libnsfdb_internal_cache_pool_t *) cache_pool )->number_of_owners = 0;
+
+		libnsfdb_cache_pool_free(
+		 &cache_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_cache_pool_set_value and libnsfdb_cache_pool_get_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_cache_pool_set_value(
+     void )
+{
+	off64_t offsets[ 4 ] = {
+		0, 512, 1024, 2048 };
+
+	int expected_results[ 4 ] = {
+		0, 1, 0, 1 };
+
+	libcerror_error_t *error          = NULL;
+	libnsfdb_cache_pool_t *cache_pool = NULL;
+	intptr_t *value                   = NULL;
+	size64_t size                     = 0;
+	uint32_t owner_identifier1        = 0;
+	uint32_t owner_identifier2        = 0;
+	int offset_index                  = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_cache_pool_initialize(
+	          &cache_pool,
+	          48,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_attach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          &owner_identifier1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_attach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          &owner_identifier2,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the values of the first owner at offsets 0 and 512 are set before the value
+	 * of the second owner at offset 0, the value at offset 512 is then referenced
+	 * so that the value at offset 0 is the least recently used
+	 */
+	for( offset_index = 0;
+	     offset_index < 2;
+	     offset_index++ )
+	{
+		value = (intptr_t *) memory_allocate(
+		                      16 );
+
+		NSFDB_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		result = libnsfdb_cache_pool_set_value(
+		          (libnsfdb_internal_cache_pool_t *) cache_pool,
+		          owner_identifier1,
+		          1,
+		          offsets[ offset_index ],
+		          value,
+		          &nsfdb_test_cache_pool_value_free,
+		          16,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libnsfdb_cache_pool_release_value(
+		          (libnsfdb_internal_cache_pool_t *) cache_pool,
+		          value,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		value = NULL;
+	}
+	value = (intptr_t *) memory_allocate(
+	                      16 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	result = libnsfdb_cache_pool_set_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier2,
+	          1,
+	          0,
+	          value,
+	          &nsfdb_test_cache_pool_value_free,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_release_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	result = libnsfdb_cache_pool_get_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier1,
+	          1,
+	          512,
+	          &value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_release_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	/* Test that setting a value beyond the maximum size evicts the least recently used value
+	 */
+	value = (intptr_t *) memory_allocate(
+	                      16 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	result = libnsfdb_cache_pool_set_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier1,
+	          1,
+	          2048,
+	          value,
+	          &nsfdb_test_cache_pool_value_free,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_release_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = NULL;
+
+	for( offset_index = 0;
+	     offset_index < 4;
+	     offset_index++ )
+	{
+		result = libnsfdb_cache_pool_get_value(
+		          (libnsfdb_internal_cache_pool_t *) cache_pool,
+		          owner_identifier1,
+		          1,
+		          offsets[ offset_index ],
+		          &value,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_results[ offset_index ] );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			result = libnsfdb_cache_pool_release_value(
+			          (libnsfdb_internal_cache_pool_t *) cache_pool,
+			          value,
+			          &error );
+
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	result = libnsfdb_cache_pool_get_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier1,
+	          2,
+	          512,
+	          &value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_get_size(
+	          cache_pool,
+	          &size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 48 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that removing the values of an owner retains the values of other owners
+	 */
+	result = libnsfdb_cache_pool_remove_values(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_get_size(
+	          cache_pool,
+	          &size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 16 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_get_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier2,
+	          1,
+	          0,
+	          &value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_release_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_cache_pool_set_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier2,
+	          1,
+	          0,
+	          value,
+	          &nsfdb_test_cache_pool_value_free,
+	          16,
+	          &error );
+
+	value = NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_cache_pool_set_value(
+	          NULL,
+	          owner_identifier2,
+	          1,
+	          0,
+	          (intptr_t *) 0x12345678UL,
+	          &nsfdb_test_cache_pool_value_free,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_cache_pool_set_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier2,
+	          1,
+	          0,
+	          NULL,
+	          &nsfdb_test_cache_pool_value_free,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_cache_pool_get_value(
+	          NULL,
+	          owner_identifier2,
+	          1,
+	          0,
+	          &value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_cache_pool_get_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier2,
+	          1,
+	          0,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_cache_pool_detach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_detach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier2,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_free(
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_pool != NULL )
+	{
+		( (libnsfdb_internal_cache_pool_t *) cache_pool )->number_of_owners = 0;
+
+		libnsfdb_cache_pool_free(
+		 &cache_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_cache_pool_remove_value and libnsfdb_cache_pool_remove_values_by_type functions
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_cache_pool_remove_value(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libnsfdb_cache_pool_t *cache_pool = NULL;
+	intptr_t *value                   = NULL;
+	uint32_t owner_identifier         = 0;
+	uint8_t value_type                = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_cache_pool_initialize(
+	          &cache_pool,
+	          1024,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_attach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          &owner_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_type = 1;
+	     value_type <= 2;
+	     value_type++ )
+	{
+		value = (intptr_t *) memory_allocate(
+		                      16 );
+
+		NSFDB_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		result = libnsfdb_cache_pool_set_value(
+		          (libnsfdb_internal_cache_pool_t *) cache_pool,
+		          owner_identifier,
+		          value_type,
+		          512,
+		          value,
+		          &nsfdb_test_cache_pool_value_free,
+		          16,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libnsfdb_cache_pool_release_value(
+		          (libnsfdb_internal_cache_pool_t *) cache_pool,
+		          value,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		value = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libnsfdb_cache_pool_remove_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier,
+	          1,
+	          1024,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_remove_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier,
+	          1,
+	          512,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 ( (libnsfdb_internal_cache_pool_t *) cache_pool )->number_of_entries,
+	 1 );
+
+	result = libnsfdb_cache_pool_remove_values_by_type(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier,
+	          2,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 ( (libnsfdb_internal_cache_pool_t *) cache_pool )->number_of_entries,
+	 0 );
+
+	/* Test that a value that is removed while referenced is freed when it is released
+	 */
+	value = (intptr_t *) memory_allocate(
+	                      16 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	result = libnsfdb_cache_pool_set_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier,
+	          1,
+	          512,
+	          value,
+	          &nsfdb_test_cache_pool_value_free,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_remove_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier,
+	          1,
+	          512,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 ( (libnsfdb_internal_cache_pool_t *) cache_pool )->number_of_entries,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "first_referenced_entry",
+	 ( (libnsfdb_internal_cache_pool_t *) cache_pool )->first_referenced_entry );
+
+	result = libnsfdb_cache_pool_release_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "first_referenced_entry",
+	 ( (libnsfdb_internal_cache_pool_t *) cache_pool )->first_referenced_entry );
+
+	/* Test error cases
+	 */
+	value = NULL;
+
+	result = libnsfdb_cache_pool_release_value(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_cache_pool_remove_value(
+	          NULL,
+	          owner_identifier,
+	          1,
+	          512,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_cache_pool_remove_values_by_type(
+	          NULL,
+	          owner_identifier,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_cache_pool_detach_owner(
+	          (libnsfdb_internal_cache_pool_t *) cache_pool,
+	          owner_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_cache_pool_free(
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_pool != NULL )
+	{
+		( (libnsfdb_internal_cache_pool_t *) cache_pool )->number_of_owners = 0;
+
+		libnsfdb_cache_pool_free(
+		 &cache_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_cache_pool_initialize",
+	 nsfdb_test_cache_pool_initialize );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_cache_pool_free",
+	 nsfdb_test_cache_pool_free );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_cache_pool_get_size",
+	 nsfdb_test_cache_pool_get_size );
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_cache_pool_attach_owner",
+	 nsfdb_test_cache_pool_attach_owner );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_cache_pool_set_value",
+	 nsfdb_test_cache_pool_set_value );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_cache_pool_remove_value",
+	 nsfdb_test_cache_pool_remove_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
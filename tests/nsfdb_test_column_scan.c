@@ -0,0 +1,2388 @@
+/*
+ * Library column_scan type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_functions.h"
+#include "nsfdb_test_libbfio.h"
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_column_scan.h"
+#include "../libnsfdb/libnsfdb_file.h"
+#include "../libnsfdb/libnsfdb_io_handle.h"
+#include "../libnsfdb/libnsfdb_libcdata.h"
+#include "../libnsfdb/libnsfdb_libfcache.h"
+#include "../libnsfdb/libnsfdb_libfdata.h"
+#include "../libnsfdb/libnsfdb_note_index.h"
+#include "../libnsfdb/libnsfdb_rrv_bucket_descriptor.h"
+#include "../libnsfdb/libnsfdb_rrv_value.h"
+#include "../libnsfdb/libnsfdb_unique_name_key.h"
+
+uint8_t nsfdb_test_column_scan_note_data1[ 142 ] = {
+	0x04, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x61, 0x62, 0x63, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x78, 0x79 };
+
+uint8_t nsfdb_test_column_scan_note_data2[ 146 ] = {
+	0x04, 0x00, 0x92, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x61, 0x62, 0x63, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x00, 0x05,
+	0x78, 0x79 };
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* Tests the libnsfdb_column_scan_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_column_scan_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libnsfdb_column_scan_t *column_scan = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 7;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_column_scan_initialize(
+	          &column_scan,
+	          2,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_free(
+	          &column_scan,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_column_scan_initialize(
+	          NULL,
+	          2,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	column_scan = (libnsfdb_column_scan_t *) 0x12345678UL;
+
+	result = libnsfdb_column_scan_initialize(
+	          &column_scan,
+	          2,
+	          16,
+	          &error );
+
+	column_scan = NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_initialize(
+	          &column_scan,
+	          0,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_initialize(
+	          &column_scan,
+	          2,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_column_scan_initialize with malloc failing
+		 */
+		nsfdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libnsfdb_column_scan_initialize(
+		          &column_scan,
+		          2,
+		          16,
+		          &error );
+
+		if( nsfdb_test_malloc_attempts_before_fail != -1 )
+		{
+			nsfdb_test_malloc_attempts_before_fail = -1;
+
+			if( column_scan != NULL )
+			{
+				libnsfdb_column_scan_free(
+				 &column_scan,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "column_scan",
+			 column_scan );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_column_scan_initialize with memset failing
+		 */
+		nsfdb_test_memset_attempts_before_fail = test_number;
+
+		result = libnsfdb_column_scan_initialize(
+		          &column_scan,
+		          2,
+		          16,
+		          &error );
+
+		if( nsfdb_test_memset_attempts_before_fail != -1 )
+		{
+			nsfdb_test_memset_attempts_before_fail = -1;
+
+			if( column_scan != NULL )
+			{
+				libnsfdb_column_scan_free(
+				 &column_scan,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "column_scan",
+			 column_scan );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_NSFDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_scan != NULL )
+	{
+		libnsfdb_column_scan_free(
+		 &column_scan,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* Tests the libnsfdb_column_scan_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_column_scan_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_column_scan_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* Creates an unique name key (UNK) table with the names: Subject, Body and From
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_column_scan_unique_name_key_table_initialize(
+     libcdata_array_t **unique_name_key_table,
+     libcerror_error_t **error )
+{
+	const char *names[ 3 ] = { "Subject", "Body", "From" };
+
+	libnsfdb_unique_name_key_t *unique_name_key = NULL;
+	size_t name_size                            = 0;
+	int entry_index                             = 0;
+	int name_index                              = 0;
+
+	if( libcdata_array_initialize(
+	     unique_name_key_table,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( name_index = 0;
+	     name_index < 3;
+	     name_index++ )
+	{
+		if( libnsfdb_unique_name_key_initialize(
+		     &unique_name_key,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		name_size = narrow_string_length(
+		             names[ name_index ] ) + 1;
+
+		unique_name_key->note_item_class = 5;
+		unique_name_key->note_item_type  = 0;
+		unique_name_key->name_size       = name_size;
+		unique_name_key->name            = (uint8_t *) memory_allocate(
+		                                                sizeof( uint8_t ) * name_size );
+
+		if( unique_name_key->name == NULL )
+		{
+			goto on_error;
+		}
+		if( memory_copy(
+		     unique_name_key->name,
+		     names[ name_index ],
+		     name_size ) == NULL )
+		{
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     *unique_name_key_table,
+		     &entry_index,
+		     (intptr_t *) unique_name_key,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		unique_name_key = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( unique_name_key != NULL )
+	{
+		libnsfdb_unique_name_key_free(
+		 &unique_name_key,
+		 NULL );
+	}
+	if( *unique_name_key_table != NULL )
+	{
+		libcdata_array_free(
+		 unique_name_key_table,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_unique_name_key_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libnsfdb_column_scan_set_field_names function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_column_scan_set_field_names(
+     void )
+{
+	const char *field_names[ 2 ]                          = { "from", "SUBJECT" };
+	const char *invalid_field_names[ 2 ]                  = { "from", NULL };
+
+	libcdata_array_t *empty_unique_name_key_table         = NULL;
+	libcdata_array_t *unique_name_key_table               = NULL;
+	libcerror_error_t *error                              = NULL;
+	libnsfdb_column_scan_t *column_scan                   = NULL;
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = nsfdb_test_column_scan_unique_name_key_table_initialize(
+	          &unique_name_key_table,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "unique_name_key_table",
+	 unique_name_key_table );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_initialize(
+	          &column_scan,
+	          2,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_column_scan_set_field_names(
+	          NULL,
+	          unique_name_key_table,
+	          field_names,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_set_field_names(
+	          internal_column_scan,
+	          unique_name_key_table,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_set_field_names(
+	          internal_column_scan,
+	          unique_name_key_table,
+	          invalid_field_names,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_set_field_names(
+	          internal_column_scan,
+	          NULL,
+	          field_names,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "internal_column_scan->unk_column_indexes",
+	 internal_column_scan->unk_column_indexes );
+
+	/* Test regular cases, the field names are matched case insensitive
+	 * and the UNK of a name without a field is not scanned
+	 */
+	result = libnsfdb_column_scan_set_field_names(
+	          internal_column_scan,
+	          unique_name_key_table,
+	          field_names,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_column_scan->number_of_unk_column_indexes",
+	 internal_column_scan->number_of_unk_column_indexes,
+	 3 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_column_scan->unk_column_indexes",
+	 internal_column_scan->unk_column_indexes );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_column_scan->unk_column_indexes[ 0 ]",
+	 internal_column_scan->unk_column_indexes[ 0 ],
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_column_scan->unk_column_indexes[ 1 ]",
+	 internal_column_scan->unk_column_indexes[ 1 ],
+	 -1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_column_scan->unk_column_indexes[ 2 ]",
+	 internal_column_scan->unk_column_indexes[ 2 ],
+	 0 );
+
+	/* Test error case where the field names are already set
+	 */
+	result = libnsfdb_column_scan_set_field_names(
+	          internal_column_scan,
+	          unique_name_key_table,
+	          field_names,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_free(
+	          &column_scan,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case with an empty UNK table
+	 */
+	result = libcdata_array_initialize(
+	          &empty_unique_name_key_table,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_initialize(
+	          &column_scan,
+	          2,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+	result = libnsfdb_column_scan_set_field_names(
+	          internal_column_scan,
+	          empty_unique_name_key_table,
+	          field_names,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_column_scan->number_of_unk_column_indexes",
+	 internal_column_scan->number_of_unk_column_indexes,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_column_scan->unk_column_indexes",
+	 internal_column_scan->unk_column_indexes );
+
+	/* Clean up
+	 */
+	result = libnsfdb_column_scan_free(
+	          &column_scan,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &empty_unique_name_key_table,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &unique_name_key_table,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_unique_name_key_free,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_scan != NULL )
+	{
+		libnsfdb_column_scan_free(
+		 &column_scan,
+		 NULL );
+	}
+	if( empty_unique_name_key_table != NULL )
+	{
+		libcdata_array_free(
+		 &empty_unique_name_key_table,
+		 NULL,
+		 NULL );
+	}
+	if( unique_name_key_table != NULL )
+	{
+		libcdata_array_free(
+		 &unique_name_key_table,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_unique_name_key_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_column_scan_read_note_data function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_column_scan_read_note_data(
+     void )
+{
+	uint8_t value_data[ 8 ];
+
+	libcerror_error_t *error                              = NULL;
+	libnsfdb_column_scan_t *column_scan                   = NULL;
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	size_t value_data_size                                = 0;
+	uint32_t note_identifier                              = 0;
+	int number_of_columns                                 = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_column_scan_initialize(
+	          &column_scan,
+	          2,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+	/* Map UNK 0 to column 1, UNK 2 to column 0 and ignore UNK 1
+	 */
+	internal_column_scan->unk_column_indexes = (int *) memory_allocate(
+	                                                    sizeof( int ) * 3 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_column_scan->unk_column_indexes",
+	 internal_column_scan->unk_column_indexes );
+
+	internal_column_scan->unk_column_indexes[ 0 ]      = 1;
+	internal_column_scan->unk_column_indexes[ 1 ]      = -1;
+	internal_column_scan->unk_column_indexes[ 2 ]      = 0;
+	internal_column_scan->number_of_unk_column_indexes = 3;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_column_scan_read_note_data(
+	          internal_column_scan,
+	          nsfdb_test_column_scan_note_data1,
+	          142,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_column_scan->number_of_rows",
+	 internal_column_scan->number_of_rows,
+	 1 );
+
+	result = libnsfdb_column_scan_get_number_of_columns(
+	          column_scan,
+	          &number_of_columns,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_columns",
+	 number_of_columns,
+	 2 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_get_note_identifier(
+	          column_scan,
+	          0,
+	          &note_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_identifier",
+	 note_identifier,
+	 (uint32_t) 0x00000024UL );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The value of column 0 is stored after the data of the ignored UNK 1
+	 */
+	result = libnsfdb_column_scan_get_value_data_size(
+	          column_scan,
+	          0,
+	          0,
+	          &value_data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 2 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_get_value_data(
+	          column_scan,
+	          0,
+	          0,
+	          value_data,
+	          8,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          "xy",
+	          2 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The value of column 1 is the first item of UNK 0
+	 */
+	result = libnsfdb_column_scan_get_value_data(
+	          column_scan,
+	          1,
+	          0,
+	          value_data,
+	          8,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          "abc",
+	          3 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_column_scan_read_note_data(
+	          internal_column_scan,
+	          nsfdb_test_column_scan_note_data1,
+	          142,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_column_scan->number_of_rows = 0;
+
+	result = libnsfdb_column_scan_read_note_data(
+	          NULL,
+	          nsfdb_test_column_scan_note_data1,
+	          142,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_read_note_data(
+	          internal_column_scan,
+	          NULL,
+	          142,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_read_note_data(
+	          internal_column_scan,
+	          nsfdb_test_column_scan_note_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the note size does not match the note data size
+	 */
+	result = libnsfdb_column_scan_read_note_data(
+	          internal_column_scan,
+	          nsfdb_test_column_scan_note_data1,
+	          141,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is invalid
+	 */
+	nsfdb_test_column_scan_note_data1[ 0 ] = 0xff;
+
+	result = libnsfdb_column_scan_read_note_data(
+	          internal_column_scan,
+	          nsfdb_test_column_scan_note_data1,
+	          142,
+	          &error );
+
+	nsfdb_test_column_scan_note_data1[ 0 ] = 0x04;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the item data size exceeds the note data
+	 */
+	nsfdb_test_column_scan_note_data1[ 128 ] = 0x03;
+
+	result = libnsfdb_column_scan_read_note_data(
+	          internal_column_scan,
+	          nsfdb_test_column_scan_note_data1,
+	          142,
+	          &error );
+
+	nsfdb_test_column_scan_note_data1[ 128 ] = 0x02;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_column_scan_free(
+	          &column_scan,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_scan != NULL )
+	{
+		libnsfdb_column_scan_free(
+		 &column_scan,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_column_scan_read_note_data function with predicates
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_column_scan_predicates(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libnsfdb_column_scan_t *column_scan                   = NULL;
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_column_scan_initialize(
+	          &column_scan,
+	          2,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+	/* Map UNK 0 to column 1, UNK 2 to column 0 and ignore UNK 1
+	 */
+	internal_column_scan->unk_column_indexes = (int *) memory_allocate(
+	                                                    sizeof( int ) * 3 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_column_scan->unk_column_indexes",
+	 internal_column_scan->unk_column_indexes );
+
+	internal_column_scan->unk_column_indexes[ 0 ]      = 1;
+	internal_column_scan->unk_column_indexes[ 1 ]      = -1;
+	internal_column_scan->unk_column_indexes[ 2 ]      = 0;
+	internal_column_scan->number_of_unk_column_indexes = 3;
+
+	/* Test a note that matches the predicates
+	 */
+	result = libnsfdb_column_scan_append_text_predicate(
+	          column_scan,
+	          1,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+	          (uint8_t *) "abc",
+	          3,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_read_note_data(
+	          internal_column_scan,
+	          nsfdb_test_column_scan_note_data2,
+	          146,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_column_scan->number_of_rows",
+	 internal_column_scan->number_of_rows,
+	 1 );
+
+	/* Test a note that does not match the predicates
+	 */
+	result = libnsfdb_column_scan_append_text_predicate(
+	          column_scan,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_PREFIX,
+	          (uint8_t *) "zz",
+	          2,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_read_note_data(
+	          internal_column_scan,
+	          nsfdb_test_column_scan_note_data2,
+	          146,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_column_scan->number_of_rows",
+	 internal_column_scan->number_of_rows,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_column_scan_append_text_predicate(
+	          NULL,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+	          (uint8_t *) "abc",
+	          3,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_append_text_predicate(
+	          column_scan,
+	          2,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+	          (uint8_t *) "abc",
+	          3,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_append_text_predicate(
+	          column_scan,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_NUMBER_RANGE,
+	          (uint8_t *) "abc",
+	          3,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_append_number_range_predicate(
+	          column_scan,
+	          0,
+	          1.0,
+	          0.0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_append_time_range_predicate(
+	          column_scan,
+	          0,
+	          2,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_column_scan_free(
+	          &column_scan,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_scan != NULL )
+	{
+		libnsfdb_column_scan_free(
+		 &column_scan,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Frees a file created by nsfdb_test_column_scan_file_initialize
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_column_scan_file_free(
+     libnsfdb_file_t **file,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	int result                              = 1;
+
+	if( ( file == NULL )
+	 || ( *file == NULL ) )
+	{
+		return( -1 );
+	}
+	internal_file = (libnsfdb_internal_file_t *) *file;
+
+	if( internal_file->summary_bucket_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_file->summary_bucket_cache ),
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( internal_file->summary_bucket_list != NULL )
+	{
+		if( libfdata_list_free(
+		     &( internal_file->summary_bucket_list ),
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		if( nsfdb_test_close_file_io_handle(
+		     &( internal_file->file_io_handle ),
+		     error ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	if( libnsfdb_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	return( result );
+}
+
+/* Creates a file that contains a summary bucket with note data 1 in slot 1 and note data 2 in slot 2
+ * The bucket data consists of a 66 bytes header, the notes, the bucket index and a 12 bytes footer
+ * the RRV identifier of the note in slot 2 is changed into 0x00000028
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_column_scan_file_initialize(
+     libnsfdb_file_t **file,
+     uint8_t *bucket_data,
+     size_t bucket_data_size,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_file_t *internal_file = NULL;
+	libnsfdb_rrv_value_t rrv_value;
+	int entry_index                         = 0;
+	int slot_index                          = 0;
+
+	if( bucket_data_size != 374 )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     bucket_data,
+	     0,
+	     bucket_data_size ) == NULL )
+	{
+		return( -1 );
+	}
+	bucket_data[ 0 ]  = 0x02;
+	bucket_data[ 1 ]  = 0x42;
+	bucket_data[ 6 ]  = 0x76;
+	bucket_data[ 7 ]  = 0x01;
+	bucket_data[ 44 ] = 0x02;
+	bucket_data[ 50 ] = 0x0c;
+
+	if( memory_copy(
+	     &( bucket_data[ 66 ] ),
+	     nsfdb_test_column_scan_note_data1,
+	     142 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( bucket_data[ 208 ] ),
+	     nsfdb_test_column_scan_note_data2,
+	     146 ) == NULL )
+	{
+		return( -1 );
+	}
+	bucket_data[ 214 ] = 0x28;
+
+	/* The bucket index is stored back to front before the footer
+	 * slot 1 has offset 66 and size 142, slot 2 has offset 208 and size 146
+	 */
+	bucket_data[ 354 ] = 0xd0;
+	bucket_data[ 356 ] = 0x92;
+	bucket_data[ 358 ] = 0x42;
+	bucket_data[ 360 ] = 0x8e;
+
+	if( libnsfdb_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	internal_file = (libnsfdb_internal_file_t *) *file;
+
+	if( nsfdb_test_open_file_io_handle(
+	     &( internal_file->file_io_handle ),
+	     bucket_data,
+	     bucket_data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_list_initialize(
+	     &( internal_file->summary_bucket_list ),
+	     NULL,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_list_append_element(
+	     internal_file->summary_bucket_list,
+	     &entry_index,
+	     0,
+	     (off64_t) 0,
+	     (size64_t) bucket_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( internal_file->summary_bucket_cache ),
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libnsfdb_note_index_initialize(
+	     &( internal_file->io_handle->note_index ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( slot_index = 1;
+	     slot_index <= 2;
+	     slot_index++ )
+	{
+		if( memory_set(
+		     &rrv_value,
+		     0,
+		     sizeof( libnsfdb_rrv_value_t ) ) == NULL )
+		{
+			goto on_error;
+		}
+		rrv_value.type           = LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER;
+		rrv_value.rrv_identifier = 0x00000020UL + ( (uint32_t) slot_index * 4 );
+		rrv_value.bucket_index   = 1;
+		rrv_value.slot_index     = (uint16_t) slot_index;
+
+		if( libnsfdb_note_index_append_entry(
+		     internal_file->io_handle->note_index,
+		     &rrv_value,
+		     LIBNSFDB_RRV_BUCKET_TYPE_DATA,
+		     0x0001,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libnsfdb_note_index_finalize(
+	     internal_file->io_handle->note_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		nsfdb_test_column_scan_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libnsfdb_column_scan_read_rows function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_column_scan_read_rows(
+     void )
+{
+	uint8_t bucket_data[ 374 ];
+
+	const char *field_names[ 2 ]                          = { "From", "Subject" };
+
+	libcdata_array_t *unique_name_key_table               = NULL;
+	libcerror_error_t *error                              = NULL;
+	libnsfdb_column_scan_t *column_scan                   = NULL;
+	libnsfdb_file_t *file                                 = NULL;
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	uint32_t note_identifier                              = 0;
+	int number_of_rows                                    = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = nsfdb_test_column_scan_file_initialize(
+	          &file,
+	          bucket_data,
+	          374,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_column_scan_unique_name_key_table_initialize(
+	          &unique_name_key_table,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_initialize(
+	          &column_scan,
+	          2,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+	/* Test error case where the column scan has no file
+	 */
+	result = libnsfdb_column_scan_read_rows(
+	          column_scan,
+	          &number_of_rows,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_column_scan->internal_file = (libnsfdb_internal_file_t *) file;
+	internal_column_scan->note_type     = LIBNSFDB_NOTE_TYPE_DATA;
+
+	result = libnsfdb_column_scan_set_field_names(
+	          internal_column_scan,
+	          unique_name_key_table,
+	          field_names,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, without predicates every note is a row
+	 * and a batch contains at most 1 row
+	 */
+	result = libnsfdb_column_scan_read_rows(
+	          column_scan,
+	          &number_of_rows,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_rows",
+	 number_of_rows,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_get_note_identifier(
+	          column_scan,
+	          0,
+	          &note_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_identifier",
+	 note_identifier,
+	 (uint32_t) 0x00000024UL );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_read_rows(
+	          column_scan,
+	          &number_of_rows,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_rows",
+	 number_of_rows,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_get_note_identifier(
+	          column_scan,
+	          0,
+	          &note_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_identifier",
+	 note_identifier,
+	 (uint32_t) 0x00000028UL );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that 0 is returned after the last note
+	 */
+	result = libnsfdb_column_scan_read_rows(
+	          column_scan,
+	          &number_of_rows,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_rows",
+	 number_of_rows,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a predicate that only matches the note in slot 2
+	 */
+	internal_column_scan->note_index = 0;
+
+	result = libnsfdb_column_scan_append_text_predicate(
+	          column_scan,
+	          1,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+	          (uint8_t *) "abc",
+	          3,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_read_rows(
+	          column_scan,
+	          &number_of_rows,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_rows",
+	 number_of_rows,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_get_note_identifier(
+	          column_scan,
+	          0,
+	          &note_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_identifier",
+	 note_identifier,
+	 (uint32_t) 0x00000028UL );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_read_rows(
+	          column_scan,
+	          &number_of_rows,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_rows",
+	 number_of_rows,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test predicates that match none of the notes
+	 */
+	internal_column_scan->note_index = 0;
+
+	result = libnsfdb_column_scan_append_text_predicate(
+	          column_scan,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_PREFIX,
+	          (uint8_t *) "zz",
+	          2,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_column_scan_read_rows(
+	          column_scan,
+	          &number_of_rows,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_rows",
+	 number_of_rows,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_column_scan->note_index",
+	 internal_column_scan->note_index,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_column_scan_read_rows(
+	          NULL,
+	          &number_of_rows,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_read_rows(
+	          column_scan,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_column_scan_free(
+	          &column_scan,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &unique_name_key_table,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_unique_name_key_free,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_column_scan_file_free(
+	          &file,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_scan != NULL )
+	{
+		libnsfdb_column_scan_free(
+		 &column_scan,
+		 NULL );
+	}
+	if( unique_name_key_table != NULL )
+	{
+		libcdata_array_free(
+		 &unique_name_key_table,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_unique_name_key_free,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		nsfdb_test_column_scan_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_column_scan_get_value_data function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_column_scan_get_value_data(
+     void )
+{
+	uint8_t value_data[ 8 ];
+
+	libcerror_error_t *error                              = NULL;
+	libnsfdb_column_scan_t *column_scan                   = NULL;
+	libnsfdb_internal_column_scan_t *internal_column_scan = NULL;
+	size_t value_data_size                                = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_column_scan_initialize(
+	          &column_scan,
+	          2,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_column_scan = (libnsfdb_internal_column_scan_t *) column_scan;
+
+	result = libnsfdb_column_scan_append_value_data(
+	          internal_column_scan,
+	          1,
+	          (uint8_t *) "value",
+	          5,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_column_scan->number_of_rows = 1;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_column_scan_get_value_data(
+	          column_scan,
+	          1,
+	          0,
+	          value_data,
+	          8,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          "value",
+	          5 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a column without a value
+	 */
+	internal_column_scan->value_data_sizes[ 0 ] = 0;
+
+	result = libnsfdb_column_scan_get_value_data_size(
+	          column_scan,
+	          0,
+	          0,
+	          &value_data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_column_scan_get_value_data(
+	          NULL,
+	          1,
+	          0,
+	          value_data,
+	          8,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_get_value_data(
+	          column_scan,
+	          2,
+	          0,
+	          value_data,
+	          8,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_get_value_data(
+	          column_scan,
+	          1,
+	          1,
+	          value_data,
+	          8,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_get_value_data(
+	          column_scan,
+	          1,
+	          0,
+	          NULL,
+	          8,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_column_scan_get_value_data(
+	          column_scan,
+	          1,
+	          0,
+	          value_data,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_column_scan_free(
+	          &column_scan,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "column_scan",
+	 column_scan );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( column_scan != NULL )
+	{
+		libnsfdb_column_scan_free(
+		 &column_scan,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_column_scan_initialize",
+	 nsfdb_test_column_scan_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_column_scan_free",
+	 nsfdb_test_column_scan_free );
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_column_scan_set_field_names",
+	 nsfdb_test_column_scan_set_field_names );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_column_scan_read_note_data",
+	 nsfdb_test_column_scan_read_note_data );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_column_scan_predicates",
+	 nsfdb_test_column_scan_predicates );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_column_scan_read_rows",
+	 nsfdb_test_column_scan_read_rows );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_column_scan_get_value_data",
+	 nsfdb_test_column_scan_get_value_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,788 @@
+/*
+ * Library compression functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_compression.h"
+#include "../libnsfdb/libnsfdb_definitions.h"
+
+/* Define to make nsfdb_test_compression generate verbose output
+#define NSFDB_TEST_COMPRESSION_VERBOSE
+ */
+
+#define NSFDB_TEST_COMPRESSION_DATA_TYPE_RANDOM		0
+#define NSFDB_TEST_COMPRESSION_DATA_TYPE_REPETITIVE	1
+#define NSFDB_TEST_COMPRESSION_DATA_TYPE_TEXT		2
+
+uint8_t nsfdb_test_compression_uncompressed_data[ 16 ] = {
+	0x4e, 0x6f, 0x74, 0x65, 0x73, 0x20, 0x4e, 0x6f, 0x74, 0x65, 0x73, 0x20, 0x4e, 0x6f, 0x74, 0x65 };
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* Fills a buffer with test data
+ */
+void nsfdb_test_compression_generate_data(
+      uint8_t *data,
+      size_t data_size,
+      int data_type,
+      uint32_t seed )
+{
+	const char *words[ 8 ] = {
+		"Notes ", "database ", "summary ", "bucket ", "the ", "of ", "item ", "\r\n" };
+
+	const char *word      = NULL;
+	size_t data_offset    = 0;
+	uint32_t random_value = seed;
+
+	while( data_offset < data_size )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345;
+		random_value &= 0xffffffffUL;
+
+		switch( data_type )
+		{
+			case NSFDB_TEST_COMPRESSION_DATA_TYPE_REPETITIVE:
+				data[ data_offset ] = (uint8_t) ( ( data_offset / 37 ) % 5 );
+
+				data_offset++;
+
+				break;
+
+			case NSFDB_TEST_COMPRESSION_DATA_TYPE_TEXT:
+				for( word = words[ ( random_value >> 16 ) % 8 ];
+				     ( *word != 0 ) && ( data_offset < data_size );
+				     word++ )
+				{
+					data[ data_offset++ ] = (uint8_t) *word;
+				}
+				break;
+
+			default:
+				data[ data_offset ] = (uint8_t) ( random_value >> 16 );
+
+				data_offset++;
+
+				break;
+		}
+	}
+}
+
+/* Compresses and decompresses data and compares the result with the original data
+ * Returns 1 if successful, 0 if the data differs or -1 on error
+ */
+int nsfdb_test_compression_round_trip(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	uint8_t *compressed_data      = NULL;
+	uint8_t *decompressed_data    = NULL;
+	static char *function         = "nsfdb_test_compression_round_trip";
+	size_t compressed_data_size   = 0;
+	size_t decompressed_data_size = 0;
+	int result                    = 0;
+
+	if( libnsfdb_compression_cx_get_maximum_compressed_data_size(
+	     uncompressed_data_size,
+	     &compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum compressed data size.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * compressed_data_size );
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The decompressed data buffer contains an additional byte to detect
+	 * the decompression writing beyond the uncompressed data size
+	 */
+	decompressed_data_size = uncompressed_data_size;
+
+	decompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * ( decompressed_data_size + 1 ) );
+
+	if( decompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     decompressed_data,
+	     0xa5,
+	     decompressed_data_size + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_compression_cx_compress(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data,
+	     &compressed_data_size,
+	     compression_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libnsfdb_compression_cx_decompress(
+	     decompressed_data,
+	     decompressed_data_size,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( NSFDB_TEST_COMPRESSION_VERBOSE )
+	fprintf(
+	 stdout,
+	 "%s: level: %d, uncompressed size: %" PRIzd ", compressed size: %" PRIzd "\n",
+	 function,
+	 compression_level,
+	 uncompressed_data_size,
+	 compressed_data_size );
+#endif
+	if( decompressed_data[ decompressed_data_size ] != 0xa5 )
+	{
+		result = 0;
+	}
+	else if( uncompressed_data_size == 0 )
+	{
+		result = 1;
+	}
+	else if( memory_compare(
+	          decompressed_data,
+	          uncompressed_data,
+	          uncompressed_data_size ) == 0 )
+	{
+		result = 1;
+	}
+	memory_free(
+	 decompressed_data );
+
+	memory_free(
+	 compressed_data );
+
+	return( result );
+
+on_error:
+	if( decompressed_data != NULL )
+	{
+		memory_free(
+		 decompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	return( -1 );
+}
+
+/* Tests the libnsfdb_compression_cx_get_maximum_compressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_compression_cx_get_maximum_compressed_data_size(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_compression_cx_get_maximum_compressed_data_size(
+	          16,
+	          &compressed_data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 23 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_compression_cx_get_maximum_compressed_data_size(
+	          16,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_compression_cx_get_tuple_number_of_bits function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_compression_cx_get_tuple_number_of_bits(
+     void )
+{
+	size_t number_of_bits = 0;
+
+	/* Test regular cases
+	 */
+	number_of_bits = libnsfdb_compression_cx_get_tuple_number_of_bits(
+	                  2,
+	                  255 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_bits",
+	 number_of_bits,
+	 (size_t) 10 );
+
+	number_of_bits = libnsfdb_compression_cx_get_tuple_number_of_bits(
+	                  3,
+	                  1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_bits",
+	 number_of_bits,
+	 (size_t) 13 );
+
+	number_of_bits = libnsfdb_compression_cx_get_tuple_number_of_bits(
+	                  LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_SIZE,
+	                  LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_OFFSET );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_bits",
+	 number_of_bits,
+	 (size_t) 43 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libnsfdb_compression_cx_write_tuple function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_compression_cx_write_tuple(
+     void )
+{
+	uint8_t compressed_data[ 8 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t compressed_data_iterator = 0;
+	uint8_t bit_index               = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_compression_cx_write_tuple(
+	          compressed_data,
+	          8,
+	          &compressed_data_iterator,
+	          &bit_index,
+	          2,
+	          0x12,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_iterator",
+	 compressed_data_iterator,
+	 (size_t) 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_index",
+	 bit_index,
+	 2 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 0 ]",
+	 compressed_data[ 0 ],
+	 0x4b );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_iterator = 0;
+	bit_index                = 0;
+
+	result = libnsfdb_compression_cx_write_tuple(
+	          compressed_data,
+	          8,
+	          &compressed_data_iterator,
+	          &bit_index,
+	          LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_SIZE + 1,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_compression_cx_write_tuple(
+	          compressed_data,
+	          8,
+	          &compressed_data_iterator,
+	          &bit_index,
+	          3,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_compression_cx_write_tuple(
+	          compressed_data,
+	          8,
+	          &compressed_data_iterator,
+	          &bit_index,
+	          2,
+	          0x100,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_compression_cx_write_tuple(
+	          compressed_data,
+	          1,
+	          &compressed_data_iterator,
+	          &bit_index,
+	          LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_SIZE,
+	          LIBNSFDB_COMPRESSION_CX_MAXIMUM_TUPLE_OFFSET,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_compression_cx_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_compression_cx_compress(
+     void )
+{
+	uint8_t compressed_data[ 32 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_size = 32;
+
+	result = libnsfdb_compression_cx_compress(
+	          nsfdb_test_compression_uncompressed_data,
+	          16,
+	          compressed_data,
+	          &compressed_data_size,
+	          LIBNSFDB_COMPRESSION_LEVEL_DEFAULT,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_LESS_THAN_UINT32(
+	 "compressed_data_size",
+	 (uint32_t) compressed_data_size,
+	 (uint32_t) 23 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 32;
+
+	result = libnsfdb_compression_cx_compress(
+	          NULL,
+	          16,
+	          compressed_data,
+	          &compressed_data_size,
+	          LIBNSFDB_COMPRESSION_LEVEL_DEFAULT,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_compression_cx_compress(
+	          nsfdb_test_compression_uncompressed_data,
+	          16,
+	          NULL,
+	          &compressed_data_size,
+	          LIBNSFDB_COMPRESSION_LEVEL_DEFAULT,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_compression_cx_compress(
+	          nsfdb_test_compression_uncompressed_data,
+	          16,
+	          compressed_data,
+	          NULL,
+	          LIBNSFDB_COMPRESSION_LEVEL_DEFAULT,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_compression_cx_compress(
+	          nsfdb_test_compression_uncompressed_data,
+	          16,
+	          compressed_data,
+	          &compressed_data_size,
+	          -1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data size too small
+	 */
+	compressed_data_size = 8;
+
+	result = libnsfdb_compression_cx_compress(
+	          nsfdb_test_compression_uncompressed_data,
+	          16,
+	          compressed_data,
+	          &compressed_data_size,
+	          LIBNSFDB_COMPRESSION_LEVEL_NONE,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests that decompressing compressed data results in the original data
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_compression_cx_round_trip(
+     void )
+{
+	size_t data_sizes[ 9 ] = {
+		0, 1, 2, 3, 16, 257, 4096, 65536, 262144 };
+
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	int compression_level    = 0;
+	int data_size_index      = 0;
+	int data_type            = 0;
+	int result               = 0;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 262144 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( data_type = NSFDB_TEST_COMPRESSION_DATA_TYPE_RANDOM;
+	     data_type <= NSFDB_TEST_COMPRESSION_DATA_TYPE_TEXT;
+	     data_type++ )
+	{
+		for( data_size_index = 0;
+		     data_size_index < 9;
+		     data_size_index++ )
+		{
+			nsfdb_test_compression_generate_data(
+			 data,
+			 data_sizes[ data_size_index ],
+			 data_type,
+			 (uint32_t) data_size_index + 1 );
+
+			for( compression_level = LIBNSFDB_COMPRESSION_LEVEL_NONE;
+			     compression_level <= LIBNSFDB_COMPRESSION_LEVEL_BEST;
+			     compression_level++ )
+			{
+				result = nsfdb_test_compression_round_trip(
+				          data,
+				          data_sizes[ data_size_index ],
+				          compression_level,
+				          &error );
+
+				NSFDB_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				NSFDB_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+			}
+		}
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_compression_cx_get_maximum_compressed_data_size",
+	 nsfdb_test_compression_cx_get_maximum_compressed_data_size );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_compression_cx_get_tuple_number_of_bits",
+	 nsfdb_test_compression_cx_get_tuple_number_of_bits );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_compression_cx_write_tuple",
+	 nsfdb_test_compression_cx_write_tuple );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_compression_cx_compress",
+	 nsfdb_test_compression_cx_compress );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_compression_cx_round_trip",
+	 nsfdb_test_compression_cx_round_trip );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -886,6 +886,734 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libnsfdb_file_set_cache_policy function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_file_set_cache_policy(
+     libnsfdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_file_set_cache_policy(
+	          file,
+	          LIBNSFDB_CACHE_POLICY_SCAN_RESISTANT,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_file_set_cache_policy(
+	          file,
+	          LIBNSFDB_CACHE_POLICY_DEFAULT,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_file_set_cache_policy(
+	          NULL,
+	          LIBNSFDB_CACHE_POLICY_DEFAULT,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_file_set_cache_policy(
+	          file,
+	          -1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_file_set_access_hint function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_file_set_access_hint(
+     libnsfdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_file_set_access_hint(
+	          file,
+	          LIBNSFDB_ACCESS_HINT_SCAN,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_file_set_access_hint(
+	          file,
+	          LIBNSFDB_ACCESS_HINT_NORMAL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_file_set_access_hint(
+	          NULL,
+	          LIBNSFDB_ACCESS_HINT_NORMAL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_file_set_access_hint(
+	          file,
+	          -1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_file_set_cache_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_file_set_cache_pool(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libnsfdb_cache_pool_t *cache_pool = NULL;
+	libnsfdb_file_t *file             = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_cache_pool_initialize(
+	          &cache_pool,
+	          1024 * 1024,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_file_initialize(
+	          &file,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_file_set_cache_pool(
+	          file,
+	          cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_file_set_cache_pool(
+	          file,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that freeing the file detaches it from the cache pool
+	 */
+	result = libnsfdb_file_set_cache_pool(
+	          file,
+	          cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_file_free(
+	          &file,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_file_set_cache_pool(
+	          NULL,
+	          cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_cache_pool_free(
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "cache_pool",
+	 cache_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libnsfdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( cache_pool != NULL )
+	{
+		libnsfdb_cache_pool_free(
+		 &cache_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_file_set_recovery_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_file_set_recovery_mode(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libnsfdb_file_t *file    = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_file_initialize(
+	          &file,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_file_set_recovery_mode(
+	          file,
+	          LIBNSFDB_RECOVERY_MODE_ON_ERROR,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_file_set_recovery_mode(
+	          NULL,
+	          LIBNSFDB_RECOVERY_MODE_ON_ERROR,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_file_set_recovery_mode(
+	          file,
+	          -1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_file_free(
+	          &file,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libnsfdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_file_set_number_of_recovery_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_file_set_number_of_recovery_threads(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libnsfdb_file_t *file    = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_file_initialize(
+	          &file,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_file_set_number_of_recovery_threads(
+	          file,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_file_set_number_of_recovery_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_file_set_number_of_recovery_threads(
+	          file,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_file_free(
+	          &file,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libnsfdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_file_prefetch_notes function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_file_prefetch_notes(
+     libnsfdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_file_prefetch_notes(
+	          file,
+	          LIBNSFDB_NOTE_TYPE_ALL,
+	          0,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_file_prefetch_notes(
+	          NULL,
+	          LIBNSFDB_NOTE_TYPE_ALL,
+	          0,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_file_prefetch_notes(
+	          file,
+	          LIBNSFDB_NOTE_TYPE_ALL,
+	          -1,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_file_prefetch_notes(
+	          file,
+	          LIBNSFDB_NOTE_TYPE_ALL,
+	          0,
+	          -1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_file_refresh function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_file_refresh(
+     libnsfdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_file_refresh(
+	          file,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_file_refresh(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -941,6 +1669,18 @@ int main(
 	 "libnsfdb_file_free",
 	 nsfdb_test_file_free );
 
+	NSFDB_TEST_RUN(
+	 "libnsfdb_file_set_cache_pool",
+	 nsfdb_test_file_set_cache_pool );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_file_set_recovery_mode",
+	 nsfdb_test_file_set_recovery_mode );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_file_set_number_of_recovery_threads",
+	 nsfdb_test_file_set_number_of_recovery_threads );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1004,12 +1744,32 @@ int main(
 
 #endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
 
+		NSFDB_TEST_RUN_WITH_ARGS(
+		 "libnsfdb_file_set_cache_policy",
+		 nsfdb_test_file_set_cache_policy,
+		 file );
+
+		NSFDB_TEST_RUN_WITH_ARGS(
+		 "libnsfdb_file_set_access_hint",
+		 nsfdb_test_file_set_access_hint,
+		 file );
+
 		/* TODO: add tests for libnsfdb_file_get_number_of_notes */
 
 		/* TODO: add tests for libnsfdb_file_get_note */
 
 		/* TODO: add tests for libnsfdb_file_get_note_by_identifier */
 
+		NSFDB_TEST_RUN_WITH_ARGS(
+		 "libnsfdb_file_prefetch_notes",
+		 nsfdb_test_file_prefetch_notes,
+		 file );
+
+		NSFDB_TEST_RUN_WITH_ARGS(
+		 "libnsfdb_file_refresh",
+		 nsfdb_test_file_refresh,
+		 file );
+
 		/* Clean up
 		 */
 		result = nsfdb_test_file_close_source(
@@ -0,0 +1,684 @@
+/*
+ * Library file_io_pool_entry type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_functions.h"
+#include "nsfdb_test_libbfio.h"
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_file_io_pool_entry.h"
+
+uint8_t nsfdb_test_file_io_pool_entry_data1[ 32 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* Tests the libnsfdb_file_io_pool_entry_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_file_io_pool_entry_initialize(
+     void )
+{
+	libbfio_pool_t *file_io_pool                      = NULL;
+	libcerror_error_t *error                          = NULL;
+	libnsfdb_file_io_pool_entry_t *file_io_pool_entry = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests                   = 1;
+	int number_of_memset_fail_tests                   = 1;
+	int test_number                                   = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_file_io_pool_entry_initialize(
+	          &file_io_pool_entry,
+	          file_io_pool,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool_entry",
+	 file_io_pool_entry );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_file_io_pool_entry_free(
+	          &file_io_pool_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "file_io_pool_entry",
+	 file_io_pool_entry );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_file_io_pool_entry_initialize(
+	          NULL,
+	          file_io_pool,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_io_pool_entry = (libnsfdb_file_io_pool_entry_t *) 0x12345678UL;
+
+	result = libnsfdb_file_io_pool_entry_initialize(
+	          &file_io_pool_entry,
+	          file_io_pool,
+	          0,
+	          &error );
+
+	file_io_pool_entry = NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_file_io_pool_entry_initialize(
+	          &file_io_pool_entry,
+	          NULL,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_file_io_pool_entry_initialize(
+	          &file_io_pool_entry,
+	          file_io_pool,
+	          -1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_file_io_pool_entry_initialize with malloc failing
+		 */
+		nsfdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libnsfdb_file_io_pool_entry_initialize(
+		          &file_io_pool_entry,
+		          file_io_pool,
+		          0,
+		          &error );
+
+		if( nsfdb_test_malloc_attempts_before_fail != -1 )
+		{
+			nsfdb_test_malloc_attempts_before_fail = -1;
+
+			if( file_io_pool_entry != NULL )
+			{
+				libnsfdb_file_io_pool_entry_free(
+				 &file_io_pool_entry,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "file_io_pool_entry",
+			 file_io_pool_entry );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_file_io_pool_entry_initialize with memset failing
+		 */
+		nsfdb_test_memset_attempts_before_fail = test_number;
+
+		result = libnsfdb_file_io_pool_entry_initialize(
+		          &file_io_pool_entry,
+		          file_io_pool,
+		          0,
+		          &error );
+
+		if( nsfdb_test_memset_attempts_before_fail != -1 )
+		{
+			nsfdb_test_memset_attempts_before_fail = -1;
+
+			if( file_io_pool_entry != NULL )
+			{
+				libnsfdb_file_io_pool_entry_free(
+				 &file_io_pool_entry,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "file_io_pool_entry",
+			 file_io_pool_entry );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_NSFDB_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_pool_entry != NULL )
+	{
+		libnsfdb_file_io_pool_entry_free(
+		 &file_io_pool_entry,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_file_io_pool_entry_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_file_io_pool_entry_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_file_io_pool_entry_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_file_io_pool_entry_initialize_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_file_io_pool_entry_initialize_file_io_handle(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libbfio_handle_t *pool_io_handle = NULL;
+	libbfio_pool_t *file_io_pool     = NULL;
+	libcerror_error_t *error         = NULL;
+	size64_t size                    = 0;
+	ssize_t read_count               = 0;
+	int entry                        = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_open_file_io_handle(
+	          &pool_io_handle,
+	          nsfdb_test_file_io_pool_entry_data1,
+	          32,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "pool_io_handle",
+	 pool_io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_append_handle(
+	          file_io_pool,
+	          &entry,
+	          pool_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file IO pool now manages the handle
+	 */
+	pool_io_handle = NULL;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_file_io_pool_entry_initialize_file_io_handle(
+	          &file_io_handle,
+	          file_io_pool,
+	          entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 32 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              16,
+	              8,
+	              &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( nsfdb_test_file_io_pool_entry_data1[ 8 ] ),
+	          16 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_file_io_pool_entry_initialize_file_io_handle(
+	          NULL,
+	          file_io_pool,
+	          entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_file_io_pool_entry_initialize_file_io_handle(
+	          &file_io_handle,
+	          NULL,
+	          entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( pool_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &pool_io_handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_file_io_pool_entry_initialize",
+	 nsfdb_test_file_io_pool_entry_initialize );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_file_io_pool_entry_free",
+	 nsfdb_test_file_io_pool_entry_free );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_file_io_pool_entry_initialize_file_io_handle",
+	 nsfdb_test_file_io_pool_entry_initialize_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1346 @@
+/*
+ * Library index file functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_functions.h"
+#include "nsfdb_test_libbfio.h"
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_index_file.h"
+#include "../libnsfdb/libnsfdb_io_handle.h"
+#include "../libnsfdb/libnsfdb_libcdata.h"
+#include "../libnsfdb/libnsfdb_libfdata.h"
+#include "../libnsfdb/libnsfdb_note_index.h"
+#include "../libnsfdb/libnsfdb_rrv_bucket_descriptor.h"
+#include "../libnsfdb/libnsfdb_rrv_value.h"
+#include "../libnsfdb/libnsfdb_unique_name_key.h"
+#include "../libnsfdb/nsfdb_index_file.h"
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+#define NSFDB_TEST_INDEX_FILE_FILE_SIZE				65536
+
+#define NSFDB_TEST_INDEX_FILE_SUPERBLOCK_WRITE_COUNT		3
+#define NSFDB_TEST_INDEX_FILE_SUPERBLOCK_CHECKSUM		0x12345678UL
+
+#define NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_WRITE_COUNT	7
+#define NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_CHECKSUM	0x9abcdef0UL
+
+/* Bucket list data with the file positions: 0x10, 0x20
+ */
+uint8_t nsfdb_test_index_file_bucket_list_data[ 8 ] = {
+	0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00 };
+
+/* Creates a bucket list
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_index_file_bucket_list_initialize(
+     libfdata_list_t **bucket_list,
+     libcerror_error_t **error )
+{
+	return( libfdata_list_initialize(
+	         bucket_list,
+	         NULL,
+	         NULL,
+	         NULL,
+	         (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
+	         NULL,
+	         LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	         error ) );
+}
+
+/* Writes an index file of an IO handle with 2 summary buckets, 1 non-summary bucket,
+ * 2 RRV bucket descriptors, 1 unique name key and 3 notes to data
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_index_file_write_data(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle                  = NULL;
+	libfdata_list_t *non_summary_bucket_list                = NULL;
+	libfdata_list_t *summary_bucket_list                    = NULL;
+	libnsfdb_io_handle_t *io_handle                         = NULL;
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	libnsfdb_unique_name_key_t *unique_name_key             = NULL;
+	libnsfdb_rrv_value_t rrv_value;
+	uint32_t rrv_identifier                                 = 0;
+	int entry_index                                         = 0;
+
+	if( libnsfdb_io_handle_initialize(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	io_handle->file_size                           = NSFDB_TEST_INDEX_FILE_FILE_SIZE;
+	io_handle->superblock_write_count              = NSFDB_TEST_INDEX_FILE_SUPERBLOCK_WRITE_COUNT;
+	io_handle->superblock_checksum                 = NSFDB_TEST_INDEX_FILE_SUPERBLOCK_CHECKSUM;
+	io_handle->bucket_descriptor_block_write_count = NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_WRITE_COUNT;
+	io_handle->bucket_descriptor_block_checksum    = NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_CHECKSUM;
+
+	if( nsfdb_test_index_file_bucket_list_initialize(
+	     &summary_bucket_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_list_append_element(
+	     summary_bucket_list,
+	     &entry_index,
+	     0,
+	     (off64_t) 0x1000,
+	     (size64_t) 0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_list_append_element(
+	     summary_bucket_list,
+	     &entry_index,
+	     0,
+	     (off64_t) 0x2000,
+	     (size64_t) 0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( nsfdb_test_index_file_bucket_list_initialize(
+	     &non_summary_bucket_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_list_append_element(
+	     non_summary_bucket_list,
+	     &entry_index,
+	     0,
+	     (off64_t) 0x3000,
+	     (size64_t) 0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libnsfdb_rrv_bucket_descriptor_initialize(
+	     &rrv_bucket_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	rrv_bucket_descriptor->type                   = LIBNSFDB_RRV_BUCKET_TYPE_DATA;
+	rrv_bucket_descriptor->initial_rrv_identifier = 4;
+	rrv_bucket_descriptor->file_offset            = 0x4000;
+
+	if( libcdata_array_append_entry(
+	     io_handle->rrv_bucket_descriptors,
+	     &entry_index,
+	     (intptr_t *) rrv_bucket_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	rrv_bucket_descriptor = NULL;
+
+	if( libnsfdb_rrv_bucket_descriptor_initialize(
+	     &rrv_bucket_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	rrv_bucket_descriptor->type                   = LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA;
+	rrv_bucket_descriptor->initial_rrv_identifier = 100;
+	rrv_bucket_descriptor->file_offset            = 0x5000;
+
+	if( libcdata_array_append_entry(
+	     io_handle->rrv_bucket_descriptors,
+	     &entry_index,
+	     (intptr_t *) rrv_bucket_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	rrv_bucket_descriptor = NULL;
+
+	if( libnsfdb_unique_name_key_initialize(
+	     &unique_name_key,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	unique_name_key->note_item_class = 1;
+	unique_name_key->note_item_type  = 5;
+	unique_name_key->name_size       = 8;
+	unique_name_key->name            = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * 8 );
+
+	if( unique_name_key->name == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     unique_name_key->name,
+	     "Subject",
+	     8 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     io_handle->unique_name_key_table,
+	     &entry_index,
+	     (intptr_t *) unique_name_key,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	unique_name_key = NULL;
+
+	if( libnsfdb_note_index_initialize(
+	     &( io_handle->note_index ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( rrv_identifier = 12;
+	     rrv_identifier > 0;
+	     rrv_identifier -= 4 )
+	{
+		if( memory_set(
+		     &rrv_value,
+		     0,
+		     sizeof( libnsfdb_rrv_value_t ) ) == NULL )
+		{
+			goto on_error;
+		}
+		rrv_value.type           = LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER;
+		rrv_value.rrv_identifier = rrv_identifier;
+		rrv_value.bucket_index   = 1;
+		rrv_value.slot_index     = (uint16_t) rrv_identifier;
+
+		if( libnsfdb_note_index_append_entry(
+		     io_handle->note_index,
+		     &rrv_value,
+		     LIBNSFDB_RRV_BUCKET_TYPE_DATA,
+		     0x0001,
+		     (uint64_t) rrv_identifier,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libnsfdb_note_index_finalize(
+	     io_handle->note_index,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     index_file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     index_file_io_handle,
+	     LIBBFIO_OPEN_READ_WRITE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libnsfdb_index_file_write(
+	     io_handle,
+	     index_file_io_handle,
+	     summary_bucket_list,
+	     non_summary_bucket_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( nsfdb_test_close_file_io_handle(
+	     &index_file_io_handle,
+	     error ) != 0 )
+	{
+		goto on_error;
+	}
+	if( libfdata_list_free(
+	     &non_summary_bucket_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfdata_list_free(
+	     &summary_bucket_list,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libnsfdb_io_handle_free(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( unique_name_key != NULL )
+	{
+		libnsfdb_unique_name_key_free(
+		 &unique_name_key,
+		 NULL );
+	}
+	if( rrv_bucket_descriptor != NULL )
+	{
+		libnsfdb_rrv_bucket_descriptor_free(
+		 &rrv_bucket_descriptor,
+		 NULL );
+	}
+	if( non_summary_bucket_list != NULL )
+	{
+		libfdata_list_free(
+		 &non_summary_bucket_list,
+		 NULL );
+	}
+	if( summary_bucket_list != NULL )
+	{
+		libfdata_list_free(
+		 &summary_bucket_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libnsfdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads an index file from data into a new IO handle and bucket lists
+ * Returns 1 if successful, 0 if the index file does not match or -1 on error
+ */
+int nsfdb_test_index_file_read_data(
+     uint8_t *data,
+     size_t data_size,
+     size64_t file_size,
+     uint32_t superblock_write_count,
+     uint32_t bucket_descriptor_block_checksum,
+     libnsfdb_io_handle_t **io_handle,
+     libfdata_list_t **summary_bucket_list,
+     libfdata_list_t **non_summary_bucket_list,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	int result                             = 0;
+
+	if( libnsfdb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( *io_handle )->file_size = file_size;
+
+	if( nsfdb_test_index_file_bucket_list_initialize(
+	     summary_bucket_list,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( nsfdb_test_index_file_bucket_list_initialize(
+	     non_summary_bucket_list,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( nsfdb_test_open_file_io_handle(
+	     &index_file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	result = libnsfdb_index_file_read(
+	          *io_handle,
+	          index_file_io_handle,
+	          superblock_write_count,
+	          NSFDB_TEST_INDEX_FILE_SUPERBLOCK_CHECKSUM,
+	          NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_WRITE_COUNT,
+	          bucket_descriptor_block_checksum,
+	          *summary_bucket_list,
+	          *non_summary_bucket_list,
+	          error );
+
+	if( nsfdb_test_close_file_io_handle(
+	     &index_file_io_handle,
+	     NULL ) != 0 )
+	{
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Frees the IO handle and bucket lists of nsfdb_test_index_file_read_data
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_index_file_free_data(
+     libnsfdb_io_handle_t **io_handle,
+     libfdata_list_t **summary_bucket_list,
+     libfdata_list_t **non_summary_bucket_list )
+{
+	int result = 1;
+
+	if( *non_summary_bucket_list != NULL )
+	{
+		if( libfdata_list_free(
+		     non_summary_bucket_list,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *summary_bucket_list != NULL )
+	{
+		if( libfdata_list_free(
+		     summary_bucket_list,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libnsfdb_io_handle_free(
+		     io_handle,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Tests the libnsfdb_index_file_copy_data_to_bucket_list function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_index_file_copy_data_to_bucket_list(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfdata_list_t *bucket_list = NULL;
+	off64_t element_offset       = 0;
+	size64_t element_size        = 0;
+	uint32_t element_flags       = 0;
+	int element_file_index       = 0;
+	int number_of_elements       = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = nsfdb_test_index_file_bucket_list_initialize(
+	          &bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "bucket_list",
+	 bucket_list );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_index_file_copy_data_to_bucket_list(
+	          nsfdb_test_index_file_bucket_list_data,
+	          0,
+	          bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_get_number_of_elements(
+	          bucket_list,
+	          &number_of_elements,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_index_file_copy_data_to_bucket_list(
+	          nsfdb_test_index_file_bucket_list_data,
+	          2,
+	          bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_get_number_of_elements(
+	          bucket_list,
+	          &number_of_elements,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 2 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_get_element_by_index(
+	          bucket_list,
+	          1,
+	          &element_file_index,
+	          &element_offset,
+	          &element_size,
+	          &element_flags,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT64(
+	 "element_offset",
+	 (int64_t) element_offset,
+	 (int64_t) 0x2000 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_index_file_copy_data_to_bucket_list(
+	          NULL,
+	          2,
+	          bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_index_file_copy_data_to_bucket_list(
+	          nsfdb_test_index_file_bucket_list_data,
+	          (uint32_t) INT_MAX + 1,
+	          bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfdata_list_free(
+	          &bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "bucket_list",
+	 bucket_list );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bucket_list != NULL )
+	{
+		libfdata_list_free(
+		 &bucket_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests writing and reading back an index file
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_index_file_read(
+     void )
+{
+	uint8_t index_file_data[ 512 ];
+
+	libcerror_error_t *error                                = NULL;
+	libfdata_list_t *non_summary_bucket_list                = NULL;
+	libfdata_list_t *summary_bucket_list                    = NULL;
+	libnsfdb_io_handle_t *io_handle                         = NULL;
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	libnsfdb_unique_name_key_t *unique_name_key             = NULL;
+	libbfio_handle_t *index_file_io_handle                  = NULL;
+	off64_t element_offset                                  = 0;
+	size64_t element_size                                   = 0;
+	uint32_t element_flags                                  = 0;
+	int element_file_index                                  = 0;
+	int number_of_elements                                  = 0;
+	int number_of_entries                                   = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          index_file_data,
+	          0,
+	          512 ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_index_file_write_data(
+	          index_file_data,
+	          512,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = nsfdb_test_index_file_read_data(
+	          index_file_data,
+	          512,
+	          NSFDB_TEST_INDEX_FILE_FILE_SIZE,
+	          NSFDB_TEST_INDEX_FILE_SUPERBLOCK_WRITE_COUNT,
+	          NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_CHECKSUM,
+	          &io_handle,
+	          &summary_bucket_list,
+	          &non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->superblock_write_count",
+	 io_handle->superblock_write_count,
+	 (uint32_t) NSFDB_TEST_INDEX_FILE_SUPERBLOCK_WRITE_COUNT );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->bucket_descriptor_block_checksum",
+	 io_handle->bucket_descriptor_block_checksum,
+	 (uint32_t) NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_CHECKSUM );
+
+	result = libfdata_list_get_number_of_elements(
+	          summary_bucket_list,
+	          &number_of_elements,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 2 );
+
+	result = libfdata_list_get_element_by_index(
+	          non_summary_bucket_list,
+	          0,
+	          &element_file_index,
+	          &element_offset,
+	          &element_size,
+	          &element_flags,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT64(
+	 "element_offset",
+	 (int64_t) element_offset,
+	 (int64_t) 0x3000 );
+
+	result = libcdata_array_get_number_of_entries(
+	          io_handle->rrv_bucket_descriptors,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	result = libcdata_array_get_entry_by_index(
+	          io_handle->rrv_bucket_descriptors,
+	          1,
+	          (intptr_t **) &rrv_bucket_descriptor,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "rrv_bucket_descriptor",
+	 rrv_bucket_descriptor );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "rrv_bucket_descriptor->type",
+	 (int) rrv_bucket_descriptor->type,
+	 (int) LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "rrv_bucket_descriptor->initial_rrv_identifier",
+	 rrv_bucket_descriptor->initial_rrv_identifier,
+	 (uint32_t) 100 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT64(
+	 "rrv_bucket_descriptor->file_offset",
+	 (int64_t) rrv_bucket_descriptor->file_offset,
+	 (int64_t) 0x5000 );
+
+	result = libcdata_array_get_entry_by_index(
+	          io_handle->unique_name_key_table,
+	          0,
+	          (intptr_t **) &unique_name_key,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "unique_name_key",
+	 unique_name_key );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "unique_name_key->name_size",
+	 unique_name_key->name_size,
+	 (size_t) 8 );
+
+	result = memory_compare(
+	          unique_name_key->name,
+	          "Subject",
+	          8 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "unique_name_key->note_item_type",
+	 (int) unique_name_key->note_item_type,
+	 5 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle->note_index",
+	 io_handle->note_index );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->note_index->number_of_entries",
+	 io_handle->note_index->number_of_entries,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = nsfdb_test_open_file_io_handle(
+	          &index_file_io_handle,
+	          index_file_data,
+	          512,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_index_file_read(
+	          NULL,
+	          index_file_io_handle,
+	          NSFDB_TEST_INDEX_FILE_SUPERBLOCK_WRITE_COUNT,
+	          NSFDB_TEST_INDEX_FILE_SUPERBLOCK_CHECKSUM,
+	          NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_WRITE_COUNT,
+	          NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_CHECKSUM,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading into an IO handle that already contains a note index
+	 */
+	result = libnsfdb_index_file_read(
+	          io_handle,
+	          index_file_io_handle,
+	          NSFDB_TEST_INDEX_FILE_SUPERBLOCK_WRITE_COUNT,
+	          NSFDB_TEST_INDEX_FILE_SUPERBLOCK_CHECKSUM,
+	          NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_WRITE_COUNT,
+	          NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_CHECKSUM,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = nsfdb_test_close_file_io_handle(
+	          &index_file_io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_index_file_free_data(
+	          &io_handle,
+	          &summary_bucket_list,
+	          &non_summary_bucket_list );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	nsfdb_test_index_file_free_data(
+	 &io_handle,
+	 &summary_bucket_list,
+	 &non_summary_bucket_list );
+
+	return( 0 );
+}
+
+/* Tests reading an index file that does not match the file
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_index_file_read_stale(
+     void )
+{
+	uint8_t index_file_data[ 512 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfdata_list_t *non_summary_bucket_list = NULL;
+	libfdata_list_t *summary_bucket_list     = NULL;
+	libnsfdb_io_handle_t *io_handle          = NULL;
+	int number_of_elements                   = 0;
+	int number_of_entries                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          index_file_data,
+	          0,
+	          512 ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_index_file_write_data(
+	          index_file_data,
+	          512,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a superblock that was written after the index file
+	 */
+	result = nsfdb_test_index_file_read_data(
+	          index_file_data,
+	          512,
+	          NSFDB_TEST_INDEX_FILE_FILE_SIZE,
+	          NSFDB_TEST_INDEX_FILE_SUPERBLOCK_WRITE_COUNT + 1,
+	          NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_CHECKSUM,
+	          &io_handle,
+	          &summary_bucket_list,
+	          &non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "io_handle->note_index",
+	 io_handle->note_index );
+
+	result = libfdata_list_get_number_of_elements(
+	          summary_bucket_list,
+	          &number_of_elements,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 0 );
+
+	result = libcdata_array_get_number_of_entries(
+	          io_handle->rrv_bucket_descriptors,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	result = nsfdb_test_index_file_free_data(
+	          &io_handle,
+	          &summary_bucket_list,
+	          &non_summary_bucket_list );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test with a bucket descriptor block that was written after the index file
+	 */
+	result = nsfdb_test_index_file_read_data(
+	          index_file_data,
+	          512,
+	          NSFDB_TEST_INDEX_FILE_FILE_SIZE,
+	          NSFDB_TEST_INDEX_FILE_SUPERBLOCK_WRITE_COUNT,
+	          NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_CHECKSUM ^ 0xffffffffUL,
+	          &io_handle,
+	          &summary_bucket_list,
+	          &non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "io_handle->note_index",
+	 io_handle->note_index );
+
+	result = nsfdb_test_index_file_free_data(
+	          &io_handle,
+	          &summary_bucket_list,
+	          &non_summary_bucket_list );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test with a file that grew after the index file was written
+	 */
+	result = nsfdb_test_index_file_read_data(
+	          index_file_data,
+	          512,
+	          NSFDB_TEST_INDEX_FILE_FILE_SIZE + 256,
+	          NSFDB_TEST_INDEX_FILE_SUPERBLOCK_WRITE_COUNT,
+	          NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_CHECKSUM,
+	          &io_handle,
+	          &summary_bucket_list,
+	          &non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_index_file_free_data(
+	          &io_handle,
+	          &summary_bucket_list,
+	          &non_summary_bucket_list );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	nsfdb_test_index_file_free_data(
+	 &io_handle,
+	 &summary_bucket_list,
+	 &non_summary_bucket_list );
+
+	return( 0 );
+}
+
+/* Tests reading a corrupt index file
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_index_file_read_corrupt(
+     void )
+{
+	uint8_t index_file_data[ 512 ];
+
+	libcerror_error_t *error                 = NULL;
+	libfdata_list_t *non_summary_bucket_list = NULL;
+	libfdata_list_t *summary_bucket_list     = NULL;
+	libnsfdb_io_handle_t *io_handle          = NULL;
+	size_t data_size                         = 0;
+	int result                               = 0;
+	int test_number                          = 0;
+
+	for( test_number = 0;
+	     test_number < 4;
+	     test_number++ )
+	{
+		/* Initialize test
+		 */
+		result = memory_set(
+		          index_file_data,
+		          0,
+		          512 ) != NULL;
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = nsfdb_test_index_file_write_data(
+		          index_file_data,
+		          512,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_size = 512;
+
+		switch( test_number )
+		{
+			/* Test with data that does not match the checksum
+			 */
+			case 0:
+				index_file_data[ sizeof( nsfdb_index_file_header_t ) + 1 ] ^= 0x40;
+				break;
+
+			/* Test with truncated data
+			 */
+			case 1:
+				data_size = sizeof( nsfdb_index_file_header_t ) + 12;
+				break;
+
+			/* Test with an invalid signature
+			 */
+			case 2:
+				index_file_data[ 0 ] = 0xff;
+				break;
+
+			/* Test with an unsupported format version
+			 */
+			case 3:
+				byte_stream_copy_from_uint32_little_endian(
+				 ( (nsfdb_index_file_header_t *) index_file_data )->format_version,
+				 2 );
+				break;
+		}
+		result = nsfdb_test_index_file_read_data(
+		          index_file_data,
+		          data_size,
+		          NSFDB_TEST_INDEX_FILE_FILE_SIZE,
+		          NSFDB_TEST_INDEX_FILE_SUPERBLOCK_WRITE_COUNT,
+		          NSFDB_TEST_INDEX_FILE_BUCKET_DESCRIPTOR_BLOCK_CHECKSUM,
+		          &io_handle,
+		          &summary_bucket_list,
+		          &non_summary_bucket_list,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "io_handle->note_index",
+		 io_handle->note_index );
+
+		result = nsfdb_test_index_file_free_data(
+		          &io_handle,
+		          &summary_bucket_list,
+		          &non_summary_bucket_list );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	nsfdb_test_index_file_free_data(
+	 &io_handle,
+	 &summary_bucket_list,
+	 &non_summary_bucket_list );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_index_file_copy_data_to_bucket_list",
+	 nsfdb_test_index_file_copy_data_to_bucket_list );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_index_file_read",
+	 nsfdb_test_index_file_read );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_index_file_read_stale",
+	 nsfdb_test_index_file_read_stale );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_index_file_read_corrupt",
+	 nsfdb_test_index_file_read_corrupt );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,19 +21,27 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "nsfdb_test_functions.h"
+#include "nsfdb_test_libbfio.h"
 #include "nsfdb_test_libcerror.h"
 #include "nsfdb_test_libnsfdb.h"
 #include "nsfdb_test_macros.h"
 #include "nsfdb_test_memory.h"
 #include "nsfdb_test_unused.h"
 
+#include "../libnsfdb/libnsfdb_io_handle.h"
+#include "../libnsfdb/libnsfdb_libcdata.h"
 #include "../libnsfdb/libnsfdb_note.h"
+#include "../libnsfdb/libnsfdb_note_value.h"
+#include "../libnsfdb/libnsfdb_rrv_value.h"
+#include "../libnsfdb/libnsfdb_unique_name_key.h"
 
 /* Tests the libnsfdb_note_free function
  * Returns 1 if successful or 0 if not
@@ -75,6 +83,939 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
 
+uint8_t nsfdb_test_note_file_data[ 16 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Creates a note in memory with the identifier: 0x00001234, note class: 0x0001 and status flags: 0x0002
+ * The note has 2 values: "Subject" with data "Hello" and a value that refers to a missing unique name key
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_note_initialize_in_memory(
+     libnsfdb_note_t **note,
+     libnsfdb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libnsfdb_internal_note_t *internal_note     = NULL;
+	libnsfdb_note_value_t *note_value           = NULL;
+	libnsfdb_unique_name_key_t *unique_name_key = NULL;
+	libnsfdb_rrv_value_t rrv_value;
+	int entry_index                             = 0;
+
+	if( libnsfdb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libnsfdb_unique_name_key_initialize(
+	     &unique_name_key,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	unique_name_key->name_size = 8;
+	unique_name_key->name      = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * 8 );
+
+	if( unique_name_key->name == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     unique_name_key->name,
+	     "Subject",
+	     8 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     ( *io_handle )->unique_name_key_table,
+	     &entry_index,
+	     (intptr_t *) unique_name_key,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	unique_name_key = NULL;
+
+	if( nsfdb_test_open_file_io_handle(
+	     file_io_handle,
+	     nsfdb_test_note_file_data,
+	     16,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     &rrv_value,
+	     0,
+	     sizeof( libnsfdb_rrv_value_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	rrv_value.type           = LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER;
+	rrv_value.rrv_identifier = 0x00001234UL;
+
+	if( libnsfdb_note_initialize(
+	     note,
+	     *file_io_handle,
+	     *io_handle,
+	     &rrv_value,
+	     NULL,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	internal_note = (libnsfdb_internal_note_t *) *note;
+
+	/* The note header and values are set directly instead of being read from a bucket
+	 */
+	internal_note->header_is_read = 1;
+	internal_note->note_class     = 0x0001;
+	internal_note->status_flags   = 0x0002;
+
+	if( libcdata_array_initialize(
+	     &( internal_note->values ),
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libnsfdb_note_value_initialize(
+	     &note_value,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	note_value->unk_table_index = 0;
+	note_value->data_size       = 5;
+
+	if( libnsfdb_note_value_set_data(
+	     note_value,
+	     (uint8_t *) "Hello",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     internal_note->values,
+	     &entry_index,
+	     (intptr_t *) note_value,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	note_value = NULL;
+
+	if( libnsfdb_note_value_initialize(
+	     &note_value,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	note_value->unk_table_index = 1;
+
+	if( libcdata_array_append_entry(
+	     internal_note->values,
+	     &entry_index,
+	     (intptr_t *) note_value,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	note_value = NULL;
+
+	return( 1 );
+
+on_error:
+	if( note_value != NULL )
+	{
+		libnsfdb_note_value_free(
+		 &note_value,
+		 NULL );
+	}
+	if( unique_name_key != NULL )
+	{
+		libnsfdb_unique_name_key_free(
+		 &unique_name_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a note created in memory
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_note_free_in_memory(
+     libnsfdb_note_t **note,
+     libnsfdb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle )
+{
+	int result = 1;
+
+	if( *note != NULL )
+	{
+		if( libnsfdb_note_free(
+		     note,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( nsfdb_test_close_file_io_handle(
+		     file_io_handle,
+		     NULL ) != 0 )
+		{
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libnsfdb_io_handle_free(
+		     io_handle,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Tests the libnsfdb_note_get_value_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_get_value_name_size(
+     libnsfdb_note_t *note )
+{
+	libcerror_error_t *error = NULL;
+	size_t name_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_get_value_name_size(
+	          note,
+	          0,
+	          &name_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 (size_t) 8 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_get_value_name_size(
+	          NULL,
+	          0,
+	          &name_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_value_name_size(
+	          note,
+	          0,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_value_name_size(
+	          note,
+	          -1,
+	          &name_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a value that refers to a missing unique name key
+	 */
+	result = libnsfdb_note_get_value_name_size(
+	          note,
+	          1,
+	          &name_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_get_value_name function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_get_value_name(
+     libnsfdb_note_t *note )
+{
+	uint8_t name[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_get_value_name(
+	          note,
+	          0,
+	          name,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          name,
+	          "Subject",
+	          8 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_get_value_name(
+	          NULL,
+	          0,
+	          name,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_value_name(
+	          note,
+	          0,
+	          NULL,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_value_name(
+	          note,
+	          0,
+	          name,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_value_name(
+	          note,
+	          0,
+	          name,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_get_value_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_get_value_data_size(
+     libnsfdb_note_t *note )
+{
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_get_value_data_size(
+	          note,
+	          0,
+	          &data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 5 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_get_value_data_size(
+	          NULL,
+	          0,
+	          &data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_value_data_size(
+	          note,
+	          0,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_value_data_size(
+	          note,
+	          2,
+	          &data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_get_value_data function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_get_value_data(
+     libnsfdb_note_t *note )
+{
+	uint8_t data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_get_value_data(
+	          note,
+	          0,
+	          data,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "Hello",
+	          5 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_get_value_data(
+	          NULL,
+	          0,
+	          data,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_value_data(
+	          note,
+	          0,
+	          NULL,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_value_data(
+	          note,
+	          0,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_value_data(
+	          note,
+	          0,
+	          data,
+	          4,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a value without data
+	 */
+	result = libnsfdb_note_get_value_data(
+	          note,
+	          1,
+	          data,
+	          16,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_get_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_get_identifier(
+     libnsfdb_note_t *note )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t note_identifier = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_get_identifier(
+	          note,
+	          &note_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_identifier",
+	 note_identifier,
+	 (uint32_t) 0x00001234UL );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_get_identifier(
+	          NULL,
+	          &note_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_identifier(
+	          note,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_get_note_class function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_get_note_class(
+     libnsfdb_note_t *note )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t note_class      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_get_note_class(
+	          note,
+	          &note_class,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT16(
+	 "note_class",
+	 note_class,
+	 (uint16_t) 0x0001 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_get_note_class(
+	          NULL,
+	          &note_class,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_note_class(
+	          note,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_get_status_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_get_status_flags(
+     libnsfdb_note_t *note )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t status_flags    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_get_status_flags(
+	          note,
+	          &status_flags,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT16(
+	 "status_flags",
+	 status_flags,
+	 (uint16_t) 0x0002 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_get_status_flags(
+	          NULL,
+	          &status_flags,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_get_status_flags(
+	          note,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
 
 /* The main program
@@ -89,6 +1030,14 @@ int main(
      char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
 #endif
 {
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libnsfdb_io_handle_t *io_handle  = NULL;
+	libnsfdb_note_t *note            = NULL;
+	int result                       = 0;
+#endif
+
 	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
 	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
 
@@ -110,11 +1059,96 @@ int main(
 
 	/* TODO: add tests for libnsfdb_note_read */
 
+	/* TODO: add tests for libnsfdb_note_get_value_by_index */
+
+	/* TODO: add tests for libnsfdb_note_get_value_unique_name_key */
+
+	/* Initialize note for tests
+	 */
+	result = nsfdb_test_note_initialize_in_memory(
+	          &note,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note",
+	 note );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_RUN_WITH_ARGS(
+	 "libnsfdb_note_get_value_name_size",
+	 nsfdb_test_note_get_value_name_size,
+	 note );
+
+	NSFDB_TEST_RUN_WITH_ARGS(
+	 "libnsfdb_note_get_value_name",
+	 nsfdb_test_note_get_value_name,
+	 note );
+
+	NSFDB_TEST_RUN_WITH_ARGS(
+	 "libnsfdb_note_get_value_data_size",
+	 nsfdb_test_note_get_value_data_size,
+	 note );
+
+	NSFDB_TEST_RUN_WITH_ARGS(
+	 "libnsfdb_note_get_value_data",
+	 nsfdb_test_note_get_value_data,
+	 note );
+
+	NSFDB_TEST_RUN_WITH_ARGS(
+	 "libnsfdb_note_get_identifier",
+	 nsfdb_test_note_get_identifier,
+	 note );
+
+	NSFDB_TEST_RUN_WITH_ARGS(
+	 "libnsfdb_note_get_note_class",
+	 nsfdb_test_note_get_note_class,
+	 note );
+
+	NSFDB_TEST_RUN_WITH_ARGS(
+	 "libnsfdb_note_get_status_flags",
+	 nsfdb_test_note_get_status_flags,
+	 note );
+
+	/* Clean up
+	 */
+	result = nsfdb_test_note_free_in_memory(
+	          &note,
+	          &io_handle,
+	          &file_io_handle );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
 
 on_error:
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	nsfdb_test_note_free_in_memory(
+	 &note,
+	 &io_handle,
+	 &file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
 	return( EXIT_FAILURE );
 }
 
@@ -0,0 +1,1093 @@
+/*
+ * Library note_filter type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_note_filter.h"
+
+/* Tests the libnsfdb_note_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_filter_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libnsfdb_note_filter_t *note_filter = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_filter_initialize(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_free(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_filter_initialize(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	note_filter = (libnsfdb_note_filter_t *) 0x12345678UL;
+
+	result = libnsfdb_note_filter_initialize(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	note_filter = NULL;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_note_filter_initialize with malloc failing
+		 */
+		nsfdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libnsfdb_note_filter_initialize(
+		          &note_filter,
+			          &error );
+
+		if( nsfdb_test_malloc_attempts_before_fail != -1 )
+		{
+			nsfdb_test_malloc_attempts_before_fail = -1;
+
+			if( note_filter != NULL )
+			{
+				libnsfdb_note_filter_free(
+				 &note_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "note_filter",
+			 note_filter );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_note_filter_initialize with memset failing
+		 */
+		nsfdb_test_memset_attempts_before_fail = test_number;
+
+		result = libnsfdb_note_filter_initialize(
+		          &note_filter,
+			          &error );
+
+		if( nsfdb_test_memset_attempts_before_fail != -1 )
+		{
+			nsfdb_test_memset_attempts_before_fail = -1;
+
+			if( note_filter != NULL )
+			{
+				libnsfdb_note_filter_free(
+				 &note_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "note_filter",
+			 note_filter );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_NSFDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( note_filter != NULL )
+	{
+		libnsfdb_note_filter_free(
+		 &note_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_filter_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_filter_set_note_class_mask function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_filter_set_note_class_mask(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libnsfdb_note_filter_t *note_filter = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_note_filter_initialize(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_filter_set_note_class_mask(
+	          note_filter,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_filter_set_note_class_mask(
+	          NULL,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_note_filter_free(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( note_filter != NULL )
+	{
+		libnsfdb_note_filter_free(
+		 &note_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_filter_set_status_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_filter_set_status_flags(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libnsfdb_note_filter_t *note_filter = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_note_filter_initialize(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_filter_set_status_flags(
+	          note_filter,
+	          0x0202,
+	          0x0002,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_filter_set_status_flags(
+	          NULL,
+	          0x0202,
+	          0x0002,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_filter_set_status_flags(
+	          note_filter,
+	          0x0002,
+	          0x0200,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_note_filter_free(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( note_filter != NULL )
+	{
+		libnsfdb_note_filter_free(
+		 &note_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_filter_set_modification_time_range function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_filter_set_modification_time_range(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libnsfdb_note_filter_t *note_filter = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_note_filter_initialize(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_filter_set_modification_time_range(
+	          note_filter,
+	          0x0000000100000000ULL,
+	          0x0000000200000000ULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_filter_set_modification_time_range(
+	          NULL,
+	          0x0000000100000000ULL,
+	          0x0000000200000000ULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_filter_set_modification_time_range(
+	          note_filter,
+	          0x0000000200000000ULL,
+	          0x0000000100000000ULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_note_filter_free(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( note_filter != NULL )
+	{
+		libnsfdb_note_filter_free(
+		 &note_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_filter_set_size_range function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_filter_set_size_range(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libnsfdb_note_filter_t *note_filter = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_note_filter_initialize(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_filter_set_size_range(
+	          note_filter,
+	          64,
+	          4096,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_filter_set_size_range(
+	          NULL,
+	          64,
+	          4096,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_filter_set_size_range(
+	          note_filter,
+	          4096,
+	          64,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_note_filter_free(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( note_filter != NULL )
+	{
+		libnsfdb_note_filter_free(
+		 &note_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* Tests the libnsfdb_note_filter_match_values function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_filter_match_values(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libnsfdb_note_filter_t *note_filter = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_note_filter_initialize(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_filter_match_values(
+	          (libnsfdb_internal_note_filter_t *) note_filter,
+	          LIBNSFDB_NOTE_CLASS_FORM,
+	          0x0200,
+	          0x0000000100000000ULL,
+	          128,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_set_note_class_mask(
+	          note_filter,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_match_values(
+	          (libnsfdb_internal_note_filter_t *) note_filter,
+	          LIBNSFDB_NOTE_CLASS_FORM,
+	          0x0000,
+	          0x0000000100000000ULL,
+	          128,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_match_values(
+	          (libnsfdb_internal_note_filter_t *) note_filter,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT | LIBNSFDB_NOTE_CLASS_DEFAULT,
+	          0x0000,
+	          0x0000000100000000ULL,
+	          128,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only match the notes that are not flagged as deleted
+	 */
+	result = libnsfdb_note_filter_set_status_flags(
+	          note_filter,
+	          0x0200,
+	          0x0000,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_match_values(
+	          (libnsfdb_internal_note_filter_t *) note_filter,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT,
+	          0x0201,
+	          0x0000000100000000ULL,
+	          128,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_match_values(
+	          (libnsfdb_internal_note_filter_t *) note_filter,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT,
+	          0x0001,
+	          0x0000000100000000ULL,
+	          128,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The time zone information of the modification time is ignored
+	 */
+	result = libnsfdb_note_filter_set_modification_time_range(
+	          note_filter,
+	          0x0000000100000000ULL,
+	          0x0000000200000000ULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_match_values(
+	          (libnsfdb_internal_note_filter_t *) note_filter,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT,
+	          0x0000,
+	          0x8500000200000000ULL,
+	          128,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_match_values(
+	          (libnsfdb_internal_note_filter_t *) note_filter,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT,
+	          0x0000,
+	          0x0000000200000001ULL,
+	          128,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_set_size_range(
+	          note_filter,
+	          64,
+	          4096,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_match_values(
+	          (libnsfdb_internal_note_filter_t *) note_filter,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT,
+	          0x0000,
+	          0x0000000100000000ULL,
+	          8192,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_filter_match_values(
+	          (libnsfdb_internal_note_filter_t *) note_filter,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT,
+	          0x0000,
+	          0x0000000100000000ULL,
+	          4096,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_filter_match_values(
+	          NULL,
+	          LIBNSFDB_NOTE_CLASS_DOCUMENT,
+	          0x0000,
+	          0x0000000100000000ULL,
+	          128,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_note_filter_free(
+	          &note_filter,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "note_filter",
+	 note_filter );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( note_filter != NULL )
+	{
+		libnsfdb_note_filter_free(
+		 &note_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_filter_initialize",
+	 nsfdb_test_note_filter_initialize );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_filter_free",
+	 nsfdb_test_note_filter_free );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_filter_set_note_class_mask",
+	 nsfdb_test_note_filter_set_note_class_mask );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_filter_set_status_flags",
+	 nsfdb_test_note_filter_set_status_flags );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_filter_set_modification_time_range",
+	 nsfdb_test_note_filter_set_modification_time_range );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_filter_set_size_range",
+	 nsfdb_test_note_filter_set_size_range );
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_filter_match_values",
+	 nsfdb_test_note_filter_match_values );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
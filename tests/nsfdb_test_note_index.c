@@ -0,0 +1,1462 @@
+/*
+ * Library note_index type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_note_index.h"
+#include "../libnsfdb/libnsfdb_rrv_bucket_descriptor.h"
+#include "../libnsfdb/libnsfdb_rrv_value.h"
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* Tests the libnsfdb_note_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_index_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libnsfdb_note_index_t *note_index = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_index_initialize(
+	          &note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_index",
+	 note_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_free(
+	          &note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "note_index",
+	 note_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_index_initialize(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	note_index = (libnsfdb_note_index_t *) 0x12345678UL;
+
+	result = libnsfdb_note_index_initialize(
+	          &note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	note_index = NULL;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_note_index_initialize with malloc failing
+		 */
+		nsfdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libnsfdb_note_index_initialize(
+		          &note_index,
+		          &error );
+
+		if( nsfdb_test_malloc_attempts_before_fail != -1 )
+		{
+			nsfdb_test_malloc_attempts_before_fail = -1;
+
+			if( note_index != NULL )
+			{
+				libnsfdb_note_index_free(
+				 &note_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "note_index",
+			 note_index );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_note_index_initialize with memset failing
+		 */
+		nsfdb_test_memset_attempts_before_fail = test_number;
+
+		result = libnsfdb_note_index_initialize(
+		          &note_index,
+		          &error );
+
+		if( nsfdb_test_memset_attempts_before_fail != -1 )
+		{
+			nsfdb_test_memset_attempts_before_fail = -1;
+
+			if( note_index != NULL )
+			{
+				libnsfdb_note_index_free(
+				 &note_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "note_index",
+			 note_index );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_NSFDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( note_index != NULL )
+	{
+		libnsfdb_note_index_free(
+		 &note_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_index_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_index_sort_lookup_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_index_sort_lookup_keys(
+     void )
+{
+	uint64_t lookup_keys[ 8 ] = {
+		0x0000000900000000ULL, 0x0000000400000001ULL, 0x0000000400000000ULL, 0x0000002000000003ULL,
+		0x0000000100000004ULL, 0x0000000800000005ULL, 0x0000000100000002ULL, 0x0000001000000007ULL };
+
+	int key_index             = 0;
+
+	libnsfdb_note_index_sort_lookup_keys(
+	 lookup_keys,
+	 8 );
+
+	for( key_index = 1;
+	     key_index < 8;
+	     key_index++ )
+	{
+		NSFDB_TEST_ASSERT_LESS_THAN_UINT64(
+		 "lookup_keys[ key_index - 1 ]",
+		 lookup_keys[ key_index - 1 ],
+		 lookup_keys[ key_index ] );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_index_append_entry and libnsfdb_note_index_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_index_lookup(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libnsfdb_note_index_entry_t *note_index_entry = NULL;
+	libnsfdb_note_index_t *note_index             = NULL;
+	libnsfdb_rrv_value_t rrv_value;
+	uint32_t rrv_identifier                       = 0;
+	int number_of_entries                         = 0;
+	int result                                    = 0;
+
+	result = libnsfdb_note_index_initialize(
+	          &note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_index",
+	 note_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Append the RRV identifiers in descending order to test the sorting
+	 */
+	for( rrv_identifier = 4000;
+	     rrv_identifier > 0;
+	     rrv_identifier -= 4 )
+	{
+		memory_set(
+		 &rrv_value,
+		 0,
+		 sizeof( libnsfdb_rrv_value_t ) );
+
+		rrv_value.type           = LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER;
+		rrv_value.rrv_identifier = rrv_identifier;
+		rrv_value.bucket_index   = rrv_identifier / 100;
+		rrv_value.slot_index     = (uint16_t) ( rrv_identifier % 100 );
+
+		result = libnsfdb_note_index_append_entry(
+		          note_index,
+		          &rrv_value,
+		          ( ( rrv_identifier % 8 ) == 0 ) ? LIBNSFDB_RRV_BUCKET_TYPE_DATA : LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA,
+		          0x0001,
+		          (uint64_t) rrv_identifier,
+		          0,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libnsfdb_note_index_finalize(
+	          note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_index_get_number_of_entries(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_ALL,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1000 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_number_of_entries(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 500 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_entry_by_index(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          0,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_index_entry",
+	 note_index_entry );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_index_entry->rrv_value.rrv_identifier",
+	 note_index_entry->rrv_value.rrv_identifier,
+	 (uint32_t) 4000 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_ALL,
+	          1236,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_index_entry->rrv_value.bucket_index",
+	 note_index_entry->rrv_value.bucket_index,
+	 (uint32_t) 12 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          1236,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_ALL,
+	          1237,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_index_get_entry_by_index(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          500,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_index_append_entry(
+	          note_index,
+	          &rrv_value,
+	          LIBNSFDB_RRV_BUCKET_TYPE_DATA,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_note_index_free(
+	          &note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "note_index",
+	 note_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( note_index != NULL )
+	{
+		libnsfdb_note_index_free(
+		 &note_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_index_get_number_of_modified_entries and libnsfdb_note_index_get_modified_entry_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_index_modified_entries(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libnsfdb_note_index_entry_t *note_index_entry = NULL;
+	libnsfdb_note_index_t *note_index             = NULL;
+	libnsfdb_rrv_value_t rrv_value;
+	uint64_t modification_time                    = 0;
+	uint32_t rrv_identifier                       = 0;
+	int entry_index                               = 0;
+	int number_of_entries                         = 0;
+	int result                                    = 0;
+
+	result = libnsfdb_note_index_initialize(
+	          &note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_index",
+	 note_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a permutation of the modification times 0 to 999 where the data notes
+	 * have an even modification time and set time zone information on some of them
+	 */
+	for( rrv_identifier = 4;
+	     rrv_identifier <= 4000;
+	     rrv_identifier += 4 )
+	{
+		memory_set(
+		 &rrv_value,
+		 0,
+		 sizeof( libnsfdb_rrv_value_t ) );
+
+		rrv_value.type           = LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER;
+		rrv_value.rrv_identifier = rrv_identifier;
+
+		modification_time = (uint64_t) ( ( ( rrv_identifier / 4 ) * 7 ) % 1000 );
+
+		if( ( rrv_identifier % 12 ) == 0 )
+		{
+			modification_time |= 0x8500000000000000ULL;
+		}
+		result = libnsfdb_note_index_append_entry(
+		          note_index,
+		          &rrv_value,
+		          ( ( rrv_identifier % 8 ) == 0 ) ? LIBNSFDB_RRV_BUCKET_TYPE_DATA : LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA,
+		          0x0001,
+		          modification_time,
+		          0,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libnsfdb_note_index_finalize(
+	          note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_index_get_number_of_modified_entries(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_ALL,
+	          0,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 999 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_number_of_modified_entries(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_ALL,
+	          500,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 499 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libnsfdb_note_index_get_modified_entry_by_index(
+		          note_index,
+		          LIBNSFDB_NOTE_TYPE_ALL,
+		          500,
+		          entry_index,
+		          &note_index_entry,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		modification_time = note_index_entry->modification_time & 0x00ffffffffffffffULL;
+
+		NSFDB_TEST_ASSERT_EQUAL_UINT64(
+		 "modification_time",
+		 modification_time,
+		 (uint64_t) ( 501 + entry_index ) );
+	}
+	/* The time zone information of the modification time is ignored
+	 */
+	result = libnsfdb_note_index_get_number_of_modified_entries(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          0x8500000000000000ULL | 500,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 249 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_modified_entry_by_index(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          500,
+	          0,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	modification_time = note_index_entry->modification_time & 0x00ffffffffffffffULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "modification_time",
+	 modification_time,
+	 (uint64_t) 502 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_number_of_modified_entries(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_NON_DATA,
+	          999,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_index_get_modified_entry_by_index(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_NON_DATA,
+	          999,
+	          0,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_index_get_number_of_modified_entries(
+	          NULL,
+	          LIBNSFDB_NOTE_TYPE_ALL,
+	          0,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_note_index_free(
+	          &note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "note_index",
+	 note_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( note_index != NULL )
+	{
+		libnsfdb_note_index_free(
+		 &note_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_index_build_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_index_threads(
+     void )
+{
+	uint32_t parent_note_identifiers[ 11 ] = {
+		0, 4, 4, 8, 16, 0, 24, 100, 40, 36, 4 };
+
+	libcerror_error_t *error                      = NULL;
+	libnsfdb_note_index_entry_t *note_index_entry = NULL;
+	libnsfdb_note_index_entry_t *response_entry   = NULL;
+	libnsfdb_note_index_entry_t *root_entry       = NULL;
+	libnsfdb_note_index_t *note_index             = NULL;
+	libnsfdb_rrv_value_t rrv_value;
+	uint32_t rrv_identifier                       = 0;
+	int number_of_response_entries                = 0;
+	int result                                    = 0;
+
+	result = libnsfdb_note_index_initialize(
+	          &note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "note_index",
+	 note_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data notes 4 to 40 contain 2 threads, a note of which the parent is missing
+	 * and a parent loop. The non-data note 44 refers to a parent that is a data note
+	 */
+	for( rrv_identifier = 4;
+	     rrv_identifier <= 44;
+	     rrv_identifier += 4 )
+	{
+		memory_set(
+		 &rrv_value,
+		 0,
+		 sizeof( libnsfdb_rrv_value_t ) );
+
+		rrv_value.type           = LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER;
+		rrv_value.rrv_identifier = rrv_identifier;
+
+		result = libnsfdb_note_index_append_entry(
+		          note_index,
+		          &rrv_value,
+		          ( rrv_identifier < 44 ) ? LIBNSFDB_RRV_BUCKET_TYPE_DATA : LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA,
+		          0x0001,
+		          0,
+		          parent_note_identifiers[ ( rrv_identifier / 4 ) - 1 ],
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libnsfdb_note_index_finalize(
+	          note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          4,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the threads were not built
+	 */
+	result = libnsfdb_note_index_get_number_of_response_entries(
+	          note_index,
+	          note_index_entry,
+	          &number_of_response_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_index_build_threads(
+	          note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_number_of_response_entries(
+	          note_index,
+	          note_index_entry,
+	          &number_of_response_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_response_entries",
+	 number_of_response_entries,
+	 2 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_response_entry_by_index(
+	          note_index,
+	          note_index_entry,
+	          0,
+	          &response_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "response_entry->rrv_value.rrv_identifier",
+	 response_entry->rrv_value.rrv_identifier,
+	 8 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_response_entry_by_index(
+	          note_index,
+	          note_index_entry,
+	          1,
+	          &response_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "response_entry->rrv_value.rrv_identifier",
+	 response_entry->rrv_value.rrv_identifier,
+	 12 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          8,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_number_of_response_entries(
+	          note_index,
+	          note_index_entry,
+	          &number_of_response_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_response_entries",
+	 number_of_response_entries,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_response_entry_by_index(
+	          note_index,
+	          note_index_entry,
+	          0,
+	          &response_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "response_entry->rrv_value.rrv_identifier",
+	 response_entry->rrv_value.rrv_identifier,
+	 16 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          20,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_thread_root_entry(
+	          note_index,
+	          note_index_entry,
+	          &root_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "root_entry->rrv_value.rrv_identifier",
+	 root_entry->rrv_value.rrv_identifier,
+	 4 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          28,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_thread_root_entry(
+	          note_index,
+	          note_index_entry,
+	          &root_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "root_entry->rrv_value.rrv_identifier",
+	 root_entry->rrv_value.rrv_identifier,
+	 24 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A note of which the parent is missing is the root of a thread
+	 */
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          32,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_thread_root_entry(
+	          note_index,
+	          note_index_entry,
+	          &root_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "root_entry->rrv_value.rrv_identifier",
+	 root_entry->rrv_value.rrv_identifier,
+	 32 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A parent loop is broken at the first note of the loop
+	 */
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_DATA,
+	          40,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_thread_root_entry(
+	          note_index,
+	          note_index_entry,
+	          &root_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "root_entry->rrv_value.rrv_identifier",
+	 root_entry->rrv_value.rrv_identifier,
+	 36 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_entry_by_identifier(
+	          note_index,
+	          LIBNSFDB_NOTE_TYPE_NON_DATA,
+	          44,
+	          &note_index_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_get_thread_root_entry(
+	          note_index,
+	          note_index_entry,
+	          &root_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "root_entry->rrv_value.rrv_identifier",
+	 root_entry->rrv_value.rrv_identifier,
+	 44 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_index_get_response_entry_by_index(
+	          note_index,
+	          note_index_entry,
+	          0,
+	          &response_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_index_get_thread_root_entry(
+	          note_index,
+	          NULL,
+	          &root_entry,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_index_build_threads(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_note_index_free(
+	          &note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "note_index",
+	 note_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( note_index != NULL )
+	{
+		libnsfdb_note_index_free(
+		 &note_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_index_initialize",
+	 nsfdb_test_note_index_initialize );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_index_free",
+	 nsfdb_test_note_index_free );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_index_sort_lookup_keys",
+	 nsfdb_test_note_index_sort_lookup_keys );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_index_lookup",
+	 nsfdb_test_note_index_lookup );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_index_modified_entries",
+	 nsfdb_test_note_index_modified_entries );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_index_threads",
+	 nsfdb_test_note_index_threads );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2144 @@
+/*
+ * Library note recovery functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_functions.h"
+#include "nsfdb_test_libbfio.h"
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_bucket.h"
+#include "../libnsfdb/libnsfdb_cache_pool.h"
+#include "../libnsfdb/libnsfdb_definitions.h"
+#include "../libnsfdb/libnsfdb_io_handle.h"
+#include "../libnsfdb/libnsfdb_libcdata.h"
+#include "../libnsfdb/libnsfdb_libfdata.h"
+#include "../libnsfdb/libnsfdb_note_index.h"
+#include "../libnsfdb/libnsfdb_note_recovery.h"
+#include "../libnsfdb/libnsfdb_rrv_bucket_descriptor.h"
+#include "../libnsfdb/libnsfdb_rrv_value.h"
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* A note of 112 bytes with RRV identifier 0x00000102 and a single summary note item
+ * with 4 bytes of data
+ */
+uint8_t nsfdb_test_note_recovery_note_data[ 112 ] = {
+	0x04, 0x00, 0x70, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64 };
+
+/* Initializes the data of a file of 612 bytes that contains 3 summary buckets
+ * The summary bucket at offset 0 has no slots and contains a deleted note in its free space,
+ * the summary bucket at offset 256 consists of garbage data and the summary bucket
+ * at offset 512 is truncated by the end of the file
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_note_recovery_file_data_initialize(
+     uint8_t *file_data )
+{
+	if( file_data == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     file_data,
+	     0,
+	     612 ) == NULL )
+	{
+		return( -1 );
+	}
+	file_data[ 0 ]  = 0x02;
+	file_data[ 1 ]  = 0x42;
+	file_data[ 6 ]  = 0xd4;
+	file_data[ 50 ] = 0x0c;
+
+	if( memory_copy(
+	     &( file_data[ 74 ] ),
+	     nsfdb_test_note_recovery_note_data,
+	     112 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     &( file_data[ 256 ] ),
+	     0xff,
+	     256 ) == NULL )
+	{
+		return( -1 );
+	}
+	file_data[ 512 ] = 0x02;
+	file_data[ 513 ] = 0x42;
+	file_data[ 518 ] = 0xd4;
+	file_data[ 562 ] = 0x0c;
+
+	return( 1 );
+}
+
+/* Appends a RRV bucket descriptor of a data RRV bucket to the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_note_recovery_append_rrv_bucket_descriptor(
+     libnsfdb_io_handle_t *io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	int entry_index                                         = 0;
+
+	if( libnsfdb_rrv_bucket_descriptor_initialize(
+	     &rrv_bucket_descriptor,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	rrv_bucket_descriptor->file_offset            = file_offset;
+	rrv_bucket_descriptor->initial_rrv_identifier = 0x00000100UL;
+	rrv_bucket_descriptor->type                   = LIBNSFDB_RRV_BUCKET_TYPE_DATA;
+
+	if( libcdata_array_append_entry(
+	     io_handle->rrv_bucket_descriptors,
+	     &entry_index,
+	     (intptr_t *) rrv_bucket_descriptor,
+	     error ) != 1 )
+	{
+		libnsfdb_rrv_bucket_descriptor_free(
+		 &rrv_bucket_descriptor,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates an IO handle that reads RRV buckets of 64 bytes by means of a cache pool
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_note_recovery_io_handle_initialize(
+     libnsfdb_io_handle_t **io_handle,
+     libnsfdb_cache_pool_t **cache_pool,
+     libcerror_error_t **error )
+{
+	if( libnsfdb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( *io_handle )->rrv_bucket_size = 64;
+
+	if( libnsfdb_cache_pool_initialize(
+	     cache_pool,
+	     1024 * 1024,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libnsfdb_cache_pool_attach_owner(
+	     (libnsfdb_internal_cache_pool_t *) *cache_pool,
+	     &( ( *io_handle )->cache_pool_owner_identifier ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( *io_handle )->cache_pool = (libnsfdb_internal_cache_pool_t *) *cache_pool;
+
+	return( 1 );
+
+on_error:
+	if( *cache_pool != NULL )
+	{
+		libnsfdb_cache_pool_free(
+		 cache_pool,
+		 NULL );
+	}
+	libnsfdb_io_handle_free(
+	 io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees an IO handle and its cache pool
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_note_recovery_io_handle_free(
+     libnsfdb_io_handle_t **io_handle,
+     libnsfdb_cache_pool_t **cache_pool,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *io_handle != NULL )
+	{
+		if( ( *io_handle )->cache_pool != NULL )
+		{
+			if( libnsfdb_cache_pool_detach_owner(
+			     ( *io_handle )->cache_pool,
+			     ( *io_handle )->cache_pool_owner_identifier,
+			     error ) != 1 )
+			{
+				result = -1;
+			}
+			( *io_handle )->cache_pool = NULL;
+		}
+		if( libnsfdb_io_handle_free(
+		     io_handle,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *cache_pool != NULL )
+	{
+		if( libnsfdb_cache_pool_free(
+		     cache_pool,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Tests the libnsfdb_note_recovery_segment_append_note function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_recovery_segment_append_note(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libnsfdb_note_recovery_segment_t *segment = NULL;
+	int note_index                            = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	segment = (libnsfdb_note_recovery_segment_t *) memory_allocate(
+	                                                sizeof( libnsfdb_note_recovery_segment_t ) );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "segment",
+	 segment );
+
+	result = memory_set(
+	          segment,
+	          0,
+	          sizeof( libnsfdb_note_recovery_segment_t ) ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( note_index = 0;
+	     note_index < 100;
+	     note_index++ )
+	{
+		result = libnsfdb_note_recovery_segment_append_note(
+		          segment,
+		          1,
+		          (uint32_t) ( 66 + ( note_index * 112 ) ),
+		          112,
+		          (uint32_t) note_index,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment->number_of_notes",
+	 segment->number_of_notes,
+	 100 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment->notes[ 99 ].data_offset",
+	 segment->notes[ 99 ].data_offset,
+	 (uint32_t) 11154 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment->notes[ 99 ].rrv_identifier",
+	 segment->notes[ 99 ].rrv_identifier,
+	 (uint32_t) 99 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_recovery_segment_append_note(
+	          NULL,
+	          1,
+	          66,
+	          112,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_note_recovery_free_segments(
+	          &segment,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "segment",
+	 segment );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment != NULL )
+	{
+		libnsfdb_note_recovery_free_segments(
+		 &segment,
+		 1,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_recovery_is_live_slot function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_recovery_is_live_slot(
+     void )
+{
+	uint64_t live_slot_keys[ 3 ] = {
+		( (uint64_t) 1 << 16 ) | 1,
+		( (uint64_t) 1 << 16 ) | 3,
+		( (uint64_t) 2 << 16 ) | 1 };
+
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_recovery_is_live_slot(
+	          live_slot_keys,
+	          3,
+	          1,
+	          3 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_note_recovery_is_live_slot(
+	          live_slot_keys,
+	          3,
+	          2,
+	          1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_note_recovery_is_live_slot(
+	          live_slot_keys,
+	          3,
+	          1,
+	          2 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libnsfdb_note_recovery_is_live_slot(
+	          live_slot_keys,
+	          3,
+	          3,
+	          1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test without live slot keys
+	 */
+	result = libnsfdb_note_recovery_is_live_slot(
+	          NULL,
+	          0,
+	          1,
+	          1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_recovery_check_note function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_recovery_check_note(
+     void )
+{
+	uint8_t note_data[ 112 ];
+
+	libcerror_error_t *error = NULL;
+	uint32_t note_size       = 0;
+	uint32_t rrv_identifier  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_recovery_check_note(
+	          nsfdb_test_note_recovery_note_data,
+	          112,
+	          &note_size,
+	          &rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_size",
+	 note_size,
+	 (uint32_t) 112 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "rrv_identifier",
+	 rrv_identifier,
+	 (uint32_t) 0x00000102UL );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a note size that exceeds the data
+	 */
+	result = libnsfdb_note_recovery_check_note(
+	          nsfdb_test_note_recovery_note_data,
+	          111,
+	          &note_size,
+	          &rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with summary note item data that exceeds the note
+	 */
+	result = memory_copy(
+	          note_data,
+	          nsfdb_test_note_recovery_note_data,
+	          112 ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	note_data[ 104 ] = 0x05;
+
+	result = libnsfdb_note_recovery_check_note(
+	          note_data,
+	          112,
+	          &note_size,
+	          &rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an invalid non-summary data identifier
+	 */
+	note_data[ 104 ] = 0x04;
+	note_data[ 56 ]  = 0x01;
+
+	result = libnsfdb_note_recovery_check_note(
+	          note_data,
+	          112,
+	          &note_size,
+	          &rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an invalid signature
+	 */
+	note_data[ 56 ] = 0x00;
+	note_data[ 0 ]  = 0x02;
+
+	result = libnsfdb_note_recovery_check_note(
+	          note_data,
+	          112,
+	          &note_size,
+	          &rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_recovery_check_note(
+	          NULL,
+	          112,
+	          &note_size,
+	          &rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_recovery_check_note(
+	          nsfdb_test_note_recovery_note_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &note_size,
+	          &rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_recovery_check_note(
+	          nsfdb_test_note_recovery_note_data,
+	          112,
+	          NULL,
+	          &rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_recovery_check_note(
+	          nsfdb_test_note_recovery_note_data,
+	          112,
+	          &note_size,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_recovery_carve_bucket function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_recovery_carve_bucket(
+     void )
+{
+	libnsfdb_note_recovery_segment_t segment;
+	libnsfdb_bucket_t bucket;
+	uint8_t bucket_data[ 212 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 * The bucket has no slots and contains a deleted note in its free space
+	 * the footer is 12 bytes
+	 */
+	result = memory_set(
+	          &segment,
+	          0,
+	          sizeof( libnsfdb_note_recovery_segment_t ) ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          bucket_data,
+	          0,
+	          212 ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	bucket_data[ 0 ]  = 0x02;
+	bucket_data[ 1 ]  = 0x42;
+	bucket_data[ 50 ] = 0x0c;
+
+	result = memory_copy(
+	          &( bucket_data[ 74 ] ),
+	          nsfdb_test_note_recovery_note_data,
+	          112 ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &bucket,
+	          0,
+	          sizeof( libnsfdb_bucket_t ) ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	bucket.data      = bucket_data;
+	bucket.data_size = 212;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_note_recovery_carve_bucket(
+	          &segment,
+	          &bucket,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment.number_of_notes",
+	 segment.number_of_notes,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment.notes[ 0 ].data_offset",
+	 segment.notes[ 0 ].data_offset,
+	 (uint32_t) 74 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment.notes[ 0 ].data_size",
+	 segment.notes[ 0 ].data_size,
+	 (uint32_t) 112 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment.notes[ 0 ].rrv_identifier",
+	 segment.notes[ 0 ].rrv_identifier,
+	 (uint32_t) 0x00000102UL );
+
+	/* Test with a footer that overlaps the note
+	 */
+	bucket_data[ 50 ] = 0x20;
+
+	segment.number_of_notes = 0;
+
+	result = libnsfdb_note_recovery_carve_bucket(
+	          &segment,
+	          &bucket,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment.number_of_notes",
+	 segment.number_of_notes,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_recovery_carve_bucket(
+	          NULL,
+	          &bucket,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_recovery_carve_bucket(
+	          &segment,
+	          NULL,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 segment.notes );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment.notes != NULL )
+	{
+		memory_free(
+		 segment.notes );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_recovery_scan_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_recovery_scan_segment(
+     void )
+{
+	libnsfdb_note_recovery_segment_t segment;
+	off64_t bucket_offsets[ 3 ] = { 0, 256, 512 };
+	uint8_t file_data[ 612 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	int abort                        = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &segment,
+	          0,
+	          sizeof( libnsfdb_note_recovery_segment_t ) ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_note_recovery_file_data_initialize(
+	          file_data );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          612,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment.file_io_handle     = file_io_handle;
+	segment.bucket_offsets     = bucket_offsets;
+	segment.first_bucket_index = 1;
+	segment.end_bucket_index   = 4;
+
+	/* Test regular cases, the summary buckets with garbage data and the truncated
+	 * summary bucket are skipped
+	 */
+	result = libnsfdb_note_recovery_scan_segment(
+	          &segment );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment.result",
+	 segment.result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "segment.error",
+	 segment.error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment.number_of_notes",
+	 segment.number_of_notes,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment.notes[ 0 ].bucket_index",
+	 segment.notes[ 0 ].bucket_index,
+	 (uint32_t) 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment.notes[ 0 ].data_offset",
+	 segment.notes[ 0 ].data_offset,
+	 (uint32_t) 74 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment.notes[ 0 ].data_size",
+	 segment.notes[ 0 ].data_size,
+	 (uint32_t) 112 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment.notes[ 0 ].rrv_identifier",
+	 segment.notes[ 0 ].rrv_identifier,
+	 (uint32_t) 0x00000102UL );
+
+	/* Test with a range that only contains the summary bucket with garbage data
+	 * and the truncated summary bucket
+	 */
+	segment.number_of_notes    = 0;
+	segment.first_bucket_index = 2;
+
+	result = libnsfdb_note_recovery_scan_segment(
+	          &segment );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "segment.error",
+	 segment.error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment.number_of_notes",
+	 segment.number_of_notes,
+	 0 );
+
+	/* Test with abort signalled
+	 */
+	segment.first_bucket_index = 1;
+	segment.abort              = &abort;
+
+	abort = 1;
+
+	result = libnsfdb_note_recovery_scan_segment(
+	          &segment );
+
+	segment.abort = NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment.number_of_notes",
+	 segment.number_of_notes,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_recovery_scan_segment(
+	          NULL );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	segment.bucket_offsets = NULL;
+
+	result = libnsfdb_note_recovery_scan_segment(
+	          &segment );
+
+	segment.bucket_offsets = bucket_offsets;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment.result",
+	 segment.result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "segment.error",
+	 segment.error );
+
+	libcerror_error_free(
+	 &( segment.error ) );
+
+	/* Clean up
+	 */
+	memory_free(
+	 segment.notes );
+
+	segment.notes = NULL;
+
+	result = nsfdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment.error != NULL )
+	{
+		libcerror_error_free(
+		 &( segment.error ) );
+	}
+	if( segment.notes != NULL )
+	{
+		memory_free(
+		 segment.notes );
+	}
+	if( file_io_handle != NULL )
+	{
+		nsfdb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_recovery_free_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_recovery_free_segments(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_recovery_free_segments(
+	          NULL,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_recovery_get_live_slot_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_recovery_get_live_slot_keys(
+     void )
+{
+	libnsfdb_rrv_value_t rrv_value;
+	uint8_t file_data[ 612 ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libnsfdb_cache_pool_t *cache_pool = NULL;
+	libnsfdb_io_handle_t *io_handle   = NULL;
+	uint64_t *live_slot_keys          = NULL;
+	int number_of_live_slot_keys      = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = nsfdb_test_note_recovery_file_data_initialize(
+	          file_data );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_note_recovery_io_handle_initialize(
+	          &io_handle,
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          612,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, without RRV buckets there are no live slots
+	 */
+	result = libnsfdb_note_recovery_get_live_slot_keys(
+	          io_handle,
+	          file_io_handle,
+	          &live_slot_keys,
+	          &number_of_live_slot_keys,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "live_slot_keys",
+	 live_slot_keys );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_live_slot_keys",
+	 number_of_live_slot_keys,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a note index that references slot 1 of bucket 2 and slot 3 of bucket 1
+	 * and a note that is stored at a file position
+	 */
+	result = libnsfdb_note_index_initialize(
+	          &( io_handle->note_index ),
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          &rrv_value,
+	          0,
+	          sizeof( libnsfdb_rrv_value_t ) ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	rrv_value.type           = LIBNSFDB_RRV_VALUE_TYPE_BUCKET_SLOT_IDENTIFIER;
+	rrv_value.rrv_identifier = 0x00000104UL;
+	rrv_value.bucket_index   = 2;
+	rrv_value.slot_index     = 1;
+
+	result = libnsfdb_note_index_append_entry(
+	          io_handle->note_index,
+	          &rrv_value,
+	          LIBNSFDB_RRV_BUCKET_TYPE_DATA,
+	          0x0001,
+	          0,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	rrv_value.rrv_identifier = 0x00000108UL;
+	rrv_value.bucket_index   = 1;
+	rrv_value.slot_index     = 3;
+
+	result = libnsfdb_note_index_append_entry(
+	          io_handle->note_index,
+	          &rrv_value,
+	          LIBNSFDB_RRV_BUCKET_TYPE_DATA,
+	          0x0001,
+	          0,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          &rrv_value,
+	          0,
+	          sizeof( libnsfdb_rrv_value_t ) ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	rrv_value.type           = LIBNSFDB_RRV_VALUE_TYPE_FILE_POSITION;
+	rrv_value.rrv_identifier = 0x0000010cUL;
+	rrv_value.file_offset    = 0x00001000;
+
+	result = libnsfdb_note_index_append_entry(
+	          io_handle->note_index,
+	          &rrv_value,
+	          LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA,
+	          0x0001,
+	          0,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_index_finalize(
+	          io_handle->note_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_recovery_get_live_slot_keys(
+	          io_handle,
+	          file_io_handle,
+	          &live_slot_keys,
+	          &number_of_live_slot_keys,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "live_slot_keys",
+	 live_slot_keys );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_live_slot_keys",
+	 number_of_live_slot_keys,
+	 2 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "live_slot_keys[ 0 ]",
+	 live_slot_keys[ 0 ],
+	 (uint64_t) 0x00010003UL );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "live_slot_keys[ 1 ]",
+	 live_slot_keys[ 1 ],
+	 (uint64_t) 0x00020001UL );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_recovery_get_live_slot_keys(
+	          io_handle,
+	          file_io_handle,
+	          &live_slot_keys,
+	          &number_of_live_slot_keys,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_free(
+	 live_slot_keys );
+
+	live_slot_keys = NULL;
+
+	result = libnsfdb_note_recovery_get_live_slot_keys(
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          &number_of_live_slot_keys,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_recovery_get_live_slot_keys(
+	          io_handle,
+	          file_io_handle,
+	          &live_slot_keys,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_recovery_get_live_slot_keys(
+	          NULL,
+	          file_io_handle,
+	          &live_slot_keys,
+	          &number_of_live_slot_keys,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a RRV bucket that consists of garbage data
+	 */
+	result = libnsfdb_note_index_free(
+	          &( io_handle->note_index ),
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_note_recovery_append_rrv_bucket_descriptor(
+	          io_handle,
+	          256,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_recovery_get_live_slot_keys(
+	          io_handle,
+	          file_io_handle,
+	          &live_slot_keys,
+	          &number_of_live_slot_keys,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "live_slot_keys",
+	 live_slot_keys );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = nsfdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_note_recovery_io_handle_free(
+	          &io_handle,
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( live_slot_keys != NULL )
+	{
+		memory_free(
+		 live_slot_keys );
+	}
+	if( file_io_handle != NULL )
+	{
+		nsfdb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	nsfdb_test_note_recovery_io_handle_free(
+	 &io_handle,
+	 &cache_pool,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libnsfdb_note_recovery_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_note_recovery_scan(
+     void )
+{
+	uint8_t file_data[ 612 ];
+
+	libbfio_handle_t *file_io_handle     = NULL;
+	libcdata_array_t *recovered_notes    = NULL;
+	libcerror_error_t *error             = NULL;
+	libfdata_list_t *summary_bucket_list = NULL;
+	libnsfdb_cache_pool_t *cache_pool    = NULL;
+	libnsfdb_io_handle_t *io_handle      = NULL;
+	libnsfdb_rrv_value_t *rrv_value      = NULL;
+	off64_t bucket_offset                = 0;
+	int abort                            = 0;
+	int element_index                    = 0;
+	int number_of_entries                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = nsfdb_test_note_recovery_file_data_initialize(
+	          file_data );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_note_recovery_io_handle_initialize(
+	          &io_handle,
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          612,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_initialize(
+	          &summary_bucket_list,
+	          NULL,
+	          NULL,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
+	          NULL,
+	          LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "summary_bucket_list",
+	 summary_bucket_list );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &recovered_notes,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "recovered_notes",
+	 recovered_notes );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, without summary buckets there is nothing to scan
+	 */
+	result = libnsfdb_note_recovery_scan(
+	          io_handle,
+	          file_io_handle,
+	          summary_bucket_list,
+	          2,
+	          recovered_notes,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          recovered_notes,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	/* Test with the summary bucket with the deleted note, the summary bucket
+	 * with garbage data and the truncated summary bucket
+	 */
+	for( bucket_offset = 0;
+	     bucket_offset < 612;
+	     bucket_offset += 256 )
+	{
+		result = libfdata_list_append_element(
+		          summary_bucket_list,
+		          &element_index,
+		          0,
+		          bucket_offset,
+		          (size64_t) 0,
+		          0,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libnsfdb_note_recovery_scan(
+	          io_handle,
+	          file_io_handle,
+	          summary_bucket_list,
+	          2,
+	          recovered_notes,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          recovered_notes,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	result = libcdata_array_get_entry_by_index(
+	          recovered_notes,
+	          0,
+	          (intptr_t **) &rrv_value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "rrv_value",
+	 rrv_value );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "rrv_value->type",
+	 rrv_value->type,
+	 (uint8_t) LIBNSFDB_RRV_VALUE_TYPE_BUCKET_DATA_RANGE );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "rrv_value->rrv_identifier",
+	 rrv_value->rrv_identifier,
+	 (uint32_t) 0x00000102UL );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "rrv_value->bucket_index",
+	 rrv_value->bucket_index,
+	 (uint32_t) 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "rrv_value->data_offset",
+	 rrv_value->data_offset,
+	 (uint32_t) 74 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "rrv_value->data_size",
+	 rrv_value->data_size,
+	 (uint32_t) 112 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_note_recovery_scan(
+	          NULL,
+	          file_io_handle,
+	          summary_bucket_list,
+	          2,
+	          recovered_notes,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_recovery_scan(
+	          io_handle,
+	          file_io_handle,
+	          summary_bucket_list,
+	          0,
+	          recovered_notes,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_recovery_scan(
+	          io_handle,
+	          file_io_handle,
+	          summary_bucket_list,
+	          LIBNSFDB_MAXIMUM_NUMBER_OF_RECOVERY_THREADS + 1,
+	          recovered_notes,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_recovery_scan(
+	          io_handle,
+	          file_io_handle,
+	          summary_bucket_list,
+	          2,
+	          NULL,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_note_recovery_scan(
+	          io_handle,
+	          file_io_handle,
+	          summary_bucket_list,
+	          2,
+	          recovered_notes,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with abort signalled
+	 */
+	abort = 1;
+
+	result = libnsfdb_note_recovery_scan(
+	          io_handle,
+	          file_io_handle,
+	          summary_bucket_list,
+	          2,
+	          recovered_notes,
+	          &abort,
+	          &error );
+
+	abort = 0;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a RRV bucket that consists of garbage data
+	 */
+	result = nsfdb_test_note_recovery_append_rrv_bucket_descriptor(
+	          io_handle,
+	          256,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_note_recovery_scan(
+	          io_handle,
+	          file_io_handle,
+	          summary_bucket_list,
+	          2,
+	          recovered_notes,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_array_get_number_of_entries(
+	          recovered_notes,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &recovered_notes,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_value_free,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "recovered_notes",
+	 recovered_notes );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_free(
+	          &summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "summary_bucket_list",
+	 summary_bucket_list );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_note_recovery_io_handle_free(
+	          &io_handle,
+	          &cache_pool,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( recovered_notes != NULL )
+	{
+		libcdata_array_free(
+		 &recovered_notes,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libnsfdb_rrv_value_free,
+		 NULL );
+	}
+	if( summary_bucket_list != NULL )
+	{
+		libfdata_list_free(
+		 &summary_bucket_list,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		nsfdb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	nsfdb_test_note_recovery_io_handle_free(
+	 &io_handle,
+	 &cache_pool,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_recovery_segment_append_note",
+	 nsfdb_test_note_recovery_segment_append_note );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_recovery_is_live_slot",
+	 nsfdb_test_note_recovery_is_live_slot );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_recovery_check_note",
+	 nsfdb_test_note_recovery_check_note );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_recovery_carve_bucket",
+	 nsfdb_test_note_recovery_carve_bucket );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_recovery_scan_segment",
+	 nsfdb_test_note_recovery_scan_segment );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_recovery_free_segments",
+	 nsfdb_test_note_recovery_free_segments );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_recovery_get_live_slot_keys",
+	 nsfdb_test_note_recovery_get_live_slot_keys );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_note_recovery_scan",
+	 nsfdb_test_note_recovery_scan );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
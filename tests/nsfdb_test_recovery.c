@@ -0,0 +1,1949 @@
+/*
+ * Library recovery functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_functions.h"
+#include "nsfdb_test_libbfio.h"
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_definitions.h"
+#include "../libnsfdb/libnsfdb_io_handle.h"
+#include "../libnsfdb/libnsfdb_libcdata.h"
+#include "../libnsfdb/libnsfdb_libfdata.h"
+#include "../libnsfdb/libnsfdb_recovery.h"
+#include "../libnsfdb/libnsfdb_rrv_bucket_descriptor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* A RRV bucket with a 32 byte header and 32 bytes of data
+ * The checksum is the 32-bit XOR of the data: 0x11111111 ^ 0x22222222
+ */
+uint8_t nsfdb_test_recovery_rrv_bucket_data[ 64 ] = {
+	0x06, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Initializes the data of a damaged file of 1024 bytes
+ * The file contains a bucket with garbage data at offset 0, a RRV bucket at offset 256,
+ * a RRV bucket with a mismatching checksum at offset 512 and a bucket that exceeds
+ * the file size at offset 768, the remaining bytes are 0xff
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_recovery_file_data_initialize(
+     uint8_t *file_data )
+{
+	if( file_data == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     file_data,
+	     0xff,
+	     1024 ) == NULL )
+	{
+		return( -1 );
+	}
+	file_data[ 0 ] = 0x02;
+	file_data[ 1 ] = 0x42;
+	file_data[ 6 ] = 0x00;
+	file_data[ 7 ] = 0x01;
+	file_data[ 8 ] = 0x00;
+	file_data[ 9 ] = 0x00;
+
+	if( memory_copy(
+	     &( file_data[ 256 ] ),
+	     nsfdb_test_recovery_rrv_bucket_data,
+	     64 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( file_data[ 512 ] ),
+	     nsfdb_test_recovery_rrv_bucket_data,
+	     64 ) == NULL )
+	{
+		return( -1 );
+	}
+	file_data[ 552 ] = 0xff;
+
+	file_data[ 768 ] = 0x02;
+	file_data[ 769 ] = 0x42;
+	file_data[ 774 ] = 0x00;
+	file_data[ 775 ] = 0x10;
+	file_data[ 776 ] = 0x00;
+	file_data[ 777 ] = 0x00;
+
+	return( 1 );
+}
+
+/* Creates the summary and non-summary bucket lists
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_recovery_bucket_lists_initialize(
+     libfdata_list_t **summary_bucket_list,
+     libfdata_list_t **non_summary_bucket_list,
+     libcerror_error_t **error )
+{
+	if( libfdata_list_initialize(
+	     summary_bucket_list,
+	     NULL,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfdata_list_initialize(
+	     non_summary_bucket_list,
+	     NULL,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libnsfdb_io_handle_read_bucket,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libfdata_list_free(
+		 summary_bucket_list,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the summary and non-summary bucket lists
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_recovery_bucket_lists_free(
+     libfdata_list_t **summary_bucket_list,
+     libfdata_list_t **non_summary_bucket_list,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *summary_bucket_list != NULL )
+	{
+		if( libfdata_list_free(
+		     summary_bucket_list,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *non_summary_bucket_list != NULL )
+	{
+		if( libfdata_list_free(
+		     non_summary_bucket_list,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Tests the libnsfdb_recovery_segment_append_structure function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_recovery_segment_append_structure(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libnsfdb_recovery_segment_t *segment = NULL;
+	int result                           = 0;
+	int structure_index                  = 0;
+
+	/* Initialize test
+	 */
+	segment = (libnsfdb_recovery_segment_t *) memory_allocate(
+	                                           sizeof( libnsfdb_recovery_segment_t ) );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "segment",
+	 segment );
+
+	result = memory_set(
+	          segment,
+	          0,
+	          sizeof( libnsfdb_recovery_segment_t ) ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( structure_index = 0;
+	     structure_index < 300;
+	     structure_index++ )
+	{
+		result = libnsfdb_recovery_segment_append_structure(
+		          segment,
+		          LIBNSFDB_RECOVERED_STRUCTURE_TYPE_SUMMARY_BUCKET,
+		          (off64_t) structure_index * 256,
+		          256,
+		          0,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment->number_of_structures",
+	 segment->number_of_structures,
+	 300 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT64(
+	 "segment->structures[ 299 ].file_offset",
+	 (int64_t) segment->structures[ 299 ].file_offset,
+	 (int64_t) 76544 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_recovery_segment_append_structure(
+	          NULL,
+	          LIBNSFDB_RECOVERED_STRUCTURE_TYPE_SUMMARY_BUCKET,
+	          0,
+	          256,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_segment_append_structure(
+	          segment,
+	          LIBNSFDB_RECOVERED_STRUCTURE_TYPE_SUMMARY_BUCKET,
+	          -1,
+	          256,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_recovery_free_segments(
+	          &segment,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "segment",
+	 segment );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment != NULL )
+	{
+		libnsfdb_recovery_free_segments(
+		 &segment,
+		 1,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_recovery_check_bucket function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_recovery_check_bucket(
+     void )
+{
+	uint8_t header_data[ 256 ];
+
+	libcerror_error_t *error        = NULL;
+	libnsfdb_io_handle_t *io_handle = NULL;
+	uint32_t bucket_size            = 0;
+	uint8_t structure_type          = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          header_data,
+	          0,
+	          256 ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_recovery_check_bucket(
+	          io_handle,
+	          NULL,
+	          4096,
+	          header_data,
+	          256,
+	          0,
+	          &structure_type,
+	          &bucket_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a bucket header that exceeds the file size
+	 */
+	header_data[ 0 ] = 0x02;
+	header_data[ 1 ] = 0x42;
+	header_data[ 6 ] = 0x00;
+	header_data[ 7 ] = 0x20;
+
+	result = libnsfdb_recovery_check_bucket(
+	          io_handle,
+	          NULL,
+	          4096,
+	          header_data,
+	          256,
+	          0,
+	          &structure_type,
+	          &bucket_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_recovery_check_bucket(
+	          NULL,
+	          NULL,
+	          4096,
+	          header_data,
+	          256,
+	          0,
+	          &structure_type,
+	          &bucket_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_check_bucket(
+	          io_handle,
+	          NULL,
+	          4096,
+	          NULL,
+	          256,
+	          0,
+	          &structure_type,
+	          &bucket_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_check_bucket(
+	          io_handle,
+	          NULL,
+	          4096,
+	          header_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &structure_type,
+	          &bucket_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_check_bucket(
+	          io_handle,
+	          NULL,
+	          4096,
+	          header_data,
+	          256,
+	          -1,
+	          &structure_type,
+	          &bucket_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_check_bucket(
+	          io_handle,
+	          NULL,
+	          4096,
+	          header_data,
+	          256,
+	          0,
+	          NULL,
+	          &bucket_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_check_bucket(
+	          io_handle,
+	          NULL,
+	          4096,
+	          header_data,
+	          256,
+	          0,
+	          &structure_type,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libnsfdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_recovery_check_rrv_bucket function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_recovery_check_rrv_bucket(
+     void )
+{
+	uint8_t rrv_bucket_data[ 64 ];
+
+	libcerror_error_t *error        = NULL;
+	uint32_t initial_rrv_identifier = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_recovery_check_rrv_bucket(
+	          nsfdb_test_recovery_rrv_bucket_data,
+	          64,
+	          &initial_rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "initial_rrv_identifier",
+	 initial_rrv_identifier,
+	 (uint32_t) 0x00000100UL );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a mismatching checksum
+	 */
+	result = memory_copy(
+	          rrv_bucket_data,
+	          nsfdb_test_recovery_rrv_bucket_data,
+	          64 ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	rrv_bucket_data[ 40 ] = 0xff;
+
+	result = libnsfdb_recovery_check_rrv_bucket(
+	          rrv_bucket_data,
+	          64,
+	          &initial_rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an invalid signature
+	 */
+	rrv_bucket_data[ 0 ]  = 0x02;
+	rrv_bucket_data[ 40 ] = 0x00;
+
+	result = libnsfdb_recovery_check_rrv_bucket(
+	          rrv_bucket_data,
+	          64,
+	          &initial_rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with data that is too small
+	 */
+	result = libnsfdb_recovery_check_rrv_bucket(
+	          nsfdb_test_recovery_rrv_bucket_data,
+	          32,
+	          &initial_rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_recovery_check_rrv_bucket(
+	          NULL,
+	          64,
+	          &initial_rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_check_rrv_bucket(
+	          nsfdb_test_recovery_rrv_bucket_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &initial_rrv_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_check_rrv_bucket(
+	          nsfdb_test_recovery_rrv_bucket_data,
+	          64,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_recovery_scan_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_recovery_scan_segment(
+     void )
+{
+	uint8_t file_data[ 1024 ];
+
+	libbfio_handle_t *file_io_handle     = NULL;
+	libcerror_error_t *error             = NULL;
+	libnsfdb_io_handle_t *io_handle      = NULL;
+	libnsfdb_recovery_segment_t *segment = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = nsfdb_test_recovery_file_data_initialize(
+	          file_data );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->rrv_bucket_size = 64;
+
+	result = nsfdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          1024,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment = (libnsfdb_recovery_segment_t *) memory_allocate(
+	                                           sizeof( libnsfdb_recovery_segment_t ) );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "segment",
+	 segment );
+
+	result = memory_set(
+	          segment,
+	          0,
+	          sizeof( libnsfdb_recovery_segment_t ) ) != NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	segment->io_handle      = io_handle;
+	segment->file_io_handle = file_io_handle;
+	segment->file_size      = 1024;
+	segment->start_offset   = 0;
+	segment->end_offset     = 1024;
+
+	/* Test regular cases, only the RRV bucket at offset 256 is recovered
+	 */
+	result = libnsfdb_recovery_scan_segment(
+	          segment );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment->result",
+	 segment->result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "segment->error",
+	 segment->error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment->number_of_structures",
+	 segment->number_of_structures,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "segment->structures[ 0 ].type",
+	 segment->structures[ 0 ].type,
+	 (uint8_t) LIBNSFDB_RECOVERED_STRUCTURE_TYPE_RRV_BUCKET );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT64(
+	 "segment->structures[ 0 ].file_offset",
+	 (int64_t) segment->structures[ 0 ].file_offset,
+	 (int64_t) 256 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment->structures[ 0 ].size",
+	 segment->structures[ 0 ].size,
+	 (uint32_t) 64 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "segment->structures[ 0 ].initial_rrv_identifier",
+	 segment->structures[ 0 ].initial_rrv_identifier,
+	 (uint32_t) 0x00000100UL );
+
+	/* Test with a region that ends before the RRV bucket
+	 */
+	segment->number_of_structures = 0;
+	segment->end_offset           = 256;
+
+	result = libnsfdb_recovery_scan_segment(
+	          segment );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment->number_of_structures",
+	 segment->number_of_structures,
+	 0 );
+
+	/* Test with a file that is truncated inside the RRV bucket
+	 */
+	segment->file_size  = 288;
+	segment->end_offset = 288;
+
+	result = libnsfdb_recovery_scan_segment(
+	          segment );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment->number_of_structures",
+	 segment->number_of_structures,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "segment->error",
+	 segment->error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_recovery_scan_segment(
+	          NULL );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Test with a file size that exceeds the data
+	 */
+	segment->file_size  = 2048;
+	segment->end_offset = 2048;
+
+	result = libnsfdb_recovery_scan_segment(
+	          segment );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment->result",
+	 segment->result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "segment->error",
+	 segment->error );
+
+	libcerror_error_free(
+	 &( segment->error ) );
+
+	segment->file_size    = 1024;
+	segment->end_offset   = 1024;
+	segment->start_offset = 128;
+
+	result = libnsfdb_recovery_scan_segment(
+	          segment );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "segment->error",
+	 segment->error );
+
+	libcerror_error_free(
+	 &( segment->error ) );
+
+	segment->start_offset = 0;
+	segment->io_handle    = NULL;
+
+	result = libnsfdb_recovery_scan_segment(
+	          segment );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "segment->error",
+	 segment->error );
+
+	libcerror_error_free(
+	 &( segment->error ) );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "segment->number_of_structures",
+	 segment->number_of_structures,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libnsfdb_recovery_free_segments(
+	          &segment,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "segment",
+	 segment );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment != NULL )
+	{
+		libnsfdb_recovery_free_segments(
+		 &segment,
+		 1,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		nsfdb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libnsfdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_recovery_free_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_recovery_free_segments(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_recovery_free_segments(
+	          NULL,
+	          1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_recovery_rebuild function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_recovery_rebuild(
+     void )
+{
+	libnsfdb_recovered_structure_t structures[ 6 ] = {
+		{ LIBNSFDB_RECOVERED_STRUCTURE_TYPE_SUMMARY_BUCKET, 0x1000, 256, 0 },
+		{ (uint8_t) 'x', 0x1100, 0xffffffffUL, 0xffffffffUL },
+		{ LIBNSFDB_RECOVERED_STRUCTURE_TYPE_RRV_BUCKET, 0x2000, 64, 0x00000200UL },
+		{ LIBNSFDB_RECOVERED_STRUCTURE_TYPE_RRV_BUCKET, 0x3000, 64, 0x00000100UL },
+		{ LIBNSFDB_RECOVERED_STRUCTURE_TYPE_RRV_BUCKET, 0x4000, 64, 0x00000100UL },
+		{ LIBNSFDB_RECOVERED_STRUCTURE_TYPE_NON_SUMMARY_BUCKET, 0x5000, 512, 0 } };
+
+	libcerror_error_t *error                                = NULL;
+	libfdata_list_t *non_summary_bucket_list                = NULL;
+	libfdata_list_t *summary_bucket_list                    = NULL;
+	libnsfdb_io_handle_t *io_handle                         = NULL;
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	int number_of_elements                                  = 0;
+	int number_of_entries                                   = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_recovery_bucket_lists_initialize(
+	          &summary_bucket_list,
+	          &non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the structure with an unknown type is ignored
+	 * and of the RRV buckets with the same initial RRV identifier the first is kept
+	 */
+	result = libnsfdb_recovery_rebuild(
+	          io_handle,
+	          structures,
+	          6,
+	          0x2000,
+	          0x3000,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_get_number_of_elements(
+	          summary_bucket_list,
+	          &number_of_elements,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 1 );
+
+	result = libfdata_list_get_number_of_elements(
+	          non_summary_bucket_list,
+	          &number_of_elements,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 1 );
+
+	result = libcdata_array_get_number_of_entries(
+	          io_handle->rrv_bucket_descriptors,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	result = libcdata_array_get_entry_by_index(
+	          io_handle->rrv_bucket_descriptors,
+	          0,
+	          (intptr_t **) &rrv_bucket_descriptor,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "rrv_bucket_descriptor",
+	 rrv_bucket_descriptor );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT64(
+	 "rrv_bucket_descriptor->file_offset",
+	 (int64_t) rrv_bucket_descriptor->file_offset,
+	 (int64_t) 0x3000 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "rrv_bucket_descriptor->type",
+	 rrv_bucket_descriptor->type,
+	 (uint8_t) LIBNSFDB_RRV_BUCKET_TYPE_DATA );
+
+	result = libcdata_array_get_entry_by_index(
+	          io_handle->rrv_bucket_descriptors,
+	          1,
+	          (intptr_t **) &rrv_bucket_descriptor,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "rrv_bucket_descriptor",
+	 rrv_bucket_descriptor );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT64(
+	 "rrv_bucket_descriptor->file_offset",
+	 (int64_t) rrv_bucket_descriptor->file_offset,
+	 (int64_t) 0x2000 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "rrv_bucket_descriptor->type",
+	 rrv_bucket_descriptor->type,
+	 (uint8_t) LIBNSFDB_RRV_BUCKET_TYPE_NON_DATA );
+
+	/* Test without recovered structures
+	 */
+	result = libnsfdb_recovery_rebuild(
+	          io_handle,
+	          NULL,
+	          0,
+	          0x2000,
+	          0x3000,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          io_handle->rrv_bucket_descriptors,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_recovery_rebuild(
+	          NULL,
+	          structures,
+	          6,
+	          0x2000,
+	          0x3000,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_rebuild(
+	          io_handle,
+	          NULL,
+	          6,
+	          0x2000,
+	          0x3000,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_rebuild(
+	          io_handle,
+	          structures,
+	          -1,
+	          0x2000,
+	          0x3000,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = nsfdb_test_recovery_bucket_lists_free(
+	          &summary_bucket_list,
+	          &non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	nsfdb_test_recovery_bucket_lists_free(
+	 &summary_bucket_list,
+	 &non_summary_bucket_list,
+	 NULL );
+
+	if( io_handle != NULL )
+	{
+		libnsfdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_recovery_scan_file function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_recovery_scan_file(
+     void )
+{
+	uint8_t file_data[ 1024 ];
+
+	libbfio_handle_t *file_io_handle                        = NULL;
+	libcerror_error_t *error                                = NULL;
+	libfdata_list_t *non_summary_bucket_list                = NULL;
+	libfdata_list_t *summary_bucket_list                    = NULL;
+	libnsfdb_io_handle_t *io_handle                         = NULL;
+	libnsfdb_rrv_bucket_descriptor_t *rrv_bucket_descriptor = NULL;
+	int abort                                               = 0;
+	int number_of_elements                                  = 0;
+	int number_of_entries                                   = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = nsfdb_test_recovery_file_data_initialize(
+	          file_data );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->rrv_bucket_size = 64;
+
+	result = nsfdb_test_recovery_bucket_lists_initialize(
+	          &summary_bucket_list,
+	          &non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          1024,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the file is smaller than a scan block
+	 * hence it is scanned by a single segment
+	 */
+	result = libnsfdb_recovery_scan_file(
+	          io_handle,
+	          file_io_handle,
+	          4,
+	          0,
+	          256,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_list_get_number_of_elements(
+	          summary_bucket_list,
+	          &number_of_elements,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 0 );
+
+	result = libfdata_list_get_number_of_elements(
+	          non_summary_bucket_list,
+	          &number_of_elements,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 0 );
+
+	result = libcdata_array_get_number_of_entries(
+	          io_handle->rrv_bucket_descriptors,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	result = libcdata_array_get_entry_by_index(
+	          io_handle->rrv_bucket_descriptors,
+	          0,
+	          (intptr_t **) &rrv_bucket_descriptor,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "rrv_bucket_descriptor",
+	 rrv_bucket_descriptor );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT64(
+	 "rrv_bucket_descriptor->file_offset",
+	 (int64_t) rrv_bucket_descriptor->file_offset,
+	 (int64_t) 256 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "rrv_bucket_descriptor->initial_rrv_identifier",
+	 rrv_bucket_descriptor->initial_rrv_identifier,
+	 (uint32_t) 0x00000100UL );
+
+	/* Test with a file that is truncated inside the RRV bucket
+	 */
+	result = nsfdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          288,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_recovery_scan_file(
+	          io_handle,
+	          file_io_handle,
+	          1,
+	          0,
+	          256,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          io_handle->rrv_bucket_descriptors,
+	          &number_of_entries,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_recovery_scan_file(
+	          NULL,
+	          file_io_handle,
+	          1,
+	          0,
+	          256,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_scan_file(
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          0,
+	          256,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_scan_file(
+	          io_handle,
+	          file_io_handle,
+	          LIBNSFDB_MAXIMUM_NUMBER_OF_RECOVERY_THREADS + 1,
+	          0,
+	          256,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &abort,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_recovery_scan_file(
+	          io_handle,
+	          file_io_handle,
+	          1,
+	          0,
+	          256,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with abort signalled
+	 */
+	abort = 1;
+
+	result = libnsfdb_recovery_scan_file(
+	          io_handle,
+	          file_io_handle,
+	          1,
+	          0,
+	          256,
+	          summary_bucket_list,
+	          non_summary_bucket_list,
+	          &abort,
+	          &error );
+
+	abort = 0;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = nsfdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_recovery_bucket_lists_free(
+	          &summary_bucket_list,
+	          &non_summary_bucket_list,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		nsfdb_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	nsfdb_test_recovery_bucket_lists_free(
+	 &summary_bucket_list,
+	 &non_summary_bucket_list,
+	 NULL );
+
+	if( io_handle != NULL )
+	{
+		libnsfdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_recovery_segment_append_structure",
+	 nsfdb_test_recovery_segment_append_structure );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_recovery_check_bucket",
+	 nsfdb_test_recovery_check_bucket );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_recovery_check_rrv_bucket",
+	 nsfdb_test_recovery_check_rrv_bucket );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_recovery_scan_segment",
+	 nsfdb_test_recovery_scan_segment );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_recovery_free_segments",
+	 nsfdb_test_recovery_free_segments );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_recovery_rebuild",
+	 nsfdb_test_recovery_rebuild );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_recovery_scan_file",
+	 nsfdb_test_recovery_scan_file );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
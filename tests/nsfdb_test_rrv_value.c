@@ -75,6 +75,87 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libnsfdb_rrv_value_set_bucket_data_range function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_rrv_value_set_bucket_data_range(
+     void )
+{
+	libnsfdb_rrv_value_t rrv_value;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_rrv_value_set_bucket_data_range(
+	          &rrv_value,
+	          3,
+	          0x0142,
+	          512,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "rrv_value.type",
+	 rrv_value.type,
+	 LIBNSFDB_RRV_VALUE_TYPE_BUCKET_DATA_RANGE );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "rrv_value.bucket_index",
+	 rrv_value.bucket_index,
+	 (uint32_t) 3 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "rrv_value.data_offset",
+	 rrv_value.data_offset,
+	 (uint32_t) 0x0142 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "rrv_value.data_size",
+	 rrv_value.data_size,
+	 (uint32_t) 512 );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_rrv_value_set_bucket_data_range(
+	          NULL,
+	          3,
+	          0x0142,
+	          512,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
 
 /* The main program
@@ -104,6 +185,10 @@ int main(
 
 	/* TODO: add tests for libnsfdb_rrv_value_set_bucket_slot_identifier */
 
+	NSFDB_TEST_RUN(
+	 "libnsfdb_rrv_value_set_bucket_data_range",
+	 nsfdb_test_rrv_value_set_bucket_data_range );
+
 	/* TODO: add tests for libnsfdb_rrv_value_set_file_position */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
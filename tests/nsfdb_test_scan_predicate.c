@@ -0,0 +1,1065 @@
+/*
+ * Library scan_predicate type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_scan_predicate.h"
+
+uint8_t nsfdb_test_scan_predicate_text_data1[ 13 ] = {
+	0x00, 0x05, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64 };
+
+uint8_t nsfdb_test_scan_predicate_number_data1[ 10 ] = {
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x40 };
+
+uint8_t nsfdb_test_scan_predicate_time_data1[ 10 ] = {
+	0x00, 0x04, 0xef, 0xcd, 0xab, 0x89, 0x67, 0x45, 0x23, 0x01 };
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* Tests the libnsfdb_scan_predicate_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_scan_predicate_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libnsfdb_scan_predicate_t *scan_predicate = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_scan_predicate_initialize(
+	          &scan_predicate,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_free(
+	          &scan_predicate,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_scan_predicate_initialize(
+	          NULL,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_predicate = (libnsfdb_scan_predicate_t *) 0x12345678UL;
+
+	result = libnsfdb_scan_predicate_initialize(
+	          &scan_predicate,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+	          &error );
+
+	scan_predicate = NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_scan_predicate_initialize(
+	          &scan_predicate,
+	          -1,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_scan_predicate_initialize(
+	          &scan_predicate,
+	          0,
+	          0xff,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_scan_predicate_initialize with malloc failing
+		 */
+		nsfdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libnsfdb_scan_predicate_initialize(
+		          &scan_predicate,
+		          0,
+		          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+		          &error );
+
+		if( nsfdb_test_malloc_attempts_before_fail != -1 )
+		{
+			nsfdb_test_malloc_attempts_before_fail = -1;
+
+			if( scan_predicate != NULL )
+			{
+				libnsfdb_scan_predicate_free(
+				 &scan_predicate,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "scan_predicate",
+			 scan_predicate );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_scan_predicate_initialize with memset failing
+		 */
+		nsfdb_test_memset_attempts_before_fail = test_number;
+
+		result = libnsfdb_scan_predicate_initialize(
+		          &scan_predicate,
+		          0,
+		          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+		          &error );
+
+		if( nsfdb_test_memset_attempts_before_fail != -1 )
+		{
+			nsfdb_test_memset_attempts_before_fail = -1;
+
+			if( scan_predicate != NULL )
+			{
+				libnsfdb_scan_predicate_free(
+				 &scan_predicate,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "scan_predicate",
+			 scan_predicate );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_NSFDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_predicate != NULL )
+	{
+		libnsfdb_scan_predicate_free(
+		 &scan_predicate,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_scan_predicate_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_scan_predicate_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_scan_predicate_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_scan_predicate_match_value_data function with text predicates
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_scan_predicate_match_text(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libnsfdb_scan_predicate_t *scan_predicate = NULL;
+	int result                                = 0;
+
+	/* Test text equals
+	 */
+	result = libnsfdb_scan_predicate_initialize(
+	          &scan_predicate,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_EQUALS,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the text is not set
+	 */
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_text_data1,
+	          13,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_scan_predicate_set_text(
+	          scan_predicate,
+	          (uint8_t *) "hello",
+	          5,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_text_data1,
+	          13,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_text_data1,
+	          7,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_scan_predicate_set_text(
+	          scan_predicate,
+	          (uint8_t *) "hello",
+	          5,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_scan_predicate_set_number_range(
+	          scan_predicate,
+	          0.0,
+	          1.0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          NULL,
+	          13,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_scan_predicate_free(
+	          &scan_predicate,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test text prefix
+	 */
+	result = libnsfdb_scan_predicate_initialize(
+	          &scan_predicate,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_PREFIX,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_set_text(
+	          scan_predicate,
+	          (uint8_t *) "hello",
+	          5,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_text_data1,
+	          13,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_text_data1,
+	          6,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a value that is not text
+	 */
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_number_data1,
+	          10,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_free(
+	          &scan_predicate,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test text contains
+	 */
+	result = libnsfdb_scan_predicate_initialize(
+	          &scan_predicate,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TEXT_CONTAINS,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_set_text(
+	          scan_predicate,
+	          (uint8_t *) "world",
+	          5,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_text_data1,
+	          13,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_text_data1,
+	          12,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_free(
+	          &scan_predicate,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_predicate != NULL )
+	{
+		libnsfdb_scan_predicate_free(
+		 &scan_predicate,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_scan_predicate_match_value_data function with range predicates
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_scan_predicate_match_range(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libnsfdb_scan_predicate_t *scan_predicate = NULL;
+	int result                                = 0;
+
+	/* Test number range
+	 */
+	result = libnsfdb_scan_predicate_initialize(
+	          &scan_predicate,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_NUMBER_RANGE,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_set_number_range(
+	          scan_predicate,
+	          10.0,
+	          42.0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_number_data1,
+	          10,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a value that is not a number
+	 */
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_time_data1,
+	          10,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a value that is too small
+	 */
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_number_data1,
+	          9,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_scan_predicate_set_number_range(
+	          scan_predicate,
+	          42.0,
+	          10.0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a range that does not contain the value
+	 */
+	result = libnsfdb_scan_predicate_set_number_range(
+	          scan_predicate,
+	          42.5,
+	          100.0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_number_data1,
+	          10,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_free(
+	          &scan_predicate,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test time range
+	 */
+	result = libnsfdb_scan_predicate_initialize(
+	          &scan_predicate,
+	          0,
+	          LIBNSFDB_SCAN_PREDICATE_TYPE_TIME_RANGE,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_set_time_range(
+	          scan_predicate,
+	          0x0023456789abcdefULL,
+	          0x0023456789abcdefULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_time_data1,
+	          10,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_set_time_range(
+	          scan_predicate,
+	          0x0000000000000000ULL,
+	          0x0023456789abcdeeULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_scan_predicate_match_value_data(
+	          scan_predicate,
+	          nsfdb_test_scan_predicate_time_data1,
+	          10,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_scan_predicate_set_time_range(
+	          scan_predicate,
+	          0x0000000000000002ULL,
+	          0x0000000000000001ULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_scan_predicate_set_text(
+	          scan_predicate,
+	          (uint8_t *) "hello",
+	          5,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_scan_predicate_free(
+	          &scan_predicate,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "scan_predicate",
+	 scan_predicate );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_predicate != NULL )
+	{
+		libnsfdb_scan_predicate_free(
+		 &scan_predicate,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_scan_predicate_initialize",
+	 nsfdb_test_scan_predicate_initialize );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_scan_predicate_free",
+	 nsfdb_test_scan_predicate_free );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_scan_predicate_match_text",
+	 nsfdb_test_scan_predicate_match_text );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_scan_predicate_match_range",
+	 nsfdb_test_scan_predicate_match_range );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
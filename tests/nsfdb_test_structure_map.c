@@ -0,0 +1,795 @@
+/*
+ * Library structure_map type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libbfio.h"
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_structure_map.h"
+
+/* Tests the libnsfdb_structure_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_structure_map_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libnsfdb_structure_map_t *structure_map = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int number_of_memset_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_structure_map_initialize(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "structure_map",
+	 structure_map );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_structure_map_free(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "structure_map",
+	 structure_map );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_structure_map_initialize(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	structure_map = (libnsfdb_structure_map_t *) 0x12345678UL;
+
+	result = libnsfdb_structure_map_initialize(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	structure_map = NULL;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_structure_map_initialize with malloc failing
+		 */
+		nsfdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libnsfdb_structure_map_initialize(
+		          &structure_map,
+		          &error );
+
+		if( nsfdb_test_malloc_attempts_before_fail != -1 )
+		{
+			nsfdb_test_malloc_attempts_before_fail = -1;
+
+			if( structure_map != NULL )
+			{
+				libnsfdb_structure_map_free(
+				 &structure_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "structure_map",
+			 structure_map );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_structure_map_initialize with memset failing
+		 */
+		nsfdb_test_memset_attempts_before_fail = test_number;
+
+		result = libnsfdb_structure_map_initialize(
+		          &structure_map,
+		          &error );
+
+		if( nsfdb_test_memset_attempts_before_fail != -1 )
+		{
+			nsfdb_test_memset_attempts_before_fail = -1;
+
+			if( structure_map != NULL )
+			{
+				libnsfdb_structure_map_free(
+				 &structure_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "structure_map",
+			 structure_map );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_NSFDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( structure_map != NULL )
+	{
+		libnsfdb_structure_map_free(
+		 &structure_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_structure_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_structure_map_free(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	int result                              = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_structure_map_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_structure_map_get_number_of_structures function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_structure_map_get_number_of_structures(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libnsfdb_structure_map_t *structure_map = NULL;
+	int number_of_structures                = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_structure_map_initialize(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "structure_map",
+	 structure_map );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_structure_map_get_number_of_structures(
+	          structure_map,
+	          &number_of_structures,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_structures",
+	 number_of_structures,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_structure_map_get_number_of_structures(
+	          NULL,
+	          &number_of_structures,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_structure_map_get_number_of_structures(
+	          structure_map,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_structure_map_free(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "structure_map",
+	 structure_map );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( structure_map != NULL )
+	{
+		libnsfdb_structure_map_free(
+		 &structure_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_structure_map_get_structure function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_structure_map_get_structure(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libnsfdb_structure_map_t *structure_map = NULL;
+	off64_t file_offset                     = 0;
+	size64_t size                           = 0;
+	uint8_t structure_type                  = 0;
+	int copy_number                         = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_structure_map_initialize(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "structure_map",
+	 structure_map );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_structure_map_get_structure(
+	          NULL,
+	          0,
+	          &structure_type,
+	          &copy_number,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* An empty structure map has no structures
+	 */
+	result = libnsfdb_structure_map_get_structure(
+	          structure_map,
+	          0,
+	          &structure_type,
+	          &copy_number,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_structure_map_free(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "structure_map",
+	 structure_map );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( structure_map != NULL )
+	{
+		libnsfdb_structure_map_free(
+		 &structure_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_structure_map_check_structure function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_structure_map_check_structure(
+     void )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libcerror_error_t *error                = NULL;
+	libnsfdb_structure_map_t *structure_map = NULL;
+	size64_t number_of_bytes                = 0;
+	uint32_t calculated_checksum            = 0;
+	uint32_t stored_checksum                = 0;
+	uint8_t problem                         = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_structure_map_initialize(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "structure_map",
+	 structure_map );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_structure_map_check_structure(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &problem,
+	          &stored_checksum,
+	          &calculated_checksum,
+	          &number_of_bytes,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* An empty structure map has no structures to check
+	 */
+	result = libnsfdb_structure_map_check_structure(
+	          structure_map,
+	          file_io_handle,
+	          0,
+	          &problem,
+	          &stored_checksum,
+	          &calculated_checksum,
+	          &number_of_bytes,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_structure_map_free(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "structure_map",
+	 structure_map );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( structure_map != NULL )
+	{
+		libnsfdb_structure_map_free(
+		 &structure_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_structure_map_get_superblock_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_structure_map_get_superblock_data_size(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libnsfdb_structure_map_t *structure_map = NULL;
+	size_t compressed_data_size             = 0;
+	size_t uncompressed_data_size           = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_structure_map_initialize(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "structure_map",
+	 structure_map );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_structure_map_get_superblock_data_size(
+	          structure_map,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_structure_map_get_superblock_data_size(
+	          NULL,
+	          &compressed_data_size,
+	          &uncompressed_data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_structure_map_get_superblock_data_size(
+	          structure_map,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_structure_map_free(
+	          &structure_map,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "structure_map",
+	 structure_map );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( structure_map != NULL )
+	{
+		libnsfdb_structure_map_free(
+		 &structure_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_structure_map_initialize",
+	 nsfdb_test_structure_map_initialize );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_structure_map_free",
+	 nsfdb_test_structure_map_free );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_structure_map_get_number_of_structures",
+	 nsfdb_test_structure_map_get_number_of_structures );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_structure_map_get_structure",
+	 nsfdb_test_structure_map_get_structure );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_structure_map_check_structure",
+	 nsfdb_test_structure_map_check_structure );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_structure_map_get_superblock_data_size",
+	 nsfdb_test_structure_map_get_superblock_data_size );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
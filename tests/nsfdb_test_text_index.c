@@ -0,0 +1,1247 @@
+/*
+ * Library text_index type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_libnsfdb.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_memory.h"
+#include "nsfdb_test_unused.h"
+
+#include "../libnsfdb/libnsfdb_text_index.h"
+
+uint8_t nsfdb_test_text_index_text1[ 28 ] = {
+	'T', 'h', 'e', ' ', 'Q', 'u', 'i', 'c', 'k', ',', ' ', 'b', 'r', 'o', 'w', 'n',
+	' ', 'f', 'o', 'x', ' ', '4', '2', ' ', 't', 'h', 'e', '.' };
+
+uint8_t nsfdb_test_text_index_text2[ 14 ] = {
+	'L', 'a', 'z', 'y', ' ', 'b', 'r', 'o', 'w', 'n', ' ', 'd', 'o', 'g' };
+
+/* Tests the libnsfdb_text_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_text_index_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libnsfdb_text_index_t *text_index = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 2;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_text_index_initialize(
+	          &text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "text_index",
+	 text_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_text_index_free(
+	          &text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "text_index",
+	 text_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_text_index_initialize(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	text_index = (libnsfdb_text_index_t *) 0x12345678UL;
+
+	result = libnsfdb_text_index_initialize(
+	          &text_index,
+	          &error );
+
+	text_index = NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_NSFDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_text_index_initialize with malloc failing
+		 */
+		nsfdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libnsfdb_text_index_initialize(
+		          &text_index,
+		          &error );
+
+		if( nsfdb_test_malloc_attempts_before_fail != -1 )
+		{
+			nsfdb_test_malloc_attempts_before_fail = -1;
+
+			if( text_index != NULL )
+			{
+				libnsfdb_text_index_free(
+				 &text_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "text_index",
+			 text_index );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libnsfdb_text_index_initialize with memset failing
+		 */
+		nsfdb_test_memset_attempts_before_fail = test_number;
+
+		result = libnsfdb_text_index_initialize(
+		          &text_index,
+		          &error );
+
+		if( nsfdb_test_memset_attempts_before_fail != -1 )
+		{
+			nsfdb_test_memset_attempts_before_fail = -1;
+
+			if( text_index != NULL )
+			{
+				libnsfdb_text_index_free(
+				 &text_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			NSFDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			NSFDB_TEST_ASSERT_IS_NULL(
+			 "text_index",
+			 text_index );
+
+			NSFDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_NSFDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( text_index != NULL )
+	{
+		libnsfdb_text_index_free(
+		 &text_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_text_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_text_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libnsfdb_text_index_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+/* Tests the libnsfdb_text_index_copy_varint_to_data and libnsfdb_text_index_copy_varint_from_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_text_index_copy_varint(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	uint32_t values[ 5 ]     = { 0, 127, 128, 16384, 0xffffffffUL };
+	size_t sizes[ 5 ]        = { 1, 1, 2, 3, 5 };
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	uint32_t value           = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		data_offset = 0;
+
+		result = libnsfdb_text_index_copy_varint_to_data(
+		          values[ value_index ],
+		          data,
+		          16,
+		          &data_offset,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_EQUAL_SIZE(
+		 "data_offset",
+		 data_offset,
+		 sizes[ value_index ] );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_offset = 0;
+
+		result = libnsfdb_text_index_copy_varint_from_data(
+		          data,
+		          16,
+		          &data_offset,
+		          &value,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_EQUAL_UINT32(
+		 "value",
+		 value,
+		 values[ value_index ] );
+
+		NSFDB_TEST_ASSERT_EQUAL_SIZE(
+		 "data_offset",
+		 data_offset,
+		 sizes[ value_index ] );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	data_offset = 0;
+
+	result = libnsfdb_text_index_copy_varint_to_data(
+	          0xffffffffUL,
+	          data,
+	          4,
+	          &data_offset,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a value that is not terminated
+	 */
+	data[ 0 ]   = 0x80;
+	data[ 1 ]   = 0x80;
+	data_offset = 0;
+
+	result = libnsfdb_text_index_copy_varint_from_data(
+	          data,
+	          2,
+	          &data_offset,
+	          &value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a value that exceeds 32-bit
+	 */
+	data[ 0 ]   = 0xff;
+	data[ 1 ]   = 0xff;
+	data[ 2 ]   = 0xff;
+	data[ 3 ]   = 0xff;
+	data[ 4 ]   = 0x1f;
+	data_offset = 0;
+
+	result = libnsfdb_text_index_copy_varint_from_data(
+	          data,
+	          5,
+	          &data_offset,
+	          &value,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_text_index_get_next_term function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_text_index_get_next_term(
+     void )
+{
+	uint8_t term_data[ 8 ];
+
+	libcerror_error_t *error = NULL;
+	size_t term_size         = 0;
+	size_t text_offset       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_text_index_get_next_term(
+	          nsfdb_test_text_index_text1,
+	          28,
+	          &text_offset,
+	          term_data,
+	          8,
+	          &term_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "term_size",
+	 term_size,
+	 (size_t) 3 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          term_data,
+	          "the",
+	          3 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libnsfdb_text_index_get_next_term(
+	          nsfdb_test_text_index_text1,
+	          28,
+	          &text_offset,
+	          term_data,
+	          8,
+	          &term_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "term_size",
+	 term_size,
+	 (size_t) 5 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          term_data,
+	          "quick",
+	          5 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a term that is truncated
+	 */
+	text_offset = 0;
+
+	result = libnsfdb_text_index_get_next_term(
+	          nsfdb_test_text_index_text1,
+	          28,
+	          &text_offset,
+	          term_data,
+	          2,
+	          &term_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "term_size",
+	 term_size,
+	 (size_t) 2 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "text_offset",
+	 text_offset,
+	 (size_t) 3 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test text without terms
+	 */
+	text_offset = 0;
+
+	result = libnsfdb_text_index_get_next_term(
+	          (uint8_t *) " ,.",
+	          3,
+	          &text_offset,
+	          term_data,
+	          8,
+	          &term_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_text_index_get_next_term(
+	          NULL,
+	          28,
+	          &text_offset,
+	          term_data,
+	          8,
+	          &term_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_text_index_get_next_term(
+	          nsfdb_test_text_index_text1,
+	          28,
+	          &text_offset,
+	          term_data,
+	          0,
+	          &term_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_text_index_search function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_text_index_search(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libnsfdb_text_index_t *text_index = NULL;
+	uint32_t note_identifier          = 0;
+	int number_of_note_identifiers    = 0;
+	int number_of_terms               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_text_index_initialize(
+	          &text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "text_index",
+	 text_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The notes are read out of order to test the sorting of the note identifiers
+	 */
+	result = libnsfdb_text_index_read_text(
+	          (libnsfdb_internal_text_index_t *) text_index,
+	          nsfdb_test_text_index_text2,
+	          14,
+	          0x00000112UL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_text_index_read_text(
+	          (libnsfdb_internal_text_index_t *) text_index,
+	          nsfdb_test_text_index_text1,
+	          28,
+	          0x0000010eUL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_text_index_get_number_of_terms(
+	          text_index,
+	          &number_of_terms,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_terms",
+	 number_of_terms,
+	 7 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_text_index_search(
+	          text_index,
+	          (uint8_t *) "BROWN",
+	          5,
+	          &number_of_note_identifiers,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_note_identifiers",
+	 number_of_note_identifiers,
+	 2 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_text_index_get_search_note_identifier(
+	          text_index,
+	          0,
+	          &note_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_identifier",
+	 note_identifier,
+	 (uint32_t) 0x0000010eUL );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_text_index_search(
+	          text_index,
+	          (uint8_t *) "brown dog",
+	          9,
+	          &number_of_note_identifiers,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_note_identifiers",
+	 number_of_note_identifiers,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_text_index_get_search_note_identifier(
+	          text_index,
+	          0,
+	          &note_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_identifier",
+	 note_identifier,
+	 (uint32_t) 0x00000112UL );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_text_index_search(
+	          text_index,
+	          (uint8_t *) "fox cat",
+	          7,
+	          &number_of_note_identifiers,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_note_identifiers",
+	 number_of_note_identifiers,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_text_index_search(
+	          NULL,
+	          (uint8_t *) "fox",
+	          3,
+	          &number_of_note_identifiers,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libnsfdb_text_index_get_search_note_identifier(
+	          text_index,
+	          0,
+	          &note_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libnsfdb_text_index_free(
+	          &text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "text_index",
+	 text_index );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( text_index != NULL )
+	{
+		libnsfdb_text_index_free(
+		 &text_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libnsfdb_text_index_write_data, libnsfdb_text_index_read_data and libnsfdb_text_index_merge functions
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_text_index_write_data(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libnsfdb_text_index_t *read_text_index   = NULL;
+	libnsfdb_text_index_t *source_text_index = NULL;
+	libnsfdb_text_index_t *text_index        = NULL;
+	uint8_t *data                            = NULL;
+	size_t data_size                         = 0;
+	uint32_t note_identifier                 = 0;
+	int number_of_note_identifiers           = 0;
+	int number_of_terms                      = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libnsfdb_text_index_initialize(
+	          &text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_text_index_initialize(
+	          &source_text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_text_index_initialize(
+	          &read_text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_text_index_read_text(
+	          (libnsfdb_internal_text_index_t *) text_index,
+	          nsfdb_test_text_index_text1,
+	          28,
+	          0x00000106UL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_text_index_read_text(
+	          (libnsfdb_internal_text_index_t *) source_text_index,
+	          nsfdb_test_text_index_text2,
+	          14,
+	          0x00012345UL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libnsfdb_text_index_merge(
+	          text_index,
+	          source_text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_text_index_write_data(
+	          (libnsfdb_internal_text_index_t *) text_index,
+	          &data,
+	          &data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_text_index_read_data(
+	          (libnsfdb_internal_text_index_t *) read_text_index,
+	          data,
+	          data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libnsfdb_text_index_get_number_of_terms(
+	          read_text_index,
+	          &number_of_terms,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_terms",
+	 number_of_terms,
+	 7 );
+
+	result = libnsfdb_text_index_search(
+	          read_text_index,
+	          (uint8_t *) "brown",
+	          5,
+	          &number_of_note_identifiers,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_note_identifiers",
+	 number_of_note_identifiers,
+	 2 );
+
+	result = libnsfdb_text_index_get_search_note_identifier(
+	          read_text_index,
+	          1,
+	          &note_identifier,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT32(
+	 "note_identifier",
+	 note_identifier,
+	 (uint32_t) 0x00012345UL );
+
+	/* Test error cases
+	 */
+	result = libnsfdb_text_index_merge(
+	          text_index,
+	          text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data with an invalid checksum
+	 */
+	data[ data_size - 1 ] ^= 0xff;
+
+	result = libnsfdb_text_index_read_data(
+	          (libnsfdb_internal_text_index_t *) source_text_index,
+	          data,
+	          data_size,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data that is too small
+	 */
+	result = libnsfdb_text_index_read_data(
+	          (libnsfdb_internal_text_index_t *) source_text_index,
+	          data,
+	          8,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libnsfdb_text_index_free(
+	          &read_text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_text_index_free(
+	          &source_text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libnsfdb_text_index_free(
+	          &text_index,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( read_text_index != NULL )
+	{
+		libnsfdb_text_index_free(
+		 &read_text_index,
+		 NULL );
+	}
+	if( source_text_index != NULL )
+	{
+		libnsfdb_text_index_free(
+		 &source_text_index,
+		 NULL );
+	}
+	if( text_index != NULL )
+	{
+		libnsfdb_text_index_free(
+		 &text_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_text_index_initialize",
+	 nsfdb_test_text_index_initialize );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_text_index_free",
+	 nsfdb_test_text_index_free );
+
+#if defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT )
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_text_index_copy_varint",
+	 nsfdb_test_text_index_copy_varint );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_text_index_get_next_term",
+	 nsfdb_test_text_index_get_next_term );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_text_index_search",
+	 nsfdb_test_text_index_search );
+
+	NSFDB_TEST_RUN(
+	 "libnsfdb_text_index_write_data",
+	 nsfdb_test_text_index_write_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBNSFDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
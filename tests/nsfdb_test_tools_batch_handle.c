@@ -0,0 +1,664 @@
+/*
+ * Tools batch handle functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_unused.h"
+
+#include "../nsfdbtools/batch_handle.h"
+
+/* The source filenames, the files do not need to exist
+ */
+#if defined( WINAPI )
+#define NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME1		"first\\mail.nsf"
+#define NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME2		"first\\mail.nsf.bak"
+#define NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME3		"second\\names.nsf"
+#define NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME4		"second\\mail.nsf"
+#else
+#define NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME1		"first/mail.nsf"
+#define NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME2		"first/mail.nsf.bak"
+#define NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME3		"second/names.nsf"
+#define NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME4		"second/mail.nsf"
+#endif
+
+/* Tests the batch_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_batch_handle_initialize(
+     void )
+{
+	batch_handle_t *batch_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = batch_handle_free(
+	          &batch_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = batch_handle_initialize(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch_handle = (batch_handle_t *) 0x12345678UL;
+
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          &error );
+
+	batch_handle = NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &batch_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the batch_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_batch_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = batch_handle_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the batch_handle_append_file function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_batch_handle_append_file(
+     void )
+{
+	batch_handle_t *batch_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	size_t filename_length       = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	filename_length = narrow_string_length(
+	                   NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME1 );
+
+	result = batch_handle_append_file(
+	          batch_handle,
+	          NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME1,
+	          filename_length,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "batch_handle->number_of_files",
+	 batch_handle->number_of_files,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "batch_handle->files[ 0 ]->filename_size",
+	 batch_handle->files[ 0 ]->filename_size,
+	 filename_length + 1 );
+
+	result = narrow_string_compare(
+	          batch_handle->files[ 0 ]->filename,
+	          NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME1,
+	          filename_length + 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The name is the part of the filename after the last path separator
+	 */
+	result = narrow_string_compare(
+	          batch_handle->files[ 0 ]->name,
+	          "mail.nsf",
+	          9 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A file that does not exist is reported when it is processed
+	 */
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "batch_handle->files[ 0 ]->file_size",
+	 (uint64_t) batch_handle->files[ 0 ]->file_size,
+	 (uint64_t) 0 );
+
+	/* Test a filename without a path separator
+	 */
+	result = batch_handle_append_file(
+	          batch_handle,
+	          "names.nsf",
+	          9,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "batch_handle->number_of_files",
+	 batch_handle->number_of_files,
+	 2 );
+
+	result = narrow_string_compare(
+	          batch_handle->files[ 1 ]->name,
+	          "names.nsf",
+	          10 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = batch_handle_append_file(
+	          NULL,
+	          NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME1,
+	          filename_length,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = batch_handle_append_file(
+	          batch_handle,
+	          NULL,
+	          filename_length,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = batch_handle_append_file(
+	          batch_handle,
+	          NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME1,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "batch_handle->number_of_files",
+	 batch_handle->number_of_files,
+	 2 );
+
+	/* Clean up
+	 */
+	result = batch_handle_free(
+	          &batch_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &batch_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the batch_handle_check_unique_names function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_batch_handle_check_unique_names(
+     void )
+{
+	batch_handle_t *batch_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = batch_handle_initialize(
+	          &batch_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	batch_handle->notify_stream = stdout;
+
+	/* Test without source files
+	 */
+	result = batch_handle_check_unique_names(
+	          batch_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test names that are unique, including a name that is the start of another name
+	 */
+	result = batch_handle_append_file(
+	          batch_handle,
+	          NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME1,
+	          narrow_string_length(
+	           NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME1 ),
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = batch_handle_check_unique_names(
+	          batch_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = batch_handle_append_file(
+	          batch_handle,
+	          NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME2,
+	          narrow_string_length(
+	           NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME2 ),
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = batch_handle_append_file(
+	          batch_handle,
+	          NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME3,
+	          narrow_string_length(
+	           NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME3 ),
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = batch_handle_check_unique_names(
+	          batch_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name that is the same as that of a source file in another directory
+	 */
+	result = batch_handle_append_file(
+	          batch_handle,
+	          NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME4,
+	          narrow_string_length(
+	           NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME4 ),
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = batch_handle_check_unique_names(
+	          batch_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The order of the source files is not changed by the check
+	 */
+	result = narrow_string_compare(
+	          batch_handle->files[ 3 ]->filename,
+	          NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME4,
+	          narrow_string_length(
+	           NSFDB_TEST_TOOLS_BATCH_HANDLE_FILENAME4 ) + 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = batch_handle_check_unique_names(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = batch_handle_free(
+	          &batch_handle,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "batch_handle",
+	 batch_handle );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch_handle != NULL )
+	{
+		batch_handle_free(
+		 &batch_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	NSFDB_TEST_RUN(
+	 "batch_handle_initialize",
+	 nsfdb_test_tools_batch_handle_initialize );
+
+	NSFDB_TEST_RUN(
+	 "batch_handle_free",
+	 nsfdb_test_tools_batch_handle_free );
+
+	NSFDB_TEST_RUN(
+	 "batch_handle_append_file",
+	 nsfdb_test_tools_batch_handle_append_file );
+
+	NSFDB_TEST_RUN(
+	 "batch_handle_check_unique_names",
+	 nsfdb_test_tools_batch_handle_check_unique_names );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1100 @@
+/*
+ * Tools blob store functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_unused.h"
+
+#include "../nsfdbtools/blob_store.h"
+#include "../nsfdbtools/nsfdbtools_libcfile.h"
+#include "../nsfdbtools/sha256_context.h"
+
+/* The blob store directory is created in the current working directory
+ * the blob of "abc" is stored in the subdirectory named after the first
+ * 2 hexadecimal digits of its SHA-256 hash
+ */
+#define NSFDB_TEST_TOOLS_BLOB_STORE_PATH		_SYSTEM_STRING( "nsfdb_test_tools_blob_store.blobs" )
+
+#if defined( WINAPI )
+#define NSFDB_TEST_TOOLS_BLOB_STORE_SUBDIRECTORY	_SYSTEM_STRING( "nsfdb_test_tools_blob_store.blobs\\ba" )
+#define NSFDB_TEST_TOOLS_BLOB_STORE_BLOB_FILENAME	_SYSTEM_STRING( "nsfdb_test_tools_blob_store.blobs\\ba\\ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" )
+#else
+#define NSFDB_TEST_TOOLS_BLOB_STORE_SUBDIRECTORY	_SYSTEM_STRING( "nsfdb_test_tools_blob_store.blobs/ba" )
+#define NSFDB_TEST_TOOLS_BLOB_STORE_BLOB_FILENAME	_SYSTEM_STRING( "nsfdb_test_tools_blob_store.blobs/ba/ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" )
+#endif
+
+/* The SHA-256 hash of "abc"
+ */
+uint8_t nsfdb_test_tools_blob_store_abc_hash[ 32 ] = {
+	0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+	0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad };
+
+/* Determines if a file or directory exists
+ * Returns 1 if it exists, 0 if not or -1 on error
+ */
+int nsfdb_test_tools_blob_store_exists(
+     const system_character_t *path )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	return( libcfile_file_exists_wide(
+	         path,
+	         NULL ) );
+#else
+	return( libcfile_file_exists(
+	         path,
+	         NULL ) );
+#endif
+}
+
+/* Removes a file
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_tools_blob_store_remove_file(
+     const system_character_t *filename )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	return( libcfile_file_remove_wide(
+	         filename,
+	         NULL ) );
+#else
+	return( libcfile_file_remove(
+	         filename,
+	         NULL ) );
+#endif
+}
+
+/* Removes an empty directory
+ * Returns 1 if successful or -1 on error
+ */
+int nsfdb_test_tools_blob_store_remove_directory(
+     const system_character_t *path )
+{
+#if defined( WINAPI ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( RemoveDirectoryW(
+	     (LPCWSTR) path ) == 0 )
+#elif defined( WINAPI )
+	if( RemoveDirectoryA(
+	     (LPCSTR) path ) == 0 )
+#else
+	if( rmdir(
+	     path ) != 0 )
+#endif
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the blob_store_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_blob_store_initialize(
+     void )
+{
+	blob_store_t *blob_store = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = blob_store_initialize(
+	          &blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "blob_store",
+	 blob_store );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = blob_store_free(
+	          &blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "blob_store",
+	 blob_store );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = blob_store_initialize(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	blob_store = (blob_store_t *) 0x12345678UL;
+
+	result = blob_store_initialize(
+	          &blob_store,
+	          &error );
+
+	blob_store = NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( blob_store != NULL )
+	{
+		blob_store_free(
+		 &blob_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the blob_store_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_blob_store_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = blob_store_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the blob_store_open function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_blob_store_open(
+     void )
+{
+	blob_store_t *blob_store = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = blob_store_initialize(
+	          &blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "blob_store",
+	 blob_store );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = blob_store_open(
+	          NULL,
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_open(
+	          blob_store,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_open(
+	          blob_store,
+	          _SYSTEM_STRING( "" ),
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases, the directory is created when it does not exist
+	 */
+	result = nsfdb_test_tools_blob_store_exists(
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = blob_store_open(
+	          blob_store,
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_tools_blob_store_exists(
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error case where the blob store is already open
+	 */
+	result = blob_store_open(
+	          blob_store,
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = blob_store_free(
+	          &blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "blob_store",
+	 blob_store );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An existing directory can be opened
+	 */
+	result = blob_store_initialize(
+	          &blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = blob_store_open(
+	          blob_store,
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = blob_store_free(
+	          &blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_tools_blob_store_remove_directory(
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( blob_store != NULL )
+	{
+		blob_store_free(
+		 &blob_store,
+		 NULL );
+	}
+	nsfdb_test_tools_blob_store_remove_directory(
+	 NSFDB_TEST_TOOLS_BLOB_STORE_PATH );
+
+	return( 0 );
+}
+
+/* Tests the blob_store_write_blob function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_blob_store_write_blob(
+     void )
+{
+	uint8_t hash[ SHA256_HASH_SIZE ];
+
+	blob_store_t *blob_store = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = blob_store_initialize(
+	          &blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "blob_store",
+	 blob_store );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = blob_store_open(
+	          blob_store,
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the blob is stored under its SHA-256 hash
+	 */
+	result = blob_store_write_blob(
+	          blob_store,
+	          (uint8_t *) "abc",
+	          3,
+	          hash,
+	          SHA256_HASH_SIZE,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          nsfdb_test_tools_blob_store_abc_hash,
+	          SHA256_HASH_SIZE );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = system_string_compare(
+	          blob_store->blob_filename,
+	          NSFDB_TEST_TOOLS_BLOB_STORE_BLOB_FILENAME,
+	          blob_store->blob_filename_size );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = nsfdb_test_tools_blob_store_exists(
+	          NSFDB_TEST_TOOLS_BLOB_STORE_BLOB_FILENAME );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The temporary blob file was renamed into place
+	 */
+	result = nsfdb_test_tools_blob_store_exists(
+	          blob_store->temporary_blob_filename );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_stored_blobs",
+	 blob_store->number_of_stored_blobs,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "blob_store->stored_data_size",
+	 blob_store->stored_data_size,
+	 (uint64_t) 3 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_deduplicated_blobs",
+	 blob_store->number_of_deduplicated_blobs,
+	 0 );
+
+	/* Test that the same data is deduplicated
+	 */
+	result = blob_store_write_blob(
+	          blob_store,
+	          (uint8_t *) "abc",
+	          3,
+	          hash,
+	          SHA256_HASH_SIZE,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          hash,
+	          nsfdb_test_tools_blob_store_abc_hash,
+	          SHA256_HASH_SIZE );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_stored_blobs",
+	 blob_store->number_of_stored_blobs,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "blob_store->stored_data_size",
+	 blob_store->stored_data_size,
+	 (uint64_t) 3 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_deduplicated_blobs",
+	 blob_store->number_of_deduplicated_blobs,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "blob_store->deduplicated_data_size",
+	 blob_store->deduplicated_data_size,
+	 (uint64_t) 3 );
+
+	/* Test error cases
+	 */
+	result = blob_store_write_blob(
+	          NULL,
+	          (uint8_t *) "abc",
+	          3,
+	          hash,
+	          SHA256_HASH_SIZE,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_write_blob(
+	          blob_store,
+	          NULL,
+	          3,
+	          hash,
+	          SHA256_HASH_SIZE,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_write_blob(
+	          blob_store,
+	          (uint8_t *) "abc",
+	          (size_t) SSIZE_MAX + 1,
+	          hash,
+	          SHA256_HASH_SIZE,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_stored_blobs",
+	 blob_store->number_of_stored_blobs,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "blob_store->number_of_deduplicated_blobs",
+	 blob_store->number_of_deduplicated_blobs,
+	 1 );
+
+	/* Clean up
+	 */
+	result = blob_store_free(
+	          &blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "blob_store",
+	 blob_store );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_tools_blob_store_remove_file(
+	          NSFDB_TEST_TOOLS_BLOB_STORE_BLOB_FILENAME );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_tools_blob_store_remove_directory(
+	          NSFDB_TEST_TOOLS_BLOB_STORE_SUBDIRECTORY );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_tools_blob_store_remove_directory(
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( blob_store != NULL )
+	{
+		blob_store_free(
+		 &blob_store,
+		 NULL );
+	}
+	nsfdb_test_tools_blob_store_remove_file(
+	 NSFDB_TEST_TOOLS_BLOB_STORE_BLOB_FILENAME );
+
+	nsfdb_test_tools_blob_store_remove_directory(
+	 NSFDB_TEST_TOOLS_BLOB_STORE_SUBDIRECTORY );
+
+	nsfdb_test_tools_blob_store_remove_directory(
+	 NSFDB_TEST_TOOLS_BLOB_STORE_PATH );
+
+	return( 0 );
+}
+
+/* Tests the blob_store_create_temporary_file function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_blob_store_create_temporary_file(
+     void )
+{
+	system_character_t *temporary_blob_filename = NULL;
+	blob_store_t *blob_store                     = NULL;
+	libcerror_error_t *error                     = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = blob_store_initialize(
+	          &blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "blob_store",
+	 blob_store );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the blob store is not open
+	 */
+	result = blob_store_create_temporary_file(
+	          blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = blob_store_open(
+	          blob_store,
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = blob_store_set_blob_filenames(
+	          blob_store,
+	          nsfdb_test_tools_blob_store_abc_hash,
+	          SHA256_HASH_SIZE,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = blob_store_make_directory(
+	          NSFDB_TEST_TOOLS_BLOB_STORE_SUBDIRECTORY,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	temporary_blob_filename = system_string_allocate(
+	                           blob_store->temporary_blob_filename_size );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "temporary_blob_filename",
+	 temporary_blob_filename );
+
+	/* Test regular cases
+	 */
+	blob_store->random_value = 0x12345678UL;
+
+	result = blob_store_create_temporary_file(
+	          blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_tools_blob_store_exists(
+	          blob_store->temporary_blob_filename );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	if( memory_copy(
+	     temporary_blob_filename,
+	     blob_store->temporary_blob_filename,
+	     sizeof( system_character_t ) * blob_store->temporary_blob_filename_size ) == NULL )
+	{
+		goto on_error;
+	}
+
+	/* Test that an existing temporary file is not reused, the same pseudo random
+	 * value results in the same temporary blob filename on the first attempt
+	 */
+	blob_store->random_value = 0x12345678UL;
+
+	result = blob_store_create_temporary_file(
+	          blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          blob_store->temporary_blob_filename,
+	          temporary_blob_filename,
+	          blob_store->temporary_blob_filename_size );
+
+	NSFDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = nsfdb_test_tools_blob_store_exists(
+	          blob_store->temporary_blob_filename );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_tools_blob_store_remove_file(
+	          blob_store->temporary_blob_filename );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_tools_blob_store_remove_file(
+	          temporary_blob_filename );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = blob_store_create_temporary_file(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 temporary_blob_filename );
+
+	temporary_blob_filename = NULL;
+
+	result = blob_store_free(
+	          &blob_store,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "blob_store",
+	 blob_store );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = nsfdb_test_tools_blob_store_remove_directory(
+	          NSFDB_TEST_TOOLS_BLOB_STORE_SUBDIRECTORY );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = nsfdb_test_tools_blob_store_remove_directory(
+	          NSFDB_TEST_TOOLS_BLOB_STORE_PATH );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( temporary_blob_filename != NULL )
+	{
+		nsfdb_test_tools_blob_store_remove_file(
+		 temporary_blob_filename );
+
+		memory_free(
+		 temporary_blob_filename );
+	}
+	if( blob_store != NULL )
+	{
+		if( blob_store->temporary_blob_filename != NULL )
+		{
+			nsfdb_test_tools_blob_store_remove_file(
+			 blob_store->temporary_blob_filename );
+		}
+		blob_store_free(
+		 &blob_store,
+		 NULL );
+	}
+	nsfdb_test_tools_blob_store_remove_directory(
+	 NSFDB_TEST_TOOLS_BLOB_STORE_SUBDIRECTORY );
+
+	nsfdb_test_tools_blob_store_remove_directory(
+	 NSFDB_TEST_TOOLS_BLOB_STORE_PATH );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	NSFDB_TEST_RUN(
+	 "blob_store_initialize",
+	 nsfdb_test_tools_blob_store_initialize );
+
+	NSFDB_TEST_RUN(
+	 "blob_store_free",
+	 nsfdb_test_tools_blob_store_free );
+
+	NSFDB_TEST_RUN(
+	 "blob_store_open",
+	 nsfdb_test_tools_blob_store_open );
+
+	NSFDB_TEST_RUN(
+	 "blob_store_write_blob",
+	 nsfdb_test_tools_blob_store_write_blob );
+
+	NSFDB_TEST_RUN(
+	 "blob_store_create_temporary_file",
+	 nsfdb_test_tools_blob_store_create_temporary_file );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
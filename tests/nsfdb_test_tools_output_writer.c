@@ -0,0 +1,278 @@
+/*
+ * Tools output writer functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_unused.h"
+
+#include "../nsfdbtools/output_writer.h"
+
+/* The JSON string known answers, the input data can contain NUL bytes
+ * hence the size is stored separately
+ */
+typedef struct nsfdb_test_tools_output_writer_json_string nsfdb_test_tools_output_writer_json_string_t;
+
+struct nsfdb_test_tools_output_writer_json_string
+{
+	/* The input data
+	 */
+	const char *data;
+
+	/* The input data size
+	 */
+	size_t data_size;
+
+	/* The expected output
+	 */
+	const char *expected_string;
+};
+
+nsfdb_test_tools_output_writer_json_string_t nsfdb_test_tools_output_writer_json_strings[ 11 ] = {
+	/* Empty string */
+	{ "", 0, "\"\"" },
+	/* Printable ASCII shorter than 8 bytes */
+	{ "Subject", 7, "\"Subject\"" },
+	/* Printable ASCII handled by the 8 bytes at a time fast path */
+	{ "Memo from the Domino server", 27, "\"Memo from the Domino server\"" },
+	/* Quotation mark and backslash */
+	{ "a\"b\\c", 5, "\"a\\\"b\\\\c\"" },
+	/* Control characters with a short escape */
+	{ "\b\f\n\r\t", 5, "\"\\b\\f\\n\\r\\t\"" },
+	/* Control characters without a short escape, including NUL and 0x1f */
+	{ "\x00\x01\x1b\x1f", 4, "\"\\u0000\\u0001\\u001b\\u001f\"" },
+	/* The first byte values that do not need to be escaped, 0x7f included */
+	{ " !#[]~\x7f", 7, "\" !#[]~\x7f\"" },
+	/* Bytes 0x80 and above */
+	{ "\x80\xa9\xc3\xa9\xff", 5, "\"\\u0080\\u00a9\\u00c3\\u00a9\\u00ff\"" },
+	/* An escape in the second block of 8 bytes */
+	{ "01234567abc\"defgh", 17, "\"01234567abc\\\"defgh\"" },
+	/* An escape as the last byte of a block of 8 bytes */
+	{ "0123456\n01234567", 16, "\"0123456\\n01234567\"" },
+	/* Every byte of a block of 8 bytes needs to be escaped */
+	{ "\\\\\"\"\x01\x80\t\xfe", 8, "\"\\\\\\\\\\\"\\\"\\u0001\\u0080\\t\\u00fe\"" } };
+
+/* Tests the output_writer_write_json_string function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_output_writer_write_json_string(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	output_writer_t *output_writer   = NULL;
+	size_t expected_string_length    = 0;
+	int json_string_index            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = output_writer_initialize(
+	          &output_writer,
+	          4096,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "output_writer",
+	 output_writer );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, without an output file the data remains in the buffer
+	 */
+	for( json_string_index = 0;
+	     json_string_index < 11;
+	     json_string_index++ )
+	{
+		output_writer->buffer_offset = 0;
+
+		result = output_writer_write_json_string(
+		          output_writer,
+		          (uint8_t *) nsfdb_test_tools_output_writer_json_strings[ json_string_index ].data,
+		          nsfdb_test_tools_output_writer_json_strings[ json_string_index ].data_size,
+		          &error );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		NSFDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_string_length = narrow_string_length(
+		                          nsfdb_test_tools_output_writer_json_strings[ json_string_index ].expected_string );
+
+		NSFDB_TEST_ASSERT_EQUAL_SIZE(
+		 "output_writer->buffer_offset",
+		 output_writer->buffer_offset,
+		 expected_string_length );
+
+		result = memory_compare(
+		          output_writer->buffer,
+		          nsfdb_test_tools_output_writer_json_strings[ json_string_index ].expected_string,
+		          expected_string_length );
+
+		NSFDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	output_writer->buffer_offset = 0;
+
+	/* Test error cases
+	 */
+	result = output_writer_write_json_string(
+	          NULL,
+	          (uint8_t *) "Subject",
+	          7,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_writer_write_json_string(
+	          output_writer,
+	          NULL,
+	          7,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_writer_write_json_string(
+	          output_writer,
+	          (uint8_t *) "Subject",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "output_writer->buffer_offset",
+	 output_writer->buffer_offset,
+	 (size_t) 0 );
+
+	/* Clean up
+	 */
+	result = output_writer_free(
+	          &output_writer,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "output_writer",
+	 output_writer );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_writer != NULL )
+	{
+		output_writer_free(
+		 &output_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	NSFDB_TEST_RUN(
+	 "output_writer_write_json_string",
+	 nsfdb_test_tools_output_writer_write_json_string );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,948 @@
+/*
+ * Tools resume state functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "nsfdb_test_libcerror.h"
+#include "nsfdb_test_macros.h"
+#include "nsfdb_test_unused.h"
+
+#include "../nsfdbtools/resume_state.h"
+
+/* The resume state file is created in the current working directory
+ */
+#define NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME			_SYSTEM_STRING( "nsfdb_test_tools_resume_state.state" )
+#define NSFDB_TEST_TOOLS_RESUME_STATE_TEMPORARY_FILENAME	_SYSTEM_STRING( "nsfdb_test_tools_resume_state.state.tmp" )
+
+/* The item names, which are stored as consecutive end-of-string terminated strings
+ */
+char nsfdb_test_tools_resume_state_item_names[ 13 ] = {
+	'S', 'u', 'b', 'j', 'e', 'c', 't', 0, 'F', 'r', 'o', 'm', 0 };
+
+/* Tests the resume_state_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_resume_state_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	resume_state_t *resume_state   = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = resume_state_initialize(
+	          &resume_state,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "resume_state",
+	 resume_state );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_free(
+	          &resume_state,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "resume_state",
+	 resume_state );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = resume_state_initialize(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	resume_state = (resume_state_t *) 0x12345678UL;
+
+	result = resume_state_initialize(
+	          &resume_state,
+	          &error );
+
+	resume_state = NULL;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resume_state != NULL )
+	{
+		resume_state_free(
+		 &resume_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the resume_state_free function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_resume_state_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = resume_state_free(
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the resume_state_set_item_names function
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_resume_state_set_item_names(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	resume_state_t *resume_state   = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = resume_state_initialize(
+	          &resume_state,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "resume_state",
+	 resume_state );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = resume_state_set_item_names(
+	          resume_state,
+	          nsfdb_test_tools_resume_state_item_names,
+	          13,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "resume_state->item_names_size",
+	 resume_state->item_names_size,
+	 (size_t) 13 );
+
+	result = memory_compare(
+	          resume_state->item_names,
+	          nsfdb_test_tools_resume_state_item_names,
+	          13 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = resume_state_set_item_names(
+	          resume_state,
+	          NULL,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "resume_state->item_names",
+	 resume_state->item_names );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "resume_state->item_names_size",
+	 resume_state->item_names_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = resume_state_set_item_names(
+	          NULL,
+	          nsfdb_test_tools_resume_state_item_names,
+	          13,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resume_state_set_item_names(
+	          resume_state,
+	          NULL,
+	          13,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resume_state_set_item_names(
+	          resume_state,
+	          nsfdb_test_tools_resume_state_item_names,
+	          (size_t) RESUME_STATE_MAXIMUM_ITEM_NAMES_SIZE + 1,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = resume_state_free(
+	          &resume_state,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "resume_state",
+	 resume_state );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resume_state != NULL )
+	{
+		resume_state_free(
+		 &resume_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the resume_state_write and resume_state_read functions
+ * Returns 1 if successful or 0 if not
+ */
+int nsfdb_test_tools_resume_state_write(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	resume_state_t *read_resume_state   = NULL;
+	resume_state_t *resume_state        = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = resume_state_initialize(
+	          &resume_state,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "resume_state",
+	 resume_state );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_initialize(
+	          &read_resume_state,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_resume_state",
+	 read_resume_state );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_set_item_names(
+	          resume_state,
+	          nsfdb_test_tools_resume_state_item_names,
+	          13,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	resume_state->export_mode              = 3;
+	resume_state->note_class_mask          = 0x0104;
+	resume_state->use_checkpoint           = 1;
+	resume_state->initial_checkpoint       = 0x01d2c3b4a5968778ULL;
+	resume_state->checkpoint               = 0x01d2c3b4a5968779ULL;
+	resume_state->has_failed_notes         = 1;
+	resume_state->number_of_notes          = 1000;
+	resume_state->next_note_index          = 500;
+	resume_state->number_of_exported_notes = 498;
+	resume_state->output_offset            = 0x123456789aLL;
+
+	/* Test reading a resume state that does not exist
+	 */
+	result = resume_state_remove(
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_read(
+	          read_resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a write and read round trip
+	 */
+	result = resume_state_write(
+	          resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_TEMPORARY_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_read(
+	          read_resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "read_resume_state->export_mode",
+	 read_resume_state->export_mode,
+	 3 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT16(
+	 "read_resume_state->note_class_mask",
+	 read_resume_state->note_class_mask,
+	 0x0104 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "read_resume_state->use_checkpoint",
+	 read_resume_state->use_checkpoint,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "read_resume_state->initial_checkpoint",
+	 read_resume_state->initial_checkpoint,
+	 (uint64_t) 0x01d2c3b4a5968778ULL );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT64(
+	 "read_resume_state->checkpoint",
+	 read_resume_state->checkpoint,
+	 (uint64_t) 0x01d2c3b4a5968779ULL );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "read_resume_state->has_failed_notes",
+	 read_resume_state->has_failed_notes,
+	 1 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "read_resume_state->number_of_notes",
+	 read_resume_state->number_of_notes,
+	 1000 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "read_resume_state->next_note_index",
+	 read_resume_state->next_note_index,
+	 500 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "read_resume_state->number_of_exported_notes",
+	 read_resume_state->number_of_exported_notes,
+	 498 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT64(
+	 "read_resume_state->output_offset",
+	 (int64_t) read_resume_state->output_offset,
+	 (int64_t) 0x123456789aLL );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "read_resume_state->item_names_size",
+	 read_resume_state->item_names_size,
+	 (size_t) 13 );
+
+	result = memory_compare(
+	          read_resume_state->item_names,
+	          nsfdb_test_tools_resume_state_item_names,
+	          13 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a round trip that replaces the resume state and clears the flags and item names
+	 */
+	resume_state->use_checkpoint   = 0;
+	resume_state->has_failed_notes = 0;
+	resume_state->next_note_index  = 1000;
+
+	result = resume_state_set_item_names(
+	          resume_state,
+	          NULL,
+	          0,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_write(
+	          resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_TEMPORARY_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_read(
+	          read_resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "read_resume_state->use_checkpoint",
+	 read_resume_state->use_checkpoint,
+	 0 );
+
+	NSFDB_TEST_ASSERT_EQUAL_UINT8(
+	 "read_resume_state->has_failed_notes",
+	 read_resume_state->has_failed_notes,
+	 0 );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "read_resume_state->next_note_index",
+	 read_resume_state->next_note_index,
+	 1000 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "read_resume_state->item_names",
+	 read_resume_state->item_names );
+
+	NSFDB_TEST_ASSERT_EQUAL_SIZE(
+	 "read_resume_state->item_names_size",
+	 read_resume_state->item_names_size,
+	 (size_t) 0 );
+
+	/* Test reading a resume state with a next note index beyond the number of notes
+	 */
+	resume_state->next_note_index = 1001;
+
+	result = resume_state_write(
+	          resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_TEMPORARY_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_read(
+	          read_resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading a resume state with more exported notes than processed notes
+	 */
+	resume_state->next_note_index          = 500;
+	resume_state->number_of_exported_notes = 501;
+
+	result = resume_state_write(
+	          resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_TEMPORARY_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_read(
+	          read_resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test removing the resume state
+	 */
+	result = resume_state_remove(
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_remove(
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = resume_state_write(
+	          NULL,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_TEMPORARY_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resume_state_write(
+	          resume_state,
+	          NULL,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_TEMPORARY_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resume_state_write(
+	          resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	resume_state->number_of_notes = -1;
+
+	result = resume_state_write(
+	          resume_state,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_TEMPORARY_FILENAME,
+	          &error );
+
+	resume_state->number_of_notes = 1000;
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resume_state_read(
+	          NULL,
+	          NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = resume_state_read(
+	          read_resume_state,
+	          NULL,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	NSFDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = resume_state_free(
+	          &read_resume_state,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "read_resume_state",
+	 read_resume_state );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = resume_state_free(
+	          &resume_state,
+	          &error );
+
+	NSFDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "resume_state",
+	 resume_state );
+
+	NSFDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	resume_state_remove(
+	 NSFDB_TEST_TOOLS_RESUME_STATE_FILENAME,
+	 NULL );
+
+	if( read_resume_state != NULL )
+	{
+		resume_state_free(
+		 &read_resume_state,
+		 NULL );
+	}
+	if( resume_state != NULL )
+	{
+		resume_state_free(
+		 &resume_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc NSFDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] NSFDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argc )
+	NSFDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	NSFDB_TEST_RUN(
+	 "resume_state_initialize",
+	 nsfdb_test_tools_resume_state_initialize );
+
+	NSFDB_TEST_RUN(
+	 "resume_state_free",
+	 nsfdb_test_tools_resume_state_free );
+
+	NSFDB_TEST_RUN(
+	 "resume_state_set_item_names",
+	 nsfdb_test_tools_resume_state_set_item_names );
+
+	NSFDB_TEST_RUN(
+	 "resume_state_write",
+	 nsfdb_test_tools_resume_state_write );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Script to validate an Apache Arrow IPC stream written by nsfdbexport
+#
+# Requires pyarrow to be installed on the system, returns 77 to indicate
+# the test was skipped if it is not installed.
+#
+# Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import sys
+
+try:
+  import pyarrow
+  import pyarrow.ipc
+except ImportError:
+  pyarrow = None
+
+
+EXIT_SKIPPED = 77
+
+NOTE_COLUMNS = [
+    ('identifier', 'uint32'),
+    ('sequence_number', 'uint32'),
+    ('modification_time', 'uint64'),
+    ('note_class', 'uint16'),
+    ('status_flags', 'uint16'),
+    ('recovered', 'bool')]
+
+
+def Main():
+  """Validates an Apache Arrow IPC stream.
+
+  Returns:
+    int: exit code that is 0 if the stream is valid, 1 if not or 77 if
+        pyarrow is not available.
+  """
+  argument_parser = argparse.ArgumentParser(description=(
+      'Validates an Apache Arrow IPC stream written by nsfdbexport.'))
+
+  argument_parser.add_argument(
+      '-n', '--item_names', dest='item_names', default='', action='store',
+      metavar='ITEM_NAMES', help=(
+          'comma separated names of the items exported as columns.'))
+
+  argument_parser.add_argument(
+      '-r', '--minimum_rows', dest='minimum_rows', default=1, type=int,
+      action='store', metavar='NUMBER', help=(
+          'minimum number of rows the stream should contain.'))
+
+  argument_parser.add_argument(
+      'source', nargs='?', action='store', metavar='PATH', default=None,
+      help='path of the Apache Arrow IPC stream.')
+
+  options = argument_parser.parse_args()
+
+  if not options.source:
+    print('Source value is missing.')
+    print('')
+    argument_parser.print_help()
+    print('')
+    return 1
+
+  if pyarrow is None:
+    print('Unable to validate stream: pyarrow is not installed.')
+    return EXIT_SKIPPED
+
+  try:
+    with pyarrow.OSFile(options.source, 'rb') as file_object:
+      table = pyarrow.ipc.open_stream(file_object).read_all()
+
+  except pyarrow.ArrowInvalid as exception:
+    print(f'Unable to read stream with error: {exception!s}')
+    return 1
+
+  expected_columns = list(NOTE_COLUMNS)
+  if options.item_names:
+    expected_columns.extend([
+        (item_name, 'string')
+        for item_name in options.item_names.split(',')])
+
+  if len(table.schema) != len(expected_columns):
+    print((f'Unexpected number of columns: {len(table.schema):d}, expected: '
+           f'{len(expected_columns):d}.'))
+    return 1
+
+  for field, (column_name, column_type) in zip(
+      table.schema, expected_columns):
+    if field.name != column_name:
+      print(f'Unexpected column: {field.name:s}, expected: {column_name:s}.')
+      return 1
+
+    if str(field.type) != column_type:
+      print((f'Unexpected type: {field.type!s} of column: {field.name:s}, '
+             f'expected: {column_type:s}.'))
+      return 1
+
+  if table.num_rows < options.minimum_rows:
+    print((f'Unexpected number of rows: {table.num_rows:d}, expected at '
+           f'least: {options.minimum_rows:d}.'))
+    return 1
+
+  table.validate(full=True)
+
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(Main())
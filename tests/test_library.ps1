@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "bucket error io_handle note note_item_class note_item_type note_value notify rrv_bucket rrv_bucket_descriptor rrv_value unique_name_key"
+$LibraryTests = "bucket bucket_history cache_pool column_scan compression error file_io_pool_entry index_file io_handle note note_filter note_index note_item_class note_item_type note_recovery note_value notify recovery rrv_bucket rrv_bucket_descriptor rrv_value scan_predicate structure_map text_index unique_name_key"
 $LibraryTestsWithInput = "file support"
 $OptionSets = "" -split " "
 
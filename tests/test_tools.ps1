@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = ""
+$ToolsTests = "batch_handle blob_store output_writer resume_state sha256_context"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1
@@ -99,6 +99,21 @@ If (-Not (Test-Path ${TestExecutablesDirectory}))
 
 $Result = ${ExitSuccess}
 
+Foreach (${TestName} in ${ToolsTests} -split " ")
+{
+	# Split will return an array of a single empty string when ToolsTests is empty.
+	If (-Not (${TestName}))
+	{
+		Continue
+	}
+	$ResultRun = RunTestBinary ${TestExecutablesDirectory} "nsfdb_test_tools_${TestName}"
+
+	If ((${ResultRun} -ne ${ExitSuccess}) -And (${ResultRun} -ne ${ExitIgnore}))
+	{
+		$Result = ${ResultRun}
+	}
+}
+
 $Profiles = @("nsfdbinfo")
 
 For ($ProfileIndex = 0; $ProfileIndex -le ($Profiles.length - 1); $ProfileIndex += 1)